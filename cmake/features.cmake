@@ -26,8 +26,12 @@ endif()
 
 ie_dependent_option (ENABLE_ONEDNN_FOR_GPU "Enable oneDNN with GPU support" ON "ENABLE_ONEDNN_FOR_GPU_DEFAULT" OFF)
 
+ie_dependent_option (ENABLE_INTEL_GPU_LEVEL_ZERO "Enable Level Zero runtime of GPU plugin, requires Level Zero loader" OFF "ENABLE_INTEL_GPU" OFF)
+
 ie_option (ENABLE_PROFILING_ITT "Build with ITT tracing. Optionally configure pre-built ittnotify library though INTEL_VTUNE_DIR variable." OFF)
 
+ie_option (ENABLE_PROFILING_COUNTERS "Build with the built-in counters backend of the ITT scopes, which aggregates their durations in the process without VTune. ITT tracing takes precedence." OFF)
+
 ie_option_enum(ENABLE_PROFILING_FILTER "Enable or disable ITT counter groups.\
 Supported values:\
  ALL - enable all ITT counters (default value)\
@@ -38,7 +42,8 @@ ie_option (ENABLE_PROFILING_FIRST_INFERENCE "Build with ITT tracing of first inf
 
 ie_option_enum(SELECTIVE_BUILD "Enable OpenVINO conditional compilation or statistics collection. \
 In case SELECTIVE_BUILD is enabled, the SELECTIVE_BUILD_STAT variable should contain the path to the collected InelSEAPI statistics. \
-Usage: -DSELECTIVE_BUILD=ON -DSELECTIVE_BUILD_STAT=/path/*.csv" OFF
+Usage: -DSELECTIVE_BUILD=ON -DSELECTIVE_BUILD_STAT=/path/*.csv. \
+The COLLECT build with the SELECTIVE_BUILD_MODELS list of the models has the selective_build_stat target collecting their statistics" OFF
                ALLOWED_VALUES ON OFF COLLECT)
 
 ie_option(ENABLE_ERROR_HIGHLIGHT "Highlight errors and warnings during compile time" OFF)
@@ -124,6 +129,8 @@ ie_dependent_option (ENABLE_BEH_TESTS "tests oriented to check inference engine
 
 ie_dependent_option (ENABLE_FUNCTIONAL_TESTS "functional tests" ON "ENABLE_TESTS" OFF)
 
+ie_dependent_option (ENABLE_CPU_BENCHMARKS "microbenchmarks of the CPU plugin nodes, require google-benchmark" OFF "ENABLE_TESTS;ENABLE_INTEL_CPU" OFF)
+
 ie_dependent_option (ENABLE_SAMPLES "console samples are part of inference engine package" ON "NOT MINGW" OFF)
 
 ie_option (ENABLE_OPENCV "enables OpenCV" ON)
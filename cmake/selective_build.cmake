@@ -0,0 +1,61 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+
+#
+# The `selective_build_stat` target of the SELECTIVE_BUILD=COLLECT build runs benchmark_app with each model of
+# SELECTIVE_BUILD_MODELS on each device of SELECTIVE_BUILD_DEVICES under the ITT collector and stores the statistics
+# to SELECTIVE_BUILD_STAT_DIR. The trimmed build is configured with -DSELECTIVE_BUILD=ON
+# -DSELECTIVE_BUILD_STAT=<SELECTIVE_BUILD_STAT_DIR>/*.csv, see selective_build.py which drives both builds.
+#
+
+if(NOT SELECTIVE_BUILD STREQUAL "COLLECT" OR NOT SELECTIVE_BUILD_MODELS)
+    return()
+endif()
+
+if(NOT ENABLE_PROFILING_ITT)
+    message(FATAL_ERROR "SELECTIVE_BUILD_MODELS requires ENABLE_PROFILING_ITT to collect the statistics")
+endif()
+if(NOT TARGET benchmark_app)
+    message(FATAL_ERROR "SELECTIVE_BUILD_MODELS requires ENABLE_SAMPLES to run the models with benchmark_app")
+endif()
+
+find_package(PythonInterp 3 REQUIRED)
+
+set(SELECTIVE_BUILD_DEVICES "CPU" CACHE STRING "Devices to run SELECTIVE_BUILD_MODELS on to collect the statistics")
+set(SELECTIVE_BUILD_STAT_DIR "${CMAKE_BINARY_DIR}/selective_build_stat" CACHE PATH
+    "Directory to store the statistics collected with SELECTIVE_BUILD_MODELS to")
+
+set(models)
+foreach(model IN LISTS SELECTIVE_BUILD_MODELS)
+    # a directory stands for all the models in it
+    if(IS_DIRECTORY "${model}")
+        file(GLOB_RECURSE dir_models "${model}/*.xml" "${model}/*.onnx")
+        list(APPEND models ${dir_models})
+    elseif(EXISTS "${model}")
+        list(APPEND models "${model}")
+    else()
+        message(FATAL_ERROR "SELECTIVE_BUILD_MODELS: ${model} does not exist")
+    endif()
+endforeach()
+
+set(collect_args)
+foreach(model IN LISTS models)
+    list(APPEND collect_args -m "${model}")
+endforeach()
+foreach(device IN LISTS SELECTIVE_BUILD_DEVICES)
+    list(APPEND collect_args -d "${device}")
+endforeach()
+
+add_custom_target(selective_build_stat
+                  COMMAND ${PYTHON_EXECUTABLE}
+                          ${OpenVINO_SOURCE_DIR}/src/common/conditional_compilation/scripts/selective_build.py collect
+                          --sea_runtool ${OpenVINO_SOURCE_DIR}/thirdparty/itt_collector/runtool/sea_runtool.py
+                          --collector_dir $<TARGET_FILE_DIR:sea_itt_lib>
+                          --benchmark_app $<TARGET_FILE:benchmark_app>
+                          --out ${SELECTIVE_BUILD_STAT_DIR}
+                          ${collect_args}
+                  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
+                  COMMENT "Collecting selective build statistics of ${models}"
+                  VERBATIM)
+add_dependencies(selective_build_stat benchmark_app sea_itt_lib ie_plugins ov_frontends)
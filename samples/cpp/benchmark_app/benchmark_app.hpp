@@ -83,6 +83,22 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for open-loop load target
+static const char target_qps_message[] =
+    "Optional. Generates the open-loop load of the asynchronous requests arriving at the given rate (requests per "
+    "second) instead of resubmitting each request on completion. The latencies are measured from the scheduled "
+    "arrivals, so the time waiting for an idle request is included. The default value is 0 (closed loop).";
+
+/// @brief message for open-loop arrivals
+static const char arrivals_message[] =
+    "Optional. Arrivals of the open-loop load: \"poisson\" (exponential intervals) or \"constant\". The default "
+    "value is \"poisson\".";
+
+/// @brief message for the scenario of several models
+static const char scenario_message[] =
+    "Optional. Path to the JSON file of the models to benchmark concurrently on the device, each with its own "
+    "\"hint\", \"nstreams\", \"nireq\", \"target_qps\" and \"arrivals\". Replaces the -m option.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -179,6 +195,12 @@ static const char data_shape_message[] =
     " or \"input1[1,192][1,384],input2[1,192][1,384],input3[1,192][1,384],input4[1,192][1,384]\"."
     " If network shapes are all static specifying the option will cause an exception.";
 
+static const char data_shape_trace_message[] =
+    "Optional. Path to the text file with the recorded shapes of the input blobs to replay, one inference per line"
+    " in the -data_shape syntax for one shape: \"[1,3,224,224]\" or \"input1[1,128],input2[1,128]\"."
+    " Empty lines and lines starting with '#' are skipped. The inferences are done in the order of the lines and the"
+    " latencies are reported for each unique shape. Can't be used together with -data_shape.";
+
 static const char layout_message[] =
     "Optional. Prompts how network layouts should be treated by application. "
     "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
@@ -191,6 +213,12 @@ static const char cache_dir_message[] = "Optional. Enables caching of loaded mod
 static const char load_from_file_message[] = "Optional. Loads model from file directly without ReadNetwork."
                                              " All CNNNetwork options (like re-shape) will be ignored";
 
+// @brief message for the load time breakdown option
+static const char load_breakdown_message[] =
+    "Optional. Report the time of the model loading phases: reading the model files, the frontend conversion, the "
+    "transformations (the slowest passes), the plugin graph build and the kernels compilation, the cache import and "
+    "export, and the first inference compared to the steady state latency.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -275,6 +303,18 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Define parameter for the rate of the open-loop load <br>
+/// It is an optional parameter
+DEFINE_double(target_qps, 0.0, target_qps_message);
+
+/// @brief Define parameter for the arrivals of the open-loop load <br>
+/// It is an optional parameter
+DEFINE_string(arrivals, "poisson", arrivals_message);
+
+/// @brief Define parameter for the scenario of several models <br>
+/// It is an optional parameter
+DEFINE_string(scenario, "", scenario_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -326,6 +366,9 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for input blob shape <br>
 DEFINE_string(data_shape, "", data_shape_message);
 
+/// @brief Define flag for the trace of the input blob shapes <br>
+DEFINE_string(data_shape_trace, "", data_shape_trace_message);
+
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
@@ -350,6 +393,9 @@ DEFINE_string(cache_dir, "", cache_dir_message);
 /// @brief Define flag for load network from model file by name without ReadNetwork <br>
 DEFINE_bool(load_from_file, false, load_from_file_message);
 
+/// @brief Define flag for reporting the time of the model loading phases <br>
+DEFINE_bool(load_breakdown, false, load_breakdown_message);
+
 /// @brief Define flag for using input image scale <br>
 DEFINE_string(iscale, "", input_image_scale_message);
 
@@ -384,10 +430,15 @@ static void show_usage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -data_shape               " << data_shape_message << std::endl;
+    std::cout << "    -data_shape_trace \"<path>\"  " << data_shape_trace_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
+    std::cout << "    -load_breakdown           " << load_breakdown_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -target_qps \"<double>\"    " << target_qps_message << std::endl;
+    std::cout << "    -arrivals \"<poisson/constant>\"  " << arrivals_message << std::endl;
+    std::cout << "    -scenario \"<path>\"        " << scenario_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
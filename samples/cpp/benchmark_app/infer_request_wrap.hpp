@@ -51,6 +51,13 @@ public:
         _request.start_async();
     }
 
+    // The latency of the open-loop request is measured from its scheduled arrival, so the time it waited for the idle
+    // request is included (no coordinated omission)
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = std::min(arrivalTime, Time::now());
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
@@ -146,7 +153,15 @@ public:
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
+    // The hook is called on the completion of each request, before it becomes idle
+    void set_completion_hook(std::function<void()> hook) {
+        _completionHook = std::move(hook);
+    }
+
     void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
+        if (_completionHook) {
+            _completionHook();
+        }
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
         if (enable_lat_groups) {
@@ -194,4 +209,5 @@ private:
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
+    std::function<void()> _completionHook;
 };
@@ -21,4 +21,6 @@ std::map<std::string, ov::TensorVector> get_tensors_static_case(const std::vecto
                                                                 benchmark_app::InputsInfo& app_inputs_info,
                                                                 size_t requestsNum);
 
+ov::Tensor get_random_tensor(const std::pair<std::string, benchmark_app::InputInfo>& inputInfo);
+
 void copy_tensor_data(ov::Tensor& dst, const ov::Tensor& src);
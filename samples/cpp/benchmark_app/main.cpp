@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -26,6 +28,7 @@
 #include "inputs_filling.hpp"
 #include "progress_bar.hpp"
 #include "remote_tensors_filling.hpp"
+#include "scenario.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 // clang-format on
@@ -43,18 +46,30 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_scenario.empty()) {
         show_usage();
-        throw std::logic_error("Model is required but not set. Please set -m option.");
+        throw std::logic_error("Model is required but not set. Please set -m or -scenario option.");
     }
 
     if (FLAGS_latency_percentile > 100 || FLAGS_latency_percentile < 1) {
         show_usage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
+    if (!FLAGS_data_shape_trace.empty() && !FLAGS_data_shape.empty()) {
+        throw std::logic_error("The -data_shape_trace option can't be used together with -data_shape option.");
+    }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_target_qps < 0) {
+        throw std::logic_error("Incorrect target QPS. Please set -target_qps option to a positive value.");
+    }
+    if (FLAGS_target_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop load (-target_qps option) is supported for the `async` API only.");
+    }
+    if (FLAGS_arrivals != "poisson" && FLAGS_arrivals != "constant") {
+        throw std::logic_error("Incorrect arrivals. Please set -arrivals option to `poisson` or `constant` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
                                "either `throughput`(tput) or `latency' value.");
@@ -106,6 +121,54 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
+/**
+ * @brief Reports the time of the model loading phases measured by the runtime, the transformation passes are
+ * summarized by the slowest ones
+ */
+static void report_load_time_breakdown(const ov::Core& core, const std::shared_ptr<StatisticsReport>& statistics) {
+    std::map<std::string, double> phases;
+    try {
+        phases = core.get_property("", ov::load_time_breakdown);
+    } catch (const std::exception& ex) {
+        slog::warn << "The load time breakdown isn't available: " << ex.what() << slog::endl;
+        return;
+    }
+    const std::string passPrefix = "transformations/";
+    std::vector<std::pair<std::string, double>> passes;
+    slog::info << "Load time breakdown:" << slog::endl;
+    for (const auto& phase : phases) {
+        if (phase.first.compare(0, passPrefix.size(), passPrefix) == 0) {
+            passes.emplace_back(phase.first.substr(passPrefix.size()), phase.second);
+            continue;
+        }
+        // the phases of a stage follow the stage itself
+        const bool nested = phase.first.find('/') != std::string::npos;
+        slog::info << (nested ? "    " : "  ") << phase.first << ": " << double_to_string(phase.second) << " ms"
+                   << slog::endl;
+        if (statistics) {
+            std::string name = phase.first;
+            std::replace(name.begin(), name.end(), '/', '_');
+            statistics->add_parameters(
+                StatisticsReport::Category::EXECUTION_RESULTS,
+                {StatisticsVariant(phase.first + " time (ms)", "load_phase_" + name, phase.second)});
+        }
+    }
+
+    std::sort(passes.begin(),
+              passes.end(),
+              [](const std::pair<std::string, double>& a, const std::pair<std::string, double>& b) {
+                  return a.second > b.second;
+              });
+    constexpr size_t maxPasses = 10;
+    if (!passes.empty()) {
+        slog::info << "  The slowest transformation passes (the nested passes are included in their parents):"
+                   << slog::endl;
+    }
+    for (size_t i = 0; i < std::min(passes.size(), maxPasses); ++i) {
+        slog::info << "    " << passes[i].first << ": " << double_to_string(passes[i].second) << " ms" << slog::endl;
+    }
+}
+
 /**
  * @brief The entry point of the benchmark application
  */
@@ -402,6 +465,22 @@ int main(int argc, char* argv[]) {
             core.set_property(ov::cache_dir(FLAGS_cache_dir));
         }
 
+        if (!FLAGS_scenario.empty()) {
+            // the models of the scenario are read, compiled and measured together with their own settings
+            const uint32_t duration_seconds =
+                FLAGS_t != 0 ? FLAGS_t : device_default_device_duration_in_seconds(device_name);
+            run_scenario(core, FLAGS_scenario, device_name, duration_seconds, FLAGS_latency_percentile, statistics);
+            return 0;
+        }
+
+        // the trace replays its unique shapes as the -data_shape groups, their latencies are reported separately
+        std::string dataShapes = FLAGS_data_shape;
+        std::vector<size_t> shapeTrace;
+        if (!FLAGS_data_shape_trace.empty()) {
+            shapeTrace = read_shape_trace(FLAGS_data_shape_trace, dataShapes);
+        }
+        const bool pcseq = FLAGS_pcseq || !shapeTrace.empty();
+
         bool isDynamicNetwork = false;
 
         if (FLAGS_load_from_file && !isNetworkCompiled) {
@@ -424,7 +503,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               batchSize,
-                                              FLAGS_data_shape,
+                                              dataShapes,
                                               inputFiles,
                                               FLAGS_iscale,
                                               FLAGS_imean,
@@ -463,7 +542,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               FLAGS_b,
-                                              FLAGS_data_shape,
+                                              dataShapes,
                                               inputFiles,
                                               FLAGS_iscale,
                                               FLAGS_imean,
@@ -618,7 +697,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               FLAGS_b,
-                                              FLAGS_data_shape,
+                                              dataShapes,
                                               inputFiles,
                                               FLAGS_iscale,
                                               FLAGS_imean,
@@ -733,6 +812,11 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("number of iterations", "iterations_num", niter),
                      StatisticsVariant("number of parallel infer requests", "nireq", nireq),
                      StatisticsVariant("duration (ms)", "duration", get_duration_in_milliseconds(duration_seconds))}));
+            if (FLAGS_target_qps > 0) {
+                statistics->add_parameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                           {StatisticsVariant("target QPS", "target_qps", FLAGS_target_qps),
+                                            StatisticsVariant("arrivals", "arrivals", FLAGS_arrivals)});
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -751,7 +835,7 @@ int main(int argc, char* argv[]) {
         // ----------------------------------------
         next_step();
 
-        InferRequestsQueue inferRequestsQueue(compiledModel, nireq, app_inputs_info.size(), FLAGS_pcseq);
+        InferRequestsQueue inferRequestsQueue(compiledModel, nireq, app_inputs_info.size(), pcseq);
 
         bool inputHasName = false;
         if (inputFiles.size() > 0) {
@@ -792,6 +876,17 @@ int main(int argc, char* argv[]) {
                     nireq);
             }
         }
+        if (!shapeTrace.empty()) {
+            // the shapes which don't fit the number of the input files are dropped while filling the tensors
+            bool traceFitsTensors = app_inputs_info.size() > *std::max_element(shapeTrace.begin(), shapeTrace.end());
+            for (const auto& data : inputsData) {
+                traceFitsTensors = traceFitsTensors && data.second.size() % app_inputs_info.size() == 0;
+            }
+            if (!traceFitsTensors) {
+                throw std::logic_error("The number of the input files must be a multiple of the number of the unique "
+                                       "shapes of the data shape trace.");
+            }
+        }
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
         size_t progressCnt = 0;
@@ -805,6 +900,9 @@ int main(int argc, char* argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (FLAGS_target_qps > 0) {
+                ss << " at " << FLAGS_target_qps << " QPS of " << FLAGS_arrivals << " arrivals";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -906,37 +1004,57 @@ int main(int argc, char* argv[]) {
 
         inferRequestsQueue.wait_all();
 
-        auto duration_ms = inferRequestsQueue.get_latencies()[0];
-        slog::info << "First inference took " << double_to_string(duration_ms) << " ms" << slog::endl;
+        const auto firstInferenceDuration = inferRequestsQueue.get_latencies()[0];
+        slog::info << "First inference took " << double_to_string(firstInferenceDuration) << " ms" << slog::endl;
 
         if (statistics) {
             statistics->add_parameters(
                 StatisticsReport::Category::EXECUTION_RESULTS,
-                {StatisticsVariant("first inference time (ms)", "first_inference_time", duration_ms)});
+                {StatisticsVariant("first inference time (ms)", "first_inference_time", firstInferenceDuration)});
         }
         inferRequestsQueue.reset_times();
 
+        // the graphs and the kernels may be created on the first inference, so the phases are collected after it
+        if (FLAGS_load_breakdown) {
+            report_load_time_breakdown(core, statistics);
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // The open-loop load: the requests are started at the scheduled arrivals regardless of the completions
+        const bool openLoop = FLAGS_target_qps > 0;
+        std::mt19937 arrivalsGenerator;
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_target_qps : 1.0);
+        auto nextArrivalTime = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            const auto arrivalTime = nextArrivalTime;
+            if (openLoop) {
+                std::this_thread::sleep_until(arrivalTime);
+                const double interval = FLAGS_arrivals == "constant" ? 1.0 / FLAGS_target_qps
+                                                                     : poissonIntervals(arrivalsGenerator);
+                nextArrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
             }
 
             if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+                const size_t groupId = shapeTrace.empty() ? iteration % app_inputs_info.size()
+                                                          : shapeTrace[iteration % shapeTrace.size()];
+                auto inputs = app_inputs_info[groupId];
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                if (pcseq) {
+                    inferRequest->set_latency_group_id(groupId);
                 }
 
                 if (isDynamicNetwork) {
@@ -955,8 +1073,14 @@ int main(int argc, char* argv[]) {
 
                 for (auto& item : inputs) {
                     auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+                    const auto& tensors = inputsData.at(inputName);
+                    // the tensors are prepared for the groups in turn, so the group of the trace takes every
+                    // app_inputs_info.size()-th one
+                    const size_t groups = app_inputs_info.size();
+                    const size_t tensorId = shapeTrace.empty()
+                                                ? iteration % tensors.size()
+                                                : groupId + groups * (iteration % (tensors.size() / groups));
+                    inferRequest->set_tensor(inputName, tensors[tensorId]);
                 }
 
                 if (useGpuMem) {
@@ -978,7 +1102,11 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->start_async();
+                if (openLoop) {
+                    inferRequest->start_async(arrivalTime);
+                } else {
+                    inferRequest->start_async();
+                }
             }
             ++iteration;
 
@@ -1004,7 +1132,7 @@ int main(int argc, char* argv[]) {
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
-        if (FLAGS_pcseq && app_inputs_info.size() > 1) {
+        if (pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
             for (int i = 0; i < lat_groups.size(); i++) {
                 const auto& lats = lat_groups[i];
@@ -1020,6 +1148,32 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // the CPU plugin counts the lookups of its primitive caches, each miss recompiles the primitives for new shapes
+        std::map<std::string, uint64_t> runtimeCacheStats;
+        if (isDynamicNetwork) {
+            try {
+                runtimeCacheStats =
+                    compiledModel.get_property("CPU_RUNTIME_CACHE_STATS").as<std::map<std::string, uint64_t>>();
+            } catch (const std::exception&) {
+                // the other devices don't report it
+            }
+        }
+        const uint64_t cacheLookups = runtimeCacheStats.empty()
+                                          ? 0
+                                          : runtimeCacheStats.at("hits") + runtimeCacheStats.at("misses");
+
+        if (FLAGS_load_breakdown && generalLatency.median_or_percentile > 0) {
+            const double coldStartRatio = firstInferenceDuration / generalLatency.median_or_percentile;
+            slog::info << "First inference took " << double_to_string(coldStartRatio)
+                       << " times the steady state latency" << slog::endl;
+            if (statistics)
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("first inference to steady state latency ratio",
+                                       "first_inference_latency_ratio",
+                                       coldStartRatio)});
+        }
+
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / generalLatency.median_or_percentile
                                            : 1000.0 * processedFramesN / totalDuration;
@@ -1043,8 +1197,30 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max),
                      StatisticsVariant("throughput", "throughput", fps)});
+                // the group of the general latency keeps its histogram in the JSON report
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("Latency metrics", "latency_metrics", generalLatency)});
+                for (const auto& percentile : generalLatency.percentiles) {
+                    std::ostringstream label, name;
+                    label << "P" << percentile.first << " latency (ms)";
+                    name << "latency_p" << percentile.first;
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                               {StatisticsVariant(label.str(), name.str(), percentile.second)});
+                }
+
+                if (cacheLookups != 0) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("primitive cache hit rate",
+                                           "primitive_cache_hit_rate",
+                                           static_cast<double>(runtimeCacheStats.at("hits")) / cacheLookups),
+                         StatisticsVariant("primitive recompilations",
+                                           "primitive_recompilations",
+                                           static_cast<unsigned long long>(runtimeCacheStats.at("misses")))});
+                }
 
-                if (FLAGS_pcseq && app_inputs_info.size() > 1) {
+                if (pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
                             StatisticsReport::Category::EXECUTION_RESULTS_GROUPPED,
@@ -1100,7 +1276,7 @@ int main(int argc, char* argv[]) {
             slog::info << "Latency: " << slog::endl;
             generalLatency.write_to_slog();
 
-            if (FLAGS_pcseq && app_inputs_info.size() > 1) {
+            if (pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
                 for (size_t i = 0; i < app_inputs_info.size(); ++i) {
                     slog::info << (i + 1) << ".";
@@ -1117,6 +1293,10 @@ int main(int argc, char* argv[]) {
                 }
             }
         }
+        if (cacheLookups != 0) {
+            slog::info << "Primitive cache: " << double_to_string(100.0 * runtimeCacheStats.at("hits") / cacheLookups)
+                       << "% hits, " << runtimeCacheStats.at("misses") << " recompilations" << slog::endl;
+        }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
@@ -0,0 +1,266 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/slog.hpp"
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "scenario.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace {
+/// @brief The model of the scenario with its own runtime settings
+struct ScenarioModel {
+    std::string path;
+    std::string hint;
+    std::string nstreams;
+    uint32_t nireq = 0;
+    double target_qps = 0;
+    std::string arrivals = "poisson";
+};
+
+/// @brief Accumulates the time at least one request of any model is in flight on the device
+class DeviceOccupancy {
+public:
+    void request_started() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_inFlight++ == 0) {
+            _busyStart = Time::now();
+        }
+    }
+
+    void request_finished() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_inFlight == 0) {
+            _busyTime += Time::now() - _busyStart;
+        }
+    }
+
+    double get_busy_time_in_milliseconds() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return std::chrono::duration_cast<ns>(_busyTime).count() * 0.000001;
+    }
+
+private:
+    std::mutex _mutex;
+    size_t _inFlight = 0;
+    Time::time_point _busyStart;
+    Time::duration _busyTime = Time::duration::zero();
+};
+
+std::vector<ScenarioModel> read_scenario(const std::string& filename) {
+    std::ifstream ifs(filename);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't load scenario file \"" + filename + "\".");
+    }
+
+    nlohmann::json jsonScenario;
+    try {
+        ifs >> jsonScenario;
+    } catch (const nlohmann::json::parse_error& e) {
+        throw std::runtime_error("Can't parse scenario file \"" + filename + "\".\n" + e.what());
+    }
+
+    std::vector<ScenarioModel> models;
+    for (const auto& item : jsonScenario.at("models")) {
+        ScenarioModel model;
+        model.path = item.at("path").get<std::string>();
+        model.hint = item.value("hint", "");
+        if (item.contains("nstreams")) {
+            const auto& nstreams = item.at("nstreams");
+            model.nstreams = nstreams.is_string() ? nstreams.get<std::string>() : std::to_string(nstreams.get<int>());
+        }
+        model.nireq = item.value("nireq", 0u);
+        model.target_qps = item.value("target_qps", 0.0);
+        model.arrivals = item.value("arrivals", "poisson");
+        if (!model.hint.empty() && model.hint != "throughput" && model.hint != "tput" && model.hint != "latency") {
+            throw std::logic_error("Incorrect performance hint of " + model.path +
+                                   " in the scenario, it must be either `throughput`(tput) or `latency'.");
+        }
+        if (model.target_qps < 0 || (model.arrivals != "poisson" && model.arrivals != "constant")) {
+            throw std::logic_error("Incorrect load of " + model.path +
+                                   " in the scenario, the target QPS must be positive and the arrivals must be "
+                                   "either `poisson` or `constant`.");
+        }
+        models.push_back(model);
+    }
+    if (models.empty()) {
+        throw std::logic_error("The scenario file \"" + filename + "\" has no models.");
+    }
+    return models;
+}
+
+/// @brief The compiled model of the scenario and its requests
+struct ModelRun {
+    ScenarioModel desc;
+    ov::CompiledModel compiledModel;
+    std::unique_ptr<InferRequestsQueue> requests;
+    size_t iterations = 0;
+};
+
+void fill_random_inputs(ModelRun& run) {
+    for (auto& request : run.requests->requests) {
+        for (const auto& input : run.compiledModel.inputs()) {
+            if (input.get_partial_shape().is_dynamic()) {
+                throw std::logic_error("The models with dynamic shapes aren't supported in the scenario, " +
+                                       run.desc.path + " has the dynamic input " + input.get_any_name() + ".");
+            }
+            benchmark_app::InputInfo info;
+            info.type = input.get_element_type();
+            info.partialShape = input.get_partial_shape();
+            info.dataShape = input.get_shape();
+            auto requestTensor = request->get_tensor(input.get_any_name());
+            copy_tensor_data(requestTensor, get_random_tensor({input.get_any_name(), info}));
+        }
+    }
+}
+
+void run_model(ModelRun& run, DeviceOccupancy& occupancy, uint64_t duration_nanoseconds, unsigned seed) {
+    const bool openLoop = run.desc.target_qps > 0;
+    std::mt19937 arrivalsGenerator(seed);
+    std::exponential_distribution<double> poissonIntervals(openLoop ? run.desc.target_qps : 1.0);
+
+    const auto startTime = Time::now();
+    auto nextArrivalTime = startTime;
+    while ((uint64_t)std::chrono::duration_cast<ns>(Time::now() - startTime).count() < duration_nanoseconds) {
+        const auto arrivalTime = nextArrivalTime;
+        if (openLoop) {
+            std::this_thread::sleep_until(arrivalTime);
+            const double interval =
+                run.desc.arrivals == "constant" ? 1.0 / run.desc.target_qps : poissonIntervals(arrivalsGenerator);
+            nextArrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+        }
+        auto request = run.requests->get_idle_request();
+        // rethrows the error of the previous inference of the request
+        request->wait();
+        occupancy.request_started();
+        if (openLoop) {
+            request->start_async(arrivalTime);
+        } else {
+            request->start_async();
+        }
+        ++run.iterations;
+    }
+    run.requests->wait_all();
+}
+}  // namespace
+
+void run_scenario(ov::Core& core,
+                  const std::string& scenario_file,
+                  const std::string& device_name,
+                  uint32_t duration_seconds,
+                  size_t latency_percentile,
+                  const std::shared_ptr<StatisticsReport>& statistics) {
+    const auto models = read_scenario(scenario_file);
+    DeviceOccupancy occupancy;
+
+    std::vector<ModelRun> runs(models.size());
+    for (size_t i = 0; i < models.size(); ++i) {
+        auto& run = runs[i];
+        run.desc = models[i];
+
+        ov::AnyMap modelConfig;
+        if (run.desc.hint == "latency") {
+            modelConfig.emplace(ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+        } else if (!run.desc.hint.empty()) {
+            modelConfig.emplace(ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT));
+        }
+        if (!run.desc.nstreams.empty()) {
+            modelConfig[ov::streams::num.name()] = run.desc.nstreams;
+        }
+        auto startTime = Time::now();
+        run.compiledModel = core.compile_model(run.desc.path, device_name, modelConfig);
+        slog::info << "Load network " << run.desc.path << " took " << double_to_string(get_duration_ms_till_now(startTime))
+                   << " ms" << slog::endl;
+
+        uint32_t nireq = run.desc.nireq;
+        if (nireq == 0) {
+            nireq = run.compiledModel.get_property(ov::optimal_number_of_infer_requests);
+        }
+        run.requests.reset(new InferRequestsQueue(run.compiledModel, nireq, 1, false));
+        run.requests->set_completion_hook([&occupancy]() {
+            occupancy.request_finished();
+        });
+        fill_random_inputs(run);
+    }
+
+    slog::info << "Start inference of " << runs.size() << " models concurrently, limits: "
+               << get_duration_in_milliseconds(duration_seconds) << " ms duration" << slog::endl;
+
+    const uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
+    std::vector<std::exception_ptr> errors(runs.size());
+    std::vector<std::thread> threads;
+    auto startTime = Time::now();
+    for (size_t i = 0; i < runs.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            try {
+                run_model(runs[i], occupancy, duration_nanoseconds, static_cast<unsigned>(i));
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const double totalDuration = get_duration_ms_till_now(startTime);
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    double totalThroughput = 0;
+    for (size_t i = 0; i < runs.size(); ++i) {
+        auto& run = runs[i];
+        LatencyMetrics latency(run.requests->get_latencies(), run.desc.path, latency_percentile);
+        const double throughput = 1000.0 * run.iterations / run.requests->get_duration_in_milliseconds();
+        totalThroughput += throughput;
+
+        slog::info << "Model " << i << ": " << run.desc.path << slog::endl;
+        slog::info << "Count:      " << run.iterations << " iterations" << slog::endl;
+        slog::info << "Latency: " << slog::endl;
+        latency.write_to_slog();
+        slog::info << "Throughput: " << double_to_string(throughput) << " requests/s" << slog::endl;
+
+        if (statistics) {
+            const std::string prefix = "model " + std::to_string(i) + " ";
+            const std::string json_prefix = "model_" + std::to_string(i) + "_";
+            statistics->add_parameters(
+                StatisticsReport::Category::EXECUTION_RESULTS,
+                {StatisticsVariant(prefix + "iterations", json_prefix + "iterations_num", run.iterations),
+                 StatisticsVariant(prefix + "throughput", json_prefix + "throughput", throughput)});
+            statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS_GROUPPED,
+                                       {StatisticsVariant("Model Latencies", "model_latencies", latency)});
+        }
+    }
+
+    // the share of the time the device had at least one request of any model, the contention shows up as the
+    // throughput lower than the one of the model benchmarked alone at the same occupancy
+    const double occupancyPercent = 100.0 * occupancy.get_busy_time_in_milliseconds() / totalDuration;
+    slog::info << "Aggregated:" << slog::endl;
+    slog::info << "Duration:   " << double_to_string(totalDuration) << " ms" << slog::endl;
+    slog::info << "Throughput: " << double_to_string(totalThroughput) << " requests/s" << slog::endl;
+    slog::info << "Device occupancy: " << double_to_string(occupancyPercent) << " %" << slog::endl;
+    if (statistics) {
+        statistics->add_parameters(
+            StatisticsReport::Category::EXECUTION_RESULTS,
+            {StatisticsVariant("total execution time (ms)", "execution_time", totalDuration),
+             StatisticsVariant("aggregated throughput", "throughput", totalThroughput),
+             StatisticsVariant("device occupancy (%)", "device_occupancy", occupancyPercent)});
+        statistics->dump();
+    }
+}
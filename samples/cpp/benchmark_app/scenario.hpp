@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <string>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+/// @brief Runs the models of the scenario file concurrently on the device and reports the throughput and the latency
+/// of each model and the aggregated device occupancy
+/// @param core The core with the device configuration applied
+/// @param scenario_file The path to the JSON scenario file, see README
+/// @param device_name The device to run the models on
+/// @param duration_seconds The time to run the models
+/// @param latency_percentile The percentile reported in the latency metrics
+/// @param statistics The statistics report, may be null
+void run_scenario(ov::Core& core,
+                  const std::string& scenario_file,
+                  const std::string& device_name,
+                  uint32_t duration_seconds,
+                  size_t latency_percentile,
+                  const std::shared_ptr<StatisticsReport>& statistics);
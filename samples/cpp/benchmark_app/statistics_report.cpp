@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <utility>
@@ -258,6 +259,12 @@ void LatencyMetrics::write_to_slog() const {
     slog::info << "\tAverage:    " << double_to_string(avg) << " ms" << slog::endl;
     slog::info << "\tMin:        " << double_to_string(min) << " ms" << slog::endl;
     slog::info << "\tMax:        " << double_to_string(max) << " ms" << slog::endl;
+    for (const auto& percentile : percentiles) {
+        std::ostringstream label;
+        label << "\tP" << percentile.first << ":";
+        slog::info << std::left << std::setw(13) << label.str() << double_to_string(percentile.second) << " ms"
+                   << slog::endl;
+    }
 }
 
 const nlohmann::json LatencyMetrics::to_json() const {
@@ -267,6 +274,16 @@ const nlohmann::json LatencyMetrics::to_json() const {
     stat["latency_average"] = avg;
     stat["latency_min"] = min;
     stat["latency_max"] = max;
+    for (const auto& percentile : percentiles) {
+        std::ostringstream name;
+        name << "latency_p" << percentile.first;
+        stat[name.str()] = percentile.second;
+    }
+    auto& buckets = stat["latency_histogram"];
+    buckets = nlohmann::json::array();
+    for (const auto& bucket : histogram) {
+        buckets.push_back({{"upper_bound", bucket.first}, {"count", bucket.second}});
+    }
     return stat;
 }
 
@@ -279,6 +296,28 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
     median_or_percentile = latencies[size_t(latencies.size() / 100.0 * percentile_boundary)];
     max = latencies.back();
+
+    percentiles.clear();
+    for (double percentile : {50.0, 90.0, 99.0, 99.9}) {
+        const size_t idx = std::min(latencies.size() - 1, size_t(latencies.size() / 100.0 * percentile));
+        percentiles.emplace_back(percentile, latencies[idx]);
+    }
+
+    // The buckets split each power of 2 of microseconds into the equal sub-buckets, so the relative error of a
+    // latency is the same (below 1 / sub_buckets) from microseconds to seconds; only the filled buckets are kept
+    constexpr size_t sub_buckets = 16;
+    histogram.clear();
+    double upper_bound = 0;
+    for (double latency : latencies) {
+        if (histogram.empty() || latency >= upper_bound) {
+            const double us = std::max(latency * 1000.0, 1.0);
+            const double range_begin = std::exp2(std::floor(std::log2(us)));
+            const double step = range_begin / sub_buckets;
+            upper_bound = (range_begin + step * (std::floor((us - range_begin) / step) + 1)) / 1000.0;
+            histogram.emplace_back(upper_bound, 0);
+        }
+        histogram.back().second++;
+    }
 };
 
 std::string StatisticsVariant::to_string() const {
@@ -45,6 +45,11 @@ public:
     double avg = 0;
     double min = 0;
     double max = 0;
+    // The tail latencies: pairs of the percentile and its latency
+    std::vector<std::pair<double, double>> percentiles;
+    // The latency histogram: pairs of the upper bound of the bucket and the number of the latencies in it, the
+    // buckets have the same relative width like in HDR histogram
+    std::vector<std::pair<double, size_t>> histogram;
     std::string data_shape;
 
 private:
@@ -5,6 +5,7 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <fstream>
 #include <map>
 #include <nlohmann/json.hpp>
 #include <regex>
@@ -94,6 +95,35 @@ std::vector<std::string> split(const std::string& s, char delim) {
     return result;
 }
 
+/// Reads the trace of the data shapes, one inference per line. Returns the index of the unique shape for each
+/// inference, the unique shapes are joined to the -data_shape string in the order of their first use.
+std::vector<size_t> read_shape_trace(const std::string& trace_path, std::string& data_shapes_string) {
+    std::ifstream trace(trace_path);
+    if (!trace.is_open()) {
+        throw std::logic_error("Can't open the data shape trace file " + trace_path);
+    }
+    std::vector<size_t> shape_ids;
+    std::map<std::string, size_t> unique_shapes;
+    data_shapes_string.clear();
+    std::string line;
+    while (std::getline(trace, line)) {
+        line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
+        if (line.empty() || line.front() == '#')
+            continue;
+        auto shape = unique_shapes.emplace(line, unique_shapes.size());
+        if (shape.second) {
+            data_shapes_string += (data_shapes_string.empty() ? "" : ",") + line;
+        }
+        shape_ids.push_back(shape.first->second);
+    }
+    if (shape_ids.empty()) {
+        throw std::logic_error("The data shape trace file " + trace_path + " has no shapes");
+    }
+    slog::info << "The data shape trace has " << shape_ids.size() << " inferences of " << unique_shapes.size()
+               << " unique shapes" << slog::endl;
+    return shape_ids;
+}
+
 std::vector<float> split_float(const std::string& s, char delim) {
     std::vector<float> result;
     std::stringstream ss(s);
@@ -62,6 +62,7 @@ std::string get_shape_string(const ov::Shape& shape);
 std::string get_shapes_string(const benchmark_app::PartialShapes& shapes);
 size_t get_batch_size(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
+std::vector<size_t> read_shape_trace(const std::string& trace_path, std::string& data_shapes_string);
 std::map<std::string, std::vector<float>> parse_scale_or_mean(const std::string& scale_mean,
                                                               const benchmark_app::InputsInfo& inputs_info);
 std::vector<ngraph::Dimension> parse_partial_shape(const std::string& partial_shape);
@@ -58,6 +58,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -303,6 +304,15 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_completion
+ * @brief Represents the completion of the asynchronous request taken from the completion queue
+ */
+typedef struct ie_completion {
+    void *tag;            //!< The tag the request was bound to the queue with
+    IEStatusCode status;  //!< The status of the inference: OK(0) for success
+} ie_completion_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -659,6 +669,19 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_blob(ie_i
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_blob(ie_infer_request_t *infer_request, const char *name, const ie_blob_t *blob);
 
+/**
+ * @brief Binds the user memory to the input/output of the infer request without copying.
+ * The memory is wrapped with the tensor descriptor of the current blob of the request, so it must have the network
+ * input/output precision, dimensions and layout, and must stay valid while the request uses it.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param name Name of input or output blob.
+ * @param ptr Pointer to the user memory.
+ * @param size Length of the user memory in elements.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_blob_memory(ie_infer_request_t *infer_request, const char *name, void *ptr, size_t size);
+
 /**
  * @brief Starts synchronous inference of the infer request and fill outputs.
  * @ingroup InferRequest
@@ -684,6 +707,17 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_infer_async(i
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback);
 
+/**
+ * @brief Sets the completion queue the completions of the asynchronous request are put to, instead of the callback.
+ * The application thread takes them with ie_completion_queue_wait(), so it doesn't run on the inference threads.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance, it must outlive the infer request.
+ * @param tag The user value the completions of the request are put to the queue with.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *tag);
+
 /**
  * @brief Waits for the result to become available. Blocks until specified timeout elapses or the result becomes available, whichever comes first.
  * @ingroup InferRequest
@@ -707,6 +741,57 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_
 
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * @ingroup ie_c_api
+ * Set of functions taking the completions of the asynchronous requests on the application threads.
+ * @{
+ */
+
+/**
+ * @brief Creates the completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the newly created ie_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by the completion queue.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the completion queue to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Takes the first completion from the queue. Blocks until specified timeout elapses or a request completes,
+ * whichever comes first.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param timeout Maximum duration in milliseconds to block for
+ * @note There are special cases when timeout is equal some value of the WaitMode enum:
+ * * 0 - Immediately returns the completion if there is one. It does not block
+ * * -1 - waits until a request completes
+ * @param completion A pointer to the taken completion.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if no request completed in time.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_wait(ie_completion_queue_t *queue, const int64_t timeout, ie_completion_t *completion);
+
+/**
+ * @brief Gets the file descriptor of the completion queue to wait for the completions with poll/epoll.
+ * The descriptor is readable while the queue isn't empty, the completions are taken with ie_completion_queue_wait().
+ * It's owned by the queue and must not be read or closed by the application.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param fd A pointer to the file descriptor.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED on the systems without eventfd.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
@@ -15,6 +15,13 @@
 #include <memory>
 #include <streambuf>
 #include <istream>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "ie_compound_blob.h"
@@ -62,6 +69,18 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This struct keeps the completions of the asynchronous requests until the application takes them
+ */
+struct ie_completion_queue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<ie_completion_t> completions;
+    // eventfd counting the completions in the queue, -1 on the systems without eventfd
+    int fd = -1;
+};
+
 /**
  * @struct mem_stringbuf
  * @brief This struct puts memory buffer to stringbuf.
@@ -244,6 +263,47 @@ void parameter2IEparam(const IE::Parameter param, ie_param_t *ie_param) {
     }
 }
 
+/**
+ *@brief wrap the pre-allocated memory into the blob of the tensor descriptor precision without copying.
+ */
+IE::Blob::Ptr make_blob_from_preallocated(const IE::TensorDesc &tensor, void *ptr, size_t size) {
+    const IE::Precision prec = tensor.getPrecision();
+    if (prec == IE::Precision::U8) {
+        uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::U16) {
+        uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN || prec == IE::Precision::I4 || prec == IE::Precision::U4) {
+        int8_t *p = reinterpret_cast<int8_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+        int16_t *p = reinterpret_cast<int16_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I32) {
+        int32_t *p = reinterpret_cast<int32_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::U32) {
+        uint32_t *p = reinterpret_cast<uint32_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I64) {
+        int64_t *p = reinterpret_cast<int64_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::U64) {
+        uint64_t *p = reinterpret_cast<uint64_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if  (prec == IE::Precision::FP32) {
+        float *p = reinterpret_cast<float *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if  (prec == IE::Precision::FP64) {
+        double *p = reinterpret_cast<double *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else {
+        uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    }
+}
+
 ie_version_t ie_c_api_version(void) {
     auto version = IE::GetInferenceEngineVersion();
     std::string version_str = version->buildNumber;
@@ -1258,6 +1318,23 @@ IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_set_blob_memory(ie_infer_request_t *infer_request, const char *name, void *ptr, size_t size) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || name == nullptr || ptr == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        // the descriptor of the current blob matches the network input/output, so the memory is set as is
+        const IE::TensorDesc tensor = infer_request->object.GetBlob(name)->getTensorDesc();
+        infer_request->object.SetBlob(name, make_blob_from_preallocated(tensor, ptr, size));
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1306,6 +1383,40 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
     return status;
 }
 
+IEStatusCode ie_infer_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *tag) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || queue == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        auto fun = [queue, tag](IE::InferRequest, IE::StatusCode code) {
+            // the map is shared by the callbacks of all the requests, so it's only searched
+            auto it = status_map.find(code);
+            ie_completion_t completion = {tag, it != status_map.end() ? it->second : IEStatusCode::UNEXPECTED};
+            {
+                std::lock_guard<std::mutex> lock(queue->mutex);
+                queue->completions.push_back(completion);
+#ifdef __linux__
+                // the counter is changed under the lock to stay equal to the number of the completions, it can't
+                // overflow so the write doesn't fail
+                if (queue->fd != -1) {
+                    const uint64_t one = 1;
+                    ssize_t written = write(queue->fd, &one, sizeof(one));
+                    (void)written;
+                }
+#endif
+            }
+            queue->cv.notify_one();
+        };
+        infer_request->object.SetCompletionCallback<std::function<void(IE::InferRequest, IE::StatusCode)>>(fun);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1337,6 +1448,79 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_ptr<ie_completion_queue_t> tmp(new ie_completion_queue_t);
+#ifdef __linux__
+        tmp->fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK | EFD_SEMAPHORE);
+        if (tmp->fd == -1) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+#endif
+        *queue = tmp.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+#ifdef __linux__
+        if (*queue && (*queue)->fd != -1) {
+            close((*queue)->fd);
+        }
+#endif
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_completion_queue_wait(ie_completion_queue_t *queue, const int64_t timeout, ie_completion_t *completion) {
+    if (queue == nullptr || completion == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        auto has_completion = [queue] { return !queue->completions.empty(); };
+        if (timeout < 0) {
+            queue->cv.wait(lock, has_completion);
+        } else if (!queue->cv.wait_for(lock, std::chrono::milliseconds(timeout), has_completion)) {
+            return IEStatusCode::RESULT_NOT_READY;
+        }
+        *completion = queue->completions.front();
+        queue->completions.pop_front();
+#ifdef __linux__
+        // the semaphore eventfd is decremented by one, it isn't readable once the queue is empty
+        uint64_t value = 0;
+        if (queue->fd != -1 && read(queue->fd, &value, sizeof(value)) != sizeof(value)) {
+            return IEStatusCode::UNEXPECTED;
+        }
+#endif
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd) {
+    if (queue == nullptr || fd == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    if (queue->fd == -1) {
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
+    *fd = queue->fd;
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1429,40 +1613,7 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
     try {
         IE::TensorDesc tensor(prec, dims_vector, l);
         std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        if (prec == IE::Precision::U8) {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U16) {
-            uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN || prec == IE::Precision::I4 || prec == IE::Precision::U4) {
-            int8_t *p = reinterpret_cast<int8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
-            int16_t *p = reinterpret_cast<int16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I32) {
-            int32_t *p = reinterpret_cast<int32_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U32) {
-            uint32_t *p = reinterpret_cast<uint32_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I64) {
-            int64_t *p = reinterpret_cast<int64_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U64) {
-            uint64_t *p = reinterpret_cast<uint64_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if  (prec == IE::Precision::FP32) {
-            float *p = reinterpret_cast<float *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if  (prec == IE::Precision::FP64) {
-            double *p = reinterpret_cast<double *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        }
+        _blob->object = make_blob_from_preallocated(tensor, ptr, size);
         *blob = _blob.release();
     } CATCH_IE_EXCEPTIONS
 
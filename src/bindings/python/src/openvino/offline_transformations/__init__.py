@@ -18,3 +18,4 @@ from openvino.pyopenvino.offline_transformations import apply_make_stateful_tran
 from openvino.pyopenvino.offline_transformations import serialize
 from openvino.pyopenvino.offline_transformations import compress_model_transformation
 from openvino.pyopenvino.offline_transformations import compress_quantize_weights_transformation
+from openvino.pyopenvino.offline_transformations import compress_weights_transformation
@@ -10,6 +10,7 @@ from openvino.pyopenvino import Core as CoreBase
 from openvino.pyopenvino import CompiledModel as CompiledModelBase
 from openvino.pyopenvino import InferRequest as InferRequestBase
 from openvino.pyopenvino import AsyncInferQueue as AsyncInferQueueBase
+from openvino.pyopenvino import InferPipeline as InferPipelineBase
 from openvino.pyopenvino import ConstOutput
 from openvino.pyopenvino import Tensor
 from openvino.pyopenvino import OVAny as OVAnyBase
@@ -22,7 +23,7 @@ def tensor_from_file(path: str) -> Tensor:
     return Tensor(np.fromfile(path, dtype=np.uint8))
 
 
-def convert_dict_items(inputs: dict, py_types: dict) -> dict:
+def convert_dict_items(inputs: dict, py_types: dict, share_inputs: bool = False) -> dict:
     """Helper function converting dictionary items to Tensors."""
     # Create new temporary dictionary.
     # new_inputs will be used to transfer data to inference calls,
@@ -35,23 +36,36 @@ def convert_dict_items(inputs: dict, py_types: dict) -> dict:
             ov_type = py_types[k]
         except KeyError:
             raise KeyError("Port for tensor {} was not found!".format(k))
-        # Convert numpy arrays or copy Tensors
-        new_inputs[k] = (
-            val
-            if isinstance(val, Tensor)
-            else Tensor(np.array(val, get_dtype(ov_type)))
-        )
+        if isinstance(val, Tensor):
+            new_inputs[k] = val
+            continue
+        dtype = get_dtype(ov_type)
+        # The numpy arrays of the port type and in C order are bound to the request without copying,
+        # the other ones are converted and copied
+        if (
+            share_inputs
+            and isinstance(val, np.ndarray)
+            and val.dtype == dtype
+            and val.flags["C_CONTIGUOUS"]
+        ):
+            new_inputs[k] = Tensor(val, shared_memory=True)
+        else:
+            new_inputs[k] = Tensor(np.asarray(val, dtype))
     return new_inputs
 
 
-def normalize_inputs(inputs: Union[dict, list], py_types: dict) -> dict:
+def normalize_inputs(
+    inputs: Union[dict, list], py_types: dict, share_inputs: bool = False
+) -> dict:
     """Normalize a dictionary of inputs to Tensors."""
     if isinstance(inputs, dict):
-        return convert_dict_items(inputs, py_types)
+        return convert_dict_items(inputs, py_types, share_inputs)
     elif isinstance(inputs, list):
         # Lists are required to be represented as dictionaries with int keys
         return convert_dict_items(
-            {index: input for index, input in enumerate(inputs)}, py_types
+            {index: input for index, input in enumerate(inputs)},
+            py_types,
+            share_inputs,
         )
     else:
         raise TypeError(
@@ -85,18 +99,41 @@ def get_input_types(obj: Union[InferRequestBase, CompiledModelBase]) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest wrapper."""
 
-    def infer(self, inputs: Union[dict, list] = None) -> dict:
-        """Infer wrapper for InferRequest."""
+    def infer(
+        self,
+        inputs: Union[dict, list] = None,
+        share_inputs: bool = False,
+        share_outputs: bool = False,
+    ) -> dict:
+        """Infer wrapper for InferRequest.
+
+        With share_inputs the numpy arrays of the input types in C order are bound to the request
+        without copying, they must be kept alive and unchanged while the request uses them.
+        With share_outputs the returned arrays are views of the output tensors without copying,
+        they are overwritten by the next inference of the request.
+        """
         return super().infer(
-            {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
+            {}
+            if inputs is None
+            else normalize_inputs(inputs, get_input_types(self), share_inputs),
+            share_outputs,
         )
 
     def start_async(
-        self, inputs: Union[dict, list] = None, userdata: Any = None
+        self,
+        inputs: Union[dict, list] = None,
+        userdata: Any = None,
+        share_inputs: bool = False,
     ) -> None:
-        """Asynchronous infer wrapper for InferRequest."""
+        """Asynchronous infer wrapper for InferRequest.
+
+        With share_inputs the numpy arrays of the input types in C order are bound to the request
+        without copying, they must be kept alive and unchanged while the request uses them.
+        """
         super().start_async(
-            {} if inputs is None else normalize_inputs(inputs, get_input_types(self)),
+            {}
+            if inputs is None
+            else normalize_inputs(inputs, get_input_types(self), share_inputs),
             userdata,
         )
 
@@ -108,15 +145,28 @@ class CompiledModel(CompiledModelBase):
         """Create new InferRequest object."""
         return InferRequest(super().create_infer_request())
 
-    def infer_new_request(self, inputs: Union[dict, list] = None) -> dict:
-        """Infer wrapper for CompiledModel."""
+    def infer_new_request(
+        self,
+        inputs: Union[dict, list] = None,
+        share_inputs: bool = False,
+        share_outputs: bool = False,
+    ) -> dict:
+        """Infer wrapper for CompiledModel, see InferRequest.infer for share_inputs and share_outputs."""
         return super().infer_new_request(
-            {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
+            {}
+            if inputs is None
+            else normalize_inputs(inputs, get_input_types(self), share_inputs),
+            share_outputs,
         )
 
-    def __call__(self, inputs: Union[dict, list] = None) -> dict:
+    def __call__(
+        self,
+        inputs: Union[dict, list] = None,
+        share_inputs: bool = False,
+        share_outputs: bool = False,
+    ) -> dict:
         """Callable infer wrapper for CompiledModel."""
-        return self.infer_new_request(inputs)
+        return self.infer_new_request(inputs, share_inputs, share_outputs)
 
 
 class AsyncInferQueue(AsyncInferQueueBase):
@@ -127,19 +177,42 @@ class AsyncInferQueue(AsyncInferQueueBase):
         return InferRequest(super().__getitem__(i))
 
     def start_async(
-        self, inputs: Union[dict, list] = None, userdata: Any = None
+        self,
+        inputs: Union[dict, list] = None,
+        userdata: Any = None,
+        share_inputs: bool = False,
     ) -> None:
-        """Asynchronous infer wrapper for AsyncInferQueue."""
+        """Asynchronous infer wrapper for AsyncInferQueue, see InferRequest.start_async for share_inputs."""
         super().start_async(
             {}
             if inputs is None
             else normalize_inputs(
-                inputs, get_input_types(self[self.get_idle_request_id()])
+                inputs,
+                get_input_types(self[self.get_idle_request_id()]),
+                share_inputs,
             ),
             userdata,
         )
 
 
+class InferPipeline(InferPipelineBase):
+    """InferPipeline wrapper."""
+
+    def submit(
+        self,
+        inputs: Union[dict, list] = None,
+        userdata: Any = None,
+        share_inputs: bool = False,
+    ) -> None:
+        """Submit wrapper for InferPipeline, see InferRequest.start_async for share_inputs."""
+        super().submit(
+            {}
+            if inputs is None
+            else normalize_inputs(inputs, get_input_types(self), share_inputs),
+            userdata,
+        )
+
+
 class Core(CoreBase):
     """Core wrapper."""
 
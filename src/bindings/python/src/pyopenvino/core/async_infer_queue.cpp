@@ -130,8 +130,88 @@ public:
         }
     }
 
+    void set_batched_callbacks(py::function f_callback) {
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
+                _requests[handle]._end_time = Time::now();
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    throw ov::Exception(e.what());
+                }
+                {
+                    // acquire the mutex to access _completed_handles
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _completed_handles.push_back(handle);
+                    // The request completed while another one is running the Python function is passed in its
+                    // next batch
+                    if (_delivering_batches) {
+                        return;
+                    }
+                    _delivering_batches = true;
+                }
+                // Acquire GIL once per batch of the completed requests, execute Python function
+                py::gil_scoped_acquire acquire;
+                for (;;) {
+                    std::vector<size_t> batch;
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        batch.swap(_completed_handles);
+                        if (batch.empty()) {
+                            _delivering_batches = false;
+                            // This request becomes idle last, get_idle_request_id() waits for the idle request
+                            // while holding the mutex, so it must have returned from the callback
+                            _idle_handles.push(handle);
+                            break;
+                        }
+                    }
+                    py::list requests;
+                    py::list user_ids;
+                    for (auto&& completed : batch) {
+                        requests.append(py::cast(_requests[completed]));
+                        user_ids.append(_user_ids[completed]);
+                    }
+                    try {
+                        f_callback(requests, user_ids);
+                    } catch (py::error_already_set py_error) {
+                        assert(PyErr_Occurred());
+                        // acquire the mutex to access _errors
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _errors.push(py_error);
+                    }
+                    {
+                        // acquire the mutex to access _idle_handles
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        // Add idle handles to queue
+                        for (auto&& completed : batch) {
+                            if (completed != handle) {
+                                _idle_handles.push(completed);
+                            }
+                        }
+                    }
+                    // Notify locks in getIdleRequestId()
+                    _cv.notify_all();
+                }
+                _cv.notify_one();
+            });
+        }
+    }
+
+    size_t pop_idle_request_id() {
+        // Wait for any request to complete and take it from the idle ones
+        auto handle = get_idle_request_id();
+        py::gil_scoped_release release;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idle_handles.pop();
+        return handle;
+    }
+
     std::vector<InferRequestWrapper> _requests;
     std::queue<size_t> _idle_handles;
+    std::vector<size_t> _completed_handles;
+    bool _delivering_batches = false;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
     std::mutex _mutex;
     std::condition_variable _cv;
@@ -170,8 +250,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const py::dict inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            self._idle_handles.pop();
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self._user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -203,6 +282,25 @@ void regclass_AsyncInferQueue(py::module m) {
         self.set_custom_callbacks(f_callback);
     });
 
+    cls.def(
+        "set_batched_callback",
+        [](AsyncInferQueue& self, py::function f_callback) {
+            self.set_batched_callbacks(f_callback);
+        },
+        py::arg("f_callback"),
+        R"(
+            Sets the callback called with the lists of the completed requests and their userdata.
+
+            The requests completed while the callback is running are passed in its next call,
+            so the GIL is acquired once per batch instead of once per request. The requests
+            become idle after the callback returns.
+
+            Parameters
+            ----------
+            f_callback : function(requests: List[InferRequest], userdata: List[Any])
+                Python function called for the batches of the completed requests.
+        )");
+
     cls.def("__len__", [](AsyncInferQueue& self) {
         return self._requests.size();
     });
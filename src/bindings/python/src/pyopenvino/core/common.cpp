@@ -325,10 +325,21 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        if (share_outputs) {
+            // The array is a view of the output tensor memory, it holds the tensor and is overwritten by the next
+            // inference of the request, same as Tensor.data
+            const auto dtype = Common::ov_type_to_dtype().find(t.get_element_type());
+            if (dtype != Common::ov_type_to_dtype().end()) {
+                res[py::cast(out)] = py::array(dtype->second, t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+            }
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
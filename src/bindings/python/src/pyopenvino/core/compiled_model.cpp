@@ -31,14 +31,18 @@ void regclass_CompiledModel(py::module m) {
 
     cls.def(
         "infer_new_request",
-        [](ov::CompiledModel& self, const py::dict& inputs) {
+        [](ov::CompiledModel& self, const py::dict& inputs, bool share_outputs) {
             auto request = self.create_infer_request();
             // Update inputs if there are any
             Common::set_request_tensors(request, inputs);
-            request.infer();
-            return Common::outputs_to_dict(self.outputs(), request);
+            {
+                py::gil_scoped_release release;
+                request.infer();
+            }
+            return Common::outputs_to_dict(self.outputs(), request, share_outputs);
         },
-        py::arg("inputs"));
+        py::arg("inputs"),
+        py::arg("share_outputs") = false);
 
     cls.def(
         "export_model",
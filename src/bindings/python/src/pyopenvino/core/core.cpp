@@ -89,6 +89,7 @@ void regclass_Core(py::module m) {
            const std::shared_ptr<const ov::Model>& model,
            const std::string& device_name,
            const std::map<std::string, std::string>& config) {
+            py::gil_scoped_release release;
             return self.compile_model(model, device_name, {config.begin(), config.end()});
         },
         py::arg("model"),
@@ -100,6 +101,7 @@ void regclass_Core(py::module m) {
         [](ov::Core& self,
            const std::shared_ptr<const ov::Model>& model,
            const std::map<std::string, std::string>& config) {
+            py::gil_scoped_release release;
             return self.compile_model(model, ov::AnyMap{config.begin(), config.end()});
         },
         py::arg("model"),
@@ -111,6 +113,7 @@ void regclass_Core(py::module m) {
            const std::string& model_path,
            const std::string& device_name,
            const std::map<std::string, std::string>& config) {
+            py::gil_scoped_release release;
             return self.compile_model(model_path, device_name, {config.begin(), config.end()});
         },
         py::arg("model_path"),
@@ -120,6 +123,7 @@ void regclass_Core(py::module m) {
     cls.def(
         "compile_model",
         [](ov::Core& self, const std::string& model_path, const std::map<std::string, std::string>& config) {
+            py::gil_scoped_release release;
             return self.compile_model(model_path, ov::AnyMap{config.begin(), config.end()});
         },
         py::arg("model_path"),
@@ -138,11 +142,15 @@ void regclass_Core(py::module m) {
                 const uint8_t* bin = reinterpret_cast<const uint8_t*>(info.ptr);
                 ov::Tensor tensor(ov::element::Type_t::u8, {bin_size});
                 std::memcpy(tensor.data(), bin, bin_size);
-                return self.read_model(model, tensor);
+                const std::string model_str = model;
+                py::gil_scoped_release release;
+                return self.read_model(model_str, tensor);
             }
             // create empty tensor of type u8
             ov::Tensor tensor(ov::element::Type_t::u8, {});
-            return self.read_model(model, tensor);
+            const std::string model_str = model;
+            py::gil_scoped_release release;
+            return self.read_model(model_str, tensor);
         },
         py::arg("model"),
         py::arg("weights") = py::bytes());
@@ -150,19 +158,24 @@ void regclass_Core(py::module m) {
     cls.def(
         "read_model",
         (std::shared_ptr<ov::Model>(ov::Core::*)(const std::string&, const std::string&) const) & ov::Core::read_model,
+        py::call_guard<py::gil_scoped_release>(),
         py::arg("model"),
         py::arg("weights") = "");
 
     cls.def(
         "read_model",
         (std::shared_ptr<ov::Model>(ov::Core::*)(const std::string&, const ov::Tensor&) const) & ov::Core::read_model,
+        py::call_guard<py::gil_scoped_release>(),
         py::arg("model"),
         py::arg("weights"));
 
     cls.def(
         "read_model",
         [](ov::Core& self, py::object model, py::object weights) {
-            return self.read_model(py::str(model), py::str(weights));
+            const std::string model_path = py::str(model);
+            const std::string weights_path = py::str(weights);
+            py::gil_scoped_release release;
+            return self.read_model(model_path, weights_path);
         },
         py::arg("model"),
         py::arg("weights") = "");
@@ -175,6 +188,7 @@ void regclass_Core(py::module m) {
            const std::map<std::string, std::string>& properties) {
             std::stringstream _stream;
             _stream << model_stream;
+            py::gil_scoped_release release;
             return self.import_model(_stream, device_name, {properties.begin(), properties.end()});
         },
         py::arg("model_stream"),
@@ -228,6 +242,7 @@ void regclass_Core(py::module m) {
             _stream << model_stream
                            .attr("read")()  // alternative: model_stream.attr("get_value")()
                            .cast<std::string>();
+            py::gil_scoped_release release;
             return self.import_model(_stream, device_name, {properties.begin(), properties.end()});
         },
         py::arg("model_stream"),
@@ -0,0 +1,246 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pyopenvino/core/infer_pipeline.hpp"
+
+#include <ie_common.h>
+#include <pybind11/stl.h>
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "pyopenvino/core/common.hpp"
+
+namespace py = pybind11;
+
+class InferPipeline {
+public:
+    InferPipeline(ov::CompiledModel& model, size_t jobs) : _inputs(model.inputs()), _outputs(model.outputs()) {
+        if (jobs == 0) {
+            jobs = (size_t)Common::get_optimal_number_of_requests(model);
+        }
+        _user_ids.resize(jobs);
+        for (size_t handle = 0; handle < jobs; handle++) {
+            _requests.push_back(model.create_infer_request());
+            _idle_handles.push(handle);
+        }
+        set_callbacks();
+    }
+
+    ~InferPipeline() {
+        // The callbacks use the pipeline, the requests must be finished before it's destroyed
+        for (auto&& request : _requests) {
+            request.wait();
+        }
+        _requests.clear();
+    }
+
+    void submit(const py::dict& inputs, py::object userdata) {
+        size_t handle;
+        {
+            // release GIL while waiting, the callbacks don't need it so it's only to let the other Python threads run
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(_mutex);
+            // Both the requests in flight and the results not taken yet are bounded by the number of the jobs
+            _cv.wait(lock, [this] {
+                return _error || (!_idle_handles.empty() && _results.size() < _requests.size());
+            });
+            rethrow_error();
+            handle = _idle_handles.front();
+            _idle_handles.pop();
+            _pending++;
+        }
+        try {
+            _user_ids[handle] = std::move(userdata);
+            Common::set_request_tensors(_requests[handle], inputs);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _idle_handles.push(handle);
+            _pending--;
+            throw;
+        }
+        py::gil_scoped_release release;
+        _requests[handle].start_async();
+    }
+
+    py::tuple get_result() {
+        Result result;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_pending == 0 && _results.empty()) {
+                IE_THROW() << "There are no submitted inputs to get the result for!";
+            }
+            _cv.wait(lock, [this] {
+                return _error || !_results.empty();
+            });
+            if (_results.empty()) {
+                rethrow_error();
+            }
+            result = std::move(_results.front());
+            _results.pop_front();
+            _pending--;
+        }
+        // Notify the submit() waiting for the results to be taken
+        _cv.notify_all();
+
+        py::dict outputs;
+        for (size_t i = 0; i < _outputs.size(); i++) {
+            auto& t = result.second[i];
+            // The array is a view of the copied output tensor, the request is already reused for another inference
+            const auto dtype = Common::ov_type_to_dtype().find(t.get_element_type());
+            if (dtype != Common::ov_type_to_dtype().end()) {
+                outputs[py::cast(_outputs[i])] =
+                    py::array(dtype->second, t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+            } else {
+                outputs[py::cast(_outputs[i])] = py::cast(t);
+            }
+        }
+        return py::make_tuple(std::move(result.first), outputs);
+    }
+
+    void wait_all() {
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] {
+            return _error || _results.size() == _pending;
+        });
+        rethrow_error();
+    }
+
+    size_t pending() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pending;
+    }
+
+    std::vector<ov::Output<const ov::Node>> _inputs;
+    std::vector<ov::Output<const ov::Node>> _outputs;
+
+private:
+    // The userdata and the copies of the output tensors of the completed inference
+    using Result = std::pair<py::object, std::vector<ov::Tensor>>;
+
+    void set_callbacks() {
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _requests[handle].set_callback([this, handle](std::exception_ptr exception_ptr) {
+                // The outputs are copied on the native thread of the callback, so the request is idle right away and
+                // the Python thread only wraps the copies into the arrays
+                Result result;
+                if (!exception_ptr) {
+                    try {
+                        for (auto&& output : _outputs) {
+                            const auto src = _requests[handle].get_tensor(output);
+                            ov::Tensor dst{src.get_element_type(), src.get_shape()};
+                            std::memcpy(dst.data(), src.data(), src.get_byte_size());
+                            result.second.push_back(dst);
+                        }
+                    } catch (...) {
+                        exception_ptr = std::current_exception();
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (exception_ptr) {
+                        if (!_error) {
+                            _error = exception_ptr;
+                        }
+                        _pending--;
+                    } else {
+                        // Moving the userdata doesn't change its reference count, so it doesn't need the GIL
+                        result.first = std::move(_user_ids[handle]);
+                        _results.push_back(std::move(result));
+                    }
+                    _idle_handles.push(handle);
+                }
+                _cv.notify_all();
+            });
+        }
+    }
+
+    // Requires the mutex to be held
+    void rethrow_error() {
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+
+    std::vector<ov::InferRequest> _requests;
+    std::vector<py::object> _user_ids;  // user ID can be any Python object
+    std::queue<size_t> _idle_handles;
+    std::deque<Result> _results;
+    // The number of the submitted inputs whose results aren't taken yet
+    size_t _pending = 0;
+    std::exception_ptr _error;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+};
+
+void regclass_InferPipeline(py::module m) {
+    py::class_<InferPipeline, std::shared_ptr<InferPipeline>> cls(m, "InferPipeline");
+
+    cls.def(py::init([](ov::CompiledModel& model, size_t jobs) {
+                return new InferPipeline(model, jobs);
+            }),
+            py::arg("model"),
+            py::arg("jobs") = 0,
+            R"(
+            Pipeline of the inferences of the compiled model on the native threads.
+
+            The inputs are inferred by the jobs requests in flight, and the outputs are copied
+            from the requests on the native threads of the completion callbacks. Python only
+            submits the inputs and takes the results in the order of the completion.
+            The preprocessing built into the model with PrePostProcessor (the element type,
+            layout, color and size conversions, mean and scale) runs in the plugin without the GIL.
+
+            Parameters
+            ----------
+            model : openvino.runtime.CompiledModel
+                The compiled model to infer.
+            jobs : int
+                The number of the requests in flight, 0 for the optimal number of the requests.
+        )");
+
+    cls.def(
+        "submit",
+        [](InferPipeline& self, const py::dict& inputs, py::object userdata) {
+            self.submit(inputs, userdata);
+        },
+        py::arg("inputs"),
+        py::arg("userdata"),
+        R"(
+            Starts the inference of the inputs, blocks while all the requests are busy or
+            the results of the jobs inferences aren't taken.
+        )");
+
+    cls.def(
+        "get_result",
+        [](InferPipeline& self) {
+            return self.get_result();
+        },
+        R"(
+            Waits for the next completed inference and returns the tuple of its userdata and
+            the dictionary of the output arrays.
+        )");
+
+    cls.def("wait_all", [](InferPipeline& self) {
+        self.wait_all();
+    });
+
+    cls.def("__len__", [](InferPipeline& self) {
+        return self.pending();
+    });
+
+    cls.def_property_readonly("inputs", [](InferPipeline& self) {
+        return self._inputs;
+    });
+
+    cls.def_property_readonly("outputs", [](InferPipeline& self) {
+        return self._outputs;
+    });
+}
@@ -58,16 +58,20 @@ void regclass_InferRequest(py::module m) {
 
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
             // Call Infer function
-            self._start_time = Time::now();
-            self._request.infer();
-            self._end_time = Time::now();
-            return Common::outputs_to_dict(self._outputs, self._request);
+            {
+                py::gil_scoped_release release;
+                self._start_time = Time::now();
+                self._request.infer();
+                self._end_time = Time::now();
+            }
+            return Common::outputs_to_dict(self._outputs, self._request, share_outputs);
         },
-        py::arg("inputs"));
+        py::arg("inputs"),
+        py::arg("share_outputs") = false);
 
     cls.def(
         "start_async",
@@ -89,6 +93,7 @@ void regclass_InferRequest(py::module m) {
         py::arg("userdata"));
 
     cls.def("cancel", [](InferRequestWrapper& self) {
+        py::gil_scoped_release release;
         self._request.cancel();
     });
 
@@ -129,6 +129,28 @@ void regmodule_offline_transformations(py::module m) {
         },
         py::arg("function"));
 
+    m_offline_transformations.def(
+        "compress_weights_transformation",
+        [](std::shared_ptr<ov::Model> function, const ov::element::Type& compressed_type, size_t group_size) {
+            ov::pass::Manager manager;
+            manager.register_pass<ngraph::pass::CompressWeights>(compressed_type, group_size);
+            manager.run_passes(function);
+        },
+        py::arg("function"),
+        py::arg("compressed_type") = ov::element::i8,
+        py::arg("group_size") = 0,
+        R"(
+    Compresses the floating point weights of MatMuls to the integer type with the dequantization subgraph.
+    Parameters
+    ----------
+    function : ov.Model
+        function which weights are compressed
+    compressed_type : ov.Type
+        i8, i4 (symmetric quantization) or u8, u4 (with zero points)
+    group_size : int
+        the number of input channels sharing the scale, 0 means the scale per output channel
+)");
+
     // todo: remove as serialize as part of passManager api will be merged
     m_offline_transformations.def(
         "serialize",
@@ -26,6 +26,7 @@
 #include "pyopenvino/core/core.hpp"
 #include "pyopenvino/core/extension.hpp"
 #include "pyopenvino/core/ie_parameter.hpp"
+#include "pyopenvino/core/infer_pipeline.hpp"
 #include "pyopenvino/core/infer_request.hpp"
 #include "pyopenvino/core/offline_transformations.hpp"
 #include "pyopenvino/core/profiling_info.hpp"
@@ -131,6 +132,7 @@ PYBIND11_MODULE(pyopenvino, m) {
     regclass_Version(m);
     regclass_Parameter(m);
     regclass_AsyncInferQueue(m);
+    regclass_InferPipeline(m);
     regclass_ProfilingInfo(m);
     regclass_Extension(m);
 
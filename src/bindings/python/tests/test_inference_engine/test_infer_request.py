@@ -9,7 +9,7 @@ import datetime
 import time
 
 import openvino.runtime.opset8 as ops
-from openvino.runtime import Core, AsyncInferQueue, Tensor, ProfilingInfo, Model, Type
+from openvino.runtime import Core, AsyncInferQueue, InferPipeline, Tensor, ProfilingInfo, Model, Type
 from openvino.preprocess import PrePostProcessor
 
 from ..conftest import model_path, read_image
@@ -284,6 +284,60 @@ def test_infer_queue(device):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+def test_infer_queue_batched_callback(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, num_request)
+    jobs_done = [{"finished": False, "latency": 0} for _ in range(jobs)]
+    batch_sizes = []
+
+    def callback(requests, job_ids):
+        assert len(requests) == len(job_ids)
+        batch_sizes.append(len(requests))
+        for request, job_id in zip(requests, job_ids):
+            jobs_done[job_id]["finished"] = True
+            jobs_done[job_id]["latency"] = request.latency
+
+    img = read_image()
+    infer_queue.set_batched_callback(callback)
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert all(job["finished"] for job in jobs_done)
+    assert all(job["latency"] > 0 for job in jobs_done)
+    assert sum(batch_sizes) == jobs
+
+
+def test_infer_pipeline(device):
+    jobs = 8
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled = core.compile_model(model, device)
+    pipeline = InferPipeline(compiled, 2)
+    data = [np.random.normal(size=[10]).astype(np.float32) for _ in range(jobs)]
+    results = {}
+    for i in range(jobs):
+        pipeline.submit([data[i]], i)
+        # The results must be taken to let the pipeline accept the next inputs
+        if len(pipeline) == 2:
+            job_id, outputs = pipeline.get_result()
+            results[job_id] = outputs[compiled.outputs[0]]
+    pipeline.wait_all()
+    while len(pipeline) > 0:
+        job_id, outputs = pipeline.get_result()
+        results[job_id] = outputs[compiled.outputs[0]]
+    assert sorted(results.keys()) == list(range(jobs))
+    for i in range(jobs):
+        assert np.allclose(results[i], np.maximum(data[i], 0))
+    with pytest.raises(RuntimeError) as e:
+        pipeline.get_result()
+    assert "There are no submitted inputs" in str(e.value)
+
+
 def test_infer_queue_is_ready(device):
     core = Core()
     param = ops.parameter([10])
@@ -594,3 +648,29 @@ def test_invalid_inputs_container(device):
     with pytest.raises(TypeError) as e:
         request.infer(inputs)
     assert "Inputs should be either list or dict! Current type:" in str(e.value)
+
+
+def test_infer_share_inputs(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer({0: arr_1, 1: arr_2}, share_inputs=True)
+    assert np.array_equal(res[request.model_outputs[0]], arr_1 + arr_2)
+    assert np.shares_memory(request.get_input_tensor(0).data, arr_1)
+
+    # not contiguous arrays are copied
+    arr_3 = np.asfortranarray(arr_1)
+    res = request.infer({0: arr_3, 1: arr_2}, share_inputs=True)
+    assert np.array_equal(res[request.model_outputs[0]], arr_3 + arr_2)
+    assert not np.shares_memory(request.get_input_tensor(0).data, arr_3)
+
+
+def test_infer_share_outputs(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer({0: arr_1, 1: arr_2}, share_outputs=True)
+    output = res[request.model_outputs[0]]
+    assert np.array_equal(output, arr_1 + arr_2)
+    assert np.shares_memory(output, request.get_output_tensor().data)
+
+    res = request.infer({0: arr_1, 1: arr_2})
+    assert not np.shares_memory(res[request.model_outputs[0]], request.get_output_tensor().data)
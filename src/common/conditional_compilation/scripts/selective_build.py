@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+#     The script produces the OpenVINO build trimmed to the code the given models use.
+# The `build` command configures and builds the SELECTIVE_BUILD=COLLECT tree, runs its
+# `selective_build_stat` target which collects the IntelSEAPI statistics of the models,
+# and then builds and installs the SELECTIVE_BUILD=ON tree with these statistics.
+# The `collect` command is the one the `selective_build_stat` target runs.
+#
+#     Usage: selective_build.py build --openvino_root_dir DIR --build_dir DIR --install_dir DIR
+#                                     -m MODEL [-m MODEL ...] [-d DEVICE ...] [--cmake_args ARGS]
+#            selective_build.py collect --sea_runtool PATH --collector_dir DIR --benchmark_app PATH
+#                                       --out DIR -m MODEL [-m MODEL ...] [-d DEVICE ...]
+
+import argparse
+import multiprocessing
+import shlex
+import subprocess
+import sys
+from glob import glob
+from pathlib import Path
+
+# The hints select different streams and threading of the devices, so the models are run with each of them
+HINTS = ['latency', 'throughput']
+
+
+def run(cmd):
+    print(' '.join(str(arg) for arg in cmd), flush=True)
+    subprocess.run([str(arg) for arg in cmd], check=True)
+
+
+def collect(args):
+    out = Path(args.out)
+    out.mkdir(parents=True, exist_ok=True)
+    # the statistics of the previous collection may contain the models which aren't in the list anymore
+    for path in glob(str(out / '*.csv')):
+        Path(path).unlink()
+
+    for model in args.models:
+        for device in args.devices:
+            for hint in HINTS:
+                prefix = out / f'{Path(model).stem}_{device}_{hint}'
+                run([sys.executable, args.sea_runtool, f'--output={prefix}', f'--bindir={args.collector_dir}', '!',
+                     args.benchmark_app, '-m', model, '-d', device, '-hint', hint, '-niter', '1'])
+                if not glob(f'{prefix}.pid*.csv'):
+                    sys.exit(f'No statistics are collected for {model} on {device} with {hint} hint')
+
+
+def build(args):
+    root = Path(args.openvino_root_dir).resolve()
+    collect_dir = Path(args.build_dir).resolve() / 'collect'
+    minimized_dir = Path(args.build_dir).resolve() / 'minimized'
+    jobs = f'-j{multiprocessing.cpu_count()}'
+    models = ';'.join(str(Path(model).resolve()) for model in args.models)
+    stat_dir = collect_dir / 'selective_build_stat'
+
+    run(['cmake', '-S', root, '-B', collect_dir, '-DCMAKE_BUILD_TYPE=Release', f'-DPYTHON_EXECUTABLE={sys.executable}',
+         '-DSELECTIVE_BUILD=COLLECT', '-DENABLE_PROFILING_ITT=ON', '-DENABLE_SAMPLES=ON',
+         f'-DSELECTIVE_BUILD_MODELS={models}', f'-DSELECTIVE_BUILD_DEVICES={";".join(args.devices)}',
+         f'-DSELECTIVE_BUILD_STAT_DIR={stat_dir}', *args.cmake_args])
+    run(['cmake', '--build', collect_dir, '--target', 'selective_build_stat', jobs])
+
+    run(['cmake', '-S', root, '-B', minimized_dir, '-DCMAKE_BUILD_TYPE=Release',
+         f'-DPYTHON_EXECUTABLE={sys.executable}', '-DSELECTIVE_BUILD=ON',
+         f'-DSELECTIVE_BUILD_STAT={stat_dir}/*.csv', *args.cmake_args])
+    run(['cmake', '--build', minimized_dir, jobs])
+    run(['cmake', '--install', minimized_dir, '--prefix', Path(args.install_dir).resolve()])
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    build_parser = subparsers.add_parser('build', help='Build and install OpenVINO trimmed to the models')
+    build_parser.add_argument('--openvino_root_dir', required=True, help='OpenVINO source directory')
+    build_parser.add_argument('--build_dir', required=True, help='Directory for the collect and minimized builds')
+    build_parser.add_argument('--install_dir', required=True, help='Directory to install the minimized build to')
+    build_parser.add_argument('--cmake_args', type=shlex.split, default=[],
+                              help='Additional CMake arguments of both builds, e.g. "-DENABLE_INTEL_GPU=OFF"')
+
+    collect_parser = subparsers.add_parser('collect', help='Collect the statistics with the COLLECT build')
+    collect_parser.add_argument('--sea_runtool', required=True, help='Path to sea_runtool.py')
+    collect_parser.add_argument('--collector_dir', required=True, help='Directory of sea_itt_lib')
+    collect_parser.add_argument('--benchmark_app', required=True, help='Path to benchmark_app of the COLLECT build')
+    collect_parser.add_argument('--out', required=True, help='Directory to store the statistics to')
+
+    for subparser in [build_parser, collect_parser]:
+        subparser.add_argument('-m', dest='models', required=True, action='append',
+                               help='Model (IR or ONNX) to keep the code of')
+        subparser.add_argument('-d', dest='devices', action='append', help='Device to run the models on (CPU)')
+
+    args = parser.parse_args()
+    if not args.devices:
+        args.devices = ['CPU']
+
+    if args.command == 'build':
+        build(args)
+    else:
+        collect(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -65,6 +65,16 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn std::string countersReport()
+         * @ingroup ie_dev_profiling
+         * @brief Returns the durations of the annotated sections of code aggregated by the built-in counters backend
+         * @details The backend is built with the ENABLE_PROFILING_COUNTERS option instead of ITT. Each line of the report is
+         * "<domain>\t<task>\t<count>\t<total_ms>\t<mean_ms>\t<max_ms>\t<p50_ms>\t<p99_ms>" after the header line, the
+         * percentiles are the upper bounds of the power of two histogram buckets. The report is empty without the backend.
+         */
+        std::string countersReport();
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
@@ -7,6 +7,18 @@
 
 #ifdef ENABLE_PROFILING_ITT
 #include <ittnotify.h>
+#elif defined(ENABLE_PROFILING_COUNTERS)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 #endif
 
 namespace openvino {
@@ -48,6 +60,238 @@ void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
 
+#elif defined(ENABLE_PROFILING_COUNTERS)
+
+// The durations of the tasks are aggregated into the power of two histograms of each thread, which only the thread
+// writes to, so the scopes take no locks. The registry is locked to create the handles, to start and end the threads
+// and to make the report.
+static constexpr size_t maxTasks = 4096;
+static constexpr size_t maxDepth = 64;
+static constexpr size_t bucketsCount = 40;
+
+struct Domain {
+    std::string name;
+};
+
+struct Task {
+    std::string name;
+    size_t id;
+    std::atomic<const Domain*> domain{nullptr};
+};
+
+struct TaskStats {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> maxNs{0};
+    std::atomic<uint64_t> buckets[bucketsCount] = {};
+
+    // only the owning thread writes, so the read-modify-write needs no atomic instructions
+    static void add(std::atomic<uint64_t>& value, uint64_t delta) {
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+};
+
+struct ThreadCounters;
+
+static std::string makeReport();
+
+// OPENVINO_COUNTERS_DUMP=<file> writes the report to the file at the process exit
+struct ReportDumper {
+    ~ReportDumper() {
+        static const char* path = std::getenv("OPENVINO_COUNTERS_DUMP");
+        if (!path || !*path)
+            return;
+        if (auto file = std::fopen(path, "w")) {
+            const auto report = makeReport();
+            std::fwrite(report.data(), 1, report.size(), file);
+            std::fclose(file);
+        }
+    }
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::unique_ptr<Domain>> domains;
+    std::unordered_map<std::string, std::unique_ptr<Task>> tasks;
+    std::vector<Task*> tasksById;
+    std::set<ThreadCounters*> threads;
+    // the stats of the ended threads
+    std::vector<std::unique_ptr<TaskStats>> retired;
+};
+
+/*
+ * Every library links its own copy of this code, so the registry is exported: on Linux the dynamic linker binds all
+ * the copies to the first one loaded, i.e. the one of the OpenVINO runtime, and the report covers all the libraries.
+ * It's never destroyed, so the threads may end at any time.
+ */
+#if defined(__GNUC__) && !defined(_WIN32)
+__attribute__((visibility("default")))
+#endif
+Registry& countersRegistry() {
+    static auto registry = new Registry;
+    static ReportDumper dumper;
+    return *registry;
+}
+
+struct ThreadCounters {
+    std::unique_ptr<std::atomic<TaskStats*>[]> stats{new std::atomic<TaskStats*>[maxTasks]};
+    std::pair<Task*, std::chrono::steady_clock::time_point> stack[maxDepth];
+    size_t depth = 0;
+
+    ThreadCounters() {
+        for (size_t i = 0; i < maxTasks; ++i)
+            stats[i].store(nullptr, std::memory_order_relaxed);
+        auto& registry = countersRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.threads.insert(this);
+    }
+
+    ~ThreadCounters() {
+        auto& registry = countersRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.threads.erase(this);
+        for (size_t id = 0; id < maxTasks; ++id) {
+            std::unique_ptr<TaskStats> threadStats{stats[id].load(std::memory_order_relaxed)};
+            if (!threadStats)
+                continue;
+            if (registry.retired.size() <= id)
+                registry.retired.resize(id + 1);
+            auto& retired = registry.retired[id];
+            if (!retired)
+                retired.reset(new TaskStats);
+            TaskStats::add(retired->count, threadStats->count.load(std::memory_order_relaxed));
+            TaskStats::add(retired->totalNs, threadStats->totalNs.load(std::memory_order_relaxed));
+            retired->maxNs.store(std::max(retired->maxNs.load(std::memory_order_relaxed),
+                                          threadStats->maxNs.load(std::memory_order_relaxed)),
+                                 std::memory_order_relaxed);
+            for (size_t b = 0; b < bucketsCount; ++b)
+                TaskStats::add(retired->buckets[b], threadStats->buckets[b].load(std::memory_order_relaxed));
+        }
+    }
+
+    TaskStats& get(size_t id) {
+        auto result = stats[id].load(std::memory_order_relaxed);
+        if (!result) {
+            result = new TaskStats;
+            // the report reads the stats of the running threads
+            stats[id].store(result, std::memory_order_release);
+        }
+        return *result;
+    }
+};
+
+static ThreadCounters& threadCounters() {
+    static thread_local ThreadCounters counters;
+    return counters;
+}
+
+static size_t bucketOf(uint64_t ns) {
+    size_t bucket = 0;
+    while (ns >>= 1)
+        ++bucket;
+    return std::min(bucket, bucketsCount - 1);
+}
+
+// the duration below which the given share of the tasks ended, as the upper bound of the histogram bucket
+static double percentileMs(const uint64_t* buckets, uint64_t count, double share) {
+    const auto target = static_cast<uint64_t>(share * static_cast<double>(count));
+    uint64_t passed = 0;
+    for (size_t b = 0; b < bucketsCount; ++b) {
+        passed += buckets[b];
+        if (passed > target || passed == count)
+            return static_cast<double>(uint64_t{2} << b) / 1e6;
+    }
+    return 0.0;
+}
+
+static std::string makeReport() {
+    auto& registry = countersRegistry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    std::ostringstream report;
+    report << "domain\ttask\tcount\ttotal_ms\tmean_ms\tmax_ms\tp50_ms\tp99_ms\n";
+    for (auto task : registry.tasksById) {
+        uint64_t count = 0, totalNs = 0, maxNs = 0;
+        uint64_t buckets[bucketsCount] = {};
+        auto accumulate = [&](const TaskStats& stats) {
+            count += stats.count.load(std::memory_order_relaxed);
+            totalNs += stats.totalNs.load(std::memory_order_relaxed);
+            maxNs = std::max(maxNs, stats.maxNs.load(std::memory_order_relaxed));
+            for (size_t b = 0; b < bucketsCount; ++b)
+                buckets[b] += stats.buckets[b].load(std::memory_order_relaxed);
+        };
+        if (task->id < registry.retired.size() && registry.retired[task->id])
+            accumulate(*registry.retired[task->id]);
+        for (auto thread : registry.threads) {
+            if (auto stats = thread->stats[task->id].load(std::memory_order_acquire))
+                accumulate(*stats);
+        }
+        if (count == 0)
+            continue;
+
+        auto domain = task->domain.load(std::memory_order_relaxed);
+        report << (domain ? domain->name : std::string()) << '\t' << task->name << '\t' << count << '\t'
+               << static_cast<double>(totalNs) / 1e6 << '\t' << static_cast<double>(totalNs) / 1e6 / count << '\t'
+               << static_cast<double>(maxNs) / 1e6 << '\t' << percentileMs(buckets, count, 0.5) << '\t'
+               << percentileMs(buckets, count, 0.99) << '\n';
+    }
+    return report.str();
+}
+
+domain_t domain(char const* name) {
+    auto& registry = countersRegistry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    auto& domain = registry.domains[name];
+    if (!domain)
+        domain.reset(new Domain{name});
+    return reinterpret_cast<domain_t>(domain.get());
+}
+
+handle_t handle(char const* name) {
+    auto& registry = countersRegistry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    auto& task = registry.tasks[name];
+    if (!task) {
+        if (registry.tasksById.size() == maxTasks)
+            return nullptr;
+        task.reset(new Task);
+        task->name = name;
+        task->id = registry.tasksById.size();
+        registry.tasksById.push_back(task.get());
+    }
+    return reinterpret_cast<handle_t>(task.get());
+}
+
+void taskBegin(domain_t d, handle_t t) {
+    auto& counters = threadCounters();
+    auto task = reinterpret_cast<Task*>(t);
+    if (task && !task->domain.load(std::memory_order_relaxed))
+        task->domain.store(reinterpret_cast<const Domain*>(d), std::memory_order_relaxed);
+    // the too deep tasks are counted to end them in pairs, but not measured
+    if (counters.depth < maxDepth)
+        counters.stack[counters.depth] = {task, std::chrono::steady_clock::now()};
+    ++counters.depth;
+}
+
+void taskEnd(domain_t) {
+    auto& counters = threadCounters();
+    if (counters.depth == 0 || --counters.depth >= maxDepth)
+        return;
+    const auto& started = counters.stack[counters.depth];
+    if (!started.first)
+        return;
+
+    const auto ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - started.second).count());
+    auto& stats = counters.get(started.first->id);
+    TaskStats::add(stats.count, 1);
+    TaskStats::add(stats.totalNs, ns);
+    if (ns > stats.maxNs.load(std::memory_order_relaxed))
+        stats.maxNs.store(ns, std::memory_order_relaxed);
+    TaskStats::add(stats.buckets[bucketOf(ns)], 1);
+}
+
+void threadName(const char *) { }
+
 #else
 
 domain_t domain(char const *) { return nullptr; }
@@ -63,5 +307,13 @@ void threadName(const char *) { }
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
+
+std::string countersReport() {
+#if !defined(ENABLE_PROFILING_ITT) && defined(ENABLE_PROFILING_COUNTERS)
+    return internal::makeReport();
+#else
+    return {};
+#endif
+}
 }  // namespace itt
 }  // namespace openvino
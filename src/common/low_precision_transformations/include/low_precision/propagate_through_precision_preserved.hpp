@@ -66,8 +66,13 @@ public:
                 const_cast<AttributeType&>(resultAttribute).merge(toMerge);
 
                 for (size_t index = 1ul; index < parentRestrictions.size(); index++) {
-                    auto& attributes = parentRestrictions[index].template as<AttributeType>().attribute->sharedValue->getAttributes();
-                    for (auto&& attributeWeakPtr : attributes) {
+                    // the pointer is copied to keep the value alive while its attributes are moved to the result one
+                    const auto sharedValue = parentRestrictions[index].template as<AttributeType>().attribute->sharedValue;
+                    // the branches merged before already share the value, e.g. the inputs of the Concat after the diamond
+                    if (sharedValue == resultAttribute.attribute->sharedValue) {
+                        continue;
+                    }
+                    for (auto&& attributeWeakPtr : sharedValue->getAttributes()) {
                         auto attribute = attributeWeakPtr.lock();
                         if (attribute == nullptr) {
                             continue;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -36,25 +37,28 @@ public:
                     return;
                 }
 
-                for (auto& attr : attributes) {
-                    auto attrLocked = attr.lock();
-                    if (attrLocked == nullptr) {
-                        continue;
-                    }
-                    if (attributeLocked == attrLocked) {
-                        return;
+                // the attributes are indexed by the address to keep the propagation through the large models linear,
+                // the expired attribute is replaced by the new one allocated at the same address
+                const auto index = indices.find(attributeLocked.get());
+                if (index != indices.end()) {
+                    auto& attr = attributes[index->second];
+                    if (attr.lock() != attributeLocked) {
+                        attr = attribute;
                     }
+                    return;
                 }
 
+                indices.emplace(attributeLocked.get(), attributes.size());
                 attributes.push_back(attribute);
             }
 
-            std::vector<std::weak_ptr<SharedValueAttribute>>& getAttributes() {
+            const std::vector<std::weak_ptr<SharedValueAttribute>>& getAttributes() const {
                 return attributes;
             }
 
         private:
             std::vector<std::weak_ptr<SharedValueAttribute>> attributes;
+            std::unordered_map<const SharedValueAttribute*, size_t> indices;
         };
         SharedValueAttribute() : sharedValue(std::make_shared<SharedValue>()) {}
 
@@ -76,8 +76,11 @@ bool MatMulTransformation::transform(TransformationContext &context, ngraph::pat
     }
 
     if (dequantization2.subtract != nullptr) {
-        NetworkHelper::optimizeSubtract(dequantization2.subtract);
-        dequantization2 = NetworkHelper::getDequantization(matMul, 1);
+        const auto roundedConst = NetworkHelper::round(dequantization2.subtractConstant, dequantization2.data.get_element_type());
+        if (NetworkHelper::isZeroConst(roundedConst)) {
+            NetworkHelper::optimizeSubtract(dequantization2.subtract);
+            dequantization2 = NetworkHelper::getDequantization(matMul, 1);
+        }
     }
 
     const std::shared_ptr<opset1::MatMul> newMatMul = std::make_shared<ngraph::op::TypeRelaxed<opset1::MatMul>>(
@@ -90,6 +93,21 @@ bool MatMulTransformation::transform(TransformationContext &context, ngraph::pat
 
     std::shared_ptr<Node> parent = newMatMul;
 
+    auto transpose = [](const std::shared_ptr<opset1::Constant>& node) -> std::shared_ptr<Node> {
+        const Shape outputShape = node->get_shape();
+        if (outputShape.size() < 2ul) {
+            return node;
+        }
+
+        std::vector<uint32_t> transposeConstant(outputShape.size());
+        std::iota(transposeConstant.begin(), transposeConstant.end(), 0);
+        std::swap(*(transposeConstant.end() - 1), *(transposeConstant.end() - 2));
+
+        auto order = opset1::Constant::create(element::u32, Shape{ transposeConstant.size() }, transposeConstant);
+        std::shared_ptr<Node> transposedConstant = fold<opset1::Transpose>(node, order);
+        return transposedConstant;
+    };
+
     // dequantization with subtract on activations & constant weights
     if (dequantization1.subtract) {
         auto broadcastShape = NetworkHelper::isScalarLike(ov::as_type_ptr<opset1::Constant>(dequantization1.subtractConstant)) ?
@@ -123,20 +141,39 @@ bool MatMulTransformation::transform(TransformationContext &context, ngraph::pat
         parent = newSubtract;
     }
 
-    auto transpose = [](const std::shared_ptr<opset1::Constant>& node) -> std::shared_ptr<Node> {
-        const Shape outputShape = node->get_shape();
-        if (outputShape.size() < 2ul) {
-            return node;
+    // dequantization with subtract on the second input: A x (B - zp) = A x B - sum(A, by rows) x zp
+    if (dequantization2.subtract) {
+        const size_t rank = newMatMul->get_input_partial_shape(0).rank().get_length();
+        const size_t columnsIdx = matMul->get_transpose_a() ? rank - 2ul : rank - 1ul;
+
+        // sum by rows of the first input: [..., X, Y] => [..., X, 1]
+        std::shared_ptr<Node> rowsSum = std::make_shared<opset1::ReduceSum>(
+            foldConvert(dequantization1.data, deqPrecision),
+            opset1::Constant::create(element::i64, Shape{ 1 }, { columnsIdx }),
+            true);
+        if (matMul->get_transpose_a()) {
+            std::vector<size_t> transposeConstant(rank);
+            std::iota(transposeConstant.begin(), transposeConstant.end(), 0ul);
+            std::swap(*(transposeConstant.end() - 1), *(transposeConstant.end() - 2));
+            rowsSum = std::make_shared<opset1::Transpose>(
+                rowsSum,
+                opset1::Constant::create(element::u32, Shape{ transposeConstant.size() }, transposeConstant));
         }
 
-        std::vector<uint32_t> transposeConstant(outputShape.size());
-        std::iota(transposeConstant.begin(), transposeConstant.end(), 0);
-        std::swap(*(transposeConstant.end() - 1), *(transposeConstant.end() - 2));
+        // zero point by columns of the second input: [1, ..., 1, Z]
+        const auto subConst2 = matMul->get_transpose_b() ?
+            transpose(dequantization2.subtractConstant) :
+            dequantization2.subtractConstant;
+        const auto shift = std::make_shared<opset1::Multiply>(
+            rowsSum,
+            NetworkHelper::toScalarIfPossible(foldConvert(subConst2, deqPrecision)));
 
-        auto order = opset1::Constant::create(element::u32, Shape{ transposeConstant.size() }, transposeConstant);
-        std::shared_ptr<Node> transposedConstant = fold<opset1::Transpose>(node, order);
-        return transposedConstant;
-    };
+        const auto newSubtract = std::make_shared<opset1::Subtract>(parent, shift);
+        newSubtract->set_friendly_name(newMatMul->get_friendly_name() + "/DequantizationSubtract");
+        copy_runtime_info({ newSubtract, matMul }, newSubtract);
+
+        parent = newSubtract;
+    }
 
     const auto mulConst1 = matMul->get_transpose_a() ? transpose(dequantization1.multiplyConstant) : dequantization1.multiplyConstant;
     auto mulConst2 = matMul->get_transpose_b() ? transpose(dequantization2.multiplyConstant) : dequantization2.multiplyConstant;
@@ -232,7 +269,21 @@ bool MatMulTransformation::canBeTransformed(const TransformationContext& context
         if (dequantization2.subtract) {
             const auto roundedConst = NetworkHelper::round(dequantization2.subtractConstant, dequantization2.data.get_element_type());
             if (!NetworkHelper::isZeroConst(roundedConst)) {
-                return false;
+                // zero points on both inputs are not supported
+                if (dequantization1.subtract) {
+                    return false;
+                }
+
+                if (!NetworkHelper::isScalarLike(dequantization2.subtractConstant)) {
+                    const auto constantShape = dequantization2.subtractConstant->get_shape();
+                    const size_t rank = dequantization2.subtract->get_output_partial_shape(0).rank().get_length();
+                    const size_t rowsIdx = matMul->get_transpose_b() ? rank - 1ul : rank - 2ul;
+
+                    // zero points by rows in tensor B can't be propagate
+                    if ((constantShape.size() == rank) && (constantShape[rowsIdx] != 1)) {
+                        return false;
+                    }
+                }
             }
         }
 
@@ -264,7 +315,7 @@ bool MatMulTransformation::canBeTransformed(const TransformationContext& context
             precisionsAttribute.as<PrecisionsAttribute>().value();
 
         const DataPrecision dataPrecision = getDataPrecision(fakeQuantize, quantizationDetails, precisions);
-        if (dataPrecision.hasZeroPoint || dataPrecision.empty()) {
+        if (dataPrecision.empty() || (dataPrecision.hasZeroPoint && dequantization1.subtract)) {
             return false;
         }
 
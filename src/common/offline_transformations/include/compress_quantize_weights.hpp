@@ -13,6 +13,7 @@ namespace pass {
 
 class CompressQuantizeWeights;
 class ZeroPointOptimizer;
+class CompressWeights;
 
 }  // namespace pass
 }  // namespace ngraph
@@ -93,3 +94,59 @@ public:
     NGRAPH_RTTI_DECLARATION;
     ZeroPointOptimizer();
 };
+
+/*
+    CompressWeights transformation performs weight-only compression of floating point MatMul weights
+    (without FakeQuantize on them):
+
+                                +-----------------+
+                                |    Constant     |
+                                |  (f32/f16, 2D)  |
+                                +-----------------+
+                                        |
+                                        v
+
+    is replaced to the dequantization subgraph:
+
+                                +-----------------+
+                                |    Constant     |
+                                | (i8/u8/i4/u4)   |
+                                +-----------------+
+                                        |
+                                        v
+                                +------------------+
+                                |     Convert      |
+                                |  (to high prec)  |
+                                +------------------+
+                                        |
+                                        v
+                  +----------+    +------------+
+                  |zero point|--->|  Subtract  |   (only for u8/u4)
+                  +----------+    +-----+------+
+                                        |
+                                        v
+                   +---------+    +------------+
+                   |  scale  |--->|  Multiply  |
+                   +---------+    +-----+------+
+                                        |
+                                        v
+                                  +------------+
+                                  |  Reshape   |   (only for groups)
+                                  +-----+------+
+                                        |
+                                        v
+
+    Signed types are quantized symmetrically, unsigned ones use the zero point. The scales are per output channel
+    or, if group_size is set and divides the input channels, per group of group_size input channels of each output
+    channel (the compressed constant is reshaped to [.., groups, group_size, ..] for that). The i4/u4 constants are
+    packed by two values per byte, so the .bin file shrinks by 4x (8 bits) or 8x (4 bits) for f32 weights.
+
+    The Convert is marked as decompression, so the plugins running DisableDecompressionConvertConstantFolding keep
+    the weights compressed (e.g. GPU for the per channel i8 weights with transpose_b), the other ones fold the
+    subgraph back into the floating point constant.
+*/
+class ngraph::pass::CompressWeights: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit CompressWeights(const element::Type& compressed_type = element::i8, size_t group_size = 0);
+};
@@ -25,7 +25,8 @@ class Pruning;
 
 /**
  * @ingroup ie_transformation_common_api
- * @brief Initialising masks for pruned operations
+ * @brief Initialising masks for pruned operations: output channels of Convolution/GroupConvolution
+ * weights and output features of MatMul (dense layer) weights
  */
 class ngraph::pass::InitMasks : public ngraph::pass::GraphRewrite {
 public:
@@ -49,7 +50,9 @@ public:
 /**
  * @ingroup ie_transformation_common_api
  * @brief Contains several MatcherPasses that initialize and propagate
- * masks from Constant operation to the network output.
+ * masks from Constant operation to the network output. Attention heads
+ * are propagated through the Reshapes splitting (merging) the features
+ * into heads only as a whole.
  */
 class ngraph::pass::PropagateMasks : public ngraph::pass::GraphRewrite {
 public:
@@ -7,8 +7,12 @@
 #include <ngraph/validation_util.hpp>
 #include <ngraph/rt_info.hpp>
 #include <openvino/pass/constant_folding.hpp>
+#include <transformations/rt_info/decompression.hpp>
 #include <compress_quantize_weights.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 NGRAPH_RTTI_DEFINITION(ngraph::pass::CompressQuantizeWeights, "CompressQuantizeWeights", 0);
 
 static bool has_dequantization_subgraph(const std::shared_ptr<ngraph::Node>& first_convert) {
@@ -233,3 +237,108 @@ ngraph::pass::ZeroPointOptimizer::ZeroPointOptimizer() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(sub_pattern, "ZeroPointOptimizer");
     this->register_matcher(m, callback);
 }
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::CompressWeights, "CompressWeights", 0);
+
+ngraph::pass::CompressWeights::CompressWeights(const element::Type& compressed_type, size_t group_size) {
+    auto weights_pattern = pattern::wrap_type<opset8::Constant>(pattern::type_matches_any({element::f32, element::f16}));
+    auto matmul_pattern = pattern::wrap_type<opset8::MatMul>({pattern::any_input(), weights_pattern});
+
+    const bool is_signed = compressed_type == element::i8 || compressed_type == element::i4;
+    const bool is_supported_type = is_signed || compressed_type == element::u8 || compressed_type == element::u4;
+    const float max_level = compressed_type.bitwidth() == 4 ? 15.f : 255.f;
+    // symmetric range of the signed types is [-max_q, max_q], the asymmetric one of the unsigned types is [0, max_q]
+    const float max_q = is_signed ? std::floor(max_level / 2) : max_level;
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        if (!is_supported_type)
+            return false;
+        auto matmul = std::dynamic_pointer_cast<opset8::MatMul>(m.get_match_root());
+        auto weights = std::dynamic_pointer_cast<opset8::Constant>(
+            m.get_pattern_value_map().at(weights_pattern).get_node_shared_ptr());
+        if (!matmul || !weights)
+            return false;
+        const auto& shape = weights->get_shape();
+        // the weights shared by several MatMuls are left as is not to duplicate them
+        if (shape.size() != 2 || shape_size(shape) == 0 || weights->get_output_target_inputs(0).size() != 1)
+            return false;
+
+        // Weights are viewed as [outer, groups, group, inner]: [N, K / G, G, 1] for transposed weights [N, K]
+        // and [1, K / G, G, N] for [K, N]
+        const bool transpose_b = matmul->get_transpose_b();
+        const size_t input_channels = transpose_b ? shape[1] : shape[0];
+        const size_t outer = transpose_b ? shape[0] : 1;
+        const size_t inner = transpose_b ? 1 : shape[1];
+        size_t group = input_channels;
+        if (group_size > 0 && group_size < input_channels && input_channels % group_size == 0)
+            group = group_size;
+        const size_t groups = input_channels / group;
+
+        const auto values = weights->cast_vector<float>();
+        std::vector<float> scales(outer * groups * inner);
+        std::vector<float> zero_points(scales.size(), 0.f);
+        std::vector<int32_t> quantized(values.size());
+        for (size_t o = 0; o < outer; ++o) {
+            for (size_t g = 0; g < groups; ++g) {
+                for (size_t i = 0; i < inner; ++i) {
+                    auto index = [&](size_t j) {
+                        return ((o * groups + g) * group + j) * inner + i;
+                    };
+                    float min_value = 0.f, max_value = 0.f;
+                    for (size_t j = 0; j < group; ++j) {
+                        min_value = std::min(min_value, values[index(j)]);
+                        max_value = std::max(max_value, values[index(j)]);
+                    }
+                    const size_t scale_index = (o * groups + g) * inner + i;
+                    float scale = is_signed ? std::max(-min_value, max_value) / max_q : (max_value - min_value) / max_q;
+                    if (scale == 0.f)
+                        scale = 1.f;
+                    const float zero_point = is_signed ? 0.f : std::round(-min_value / scale);
+                    const float min_q = is_signed ? -max_q : 0.f;
+                    for (size_t j = 0; j < group; ++j) {
+                        const float q = std::round(values[index(j)] / scale) + zero_point;
+                        quantized[index(j)] = static_cast<int32_t>(std::min(std::max(q, min_q), max_q));
+                    }
+                    scales[scale_index] = scale;
+                    zero_points[scale_index] = zero_point;
+                }
+            }
+        }
+
+        const bool grouped = groups > 1;
+        const Shape compressed_shape = !grouped ? shape : (transpose_b ? Shape{outer, groups, group}
+                                                                       : Shape{groups, group, inner});
+        const Shape scale_shape = !grouped ? (transpose_b ? Shape{outer, 1} : Shape{1, inner})
+                                           : (transpose_b ? Shape{outer, groups, 1} : Shape{groups, 1, inner});
+        const auto& float_type = weights->get_element_type();
+        auto compressed = opset8::Constant::create(compressed_type, compressed_shape, quantized);
+        compressed->set_friendly_name(weights->get_friendly_name());
+
+        auto convert = std::make_shared<opset8::Convert>(compressed, float_type);
+        std::shared_ptr<Node> dequantized = convert;
+        NodeVector new_nodes{convert};
+        if (!is_signed) {
+            auto zero_point = opset8::Constant::create(float_type, scale_shape, zero_points);
+            dequantized = std::make_shared<opset8::Subtract>(dequantized, zero_point);
+            new_nodes.push_back(dequantized);
+        }
+        dequantized = std::make_shared<opset8::Multiply>(dequantized, opset8::Constant::create(float_type, scale_shape, scales));
+        new_nodes.push_back(dequantized);
+        if (grouped) {
+            auto target_shape = opset8::Constant::create(element::i64, Shape{shape.size()}, shape);
+            dequantized = std::make_shared<opset8::Reshape>(dequantized, target_shape, false);
+            new_nodes.push_back(dequantized);
+        }
+        dequantized->set_friendly_name(weights->get_friendly_name() + "/decompressed");
+        copy_runtime_info(weights, new_nodes);
+        ov::mark_as_decompression(convert);
+        ov::pass::disable_constant_folding(convert);
+
+        matmul->input(1).replace_source_output(dequantized);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_pattern, "CompressWeights");
+    this->register_matcher(m, callback);
+}
+
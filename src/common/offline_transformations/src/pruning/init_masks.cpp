@@ -16,6 +16,7 @@ namespace pass {
 namespace init_masks {
 
 class InitConvMask;
+class InitMatMulMask;
 
 } // namespace init_masks
 } // namespace pass
@@ -57,8 +58,51 @@ public:
     }
 };
 
+class ngraph::pass::init_masks::InitMatMulMask : public MatcherPass {
+public:
+    InitMatMulMask() {
+        auto input = pattern::any_input();
+        auto weights = pattern::any_input(pattern::has_static_shape());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({input, weights});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(matmul);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+            if (!matmul_node) return false;
+
+            // Only the dense layers (2D weights) are pruned, the batched MatMuls of two activations are
+            // processed in PropagateMasks pass
+            if (pattern_map.at(weights).get_shape().size() != 2) return false;
+
+            // Initializing weights mask:
+            // 1. Looking for Const node with weights, only through the operations keeping the weights layout
+            auto cur_node = m_output.get_node()->get_input_node_shared_ptr(1);
+
+            while (ngraph::is_type<opset6::Convert>(cur_node) || ngraph::is_type<opset6::FakeQuantize>(cur_node)) {
+                cur_node = cur_node->get_input_node_shared_ptr(0);
+            }
+            if (!ngraph::is_type<opset6::Constant>(cur_node) || cur_node->get_shape().size() != 2) {
+                NGRAPH_DEBUG << "Can't find Constant weights for MatMul: " <<
+                m_output.get_node()->get_friendly_name() << std::endl;
+                return false;
+            }
+
+            // 2. Init mask for Const node: output channels are the columns of weights [K, N]
+            // or the rows of transposed weights [N, K]
+            const size_t output_channel_dim = matmul_node->get_transpose_b() ? 0 : 1;
+            InitConstMask({output_channel_dim}).apply(cur_node);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulInitMask");
+        register_matcher(m, callback);
+    }
+};
+
 
 ngraph::pass::InitMasks::InitMasks() {
     add_matcher<init_masks::InitConvMask>();
+    add_matcher<init_masks::InitMatMulMask>();
 }
 
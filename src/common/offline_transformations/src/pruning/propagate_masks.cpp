@@ -23,10 +23,12 @@ namespace mask_propagation {
 class Convolution;
 class GroupConvolution;
 class GroupConvolutionReshape;
+class MatMul;
 class Elementwise;
 class PassThrough;
 class Reduce;
 class Reshape;
+class Transpose;
 class StopPropagation;
 class SkipPropagation;
 class FakeQuantize;
@@ -45,6 +47,28 @@ static ngraph::Shape broadcast_shape_to_rank(ngraph::Shape shape_to_broadcast, i
     return new_shape;
 }
 
+// Attention heads are pruned only as a whole: the head is pruned if all its channels are pruned
+static std::set<uint64_t> channels_to_heads(const std::set<uint64_t> & channels, uint64_t head_size) {
+    std::set<uint64_t> heads;
+    for (const auto & channel : channels) {
+        const auto head = channel / head_size;
+        bool whole_head = true;
+        for (uint64_t i = head * head_size; i < (head + 1) * head_size && whole_head; ++i)
+            whole_head = channels.count(i) != 0;
+        if (whole_head)
+            heads.insert(head);
+    }
+    return heads;
+}
+
+static std::set<uint64_t> heads_to_channels(const std::set<uint64_t> & heads, uint64_t head_size) {
+    std::set<uint64_t> channels;
+    for (const auto & head : heads)
+        for (uint64_t i = head * head_size; i < (head + 1) * head_size; ++i)
+            channels.insert(i);
+    return channels;
+}
+
 class ngraph::pass::mask_propagation::Convolution : public MatcherPass {
 public:
     Convolution() {
@@ -115,6 +139,133 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::MatMul : public MatcherPass {
+public:
+    MatMul() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto weights = pattern::any_input(pattern::has_static_rank());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({input, weights}, pattern::has_static_rank());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_weights = pattern_map.at(weights);
+            const auto & m_output = pattern_map.at(matmul);
+            const auto & m_input = pattern_map.at(input);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+
+            const auto input_rank = static_cast<size_t>(m_input.get_partial_shape().rank().get_length());
+            const auto weights_rank = static_cast<size_t>(m_weights.get_partial_shape().rank().get_length());
+            const auto output_rank = static_cast<size_t>(m_output.get_partial_shape().rank().get_length());
+            if (input_rank < 2 || weights_rank < 2) {
+                return false;
+            }
+
+            auto input_mask = getMask(m_input);
+            auto weights_mask = getMask(m_weights);
+            if (weights_rank > 2) {
+                // MatMul of two activations (e.g. attention scores or context): only batch dims (attention heads)
+                // are propagated, the masks of both inputs are intersected.
+                if (!input_mask || !weights_mask || input_rank != weights_rank || input_rank != output_rank) {
+                    NGRAPH_DEBUG << "MatMul: No masks for both inputs of " << m_output.get_node()->get_friendly_name() << "\n";
+                    return false;
+                }
+                const auto batch_dims = output_rank - 2;
+                auto copy_batch_dims = [batch_dims](Mask * dst, Mask * src) {
+                    for (size_t dim = 0; dim < dst->size(); ++dim) {
+                        if (dim < batch_dims)
+                            dst->at(dim) = src->at(dim);
+                        else
+                            dst->at(dim).clear();
+                    }
+                };
+                auto input_mask_row = input_mask.get();
+                auto weights_mask_row = weights_mask.get();
+                auto output_mask = std::make_shared<Mask>(output_rank);
+                auto output_mask_row = output_mask.get();
+
+                output_mask->add_callback([input_mask_row, weights_mask_row, copy_batch_dims](Mask::Ptr cur_mask) -> bool {
+                    auto result_mask = input_mask_row->intersect_masks_reversed(weights_mask_row);
+                    copy_batch_dims(cur_mask.get(), result_mask.get());
+                    return true;
+                }, input_mask);
+                input_mask->add_callback([weights_mask_row, copy_batch_dims](Mask::Ptr cur_mask) -> bool {
+                    copy_batch_dims(cur_mask.get(), weights_mask_row);
+                    return true;
+                }, weights_mask);
+                input_mask->add_callback([output_mask_row, copy_batch_dims](Mask::Ptr cur_mask) -> bool {
+                    copy_batch_dims(cur_mask.get(), output_mask_row);
+                    return true;
+                }, output_mask);
+                weights_mask->add_callback([input_mask_row, copy_batch_dims](Mask::Ptr cur_mask) -> bool {
+                    copy_batch_dims(cur_mask.get(), input_mask_row);
+                    return true;
+                }, input_mask);
+
+                output_mask->apply_callback(input_mask);
+                weights_mask->apply_callback(input_mask);
+
+                setMask(m_output, output_mask);
+                return true;
+            }
+
+            // Weights mask for the dense MatMul should be initialized in the InitMasks pass (and propagate after it).
+            if (!weights_mask) {
+                NGRAPH_DEBUG << "No weights mask for " << m_output.get_node()->get_friendly_name() << "\n";
+                return false;
+            }
+            auto weights_mask_row = weights_mask.get();
+
+            const size_t input_channel_dim = matmul_node->get_transpose_a() ? input_rank - 2 : input_rank - 1;
+            const size_t weights_input_channel_dim = matmul_node->get_transpose_b() ? 1 : 0;
+            const size_t weights_output_channel_dim = matmul_node->get_transpose_b() ? 0 : 1;
+            const size_t output_channel_dim = output_rank - 1;
+
+            if (input_mask) {
+                auto input_mask_row = input_mask.get();
+                // Weights input channel is connected to the MatMul input features dimension
+                // so we update weights mask to be aligned with input shape.
+                weights_mask->add_callback([input_mask_row, weights_input_channel_dim, input_channel_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(weights_input_channel_dim) = input_mask_row->at(input_channel_dim);
+                    return true;
+                }, input_mask);
+
+                input_mask->add_callback([weights_mask_row, weights_input_channel_dim, input_channel_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(input_channel_dim) = weights_mask_row->at(weights_input_channel_dim);
+                    return true;
+                }, weights_mask);
+
+                if (!weights_mask->apply_callback(input_mask)) {
+                    return false;
+                }
+            }
+
+            // Create output mask that describes which features will be removed
+            auto matmul_mask = std::make_shared<Mask>(output_rank);
+            auto matmul_mask_row = matmul_mask.get();
+
+            matmul_mask->add_callback([weights_mask_row, weights_output_channel_dim, output_channel_dim](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(output_channel_dim) = weights_mask_row->at(weights_output_channel_dim);
+                return true;
+            }, weights_mask);
+
+            weights_mask->add_callback([matmul_mask_row, weights_output_channel_dim, output_channel_dim](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(weights_output_channel_dim) = matmul_mask_row->at(output_channel_dim);
+                return true;
+            }, matmul_mask);
+
+            if (!matmul_mask->apply_callback(weights_mask)) {
+                return false;
+            }
+
+            setMask(m_output, matmul_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::GroupConvolution : public MatcherPass {
 public:
     GroupConvolution() {
@@ -293,28 +444,68 @@ public:
 
         ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
             const auto & pattern_map = m.get_pattern_value_map();
-            const auto & m_weights = pattern_map.at(weights);
             const auto & m_output = pattern_map.at(eltwise);
-            const auto & m_input = pattern_map.at(input);
+            auto m_weights = pattern_map.at(weights);
+            auto m_input = pattern_map.at(input);
 
             // Case when input masks should be united instead of intersection
             bool union_eltwise_type = ngraph::is_type<opset6::Multiply>(m_output.get_node_shared_ptr());
 
+            // Scaling by the scalar (e.g. of the attention scores) keeps the pruned channels zero
+            if (union_eltwise_type) {
+                for (const auto & scalar_idx : {0, 1}) {
+                    const auto scalar = m_output.get_node()->get_input_node_shared_ptr(scalar_idx);
+                    if (!ngraph::is_type<opset6::Constant>(scalar) || shape_size(scalar->get_shape()) != 1)
+                        continue;
+                    if (auto data_mask = getMask(m_output.get_node()->input_value(1 - scalar_idx))) {
+                        setMask(m_output, data_mask);
+                        return true;
+                    }
+                }
+            }
+
+            const auto output_rank = m_output.get_partial_shape().rank().get_length();
+            // The constants of the lower rank (e.g. MatMul biases) are broadcasted to the output rank
+            // for the convenience of working with the masks
+            const auto autob = m_output.get_node()->get_autob();
+            for (size_t idx = 0; idx < 2 && autob.m_type == ngraph::op::AutoBroadcastType::NUMPY; ++idx) {
+                auto const_node = std::dynamic_pointer_cast<opset6::Constant>(
+                        m_output.get_node()->get_input_node_shared_ptr(idx));
+                if (!const_node || static_cast<int64_t>(const_node->get_shape().size()) >= output_rank ||
+                    !getMask(m_output.get_node()->input_value(1 - idx)))
+                    continue;
+                auto new_shape = broadcast_shape_to_rank(const_node->get_shape(), output_rank);
+                auto new_const = std::make_shared<op::Constant>(*const_node, new_shape);
+                new_const->set_friendly_name(const_node->get_friendly_name());
+                ngraph::copy_runtime_info(const_node, new_const);
+                ngraph::replace_node(const_node, new_const);
+            }
+            m_input = m_output.get_node()->input_value(0);
+            m_weights = m_output.get_node()->input_value(1);
+
             const auto & input_rank = m_input.get_partial_shape().rank().get_length();
             const auto & weights_rank = m_weights.get_partial_shape().rank().get_length();
-            // Here assuming that masks can be propagated only through 3/4 dimensional tensors
+            // Here assuming that masks can be propagated only through 2/3/4 dimensional tensors
             // (since channel dim is necessary)
-            if (weights_rank < 3 || input_rank < 3) return false;
+            if (weights_rank < 2 || input_rank < 2) return false;
+
+            // Channels are in the last dim of the MatMul outputs
+            AxisSet const_mask_dims{0, 1/* potential output channel dim */};
+            for (const auto & operand : {m_input, m_weights}) {
+                auto operand_mask = getMask(operand);
+                if (operand_mask && !operand_mask->empty() && !operand_mask->back().empty())
+                    const_mask_dims.insert(output_rank - 1);
+            }
 
             // In case if first of the inputs is constant
-            InitConstMask({0, 1/* potential output channel dim */}).apply(m_input.get_node_shared_ptr());
+            InitConstMask(const_mask_dims).apply(m_input.get_node_shared_ptr());
             auto input_mask = getMask(m_input);
             if (!input_mask) {
                 NGRAPH_DEBUG << "No input mask for: " << m_output.get_node()->get_friendly_name() << std::endl;
                 return false;
             }
 
-            InitConstMask({0, 1}).apply(m_weights.get_node_shared_ptr());
+            InitConstMask(const_mask_dims).apply(m_weights.get_node_shared_ptr());
             auto weights_mask = getMask(m_weights);
             if (!weights_mask) {
                 NGRAPH_DEBUG << "No weights mask for: " << m_output.get_node()->get_friendly_name() << std::endl;
@@ -690,18 +881,52 @@ public:
                 }
                 auto not_reshaped_dims = i;
 
+                // The first reshaped dim could be split into the attention heads [H * D] -> [H, D]
+                // or merged back [H, D] -> [H * D], the masks are propagated through it for the whole heads.
+                // The shape constant should have the exact value of this dim to be adjusted.
+                bool split_heads = false;
+                bool merge_heads = false;
+                uint64_t head_size = 0;
+                const auto shape_value = std::dynamic_pointer_cast<opset6::Constant>(
+                        m_weights.get_node_shared_ptr())->cast_vector<int64_t>();
+                if (i < std::min(input_shape.size(), output_shape.size()) && i < shape_value.size() &&
+                    shape_value[i] == static_cast<int64_t>(output_shape[i])) {
+                    if (output_shape.size() == input_shape.size() + 1 && i + 1 < output_shape.size() &&
+                        input_shape[i] == output_shape[i] * output_shape[i + 1] &&
+                        std::equal(input_shape.begin() + i + 1, input_shape.end(), output_shape.begin() + i + 2)) {
+                        split_heads = true;
+                        head_size = output_shape[i + 1];
+                    } else if (input_shape.size() == output_shape.size() + 1 && i + 1 < input_shape.size() &&
+                               output_shape[i] == input_shape[i] * input_shape[i + 1] &&
+                               std::equal(output_shape.begin() + i + 1, output_shape.end(), input_shape.begin() + i + 2)) {
+                        merge_heads = true;
+                        head_size = input_shape[i + 1];
+                    }
+                }
+                const bool heads_dim = split_heads || merge_heads;
+
                 auto input_mask_row = input_mask.get();
                 auto weights_mask_row = weights_mask.get();
                 auto output_mask_row = output_mask.get();
-                input_mask->add_callback([weights_mask_row](Mask::Ptr cur_mask) -> bool {
+                input_mask->add_callback([weights_mask_row, not_reshaped_dims, split_heads,
+                                          merge_heads, head_size](Mask::Ptr cur_mask) -> bool {
                     cur_mask->copy_value_from_mask(weights_mask_row);
+                    if (split_heads)
+                        cur_mask->at(not_reshaped_dims) = heads_to_channels(weights_mask_row->at(not_reshaped_dims), head_size);
+                    else if (merge_heads)
+                        cur_mask->at(not_reshaped_dims) = channels_to_heads(weights_mask_row->at(not_reshaped_dims), head_size);
                     return true;
                 }, weights_mask);
-                weights_mask->add_callback([input_mask_row, not_reshaped_dims](Mask::Ptr cur_mask) -> bool{
+                weights_mask->add_callback([input_mask_row, not_reshaped_dims, split_heads,
+                                            merge_heads, head_size](Mask::Ptr cur_mask) -> bool{
                     // Propagate masks down through dimension only if this dimension isn't reshaped
                     for (size_t dim = 0; dim < std::min(cur_mask->size(), input_mask_row->size()); ++dim)
                         if (dim < not_reshaped_dims)
                             cur_mask->at(dim) = input_mask_row->at(dim);
+                        else if (dim == not_reshaped_dims && split_heads)
+                            cur_mask->at(dim) = channels_to_heads(input_mask_row->at(dim), head_size);
+                        else if (dim == not_reshaped_dims && merge_heads)
+                            cur_mask->at(dim) = heads_to_channels(input_mask_row->at(dim), head_size);
                         else if (cur_mask->at(dim) != input_mask_row->at(dim))
                             cur_mask->initialize_dependencies();
                     return true;
@@ -712,10 +937,10 @@ public:
                     return true;
                 }, weights_mask);
 
-                weights_mask->add_callback([output_mask_row, not_reshaped_dims](Mask::Ptr cur_mask) -> bool {
+                weights_mask->add_callback([output_mask_row, not_reshaped_dims, heads_dim](Mask::Ptr cur_mask) -> bool {
                     // Propagate masks up through dimension only if this dimension isn't reshaped
                     for (size_t dim = 0; dim < std::min(cur_mask->size(), output_mask_row->size()); ++dim)
-                        if (dim < not_reshaped_dims)
+                        if (dim < not_reshaped_dims || (dim == not_reshaped_dims && heads_dim))
                             cur_mask->at(dim) = output_mask_row->at(dim);
                         else if (cur_mask->at(dim) != output_mask_row->at(dim))
                             cur_mask->initialize_dependencies();
@@ -735,6 +960,62 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::Transpose : public MatcherPass {
+public:
+    Transpose() {
+        auto inputs = pattern::any_input(pattern::has_static_rank());
+        auto order = pattern::wrap_type<opset6::Constant>();
+        auto transpose = pattern::wrap_type<opset6::Transpose>({inputs, order}, pattern::has_static_rank());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_order = pattern_map.at(order);
+            const auto & m_input = pattern_map.at(inputs);
+            const auto & m_output = pattern_map.at(transpose);
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask) {
+                return false;
+            }
+
+            const auto rank = static_cast<size_t>(m_input.get_partial_shape().rank().get_length());
+            const auto constant = std::dynamic_pointer_cast<opset6::Constant>(m_order.get_node_shared_ptr());
+            auto transpose_order = constant->cast_vector<int64_t>();
+            // Empty order means the reversed dims
+            if (transpose_order.empty()) {
+                for (size_t dim = rank; dim > 0; --dim)
+                    transpose_order.push_back(dim - 1);
+            }
+            if (transpose_order.size() != rank) {
+                return false;
+            }
+
+            auto output_mask = std::make_shared<Mask>(rank);
+            auto input_mask_row = input_mask.get();
+            auto output_mask_row = output_mask.get();
+
+            // Output dim i is the input dim order[i]
+            input_mask->add_callback([output_mask_row, transpose_order](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < transpose_order.size(); ++dim)
+                    cur_mask->at(transpose_order[dim]) = output_mask_row->at(dim);
+                return true;
+            }, output_mask);
+            output_mask->add_callback([input_mask_row, transpose_order](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < transpose_order.size(); ++dim)
+                    cur_mask->at(dim) = input_mask_row->at(transpose_order[dim]);
+                return true;
+            }, input_mask);
+
+            output_mask->apply_callback(input_mask);
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(transpose, "TransposeMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::StopPropagation : public MatcherPass {
 public:
     StopPropagation() {
@@ -803,10 +1084,12 @@ ngraph::pass::PropagateMasks::PropagateMasks() {
     add_matcher<mask_propagation::Convolution>();
     add_matcher<mask_propagation::GroupConvolutionReshape>();
     add_matcher<mask_propagation::GroupConvolution>();
+    add_matcher<mask_propagation::MatMul>();
     add_matcher<mask_propagation::Elementwise>();
     add_matcher<mask_propagation::PassThrough>();
     add_matcher<mask_propagation::Reduce>();
     add_matcher<mask_propagation::Reshape>();
+    add_matcher<mask_propagation::Transpose>();
     add_matcher<mask_propagation::FakeQuantize>();
     add_matcher<mask_propagation::Concat>();
     add_matcher<mask_propagation::SkipPropagation>();
@@ -10,6 +10,8 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <list>
+#include <mutex>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -686,7 +688,64 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+// Keeps the graphs compiled for the recent calls, so the infer requests of the same network, as well as
+// an engine switching between a few input sizes, don't compile them again. A compiled graph owns its
+// internal buffers, so an entry is taken by a single engine and is put back once the engine doesn't use it.
+class PreprocEngine::CompiledCache {
+public:
+    using Key = std::tuple<CallDesc, bool>;
+
+    static std::shared_ptr<CompiledCache> get() {
+        // the engines keep the cache alive, they may be destroyed after the static objects
+        static const auto cache = std::make_shared<CompiledCache>();
+        return cache;
+    }
+
+    bool take(const Key& key, std::vector<cv::GCompiled>& compiled) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = std::find_if(_entries.begin(), _entries.end(), [&](const Entry& entry) {
+            return entry.first == key;
+        });
+        if (it == _entries.end()) {
+            return false;
+        }
+        compiled = std::move(it->second);
+        _entries.erase(it);
+        return true;
+    }
+
+    void put(Key key, std::vector<cv::GCompiled> compiled) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries.emplace_front(std::move(key), std::move(compiled));
+        if (_entries.size() > maxEntries) {
+            _entries.pop_back();
+        }
+    }
+
+private:
+    using Entry = std::pair<Key, std::vector<cv::GCompiled>>;
+    static constexpr size_t maxEntries = 16;
+
+    std::mutex _mutex;
+    std::list<Entry> _entries;
+};
+
+PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()), _compiledCache(CompiledCache::get()) {}
+
+PreprocEngine::~PreprocEngine() {
+    try {
+        releaseCompiled();
+    } catch (...) {
+        // the compiled graphs are just not reused
+    }
+}
+
+void PreprocEngine::releaseCompiled() {
+    if (_lastCall) {
+        _compiledCache->put(CompiledCache::Key{*_lastCall, _lastSerial}, std::move(_lastComp));
+    }
+    _lastComp = std::vector<cv::GCompiled>(parallel_get_max_threads());
+}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -881,6 +940,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             }
         }
 
+        if (!compiled) return;  // no rows were left for this slice when the graph was compiled
+
         for (int i = 0; i < batch_size; ++i) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
@@ -948,26 +1009,45 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+#if IE_THREAD == IE_THREAD_OMP
+    const bool serial = omp_serial;
+#else
+    const bool serial = false;
+#endif
+
+    Update update = needUpdate(thisCall);
+    if (_lastCall && serial != _lastSerial) {
+        // the output rows are split into the other number of slices
+        update = Update::REBUILD;
+    }
 
-    Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
+        std::vector<cv::GCompiled> cached;
+        if (_compiledCache->take(CompiledCache::Key{thisCall, serial}, cached)) {
+            releaseCompiled();
+            _lastComp = std::move(cached);
+            update = Update::NOTHING;
+        } else if (Update::REBUILD == update) {
+            releaseCompiled();
+        }
         _lastCall = cv::util::make_optional(std::move(thisCall));
+        _lastSerial = serial;
+    }
 
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
-        }
+    Opt<cv::GComputation> _lastComputation;
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        _lastComputation = cv::util::make_optional(
+            buildGraph(custom_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
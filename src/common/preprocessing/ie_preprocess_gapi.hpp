@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -27,6 +28,12 @@ class PreprocEngine {
 
     Opt<CallDesc> _lastCall;
     std::vector<cv::GCompiled> _lastComp;
+    bool _lastSerial = false;
+
+    // The graphs compiled by the engines which switched to other calls or were destroyed,
+    // shared by all the engines of the process
+    class CompiledCache;
+    std::shared_ptr<CompiledCache> _compiledCache;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -35,6 +42,7 @@ class PreprocEngine {
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
+    void releaseCompiled();
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
@@ -50,6 +58,9 @@ class PreprocEngine {
 
 public:
     PreprocEngine();
+    ~PreprocEngine();
+    PreprocEngine(const PreprocEngine&) = delete;
+    PreprocEngine& operator=(const PreprocEngine&) = delete;
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
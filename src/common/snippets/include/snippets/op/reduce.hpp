@@ -0,0 +1,46 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Generated by Canonicalization for a reduction over the innermost dimension. The output register accumulates
+ * the input through all the iterations of the inner tiles, so the result is available only to ReduceStore
+ * ScalarReduce == the same accumulation for the tail elements
+ * @ingroup snippets
+ */
+class Reduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reduce", "SnippetsOpset");
+
+    enum class Kind {
+        Sum,
+        Max
+    };
+
+    Reduce(const Output<Node>& x, Kind kind);
+    Reduce() = default;
+
+    Kind get_kind() const { return m_kind; }
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+protected:
+    Kind m_kind = Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
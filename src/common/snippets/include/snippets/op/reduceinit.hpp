@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ReduceInit
+ * @brief Generated by Generator before the inner tiles to fill the accumulator of Reduce with the identity value
+ * @ingroup snippets
+ */
+class ReduceInit : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ReduceInit", "SnippetsOpset");
+
+    explicit ReduceInit(Reduce::Kind kind);
+    ReduceInit() = default;
+
+    Reduce::Kind get_kind() const { return m_kind; }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<ReduceInit>(m_kind);
+    }
+
+private:
+    Reduce::Kind m_kind = Reduce::Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+#include "store.hpp"
+#include "reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ReduceStore
+ * @brief Generated by Canonicalization for the store of a Reduce result. It's emitted after the inner tiles,
+ * reduces the lanes of the accumulator and stores a single value per row
+ * @ingroup snippets
+ */
+class ReduceStore : public Store {
+public:
+    OPENVINO_OP("ReduceStore", "SnippetsOpset", ngraph::snippets::op::Store);
+
+    ReduceStore(const Output<Node>& x);
+    ReduceStore() = default;
+
+    Reduce::Kind get_kind() const;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ReduceStore>(new_args.at(0));
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
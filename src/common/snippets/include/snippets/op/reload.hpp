@@ -0,0 +1,36 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+#include "spill.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reload
+ * @brief Generated by AssignRegisters before a use of the spilled value. Loads the stack slot of the input Spill
+ * to the output register.
+ * @ingroup snippets
+ */
+class Reload : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reload", "SnippetsOpset");
+
+    explicit Reload(const Output<Node>& spill);
+    Reload() = default;
+
+    size_t get_slot() const;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
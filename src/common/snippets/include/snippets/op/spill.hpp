@@ -0,0 +1,40 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Spill
+ * @brief Generated by AssignRegisters if the live values don't fit the vector registers. Stores the input register to
+ * the stack slot of the kernel, so the value is kept in the memory until it's needed by Reload. The output isn't a register.
+ * @ingroup snippets
+ */
+class Spill : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Spill", "SnippetsOpset");
+
+    Spill(const Output<Node>& x, size_t slot);
+    Spill() = default;
+
+    size_t get_slot() const { return m_slot; }
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+private:
+    size_t m_slot = 0;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -124,6 +124,17 @@ static inline auto is_scalar_constant(const std::shared_ptr<ngraph::Node>& sourc
     return ngraph::is_type<ngraph::opset1::Constant>(source_output_node) && ngraph::shape_size(source_output_node->get_shape()) == 1;
 };
 
+// ReduceSum and ReduceMax over the innermost dimension only, which keep the reduced dimension, are supported as
+// the sinks of a subgraph: they accumulate the rows of the execution domain while it's tiled
+static inline auto is_innermost_reduction(const std::shared_ptr<const ngraph::Node>& node) -> bool {
+    if (!ngraph::is_type<ngraph::opset1::ReduceSum>(node) && !ngraph::is_type<ngraph::opset1::ReduceMax>(node))
+        return false;
+    const auto reduce = std::static_pointer_cast<const ngraph::op::util::ArithmeticReductionKeepDims>(node);
+    const auto rank = reduce->get_input_partial_shape(0).rank();
+    return reduce->get_keep_dims() && reduce->reduction_axes_constant() && rank.is_static() && rank.get_length() > 0 &&
+           reduce->get_reduction_axes() == ngraph::AxisSet{static_cast<size_t>(rank.get_length() - 1)};
+};
+
 static inline auto create_body(std::string name, const ngraph::ResultVector& results, const ngraph::ParameterVector& parameters) ->
     std::shared_ptr<ov::Model> {
     auto body = std::make_shared<ov::Model>(results, parameters, name);
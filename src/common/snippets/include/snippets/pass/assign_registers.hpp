@@ -14,6 +14,7 @@ namespace pass {
  * @interface AssignRegisters
  * @brief Assigns internal `vector` register indexes to operations.
  * Changing order of variables or datafrow lead to invalidation of register assignment.
+ * If the live values don't fit the registers, the values used the latest are spilled to the stack with Spill and Reload.
  * @ingroup snippets
  */
 class AssignRegisters : public ngraph::pass::FunctionPass {
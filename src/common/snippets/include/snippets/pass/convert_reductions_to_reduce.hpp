@@ -0,0 +1,26 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ConvertReductionsToReduce
+ * @brief Replace ReduceSum and ReduceMax over the innermost dimension with snippets::op::Reduce, the constant axes are dropped.
+ * @ingroup snippets
+ */
+class ConvertReductionsToReduce: public ngraph::pass::MatcherPass {
+public:
+    ConvertReductionsToReduce();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
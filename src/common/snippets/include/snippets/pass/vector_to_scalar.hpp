@@ -35,6 +35,17 @@ public:
     ReplaceStoresWithScalarStores();
 };
 
+/**
+ * @interface ReplaceReductionsWithScalarReductions
+ * @brief Replaces vector reductions with scalar versions, which accumulate into the same vector register.
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class ReplaceReductionsWithScalarReductions: public ngraph::pass::MatcherPass {
+public:
+    ReplaceReductionsWithScalarReductions();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
@@ -14,9 +14,15 @@
 #include "op/kernel.hpp"
 #include "op/load.hpp"
 #include "op/nop.hpp"
+#include "op/reduce.hpp"
+#include "op/reduceinit.hpp"
+#include "op/reducestore.hpp"
+#include "op/reload.hpp"
 #include "op/scalar.hpp"
 #include "op/scalarload.hpp"
+#include "op/scalarreduce.hpp"
 #include "op/scalarstore.hpp"
+#include "op/spill.hpp"
 #include "op/powerstatic.hpp"
 #include "op/store.hpp"
 #include "op/tile.hpp"
@@ -19,6 +19,13 @@ NGRAPH_OP(BroadcastLoad, ngraph::snippets::op)
 NGRAPH_OP(Store, ngraph::snippets::op)
 NGRAPH_OP(ScalarStore, ngraph::snippets::op)
 NGRAPH_OP(VectorStore, ngraph::snippets::op)
+NGRAPH_OP(ReduceStore, ngraph::snippets::op)
+
+NGRAPH_OP(Reduce, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduce, ngraph::snippets::op)
+
+NGRAPH_OP(Spill, ngraph::snippets::op)
+NGRAPH_OP(Reload, ngraph::snippets::op)
 
 NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
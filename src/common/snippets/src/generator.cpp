@@ -8,6 +8,9 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/reduceinit.hpp"
+#include "snippets/op/reducestore.hpp"
+#include "snippets/op/spill.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
@@ -50,11 +53,17 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto out = results.size();
     auto nptrs = in + out;
 
+    // the reductions accumulate through the inner tiles, so their results are stored once per row after them
+    auto is_reduce_store = [](const std::shared_ptr<ngraph::Node>& n) {
+        return ov::is_type<ngraph::snippets::op::ReduceStore>(n);
+    };
+
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
     std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
     for (auto n : m->get_ordered_ops()) {
-        lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        if (!is_reduce_store(n))
+            lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
 
@@ -63,16 +72,32 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     ngraph::pass::Manager mng;
     mng.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
     mng.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    mng.register_pass<ngraph::snippets::pass::ReplaceReductionsWithScalarReductions>();
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
     for (auto n : m_scalar->get_ordered_ops()) {
-        scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        if (!is_reduce_store(n))
+            scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+    }
+    OV_ITT_TASK_NEXT(GENERATE, "::Reductions")
+
+    // the accumulators are initialized before the inner tiles and reduced after them
+    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> reduce_init;
+    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> reduce_store;
+    for (auto n : m->get_ordered_ops()) {
+        if (!is_reduce_store(n))
+            continue;
+        auto reduce = n->get_input_node_shared_ptr(0);
+        auto init = std::make_shared<ngraph::snippets::op::ReduceInit>(ov::as_type_ptr<ngraph::snippets::op::ReduceStore>(n)->get_kind());
+        reduce_init.push_back(std::make_pair(target->get(ngraph::snippets::op::ReduceInit::get_type_info_static())(init),
+                                             std::make_pair(std::vector<size_t>{}, ngraph::snippets::getRegisters(reduce).second)));
+        reduce_store.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
 
     // wrapping into tiles1D
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D;
+    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D(reduce_init);
     auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
     tile->compile_params = compile_params;
     tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
@@ -81,6 +106,7 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     tile->compile_params = compile_params;
     tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
                     std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    tiles1D.insert(tiles1D.end(), reduce_store.begin(), reduce_store.end());
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
@@ -95,9 +121,16 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto tiles2DKernel = std::make_shared<ngraph::snippets::op::Kernel>(tiles2D);
     tiles2DKernel->compile_params = compile_params;
     std::shared_ptr<Emitter> kernel = target->get(ngraph::snippets::op::Kernel::get_type_info_static())(tiles2DKernel);
-    kernel->emit_code({in, out}, {});
+    // the stack slots of the values spilled by the register allocation are allocated by the kernel
+    const auto ops = m->get_ordered_ops();
+    const auto spills = std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& n) {
+        return ov::is_type<ngraph::snippets::op::Spill>(n);
+    });
+    kernel->emit_code({in, out, static_cast<size_t>(spills)}, {});
     OV_ITT_TASK_NEXT(GENERATE, "::EmitData")
     lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
+    lowered.insert(lowered.end(), reduce_init.begin(), reduce_init.end());
+    lowered.insert(lowered.end(), reduce_store.begin(), reduce_store.end());
     for (auto& op : lowered) {
         op.first->emit_data();
     }
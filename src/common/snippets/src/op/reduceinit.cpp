@@ -0,0 +1,11 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/reduceinit.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::ReduceInit::ReduceInit(Reduce::Kind kind) : Op(), m_kind(kind) {
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/reducestore.hpp"
+
+using namespace ngraph;
+
+snippets::op::ReduceStore::ReduceStore(const Output<Node>& x) : Store(x) {
+}
+
+snippets::op::Reduce::Kind snippets::op::ReduceStore::get_kind() const {
+    const auto reduce = ov::as_type_ptr<Reduce>(get_input_node_shared_ptr(0));
+    NODE_VALIDATION_CHECK(this, reduce != nullptr, "ReduceStore expects Reduce as the input");
+    return reduce->get_kind();
+}
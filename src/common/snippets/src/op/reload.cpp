@@ -0,0 +1,29 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/reload.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Reload::Reload(const Output<Node>& spill) : Op({spill}) {
+    constructor_validate_and_infer_types();
+}
+
+size_t snippets::op::Reload::get_slot() const {
+    return ov::as_type_ptr<Spill>(get_input_node_shared_ptr(0))->get_slot();
+}
+
+std::shared_ptr<Node> snippets::op::Reload::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(Reload);
+    check_new_args_count(this, new_args);
+    return std::make_shared<Reload>(new_args.at(0));
+}
+
+void snippets::op::Reload::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, ov::is_type<Spill>(get_input_node_shared_ptr(0)), "Reload expects Spill as the input");
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
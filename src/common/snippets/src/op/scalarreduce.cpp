@@ -0,0 +1,10 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/scalarreduce.hpp"
+
+using namespace ngraph;
+
+snippets::op::ScalarReduce::ScalarReduce(const Output<Node>& x, Kind kind) : Reduce(x, kind) {
+}
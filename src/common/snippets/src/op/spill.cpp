@@ -0,0 +1,29 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/spill.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Spill::Spill(const Output<Node>& x, size_t slot) : Op({x}), m_slot(slot) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::Spill::visit_attributes(AttributeVisitor& visitor) {
+    visitor.on_attribute("slot", m_slot);
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::Spill::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(Spill);
+    check_new_args_count(this, new_args);
+    return std::make_shared<Spill>(new_args.at(0), m_slot);
+}
+
+void snippets::op::Spill::validate_and_infer_types() {
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
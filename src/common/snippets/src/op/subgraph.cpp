@@ -12,6 +12,7 @@
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
+#include "snippets/pass/convert_reductions_to_reduce.hpp"
 
 #include <ngraph/pass/manager.hpp>
 #include <openvino/pass/serialize.hpp>
@@ -180,8 +181,8 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = m_body->get_parameters()[i]->get_shape();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()))
+        // the parameters of a dynamic snippet are dynamic until the actual shapes are passed here
+        if (m_body->get_parameters()[i]->get_partial_shape() != PartialShape(inShape))
                 m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(inType, inShape));
     }
 
@@ -203,7 +204,25 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
                                                                ::ngraph::op::AutoBroadcastType::NUMPY);
         NODE_VALIDATION_CHECK(this, compatibleWithOtherOutputs, "Snippets output shapes must be numpy broadcastable");
     }
+    // The reductions are scheduled over their inputs, so the reduced dimension is a part of the execution domain
+    std::vector<std::shared_ptr<Node>> reductions;
+    for (const auto& op : m_body->get_ordered_ops()) {
+        if (is_innermost_reduction(op))
+            reductions.push_back(op);
+    }
+    for (const auto& reduction : reductions) {
+        NODE_VALIDATION_CHECK(this, PartialShape::broadcast_merge_into(outPShape, reduction->get_input_shape(0),
+                                                                       ::ngraph::op::AutoBroadcastType::NUMPY),
+                              "Snippets reduction inputs must be numpy broadcastable with the outputs");
+    }
     exec_domain = outPShape.get_shape();
+    for (const auto& reduction : reductions) {
+        const auto& reduced_shape = reduction->get_output_shape(0);
+        NODE_VALIDATION_CHECK(this, reduction->get_input_shape(0).back() == exec_domain.back() &&
+                                    reduced_shape.size() == exec_domain.size() &&
+                                    std::equal(reduced_shape.begin(), reduced_shape.end() - 1, exec_domain.begin()),
+                              "Snippets reductions must cover all the rows of the execution domain");
+    }
     return exec_domain;
 }
 
@@ -211,6 +230,7 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::convert_to_snippet_dialect")
     ngraph::pass::Manager manager;
+    manager.register_pass<snippets::pass::ConvertReductionsToReduce>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
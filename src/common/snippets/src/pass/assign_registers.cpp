@@ -12,16 +12,22 @@
 #include <ngraph/opsets/opset1.hpp>
 
 #include <iterator>
+#include <map>
 
-bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr<ov::Model>& f) {
-    RUN_ON_FUNCTION_SCOPE(AssignRegisters);
-    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::AssignRegisters")
-    int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
-    using Reg = size_t;
+namespace {
+using Reg = size_t;
+
+// Performs the allocation for the current order of the model. Returns nullptrs if the live values fit the bank,
+// otherwise the value to spill and the statement the bank is exhausted at
+auto allocate(const std::shared_ptr<ov::Model>& f, std::map<std::shared_ptr<ngraph::descriptor::Tensor>, Reg>& physical_regs)
+    -> std::pair<std::shared_ptr<ngraph::Node>, std::shared_ptr<ngraph::Node>> {
+    using namespace ngraph;
     auto ops = f->get_ordered_ops();
     decltype(ops) stmts;
+    // the spills only read the registers and keep their results on the stack
     std::copy_if(ops.begin(), ops.end(), std::back_inserter(stmts), [](decltype(ops[0]) op) {
-        return !(std::dynamic_pointer_cast<opset1::Parameter>(op) || std::dynamic_pointer_cast<opset1::Result>(op));
+        return !(std::dynamic_pointer_cast<opset1::Parameter>(op) || std::dynamic_pointer_cast<opset1::Result>(op) ||
+                 ov::is_type<snippets::op::Spill>(op));
         });
 
     size_t rdx = 0;
@@ -108,13 +114,29 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         live_intervals.insert(std::make_pair(i, find_last_use(i)));
     }
 
+    // The accumulators of the reductions are alive through all the tile iterations, so they get dedicated registers
+    // from the end of the bank instead of being a part of the allocation
+    std::map<int, Reg> accumulators;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        if (ov::is_type<snippets::op::Reduce>(stmts[i])) {
+            if (accumulators.size() == 16)
+                throw ngraph_error("caanot allocate registers for a snippet ");
+            accumulators[i] = 16 - 1 - accumulators.size();
+        }
+    }
+
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
     std::multiset<std::pair<int, int>, by_ending> active;
     std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
+    for (int i = accumulators.size(); i < 16; i++) bank.push(16-1-i);
 
     for (auto interval : live_intervals) {
+        const auto accumulator = accumulators.find(interval.first);
+        if (accumulator != accumulators.end()) {
+            register_map[interval.first] = accumulator->second;
+            continue;
+        }
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -125,8 +147,26 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
-            throw ngraph_error("caanot allocate registers for a snippet ");
+        if (bank.empty()) {
+            // the value used the latest which isn't an operand of the current statement
+            const auto& current = stmts[interval.first];
+            const auto inputs = current->inputs();
+            std::shared_ptr<Node> candidate;
+            int candidate_end = interval.first;
+            for (const auto& x : active) {
+                const auto& node = stmts[x.first];
+                if (x.second <= candidate_end || ov::is_type<snippets::op::Reload>(node) ||
+                    std::dynamic_pointer_cast<snippets::op::Store>(node))
+                    continue;
+                const auto tensor = node->output(0).get_tensor_ptr();
+                if (std::any_of(inputs.begin(), inputs.end(), [&](const Input<Node>& in) { return in.get_tensor_ptr() == tensor; }))
+                    continue;
+                candidate = node;
+                candidate_end = x.second;
+            }
+            if (!candidate)
+                throw ngraph_error("caanot allocate registers for a snippet ");
+            return {candidate, current};
         } else {
             register_map[interval.first] = bank.top();
             bank.pop();
@@ -134,11 +174,54 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         }
     }
 
-    std::map<std::shared_ptr<descriptor::Tensor>, Reg> physical_regs;
-
+    physical_regs.clear();
     for (auto reg : regs) {
         physical_regs[reg.first] = register_map[reg.second];
     }
+    return {nullptr, nullptr};
+}
+
+// Stores the value to the stack slot right after it's computed and reloads it right before each of the consumers
+// following the statement the bank is exhausted at, so the value doesn't occupy a register in between
+void spill(const std::shared_ptr<ov::Model>& f, const std::shared_ptr<ngraph::Node>& value, const std::shared_ptr<ngraph::Node>& at,
+           size_t slot) {
+    using namespace ngraph;
+    const auto ops = f->get_ordered_ops();
+    auto position = [&ops](const std::shared_ptr<Node>& n) {
+        return std::find(ops.begin(), ops.end(), n) - ops.begin();
+    };
+
+    std::map<std::shared_ptr<Node>, std::vector<Input<Node>>> consumers;
+    for (const auto& in : value->get_output_target_inputs(0)) {
+        const auto consumer = in.get_node()->shared_from_this();
+        if (position(consumer) > position(at))
+            consumers[consumer].push_back(in);
+    }
+
+    const auto spilled = std::make_shared<snippets::op::Spill>(value->output(0), slot);
+    ops[position(value) + 1]->add_control_dependency(spilled);
+    for (const auto& consumer : consumers) {
+        const auto reload = std::make_shared<snippets::op::Reload>(spilled);
+        const auto& previous = ops[position(consumer.first) - 1];
+        if (previous != value)
+            reload->add_control_dependency(previous);
+        for (auto in : consumer.second) {
+            in.replace_source_output(reload);
+        }
+    }
+}
+}  // namespace
+
+bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_FUNCTION_SCOPE(AssignRegisters);
+    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::AssignRegisters")
+    int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
+    std::map<std::shared_ptr<descriptor::Tensor>, Reg> physical_regs;
+    size_t slot = 0;
+    // while the live values don't fit the bank, the one used the latest goes to the stack
+    for (auto spilled = allocate(f, physical_regs); spilled.first; spilled = allocate(f, physical_regs)) {
+        spill(f, spilled.first, spilled.second, slot++);
+    }
 
     size_t constantID = 0;
 
@@ -148,6 +231,10 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         if (std::dynamic_pointer_cast<opset1::Parameter>(n) || std::dynamic_pointer_cast<opset1::Result>(n)) {
             continue;
         }
+        // the spill keeps the value on the stack, its slot is the only attribute
+        if (ov::is_type<snippets::op::Spill>(n)) {
+            continue;
+        }
 
         // store only effective address
         if (auto result = std::dynamic_pointer_cast<snippets::op::Store>(n)) {
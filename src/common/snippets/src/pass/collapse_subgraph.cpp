@@ -33,6 +33,18 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // the dynamic outputs are scheduled if they can be broadcasted to a single shape of the same rank,
+    // the actual shapes are checked by the canonicalization
+    const bool is_dynamic = std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& output) {
+        return output.get_partial_shape().is_dynamic();
+    });
+    if (is_dynamic) {
+        PartialShape domain = outputs.begin()->get_partial_shape();
+        return std::any_of(outputs.begin(), outputs.end(), [&domain](const Output<const Node>& output) {
+            return output.get_partial_shape().rank() != domain.rank() ||
+                   !PartialShape::broadcast_merge_into(domain, output.get_partial_shape(), ::ngraph::op::AutoBroadcastType::NUMPY);
+        });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -103,12 +115,15 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
 }
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
+    // the dynamic shapes of the static ranks are scheduled at runtime
     auto supported = [](descriptor::Tensor& t) -> bool {
         return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+               t.get_partial_shape().rank().is_static();
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
+    // the axes of a reduction are an integer constant, which is folded into the snippet
+    const auto data_inputs_end = op::is_innermost_reduction(n) ? inputs.begin() + 1 : inputs.end();
     // todo: Is this check necessary? Remove if not
     for (const auto& out : outputs) {
         for (const auto &in_out : out.get_target_inputs()) {
@@ -117,7 +132,7 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    return std::all_of(inputs.begin(), data_inputs_end, [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -139,6 +154,40 @@ auto get_num_result_children(const std::shared_ptr<const Node> &node) -> size_t
     }
     return result;
 }
+// The result of a reduction is produced after the inner tiles, so it can't be consumed inside of the subgraph
+auto is_reduction_output(const Output<Node>& output) -> bool {
+    const auto subgraph = ov::as_type_ptr<op::Subgraph>(output.get_node_shared_ptr());
+    return subgraph &&
+           op::is_innermost_reduction(subgraph->get_body()->get_results()[output.get_index()]->get_input_node_shared_ptr(0));
+}
+
+// The reductions accumulate the rows of the execution domain, so they must cover it except for the reduced dimension
+auto reductions_are_not_schedulable(const std::shared_ptr<const op::Subgraph>& subgraph) -> bool {
+    std::vector<std::shared_ptr<Node>> reductions;
+    for (const auto& op : subgraph->get_body()->get_ordered_ops()) {
+        if (op::is_innermost_reduction(op))
+            reductions.push_back(op);
+    }
+    if (reductions.empty())
+        return false;
+
+    PartialShape domain = subgraph->get_output_partial_shape(0);
+    bool mergeable = true;
+    for (const auto& output : subgraph->outputs())
+        mergeable &= PartialShape::broadcast_merge_into(domain, output.get_partial_shape(), ::ngraph::op::AutoBroadcastType::NUMPY);
+    for (const auto& reduction : reductions)
+        mergeable &= PartialShape::broadcast_merge_into(domain, reduction->get_input_partial_shape(0), ::ngraph::op::AutoBroadcastType::NUMPY);
+    if (!mergeable || domain.is_dynamic())
+        return true;
+
+    const auto domain_shape = domain.get_shape();
+    return std::any_of(reductions.begin(), reductions.end(), [&domain_shape](const std::shared_ptr<Node>& reduction) {
+        const auto& reduced_shape = reduction->get_output_shape(0);
+        return reduction->get_input_shape(0).back() != domain_shape.back() || reduced_shape.size() != domain_shape.size() ||
+               !std::equal(reduced_shape.begin(), reduced_shape.end() - 1, domain_shape.begin());
+    });
+}
+
 // Need to update tensor name manually, since MKLDNNGraph::Replicate() looks at input.get_tensor().get_name();
 // If subgraph->get_output_size() == 1, then the name will be restored correctly from the node name
 auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &subgraph) -> void {
@@ -164,7 +213,7 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || op::is_innermost_reduction(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -241,8 +290,15 @@ TokenizeSnippets::TokenizeSnippets() {
             update_out_tensor_name(subgraph);
         };
 
+        // A reduction is worth only fusing into its elementwise producers, so it never makes a subgraph on its own
+        const bool is_reduction = op::is_innermost_reduction(node);
+
         auto abort_with_strategy = [&](const std::string& message_reset,
                                                      const std::string& message_abort = "", int priority = 3) {
+            if (is_reduction) {
+                remark(priority) << "Reduction isn't fused: " << message_reset << std::endl;
+                return false;
+            }
             if (strategy == continuation_strategy::reset) {
                 create_single_node_subgraph(node);
                 return true;
@@ -265,6 +321,12 @@ TokenizeSnippets::TokenizeSnippets() {
         OutputVector internal_inputs;
 
         auto input_values = node->input_values();
+        // subgraphs which produce reductions consumed by the node are kept apart
+        std::unordered_set<std::shared_ptr<Node>> reduction_producers;
+        for (const auto& input_value : input_values) {
+            if (is_reduction_output(input_value))
+                reduction_producers.insert(input_value.get_node_shared_ptr());
+        }
         /* 
         * Called with subgraph->input_value(i) arg and used to 
         * Check that the attached node input subgraph has the same input as the node itself.
@@ -307,7 +369,7 @@ TokenizeSnippets::TokenizeSnippets() {
 
         for (const auto &input_node : ngraph::as_node_vector(input_values)) {
             if (auto subgraph = ov::as_type_ptr<op::Subgraph>(input_node)) {
-                if (!clones.count(input_node)) {
+                if (!clones.count(input_node) && !reduction_producers.count(input_node)) {
                     auto f = ov::clone_model(*subgraph->get_body().get());
                     f->set_friendly_name(subgraph->get_body()->get_friendly_name());
                     clones[input_node] = f;
@@ -316,6 +378,8 @@ TokenizeSnippets::TokenizeSnippets() {
         }
         //  If there are no input subgraphs no need to go further, just create a new one.
         if (clones.empty()) {
+            if (is_reduction)
+                return false;
             create_single_node_subgraph(node);
             remark(1) << "Starting subgraph at: "  << node->get_friendly_name()
                       << " with " << node->inputs().size() << " inputs and " << node->outputs().size()
@@ -330,7 +394,7 @@ TokenizeSnippets::TokenizeSnippets() {
         assert(!cyclicDependencyIsIntoduced(node, currentTopoBounds) && "Cyclic dependency is introduced by the node itself");
         for (const auto& input_value : input_values) {
             auto input_node = input_value.get_node_shared_ptr();
-            if (ov::is_type<op::Subgraph>(input_node) &&
+            if (ov::is_type<op::Subgraph>(input_node) && !reduction_producers.count(input_node) &&
                 !cyclicDependencyIsIntoduced(input_node, currentTopoBounds)) {
                 auto subgraph = std::static_pointer_cast<op::Subgraph>(input_node);
                 if (!input_subgraphs.count(input_node)) {
@@ -497,6 +561,9 @@ TokenizeSnippets::TokenizeSnippets() {
         if (outputs_are_not_broadcastable(subgraph))
             return abort_with_strategy("New subgraph is created due to outputs of a subgraph not broadcastable.");
 
+        if (reductions_are_not_schedulable(subgraph))
+            return abort_with_strategy("New subgraph is created due to reductions not covering the execution domain.");
+
         for (size_t i = 0; i < subgraph->get_output_size(); ++i) {
             for (auto target_input : subgraph_result_inputs[i]) {
                 target_input.replace_source_output(subgraph->output(i));
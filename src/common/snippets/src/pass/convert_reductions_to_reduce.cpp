@@ -0,0 +1,30 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/op/subgraph.hpp"
+#include "snippets/pass/convert_reductions_to_reduce.hpp"
+#include <ngraph/rt_info.hpp>
+
+
+ngraph::snippets::pass::ConvertReductionsToReduce::ConvertReductionsToReduce() {
+    MATCHER_SCOPE(ConvertReductionsToReduce);
+    auto reduction = std::make_shared<pattern::op::Label>(pattern::any_input(),
+                                                    [](std::shared_ptr<Node> n) {
+                                                        return snippets::op::is_innermost_reduction(n);
+                                                    });
+    ngraph::graph_rewrite_callback callback = [this](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ConvertReductionsToReduce")
+        auto root = m.get_match_root();
+        const auto kind = is_type<opset1::ReduceMax>(root) ? snippets::op::Reduce::Kind::Max : snippets::op::Reduce::Kind::Sum;
+        auto reduce = std::make_shared<snippets::op::Reduce>(root->input_value(0), kind);
+        reduce->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, reduce);
+        ngraph::replace_node(root, reduce);
+
+        return true;
+    };
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(reduction), callback);
+}
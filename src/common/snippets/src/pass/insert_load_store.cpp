@@ -61,7 +61,12 @@ ngraph::snippets::pass::InsertStore::InsertStore() {
                 }
             }
 
-            auto store = std::make_shared<ngraph::snippets::op::Store> (root->input_value(0));
+            // the result of a reduction is available only after the inner tiles, so it's stored once per row
+            std::shared_ptr<ngraph::Node> store;
+            if (ov::is_type<ngraph::snippets::op::Reduce>(root->get_input_node_shared_ptr(0)))
+                store = std::make_shared<ngraph::snippets::op::ReduceStore> (root->input_value(0));
+            else
+                store = std::make_shared<ngraph::snippets::op::Store> (root->input_value(0));
             ngraph::copy_runtime_info(root, store);
             root->set_argument(0, store);
             return true;
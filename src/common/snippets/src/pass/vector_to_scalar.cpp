@@ -33,6 +33,9 @@ ngraph::snippets::pass::ReplaceStoresWithScalarStores::ReplaceStoresWithScalarSt
             [this](ngraph::pattern::Matcher &m) {
             OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ReplaceStoresWithScalarStores_callback")
             auto root = m.get_match_root();
+            // the reductions are stored after the tiles, so there is no tail for them
+            if (ov::is_type<ngraph::snippets::op::ReduceStore>(root))
+                return false;
             auto store = std::make_shared<ngraph::snippets::op::ScalarStore> (root->input_value(0));
             store->set_friendly_name(root->get_friendly_name());
             ngraph::copy_runtime_info(root, store);
@@ -40,3 +43,20 @@ ngraph::snippets::pass::ReplaceStoresWithScalarStores::ReplaceStoresWithScalarSt
             return true;
         });
 }
+
+ngraph::snippets::pass::ReplaceReductionsWithScalarReductions::ReplaceReductionsWithScalarReductions() {
+    MATCHER_SCOPE(ReplaceReductionsWithScalarReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::snippets::op::Reduce>()),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ReplaceReductionsWithScalarReductions_callback")
+            auto root = ov::as_type_ptr<ngraph::snippets::op::Reduce>(m.get_match_root());
+            if (!root || ov::is_type<ngraph::snippets::op::ScalarReduce>(root))
+                return false;
+            auto reduce = std::make_shared<ngraph::snippets::op::ScalarReduce> (root->input_value(0), root->get_kind());
+            reduce->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, reduce);
+            ngraph::replace_node(root, reduce);
+            return true;
+        });
+}
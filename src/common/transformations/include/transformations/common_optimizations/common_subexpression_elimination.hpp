@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API CommonSubexpressionElimination;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief CommonSubexpressionElimination transformation replaces the operations which have the same type, attributes
+ * and input values (and the Constants with the same data) with the first of them. The model is processed in one
+ * pass in topological order, so the chains of the duplicated operations are merged from the inputs to the outputs.
+ * Stateful, random and sub-graph operations and the operations with the attributes those can't be compared are kept.
+ */
+class ngraph::pass::CommonSubexpressionElimination: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& f) override;
+};
@@ -22,6 +22,11 @@ class TRANSFORMATIONS_API TransposeEltwise;
 class TRANSFORMATIONS_API TransposeReduction;
 class TRANSFORMATIONS_API TransposeFQReduction;
 class TRANSFORMATIONS_API TransposeFuse;
+class TRANSFORMATIONS_API TransposeUnary;
+class TRANSFORMATIONS_API TransposeBinaryEltwise;
+class TRANSFORMATIONS_API TransposeConcat;
+class TRANSFORMATIONS_API TransposePad;
+class TRANSFORMATIONS_API TransposeInterpolate;
 
 }  // namespace pass
 }  // namespace ngraph
@@ -66,6 +71,59 @@ public:
     TransposeEltwise();
 };
 
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeUnary transformation sinks Transpose through the unary elementwise operations
+ */
+class ngraph::pass::TransposeUnary : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeUnary();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeBinaryEltwise transformation sinks Transposes through the binary elementwise operation in case all its
+ * inputs are either Transposes with the same order or Constants, the Constants are transposed with the reversed order
+ */
+class ngraph::pass::TransposeBinaryEltwise : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeBinaryEltwise();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeConcat transformation sinks Transposes through Concat in case all its inputs are either Transposes
+ * with the same order or Constants, the concatenation axis is updated with the order
+ */
+class ngraph::pass::TransposeConcat : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeConcat();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposePad transformation sinks Transpose through Pad, the pads are permuted with the reversed order
+ */
+class ngraph::pass::TransposePad : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposePad();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeInterpolate transformation sinks Transpose through Interpolate with the explicit axes input, the axes
+ * are updated with the order
+ */
+class ngraph::pass::TransposeInterpolate : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeInterpolate();
+};
+
 /**
  * @ingroup ie_transformation_common_api
  * @brief TransposeFuse transformation eliminates 2 consequtive Transposes if they result in no changes to input or fuses them
@@ -79,7 +137,9 @@ public:
 
 /**
  * @ingroup ie_transformation_common_api
- * @brief TransposeSinking transformation sinks Transposes through known operations
+ * @brief TransposeSinking transformation sinks Transposes through known operations, so the Transposes of the layout
+ * conversions (e.g. around the NHWC sub-graphs of the TF models) travel down until they are fused with each other or
+ * reach the operation they can't be sunk through
  */
 class ngraph::pass::TransposeSinking: public ngraph::pass::GraphRewrite {
 public:
@@ -89,6 +149,11 @@ public:
         add_matcher<ngraph::pass::TransposeReduction>();
         add_matcher<ngraph::pass::TransposeConvert>();
         add_matcher<ngraph::pass::TransposeEltwise>();
+        add_matcher<ngraph::pass::TransposeUnary>();
+        add_matcher<ngraph::pass::TransposeBinaryEltwise>();
+        add_matcher<ngraph::pass::TransposeConcat>();
+        add_matcher<ngraph::pass::TransposePad>();
+        add_matcher<ngraph::pass::TransposeInterpolate>();
         add_matcher<ngraph::pass::TransposeFuse>();
     }
 };
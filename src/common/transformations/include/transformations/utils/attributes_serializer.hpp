@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <openvino/core/attribute_visitor.hpp>
+#include <openvino/core/partial_shape.hpp>
+#include <openvino/core/model.hpp>
+#include <openvino/op/util/variable.hpp>
+
+namespace ngraph {
+namespace op {
+namespace util {
+
+template <typename T>
+inline void append_value(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+inline void append_value(std::string& key, const std::string& value) {
+    append_value(key, value.size());
+    key.append(value);
+}
+
+inline void append_value(std::string& key, const ov::PartialShape& shape) {
+    std::ostringstream stream;
+    stream << shape;
+    append_value(key, stream.str());
+}
+
+template <typename T>
+inline void append_vector(std::string& key, const std::vector<T>& values) {
+    append_value(key, values.size());
+    for (const auto& value : values)
+        append_value(key, value);
+}
+
+/**
+ * @brief Writes the attributes of the operation to the key, so the operations with equal attributes have equal keys.
+ * The values are written in the binary form, so the floating point attributes are compared exactly.
+ * The key is incomplete if some attribute can't be written (e.g. the sub-graphs port maps or the buffers).
+ */
+class AttributesSerializer : public ov::AttributeVisitor {
+public:
+    explicit AttributesSerializer(std::string& key) : m_key(key) {}
+
+    bool is_complete() const {
+        return m_complete;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        append_value(m_key, name);
+        if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            append_value(m_key, a->get());
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            append_value(m_key, a->get()->get_info().variable_id);
+        } else {
+            m_complete = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        write_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_complete = false;
+    }
+
+private:
+    template <typename T>
+    void write_value(const std::string& name, const T& value) {
+        append_value(m_key, name);
+        append_value(m_key, value);
+    }
+
+    template <typename T>
+    void write_vector(const std::string& name, const std::vector<T>& values) {
+        append_value(m_key, name);
+        append_vector(m_key, values);
+    }
+
+    std::string& m_key;
+    bool m_complete = true;
+};
+
+}  // namespace util
+}  // namespace op
+}  // namespace ngraph
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "itt.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/core/attribute_visitor.hpp>
+#include <openvino/op/sink.hpp>
+#include <openvino/op/util/read_value_base.hpp>
+#include <openvino/op/util/variable.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/utils/attributes_serializer.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::CommonSubexpressionElimination, "CommonSubexpressionElimination", 0);
+
+namespace {
+
+using ngraph::op::util::append_value;
+using ngraph::op::util::append_vector;
+using ngraph::op::util::AttributesSerializer;
+
+uint64_t hash_data(const char* data, size_t size) {
+    // FNV-1a over the 8 byte words, the tail is hashed by bytes
+    constexpr uint64_t prime = 0x100000001B3ull;
+    uint64_t seed = 0xCBF29CE484222325ull ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        seed = (seed ^ word) * prime;
+    }
+    for (; i < size; i++)
+        seed = (seed ^ static_cast<uint8_t>(data[i])) * prime;
+    return seed;
+}
+
+bool is_eliminable(const std::shared_ptr<ngraph::Node>& node) {
+    if (ov::is_type<ngraph::opset1::Parameter>(node) || ov::is_type<ngraph::opset1::Result>(node) ||
+        ov::is_type<ov::op::Sink>(node) || ov::is_type<ov::op::util::ReadValueBase>(node) ||
+        ov::is_type<ngraph::opset8::RandomUniform>(node) ||
+        ov::is_type<ngraph::op::util::SubGraphOp>(node))
+        return false;
+    // the control dependencies define the execution order, which is lost when the node is merged with another one
+    return node->get_control_dependencies().empty() && node->get_control_dependents().empty() &&
+           node->get_output_size() > 0;
+}
+
+// The key contains the type of the operation, its input values, outputs types and attributes. The Constants are keyed
+// by the hash of their data, so the candidates with equal keys must be compared by the data.
+bool make_key(const std::shared_ptr<ngraph::Node>& node, std::string& key) {
+    const auto& type_info = node->get_type_info();
+    append_value(key, std::string(type_info.name));
+    append_value(key, type_info.get_version());
+
+    if (auto constant = ov::as_type_ptr<ngraph::opset1::Constant>(node)) {
+        append_value(key, constant->get_element_type().get_type_name());
+        append_vector(key, static_cast<const std::vector<size_t>&>(constant->get_shape()));
+        append_value(key, hash_data(constant->get_data_ptr<char>(), constant->get_byte_size()));
+        return true;
+    }
+
+    append_value(key, node->get_input_size());
+    for (const auto& input : node->input_values()) {
+        append_value(key, input.get_node()->get_instance_id());
+        append_value(key, input.get_index());
+    }
+    append_value(key, node->get_output_size());
+    for (const auto& output : node->outputs()) {
+        append_value(key, output.get_element_type().get_type_name());
+        append_value(key, output.get_partial_shape());
+    }
+
+    AttributesSerializer serializer(key);
+    return node->visit_attributes(serializer) && serializer.is_complete();
+}
+
+bool are_equal_constants(const std::shared_ptr<ngraph::Node>& lhs, const std::shared_ptr<ngraph::Node>& rhs) {
+    const auto lhs_constant = ov::as_type_ptr<ngraph::opset1::Constant>(lhs);
+    const auto rhs_constant = ov::as_type_ptr<ngraph::opset1::Constant>(rhs);
+    if (!lhs_constant || !rhs_constant)
+        return true;
+    const auto size = lhs_constant->get_byte_size();
+    if (size != rhs_constant->get_byte_size())
+        return false;
+    const auto lhs_data = lhs_constant->get_data_ptr<char>();
+    const auto rhs_data = rhs_constant->get_data_ptr<char>();
+    return lhs_data == rhs_data || std::memcmp(lhs_data, rhs_data, size) == 0;
+}
+
+}  // namespace
+
+bool ngraph::pass::CommonSubexpressionElimination::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    RUN_ON_FUNCTION_SCOPE(CommonSubexpressionElimination);
+    bool graph_rewritten = false;
+
+    // The ops are visited in topological order, so the inputs of the node are already replaced with the first ones of
+    // their equivalence classes and the input values in the key identify the classes.
+    std::unordered_map<std::string, std::vector<std::shared_ptr<ngraph::Node>>> key_to_nodes;
+    for (const auto& node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            if (auto sub_graph = sub_graph_node->get_function())
+                graph_rewritten |= run_on_model(sub_graph);
+
+        if (!is_eliminable(node))
+            continue;
+
+        std::string key;
+        if (!make_key(node, key))
+            continue;
+
+        auto& candidates = key_to_nodes[key];
+        std::shared_ptr<ngraph::Node> root;
+        for (const auto& candidate : candidates) {
+            if (are_equal_constants(candidate, node)) {
+                root = candidate;
+                break;
+            }
+        }
+        if (!root) {
+            candidates.push_back(node);
+            continue;
+        }
+
+        bool replaced = false;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+            replaced |= replace_output_update_name(node->output(i), root->output(i));
+        if (replaced) {
+            copy_runtime_info({root, node}, root);
+            graph_rewritten = true;
+        }
+    }
+    return graph_rewritten;
+}
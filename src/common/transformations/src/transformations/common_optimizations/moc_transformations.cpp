@@ -20,6 +20,7 @@
 #include <transformations/common_optimizations/convert_quantize_dequantize.hpp>
 #include <transformations/common_optimizations/pad_fusion.hpp>
 #include <transformations/common_optimizations/simplify_shape_of_sub_graph.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
 #include <transformations/op_conversions/convert_scatter_elements_to_scatter.hpp>
 #include <transformations/common_optimizations/clamp_fusion.hpp>
 #include <transformations/common_optimizations/mvn_fusion.hpp>
@@ -96,6 +97,8 @@ bool ngraph::pass::MOCTransformations::run_on_model(const std::shared_ptr<ngraph
     manager.register_pass<ngraph::pass::DisableRandomUniformConstantFolding>();
     manager.register_pass<ngraph::pass::ConstantFolding>();
     manager.register_pass<ngraph::pass::Validate>();
+    // merge the duplicated sub-graphs and constants before the fusions, so the patterns see the shared values
+    manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
 
     // FusedFilteringBoxesBySize transformation has the complex pattern
     // which can be affected by further transformations. So we have to
@@ -33,6 +33,8 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
     MATCHER_SCOPE(MVNFusionWithoutConstants);
     // Detect MVN decomposition pattern:
     // (x - ReduceMean(x, axes)) / (Sqrt(ReduceMean((x - ReduceMean(x, axes)) ^ 2)) + eps)
+    // the square may be Power(d, 2), Multiply(d, d) or SquaredDifference(x, mean),
+    // the inverse square root with the eps inside may be Power(var + eps, -0.5)
     auto x = pattern::any_input();
 
     // (x - ReduceMean(x, axes))
@@ -63,10 +65,20 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
     auto const_2 = pattern::wrap_type<opset6::Constant>(value_is_equal_to<float>({ 2.0 }));
     auto power = pattern::wrap_type<opset6::Power>({ hasConvertOrNot, const_2 });
 
+    // Sqrt(ReduceMean((x - ReduceMean(x, axes)) * (x - ReduceMean(x, axes))))
+    //                 `---------------------------square_mul-------------'
+    auto square_mul = pattern::wrap_type<opset6::Multiply>({ hasConvertOrNot, hasConvertOrNot });
+
+    // Sqrt(ReduceMean(SquaredDifference(x, ReduceMean(x, axes))))
+    //                 `-squared_difference----------------------'
+    auto squared_difference = pattern::wrap_type<opset6::SquaredDifference>({ x, mean2 });
+
+    const auto square = std::make_shared<pattern::op::Or>(OutputVector{ power, square_mul, squared_difference });
+
     // Sqrt(ReduceMean((x - ReduceMean(x, axes)) ^ 2))
     //     `---mean3--------------------------------'
     auto mean3_axes = pattern::wrap_type<opset6::Constant>();
-    auto mean3 = pattern::wrap_type<opset6::ReduceMean>({ power, mean3_axes });
+    auto mean3 = pattern::wrap_type<opset6::ReduceMean>({ square, mean3_axes });
 
     auto const_0_5 = pattern::wrap_type<ngraph::opset6::Constant>(value_is_equal_to<float>({0.5}));
     auto eps = pattern::wrap_type<opset6::Constant>();
@@ -102,7 +114,13 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
     auto div = pattern::wrap_type<opset6::Multiply>({ sub1, power_div });
 
     auto div_alt = pattern::wrap_type<opset6::Divide>({ sub1, outsideOrInside });
-    const auto powerMulOrDiv = std::make_shared<pattern::op::Or>(OutputVector{ div, div_alt });
+
+    // (x - ReduceMean(x, axes)) * (ReduceMean((x - ReduceMean(x, axes)) ^ 2) + eps) ^ -0.5
+    // `----------------------------------------------------------------------div_rsqrt----'
+    auto const_neg_0_5 = pattern::wrap_type<opset6::Constant>(value_is_equal_to<float>({ -0.5 }));
+    auto power_rsqrt = pattern::wrap_type<opset6::Power>({ add_eps_is, const_neg_0_5 });
+    auto div_rsqrt = pattern::wrap_type<opset6::Multiply>({ sub1, power_rsqrt });
+    const auto powerMulOrDiv = std::make_shared<pattern::op::Or>(OutputVector{ div, div_alt, div_rsqrt });
 
     ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher& m) {
         auto& pattern_to_output = m.get_pattern_value_map();
@@ -138,13 +156,30 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
             }
         }
 
+        if (pattern_to_output.count(square_mul)) {
+            auto square_mul_node = pattern_to_output.at(square_mul).get_node_shared_ptr();
+            if (square_mul_node->input_value(0) != square_mul_node->input_value(1)) {
+                return false;
+            }
+        }
+
         ngraph::NodeVector nodes_to_copy_info({ pattern_to_output.at(mean1).get_node_shared_ptr(),
                                                 pattern_to_output.at(sub1).get_node_shared_ptr(),
-                                                pattern_to_output.at(power).get_node_shared_ptr(),
                                                 pattern_to_output.at(mean3).get_node_shared_ptr() });
+        if (pattern_to_output.count(power)) {
+            nodes_to_copy_info.push_back(pattern_to_output.at(power).get_node_shared_ptr());
+        } else if (pattern_to_output.count(square_mul)) {
+            nodes_to_copy_info.push_back(pattern_to_output.at(square_mul).get_node_shared_ptr());
+        } else if (pattern_to_output.count(squared_difference)) {
+            nodes_to_copy_info.push_back(pattern_to_output.at(squared_difference).get_node_shared_ptr());
+        }
 
         op::MVNEpsMode mode;
-        if (pattern_to_output.count(add_eps_os)) {
+        if (pattern_to_output.count(power_rsqrt)) {
+            mode = op::MVNEpsMode::INSIDE_SQRT;
+            nodes_to_copy_info.push_back(pattern_to_output.at(add_eps_is).get_node_shared_ptr());
+            nodes_to_copy_info.push_back(pattern_to_output.at(power_rsqrt).get_node_shared_ptr());
+        } else if (pattern_to_output.count(add_eps_os)) {
             mode = op::MVNEpsMode::OUTSIDE_SQRT;
             nodes_to_copy_info.push_back(pattern_to_output.at(add_eps_os).get_node_shared_ptr());
             if (pattern_to_output.count(power_sqrt_os)) {
@@ -168,13 +203,17 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
         if (pattern_to_output.count(mean2) && pattern_to_output.count(sub2)) {
             nodes_to_copy_info.push_back(pattern_to_output.at(mean2).get_node_shared_ptr());
             nodes_to_copy_info.push_back(pattern_to_output.at(sub2).get_node_shared_ptr());
+        } else if (pattern_to_output.count(mean2) && pattern_to_output.count(squared_difference)) {
+            nodes_to_copy_info.push_back(pattern_to_output.at(mean2).get_node_shared_ptr());
         }
 
         if (pattern_to_output.count(cast)) {
             nodes_to_copy_info.push_back(pattern_to_output.at(cast).get_node_shared_ptr());
         }
 
-        if (pattern_to_output.count(div_alt)) {
+        if (pattern_to_output.count(div_rsqrt)) {
+            nodes_to_copy_info.push_back(pattern_to_output.at(div_rsqrt).get_node_shared_ptr());
+        } else if (pattern_to_output.count(div_alt)) {
             nodes_to_copy_info.push_back(pattern_to_output.at(div_alt).get_node_shared_ptr());
         } else if (pattern_to_output.count(power_div) && pattern_to_output.count(div)) {
             nodes_to_copy_info.push_back(pattern_to_output.at(power_div).get_node_shared_ptr());
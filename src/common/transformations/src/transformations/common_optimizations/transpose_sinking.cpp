@@ -21,6 +21,11 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeEltwise, "TransposeEltwise", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeReduction, "TransposeReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFQReduction, "TransposeFQReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFuse, "TransposeFuse", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeUnary, "TransposeUnary", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeBinaryEltwise, "TransposeBinaryEltwise", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeConcat, "TransposeConcat", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposePad, "TransposePad", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeInterpolate, "TransposeInterpolate", 0);
 
 using namespace ngraph;
 
@@ -60,6 +65,69 @@ std::shared_ptr<ngraph::opset6::Constant> get_reversed_order_constant(const std:
             ngraph::element::i64, ngraph::Shape{reverse_order.size()}, reverse_order);
 }
 
+std::shared_ptr<ngraph::opset6::Constant> get_transpose_order(const ngraph::Output<ngraph::Node>& output) {
+    if (!ov::is_type<ngraph::opset6::Transpose>(output.get_node()))
+        return nullptr;
+    return std::dynamic_pointer_cast<ngraph::opset6::Constant>(output.get_node()->get_input_node_shared_ptr(1));
+}
+
+// the order of the first input which is Transpose with the constant order, nullptr if there is no such input
+std::shared_ptr<ngraph::opset6::Constant> find_inputs_transpose_order(const std::shared_ptr<ngraph::Node>& node) {
+    for (const auto& input : node->input_values()) {
+        if (auto order = get_transpose_order(input))
+            return order;
+    }
+    return nullptr;
+}
+
+// Replaces the input Transposes with the given order by their inputs and transposes the input Constants with the
+// reversed order, so the node can be executed before the Transpose. Returns false if some input is neither of them or
+// the input Transpose has other consumers
+bool get_sunk_inputs(const std::shared_ptr<ngraph::Node>& node,
+                     const std::shared_ptr<ngraph::opset6::Constant>& order_const,
+                     ngraph::OutputVector& new_inputs,
+                     ngraph::NodeVector& new_ops) {
+    const auto order = order_const->cast_vector<int64_t>();
+    const auto rank = order.size();
+    std::shared_ptr<ngraph::opset6::Constant> reversed_order;
+    for (const auto& input : node->input_values()) {
+        if (auto input_order = get_transpose_order(input)) {
+            if (input_order->cast_vector<int64_t>() != order || input.get_target_inputs().size() != 1)
+                return false;
+            new_inputs.push_back(input.get_node()->input_value(0));
+            continue;
+        }
+
+        auto constant = ov::as_type_ptr<ngraph::opset6::Constant>(input.get_node_shared_ptr());
+        if (!constant || constant->get_shape().size() > rank)
+            return false;
+        if (ov::shape_size(constant->get_shape()) == 1) {
+            // the broadcasted scalar is the same in any layout
+            new_inputs.push_back(input);
+            continue;
+        }
+
+        ngraph::Output<ngraph::Node> value = input;
+        const auto ranks_diff = rank - constant->get_shape().size();
+        if (ranks_diff > 0) {
+            std::vector<int64_t> axes(ranks_diff);
+            std::iota(axes.begin(), axes.end(), 0);
+            const auto axes_const = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{axes.size()}, axes);
+            new_ops.push_back(axes_const);
+            value = ngraph::op::util::make_try_fold<ngraph::opset6::Unsqueeze>(value, axes_const);
+            new_ops.push_back(value.get_node_shared_ptr());
+        }
+        if (!reversed_order) {
+            reversed_order = get_reversed_order_constant(order_const);
+            new_ops.push_back(reversed_order);
+        }
+        value = ngraph::op::util::make_try_fold<ngraph::opset6::Transpose>(value, reversed_order);
+        new_ops.push_back(value.get_node_shared_ptr());
+        new_inputs.push_back(value);
+    }
+    return true;
+}
+
 } // namespace
 
 ngraph::pass::TransposeEltwise::TransposeEltwise() {
@@ -137,6 +205,220 @@ ngraph::pass::TransposeConvert::TransposeConvert() {
     register_matcher(m, matcher_pass_callback);
 }
 
+ngraph::pass::TransposeUnary::TransposeUnary() {
+    MATCHER_SCOPE(TransposeUnary);
+
+    auto transpose_label = pattern::wrap_type<opset6::Transpose>({pattern::any_input(),
+                                                                  pattern::wrap_type<opset6::Constant>()},
+                                                                  pattern::consumers_count(1));
+    auto unary_label = pattern::wrap_type<op::util::UnaryElementwiseArithmetic, opset6::Clamp, opset6::Elu, opset6::SoftPlus>(
+            {transpose_label});
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto unary = pattern_to_output.at(unary_label).get_node_shared_ptr();
+
+        auto new_unary = unary->clone_with_new_inputs({transpose->input_value(0)});
+        auto new_transpose = transpose->clone_with_new_inputs({new_unary, transpose->input_value(1)});
+        register_new_node(new_transpose);
+
+        new_transpose->set_friendly_name(unary->get_friendly_name());
+        copy_runtime_info({transpose, unary}, {new_unary, new_transpose});
+        replace_node(unary, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(unary_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeBinaryEltwise::TransposeBinaryEltwise() {
+    MATCHER_SCOPE(TransposeBinaryEltwise);
+
+    auto eltwise_label = pattern::wrap_type<op::util::BinaryElementwiseArithmetic,
+                                            op::util::BinaryElementwiseComparison,
+                                            op::util::BinaryElementwiseLogical>(pattern::has_static_rank());
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto eltwise = m.get_match_root();
+        // TransposeEltwise moves the Transposes up through the preprocessing eltwises, so they are not sunk back
+        if (ov::is_preprocesing_node(eltwise) || eltwise->get_autob().m_type != ngraph::op::AutoBroadcastType::NUMPY)
+            return false;
+
+        auto order = find_inputs_transpose_order(eltwise);
+        if (!order || ov::shape_size(order->get_shape()) !=
+                      static_cast<size_t>(eltwise->get_output_partial_shape(0).rank().get_length()))
+            return false;
+
+        ngraph::OutputVector new_inputs;
+        ngraph::NodeVector new_ops;
+        if (!get_sunk_inputs(eltwise, order, new_inputs, new_ops))
+            return false;
+
+        auto new_eltwise = eltwise->clone_with_new_inputs(new_inputs);
+        new_ops.push_back(new_eltwise);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_eltwise, order);
+        new_ops.push_back(new_transpose);
+        new_transpose->set_friendly_name(eltwise->get_friendly_name());
+
+        NodeVector old_ops{eltwise};
+        for (const auto& input : eltwise->input_values())
+            old_ops.push_back(input.get_node_shared_ptr());
+        copy_runtime_info(old_ops, new_ops);
+        replace_node(eltwise, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeConcat::TransposeConcat() {
+    MATCHER_SCOPE(TransposeConcat);
+
+    auto concat_label = pattern::wrap_type<opset6::Concat>(pattern::has_static_rank());
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto concat = std::dynamic_pointer_cast<opset6::Concat>(m.get_match_root());
+        if (!concat)
+            return false;
+
+        const auto rank = concat->get_output_partial_shape(0).rank().get_length();
+        auto order = find_inputs_transpose_order(concat);
+        if (!order || ov::shape_size(order->get_shape()) != static_cast<size_t>(rank))
+            return false;
+
+        ngraph::OutputVector new_inputs;
+        ngraph::NodeVector new_ops;
+        if (!get_sunk_inputs(concat, order, new_inputs, new_ops))
+            return false;
+
+        // the axis of the transposed tensor is the order[axis] axis of the Transposes inputs
+        auto axis = concat->get_axis();
+        if (axis < 0)
+            axis += rank;
+        auto new_concat = std::make_shared<opset6::Concat>(new_inputs, order->cast_vector<int64_t>()[axis]);
+        new_ops.push_back(new_concat);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_concat, order);
+        new_ops.push_back(new_transpose);
+        new_transpose->set_friendly_name(concat->get_friendly_name());
+
+        NodeVector old_ops{concat};
+        for (const auto& input : concat->input_values())
+            old_ops.push_back(input.get_node_shared_ptr());
+        copy_runtime_info(old_ops, new_ops);
+        replace_node(concat, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(concat_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposePad::TransposePad() {
+    MATCHER_SCOPE(TransposePad);
+
+    // Pad has the optional pad value input, so the Transpose is checked in the callback
+    auto pad_label = pattern::wrap_type<opset6::Pad>();
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto pad = m.get_match_root();
+        auto transpose = pad->get_input_node_shared_ptr(0);
+        auto order = get_transpose_order(pad->input_value(0));
+        if (!order || transpose->get_output_target_inputs(0).size() != 1)
+            return false;
+
+        // the pads of the axis i of the transposed tensor are the ones of the axis order[i] of the Transpose input
+        ngraph::NodeVector new_ops;
+        auto reversed_order = get_reversed_order_constant(order);
+        auto gather_axis = opset6::Constant::create(element::i64, {}, {0});
+        new_ops.push_back(reversed_order);
+        ngraph::OutputVector new_inputs = {transpose->input_value(0)};
+        for (size_t i = 1; i < pad->get_input_size(); ++i) {
+            if (i > 2) {
+                new_inputs.push_back(pad->input_value(i));
+                continue;
+            }
+            auto new_pads = op::util::make_try_fold<opset6::Gather>(pad->input_value(i), reversed_order, gather_axis);
+            new_ops.push_back(new_pads);
+            new_inputs.push_back(new_pads);
+        }
+        auto new_pad = pad->clone_with_new_inputs(new_inputs);
+        new_ops.push_back(new_pad);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_pad, order);
+        new_ops.push_back(new_transpose);
+        new_transpose->set_friendly_name(pad->get_friendly_name());
+
+        copy_runtime_info({transpose, pad}, new_ops);
+        replace_node(pad, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(pad_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeInterpolate::TransposeInterpolate() {
+    MATCHER_SCOPE(TransposeInterpolate);
+
+    auto transpose_label = pattern::wrap_type<opset6::Transpose>({pattern::any_input(pattern::has_static_rank()),
+                                                                  pattern::wrap_type<opset6::Constant>()},
+                                                                  pattern::consumers_count(1));
+    auto interpolate_label = pattern::wrap_type<opset6::Interpolate>({transpose_label,
+                                                                      pattern::any_input(),
+                                                                      pattern::any_input(),
+                                                                      pattern::wrap_type<opset6::Constant>()});
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto interpolate = std::dynamic_pointer_cast<opset6::Interpolate>(pattern_to_output.at(interpolate_label).get_node_shared_ptr());
+        auto order = std::dynamic_pointer_cast<opset6::Constant>(transpose->get_input_node_shared_ptr(1));
+        if (!interpolate || !order)
+            return false;
+        auto axes = std::dynamic_pointer_cast<opset6::Constant>(interpolate->get_input_node_shared_ptr(3));
+        if (!axes)
+            return false;
+
+        const auto& order_values = order->cast_vector<int64_t>();
+        const auto rank = transpose->get_input_partial_shape(0).rank();
+        auto attrs = interpolate->get_attrs();
+        // the pads are defined per axis, so they are permuted as well
+        for (auto* pads : {&attrs.pads_begin, &attrs.pads_end}) {
+            if (std::all_of(pads->begin(), pads->end(), [](size_t pad) { return pad == 0; }))
+                continue;
+            if (pads->size() != order_values.size())
+                return false;
+            std::vector<size_t> new_pads(pads->size());
+            for (size_t i = 0; i < order_values.size(); ++i)
+                new_pads[order_values[i]] = (*pads)[i];
+            *pads = new_pads;
+        }
+
+        const auto& non_negative_axes = ngraph::normalize_axes(interpolate->get_friendly_name(), axes->cast_vector<int64_t>(), rank);
+        std::vector<int64_t> new_axes_values;
+        for (const auto& axis : non_negative_axes)
+            new_axes_values.push_back(order_values[axis]);
+        auto new_axes = opset6::Constant::create(axes->get_element_type(), {new_axes_values.size()}, new_axes_values);
+
+        auto new_interpolate = std::make_shared<opset6::Interpolate>(transpose->input_value(0),
+                                                                     interpolate->input_value(1),
+                                                                     interpolate->input_value(2),
+                                                                     new_axes,
+                                                                     attrs);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_interpolate, order);
+        new_transpose->set_friendly_name(interpolate->get_friendly_name());
+
+        copy_runtime_info({transpose, interpolate}, {new_axes, new_interpolate, new_transpose});
+        replace_node(interpolate, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(interpolate_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
 ngraph::pass::TransposeReduction::TransposeReduction() {
     MATCHER_SCOPE(TransposeReduction);
 
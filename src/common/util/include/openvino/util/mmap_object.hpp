@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory-mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only view of a file mapped into the process address space.
+ * Pages are faulted in lazily on first access, so parts of the file which are never read
+ * do not contribute to the resident set size.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns pointer to the beginning of the mapped region
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns size of the mapped region in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into memory in read-only mode.
+ * @param path Path to a file
+ * @return Reference to the mapped memory; the mapping is released together with the last reference
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified into memory in read-only mode.
+ * @param path Path to a file
+ * @return Reference to the mapped memory; the mapping is released together with the last reference
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace ov {
+namespace compact_ir {
+
+/**
+ * The compact IR is the binary form of the IR XML document written by ov::pass::CompactSerialize and read by the IR
+ * frontend. It holds the same elements, attributes and texts, so the IR frontend builds the same ov::Model from it, but
+ * it doesn't need the XML to be tokenized and unescaped and every distinct string is stored once.
+ * All the sections are addressed by their offsets from the beginning of the data, so it can be read in place:
+ *
+ *   [ Header                                              ]
+ *   [ String offsets: strings_count x uint64_t            ]
+ *   [ Strings: null-terminated, each distinct string once ]
+ *   [ Nodes: nodes_count x Node, in the document order    ]
+ *   [ Attributes: attributes_count x Attribute            ]
+ */
+
+constexpr char magic[8] = {'O', 'V', 'C', 'I', 'R', '\0', '\0', '\1'};
+constexpr uint32_t format_version = 1;
+constexpr uint32_t none = UINT32_MAX;
+
+enum class NodeType : uint32_t {
+    ELEMENT = 0,  // name is the element name
+    TEXT = 1      // name is the text
+};
+
+struct Header {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t ir_version;  // the version attribute of the root element as in the XML IR header
+    uint64_t string_offsets_offset;
+    uint64_t strings_count;
+    uint64_t nodes_offset;
+    uint64_t nodes_count;
+    uint64_t attributes_offset;
+    uint64_t attributes_count;
+};
+
+struct Node {
+    NodeType type;
+    uint32_t name;          // the string index
+    uint32_t first_child;   // the node index, none for no children
+    uint32_t next_sibling;  // the node index, none for the last child
+    uint32_t first_attribute;
+    uint32_t attributes_count;
+};
+
+struct Attribute {
+    uint32_t name;   // the string index
+    uint32_t value;  // the string index
+};
+
+/**
+ * @brief Checks that the data starts with the compact IR header
+ */
+inline bool is_compact_ir(const char* data, size_t size) {
+    return size >= sizeof(Header) && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+}  // namespace compact_ir
+}  // namespace ov
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace load_time_stats {
+
+/// \brief Adds the duration to the total time of the model loading phase in the process.
+///
+/// The phases are named "<stage>/<phase>", e.g. "read_model/load" or "transformations/ConstantFolding", the time of
+/// the stage itself is reported under its name. The phases can be nested, so the time of a phase includes the time of
+/// the phases run inside it.
+OPENVINO_API void add(const std::string& phase, std::chrono::nanoseconds duration);
+
+/// \brief Returns the total time in milliseconds of each phase measured in the process so far
+OPENVINO_API std::map<std::string, double> get();
+
+/// \brief Measures the time till the scope exit as the phase
+class Scope {
+public:
+    explicit Scope(std::string phase) : m_phase(std::move(phase)), m_start(std::chrono::steady_clock::now()) {}
+    ~Scope() {
+        add(m_phase, std::chrono::steady_clock::now() - m_start);
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    std::string m_phase;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace load_time_stats
+}  // namespace ov
@@ -179,6 +179,12 @@ public:
     /// \brief Returns true if any of the op's defined in the model contains partial shape
     bool is_dynamic() const;
 
+    /// \brief Returns the version of the model graph including its subgraphs. It changes every time the nodes are
+    /// connected, disconnected or destroyed, the parameters, results or sinks are changed or the output types of the
+    /// nodes are changed, so a pass that didn't change the model at some version doesn't change it at the same version
+    /// again. The changes of the attributes and the runtime info of the nodes don't change the version.
+    size_t get_graph_version() const;
+
     /// \brief Replace the `parameter_index`th parameter of the model with `parameter`.
     ///
     /// All users of the `parameter_index`th parameter are redirected to `parameter`, and the
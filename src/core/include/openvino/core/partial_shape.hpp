@@ -5,11 +5,13 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include "openvino/core/attribute_adapter.hpp"
 #include "openvino/core/dimension.hpp"
 #include "openvino/core/rank.hpp"
 #include "openvino/core/shape.hpp"
+#include "openvino/core/small_vector.hpp"
 #include "openvino/op/util/attr_types.hpp"
 
 namespace ov {
@@ -28,7 +30,8 @@ struct AutoBroadcastSpec;
 /// \li Static rank, and static dimensions on all axes.
 ///     (Informal notation examples: `{1,2,3,4}`, `{6}`, `{}`)
 class OPENVINO_API PartialShape {
-    using Dimensions = std::vector<Dimension>;
+    // the dimensions of the shapes with up to 6 axes are kept inline, without the heap memory
+    using Dimensions = SmallVector<Dimension, 6>;
 
 public:
     using iterator = Dimensions::iterator;
@@ -172,7 +175,7 @@ public:
     Dimension& operator[](size_t i);
     /// \brief Returns a vector of the dimensions. This has no meaning if dynamic.
     explicit operator std::vector<Dimension>() const {
-        return m_dimensions;
+        return std::vector<Dimension>(m_dimensions.begin(), m_dimensions.end());
     }
     friend OPENVINO_API std::ostream& operator<<(std::ostream& str, const PartialShape& shape);
     friend OPENVINO_API PartialShape operator+(const PartialShape& s1, const PartialShape& s2);
@@ -340,7 +343,7 @@ public:
 
 private:
     // Private constructor for PartialShape::dynamic().
-    PartialShape(bool rank_is_static, std::vector<Dimension> dimensions);
+    PartialShape(bool rank_is_static, Dimensions dimensions);
 
     // True if the shape's rank is static.
     bool m_rank_is_static;
@@ -75,6 +75,28 @@ public:
     /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
     PostProcessSteps& convert_layout(const std::vector<uint64_t>& dims);
 
+    /// \brief Add softmax operation over the 'channels' dimension of the output, or over the last dimension if current
+    /// layout doesn't have 'channels'
+    ///
+    /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner
+    PostProcessSteps& softmax();
+
+    /// \brief Add 'top K' operation over the 'channels' dimension of the output, or over the last dimension if current
+    /// layout doesn't have 'channels'. Output is replaced with 'i32' indices of K largest elements sorted by value, so
+    /// device produces the compact result instead of the whole scores tensor
+    ///
+    /// \example Example: classification model produces scores with shape [1, 1000] and user needs 5 best classes:
+    ///
+    /// \code{.cpp} auto proc = PrePostProcessor(function);
+    /// proc.output().postprocess().softmax().topk(5); // Output shape is [1, 5]
+    /// function = proc.build();
+    /// \endcode
+    ///
+    /// \param k Number of elements to keep, 'topk(1)' works as 'argmax'. Must be greater than zero.
+    ///
+    /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner
+    PostProcessSteps& topk(size_t k);
+
     /// \brief Signature for custom postprocessing operation. Custom postprocessing operation takes one output node and
     /// produces one output node. For more advanced cases, client's code can use transformation passes over ov::Model
     /// directly
@@ -0,0 +1,398 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+/// \brief A vector which keeps up to N elements inline and allocates the heap memory only for more elements.
+///
+/// It has the interface of std::vector, its iterators are pointers. The iterators and the references are invalidated
+/// by moving the vector as well, since the inline elements are moved one by one.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "SmallVector must keep at least one element inline");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SmallVector() noexcept : m_data(inline_data()) {}
+
+    explicit SmallVector(size_t count) : SmallVector() {
+        resize(count);
+    }
+
+    SmallVector(size_t count, const T& value) : SmallVector() {
+        assign(count, value);
+    }
+
+    template <class InputIterator,
+              typename std::enable_if<!std::is_integral<InputIterator>::value, bool>::type = true>
+    SmallVector(InputIterator first, InputIterator last) : SmallVector() {
+        assign(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> init) : SmallVector(init.begin(), init.end()) {}
+
+    SmallVector(const SmallVector& other) : SmallVector(other.begin(), other.end()) {}
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallVector() {
+        take(std::move(other));
+    }
+
+    ~SmallVector() {
+        clear();
+        release();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            release();
+            m_data = inline_data();
+            m_capacity = N;
+            take(std::move(other));
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    void assign(size_t count, const T& value) {
+        const T copy = value;
+        clear();
+        reserve(count);
+        for (; m_size < count; ++m_size) {
+            new (m_data + m_size) T(copy);
+        }
+    }
+
+    template <class InputIterator,
+              typename std::enable_if<!std::is_integral<InputIterator>::value, bool>::type = true>
+    void assign(InputIterator first, InputIterator last) {
+        clear();
+        append(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+    }
+
+    iterator begin() noexcept {
+        return m_data;
+    }
+    const_iterator begin() const noexcept {
+        return m_data;
+    }
+    iterator end() noexcept {
+        return m_data + m_size;
+    }
+    const_iterator end() const noexcept {
+        return m_data + m_size;
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+    const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+
+    size_t size() const noexcept {
+        return m_size;
+    }
+    bool empty() const noexcept {
+        return m_size == 0;
+    }
+    size_t capacity() const noexcept {
+        return m_capacity;
+    }
+    /// \brief Returns true if the elements are kept inline, without the heap memory
+    bool is_inline() const noexcept {
+        return m_data == inline_data();
+    }
+
+    T* data() noexcept {
+        return m_data;
+    }
+    const T* data() const noexcept {
+        return m_data;
+    }
+    T& operator[](size_t i) {
+        return m_data[i];
+    }
+    const T& operator[](size_t i) const {
+        return m_data[i];
+    }
+    T& at(size_t i) {
+        if (i >= m_size)
+            throw std::out_of_range("SmallVector index is out of range");
+        return m_data[i];
+    }
+    const T& at(size_t i) const {
+        if (i >= m_size)
+            throw std::out_of_range("SmallVector index is out of range");
+        return m_data[i];
+    }
+    T& front() {
+        return m_data[0];
+    }
+    const T& front() const {
+        return m_data[0];
+    }
+    T& back() {
+        return m_data[m_size - 1];
+    }
+    const T& back() const {
+        return m_data[m_size - 1];
+    }
+
+    void reserve(size_t new_capacity) {
+        if (new_capacity <= m_capacity)
+            return;
+        T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        size_t moved = 0;
+        try {
+            for (; moved < m_size; ++moved) {
+                new (new_data + moved) T(std::move_if_noexcept(m_data[moved]));
+            }
+        } catch (...) {
+            destroy(new_data, new_data + moved);
+            ::operator delete(new_data);
+            throw;
+        }
+        destroy(m_data, m_data + m_size);
+        release();
+        m_data = new_data;
+        m_capacity = new_capacity;
+    }
+
+    void resize(size_t count) {
+        if (count < m_size) {
+            erase(begin() + count, end());
+            return;
+        }
+        reserve(count);
+        for (; m_size < count; ++m_size) {
+            new (m_data + m_size) T();
+        }
+    }
+
+    void resize(size_t count, const T& value) {
+        if (count < m_size) {
+            erase(begin() + count, end());
+            return;
+        }
+        const T copy = value;
+        reserve(count);
+        for (; m_size < count; ++m_size) {
+            new (m_data + m_size) T(copy);
+        }
+    }
+
+    void clear() noexcept {
+        destroy(m_data, m_data + m_size);
+        m_size = 0;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        if (m_size == m_capacity) {
+            // the arguments may refer to the elements, so they are constructed before the elements are moved
+            T value(std::forward<Args>(args)...);
+            reserve(grown_capacity(m_size + 1));
+            new (m_data + m_size) T(std::move(value));
+        } else {
+            new (m_data + m_size) T(std::forward<Args>(args)...);
+        }
+        return m_data[m_size++];
+    }
+
+    void pop_back() {
+        m_data[--m_size].~T();
+    }
+
+    iterator insert(const_iterator position, const T& value) {
+        return insert(position, static_cast<size_t>(1), value);
+    }
+
+    iterator insert(const_iterator position, T&& value) {
+        const auto index = position - begin();
+        emplace_back(std::move(value));
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator position, size_t count, const T& value) {
+        const auto index = position - begin();
+        const T copy = value;
+        reserve(grown_capacity(m_size + count));
+        for (size_t i = 0; i < count; ++i) {
+            new (m_data + m_size) T(copy);
+            ++m_size;
+        }
+        std::rotate(begin() + index, end() - count, end());
+        return begin() + index;
+    }
+
+    template <class InputIterator,
+              typename std::enable_if<!std::is_integral<InputIterator>::value, bool>::type = true>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last) {
+        const auto index = position - begin();
+        // the range may refer to the elements, so it's copied before the elements are moved
+        SmallVector values(first, last);
+        reserve(grown_capacity(m_size + values.size()));
+        for (auto& value : values) {
+            new (m_data + m_size) T(std::move(value));
+            ++m_size;
+        }
+        std::rotate(begin() + index, end() - values.size(), end());
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator position, std::initializer_list<T> init) {
+        return insert(position, init.begin(), init.end());
+    }
+
+    iterator erase(const_iterator position) {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto index = first - begin();
+        if (first != last) {
+            auto new_end = std::move(begin() + (last - begin()), end(), begin() + index);
+            destroy(new_end, end());
+            m_size = new_end - begin();
+        }
+        return begin() + index;
+    }
+
+    void swap(SmallVector& other) {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    friend bool operator==(const SmallVector& lhs, const SmallVector& rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+    friend bool operator!=(const SmallVector& lhs, const SmallVector& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    T* inline_data() noexcept {
+        return reinterpret_cast<T*>(&m_inline);
+    }
+    const T* inline_data() const noexcept {
+        return reinterpret_cast<const T*>(&m_inline);
+    }
+
+    size_t grown_capacity(size_t min_capacity) const {
+        return std::max(min_capacity, 2 * m_capacity);
+    }
+
+    static void destroy(T* first, T* last) noexcept {
+        for (; first != last; ++first) {
+            first->~T();
+        }
+    }
+
+    // Frees the heap memory, the elements must be destroyed before
+    void release() noexcept {
+        if (!is_inline()) {
+            ::operator delete(m_data);
+        }
+    }
+
+    // Takes the elements of the other vector, this one must be empty and inline
+    void take(SmallVector&& other) {
+        if (other.is_inline()) {
+            for (; m_size < other.m_size; ++m_size) {
+                new (m_data + m_size) T(std::move(other.m_data[m_size]));
+            }
+            other.clear();
+        } else {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.inline_data();
+            other.m_size = 0;
+            other.m_capacity = N;
+        }
+    }
+
+    template <class InputIterator>
+    void append(InputIterator first, InputIterator last, std::input_iterator_tag) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    template <class ForwardIterator>
+    void append(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+        reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        for (; first != last; ++first) {
+            new (m_data + m_size) T(*first);
+            ++m_size;
+        }
+    }
+
+    T* m_data;
+    size_t m_size = 0;
+    size_t m_capacity = N;
+    typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type m_inline;
+};
+}  // namespace ov
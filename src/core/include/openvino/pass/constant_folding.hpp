@@ -14,10 +14,17 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *        The nodes whose inputs are all Constants are folded in waves: the nodes of a wave are independent, so the
+ *        standard operations of a wave with large inputs are evaluated concurrently.
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+
+    /// \param in_place Evaluate the elementwise operations into the buffer of their first input if it's a Constant
+    /// created by this pass which has no other consumers, instead of allocating the result
+    explicit ConstantFolding(bool in_place = false) : m_in_place(in_place) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
 protected:
@@ -25,6 +32,15 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& f);
+    /// \brief Folds the subgraphs of the nodes with Constant inputs wave by wave, the next wave is the consumers of
+    /// the folded nodes whose inputs became all Constants.
+    bool constant_subgraphs_folding(const std::shared_ptr<ov::Model>& f, bool revalidate);
+
+private:
+    /// \brief Replaces the node outputs with their folded values, returns true if any output is replaced
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+    bool m_in_place = false;
 };
 
 /**
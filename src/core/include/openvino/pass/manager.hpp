@@ -7,6 +7,7 @@
 #include <list>
 #include <memory>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include "openvino/pass/pass.hpp"
@@ -57,6 +58,14 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable skipping the matcher passes and the graph rewrites which didn't change the
+    /// same model at the same graph version before, e.g. when the same pipeline runs several times on the model.
+    /// The pass config and the transformation callbacks must not change between the runs.
+    /// \param new_state Value "true" enables skipping; "false", otherwise
+    void set_change_tracking(bool new_state) {
+        m_change_tracking = new_state;
+    }
+
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -110,6 +119,15 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_change_tracking = false;
+
+private:
+    // the model and its graph version each pass didn't change at
+    struct UnchangedModel {
+        std::weak_ptr<Model> model;
+        size_t graph_version;
+    };
+    std::unordered_map<const PassBase*, UnchangedModel> m_unchanged_models;
 };
 }  // namespace pass
 }  // namespace ov
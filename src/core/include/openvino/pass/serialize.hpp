@@ -56,6 +56,35 @@ private:
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
 };
 
+/**
+ * @brief CompactSerialize transformation converts ngraph::Function into the compact IR files: the topology is written
+ * in the binary form of the IR XML document, which the IR frontend reads without parsing the XML, the weights are
+ * written as by Serialize
+ * @attention
+ * - the topology file can't have the 'bin' extension, the weights file path is derived from it by replacing the
+ * extension with 'bin' if it's not provided
+ */
+class OPENVINO_API CompactSerialize : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("CompactSerialize");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    CompactSerialize(std::ostream& modelFile,
+                     std::ostream& binFile,
+                     Serialize::Version version = Serialize::Version::UNSPECIFIED);
+    CompactSerialize(const std::string& modelPath,
+                     const std::string& binPath = {},
+                     Serialize::Version version = Serialize::Version::UNSPECIFIED);
+
+private:
+    std::ostream* m_modelFile;
+    std::ostream* m_binFile;
+    const std::string m_modelPath;
+    std::string m_binPath;
+    const Serialize::Version m_version;
+};
+
 /**
  * @brief StreamSerialize transformation converts ngraph::Function into single binary stream
  * @attention
@@ -148,6 +148,15 @@ public:
     explicit operator bool() const noexcept;
 };
 
+/**
+ * @brief Returns the process-wide allocator which keeps the released memory in the free lists of size classes instead of
+ * returning it to the system, at first in the thread which released it. So the tensors reallocated with the varying
+ * sizes (e.g. the outputs of the dynamic shapes) reuse the memory pages without taking a lock in the most of cases.
+ * The memory is aligned at least to 64 bytes and may be released by the allocator without the size and alignment.
+ * @return The pooled allocator
+ */
+OPENVINO_API Allocator get_pooled_allocator();
+
 namespace runtime {
 using ov::Allocator;
 using ov::AllocatorImpl;
@@ -16,6 +16,7 @@
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph {
@@ -234,15 +235,17 @@ void convolution(const T* in,
     const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
     const size_t filter_size = shape_size(filter_shape);
 
-    auto batch = in;
-    for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx) {
-        auto filter = f;
-        for (size_t f_idx = 0; f_idx < filters_count; ++f_idx) {
-            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-            filter += filter_size;
+    // the output channels of all the batches are computed in parallel
+    const size_t out_channel_size = shape_size(Shape{std::next(out_shape.begin(), 2), out_shape.end()});
+    const size_t channel_work = out_channel_size * filter_size;
+    parallel_for(batches_count * filters_count, channel_work, [&](size_t begin, size_t end) {
+        for (size_t channel = begin; channel < end; ++channel) {
+            const auto batch = in + channel / filters_count * batch_size;
+            const auto filter = f + channel % filters_count * filter_size;
+            auto channel_out = out + channel * out_channel_size;
+            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, channel_out);
         }
-        batch += batch_size;
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -11,42 +11,59 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace details {
+// Computes the rows [begin, end) of the {I, K} x {K, J} product, the innermost loop over a row is vectorized
 template <typename T>
-void dot(const T* arg0,
-         const T* arg1,
-         T* out,
-         const Shape& arg0_shape,
-         const Shape& arg1_shape,
-         const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
-    const size_t arg0_rank = arg0_shape.size();
-    const size_t arg1_rank = arg1_shape.size();
-
-    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-    const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
-
-    for (size_t i = 0; i < I_dim; ++i) {
+void dot_rows(const T* arg0, const T* arg1, T* out, size_t K_dim, size_t J_dim, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        T* const out_row = out + i * J_dim;
+        std::fill(out_row, out_row + J_dim, T{0});
         for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
+            const T a = arg0[i * K_dim + k];
+            const T* const b_row = arg1 + k * J_dim;
             for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                out_row[j] += a * b_row[j];
             }
         }
     }
 }
 
+// 2D inputs shapes are interpreted as {I, K} x {K, J}
+// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+inline size_t dot_I_dim(const Shape& arg0_shape) {
+    return arg0_shape.size() == 1 ? 1 : arg0_shape[arg0_shape.size() - 2];
+}
+inline size_t dot_J_dim(const Shape& arg1_shape) {
+    return arg1_shape.size() == 1 ? 1 : arg1_shape[arg1_shape.size() - 1];
+}
+inline size_t dot_K_dim(const Shape& arg1_shape) {
+    return arg1_shape.size() == 1 ? arg1_shape[arg1_shape.size() - 1] : arg1_shape[arg1_shape.size() - 2];
+}
+
+template <typename T>
+void dot(const T* arg0,
+         const T* arg1,
+         T* out,
+         const Shape& arg0_shape,
+         const Shape& arg1_shape,
+         const Shape& /* out_shape */) {
+    const size_t I_dim = dot_I_dim(arg0_shape);
+    const size_t J_dim = dot_J_dim(arg1_shape);
+    const size_t K_dim = dot_K_dim(arg1_shape);
+
+    // the rows of the output are computed in parallel
+    parallel_for(I_dim, K_dim * J_dim, [&](size_t begin, size_t end) {
+        dot_rows(arg0, arg1, out, K_dim, J_dim, begin, end);
+    });
+}
+
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
 }  // namespace details
 /// \brief Reference kernel for matmul computation.
@@ -208,14 +225,25 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+
+    // the rows of all the batches are computed in parallel
+    const size_t I_dim = details::dot_I_dim(dot_arg0_shape);
+    const size_t J_dim = details::dot_J_dim(dot_arg1_shape);
+    const size_t K_dim = details::dot_K_dim(dot_arg1_shape);
+    parallel_for(output_batch_size * I_dim, K_dim * J_dim, [&](size_t begin, size_t end) {
+        while (begin < end) {
+            const size_t batch = begin / I_dim;
+            const size_t batch_end = std::min(end, (batch + 1) * I_dim);
+            details::dot_rows(arg0_data + batch * arg0_offset,
+                              arg1_data + batch * arg1_offset,
+                              out + batch * output_offset,
+                              K_dim,
+                              J_dim,
+                              begin - batch * I_dim,
+                              batch_end - batch * I_dim);
+            begin = batch_end;
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief The kernels doing less work than this (in the elementary operations) run on the calling thread, the threads
+/// would cost more than they save
+constexpr size_t parallel_for_min_work = 1 << 16;
+
+namespace details {
+// The number of the threads running the parallel_for calls of the process at the moment, the concurrent calls share
+// the hardware threads instead of starting hardware_concurrency threads each
+inline std::atomic<size_t>& parallel_for_busy_threads() {
+    static std::atomic<size_t> busy_threads{0};
+    return busy_threads;
+}
+
+// True on the threads running a parallel_for, the nested calls run on the calling thread
+inline bool& in_parallel_for() {
+    static thread_local bool in_parallel = false;
+    return in_parallel;
+}
+
+class ParallelForScope {
+public:
+    explicit ParallelForScope(size_t threads) : m_threads(threads), m_was_in_parallel(in_parallel_for()) {
+        parallel_for_busy_threads() += m_threads;
+        in_parallel_for() = true;
+    }
+    ~ParallelForScope() {
+        in_parallel_for() = m_was_in_parallel;
+        parallel_for_busy_threads() -= m_threads;
+    }
+    ParallelForScope(const ParallelForScope&) = delete;
+    ParallelForScope& operator=(const ParallelForScope&) = delete;
+
+private:
+    size_t m_threads;
+    bool m_was_in_parallel;
+};
+}  // namespace details
+
+/// \brief Calls func(begin, end) for the chunks of the range [0, count) on the hardware threads.
+///
+/// The chunks are taken by the threads dynamically, so the items don't have to take the same time. The calls are
+/// sequential if the range is too small for the threads, inside another parallel_for or if the hardware threads are
+/// busy with the other parallel_for calls, so func must not rely on running concurrently. The first exception thrown
+/// by func is rethrown after all the threads are finished, the chunks not started by then are skipped.
+///
+/// \param count The number of the items.
+/// \param work_per_item The approximate work of one item in the elementary operations.
+/// \param func The functor processing the items [begin, end), it's called concurrently for the different chunks.
+template <typename Functor>
+void parallel_for(size_t count, size_t work_per_item, const Functor& func) {
+    if (count == 0) {
+        return;
+    }
+    const size_t max_work = std::numeric_limits<size_t>::max();
+    const size_t work = work_per_item != 0 && count > max_work / work_per_item ? max_work : count * work_per_item;
+    const size_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t busy_threads = details::parallel_for_busy_threads();
+    const size_t free_threads = hardware_threads > busy_threads ? hardware_threads - busy_threads : 1;
+    const size_t num_threads = std::min({free_threads, count, std::max<size_t>(work / parallel_for_min_work, 1)});
+    if (num_threads <= 1 || details::in_parallel_for()) {
+        func(size_t{0}, count);
+        return;
+    }
+
+    // a few chunks per thread balance the uneven items without taking the next chunk too often
+    const size_t chunk_size = (count + 4 * num_threads - 1) / (4 * num_threads);
+    const size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+    std::atomic<size_t> next_chunk{0};
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    auto run_chunks = [&]() {
+        details::in_parallel_for() = true;
+        for (size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++) {
+            try {
+                const size_t begin = chunk * chunk_size;
+                func(begin, std::min(begin + chunk_size, count));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{exception_mutex};
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+                next_chunk = num_chunks;
+            }
+        }
+    };
+
+    {
+        details::ParallelForScope scope{num_threads};
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads - 1);
+        try {
+            for (size_t i = 1; i < num_threads; ++i) {
+                threads.emplace_back(run_chunks);
+            }
+        } catch (const std::system_error&) {
+            // the chunks are run by the threads started so far
+        }
+        run_chunks();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
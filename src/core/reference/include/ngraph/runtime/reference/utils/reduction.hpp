@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Calls func(in_idx, out_idx) for every element of the input, out_idx is the index of the element reduced
+/// over the reduction axes in the output without the reduced dimensions.
+///
+/// The elements reduced into each output element are visited in the row-major order as by iterating over the input,
+/// so the results don't depend on the threads. The slices along the leading not reduced axes are visited in parallel,
+/// they are reduced into the disjoint output elements, so func may update the output element without synchronization.
+template <typename Functor>
+void reduction_loop(const Shape& in_shape, const AxisSet& reduction_axes, const Functor& func) {
+    const size_t in_size = shape_size(in_shape);
+    if (in_size == 0) {
+        return;
+    }
+    const size_t rank = in_shape.size();
+
+    // the output stride of every input axis, zero for the reduced ones
+    std::vector<size_t> out_axis_strides(rank, 0);
+    size_t out_stride = 1;
+    for (size_t axis = rank; axis-- > 0;) {
+        if (reduction_axes.count(axis) == 0) {
+            out_axis_strides[axis] = out_stride;
+            out_stride *= in_shape[axis];
+        }
+    }
+
+    size_t outer_rank = 0;
+    size_t outer_size = 1;
+    while (outer_rank < rank && reduction_axes.count(outer_rank) == 0) {
+        outer_size *= in_shape[outer_rank++];
+    }
+    const size_t inner_size = in_size / outer_size;
+    const size_t out_inner_size = outer_rank == 0 ? out_stride : out_axis_strides[outer_rank - 1];
+
+    parallel_for(outer_size, inner_size, [&](size_t begin, size_t end) {
+        std::vector<size_t> coord(rank - outer_rank, 0);
+        for (size_t outer = begin; outer < end; ++outer) {
+            const size_t in_offset = outer * inner_size;
+            const size_t out_offset = outer * out_inner_size;
+            size_t out_inner_offset = 0;
+            for (size_t i = 0; i < inner_size; ++i) {
+                func(in_offset + i, out_offset + out_inner_offset);
+                // increments the coordinate of the inner axes
+                for (size_t axis = rank; axis-- > outer_rank;) {
+                    auto& c = coord[axis - outer_rank];
+                    out_inner_offset += out_axis_strides[axis];
+                    if (++c < in_shape[axis]) {
+                        break;
+                    }
+                    out_inner_offset -= c * out_axis_strides[axis];
+                    c = 0;
+                }
+            }
+        }
+    });
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
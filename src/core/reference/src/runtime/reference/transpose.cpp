@@ -4,17 +4,79 @@
 
 #include "ngraph/runtime/reference/transpose.hpp"
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <numeric>
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+// Copies the rows [begin, end) of the output, the innermost output axis, from the input with the strides of the
+// output axes in the input
+template <typename T>
+void transpose_rows(const T* data,
+                    T* out,
+                    const Shape& out_shape,
+                    const std::vector<size_t>& in_strides,
+                    size_t begin,
+                    size_t end) {
+    const size_t rank = out_shape.size();
+    const size_t row_size = out_shape[rank - 1];
+    const size_t row_stride = in_strides[rank - 1];
+
+    // the coordinate of the first row in the outer output axes
+    std::vector<size_t> coord(rank - 1, 0);
+    size_t in_offset = 0;
+    for (size_t axis = rank - 1, row = begin; axis-- > 0;) {
+        coord[axis] = row % out_shape[axis];
+        row /= out_shape[axis];
+        in_offset += coord[axis] * in_strides[axis];
+    }
+
+    out += begin * row_size;
+    for (size_t row = begin; row < end; ++row) {
+        const T* in_row = data + in_offset;
+        for (size_t i = 0; i < row_size; ++i) {
+            out[i] = in_row[i * row_stride];
+        }
+        out += row_size;
+
+        for (size_t axis = rank - 1; axis-- > 0;) {
+            in_offset += in_strides[axis];
+            if (++coord[axis] < out_shape[axis]) {
+                break;
+            }
+            in_offset -= coord[axis] * in_strides[axis];
+            coord[axis] = 0;
+        }
+    }
+}
+
+template <typename T>
+void transpose_parallel(const char* data, char* out, const Shape& data_shape, const AxisVector& axes_order) {
+    const size_t rank = data_shape.size();
+    const auto data_strides = row_major_strides(data_shape);
+    Shape out_shape(rank);
+    std::vector<size_t> in_strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        out_shape[i] = data_shape[axes_order[i]];
+        in_strides[i] = data_strides[axes_order[i]];
+    }
+    const size_t row_size = out_shape.back();
+    parallel_for(shape_size(out_shape) / row_size, row_size, [&](size_t begin, size_t end) {
+        transpose_rows(reinterpret_cast<const T*>(data), reinterpret_cast<T*>(out), out_shape, in_strides, begin, end);
+    });
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
@@ -24,7 +86,30 @@ void transpose(const char* data,
     // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
     // Negative axes are not supported, it is validated by transpose evaluate method
     std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
-    runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+    if (data_shape.empty() || shape_size(data_shape) == 0 ||
+        std::is_sorted(axis_vector.begin(), axis_vector.end())) {
+        runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+        return;
+    }
+
+    // the rows of the output are copied in parallel, by the elements of the sizes handled as the integers
+    switch (element_size) {
+    case 1:
+        transpose_parallel<uint8_t>(data, out, data_shape, axis_vector);
+        break;
+    case 2:
+        transpose_parallel<uint16_t>(data, out, data_shape, axis_vector);
+        break;
+    case 4:
+        transpose_parallel<uint32_t>(data, out, data_shape, axis_vector);
+        break;
+    case 8:
+        transpose_parallel<uint64_t>(data, out, data_shape, axis_vector);
+        break;
+    default:
+        runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+        break;
+    }
 }
 }  // namespace reference
 }  // namespace runtime
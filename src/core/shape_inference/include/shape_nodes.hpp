@@ -154,7 +154,7 @@ void shape_infer(const ov::opset1::Unsqueeze* op,
     std::set<int64_t> unique_sorted_axes(axes.begin(), axes.end());
     for (const auto& axis : unique_sorted_axes) {
         NODE_VALIDATION_CHECK(op, axis <= expanded_rank, "provided 'axes' value ", axis, " is not valid.");
-        output_shape.insert(next(begin(output_shape), axis), 1);
+        output_shape.insert(std::next(std::begin(output_shape), axis), 1);
     }
 }
 
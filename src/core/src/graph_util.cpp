@@ -213,53 +213,61 @@ bool ngraph::is_post_dominated(Node* X, Node* Y) {
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes,
-                                                               NodeMap& node_map) {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
+namespace {
+// Clones nodes which are already in topological order, so the callers owning a sorted
+// list (e.g. ov::Model caches it) don't pay for one more sort of the whole graph
+void clone_sorted_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& sorted_nodes, ngraph::NodeMap& node_map) {
+    node_map.reserve(node_map.size() + sorted_nodes.size());
+    ngraph::OutputVector cloned_args;
+    std::vector<std::shared_ptr<ngraph::Node>> cloned_dependencies;
     for (const auto& node : sorted_nodes) {
-        if (node_map.count(node.get()) == 0) {
-            // get (already) cloned arguments and clone the node
-            OutputVector cloned_args;
-            for (auto input : node->inputs()) {
-                Output<Node> output = input.get_source_output();
-                cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
-            }
-            std::vector<std::shared_ptr<Node>> cloned_dependencies;
-            for (auto& dependency : node->get_control_dependencies()) {
-                shared_ptr<Node>& dependent = node_map.at(dependency.get());
-                if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
-                    cloned_dependencies.end()) {
-                    cloned_dependencies.push_back(dependent);
-                }
-            }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
-            // There is a friendly name for this node so copy it
-            cloned_node->set_friendly_name(node->get_friendly_name());
-            auto rt_info = node->get_rt_info();
-            cloned_node->get_rt_info() = rt_info;
-
-            for (auto output : node->outputs()) {
-                const auto& output_rt_info = output.get_rt_info();
-                auto new_output = output.for_node(cloned_node);
-                new_output.get_rt_info() = output_rt_info;
+        if (node_map.count(node.get()) != 0) {
+            continue;
+        }
+        // get (already) cloned arguments and clone the node
+        cloned_args.clear();
+        cloned_args.reserve(node->get_input_size());
+        for (auto input : node->inputs()) {
+            ngraph::Output<ngraph::Node> output = input.get_source_output();
+            cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
+        }
+        cloned_dependencies.clear();
+        for (auto& dependency : node->get_control_dependencies()) {
+            std::shared_ptr<ngraph::Node>& dependent = node_map.at(dependency.get());
+            if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) == cloned_dependencies.end()) {
+                cloned_dependencies.push_back(dependent);
             }
+        }
+        auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+        // There is a friendly name for this node so copy it
+        cloned_node->set_friendly_name(node->get_friendly_name());
+        // RTMap holds ov::Any values which share the underlying attributes, so the copy is shallow
+        cloned_node->get_rt_info() = node->get_rt_info();
+
+        for (auto output : node->outputs()) {
+            output.for_node(cloned_node).get_rt_info() = output.get_rt_info();
+        }
 
-            for (auto input : node->inputs()) {
-                const auto& output_rt_info = input.get_rt_info();
-                auto new_input = cloned_node->input(input.get_index());
-                new_input.get_rt_info() = output_rt_info;
-            }
+        for (auto input : node->inputs()) {
+            cloned_node->input(input.get_index()).get_rt_info() = input.get_rt_info();
+        }
 
-            cloned_node->set_op_annotations(node->get_op_annotations());
+        cloned_node->set_op_annotations(node->get_op_annotations());
 
-            node_map[node.get()] = cloned_node;
-        }
+        node_map[node.get()] = std::move(cloned_node);
     }
+}
+}  // namespace
+
+std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes,
+                                                               NodeMap& node_map) {
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes), node_map);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
     std::vector<std::shared_ptr<ngraph::Node>> cloned_nodes;
+    cloned_nodes.reserve(nodes.size());
     for (const auto& node : nodes) {
         cloned_nodes.push_back(node_map.at(node.get()));
     }
@@ -317,13 +325,14 @@ std::shared_ptr<ov::Model> ov::clone_model(const ov::Model& func) {
 }
 
 std::shared_ptr<ov::Model> ov::clone_model(const ov::Model& func, ngraph::NodeMap& node_map) {
-    // clone model operations
-    ngraph::clone_nodes(func.get_ops(), node_map);
+    // clone model operations, the cached topological order of the model is reused
+    clone_sorted_nodes(func.get_ordered_ops(), node_map);
 
     // clone variables
     auto variables = func.get_variables();
     ngraph::VariableVector cloned_vars;
     std::map<std::string, std::shared_ptr<ngraph::Variable>> var_map;
+    cloned_vars.reserve(variables.size());
     for (const auto& var : variables) {
         auto cloned_var = std::make_shared<ngraph::Variable>(var->get_info());
         cloned_vars.push_back(cloned_var);
@@ -331,10 +340,8 @@ std::shared_ptr<ov::Model> ov::clone_model(const ov::Model& func, ngraph::NodeMa
     }
     if (!variables.empty()) {
         for (const auto& op : node_map) {
-            if (auto read_val = std::dynamic_pointer_cast<ngraph::VariableExtension>(op.second)) {
-                read_val->set_variable(var_map.at(read_val->get_variable_id()));
-            } else if (auto assign = std::dynamic_pointer_cast<ngraph::VariableExtension>(op.second)) {
-                assign->set_variable(var_map.at(assign->get_variable_id()));
+            if (auto var_op = std::dynamic_pointer_cast<ngraph::VariableExtension>(op.second)) {
+                var_op->set_variable(var_map.at(var_op->get_variable_id()));
             }
         }
     }
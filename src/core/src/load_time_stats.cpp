@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_time_stats.hpp"
+
+#include <mutex>
+
+namespace {
+struct Stats {
+    std::mutex mutex;
+    std::map<std::string, std::chrono::nanoseconds> phases;
+};
+
+// the phases are measured by all the libraries of the process, the plugins and the frontends too
+Stats& stats() {
+    static Stats instance;
+    return instance;
+}
+}  // namespace
+
+void ov::load_time_stats::add(const std::string& phase, std::chrono::nanoseconds duration) {
+    auto& s = stats();
+    std::lock_guard<std::mutex> lock{s.mutex};
+    s.phases[phase] += duration;
+}
+
+std::map<std::string, double> ov::load_time_stats::get() {
+    auto& s = stats();
+    std::lock_guard<std::mutex> lock{s.mutex};
+    std::map<std::string, double> milliseconds;
+    for (const auto& phase : s.phases) {
+        milliseconds.emplace(phase.first, std::chrono::duration<double, std::milli>(phase.second).count());
+    }
+    return milliseconds;
+}
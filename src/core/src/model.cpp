@@ -33,6 +33,7 @@ using namespace std;
 BWDCMP_RTTI_DEFINITION(ov::AttributeAdapter<std::shared_ptr<ov::Model>>);
 
 atomic<size_t> ov::Model::m_next_instance_id(0);
+atomic<size_t> ov::SharedRTInfo::m_next_version(0);
 
 namespace {
 
@@ -265,6 +266,21 @@ void ov::Model::validate_nodes_and_infer_types() const {
     }
 }
 
+size_t ov::Model::get_graph_version() const {
+    // the nodes share the info of the model since they are sorted, so their later changes update its version
+    const auto ordered_ops = get_ordered_ops();
+    size_t version = m_shared_rt_info->get_version();
+    for (const auto& op : ordered_ops) {
+        if (const auto multi_subgraph_op = ov::as_type<ov::op::util::MultiSubGraphOp>(op.get())) {
+            for (size_t i = 0; i < multi_subgraph_op->get_internal_subgraphs_size(); ++i) {
+                const auto& body = multi_subgraph_op->get_function(static_cast<int>(i));
+                version = ngraph::hash_combine({version, body ? body->get_graph_version() : 0});
+            }
+        }
+    }
+    return version;
+}
+
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops");
     lock_guard<mutex> lock(m_topological_sort_mutex);
@@ -243,8 +243,15 @@ void ov::Node::set_input_is_relevant_to_value(size_t i, bool relevant) {
 }
 
 void ov::Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape) {
+    const auto& tensor = get_output_descriptor(i).get_tensor_ptr();
+    if (tensor->get_element_type() != element_type || tensor->get_partial_shape() != pshape) {
+        // the consumers may be matched differently, so the graph version is updated
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
+            info->update_version();
+        });
+    }
     OPENVINO_SUPPRESS_DEPRECATED_START
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    tensor->set_tensor_type(element_type, pshape);
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
@@ -805,8 +812,11 @@ bool ov::Node::constant_fold(OutputVector& output_values, const OutputVector& in
 
     HostTensorVector input_tensors;
     for (const auto& input : input_values) {
-        auto host_tensor = make_shared<ngraph::runtime::HostTensor>(
-            ov::as_type_ptr<ngraph::op::v0::Constant>(input.get_node_shared_ptr()));
+        // the inputs are only read, so they refer to the data of the Constants instead of copying it
+        const auto constant = ov::as_type<ngraph::op::v0::Constant>(input.get_node());
+        auto host_tensor = make_shared<ngraph::runtime::HostTensor>(constant->get_element_type(),
+                                                                    constant->get_shape(),
+                                                                    const_cast<void*>(constant->get_data_ptr()));
         input_tensors.push_back(host_tensor);
     }
     HostTensorVector output_tensors;
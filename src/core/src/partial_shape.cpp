@@ -13,7 +13,7 @@
 
 ov::PartialShape::PartialShape() : PartialShape(std::initializer_list<Dimension>{}) {}
 
-ov::PartialShape::PartialShape(std::initializer_list<Dimension> init) : PartialShape(true, init) {}
+ov::PartialShape::PartialShape(std::initializer_list<Dimension> init) : PartialShape(true, Dimensions(init)) {}
 
 ov::PartialShape::PartialShape(const std::vector<Dimension::value_type>& dimensions)
     : m_rank_is_static(true),
@@ -24,13 +24,13 @@ ov::PartialShape::PartialShape(const Shape& shape)
       m_shape_type(ShapeType::SHAPE_IS_STATIC),
       m_dimensions(shape.begin(), shape.end()) {}
 
-ov::PartialShape::PartialShape(bool rank_is_static, std::vector<Dimension> dimensions)
+ov::PartialShape::PartialShape(bool rank_is_static, Dimensions dimensions)
     : m_rank_is_static(rank_is_static),
       m_dimensions(std::move(dimensions)) {}
 
 ov::PartialShape::PartialShape(std::vector<Dimension> dimensions)
     : m_rank_is_static(true),
-      m_dimensions(std::move(dimensions)) {}
+      m_dimensions(std::make_move_iterator(dimensions.begin()), std::make_move_iterator(dimensions.end())) {}
 
 bool ov::PartialShape::is_static() const {
     ShapeType shape_type = m_shape_type;
@@ -75,7 +75,7 @@ ov::Shape ov::PartialShape::get_max_shape() const {
         return Shape();
     } else {
         Shape shape;
-        for (auto dimension : m_dimensions) {
+        for (const auto& dimension : m_dimensions) {
             shape.push_back(dimension.get_interval().get_max_val());
         }
         return shape;
@@ -87,7 +87,7 @@ ov::Shape ov::PartialShape::get_min_shape() const {
         return Shape();
     } else {
         Shape shape;
-        for (auto dimension : m_dimensions) {
+        for (const auto& dimension : m_dimensions) {
             shape.push_back(dimension.get_interval().get_min_val());
         }
         return shape;
@@ -97,7 +97,7 @@ ov::Shape ov::PartialShape::get_min_shape() const {
 ov::Shape ov::PartialShape::get_shape() const {
     NGRAPH_CHECK(rank().is_static(), "get_shape() must be called on a static shape");
     Shape shape;
-    for (auto dimension : m_dimensions) {
+    for (const auto& dimension : m_dimensions) {
         auto min_val = dimension.get_interval().get_min_val();
         auto max_val = dimension.get_interval().get_max_val();
         NGRAPH_CHECK(min_val == max_val, "get_shape() must be called on a static shape");
@@ -144,7 +144,7 @@ std::ostream& ov::operator<<(std::ostream& str, const PartialShape& shape) {
 
 ov::PartialShape ov::PartialShape::dynamic(Rank r) {
     return PartialShape(r.is_static(),
-                        std::vector<Dimension>(r.is_static() ? r.get_length() : 0, Dimension::dynamic()));
+                        Dimensions(r.is_static() ? r.get_length() : 0, Dimension::dynamic()));
 }
 
 bool ov::PartialShape::compatible(const PartialShape& s) const {
@@ -227,7 +227,7 @@ bool ov::PartialShape::merge_rank(Rank r) {
         return true;
     } else if (!m_rank_is_static) {
         m_rank_is_static = true;
-        m_dimensions = std::vector<Dimension>(r.get_length(), Dimension::dynamic());
+        m_dimensions.assign(r.get_length(), Dimension::dynamic());
         m_shape_type = ShapeType::SHAPE_IS_UNKNOWN;
         return true;
     } else {
@@ -283,14 +283,14 @@ bool ov::PartialShape::broadcast_merge_into(PartialShape& dst,
             auto dst_rank = dst.rank().get_length();
             auto src_rank = src.rank().get_length();
             auto new_rank = std::max(dst_rank, src_rank);
-            std::vector<Dimension> dims(new_rank);
+            Dimensions dims(new_rank);
             bool success = true;
             for (int64_t i = 0; i < new_rank; i++) {
                 auto dsti = i < (new_rank - dst_rank) ? Dimension(1) : dst[i - (new_rank - dst_rank)];
                 auto srci = i < (new_rank - src_rank) ? Dimension(1) : src[i - (new_rank - src_rank)];
                 success &= Dimension::broadcast_merge(dims[i], dsti, srci);
             }
-            dst = PartialShape(std::move(dims));
+            dst = PartialShape(true, std::move(dims));
             return success;
         }
     }
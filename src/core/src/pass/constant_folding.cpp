@@ -4,18 +4,95 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <cstring>
 #include <ngraph/op/constant.hpp>
+#include <unordered_set>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph/opsets/opset3.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/validation_util.hpp"
+#include "openvino/op/convert_like.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 
 using namespace std;
 
+namespace {
+// the waves with less data than this are folded sequentially, the threads would cost more than they save
+constexpr size_t parallel_folding_min_bytes = 1 << 20;
+
+bool inputs_are_constants(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::is_type<ngraph::op::Constant>(node) ||
+        ov::is_type<ngraph::op::util::MultiSubGraphOp>(node) || ov::pass::constant_folding_is_disabled(node))
+        return false;
+    for (const auto& input : node->input_values()) {
+        if (!ov::is_type<ngraph::op::Constant>(input.get_node()))
+            return false;
+    }
+    return true;
+}
+
+// The operations of the standard opsets only read their input Constants while they are folded, except ConvertLike
+// connecting a temporary Convert to its input, so several of them can be folded at once. The other operations
+// may override constant_fold with anything
+bool can_be_folded_concurrently(const std::shared_ptr<ov::Node>& node) {
+    const auto& version_id = node->get_type_info().version_id;
+    return version_id && std::strncmp(version_id, "opset", 5) == 0 && !ov::is_type<ov::op::v1::ConvertLike>(node);
+}
+
+OPENVINO_SUPPRESS_DEPRECATED_START
+// The host tensor over the data of a Constant, it keeps the Constant alive
+class ConstantHostTensor : public ngraph::runtime::HostTensor {
+public:
+    explicit ConstantHostTensor(const std::shared_ptr<ngraph::op::Constant>& constant)
+        : ngraph::runtime::HostTensor(constant->get_element_type(),
+                                      constant->get_shape(),
+                                      const_cast<void*>(constant->get_data_ptr())),
+          m_constant(constant) {}
+
+private:
+    std::shared_ptr<ngraph::op::Constant> m_constant;
+};
+
+// Evaluates the elementwise operation into the buffer of its first input, the buffer must not be shared with anyone
+bool fold_in_place(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements) {
+    ngraph::HostTensorVector inputs;
+    for (const auto& input : node->input_values())
+        inputs.push_back(std::make_shared<ConstantHostTensor>(
+            ov::as_type_ptr<ngraph::op::Constant>(input.get_node_shared_ptr())));
+    ngraph::HostTensorVector outputs{inputs[0]};
+    if (!node->evaluate(outputs, inputs))
+        return false;
+    replacements[0] = std::make_shared<ngraph::op::Constant>(outputs[0]);
+    return true;
+}
+OPENVINO_SUPPRESS_DEPRECATED_END
+
+// The elementwise operations are folded by Node::constant_fold into new buffers, unlike e.g. Reshape sharing the
+// buffer of its input, so nobody else refers to the buffers of their folded values
+bool folds_into_new_buffer(const std::shared_ptr<ov::Node>& node) {
+    return can_be_folded_concurrently(node) && node->get_output_size() == 1 &&
+           (ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) ||
+            ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node));
+}
+
+bool can_be_folded_in_place(const std::shared_ptr<ov::Node>& node,
+                            const std::unordered_set<const ov::Node*>& owned_constants) {
+    if (!folds_into_new_buffer(node))
+        return false;
+    const auto data = node->input_value(0);
+    return owned_constants.count(data.get_node()) && data.get_target_inputs().size() == 1 &&
+           node->get_output_element_type(0) == data.get_element_type() &&
+           node->get_output_partial_shape(0) == data.get_partial_shape();
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
+    rewritten = constant_subgraphs_folding(f, rewritten) || rewritten;
 
     for (const auto& node : f->get_ordered_ops()) {
         if (rewritten) {
@@ -28,27 +105,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
         // method, so we can't always rely on attribute check inside default node->constant_fold method
         if (node->get_rt_info().count(DisableConstantFolding::get_type_info_static()) == 0 &&
             node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            rewritten = replace_with_folded(node, replacements) || rewritten;
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
@@ -63,6 +120,120 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                   const OutputVector& replacements) {
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            if (replacements.size() == 1) {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            } else {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                     std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::constant_subgraphs_folding(const std::shared_ptr<ov::Model>& f, bool revalidate) {
+    std::vector<std::shared_ptr<Node>> wave;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (revalidate) {
+            node->validate_and_infer_types();
+        }
+        if (inputs_are_constants(node)) {
+            wave.push_back(node);
+        }
+    }
+
+    // the Constants with the folded values in new buffers, only this pass refers to them
+    std::unordered_set<const Node*> owned_constants;
+    bool rewritten = false;
+    while (!wave.empty()) {
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), false);
+        std::vector<char> in_place(wave.size(), false);
+        std::vector<size_t> concurrent;
+        std::vector<size_t> sequential;
+        size_t concurrent_bytes = 0;
+        for (size_t i = 0; i < wave.size(); ++i) {
+            replacements[i].resize(wave[i]->get_output_size());
+            in_place[i] = m_in_place && can_be_folded_in_place(wave[i], owned_constants);
+            if (can_be_folded_concurrently(wave[i])) {
+                concurrent.push_back(i);
+                for (const auto& input : wave[i]->input_values())
+                    concurrent_bytes += ov::as_type<ngraph::op::Constant>(input.get_node())->get_byte_size();
+            } else {
+                sequential.push_back(i);
+            }
+        }
+        auto fold = [&](size_t i) {
+            const auto& node = wave[i];
+            folded[i] = in_place[i] ? fold_in_place(node, replacements[i])
+                                    : node->constant_fold(replacements[i], node->input_values());
+        };
+
+        if (concurrent_bytes < parallel_folding_min_bytes) {
+            sequential.insert(sequential.end(), concurrent.begin(), concurrent.end());
+            concurrent.clear();
+        }
+        // the kernels of the nodes folded concurrently run on the calling thread, the other ones run on the threads
+        namespace reference = ngraph::runtime::reference;
+        reference::parallel_for(concurrent.size(), reference::parallel_for_min_work, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                fold(concurrent[i]);
+            }
+        });
+        for (const auto i : sequential) {
+            fold(i);
+        }
+
+        // the graph is changed in the topological order of the wave, so the names and the runtime info are the same
+        // as the sequential folding gives
+        std::vector<std::shared_ptr<Node>> next_wave;
+        std::unordered_set<const Node*> next_wave_nodes;
+        for (size_t i = 0; i < wave.size(); ++i) {
+            if (!folded[i] || !replace_with_folded(wave[i], replacements[i])) {
+                continue;
+            }
+            rewritten = true;
+            for (const auto& replacement : replacements[i]) {
+                if (!replacement.get_node_shared_ptr()) {
+                    continue;
+                }
+                if (folds_into_new_buffer(wave[i])) {
+                    owned_constants.insert(replacement.get_node());
+                }
+                for (const auto& target_input : replacement.get_target_inputs()) {
+                    auto consumer = target_input.get_node()->shared_from_this();
+                    if (!next_wave_nodes.count(consumer.get()) && inputs_are_constants(consumer)) {
+                        next_wave_nodes.insert(consumer.get());
+                        next_wave.push_back(consumer);
+                    }
+                }
+            }
+        }
+        // a consumer can be before another one in the topological order only if it doesn't depend on it
+        for (const auto& node : next_wave) {
+            node->validate_and_infer_types();
+        }
+        wave = std::move(next_wave);
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                        const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
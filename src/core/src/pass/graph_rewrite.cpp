@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
 #include <unordered_set>
@@ -57,6 +58,33 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+// Collects the types the root node of a pattern can have, returns false if it can be of any type
+bool collect_root_types(std::shared_ptr<Node> root, std::vector<NodeTypeInfo>& root_types) {
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to get actual root node we need to take it's parent.
+    if (auto any_output = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
+        root = any_output->input_value(0).get_node_shared_ptr();
+    }
+
+    // if root is an operation from opset or has pattern::op::WrapType type then we can extract it's type, the root
+    // of pattern::op::Or is the root of any of its patterns
+    if (auto wrap_type = std::dynamic_pointer_cast<pattern::op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    } else if (std::dynamic_pointer_cast<pattern::op::Or>(root)) {
+        for (const auto& pattern : root->input_values()) {
+            if (!collect_root_types(pattern.get_node_shared_ptr(), root_types))
+                return false;
+        }
+        return true;
+    } else if (std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        return false;
+    }
+    root_types.push_back(root->get_type_info());
+    return true;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -86,48 +114,46 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index the matchers by the types of their root nodes, so only the matchers which can match a node are run on
+    // it. The matchers whose root can be of any type are run on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> any_type_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
+        std::vector<NodeTypeInfo> root_types;
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+        if (matcher && collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            for (const auto& root_type_info : root_types) {
+                type_to_matcher[root_type_info].push_back(matcher_index);
             }
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            any_type_matchers.push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // The matchers to run for each node type in the order of the registration, including the matchers registered for
+    // the parents of the type
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> type_to_matchers_to_run;
+    auto get_matchers_to_run = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto matchers_to_run = type_to_matchers_to_run.find(&type_info);
+        if (matchers_to_run != type_to_matchers_to_run.end())
+            return matchers_to_run->second;
+
+        std::vector<size_t> matcher_indices = any_type_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_indices.insert(matcher_indices.end(), matchers->second.begin(), matchers->second.end());
+            }
+        }
+        std::sort(matcher_indices.begin(), matcher_indices.end());
+        matcher_indices.erase(std::unique(matcher_indices.begin(), matcher_indices.end()), matcher_indices.end());
+        return type_to_matchers_to_run.emplace(&type_info, std::move(matcher_indices)).first->second;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -160,9 +186,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -183,47 +206,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers_to_run(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
@@ -5,6 +5,7 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <unordered_map>
 
 #include "itt.hpp"
+#include "load_time_stats.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -32,6 +34,35 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+// the passes whose result depends only on the graph and the pass config
+bool is_change_tracked(const std::shared_ptr<ov::pass::PassBase>& pass) {
+    return std::dynamic_pointer_cast<ov::pass::MatcherPass>(pass) ||
+           std::dynamic_pointer_cast<ov::pass::GraphRewrite>(pass);
+}
+
+// Measures the run of the outermost pass::Manager on the thread, the nested managers run inside its passes
+class OutermostRunScope {
+public:
+    OutermostRunScope() : m_start(std::chrono::steady_clock::now()) {
+        ++depth();
+    }
+    ~OutermostRunScope() {
+        if (--depth() == 0) {
+            ov::load_time_stats::add("transformations", std::chrono::steady_clock::now() - m_start);
+        }
+    }
+    OutermostRunScope(const OutermostRunScope&) = delete;
+    OutermostRunScope& operator=(const OutermostRunScope&) = delete;
+
+private:
+    static size_t& depth() {
+        static thread_local size_t run_depth = 0;
+        return run_depth;
+    }
+
+    std::chrono::steady_clock::time_point m_start;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -52,6 +83,7 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
 void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Manager::run_passes");
+    OutermostRunScope run_scope;
 
     static bool profile_enabled =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
@@ -61,12 +93,28 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     ngraph::stopwatch overall_timer;
     overall_timer.start();
     bool function_changed = false;
+    // the total time and the number of runs of each pass, to find the hot spots of the pipeline
+    std::unordered_map<std::string, std::pair<size_t, size_t>> pass_times;
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
             continue;
         }
 
+        const bool change_tracked = m_change_tracking && is_change_tracked(pass);
+        if (change_tracked) {
+            auto unchanged = m_unchanged_models.find(pass.get());
+            if (unchanged != m_unchanged_models.end() && unchanged->second.model.lock() == func &&
+                unchanged->second.graph_version == func->get_graph_version()) {
+                NGRAPH_DEBUG << "Pass " << pass->get_name() << " didn't change the model at this version";
+                if (profile_enabled) {
+                    cout << "skipped " << pass->get_name() << "\n";
+                }
+                function_changed = false;
+                continue;
+            }
+        }
+
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::nGraphPass_LT, pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
@@ -123,14 +171,38 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 vt.run_on_model(func);
             }
         }
+        if (change_tracked) {
+            if (function_changed) {
+                m_unchanged_models.erase(pass.get());
+            } else {
+                m_unchanged_models[pass.get()] = {func, func->get_graph_version()};
+            }
+        }
+
         index++;
         pass_timer.stop();
+        ov::load_time_stats::add("transformations/" + pass->get_name(), pass_timer.get_timer_value());
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            auto& pass_time = pass_times[pass->get_name()];
+            pass_time.first += pass_timer.get_microseconds();
+            ++pass_time.second;
         }
     }
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        std::vector<std::pair<std::string, std::pair<size_t, size_t>>> hot_spots(pass_times.begin(),
+                                                                                  pass_times.end());
+        std::sort(hot_spots.begin(), hot_spots.end(), [](const decltype(hot_spots)::value_type& a,
+                                                         const decltype(hot_spots)::value_type& b) {
+            return a.second.first > b.second.first;
+        });
+        constexpr size_t max_hot_spots = 10;
+        cout << "the slowest passes:\n";
+        for (size_t i = 0; i < std::min(hot_spots.size(), max_hot_spots); ++i) {
+            cout << setw(7) << hot_spots[i].second.first / 1000 << "ms " << hot_spots[i].first << " ("
+                 << hot_spots[i].second.second << " runs)\n";
+        }
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "compact_ir.hpp"
 #include "itt.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -62,17 +63,34 @@ std::string translate_type_name(const std::string& name) {
 
 size_t hash_combine(const void* v, int64_t size) {
     constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
+    // Several independent lanes are mixed at once (so the loop is not one long dependency chain
+    // and may be vectorized), then folded into the seed. It matters for the multi-gigabyte weights.
+    constexpr size_t lanes_count = 4;
+    const auto data = static_cast<const char*>(v);
+    const auto cells_count = static_cast<size_t>(size) / cel_size;
+    const auto blocks_count = cells_count / lanes_count;
     // The constant value used as a magic number has been
     // traditionally used e.g. in boost library's hash_combine.
     // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    size_t lanes[lanes_count] = {0x9e3779b9, 0x7f4a7c15, 0x85ebca6b, 0xc2b2ae35};
+    for (size_t block = 0; block < blocks_count; ++block) {
+        size_t cells[lanes_count];
+        std::memcpy(cells, data + block * sizeof(cells), sizeof(cells));
+        for (size_t lane = 0; lane < lanes_count; ++lane) {
+            lanes[lane] ^= cells[lane] + 0x9e3779b9 + (lanes[lane] << 6) + (lanes[lane] >> 2);
+        }
+    }
+    auto seed = static_cast<size_t>(size);
+    for (const auto lane : lanes) {
+        seed ^= lane + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    for (size_t cell = blocks_count * lanes_count; cell < cells_count; ++cell) {
+        size_t value;
+        std::memcpy(&value, data + cell * cel_size, cel_size);
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     }
     size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
+    std::memcpy(&last_bytes, data + cells_count * cel_size, size % cel_size);
     seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     return seed;
 }
@@ -81,7 +99,13 @@ class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    struct ConstWritePosition {
+        FilePosition offset;
+        void const* ptr;
+        size_t size;
+    };
+    // several different blobs may have the same hash, all of them are kept to be deduplicated
+    using ConstWritePositions = std::unordered_multimap<HashValue, ConstWritePosition>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
@@ -100,14 +124,18 @@ public:
         // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
         // values when finding a match in hash map.
         const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        const auto found = m_hash_to_file_positions.equal_range(hash);
+        for (auto it = found.first; it != found.second; ++it) {
+            const auto& position = it->second;
+            // constants sharing the same buffer (e.g. after cloning) don't need to be compared
+            if (position.size == size &&
+                (position.ptr == ptr || memcmp(static_cast<void const*>(ptr), position.ptr, size) == 0)) {
+                return position.offset;
+            }
         }
 
         m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
+        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr), size}});
 
         return offset;
     }
@@ -974,12 +1002,102 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
     return bestPath;
 }
 
+class CompactIRWriter {
+public:
+    void write(const pugi::xml_document& xml_doc, std::ostream& stream, int64_t version) {
+        add_node(xml_doc.document_element());
+        NGRAPH_CHECK(m_nodes.size() < compact_ir::none && m_attributes.size() < compact_ir::none &&
+                         m_strings.size() < compact_ir::none,
+                     "The model is too large for the compact IR");
+
+        compact_ir::Header header = {};
+        std::memcpy(header.magic, compact_ir::magic, sizeof(header.magic));
+        header.format_version = compact_ir::format_version;
+        header.ir_version = static_cast<uint32_t>(version);
+        header.string_offsets_offset = sizeof(compact_ir::Header);
+        header.strings_count = m_strings.size();
+
+        std::vector<uint64_t> string_offsets;
+        string_offsets.reserve(m_strings.size());
+        uint64_t offset = header.string_offsets_offset + m_strings.size() * sizeof(uint64_t);
+        for (const auto& str : m_strings) {
+            string_offsets.push_back(offset);
+            offset += str->size() + 1;
+        }
+        // the records are aligned to be read in place
+        const auto strings_end = offset;
+        header.nodes_offset = align(strings_end);
+        header.nodes_count = m_nodes.size();
+        header.attributes_offset = header.nodes_offset + m_nodes.size() * sizeof(compact_ir::Node);
+        header.attributes_count = m_attributes.size();
+
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(string_offsets.data()), string_offsets.size() * sizeof(uint64_t));
+        for (const auto& str : m_strings)
+            stream.write(str->c_str(), str->size() + 1);
+        const char padding[alignment] = {};
+        stream.write(padding, header.nodes_offset - strings_end);
+        stream.write(reinterpret_cast<const char*>(m_nodes.data()), m_nodes.size() * sizeof(compact_ir::Node));
+        stream.write(reinterpret_cast<const char*>(m_attributes.data()),
+                     m_attributes.size() * sizeof(compact_ir::Attribute));
+    }
+
+private:
+    static constexpr size_t alignment = 8;
+
+    static uint64_t align(uint64_t offset) {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    uint32_t intern(const char* str) {
+        auto it = m_string_ids.emplace(str, static_cast<uint32_t>(m_strings.size())).first;
+        if (it->second == m_strings.size())
+            m_strings.push_back(&it->first);
+        return it->second;
+    }
+
+    uint32_t add_node(const pugi::xml_node& xml_node) {
+        const auto index = static_cast<uint32_t>(m_nodes.size());
+        compact_ir::Node node = {};
+        const bool is_text = xml_node.type() == pugi::node_pcdata || xml_node.type() == pugi::node_cdata;
+        node.type = is_text ? compact_ir::NodeType::TEXT : compact_ir::NodeType::ELEMENT;
+        node.name = intern(is_text ? xml_node.value() : xml_node.name());
+        node.first_child = compact_ir::none;
+        node.next_sibling = compact_ir::none;
+        node.first_attribute = static_cast<uint32_t>(m_attributes.size());
+        for (const auto& attribute : xml_node.attributes())
+            m_attributes.push_back({intern(attribute.name()), intern(attribute.value())});
+        node.attributes_count = static_cast<uint32_t>(m_attributes.size()) - node.first_attribute;
+        m_nodes.push_back(node);
+
+        auto last_child = compact_ir::none;
+        for (const auto& child : xml_node.children()) {
+            if (child.type() != pugi::node_element && child.type() != pugi::node_pcdata &&
+                child.type() != pugi::node_cdata)
+                continue;
+            const auto child_index = add_node(child);
+            if (last_child == compact_ir::none)
+                m_nodes[index].first_child = child_index;
+            else
+                m_nodes[last_child].next_sibling = child_index;
+            last_child = child_index;
+        }
+        return index;
+    }
+
+    std::unordered_map<std::string, uint32_t> m_string_ids;
+    std::vector<const std::string*> m_strings;
+    std::vector<compact_ir::Node> m_nodes;
+    std::vector<compact_ir::Attribute> m_attributes;
+};
+
 void serializeFunc(std::ostream& xml_file,
                    std::ostream& bin_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool compact = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1004,7 +1122,10 @@ void serializeFunc(std::ostream& xml_file,
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
-    xml_doc.save(xml_file);
+    if (compact)
+        CompactIRWriter().write(xml_doc, xml_file, version);
+    else
+        xml_doc.save(xml_file);
     xml_file.flush();
     bin_file.flush();
 };
@@ -1072,6 +1193,58 @@ pass::Serialize::Serialize(const std::string& xmlPath, const std::string& binPat
     : pass::Serialize::Serialize(xmlPath, binPath, std::map<std::string, ngraph::OpSet>{}, version) {}
 OPENVINO_SUPPRESS_DEPRECATED_END
 
+bool pass::CompactSerialize::run_on_model(const std::shared_ptr<ov::Model>& f_orig) {
+    auto f = ov::clone_model(*f_orig);
+    if (m_modelFile && m_binFile) {
+        serializeFunc(*m_modelFile, *m_binFile, f, m_version, {}, false, true);
+    } else {
+        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
+
+        std::ofstream model_file(m_modelPath, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(model_file, "Can't open model file: \"" + m_modelPath + "\"");
+
+        try {
+            serializeFunc(model_file, bin_file, f, m_version, {}, false, true);
+        } catch (const ngraph::CheckFailure&) {
+            model_file.close();
+            bin_file.close();
+            std::remove(m_modelPath.c_str());
+            std::remove(m_binPath.c_str());
+            throw;
+        }
+    }
+
+    // Return false because we didn't change nGraph Function
+    return false;
+}
+
+pass::CompactSerialize::CompactSerialize(std::ostream& modelFile,
+                                         std::ostream& binFile,
+                                         pass::Serialize::Version version)
+    : m_modelFile{&modelFile},
+      m_binFile{&binFile},
+      m_modelPath{},
+      m_binPath{},
+      m_version{version} {}
+
+pass::CompactSerialize::CompactSerialize(const std::string& modelPath,
+                                         const std::string& binPath,
+                                         pass::Serialize::Version version)
+    : m_modelFile{nullptr},
+      m_binFile{nullptr},
+      m_modelPath{modelPath},
+      m_binPath{binPath},
+      m_version{version} {
+    if (m_binPath.empty()) {
+        const auto pos = m_modelPath.rfind('.');
+        NGRAPH_CHECK(pos != std::string::npos,
+                     "Path for model file doesn't contain an extension: \"" + modelPath + "\"");
+        m_binPath = m_modelPath.substr(0, pos) + ".bin";
+    }
+    NGRAPH_CHECK(m_binPath != m_modelPath, "Paths for model and bin files are the same: \"" + modelPath + "\"");
+}
+
 OPENVINO_SUPPRESS_DEPRECATED_START
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        std::map<std::string, ngraph::OpSet>&& custom_opsets,
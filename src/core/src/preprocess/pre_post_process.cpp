@@ -370,6 +370,16 @@ PostProcessSteps& PostProcessSteps::convert_layout(const std::vector<uint64_t>&
     return *this;
 }
 
+PostProcessSteps& PostProcessSteps::softmax() {
+    m_impl->add_softmax_impl();
+    return *this;
+}
+
+PostProcessSteps& PostProcessSteps::topk(size_t k) {
+    m_impl->add_topk_impl(k);
+    return *this;
+}
+
 PostProcessSteps& PostProcessSteps::custom(const CustomPostprocessOp& postprocess_cb) {
     // 'true' indicates that custom postprocessing step will trigger validate_and_infer_types
     m_impl->actions().emplace_back(
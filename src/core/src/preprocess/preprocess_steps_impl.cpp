@@ -576,5 +576,51 @@ void PostStepsList::add_convert_layout_impl(const std::vector<uint64_t>& dims) {
         },
         "convert layout " + vector_to_string(dims));
 }
+
+static size_t get_postprocess_axis(const Output<Node>& node, const PostprocessingContext& context) {
+    if (ov::layout::has_channels(context.layout())) {
+        return get_and_check_channels_idx(context.layout(), node.get_partial_shape());
+    }
+    const auto& rank = node.get_partial_shape().rank();
+    OPENVINO_ASSERT(rank.is_static() && rank.get_length() > 0,
+                    "Can't get postprocessing axis for output with shape ",
+                    node.get_partial_shape());
+    return rank.get_length() - 1;
+}
+
+void PostStepsList::add_softmax_impl() {
+    m_actions.emplace_back(
+        [](const Output<Node>& node, PostprocessingContext& context) {
+            auto softmax = std::make_shared<op::v8::Softmax>(node, get_postprocess_axis(node, context));
+            return std::make_tuple(Output<Node>(softmax), true);
+        },
+        "softmax");
+}
+
+void PostStepsList::add_topk_impl(size_t k) {
+    OPENVINO_ASSERT(k > 0, "Top K postprocessing requires K greater than zero");
+    m_actions.emplace_back(
+        [k](const Output<Node>& node, PostprocessingContext& context) {
+            auto axis = get_postprocess_axis(node, context);
+            const auto& dim = node.get_partial_shape()[axis];
+            OPENVINO_ASSERT(dim.is_dynamic() || static_cast<size_t>(dim.get_length()) >= k,
+                            "Top K postprocessing: K = ",
+                            k,
+                            " is greater than dimension ",
+                            dim,
+                            " of output shape ",
+                            node.get_partial_shape());
+            auto k_constant = op::v0::Constant::create<int64_t>(element::i64, Shape{}, {static_cast<int64_t>(k)});
+            auto topk = std::make_shared<op::v3::TopK>(node,
+                                                       k_constant,
+                                                       static_cast<int64_t>(axis),
+                                                       op::v1::TopK::Mode::MAX,
+                                                       op::v1::TopK::SortType::SORT_VALUES,
+                                                       element::i32);
+            // Only indices are returned, the values output stays unconnected
+            return std::make_tuple(topk->output(1), true);
+        },
+        "top " + std::to_string(k));
+}
 }  // namespace preprocess
 }  // namespace ov
@@ -219,6 +219,8 @@ public:
     void add_convert_impl(const element::Type& type);
     void add_convert_layout_impl(const Layout& layout);
     void add_convert_layout_impl(const std::vector<uint64_t>& dims);
+    void add_softmax_impl();
+    void add_topk_impl(size_t k);
 
     const std::list<InternalPostprocessAction>& actions() const {
         return m_actions;
@@ -8,6 +8,7 @@
 #include "ie_allocator.hpp"
 #include "ie_common.h"
 #include "openvino/core/except.hpp"
+#include "pooled_allocator.hpp"
 
 namespace ov {
 
@@ -60,4 +61,8 @@ Allocator::operator bool() const noexcept {
     return (!!_impl);
 }
 
+Allocator get_pooled_allocator() {
+    return Allocator{PooledAllocator::get()};
+}
+
 }  // namespace ov
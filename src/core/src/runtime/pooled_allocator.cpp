@@ -0,0 +1,212 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace {
+// the classes are 64 bytes and then four classes for each power of two: (2^p, 2^p * 1.25], ..., (2^p * 1.75, 2^(p+1)],
+// so no more than a fifth of a pooled block is wasted
+constexpr size_t min_class_log2 = 6;
+constexpr size_t max_class_log2 = 28;
+constexpr size_t classes_per_power = 4;
+constexpr size_t classes_count = 1 + (max_class_log2 - min_class_log2) * classes_per_power;
+constexpr size_t max_class_size = size_t{1} << max_class_log2;
+// the blocks which are too big for the classes or too aligned are not cached
+constexpr size_t unpooled = static_cast<size_t>(-1);
+
+// the blocks up to 256KB are cached in the thread which released them, a few blocks per class
+constexpr size_t thread_classes_count = 1 + (18 - min_class_log2) * classes_per_power;
+constexpr size_t thread_cache_blocks_per_class = 4;
+constexpr size_t thread_cache_max_bytes = 4ul * 1024 * 1024;
+// the bigger blocks and the excess of the thread caches are shared by all the threads
+constexpr size_t global_cache_max_bytes = 512ul * 1024 * 1024;
+
+size_t floor_log2(size_t value) {
+    size_t result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+size_t get_size_class(size_t bytes) {
+    if (bytes <= (size_t{1} << min_class_log2)) {
+        return 0;
+    }
+    const auto power = floor_log2(bytes - 1);
+    const auto step = size_t{1} << (power - 2);
+    const auto sub_class = (bytes - (size_t{1} << power) + step - 1) / step;
+    return 1 + (power - min_class_log2) * classes_per_power + (sub_class - 1);
+}
+
+size_t get_class_size(size_t size_class) {
+    if (size_class == 0) {
+        return size_t{1} << min_class_log2;
+    }
+    const auto power = min_class_log2 + (size_class - 1) / classes_per_power;
+    const auto sub_class = (size_class - 1) % classes_per_power + 1;
+    return (size_t{1} << power) + sub_class * (size_t{1} << (power - 2));
+}
+
+// placed right before the memory given to the user
+struct Header {
+    void* allocated;
+    size_t size_class;
+};
+
+// the released blocks are linked through their own memory
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+Header* get_header(void* ptr) {
+    return reinterpret_cast<Header*>(static_cast<char*>(ptr) - sizeof(Header));
+}
+
+void* allocate_block(size_t bytes, size_t alignment, size_t size_class) {
+    auto allocated = static_cast<char*>(::operator new(bytes + alignment + sizeof(Header)));
+    const auto address = reinterpret_cast<uintptr_t>(allocated + sizeof(Header));
+    auto ptr = reinterpret_cast<char*>((address + alignment - 1) & ~(uintptr_t{alignment} - 1));
+    *get_header(ptr) = Header{allocated, size_class};
+    return ptr;
+}
+
+void free_block(void* ptr) {
+    ::operator delete(get_header(ptr)->allocated);
+}
+
+struct GlobalCache {
+    std::mutex mutex;
+    FreeBlock* blocks[classes_count] = {};
+    size_t cached_bytes = 0;
+
+    void* pop(size_t size_class) {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto block = blocks[size_class];
+        if (block) {
+            blocks[size_class] = block->next;
+            cached_bytes -= get_class_size(size_class);
+        }
+        return block;
+    }
+
+    void push(void* ptr, size_t size_class) {
+        const auto size = get_class_size(size_class);
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (cached_bytes + size <= global_cache_max_bytes) {
+                auto block = static_cast<FreeBlock*>(ptr);
+                block->next = blocks[size_class];
+                blocks[size_class] = block;
+                cached_bytes += size;
+                return;
+            }
+        }
+        free_block(ptr);
+    }
+};
+
+// the cache outlives all the threads, so it's never destroyed
+GlobalCache& get_global_cache() {
+    static auto cache = new GlobalCache;
+    return *cache;
+}
+
+struct ThreadCache {
+    FreeBlock* blocks[thread_classes_count] = {};
+    size_t counts[thread_classes_count] = {};
+    size_t cached_bytes = 0;
+
+    ~ThreadCache() {
+        auto& global_cache = get_global_cache();
+        for (size_t size_class = 0; size_class < thread_classes_count; ++size_class) {
+            while (auto block = blocks[size_class]) {
+                blocks[size_class] = block->next;
+                global_cache.push(block, size_class);
+            }
+        }
+    }
+
+    void* pop(size_t size_class) {
+        auto block = blocks[size_class];
+        if (block) {
+            blocks[size_class] = block->next;
+            --counts[size_class];
+            cached_bytes -= get_class_size(size_class);
+        }
+        return block;
+    }
+
+    bool push(void* ptr, size_t size_class) {
+        const auto size = get_class_size(size_class);
+        if (counts[size_class] == thread_cache_blocks_per_class || cached_bytes + size > thread_cache_max_bytes) {
+            return false;
+        }
+        auto block = static_cast<FreeBlock*>(ptr);
+        block->next = blocks[size_class];
+        blocks[size_class] = block;
+        ++counts[size_class];
+        cached_bytes += size;
+        return true;
+    }
+};
+
+ThreadCache& get_thread_cache() {
+    thread_local ThreadCache cache;
+    return cache;
+}
+}  // namespace
+
+constexpr size_t PooledAllocator::min_alignment;
+
+const std::shared_ptr<PooledAllocator>& PooledAllocator::get() {
+    static const auto allocator = std::make_shared<PooledAllocator>();
+    return allocator;
+}
+
+void* PooledAllocator::allocate(const size_t bytes, const size_t alignment) {
+    OPENVINO_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0,
+                    "The alignment must be a power of two. alignment: ",
+                    alignment);
+    if (alignment > min_alignment || bytes > max_class_size) {
+        return allocate_block(bytes, std::max(alignment, min_alignment), unpooled);
+    }
+
+    const auto size_class = get_size_class(bytes);
+    void* ptr = nullptr;
+    if (size_class < thread_classes_count) {
+        ptr = get_thread_cache().pop(size_class);
+    }
+    if (!ptr) {
+        ptr = get_global_cache().pop(size_class);
+    }
+    return ptr ? ptr : allocate_block(get_class_size(size_class), min_alignment, size_class);
+}
+
+void PooledAllocator::deallocate(void* handle, const size_t, size_t) {
+    if (!handle) {
+        return;
+    }
+    const auto size_class = get_header(handle)->size_class;
+    if (size_class == unpooled) {
+        free_block(handle);
+    } else if (size_class >= thread_classes_count || !get_thread_cache().push(handle, size_class)) {
+        get_global_cache().push(handle, size_class);
+    }
+}
+
+bool PooledAllocator::is_equal(const AllocatorImpl& other) const {
+    // all the blocks have the headers, so any pooled allocator releases them
+    return dynamic_cast<const PooledAllocator*>(&other) != nullptr;
+}
+
+}  // namespace ov
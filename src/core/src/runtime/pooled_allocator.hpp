@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/runtime/allocator.hpp"
+
+namespace ov {
+
+/**
+ * @brief The allocator which keeps the released blocks in the free lists of size classes instead of returning them to
+ *        the system. The small blocks are cached in the thread which released them first, so the most of allocations
+ *        take no lock. Each block has a header with its size class, so the memory may be released without the size and
+ *        by any PooledAllocator.
+ */
+class PooledAllocator : public AllocatorImpl {
+public:
+    /// @brief The alignment all the blocks have at least
+    static constexpr size_t min_alignment = 64;
+
+    /// @brief The process-wide pool, it's never destroyed so the thread caches may be flushed at any time
+    static const std::shared_ptr<PooledAllocator>& get();
+
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) override;
+
+    void deallocate(void* handle, const size_t bytes = 0, size_t alignment = alignof(max_align_t)) override;
+
+    bool is_equal(const AllocatorImpl& other) const override;
+};
+
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
@@ -11,17 +12,32 @@
 namespace ov {
 class SharedRTInfo {
 public:
-    SharedRTInfo() : m_use_topological_cache(false) {}
+    SharedRTInfo() : m_use_topological_cache(false), m_version(m_next_version.fetch_add(1)) {}
 
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
+        if (!status) {
+            update_version();
+        }
     }
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    /// \brief Marks the nodes sharing this info as changed, the versions are unique across all the models
+    void update_version() {
+        m_version = m_next_version.fetch_add(1);
+    }
+
+    size_t get_version() const {
+        return m_version;
+    }
+
 private:
+    static std::atomic<size_t> m_next_version;
+
     bool m_use_topological_cache;
+    std::atomic<size_t> m_version;
 };
 }  // namespace ov
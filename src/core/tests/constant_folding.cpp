@@ -4,6 +4,7 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <numeric>
 #include <transformations/utils/utils.hpp>
 
 #include "gtest/gtest.h"
@@ -3353,3 +3354,49 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, large_constant_subgraphs) {
+    // Two independent chains of elementwise operations over 1M floats, each wave of the chains is large enough to be
+    // folded concurrently, the intermediate buffers are reused if the folding is in place
+    const Shape shape{1024, 1024};
+    auto make_model = [&]() {
+        std::vector<float> values(shape_size(shape));
+        std::iota(values.begin(), values.end(), 0.f);
+        auto data_0 = op::Constant::create(element::f32, shape, values);
+        auto data_1 = op::Constant::create(element::f32, shape, values);
+        auto two = op::Constant::create(element::f32, Shape{}, {2});
+        Output<Node> chain_0 = std::make_shared<opset5::Multiply>(data_0, two);
+        Output<Node> chain_1 = std::make_shared<opset5::Add>(data_1, two);
+        for (size_t i = 0; i < 4; ++i) {
+            chain_0 = std::make_shared<opset5::Subtract>(chain_0, two);
+            chain_1 = std::make_shared<opset5::Negative>(chain_1);
+        }
+        chain_0.get_node_shared_ptr()->set_friendly_name("chain_0");
+        chain_1.get_node_shared_ptr()->set_friendly_name("chain_1");
+        return std::make_shared<Function>(OutputVector{chain_0, chain_1}, ParameterVector{});
+    };
+
+    for (bool in_place : {false, true}) {
+        auto f = make_model();
+        pass::Manager m;
+        m.register_pass<pass::ConstantFolding>(in_place);
+        m.run_passes(f);
+
+        ASSERT_EQ(count_ops_of_type<opset5::Subtract>(f), 0);
+        ASSERT_EQ(count_ops_of_type<opset5::Negative>(f), 0);
+        auto result_0 = ov::as_type_ptr<op::Constant>(f->get_results().at(0)->get_input_node_shared_ptr(0));
+        auto result_1 = ov::as_type_ptr<op::Constant>(f->get_results().at(1)->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(result_0);
+        ASSERT_TRUE(result_1);
+        ASSERT_EQ(result_0->get_friendly_name(), "chain_0");
+        ASSERT_EQ(result_1->get_friendly_name(), "chain_1");
+
+        const auto values_0 = result_0->cast_vector<float>();
+        const auto values_1 = result_1->cast_vector<float>();
+        ASSERT_EQ(values_0.size(), shape_size(shape));
+        for (size_t i = 0; i < values_0.size(); i += 997) {
+            ASSERT_EQ(values_0[i], 2.f * i - 8.f);
+            ASSERT_EQ(values_1[i], i + 2.f);
+        }
+    }
+}
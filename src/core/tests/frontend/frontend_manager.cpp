@@ -3,6 +3,7 @@
 //
 
 #include <memory>
+#include <sstream>
 #include <openvino/frontend/exception.hpp>
 #include <openvino/frontend/manager.hpp>
 
@@ -172,6 +173,26 @@ TEST(FrontEndManagerTest, testDefaultFrontEnd) {
     ASSERT_EQ(fe->get_name(), std::string());
 }
 
+TEST(FrontEndManagerTest, testLoadByModelChecksFrontEndOnce) {
+    FrontEndManager fem;
+    static int supported_calls = 0;
+    class MockFrontEnd : public FrontEnd {
+    protected:
+        bool supported_impl(const std::vector<ov::Any>&) const override {
+            ++supported_calls;
+            return false;
+        }
+    };
+    ASSERT_NO_THROW(fem.register_front_end("onnx", []() {
+        return std::make_shared<MockFrontEnd>();
+    }));
+    std::istringstream model_stream("not a model");
+    FrontEnd::Ptr fe;
+    ASSERT_NO_THROW(fe = fem.load_by_model(&model_stream));
+    ASSERT_FALSE(fe);
+    ASSERT_EQ(supported_calls, 1);
+}
+
 TEST(FrontEndManagerTest, testDefaultInputModel) {
     class MockInputModel : public InputModel {};
     std::unique_ptr<InputModel> imPtr(new MockInputModel());  // to verify base destructor
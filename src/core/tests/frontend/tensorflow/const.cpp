@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov::frontend;
+
+namespace {
+std::shared_ptr<ov::opset8::Constant> find_constant(const std::shared_ptr<ov::Model>& model, const std::string& name) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (node->get_friendly_name() == name)
+            return std::dynamic_pointer_cast<ov::opset8::Constant>(node);
+    }
+    return nullptr;
+}
+}  // namespace
+
+TEST(FrontEndConvertModelTest, large_constants_values) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+    ASSERT_NE(frontEnd, nullptr);
+    auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                             std::string("large_constants/large_constants.pb"));
+    ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+    ASSERT_NE(inputModel, nullptr);
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+    ASSERT_NE(model, nullptr);
+    // the constants refer to the graph, it has to outlive the frontend objects
+    inputModel.reset();
+    frontEnd.reset();
+
+    auto embedding = find_constant(model, "embedding");
+    ASSERT_NE(embedding, nullptr);
+    ASSERT_EQ(embedding->get_shape(), (ov::Shape{1000, 64}));
+    const auto embedding_values = embedding->cast_vector<float>();
+    for (size_t i = 0; i < embedding_values.size(); ++i)
+        ASSERT_EQ(embedding_values[i], static_cast<float>(i));
+
+    auto bias = find_constant(model, "bias");
+    ASSERT_NE(bias, nullptr);
+    const auto bias_values = bias->cast_vector<int64_t>();
+    ASSERT_EQ(bias_values.size(), 64);
+    for (size_t i = 0; i < bias_values.size(); ++i)
+        ASSERT_EQ(bias_values[i], static_cast<int64_t>(i));
+
+    auto mask = find_constant(model, "mask");
+    ASSERT_NE(mask, nullptr);
+    ASSERT_EQ(mask->get_element_type(), ov::element::boolean);
+    const auto mask_values = mask->cast_vector<char>();
+    ASSERT_EQ(mask_values.size(), 64);
+    for (size_t i = 0; i < mask_values.size(); ++i)
+        ASSERT_EQ(mask_values[i] != 0, i % 2 == 0);
+}
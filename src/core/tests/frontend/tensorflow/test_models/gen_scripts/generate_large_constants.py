@@ -0,0 +1,27 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model
+with tf.compat.v1.Session() as sess:
+    indices = tf.compat.v1.placeholder(tf.int32, [4], 'indices')
+
+    # the values of the constants are their indices, so the test can check them
+    embedding = tf.constant(np.arange(1000 * 64).reshape(1000, 64), dtype=tf.float32, name="embedding")
+    bias = tf.constant(np.arange(64), dtype=tf.int64, name="bias")
+    mask = tf.constant(np.arange(64) % 2 == 0, dtype=tf.bool, name="mask")
+
+    gathered = tf.gather(embedding, indices, name="gathered")
+    biased = tf.add(gathered, tf.cast(bias, tf.float32), name="biased")
+    tf.where(mask, biased, tf.zeros_like(biased), name="masked")
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "large_constants"), 'large_constants.pb', False)
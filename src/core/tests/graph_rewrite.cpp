@@ -7,6 +7,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -442,3 +444,41 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+class CountRootsPass : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    CountRootsPass(const std::shared_ptr<Node>& root, NodeVector& roots) : MatcherPass() {
+        ngraph::matcher_pass_callback callback = [&roots](pattern::Matcher& m) {
+            roots.push_back(m.get_match_root());
+            return false;
+        };
+        auto m = std::make_shared<ngraph::pattern::Matcher>(root, "CountRoots");
+        register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(CountRootsPass, "CountRootsPass", 0);
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassWithAnyTypeRoots) {
+    // the matchers indexed by their root types and the ones matching any node are all run in the registration order
+    auto f = get_function();
+    NodeVector divide_roots, or_roots, any_roots;
+
+    Anchor anchor;
+    anchor.add_matcher<CountRootsPass>(pattern::wrap_type<opset3::Divide>(), divide_roots);
+    anchor.add_matcher<CountRootsPass>(std::make_shared<pattern::op::Or>(
+                                           OutputVector{pattern::wrap_type<opset3::Divide>(),
+                                                        pattern::wrap_type<opset3::Parameter, opset3::Constant>()}),
+                                       or_roots);
+    anchor.add_matcher<CountRootsPass>(pattern::any_input(), any_roots);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(divide_roots.size(), 1);
+    ASSERT_TRUE(ov::is_type<opset3::Divide>(divide_roots[0]));
+    ASSERT_EQ(or_roots.size(), 3);
+    for (const auto& root : or_roots) {
+        ASSERT_FALSE(ov::is_type<opset3::Result>(root));
+    }
+    ASSERT_EQ(any_roots.size(), f->get_ordered_ops().size());
+}
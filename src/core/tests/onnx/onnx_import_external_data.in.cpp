@@ -84,6 +84,23 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_share_mapping) {
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    // the constants refer to the single mapping of the file at the offsets of their data
+    std::map<std::string, const char*> constants_data;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<default_opset::Constant>(op)) {
+            constants_data[constant->get_friendly_name()] = constant->get_data_ptr<char>();
+        }
+    }
+    ASSERT_EQ(constants_data.count("data_a"), 1);
+    ASSERT_EQ(constants_data.count("data_b"), 1);
+    EXPECT_EQ(constants_data["data_b"] - constants_data["data_a"], 4096);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -202,7 +202,7 @@ ComparisonResult compare_onnx_models(const std::string& model, const std::string
     std::stringstream model_stream{model};
     const auto model_proto = onnx_common::parse_from_istream(model_stream);
     const auto ref_model = onnx_common::parse_from_file(reference_model_path);
-    return compare_onnx_graphs(model_proto.graph(), ref_model.graph(), comp);
+    return compare_onnx_graphs(model_proto->graph(), ref_model->graph(), comp);
 }
 }  // namespace test
 }  // namespace ngraph
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using OVPooledAllocatorTest = ::testing::Test;
+
+TEST_F(OVPooledAllocatorTest, notThrowOnZeroSize) {
+    auto allocator = ov::get_pooled_allocator();
+    void* ptr = nullptr;
+    ASSERT_NO_THROW(ptr = allocator.allocate(0));
+    ASSERT_NO_THROW(allocator.deallocate(ptr));
+}
+
+TEST_F(OVPooledAllocatorTest, memoryIsAligned) {
+    auto allocator = ov::get_pooled_allocator();
+    for (size_t size : {1, 63, 64, 100, 10000, 1000000}) {
+        void* ptr = allocator.allocate(size);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        allocator.deallocate(ptr);
+    }
+    void* ptr = allocator.allocate(100, 4096);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 4096, 0);
+    allocator.deallocate(ptr, 100, 4096);
+    ASSERT_THROW(allocator.allocate(100, 3), ov::Exception);
+}
+
+TEST_F(OVPooledAllocatorTest, releasedMemoryIsReused) {
+    auto allocator = ov::get_pooled_allocator();
+    void* ptr = allocator.allocate(10000);
+    allocator.deallocate(ptr, 10000);
+    // the size of the same class is given the cached block
+    void* other = allocator.allocate(9000);
+    EXPECT_EQ(ptr, other);
+    allocator.deallocate(other);
+}
+
+TEST_F(OVPooledAllocatorTest, pooledAllocatorsAreEqual) {
+    ASSERT_TRUE(ov::get_pooled_allocator() == ov::get_pooled_allocator());
+    ASSERT_FALSE(ov::get_pooled_allocator() == ov::Allocator{});
+}
+
+TEST_F(OVPooledAllocatorTest, canBeReleasedInOtherThread) {
+    auto allocator = ov::get_pooled_allocator();
+    std::vector<void*> ptrs;
+    for (size_t i = 1; i < 100; ++i) {
+        auto ptr = static_cast<char*>(allocator.allocate(i * 1000));
+        ptr[i * 1000 - 1] = 11;
+        ptrs.push_back(ptr);
+    }
+    std::thread([&] {
+        for (auto ptr : ptrs) {
+            allocator.deallocate(ptr);
+        }
+    }).join();
+}
+
+TEST_F(OVPooledAllocatorTest, tensorCanUsePooledAllocator) {
+    ov::Tensor tensor{ov::element::f32, ov::Shape{1, 3, 224, 224}, ov::get_pooled_allocator()};
+    auto data = tensor.data<float>();
+    data[tensor.get_size() - 1] = 1.f;
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % 64, 0);
+    tensor.set_shape({1, 3, 300, 300});
+    tensor.data<float>()[tensor.get_size() - 1] = 1.f;
+}
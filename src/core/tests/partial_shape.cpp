@@ -1255,3 +1255,26 @@ TEST(partial_shape, infer_windowed_reduction_rank_static_dynamic_rank_static_dyn
         },
         NodeValidationFailure);
 }
+
+TEST(partial_shape, inline_and_heap_dimensions) {
+    // the short shapes keep their dimensions inline, the longer ones move them to the heap, both behave the same
+    PartialShape ps{1, Dimension::dynamic(), 3};
+    ps.insert(ps.begin() + 1, Dimension(2, 4));
+    ASSERT_EQ(ps, (PartialShape{1, Dimension(2, 4), Dimension::dynamic(), 3}));
+
+    ps.insert(ps.end(), 4, Dimension(5));
+    ASSERT_EQ(ps.size(), 8);
+    ps.push_back(ps[0]);
+    ps.insert(ps.begin(), ps.begin() + 1, ps.begin() + 3);
+    ASSERT_EQ(ps,
+              (PartialShape{Dimension(2, 4), Dimension::dynamic(), 1, Dimension(2, 4), Dimension::dynamic(), 3, 5, 5, 5,
+                            5, 1}));
+
+    auto copy = ps;
+    auto moved = std::move(ps);
+    ASSERT_EQ(copy, moved);
+    moved.resize(2);
+    ASSERT_EQ(moved, (PartialShape{Dimension(2, 4), Dimension::dynamic()}));
+    ASSERT_EQ(std::vector<Dimension>(copy).size(), 11);
+    ASSERT_EQ(PartialShape(std::vector<Dimension>(copy)), copy);
+}
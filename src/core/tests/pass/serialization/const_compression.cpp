@@ -207,3 +207,27 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, IdenticalLargeConstantsAndSharedBuffer) {
+    constexpr int unique_const_count = 2;
+    const ov::Shape shape{4, 4, 5};
+
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i);
+    }
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    auto C = A->clone_with_new_inputs({});
+    values.back() = -1.f;
+    auto D = ov::opset8::Constant::create(ov::element::f32, shape, values);
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B, C, D}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(float));
+}
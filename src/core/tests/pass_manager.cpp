@@ -9,9 +9,13 @@
 
 #include "engines_util/execute_tools.hpp"
 #include "gtest/gtest.h"
+#include "load_time_stats.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset3.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +46,91 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+// Counts the Relu operations it visits and changes nothing
+class CountReluPass : public ov::pass::MatcherPass {
+public:
+    explicit CountReluPass(size_t& count) {
+        auto relu = ov::pass::pattern::wrap_type<opset3::Relu>();
+        ngraph::matcher_pass_callback callback = [&count](ov::pass::pattern::Matcher&) {
+            ++count;
+            return false;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "CountRelu"), callback);
+    }
+};
+}  // namespace
+
+TEST(pass_manager, graph_version) {
+    auto data = make_shared<opset3::Parameter>(element::f32, PartialShape{1, 3});
+    auto relu = make_shared<opset3::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+
+    const auto version = f->get_graph_version();
+    EXPECT_EQ(version, f->get_graph_version());
+    relu->set_friendly_name("relu");
+    EXPECT_EQ(version, f->get_graph_version());
+
+    data->set_partial_shape(PartialShape{2, 3});
+    f->validate_nodes_and_infer_types();
+    const auto reshaped_version = f->get_graph_version();
+    EXPECT_NE(version, reshaped_version);
+
+    auto abs = make_shared<opset3::Abs>(data);
+    relu->input(0).replace_source_output(abs);
+    EXPECT_NE(reshaped_version, f->get_graph_version());
+}
+
+TEST(pass_manager, change_tracking) {
+    auto data = make_shared<opset3::Parameter>(element::f32, PartialShape{1, 3});
+    auto relu = make_shared<opset3::Relu>(make_shared<opset3::Relu>(data));
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+
+    size_t count = 0;
+    pass::Manager manager;
+    manager.set_change_tracking(true);
+    manager.register_pass<CountReluPass>(count);
+
+    manager.run_passes(f);
+    EXPECT_EQ(count, 2);
+
+    // nothing is changed since the previous run
+    manager.run_passes(f);
+    EXPECT_EQ(count, 2);
+
+    auto another_relu = make_shared<opset3::Relu>(relu);
+    f->get_results()[0]->input(0).replace_source_output(another_relu);
+    manager.run_passes(f);
+    EXPECT_EQ(count, 5);
+
+    // the other models aren't skipped
+    auto g = ngraph::clone_function(*f);
+    manager.run_passes(g);
+    EXPECT_EQ(count, 8);
+
+    manager.set_change_tracking(false);
+    manager.run_passes(g);
+    EXPECT_EQ(count, 11);
+}
+
+TEST(pass_manager, load_time_stats) {
+    auto data = make_shared<opset3::Parameter>(element::f32, PartialShape{1, 3});
+    auto relu = make_shared<opset3::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+
+    size_t count = 0;
+    pass::Manager manager;
+    const auto pass_name = "transformations/" + manager.register_pass<CountReluPass>(count)->get_name();
+
+    const auto before = ov::load_time_stats::get();
+    manager.run_passes(f);
+    const auto after = ov::load_time_stats::get();
+    ASSERT_EQ(after.count("transformations"), 1);
+    ASSERT_EQ(after.count(pass_name), 1);
+    auto measured = [&](const std::string& phase) {
+        return after.at(phase) - (before.count(phase) ? before.at(phase) : 0.0);
+    };
+    // the time of the pass manager includes the time of its passes
+    EXPECT_GE(measured("transformations"), measured(pass_name));
+}
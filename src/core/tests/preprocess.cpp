@@ -1579,6 +1579,40 @@ TEST(pre_post_process, postprocess_custom_step) {
               std::string(op::v0::Abs::get_type_info_static().name));
 }
 
+TEST(pre_post_process, postprocess_softmax_topk) {
+    auto f = create_simple_function(element::f32, Shape{2, 1000});
+    auto p = PrePostProcessor(f);
+
+    p.output().postprocess().softmax().topk(5);
+    p.build();
+    EXPECT_EQ(f->get_results()[0]->get_element_type(), element::i32);
+    EXPECT_EQ(f->get_results()[0]->get_output_tensor(0).get_partial_shape(), (PartialShape{2, 5}));
+    EXPECT_EQ(f->output().get_tensor().get_names(), (std::unordered_set<std::string>{"tensor_output1"}));
+    auto topk = f->get_results()[0]->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(std::dynamic_pointer_cast<op::v3::TopK>(topk));
+    EXPECT_EQ(std::dynamic_pointer_cast<op::v3::TopK>(topk)->get_axis(), 1u);
+    EXPECT_TRUE(std::dynamic_pointer_cast<op::v8::Softmax>(topk->get_input_node_shared_ptr(0)));
+}
+
+TEST(pre_post_process, postprocess_topk_channels) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 480, 640});
+    auto p = PrePostProcessor(f);
+
+    p.output().model().set_layout("NCHW");
+    p.output().postprocess().topk(1);
+    p.build();
+    EXPECT_EQ(f->get_results()[0]->get_output_tensor(0).get_partial_shape(), (PartialShape{1, 1, 480, 640}));
+    EXPECT_EQ(f->get_results()[0]->get_layout(), "NCHW");
+}
+
+TEST(pre_post_process, postprocess_topk_invalid_k) {
+    auto f = create_simple_function(element::f32, Shape{1, 10});
+    auto p = PrePostProcessor(f);
+    EXPECT_THROW(p.output().postprocess().topk(0), ov::AssertFailure);
+    p.output().postprocess().topk(11);
+    EXPECT_THROW(p.build(), ov::AssertFailure);
+}
+
 TEST(pre_post_process, postprocess_implicit_convert_element_type_and_layout) {
     auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
     auto p = PrePostProcessor(f);
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/transpose.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace ngraph;
+using namespace ngraph::runtime::reference;
+
+TEST(reference_parallel, parallel_for_visits_every_item_once) {
+    constexpr size_t count = 10000;
+    std::vector<std::atomic<int>> visits(count);
+    for (auto& visit : visits) {
+        visit = 0;
+    }
+    parallel_for(count, parallel_for_min_work, [&](size_t begin, size_t end) {
+        ASSERT_LT(begin, end);
+        ASSERT_LE(end, count);
+        for (size_t i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+    });
+    for (const auto& visit : visits) {
+        EXPECT_EQ(visit, 1);
+    }
+}
+
+TEST(reference_parallel, parallel_for_small_range_on_calling_thread) {
+    size_t calls = 0;
+    parallel_for(100, 1, [&](size_t begin, size_t end) {
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 100);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(reference_parallel, parallel_for_nested_on_calling_thread) {
+    std::atomic<size_t> nested_calls{0};
+    parallel_for(64, parallel_for_min_work, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            parallel_for(64, parallel_for_min_work, [&](size_t nested_begin, size_t nested_end) {
+                EXPECT_EQ(nested_begin, 0);
+                EXPECT_EQ(nested_end, 64);
+                ++nested_calls;
+            });
+        }
+    });
+    EXPECT_EQ(nested_calls, 64);
+}
+
+TEST(reference_parallel, parallel_for_rethrows) {
+    EXPECT_THROW(parallel_for(1000,
+                              parallel_for_min_work,
+                              [](size_t begin, size_t end) {
+                                  if (begin <= 500 && 500 < end) {
+                                      throw std::runtime_error("item 500");
+                                  }
+                              }),
+                 std::runtime_error);
+}
+
+TEST(reference_parallel, reduction_loop_same_order_as_input) {
+    const Shape in_shape{4, 3, 5, 6};
+    for (const auto& reduction_axes : std::vector<AxisSet>{{}, {0}, {1}, {3}, {1, 3}, {0, 2}, {0, 1, 2, 3}}) {
+        const auto out_shape = reduce(in_shape, reduction_axes, false);
+        const auto in_strides = row_major_strides(in_shape);
+        const auto out_strides = row_major_strides(out_shape);
+
+        std::vector<std::vector<size_t>> expected(shape_size(out_shape));
+        NGRAPH_SUPPRESS_DEPRECATED_START
+        for (const Coordinate& in_coord : CoordinateTransformBasic(in_shape)) {
+            const Coordinate out_coord = reduce(in_coord, reduction_axes, false);
+            const size_t in_idx = std::inner_product(in_coord.begin(), in_coord.end(), in_strides.begin(), size_t{0});
+            const size_t out_idx =
+                std::inner_product(out_coord.begin(), out_coord.end(), out_strides.begin(), size_t{0});
+            expected[out_idx].push_back(in_idx);
+        }
+        NGRAPH_SUPPRESS_DEPRECATED_END
+
+        std::vector<std::vector<size_t>> visited(shape_size(out_shape));
+        reduction_loop(in_shape, reduction_axes, [&](size_t in_idx, size_t out_idx) {
+            visited[out_idx].push_back(in_idx);
+        });
+        EXPECT_EQ(visited, expected) << "reduction axes " << reduction_axes;
+    }
+}
+
+TEST(reference_parallel, transpose_by_rows) {
+    const Shape data_shape{8, 64, 32, 16};
+    const std::vector<int64_t> axes_order{0, 2, 3, 1};
+    const Shape out_shape{8, 32, 16, 64};
+    std::vector<float> data(shape_size(data_shape));
+    std::iota(data.begin(), data.end(), 0.0f);
+
+    std::vector<float> out(data.size());
+    transpose(reinterpret_cast<const char*>(data.data()),
+              reinterpret_cast<char*>(out.data()),
+              data_shape,
+              sizeof(float),
+              axes_order.data(),
+              out_shape);
+
+    const auto data_strides = row_major_strides(data_shape);
+    const auto out_strides = row_major_strides(out_shape);
+    for (size_t i = 0; i < out.size(); ++i) {
+        size_t data_idx = 0;
+        for (size_t axis = 0; axis < out_shape.size(); ++axis) {
+            data_idx += i / out_strides[axis] % out_shape[axis] * data_strides[axes_order[axis]];
+        }
+        ASSERT_EQ(out[i], data[data_idx]) << "output element " << i;
+    }
+}
@@ -4,9 +4,16 @@
 
 #include "openvino/frontend/manager.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
 #include <openvino/util/env_util.hpp>
 #include <openvino/util/file_util.hpp>
+#include <set>
+#include <sstream>
 
+#include "compact_ir.hpp"
 #include "ngraph/except.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/env_util.hpp"
@@ -51,13 +58,21 @@ public:
                 }
             }
         }
-        // Load plugins until we found the right one
+        // Load plugins until we found the right one, the library named after the framework is the likely one
+        std::vector<PluginInfo*> plugins;
         for (auto& plugin : m_plugins) {
-            OPENVINO_ASSERT(plugin.load(), "Cannot load frontend ", plugin.get_name_from_file());
-            if (plugin.get_creator().m_name == framework) {
+            plugins.push_back(&plugin);
+        }
+        std::stable_partition(plugins.begin(), plugins.end(), [&framework](const PluginInfo* plugin) {
+            return plugin->is_loaded() ? plugin->get_creator().m_name == framework
+                                       : plugin->get_name_from_file() == framework;
+        });
+        for (auto plugin : plugins) {
+            OPENVINO_ASSERT(plugin->load(), "Cannot load frontend ", plugin->get_name_from_file());
+            if (plugin->get_creator().m_name == framework) {
                 auto fe_obj = std::make_shared<FrontEnd>();
-                fe_obj->m_shared_object = plugin.get_so_pointer();
-                fe_obj->m_actual = plugin.get_creator().m_creator();
+                fe_obj->m_shared_object = plugin->get_so_pointer();
+                fe_obj->m_actual = plugin->get_creator().m_creator();
                 return fe_obj;
             }
         }
@@ -80,13 +95,14 @@ public:
     FrontEnd::Ptr load_by_model(const std::vector<ov::Any>& variants) {
         std::lock_guard<std::mutex> guard(m_loading_mutex);
         // Step 1: Search from hard-coded prioritized frontends first
-        auto ptr = search_priority(variants);
+        std::set<const PluginInfo*> checked;
+        auto ptr = search_priority(variants, checked);
         if (ptr) {
             return ptr;
         }
-        // Step 2: Load and search from all available frontends
+        // Step 2: Load and search from all available frontends, except for the ones rejected the model already
         for (auto& plugin : m_plugins) {
-            if (!plugin.load()) {
+            if (checked.count(&plugin) || !plugin.load()) {
                 continue;
             }
             auto fe = plugin.get_creator().m_creator();
@@ -123,7 +139,35 @@ private:
         return info.is_file_name_match(names.file_name) || info.get_creator().m_name == names.name;
     }
 
-    FrontEnd::Ptr search_priority(const std::vector<ov::Any>& variants) {
+    // Guesses the frontend file name by the first bytes of the model, only the order of the frontends depends on it
+    static std::string guess_by_header(std::istream& stream) {
+        char header[sizeof(ov::compact_ir::Header)] = {};
+        const auto pos = stream.tellg();
+        stream.read(header, sizeof(header));
+        const auto size = static_cast<size_t>(stream.gcount());
+        stream.clear();
+        stream.seekg(pos);
+
+        if (ov::compact_ir::is_compact_ir(header, size)) {
+            return "ir";
+        }
+        // skip the UTF-8 BOM and the whitespaces before the XML declaration or the root element
+        size_t i = size >= 3 && std::memcmp(header, "\xEF\xBB\xBF", 3) == 0 ? 3 : 0;
+        while (i < size && std::isspace(static_cast<unsigned char>(header[i]))) {
+            ++i;
+        }
+        if (i < size && header[i] == '<') {
+            return "ir";
+        }
+        // ONNX ModelProto starts with the ir_version varint field, while the TensorFlow and PaddlePaddle protobufs
+        // start with the length-delimited fields
+        if (size > 0 && header[0] == '\x08') {
+            return "onnx";
+        }
+        return {};
+    }
+
+    FrontEnd::Ptr search_priority(const std::vector<ov::Any>& variants, std::set<const PluginInfo*>& checked) {
         // Map between file extension and suitable frontend
         static const std::map<std::string, FrontEndNames> priority_fe_extensions = {
             {".xml", {"ir", "ir"}},
@@ -154,17 +198,33 @@ private:
             model_path = ov::util::wstring_to_string(wpath);
 #endif
         }
+        std::string guessed_file_name;
         if (!model_path.empty()) {
             auto ext = ov::util::get_file_ext(model_path);
             auto it = priority_fe_extensions.find(ext);
             if (it != priority_fe_extensions.end()) {
                 // Priority FE is found by file extension, try this first
-                auto list_it = std::find(priority_list.begin(), priority_list.end(), it->second);
-                OPENVINO_ASSERT(list_it != priority_list.end(),
-                                "Internal error. Incorrect priority frontends configuration");
-                // Move frontend matched by extension (e.g. ".onnx") to the top of priority list
-                priority_list.splice(priority_list.begin(), priority_list, list_it);
+                guessed_file_name = it->second.file_name;
+            } else {
+                std::ifstream model_stream(model_path, std::ios::in | std::ios::binary);
+                if (model_stream.is_open()) {
+                    guessed_file_name = guess_by_header(model_stream);
+                }
             }
+        } else if (model_variant.is<std::istream*>()) {
+            guessed_file_name = guess_by_header(*model_variant.as<std::istream*>());
+        } else if (model_variant.is<std::istringstream*>()) {
+            guessed_file_name = guess_by_header(*model_variant.as<std::istringstream*>());
+        }
+        if (!guessed_file_name.empty()) {
+            auto list_it = std::find_if(priority_list.begin(), priority_list.end(), [&](const FrontEndNames& names) {
+                return names.file_name == guessed_file_name;
+            });
+            OPENVINO_ASSERT(list_it != priority_list.end(),
+                            "Internal error. Incorrect priority frontends configuration");
+            // Move frontend matched by extension (e.g. ".onnx") or by the model header to the top of priority list,
+            // so the other frontends aren't loaded when it supports the model
+            priority_list.splice(priority_list.begin(), priority_list, list_it);
         }
         for (const auto& priority_info : priority_list) {
             auto plugin_it = std::find_if(m_plugins.begin(), m_plugins.end(), [&priority_info](const PluginInfo& info) {
@@ -181,6 +241,7 @@ private:
                 }
             }
             // Plugin from priority list is loaded, create FrontEnd and check if it supports model loading
+            checked.insert(&plugin_info);
             auto fe = plugin_info.get_creator().m_creator();
             if (fe && fe->supported(variants)) {
                 // Priority FE (e.g. IR) is found and is suitable
@@ -0,0 +1,152 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compact_ir_reader.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "compact_ir.hpp"
+#include "ie_common.h"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+namespace {
+
+class CompactIRData {
+public:
+    CompactIRData(const char* data, size_t size) : m_data(data), m_size(size) {
+        if (!compact_ir::is_compact_ir(data, size))
+            IE_THROW() << "The data is not a compact IR";
+        std::memcpy(&m_header, data, sizeof(m_header));
+        if (m_header.format_version != compact_ir::format_version)
+            IE_THROW() << "Unsupported compact IR format version " << m_header.format_version;
+        check_section(m_header.string_offsets_offset, m_header.strings_count, sizeof(uint64_t));
+        check_section(m_header.nodes_offset, m_header.nodes_count, sizeof(compact_ir::Node));
+        check_section(m_header.attributes_offset, m_header.attributes_count, sizeof(compact_ir::Attribute));
+        if (m_header.nodes_count == 0)
+            IE_THROW() << "The compact IR has no nodes";
+
+        // the strings are between the offsets and the nodes
+        const uint64_t strings_begin = m_header.string_offsets_offset + m_header.strings_count * sizeof(uint64_t);
+        const uint64_t strings_end = m_header.nodes_offset;
+        if (strings_begin > strings_end)
+            IE_THROW() << "The compact IR strings are corrupted";
+        m_strings.reserve(m_header.strings_count);
+        for (uint64_t i = 0; i < m_header.strings_count; ++i) {
+            uint64_t offset = 0;
+            std::memcpy(&offset, m_data + m_header.string_offsets_offset + i * sizeof(uint64_t), sizeof(offset));
+            if (offset < strings_begin || offset >= strings_end ||
+                std::memchr(m_data + offset, '\0', strings_end - offset) == nullptr)
+                IE_THROW() << "The compact IR string " << i << " is corrupted";
+            m_strings.push_back(m_data + offset);
+        }
+    }
+
+    uint64_t nodes_count() const {
+        return m_header.nodes_count;
+    }
+
+    compact_ir::Node node(uint64_t index) const {
+        compact_ir::Node record;
+        std::memcpy(&record, m_data + m_header.nodes_offset + index * sizeof(record), sizeof(record));
+        if (record.name >= m_strings.size() ||
+            (record.type != compact_ir::NodeType::ELEMENT && record.type != compact_ir::NodeType::TEXT) ||
+            record.first_attribute > m_header.attributes_count ||
+            record.attributes_count > m_header.attributes_count - record.first_attribute)
+            IE_THROW() << "The compact IR node " << index << " is corrupted";
+        return record;
+    }
+
+    compact_ir::Attribute attribute(uint64_t index) const {
+        compact_ir::Attribute record;
+        std::memcpy(&record, m_data + m_header.attributes_offset + index * sizeof(record), sizeof(record));
+        if (record.name >= m_strings.size() || record.value >= m_strings.size())
+            IE_THROW() << "The compact IR attribute " << index << " is corrupted";
+        return record;
+    }
+
+    const char* string(uint32_t index) const {
+        return m_strings[index];
+    }
+
+private:
+    void check_section(uint64_t offset, uint64_t count, size_t record_size) const {
+        if (offset > m_size || count > (m_size - offset) / record_size)
+            IE_THROW() << "The compact IR is truncated";
+    }
+
+    const char* m_data;
+    size_t m_size;
+    compact_ir::Header m_header;
+    std::vector<const char*> m_strings;
+};
+
+}  // namespace
+
+bool is_compact_ir(std::istream& stream) {
+    char header[sizeof(compact_ir::Header)] = {};
+    const auto pos = stream.tellg();
+    stream.read(header, sizeof(header));
+    const auto read = static_cast<size_t>(stream.gcount());
+    stream.clear();
+    stream.seekg(pos);
+    return compact_ir::is_compact_ir(header, read);
+}
+
+void load_compact_ir(const char* data, size_t size, pugi::xml_document& xml_doc) {
+    const CompactIRData ir_data(data, size);
+
+    // the nodes are in the document order, so a parent and the previous siblings are always built before a node
+    const auto nodes_count = ir_data.nodes_count();
+    std::vector<uint64_t> parents(nodes_count, compact_ir::none);
+    std::vector<pugi::xml_node> xml_nodes(nodes_count);
+    for (uint64_t index = 0; index < nodes_count; ++index) {
+        const auto node = ir_data.node(index);
+        if (index != 0 && parents[index] == compact_ir::none)
+            IE_THROW() << "The compact IR node " << index << " has no parent";
+        auto parent = index == 0 ? static_cast<pugi::xml_node>(xml_doc) : xml_nodes[parents[index]];
+
+        if (node.type == compact_ir::NodeType::TEXT) {
+            if (node.first_child != compact_ir::none || node.attributes_count != 0)
+                IE_THROW() << "The compact IR text node " << index << " has children or attributes";
+            xml_nodes[index] = parent.append_child(pugi::node_pcdata);
+            xml_nodes[index].set_value(ir_data.string(node.name));
+            continue;
+        }
+
+        auto& xml_node = xml_nodes[index];
+        xml_node = parent.append_child(ir_data.string(node.name));
+        for (uint32_t i = 0; i < node.attributes_count; ++i) {
+            const auto attribute = ir_data.attribute(node.first_attribute + i);
+            xml_node.append_attribute(ir_data.string(attribute.name)).set_value(ir_data.string(attribute.value));
+        }
+        // the children follow the node and each other, so the links can't make a cycle
+        uint64_t previous = index;
+        for (auto child = node.first_child; child != compact_ir::none; child = ir_data.node(child).next_sibling) {
+            if (child <= previous || child >= nodes_count || parents[child] != compact_ir::none)
+                IE_THROW() << "The compact IR node " << index << " has corrupted children";
+            parents[child] = index;
+            previous = child;
+        }
+    }
+}
+
+void load_compact_ir(std::istream& stream, pugi::xml_document& xml_doc) {
+    const auto begin = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(begin);
+    if (begin < 0 || end < begin)
+        IE_THROW() << "The compact IR stream is not seekable";
+    std::vector<char> data(static_cast<size_t>(end - begin));
+    if (!stream.read(data.data(), data.size()))
+        IE_THROW() << "The compact IR stream can't be read";
+    load_compact_ir(data.data(), data.size(), xml_doc);
+}
+
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+
+#include "pugixml.hpp"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+
+/**
+ * @brief Checks whether the stream holds the compact IR, the stream position is kept
+ */
+bool is_compact_ir(std::istream& stream);
+
+/**
+ * @brief Builds the IR XML document from the compact IR data, throws if the data is corrupted
+ * @param data The compact IR data, it's read in place
+ * @param size The size of the data
+ * @param xml_doc The document to build
+ */
+void load_compact_ir(const char* data, size_t size, pugi::xml_document& xml_doc);
+
+/**
+ * @brief Builds the IR XML document from the compact IR stream, the stream is read to the end
+ */
+void load_compact_ir(std::istream& stream, pugi::xml_document& xml_doc);
+
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
@@ -4,17 +4,28 @@
 
 #include "openvino/frontend/ir/frontend.hpp"
 
+#include <sys/stat.h>
+#include <sys/types.h>
+
 #include <array>
+#include <cstring>
+#include <istream>
 #include <vector>
 
+#include "compact_ir.hpp"
 #include "input_model.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
+#ifdef _WIN32
+#    define stat _stat
+#endif
+
 using namespace ov;
 
 namespace ov {
@@ -22,6 +33,64 @@ namespace frontend {
 namespace ir {
 namespace {
 
+/**
+ * @brief Identifies the weights file by its path, size and modification time
+ * @param path Path to the weights file
+ * @return The identity, 0 if the file can't be identified
+ */
+uint64_t GetWeightsFileIdentity(const std::string& path) {
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) != 0)
+        return 0;
+    std::string abs_path = path;
+    try {
+        abs_path = ov::util::get_absolute_file_path(path);
+    } catch (...) {
+        // can't get absolute path, the path is used as is
+    }
+    uint64_t seed = std::hash<std::string>()(abs_path);
+    for (const auto value : {static_cast<uint64_t>(file_stat.st_size), static_cast<uint64_t>(file_stat.st_mtime)})
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed == 0 ? 1 : seed;
+}
+
+/**
+ * @brief Reads the weights stream from its current position to the end
+ * The size of a seekable stream is known upfront, so the data is read straight into the buffer the model owns,
+ * other streams (e.g. the ones receiving the model from network) are consumed chunk by chunk.
+ * @param stream Weights stream
+ * @return The buffer the constants of the model share, nullptr if the stream is empty
+ */
+std::shared_ptr<ngraph::runtime::AlignedBuffer> ReadWeights(std::istream& stream) {
+    const auto begin = stream.tellg();
+    if (begin != std::istream::pos_type(-1) && stream.seekg(0, std::ios::end)) {
+        const auto size = static_cast<size_t>(stream.tellg() - begin);
+        stream.seekg(begin);
+        if (size == 0)
+            return nullptr;
+        auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(size);
+        stream.read(buffer->get_ptr<char>(), size);
+        if (static_cast<size_t>(stream.gcount()) != size)
+            IE_THROW() << "Weights stream cannot be read!";
+        return buffer;
+    }
+    stream.clear();
+
+    constexpr size_t chunk_size = 1 << 20;
+    auto data = std::make_shared<std::vector<char>>();
+    while (stream) {
+        const auto size = data->size();
+        data->resize(size + chunk_size);
+        stream.read(data->data() + size, chunk_size);
+        data->resize(size + static_cast<size_t>(stream.gcount()));
+    }
+    if (data->empty())
+        return nullptr;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<std::vector<char>>>>(data->data(),
+                                                                                               data->size(),
+                                                                                               data);
+}
+
 inline size_t GetIRVersion(pugi::xml_node& root) {
     return XMLParseUtils::GetUIntAttr(root, "version", 0);
 }
@@ -36,9 +105,16 @@ size_t GetIRVersion(std::istream& model) {
 
     model.seekg(0, model.beg);
     model.read(header.data(), header.size());
+    const auto header_size = static_cast<size_t>(model.gcount());
     model.clear();
     model.seekg(0, model.beg);
 
+    if (compact_ir::is_compact_ir(header.data(), header_size)) {
+        compact_ir::Header compact_ir_header;
+        std::memcpy(&compact_ir_header, header.data(), sizeof(compact_ir_header));
+        return compact_ir_header.ir_version;
+    }
+
     pugi::xml_document doc;
     auto res =
         doc.load_buffer(header.data(), header.size(), pugi::parse_default | pugi::parse_fragment, pugi::encoding_utf8);
@@ -115,6 +191,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ngraph::runtime::AlignedBuffer> weights;
+    uint64_t weights_identity = 0;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -127,9 +204,13 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 
     auto create_input_model = [&]() -> std::shared_ptr<InputModel> {
         if (provided_model_stream) {
-            return std::make_shared<InputModel>(*provided_model_stream, weights, create_extensions_map());
+            return std::make_shared<InputModel>(*provided_model_stream,
+                                                weights,
+                                                create_extensions_map(),
+                                                weights_identity);
         } else if (local_model_stream.is_open()) {
-            auto input_model = std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map());
+            auto input_model =
+                std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map(), weights_identity);
             local_model_stream.close();
             return input_model;
         }
@@ -179,6 +260,8 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 #endif
         } else if (variant.is<std::shared_ptr<ngraph::runtime::AlignedBuffer>>()) {
             weights = variant.as<std::shared_ptr<ngraph::runtime::AlignedBuffer>>();
+        } else if (variant.is<std::istream*>()) {
+            weights = ReadWeights(*variant.as<std::istream*>());
         }
     }
 
@@ -199,27 +282,28 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
 
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
+        // Map the weights file instead of reading it: Constants created by the deserializer keep references
+        // into the mapping, so the data stays zero-copy and untouched pages are never loaded from disk
+        std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+        try {
+            mapped_memory = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception&) {
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
             IE_THROW() << "Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!";
 #else
             IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
 #endif
+        }
 
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
-
-        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped_memory->data(),
+            mapped_memory->size(),
+            mapped_memory);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+        weights_identity = GetWeightsFileIdentity(ov::util::wstring_to_string(weights_path));
+#else
+        weights_identity = GetWeightsFileIdentity(weights_path);
+#endif
     }
 
     return create_input_model();
@@ -6,6 +6,7 @@
 
 #include <xml_parse_utils.h>
 
+#include <compact_ir_reader.hpp>
 #include <ir_deserializer.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <openvino/op/util/framework_node.hpp>
@@ -190,6 +191,7 @@ namespace ir {
 
 class InputModel::InputModelIRImpl {
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_weights;
+    uint64_t m_weights_identity;
     std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> m_extensions;
     std::unordered_map<std::string, ngraph::OpSet> m_opsets;
     pugi::xml_node m_root;
@@ -198,12 +200,18 @@ class InputModel::InputModelIRImpl {
 public:
     InputModelIRImpl(std::istream& stream,
                      const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                     uint64_t weights_identity)
         : m_weights(weights),
+          m_weights_identity(weights_identity),
           m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
-        if (res.status != pugi::status_ok) {
-            IE_THROW() << res.description() << " at offset " << res.offset;
+        if (is_compact_ir(stream)) {
+            load_compact_ir(stream, m_xml_doc);
+        } else {
+            pugi::xml_parse_result res = m_xml_doc.load(stream);
+            if (res.status != pugi::status_ok) {
+                IE_THROW() << res.description() << " at offset " << res.offset;
+            }
         }
         m_root = m_xml_doc.document_element();
         m_opsets["opset1"] = ngraph::get_opset1();
@@ -221,8 +229,9 @@ public:
 
 InputModel::InputModel(std::istream& stream,
                        const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
-    _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                       uint64_t weights_identity) {
+    _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions, weights_identity);
 }
 
 std::shared_ptr<Function> InputModel::convert() {
@@ -238,6 +247,12 @@ std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
     std::shared_ptr<ngraph::Function> function;
     visitor.on_attribute("net", function);
     function->get_rt_info()["version"] = int64_t(version);
+    if (m_weights && m_weights_identity != 0) {
+        // The constants inside the read-only mapping are identified by the file and their offsets in it,
+        // so the compilation cache doesn't hash their data
+        function->get_rt_info()["weights_mapping"] =
+            std::vector<uint64_t>{reinterpret_cast<uint64_t>(m_weights->get_ptr()), m_weights->size(), m_weights_identity};
+    }
     ParsePreProcess(m_root, m_weights, function);
 
     return function;
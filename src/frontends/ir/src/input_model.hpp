@@ -21,9 +21,13 @@ class InputModel : public ov::frontend::InputModel {
     std::shared_ptr<InputModelIRImpl> _impl;
 
 public:
+    /**
+     * @param weights_identity The identity of the file the weights are mapped from, 0 if they aren't mapped
+     */
     InputModel(std::istream& stream,
                const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+               uint64_t weights_identity = 0);
 
     std::shared_ptr<Model> convert();
 };
@@ -4,10 +4,14 @@
 
 #include "core/graph.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
+#include <mutex>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "core/value_info.hpp"
 #include "default_opset.hpp"
@@ -51,6 +55,65 @@ static std::string get_op_domain_and_name(const ONNX_NAMESPACE::NodeProto& node_
     std::string domain = get_node_domain(node_proto);
     return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
 }
+
+/// \brief      Creates the Constant nodes of the named initializers.
+///
+/// \note       The initializers are decoded concurrently, the Constants are independent until
+///             they are connected to the graph, which is done sequentially by the caller.
+///
+/// \param[in]  initializer_tensors  The initializers of the graph.
+///
+/// \return     The Constants in the order of the initializers, nullptr for the unnamed ones.
+///
+template <typename Initializers>
+std::vector<std::shared_ptr<default_opset::Constant>> decode_initializers(const Initializers& initializer_tensors) {
+    const size_t num_initializers = initializer_tensors.size();
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(num_initializers);
+    std::atomic<size_t> next_initializer{0};
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    auto decode = [&]() {
+        for (size_t i = next_initializer++; i < num_initializers; i = next_initializer++) {
+            const auto& initializer_tensor = initializer_tensors.Get(static_cast<int>(i));
+            if (!initializer_tensor.has_name()) {
+                continue;
+            }
+            try {
+                Tensor tensor = Tensor{initializer_tensor};
+                // For each initializer create a Constant node
+                try {
+                    ng_constants[i] = tensor.get_ng_constant();
+                } catch (const error::invalid_external_data&) {
+                    // invalid external data makes initializers creation impossible
+                    throw;
+                } catch (const ngraph::ngraph_error&) {
+                    ng_constants[i] = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{exception_mutex};
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+                next_initializer = num_initializers;
+            }
+        }
+    };
+
+    const size_t num_threads =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), num_initializers);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i) {
+        threads.emplace_back(decode);
+    }
+    decode();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return ng_constants;
+}
 }  // namespace detail
 
 Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto, ov::frontend::ExtensionHolder extensions)
@@ -65,23 +128,14 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
     std::map<std::string, Tensor> initializers;
 
     // Process all initializers in the graph
-    for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
+    const auto& initializer_tensors = m_model->get_graph().initializer();
+    auto ng_constants = detail::decode_initializers(initializer_tensors);
+    for (int i = 0; i < initializer_tensors.size(); ++i) {
+        const auto& initializer_tensor = initializer_tensors.Get(i);
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ng_constant = tensor.get_ng_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ngraph::ngraph_error&) {
-                ng_constant = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
-            }
-
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+            initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor});
+            ng_constants[i]->get_output_tensor(0).set_names({initializer_tensor.name()});
+            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constants[i]));
         }
     }
 
@@ -13,6 +13,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "exceptions.hpp"
 #include "onnx_common/utils.hpp"
 #include "utils/common.hpp"
 #include "utils/tensor_external_data.hpp"
@@ -70,10 +71,15 @@ inline std::vector<T> __get_data(const Container& container) {
 #endif
 }
 
+template <typename T>
+inline std::vector<T> __get_raw_data(const char* raw_data, size_t size, int onnx_data_type) {
+    auto it = reinterpret_cast<const T*>(raw_data);
+    return std::vector<T>(it, it + (size / onnx_common::get_onnx_data_size(onnx_data_type)));
+}
+
 template <typename T>
 inline std::vector<T> __get_raw_data(const std::string& raw_data, int onnx_data_type) {
-    auto it = reinterpret_cast<const T*>(raw_data.data());
-    return std::vector<T>(it, it + (raw_data.size() / onnx_common::get_onnx_data_size(onnx_data_type)));
+    return __get_raw_data<T>(raw_data.data(), raw_data.size(), onnx_data_type);
 }
 
 template <typename T>
@@ -81,7 +87,7 @@ inline std::vector<T> get_external_data(const ONNX_NAMESPACE::TensorProto& tenso
     const auto tensor_external_data = TensorExternalData(tensor);
     const auto raw_data = tensor_external_data.load_external_data();
 
-    return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+    return detail::__get_raw_data<T>(raw_data->get_ptr<char>(), raw_data->size(), tensor.data_type());
 }
 
 bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
@@ -459,7 +465,18 @@ public:
 private:
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto) && !m_tensor_proto->has_segment()) {
+            // the external data is laid out the way the constant stores it, so the constant refers to the mapped file
+            const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+            auto raw_data = tensor_external_data.load_external_data();
+            if (raw_data->size() < shape_size(m_shape) * type.size()) {
+                throw error::invalid_external_data{tensor_external_data};
+            }
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, raw_data);
+        } else {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
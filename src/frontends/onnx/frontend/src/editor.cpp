@@ -207,17 +207,14 @@ struct onnx_editor::ONNXModelEditor::Impl {
     Impl() = delete;
 
     Impl(const std::string& model_path)
-        : m_model_proto{
-              std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
+        : m_model_proto{ngraph::onnx_common::parse_from_file(model_path)} {}
 
     Impl(std::istream& model_stream)
-        : m_model_proto{
-              std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_istream(model_stream))} {}
+        : m_model_proto{ngraph::onnx_common::parse_from_istream(model_stream)} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     Impl(const std::wstring& model_path)
-        : m_model_proto{
-              std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
+        : m_model_proto{ngraph::onnx_common::parse_from_file(model_path)} {}
 #endif
 };
 
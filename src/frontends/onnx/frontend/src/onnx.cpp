@@ -17,19 +17,20 @@
 namespace ngraph {
 namespace onnx_import {
 std::shared_ptr<Function> import_onnx_model(std::istream& stream, const std::string& model_path) {
-    auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(onnx_common::parse_from_istream(stream));
+    auto model_proto = onnx_common::parse_from_istream(stream);
     return detail::import_onnx_model(model_proto, model_path);
 }
 
 std::shared_ptr<Function> import_onnx_model(const std::string& file_path) {
-    std::ifstream model_stream{file_path, std::ios::in | std::ios::binary};
-
-    if (!model_stream.is_open()) {
-        throw ngraph_error("Error during import of ONNX model expected to be in file: " + file_path +
-                           ". Could not open the file.");
-    };
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto;
+    try {
+        model_proto = onnx_common::parse_from_file(file_path);
+    } catch (const ngraph_error& error) {
+        throw ngraph_error("Error during import of ONNX model expected to be in file: " + file_path + ". " +
+                           error.what());
+    }
 
-    return import_onnx_model(model_stream, file_path);
+    return detail::import_onnx_model(model_proto, file_path);
 }
 
 std::set<std::string> get_supported_operators(std::int64_t version, const std::string& domain) {
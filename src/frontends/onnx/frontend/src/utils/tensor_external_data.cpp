@@ -4,7 +4,8 @@
 
 #include "utils/tensor_external_data.hpp"
 
-#include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -28,7 +29,27 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     }
 }
 
-std::string TensorExternalData::load_external_data() const {
+namespace {
+template <typename Path>
+std::shared_ptr<ov::util::MappedMemory> load_mapped_file(const Path& path) {
+    // the mappings are shared by the tensors of the file, the file is unmapped with the last of them
+    static std::mutex mutex;
+    static std::map<Path, std::weak_ptr<ov::util::MappedMemory>> mapped_files;
+    std::lock_guard<std::mutex> lock{mutex};
+    auto& mapped_file = mapped_files[path];
+    auto mapped_memory = mapped_file.lock();
+    if (!mapped_memory) {
+        for (auto it = mapped_files.begin(); it != mapped_files.end();) {
+            it = it->second.expired() && it->first != path ? mapped_files.erase(it) : std::next(it);
+        }
+        mapped_memory = ov::util::load_mmap_object(path);
+        mapped_file = mapped_memory;
+    }
+    return mapped_memory;
+}
+}  // namespace
+
+TensorExternalData::Buffer TensorExternalData::load_external_data() const {
     NGRAPH_SUPPRESS_DEPRECATED_START
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::wstring path = ov::util::string_to_wstring(m_data_location);
@@ -36,35 +57,32 @@ std::string TensorExternalData::load_external_data() const {
     std::string path = m_data_location;
 #endif
     NGRAPH_SUPPRESS_DEPRECATED_END
-    std::ifstream external_data_stream(path, std::ios::binary | std::ios::in | std::ios::ate);
-    if (external_data_stream.fail())
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    try {
+        mapped_memory = load_mapped_file(path);
+    } catch (const std::exception&) {
         throw error::invalid_external_data{*this};
+    }
 
-    std::streamsize read_data_length;
+    // default value of m_offset is 0
+    if (m_offset < 0 || m_data_length < 0 || static_cast<size_t>(m_offset) > mapped_memory->size())
+        throw error::invalid_external_data{*this};
+    size_t read_data_length;
     if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
+        read_data_length = mapped_memory->size() - m_offset;
     else
         read_data_length = m_data_length;
-
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
-    // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
+    if (read_data_length > mapped_memory->size() - m_offset)
+        throw error::invalid_external_data{*this};
 
     if (m_sha1_digest != 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
-
-    return read_data;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        read_data_length,
+        mapped_memory);
 }
 
 std::string TensorExternalData::to_string() const {
@@ -6,22 +6,28 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
+    using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>;
+
     TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
+    /// \note       The external file is mapped into memory once and shared by all
+    ///             the tensors stored in it while any of their buffers is alive.
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data() const;
+    /// \return     External binary data as a view into the mapped file
+    Buffer load_external_data() const;
 
     /// \brief      Represets parameter of external data as string
     ///
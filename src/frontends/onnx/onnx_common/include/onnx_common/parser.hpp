@@ -4,6 +4,7 @@
 
 #pragma once
 #include <fstream>
+#include <memory>
 #include <string>
 
 /// \ingroup ngraph_cpp_api
@@ -15,20 +16,24 @@ namespace ngraph {
 namespace onnx_common {
 /// \brief   Parses an ONNX model from a file located on a storage device.
 ///
+/// \note    The file is mapped into memory and parsed in place.
+///
 /// \param   file_path    Path to the file containing an ONNX model.
 ///
-/// \return  The parsed in-memory representation of the ONNX model
-ONNX_NAMESPACE::ModelProto parse_from_file(const std::string& file_path);
+/// \return  The parsed in-memory representation of the ONNX model, its messages are allocated on
+///          a protobuf arena which is released together with the returned pointer
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_file(const std::string& file_path);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-ONNX_NAMESPACE::ModelProto parse_from_file(const std::wstring& file_path);
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_file(const std::wstring& file_path);
 #endif
 
 /// \brief   Parses an ONNX model from a stream (representing for example a file)
 ///
 /// \param   model_stream  Path to the file containing an ONNX model.
 ///
-/// \return  The parsed in-memory representation of the ONNX model
-ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream);
+/// \return  The parsed in-memory representation of the ONNX model, its messages are allocated on
+///          a protobuf arena which is released together with the returned pointer
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_istream(std::istream& model_stream);
 }  // namespace onnx_common
 
 }  // namespace ngraph
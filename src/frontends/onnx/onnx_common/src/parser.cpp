@@ -4,45 +4,69 @@
 
 #include "onnx_common/parser.hpp"
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
 #include <onnx/onnx_pb.h>
 
+#include <limits>
 #include <ngraph/file_util.hpp>
 
 #include "ngraph/except.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ngraph {
 namespace onnx_common {
-ONNX_NAMESPACE::ModelProto parse_from_file(const std::string& file_path) {
-    std::ifstream file_stream{file_path, std::ios::in | std::ios::binary};
+namespace {
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> create_model_proto() {
+    // the messages of the model are allocated in the blocks of the arena and released all at once with it,
+    // the returned pointer shares the ownership of the arena
+    auto arena = std::make_shared<google::protobuf::Arena>();
+    const auto model_proto = google::protobuf::Arena::CreateMessage<ONNX_NAMESPACE::ModelProto>(arena.get());
+    return std::shared_ptr<ONNX_NAMESPACE::ModelProto>(arena, model_proto);
+}
 
-    if (!file_stream.is_open()) {
-        throw ngraph_error("Could not open the file: " + file_path);
-    };
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_mapped_memory(ov::util::MappedMemory& mapped_memory) {
+    if (mapped_memory.size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw ngraph_error("Error during import of ONNX model: the binary protobuf message exceeds 2GB.");
+    }
 
-    auto model_proto = parse_from_istream(file_stream);
-    file_stream.close();
+    auto model_proto = create_model_proto();
+    if (!model_proto->ParseFromArray(mapped_memory.data(), static_cast<int>(mapped_memory.size()))) {
+        throw ngraph_error("Error during import of ONNX model provided as file "
+                           " with binary protobuf message.");
+    }
     return model_proto;
 }
+}  // namespace
 
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-ONNX_NAMESPACE::ModelProto parse_from_file(const std::wstring& file_path) {
-    std::ifstream file_stream{file_path, std::ios::in | std::ios::binary};
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_file(const std::string& file_path) {
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    try {
+        mapped_memory = ov::util::load_mmap_object(file_path);
+    } catch (const std::exception&) {
+        throw ngraph_error("Could not open the file: " + file_path);
+    }
+
+    return parse_from_mapped_memory(*mapped_memory);
+}
 
-    if (!file_stream.is_open()) {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_file(const std::wstring& file_path) {
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    try {
+        mapped_memory = ov::util::load_mmap_object(file_path);
+    } catch (const std::exception&) {
         NGRAPH_SUPPRESS_DEPRECATED_START
         throw ngraph_error("Could not open the file: " + file_util::wstring_to_string(file_path));
         NGRAPH_SUPPRESS_DEPRECATED_END
-    };
+    }
 
-    auto model_proto = parse_from_istream(file_stream);
-    file_stream.close();
-    return model_proto;
+    return parse_from_mapped_memory(*mapped_memory);
 }
 #endif
 
-ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream) {
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_istream(std::istream& model_stream) {
     if (!model_stream.good()) {
         model_stream.clear();
         model_stream.seekg(0);
@@ -51,8 +75,8 @@ ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream) {
         }
     }
 
-    ONNX_NAMESPACE::ModelProto model_proto;
-    if (!model_proto.ParseFromIstream(&model_stream)) {
+    auto model_proto = create_model_proto();
+    if (!model_proto->ParseFromIstream(&model_stream)) {
         throw ngraph_error("Error during import of ONNX model provided as input stream "
                            " with binary protobuf message.");
     }
@@ -4,15 +4,18 @@
 
 #include "input_model.hpp"
 
+#include <cstring>
 #include <fstream>
 #include <queue>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -60,6 +63,8 @@ private:
     void loadPlaces();
     template <typename T>
     void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::shared_ptr<ov::util::MappedMemory>& weights);
+    std::vector<std::pair<std::string, std::shared_ptr<TensorPlace>>> getConstPlaces() const;
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
@@ -179,16 +184,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_path) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = path;
+        weights_path->replace(weights_path->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -197,16 +199,14 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_path) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = path;
+        weights_path->replace(weights_path->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -261,9 +261,9 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
     return new_op_places;
 }
 
-template <typename T>
-void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                            std::istream* weight_stream) {
+std::vector<std::pair<std::string, std::shared_ptr<TensorPlace>>> InputModel::InputModelImpl::getConstPlaces() const {
+    // the map is ordered by the names, which is the order Paddle saves the combined params file in
+    std::vector<std::pair<std::string, std::shared_ptr<TensorPlace>>> const_places;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -273,19 +273,30 @@ void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_w
             continue;
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
-        const auto& tensor = var_desc.type().lod_tensor().tensor();
+        const_places.emplace_back(name, item.second);
+    }
+    return const_places;
+}
+
+template <typename T>
+void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
+                                            std::istream* weight_stream) {
+    for (const auto& item : getConstPlaces()) {
+        const auto& name = item.first;
+        const auto& tensor = item.second->get_desc().type().lod_tensor().tensor();
         Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
         const auto& type = TYPE_MAP[tensor.data_type()];
         const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
+        // the data is read straight to the buffer the constant owns
+        auto tensor_data = std::make_shared<ngraph::runtime::AlignedBuffer>(data_length);
 
         bool read_succeed = false;
         if (weight_stream) {
-            read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+            read_succeed = read_tensor(*weight_stream, tensor_data->get_ptr<char>(), data_length);
         } else if (!folder_with_weights.empty()) {
             std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
             FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+            read_succeed = read_tensor(is, tensor_data->get_ptr<char>(), data_length);
         } else {
             FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
         }
@@ -294,7 +305,52 @@ void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_w
                                 name,
                                 " wasn't successfully read.");
 
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
+        auto const_node = std::make_shared<opset7::Constant>(
+            type,
+            shape,
+            std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                tensor_data->get_ptr<char>(),
+                data_length,
+                tensor_data));
+        const_node->set_friendly_name(name);
+        m_tensor_values[name] = const_node;
+    }
+}
+
+void InputModel::InputModelImpl::loadConsts(const std::shared_ptr<ov::util::MappedMemory>& weights) {
+    // The tensors are stored one after another in the combined params file and are kept in the mapping:
+    // the constants reference their data there, so nothing is copied and untouched pages are never loaded
+    char* data = weights->data();
+    const size_t size = weights->size();
+    size_t offset = 0;
+    for (const auto& item : getConstPlaces()) {
+        const auto& name = item.first;
+        const auto& tensor = item.second->get_desc().type().lod_tensor().tensor();
+        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
+        const auto& type = TYPE_MAP[tensor.data_type()];
+        const auto& data_length = shape_size(shape) * type.size();
+
+        // the tensor header is followed by the size of the tensor description and the description itself
+        uint32_t dims_len = 0;
+        FRONT_END_GENERAL_CHECK(size >= offset + 16 + sizeof(dims_len),
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+        std::memcpy(&dims_len, data + offset + 16, sizeof(dims_len));
+        offset += 16 + sizeof(dims_len) + dims_len;
+        FRONT_END_GENERAL_CHECK(size >= offset && size - offset >= data_length,
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+
+        auto const_node = std::make_shared<opset7::Constant>(
+            type,
+            shape,
+            std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                data + offset,
+                data_length,
+                weights));
+        offset += data_length;
         const_node->set_friendly_name(name);
         m_tensor_values[name] = const_node;
     }
@@ -308,8 +364,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
       m_input_model(input_model),
       m_telemetry(telemetry) {
     std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_path), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -322,8 +378,17 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
-        loadConsts(std::basic_string<T>{}, &weights_stream);
+    std::shared_ptr<ov::util::MappedMemory> weights;
+    if (!weights_path.empty()) {
+        try {
+            weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception&) {
+            // Don't throw error if file isn't opened
+            // It may mean that model don't have constants
+        }
+    }
+    if (weights) {
+        loadConsts(weights);
     } else {
         loadConsts(path, nullptr);
     }
@@ -28,39 +28,44 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
 }  // namespace
 
 ov::Any DecoderProto::get_native_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
-        return {};
-    }
+    const auto& attr = decode_attribute_helper(name);
 
-    switch (attrs[0].value_case()) {
+    switch (attr.value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kTensor:
-        return attrs[0].tensor();
+        return attr.tensor();
     case ::tensorflow::AttrValue::ValueCase::kType:
-        return attrs[0].type();
+        return attr.type();
     default:
         FRONT_END_GENERAL_CHECK(false, "DataType is not covered.");
     }
 }
 
+const ::tensorflow::TensorProto& DecoderProto::get_tensor_attribute(const std::string& name) const {
+    const auto& attr = decode_attribute_helper(name);
+    FRONT_END_GENERAL_CHECK(attr.value_case() == ::tensorflow::AttrValue::ValueCase::kTensor,
+                            "The ",
+                            name,
+                            " attribute of ",
+                            get_op_type(),
+                            " node is not a tensor");
+    return attr.tensor();
+}
+
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
-        return {};
-    }
+    const auto& attr = decode_attribute_helper(name);
 
-    switch (attrs[0].value_case()) {
+    switch (attr.value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr.b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr.f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr.s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr.i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
         std::vector<ov::Dimension> dims;
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr.shape();
         for (int i = 0; i < tf_shape.dim_size(); i++) {
             dims.emplace_back(tf_shape.dim(i).size());
         }
@@ -68,10 +73,10 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType:
-        return TYPE_MAP().at(attrs[0].type());
+        return TYPE_MAP().at(attr.type());
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr.list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -163,16 +168,16 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    FRONT_END_GENERAL_CHECK(attr_map.contains(name),
+const ::tensorflow::AttrValue& DecoderProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    const auto attr_it = attr_map.find(name);
+    FRONT_END_GENERAL_CHECK(attr_it != attr_map.end(),
                             "An error occurred while parsing the ",
                             name,
                             " attribute of ",
                             this->get_op_type(),
                             "node");
-    auto value = m_node_def->attr().at(name);
-    return {value};
+    return attr_it->second;
 }
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,6 +4,9 @@
 
 #include "openvino/frontend/tensorflow/frontend.hpp"
 
+#include <atomic>
+#include <thread>
+
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/frontend/tensorflow/extension/conversion.hpp"
@@ -38,6 +41,59 @@ void translate_framework_node(const std::shared_ptr<FrameworkNode>& node,
         old_output->replace(*new_output);
     }
 }
+
+// Translates the Const operations concurrently: they don't depend on other operations and are the most of the
+// conversion time of the frozen graphs with large constants. The operations which fail to translate are skipped,
+// the sequential translation handles them
+std::unordered_map<std::string, ov::OutputVector> translate_consts(
+    const std::vector<std::shared_ptr<OpPlace>>& operation_places,
+    const std::map<const std::string, const std::function<ov::OutputVector(const NodeContext&)>>& translate_map) {
+    std::unordered_map<std::string, ov::OutputVector> translated_consts;
+    // a Const translator set by an extension isn't known to be thread-safe
+    const auto translator_it = translate_map.find("Const");
+    if (translator_it == translate_map.end())
+        return translated_consts;
+    using Translator = ov::OutputVector (*)(const NodeContext&);
+    const auto translator = translator_it->second.target<Translator>();
+    if (!translator || *translator != &ov::frontend::tensorflow::op::translate_const_op)
+        return translated_consts;
+
+    std::vector<std::pair<std::string, std::shared_ptr<DecoderBase>>> consts;
+    for (const auto& operation_place : operation_places) {
+        auto operation_decoder = operation_place->get_decoder();
+        if (operation_decoder->get_op_type() == "Const" && operation_decoder->get_input_size() == 0)
+            consts.emplace_back(operation_place->get_names()[0], operation_decoder);
+    }
+
+    std::vector<ov::OutputVector> const_outputs(consts.size());
+    std::atomic<size_t> next_const{0};
+    const ov::OutputVector no_inputs;
+    auto translate = [&]() {
+        for (size_t i = next_const++; i < consts.size(); i = next_const++) {
+            try {
+                NodeContext node_context(*consts[i].second, no_inputs);
+                const_outputs[i] = ov::frontend::tensorflow::op::translate_const_op(node_context);
+            } catch (...) {
+                const_outputs[i].clear();
+            }
+        }
+    };
+    const size_t num_threads = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), consts.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i) {
+        threads.emplace_back(translate);
+    }
+    translate();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < consts.size(); ++i) {
+        if (!const_outputs[i].empty())
+            translated_consts.emplace(consts[i].first, std::move(const_outputs[i]));
+    }
+    return translated_consts;
+}
 }  // namespace
 
 FrontEnd::FrontEnd() : m_op_translators(tensorflow::op::get_supported_ops()) {}
@@ -96,6 +152,8 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         ng_op_map[input_name] = {param};
     }
 
+    const auto translated_consts = translate_consts(operation_places, translate_map);
+
     // create the OV ops from TensorFlow ops
     for (const auto& operation_place : operation_places) {
         auto operation_decoder = operation_place->get_decoder();
@@ -150,25 +208,30 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
 
         // generate OV node output vector for the current operation node
         ov::OutputVector ng_outputs;
-        try {
-            FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
-                                          "No translator found for " + operation_decoder->get_op_type() + " node.");
-            auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
-            // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
-            // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
-            NodeContext node_context(*operation_decoder, ng_inputs);
-            // generate OV node output vector using translator for given operation type
-            ng_outputs = (*op_fun)(node_context);
-        } catch (...) {
-            if (fail_fast) {
-                // re-throw any exception
-                throw;
-            } else {
-                auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
-                                                               ng_inputs,
-                                                               operation_place->get_output_ports().size());
-                set_node_name(operation_name, ng_node);
-                ng_outputs = ng_node->outputs();
+        const auto translated_const = translated_consts.find(operation_name);
+        if (translated_const != translated_consts.end()) {
+            ng_outputs = translated_const->second;
+        } else {
+            try {
+                FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
+                                              "No translator found for " + operation_decoder->get_op_type() + " node.");
+                auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
+                // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
+                // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
+                NodeContext node_context(*operation_decoder, ng_inputs);
+                // generate OV node output vector using translator for given operation type
+                ng_outputs = (*op_fun)(node_context);
+            } catch (...) {
+                if (fail_fast) {
+                    // re-throw any exception
+                    throw;
+                } else {
+                    auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
+                                                                   ng_inputs,
+                                                                   operation_place->get_output_ports().size());
+                    set_node_name(operation_name, ng_node);
+                    ng_outputs = ng_node->outputs();
+                }
             }
         }
 
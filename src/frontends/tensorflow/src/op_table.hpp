@@ -19,6 +19,8 @@ namespace tensorflow {
 namespace op {
 
 const std::map<std::string, CreatorFunction> get_supported_ops();
+
+OutputVector translate_const_op(const NodeContext& node);
 }  // namespace op
 }  // namespace tensorflow
 }  // namespace frontend
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "graph_iterator_proto.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "openvino/opsets/opset8.hpp"
@@ -99,14 +100,14 @@ void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_sha
     //  approaches should work the same way.
     // auto tensor_proto = decoder->get_native_attribute("value").as<::tensorflow::TensorProto>();
     auto value = decoder->get_native_attribute("value");
-    auto tensor_proto = value.as<::tensorflow::TensorProto>();
+    const auto& tensor_proto = value.as<::tensorflow::TensorProto>();
 
     const ::tensorflow::TensorShapeProto& shape = tensor_proto.tensor_shape();
     ov::PartialShape pshape;
     tf_shape_to_ov_shape(shape, &pshape);
     *const_tensor_shape = pshape.get_shape();
     TENSORFLOW_OP_VALIDATION(node, pshape.is_static(), "Dynamic shapes are not supported in Constant conversion.");
-    auto tensor_content = tensor_proto.tensor_content();
+    const auto& tensor_content = tensor_proto.tensor_content();
     std::vector<char> tensor_values_plain(tensor_content.begin(), tensor_content.end());
     const T* tensor_values = reinterpret_cast<const T*>(tensor_values_plain.data());
 
@@ -188,8 +189,40 @@ void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_sha
     }
 }
 
+// Creates the Constant referring to the Const tensor content in the graph without copying it, returns nullptr if the
+// content can't be referred to: the graph isn't owned by the decoder, the values are kept in the typed fields or
+// the content isn't aligned for T
+template <typename T>
+std::shared_ptr<ov::opset8::Constant> make_shared_const_op(const NodeContext& node, element::Type et) {
+    const auto* decoder = dynamic_cast<const DecoderProto*>(node.get_decoder());
+    if (!decoder || !decoder->get_graph_def())
+        return nullptr;
+    const auto& tensor_proto = decoder->get_tensor_attribute("value");
+    const auto& tensor_content = tensor_proto.tensor_content();
+    if (tensor_content.empty() || !tensor_proto.has_tensor_shape() ||
+        reinterpret_cast<uintptr_t>(tensor_content.data()) % alignof(T) != 0)
+        return nullptr;
+    ov::PartialShape pshape;
+    tf_shape_to_ov_shape(tensor_proto.tensor_shape(), &pshape);
+    if (pshape.is_dynamic() || shape_size(pshape.get_shape()) * sizeof(T) != tensor_content.size())
+        return nullptr;
+
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<::tensorflow::GraphDef>>>(
+        const_cast<char*>(tensor_content.data()),
+        tensor_content.size(),
+        decoder->get_graph_def());
+    return std::make_shared<ov::opset8::Constant>(et, pshape.get_shape(), buffer);
+}
+
 template <typename T, typename VecT = T>
 void make_const_op(const NodeContext& node, element::Type et, ov::Output<ov::Node>& ng_node) {
+    if (sizeof(T) == sizeof(VecT) && node.get_op_type() == "Const") {
+        if (auto shared_const = make_shared_const_op<T>(node, et)) {
+            ng_node = shared_const;
+            return;
+        }
+    }
+
     std::vector<VecT> const_values;
     ov::Shape ng_shape;
 
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "threading/ie_cpu_streams_executor.hpp"
 #include "threading/ie_immediate_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
@@ -93,6 +94,8 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
                                _futures.end());
                 _promise = {};
                 _futures.emplace_back(_promise.get_future().share());
+                _deadline = _timeout.count() ? std::chrono::steady_clock::now() + _timeout
+                                             : CPUStreamsExecutor::Deadline::max();
             } break;
             case InferState::Stop:
                 break;
@@ -259,6 +262,26 @@ public:
         return _syncRequest->GetBlob(name);
     }
 
+    void SetInputBlob(size_t idx, const Blob::Ptr& data) override {
+        CheckState();
+        _syncRequest->SetInputBlob(idx, data);
+    }
+
+    void SetOutputBlob(size_t idx, const Blob::Ptr& data) override {
+        CheckState();
+        _syncRequest->SetOutputBlob(idx, data);
+    }
+
+    Blob::Ptr GetInputBlob(size_t idx) override {
+        CheckState();
+        return _syncRequest->GetInputBlob(idx);
+    }
+
+    Blob::Ptr GetOutputBlob(size_t idx) override {
+        CheckState();
+        return _syncRequest->GetOutputBlob(idx);
+    }
+
     const PreProcessInfo& GetPreProcess(const std::string& name) const override {
         return _syncRequest->GetPreProcess(name);
     }
@@ -292,10 +315,16 @@ public:
         }
     }
 
+    void SetScheduling(bool latencySensitive, std::chrono::microseconds timeout, bool dropExpired) override {
+        CheckState();
+        _priority = latencySensitive ? CPUStreamsExecutor::Priority::LATENCY : CPUStreamsExecutor::Priority::BATCH;
+        _timeout = timeout;
+        _dropExpired = dropExpired && timeout.count();
+    }
+
     void setModelInputsOutputs(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                const std::vector<std::shared_ptr<const ov::Node>>& outputs) override {
-        _parameters = inputs;
-        _results = outputs;
+        IInferRequestInternal::setModelInputsOutputs(inputs, outputs);
         _syncRequest->setModelInputsOutputs(inputs, outputs);
     }
 
@@ -322,7 +351,7 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        RunStage(firstStageExecutor, MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
     }
 
     /**
@@ -381,6 +410,20 @@ protected:
     }
 
 private:
+    /**
+     * @brief Runs the stage task with the request priority and deadline if the executor supports them
+     * @param[in]  executor The stage executor
+     * @param[in]  task The stage task
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor, Task task) {
+        auto streamsExecutor = dynamic_cast<CPUStreamsExecutor*>(executor.get());
+        if (nullptr != streamsExecutor) {
+            streamsExecutor->run(std::move(task), _priority, _deadline);
+        } else {
+            executor->run(std::move(task));
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -402,6 +445,9 @@ private:
                 auto& thisStage = *itStage;
                 auto itNextStage = itStage + 1;
                 try {
+                    if (_dropExpired && std::chrono::steady_clock::now() > _deadline) {
+                        IE_THROW(InferCancelled) << "The inference request deadline is expired";
+                    }
                     auto& stageTask = std::get<Stage_e::task>(thisStage);
                     IE_ASSERT(nullptr != stageTask);
                     stageTask();
@@ -409,7 +455,8 @@ private:
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                         IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                        RunStage(nextStageExecutor,
+                                 MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
                     }
                 } catch (...) {
                     currentException = std::current_exception();
@@ -456,5 +503,10 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    // the scheduling of the request stages on the streams executors, the deadline is set on the inference start
+    CPUStreamsExecutor::Priority _priority = CPUStreamsExecutor::Priority::BATCH;
+    std::chrono::microseconds _timeout{0};
+    bool _dropExpired = false;
+    CPUStreamsExecutor::Deadline _deadline = CPUStreamsExecutor::Deadline::max();
 };
 }  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -71,6 +72,14 @@ public:
      */
     virtual void Cancel();
 
+    /**
+     * @brief Sets the priority and the deadline the next inferences of the request are scheduled with
+     * @param latencySensitive The inference stages are executed before the queued stages of the other requests
+     * @param timeout The deadline of the inference counted from its start, zero means no deadline
+     * @param dropExpired The inference whose stage isn't started before the deadline is cancelled
+     */
+    virtual void SetScheduling(bool latencySensitive, std::chrono::microseconds timeout, bool dropExpired);
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming layer.
      *  Note: not all plugins may provide meaningful data
@@ -129,6 +138,42 @@ public:
      */
     virtual BatchedBlob::Ptr GetBlobs(const std::string& name);
 
+    /**
+     * @brief Sets input data to infer by the index of the input in GetInputs()
+     * @note The default implementation calls SetBlob() with the name of the input resolved once the model inputs are
+     * set. Plugins may override it to skip the name lookups of SetBlob() as well.
+     * @param idx - an index of the input.
+     * @param data - a reference to input blob.
+     */
+    virtual void SetInputBlob(size_t idx, const Blob::Ptr& data);
+
+    /**
+     * @brief Sets output data by the index of the output in GetOutputs()
+     * @note The default implementation calls SetBlob() with the name of the output resolved once the model outputs
+     * are set.
+     * @param idx - an index of the output.
+     * @param data - a reference to output blob.
+     */
+    virtual void SetOutputBlob(size_t idx, const Blob::Ptr& data);
+
+    /**
+     * @brief Gets input data to infer by the index of the input in GetInputs()
+     * @note The default implementation calls GetBlob() with the name of the input resolved once the model inputs are
+     * set. Plugins may override it to access the blob without the name lookups of GetBlob().
+     * @param idx - an index of the input.
+     * @return A reference to input blob.
+     */
+    virtual Blob::Ptr GetInputBlob(size_t idx);
+
+    /**
+     * @brief Gets output data by the index of the output in GetOutputs()
+     * @note The default implementation calls GetBlob() with the name of the output resolved once the model outputs
+     * are set.
+     * @param idx - an index of the output.
+     * @return A reference to output blob.
+     */
+    virtual Blob::Ptr GetOutputBlob(size_t idx);
+
     /**
      * @brief Sets pre-process for input data
      * @param name Name of input blob.
@@ -329,6 +374,8 @@ protected:
     InferenceEngine::BlobMap _outputs;                //!< A map of user passed blobs for network outputs
     std::vector<std::shared_ptr<const ov::Node>> _parameters;  //!< A vector of function inputs
     std::vector<std::shared_ptr<const ov::Node>> _results;     //!< A vector of function outputs
+    std::vector<std::string> _parameterNames;                  //!< Blob names of function inputs by their indices
+    std::vector<std::string> _resultNames;                     //!< Blob names of function outputs by their indices
     std::map<std::string, PreProcessDataPtr> _preProcData;     //!< A map of pre-process data per input
     std::map<std::string, BatchedBlob::Ptr> _batched_inputs;   //!< A map of user passed blobs for network inputs
     int m_curBatch = -1;                                       //!< Current batch value used in dynamic batching
@@ -74,6 +74,323 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables the CPU runtime parameters cache shared between all the streams and compiled models of the plugin
+ * instance (YES/NO). The limits of the shared cache are the plugin ones, i.e. CPU_RUNTIME_CACHE_CAPACITY and
+ * CPU_RUNTIME_CACHE_SHARED_BYTES set for the plugin rather than for the compiled model, so all the models sharing the
+ * cache see the same limits regardless of the compilation order. The models compiled after the plugin limits are
+ * changed share a new cache
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARED);
+
+/**
+ * @brief Defines the memory budget in bytes of the shared CPU runtime parameters cache per CPU runtime parameter type:
+ * each record costs the bytes held by the cached primitive or executor. Zero (the default) limits the shared cache by
+ * CPU_RUNTIME_CACHE_CAPACITY records instead
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARED_BYTES);
+
+/**
+ * @brief Defines the policy the dynamic dimensions of the CPU graph inputs are rounded up with: NO (default), POW2 to
+ * round up to powers of two or an ascending comma-separated list of the bucket values (e.g. "32,64,128,256").
+ * The inputs are zero padded up to the bucket values and the outputs are cropped back to the dims the shape inference
+ * gives for the original input dims. The padding is applied only if all the nodes consuming the padded data keep the
+ * valid values independent of the zero tails (the element-wise nodes, Transpose, MatMul, FullyConnected and Convolution)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_BUCKETS);
+
+/**
+ * @brief Defines the input shapes the dynamic model is served with, so the CPU plugin compiles a static network per
+ * shapes set at the model compilation. The requests with these input shapes are inferred by the static networks with
+ * all the static-only optimizations applied, the other ones by the dynamic graph. The sets are separated by ';', the
+ * inputs of a set by ',', e.g. "data[1,3,224,224],info[1,3];data[1,3,320,320],info[1,3]". Each set must define all the
+ * dynamic inputs of the model. Is applied only to the new API requests of the models without states
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_SPECIALIZATIONS);
+
+/**
+ * @brief Defines how the weights shared between the CPU streams are placed on the NUMA nodes:
+ * REPLICATE (default) - a copy per NUMA node bound to that node, INTERLEAVE - a single copy interleaved over all the
+ * nodes, SINGLE_NODE - a single copy bound to the first node
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_NUMA_POLICY);
+DECLARE_CONFIG_VALUE(REPLICATE);
+DECLARE_CONFIG_VALUE(INTERLEAVE);
+DECLARE_CONFIG_VALUE(SINGLE_NODE);
+
+/**
+ * @brief Makes the CPU streams of the compiled model share a single graph instead of the graph per stream (YES/NO).
+ * The graph is split into as many pipeline stages of similar cost as there are streams, so the consecutive requests flow
+ * through the stages concurrently, each on the cores of its stream. Is applied only to the static models without states
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PIPELINED_STREAMS);
+
+/**
+ * @brief Defines the minimal size of the sub-batches the batch of a request is split into, so the sub-batches are
+ * inferred by several CPU streams at once and write to the slices of the same output tensors. A non negative integer,
+ * 0 (default) disables the split. Is applied only to the models which batch is the only dynamic dimension
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BATCH_SPLIT_MIN_SIZE);
+
+/**
+ * @brief Makes the compiled model lease the streams of the CPU pool shared by all the compiled models of the process
+ * instead of creating the streams of its own (YES/NO). The pool covers all the cores, the models get the pool streams
+ * in proportion to the streams number they are configured with, so the concurrent models don't oversubscribe the CPU
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_POOL);
+
+/**
+ * @brief Makes the compiled model share its weights with the other models compiled by the plugin (YES/NO). The weights
+ * are identified by their content, so the models having the same constants, e.g. the variants of the same backbone,
+ * keep the single copy of the constants and of the weights repacked from them. The weights of the multi-stream models
+ * are always shared this way, the key enables the sharing for the single stream ones as well
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS);
+
+/**
+ * @brief Defines how long, in milliseconds, the graph of the CPU stream may stay unused before it's released, 0
+ * (default) keeps the graphs. The graphs referred by the infer requests are kept anyway, the released graph is created
+ * again on the next use of its stream
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAM_GRAPHS_IDLE_TIMEOUT);
+
+/**
+ * @brief Enables the concurrent execution of the independent nodes of the CPU graph (YES/NO). The nodes having no
+ * dependencies on each other are executed at once, each in a task arena which concurrency is proportional to the node
+ * cost. Is applied only to the static models without states and only if the plugin is built with TBB
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief Read-only metric of the CPU compiled model: the bytes of the shared weights physically placed on each NUMA
+ * node (std::map<int, size_t>, -1 stands for the bytes which placement is unknown). The stores are shared by all the
+ * models compiled with the same policy, so the weights of these models are reported as well.
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_WEIGHTS_NUMA_BYTES = "CPU_WEIGHTS_NUMA_BYTES";
+
+/**
+ * @brief Defines how many latest execution records of the CPU graph nodes and infer requests are kept in the ring buffer of
+ * the compiled model, 0 (default) disables the tracing. The records are read with METRIC_CPU_EXECUTION_TRACE
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EXECUTION_TRACE_CAPACITY);
+
+/**
+ * @brief Read-only metric of the CPU compiled model: the kept execution records as the Chrome trace event format JSON
+ * (std::string) to be opened with chrome://tracing or Perfetto. Each stream is shown as a process, -1 stands for the
+ * records made outside of the streams
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_EXECUTION_TRACE = "CPU_EXECUTION_TRACE";
+
+/**
+ * @brief Read-only metric of the CPU compiled model: the lookups of the runtime parameters caches of its graphs
+ * (std::map<std::string, uint64_t> with "hits" and "misses"). Each miss creates the primitive or the executor for the
+ * new shapes, so the misses are the recompilations of the dynamic model. The shared cache also counts the lookups of
+ * the other models sharing it
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_RUNTIME_CACHE_STATS = "CPU_RUNTIME_CACHE_STATS";
+
+/**
+ * @brief Defines the minimal share of the zero blocks (16 output channels by 1 input channel) in the constant FP32 weights
+ * of FullyConnected from which the weights are compressed to the block-sparse format and executed by the sparse kernel.
+ * A floating point number from 0 to 1, 1 (default) disables the sparse execution
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_RATE);
+
+/**
+ * @brief Defines the weight-only compression of the constant FP32 weights of FullyConnected: NO (default),
+ * INT8 or INT4 - the weights are quantized to the unsigned integers with a scale and a zero point per output channel
+ * and group of the input channels, stay compressed in memory and are dequantized by the kernel on the fly.
+ * The compression is lossy, so it's applicable only to the models tolerant to the weights quantization (e.g. LLMs)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION);
+DECLARE_CONFIG_VALUE(INT8);
+DECLARE_CONFIG_VALUE(INT4);
+
+/**
+ * @brief Defines the number of the input channels sharing a scale and a zero point of the compressed weights,
+ * a positive integer, 128 by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION_GROUP_SIZE);
+
+/**
+ * @brief Splits the sparse and compressed constant weights of FullyConnected by the output channels between the NUMA
+ * nodes (YES/NO). Each node computes its output channels by its own cores over its own part of the weights, so the
+ * memory bandwidth of all the sockets serves a single request. Is applied only to the large weights and a few rows
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TENSOR_PARALLEL);
+
+/**
+ * @brief Fuses the MatMul - [Multiply] - [Add] - Softmax - MatMul attention of the FP32 models into a single CPU node
+ * computing the scores tile by tile (YES/NO, default YES). Saves the memory of the [..., Lq, Lk] scores and the passes
+ * over it, the tiles are multiplied by the oneDNN sgemm
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ATTENTION_FUSION);
+
+/**
+ * @brief Enables the BF16 auto mixed precision of the CPU plugin: if BF16 is enforced, the nodes which are sensitive to
+ * the precision loss are kept in FP32 - Softmax, LogSoftmax and the producers of their inputs, MVN and the last
+ * FullyConnected or MatMul nodes before the outputs. YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_AUTO_MIXED_PRECISION);
+
+/**
+ * @brief Sets the precisions of the nodes explicitly if BF16 is enforced, e.g. the map exported with the
+ * METRIC_CPU_BF16_PRECISION_MAP and refined by the accuracy measurements. The list of the original node names with
+ * the precisions separated by ';', e.g. "conv1:BF16;fc_out:FP32". The precision is either BF16 or FP32 and overrides
+ * both the graph tail and the auto mixed precision rules
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_PRECISION_MAP);
+
+/**
+ * @brief Read-only metric of the CPU compiled model: the precisions the floating point nodes are executed with in the
+ * format of KEY_CPU_BF16_PRECISION_MAP (std::string), so the map can be edited and passed back. Is empty if BF16 is not
+ * enforced
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_BF16_PRECISION_MAP = "CPU_BF16_PRECISION_MAP";
+
+/**
+ * @brief Limits the instruction set of the CPU plugin kernels (oneDNN primitives and the plugin JIT kernels) to
+ * compare e.g. AMX against AVX-512 on the same machine. Accepts the oneDNN ISA names: SSE41, AVX, AVX2, AVX2_VNNI,
+ * AVX512_CORE, AVX512_CORE_VNNI, AVX512_CORE_BF16, AVX512_CORE_AMX or ALL (default). The limit is process-wide and can
+ * be set only before the first model is compiled
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MAX_ISA);
+
+/**
+ * @brief Read-only metric of the CPU plugin: the name of the instruction set the kernels are dispatched for (std::string),
+ * which is the best ISA supported by the machine within the CPU_MAX_ISA limit
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_EFFECTIVE_ISA = "CPU_EFFECTIVE_ISA";
+
+/**
+ * @brief Read-only metric of the CPU plugin: the topology the default streams and threads are derived from
+ * (std::map<std::string, int>): "numa_nodes", "physical_cores" and "logical_cores" available to the process affinity
+ * mask (so the cpuset of the container is applied) and "cpu_quota", the CPUs of the CPU bandwidth quota of the
+ * process (0 if it isn't set), which limits the default number of the threads
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_EFFECTIVE_TOPOLOGY = "CPU_EFFECTIVE_TOPOLOGY";
+
+/**
+ * @brief Defines how the CPU plugin backs the weights, the intermediate tensors and the I/O blobs of 2MB and above with
+ * the huge pages: NO (default), TRANSPARENT - the transparent huge pages advised with madvise, EXPLICIT - the 2MB pages
+ * of the hugetlbfs pool, EXPLICIT_1G - the 1GB pages of the pool for the regions of 1GB and above, the 2MB ones for the
+ * rest. The explicit modes fall back to the transparent pages when the pool is exhausted. The mode is process-wide and
+ * applies to the memory allocated after it's set
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(TRANSPARENT);
+DECLARE_CONFIG_VALUE(EXPLICIT);
+DECLARE_CONFIG_VALUE(EXPLICIT_1G);
+
+/**
+ * @brief Read-only metric of the CPU plugin: the bytes currently allocated with the huge pages by kind
+ * (std::map<std::string, size_t>): EXPLICIT_1G, EXPLICIT_2M, TRANSPARENT and FALLBACK, the part of TRANSPARENT the
+ * explicit mode failed to map from the pool. The transparent bytes are only advised, the kernel backs them with the huge
+ * pages as far as it's able to
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_HUGE_PAGES_BYTES = "CPU_HUGE_PAGES_BYTES";
+
+/**
+ * @brief The number of the in-order command queues the GPU network distributes its independent branches to, so the small
+ *        branches execute concurrently with the big ones. The queues are synchronized only where the branches join.
+ *        Is used only with the in-order queue and no profiling, 1 (the default) executes the network on one queue
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_BRANCH_QUEUES);
+
+/**
+ * @brief Makes the GPU network record its kernels into a cl_khr_command_buffer on the first inference and replay it on
+ *        the next ones instead of enqueuing each kernel. The network is recorded again when its input or output buffers
+ *        change. Is used with the in-order queue and no profiling if the network has only the OpenCL kernels and the
+ *        driver supports the extension, YES or NO (the default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_RECORDED_EXECUTION);
+
+/**
+ * @brief Makes the GPU plugin execute the networks on the immediate command lists of Level Zero with the USM buffers
+ *        instead of the OpenCL queues. The kernels are still built by OpenCL. Is available if the plugin is built with
+ *        ENABLE_INTEL_GPU_LEVEL_ZERO and can't be used with the user OpenCL contexts, queues or VA devices and with
+ *        oneDNN, YES or NO (the default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_LEVEL_ZERO);
+
+/**
+ * @brief The number of the throughput streams of the GPU compiled model which execute at the same time. The streams are
+ *        split into that many groups, the streams of a group share one in-order queue and one set of the intermediate
+ *        buffers and execute one after another, while their preprocessing still overlaps, so the activations memory is
+ *        the one of the executing streams rather than of all of them. The weights are shared by all the streams anyway.
+ *        Is used only with the in-order queue, the memory pool and one branch queue, 0 (the default) executes all the
+ *        streams at the same time with their own buffers
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_EXECUTING_STREAMS);
+
+/**
+ * @brief Makes the GPU plugin quantize the activations of the FullyConnected layers per token on the fly: the kernel
+ *        finds the scale of each input row, converts it to int8 and computes the int8 dot products with the int8
+ *        weights. The float constant weights of the MatMuls are compressed to int8 with per output feature scales for
+ *        this. Independent of the low precision transformations, it isn't applied to the quantized models, YES or NO
+ *        (the default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_DYNAMIC_QUANTIZATION);
+
+/**
+ * @brief The directory the GPU infer requests write the trace of their kernels to after each inference, a Chrome trace
+ *        JSON file per inference with the device queued/submit/start/end timestamps, the selected kernel, the global and
+ *        local work sizes and the bytes of the inputs and the output of each primitive. Enables the profiling, the empty
+ *        value (the default) disables the trace
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_KERNEL_TRACE_DIR);
+
+/**
+ * @brief The p99 latency target of the AUTO_BATCH requests in ms. When it's set, the time the batch is collected is
+ *        adapted to the arrival rate of the requests and the device latency of the batched and the batch1 executions,
+ *        so the batch is filled as long as the target is met. AUTO_BATCH_TIMEOUT remains the upper bound of the time,
+ *        0 (the default) makes it the fixed one
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET);
+
+/**
+ * @brief Read-only metric of the AUTO_BATCH network: the values its adaptive timeout is chosen from
+ * (std::map<std::string, float>): LATENCY_TARGET_MS, the current TIMEOUT_MS, the ARRIVAL_RATE of the requests per second
+ * and the moving averages of the BATCH_LATENCY_MS and BATCH1_LATENCY_MS executions
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_AUTO_BATCH_TIMEOUT_STATS = "AUTO_BATCH_TIMEOUT_STATS";
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -86,6 +403,61 @@ DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
  */
 DECLARE_CONFIG_KEY(MULTI_WORK_MODE_AS_AUTO);
 
+/**
+ * @brief Makes the MULTI device route each request to the device it's expected to complete on first, from the moving
+ *        average of the time the requests of each device take. The request may wait for a busy faster device instead of
+ *        going to an idle slower one. YES or NO (the default), which takes the first idle device in the priority order
+ */
+DECLARE_CONFIG_KEY(MULTI_LOAD_AWARE_SCHEDULING);
+
+/**
+ * @brief Keeps the CPU network AUTO infers on while the accelerator one is compiled, so the requests the accelerator has
+ *        no idle request for run on the CPU instead of waiting. YES or NO (the default), which releases the CPU
+ *        network and its requests once the accelerator takes over
+ */
+DECLARE_CONFIG_KEY(AUTO_CPU_OVERFLOW);
+
+/**
+ * @brief Makes AUTO compile the network on all the devices supporting it, e.g. all the GPUs and the CPU, and distribute
+ *        the requests among them the way the MULTI device does with the load-aware scheduling, instead of selecting a
+ *        single device. The number of requests of each device is its OPTIMAL_NUMBER_OF_INFER_REQUESTS, with the
+ *        THROUGHPUT hint unless another one is set. YES or NO (the default)
+ */
+DECLARE_CONFIG_KEY(AUTO_CUMULATIVE_THROUGHPUT);
+
+/**
+ * @brief Read-only metric of the AUTO network: the times of its switch from the CPU to the accelerator
+ * (std::map<std::string, float>): ACTUAL_READY_MS since the network load started till the accelerator network is ready
+ * and SWITCH_MS till the last CPU request completed and the CPU network was released. The entries are missing until the
+ * respective event
+ */
+static constexpr auto METRIC_AUTO_SWITCH_STATS = "AUTO_SWITCH_STATS";
+
+/**
+ * @brief Read-only metric of the MULTI and AUTO networks: the statistics of the completed requests per device
+ * (std::map<std::string, float>), the entries are named <device>:<statistic>. COUNT is the number of the requests
+ * completed on the device, QUEUE_P50_MS, QUEUE_P90_MS, QUEUE_P99_MS are the percentiles of the time the requests wait
+ * for an idle request of the device and EXEC_P50_MS, EXEC_P90_MS, EXEC_P99_MS of the time they take on the device.
+ * The percentiles are of the last 1024 requests of the device
+ */
+static constexpr auto METRIC_MULTI_REQUEST_STATS = "MULTI_REQUEST_STATS";
+
+/**
+ * @brief Makes the HETERO requests share a pool of requests per subgraph instead of owning a request of each, so the
+ *        devices run the subgraphs of the different HETERO requests at the same time. The pool of a subgraph has the
+ *        OPTIMAL_NUMBER_OF_INFER_REQUESTS of its device, the subgraphs waiting for a request are queued.
+ *        YES or NO (the default)
+ */
+DECLARE_CONFIG_KEY(HETERO_PIPELINED_EXECUTION);
+
+/**
+ * @brief Makes HETERO assign the operations to the devices by the estimate of the model latency: the operation costs
+ *        from the DEVICE_GOPS of the devices and the costs of the tensor transfers between the subgraphs, instead of
+ *        the first device in the priority order supporting an operation. The last device of the priorities is the host
+ *        the small islands of operations are merged to. YES or NO (the default)
+ */
+DECLARE_CONFIG_KEY(HETERO_COST_BASED_AFFINITY);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
@@ -62,6 +62,25 @@ INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores(bool bigCoresOnly = false);
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfLogicalCPUCores(bool bigCoresOnly = false);
 
+/**
+ * @brief      Returns the number of CPUs the CPU bandwidth quota of the process allows, rounded up: the cgroup v2
+ * cpu.max or cgroup v1 cpu.cfs_quota_us of the process cgroup and its ancestors on Linux, the hard capped CPU rate
+ * of the job on Windows. Unlike the cpuset of the container, which is a part of the process affinity mask and so is
+ * accounted by the number of the cores above, the quota doesn't change the topology
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Number of CPUs of the quota, 0 if the quota isn't set
+ */
+INFERENCE_ENGINE_API_CPP(int) getCPUQuota();
+
+/**
+ * @brief      Limits the default number of the threads to the CPU quota of the process, as the threads above the quota
+ * are throttled by the OS scheduler
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  threads The number of the threads derived from the topology
+ * @return     The number of the threads not greater than the quota
+ */
+INFERENCE_ENGINE_API_CPP(int) limitByCPUQuota(int threads);
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -20,7 +21,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue, or from the queues of the streams
+ *        if the @ref Config::_workStealing is set.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -29,6 +31,19 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief The priority of the task, the queued latency tasks are pulled by the streams before the batch ones
+     */
+    enum class Priority {
+        BATCH = 0,    //!< The default priority, e.g. for the throughput traffic
+        LATENCY = 1,  //!< The latency sensitive tasks
+    };
+
+    /**
+     * @brief The time point the task should be started before
+     */
+    using Deadline = std::chrono::steady_clock::time_point;
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -42,6 +57,15 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Runs the task with the priority and the deadline
+     * @param task A task to start
+     * @param priority The priority of the task in the queue
+     * @param deadline The queued tasks of the same priority are pulled in the earliest deadline first order,
+     *        the tasks without the deadline are pulled after the ones with it
+     */
+    void run(Task task, Priority priority, Deadline deadline = Deadline::max());
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
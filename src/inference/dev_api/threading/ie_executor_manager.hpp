@@ -46,6 +46,17 @@ public:
     /// @private
     virtual IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) = 0;
 
+    /**
+     * @brief Returns the executor leasing the streams of the pool shared by all the callers with the same config
+     * The pool lives while any of its executors does. The pool streams are shared by the executors having the queued
+     * tasks in proportion to their weights, the streams of an idle executor are used by the others
+     * @param config The config of the pool, e.g. the streams covering all the cores
+     * @param weight The share of the executor, the number of the streams it's given when all the executors are busy
+     *        is proportional to it
+     * @return A shared pointer to the new executor of the existing or the newly created pool
+     */
+    virtual IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config, int weight) = 0;
+
     /**
      * @cond
      */
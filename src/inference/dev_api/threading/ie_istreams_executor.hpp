@@ -103,6 +103,11 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< Every stream pulls the tasks from its own queue and steals the tasks of
+                                     //!< the other streams of the same NUMA node when its queue is empty. The tasks
+                                     //!< are routed to the streams with the shorter measured tasks duration first
+        bool _latencyOnBigCores = false;  //!< In case of @ref HYBRID_AWARE and @ref _workStealing the latency tasks
+                                          //!< are run by the Big cores streams only, the batch ones by any stream
 
         /**
          * @brief      A constructor with arguments
@@ -115,6 +120,8 @@ public:
          * @param[in]  threadBindingOffset  @copybrief Config::_threadBindingOffset
          * @param[in]  threads              @copybrief Config::_threads
          * @param[in]  threadPreferBigCores @copybrief Config::_threadPreferBigCores
+         * @param[in]  workStealing         @copybrief Config::_workStealing
+         * @param[in]  latencyOnBigCores    @copybrief Config::_latencyOnBigCores
          */
         Config(std::string name = "StreamsExecutor",
                int streams = 1,
@@ -123,7 +130,9 @@ public:
                int threadBindingStep = 1,
                int threadBindingOffset = 0,
                int threads = 0,
-               PreferredCoreType threadPreferredCoreType = PreferredCoreType::ANY)
+               PreferredCoreType threadPreferredCoreType = PreferredCoreType::ANY,
+               bool workStealing = false,
+               bool latencyOnBigCores = false)
             : _name{name},
               _streams{streams},
               _threadsPerStream{threadsPerStream},
@@ -131,7 +140,9 @@ public:
               _threadBindingStep{threadBindingStep},
               _threadBindingOffset{threadBindingOffset},
               _threads{threads},
-              _threadPreferredCoreType(threadPreferredCoreType) {}
+              _threadPreferredCoreType(threadPreferredCoreType),
+              _workStealing{workStealing},
+              _latencyOnBigCores{latencyOnBigCores} {}
     };
 
     /**
@@ -29,6 +29,68 @@ namespace ov {
 
 class Core;
 class InferRequest;
+class CompiledModel;
+struct InferRequestPool;
+
+/**
+ * @brief The inference request borrowed from the pool of the compiled model
+ * The request, with its tensors, is given back to the pool when the object is destroyed or released, so the next
+ * caller gets it without the allocation. The request shall not be running when it's given back.
+ */
+class OPENVINO_RUNTIME_API PooledInferRequest {
+    std::shared_ptr<InferRequestPool> _pool;
+    InferRequest _request;
+
+    PooledInferRequest(const std::shared_ptr<InferRequestPool>& pool, InferRequest request);
+    friend class ov::CompiledModel;
+
+public:
+    /**
+     * @brief A default constructor, constructs the object owning no request
+     */
+    PooledInferRequest() = default;
+
+    PooledInferRequest(const PooledInferRequest&) = delete;
+    PooledInferRequest& operator=(const PooledInferRequest&) = delete;
+
+    /**
+     * @brief Move constructor, the moved from object owns no request
+     */
+    PooledInferRequest(PooledInferRequest&& other) noexcept;
+
+    /**
+     * @brief Move assignment, the request owned before is given back to the pool
+     */
+    PooledInferRequest& operator=(PooledInferRequest&& other) noexcept;
+
+    /**
+     * @brief Destructor gives the request back to the pool
+     */
+    ~PooledInferRequest();
+
+    /**
+     * @brief Gives the request back to the pool before the object destruction
+     */
+    void release();
+
+    /**
+     * @brief Gets the borrowed request
+     * @return A reference to the borrowed request
+     */
+    InferRequest& operator*();
+
+    /**
+     * @brief Gets the borrowed request
+     * @return A pointer to the borrowed request
+     */
+    InferRequest* operator->();
+
+    /**
+     * @brief Checks if the object owns a request
+     * @return `true` if the object owns a request, `false` - otherwise
+     */
+    explicit operator bool() const noexcept;
+};
 
 /**
  * @brief This class represents compiled model
@@ -38,6 +100,7 @@ class InferRequest;
 class OPENVINO_RUNTIME_API CompiledModel {
     std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> _impl;
     std::shared_ptr<void> _so;
+    std::shared_ptr<InferRequestPool> _pool;
 
     /**
      * @brief Constructs CompiledModel from the initialized std::shared_ptr
@@ -152,6 +215,25 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Borrows an inference request from the pool of the compiled model
+     * The pool is shared by all the copies of the compiled model. The requests are created on demand, while the pool
+     * size allows, so the idle requests and their tensors are reused by the callers instead of allocating the new
+     * ones. If all the requests of the full pool are borrowed, the method waits for one of them to be given back.
+     *
+     * @return The borrowed request, it's given back to the pool on the destruction
+     */
+    PooledInferRequest acquire_infer_request();
+
+    /**
+     * @brief Sets the maximal number of the requests of the pool
+     * The pool is limited by the ov::optimal_number_of_infer_requests of the compiled model by default. If the limit
+     * is decreased, the borrowed requests above it are destroyed when they are given back.
+     *
+     * @param max_size The maximal number of the requests, should be positive
+     */
+    void set_infer_request_pool_size(size_t max_size);
+
     /**
      * @brief Exports the current compiled model to an output stream `std::ostream`.
      * The exported model can also be imported via ov::Core::import_model method
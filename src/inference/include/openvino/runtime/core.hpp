@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -103,13 +104,22 @@ public:
      * @param model A string with model in IR / ONNX / PDPD format
      * @param weights A shared pointer to constant tensor with weights
      * Reading ONNX / PDPD models doesn't support loading weights from @p weights tensors.
-     * @note Created model object shares the weights with @p weights object.
-     * So, do not create @p weights on temporary data which can be later freed, since the model
-     * constant data becomes point to an invalid memory.
+     * @note Created model object shares the weights with @p weights object, neither the weights nor the @p model
+     * string are copied while reading. So, do not create @p weights on temporary data which can be later freed,
+     * since the model constant data becomes point to an invalid memory.
      * @return A model
      */
     std::shared_ptr<ov::Model> read_model(const std::string& model, const Tensor& weights) const;
 
+    /**
+     * @brief Reads models from IR / PDPD streams
+     * @param model A stream with model in IR / PDPD format
+     * @param weights A stream with weights of the model. It's read to the end by the frontend straight into the
+     * memory the created model owns, so the model doesn't have to be staged in a file or a buffer beforehand.
+     * @return A model
+     */
+    std::shared_ptr<ov::Model> read_model(std::istream& model, std::istream& weights) const;
+
     /**
      * @brief Creates and loads a compiled model from a source model to the default OpenVINO device selected by AUTO
      * plugin.
@@ -283,6 +293,39 @@ public:
         return compile_model(model, context, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Creates a compiled model from a source model object without blocking the caller.
+     *
+     * The models are compiled in parallel on a pool of a bounded size owned by the Core object. If the model caching is
+     * enabled, the future is ready as soon as the model is compiled (or imported from the cache), the compiled model is
+     * exported to the cache afterwards in the background. So the already compiled models can be used while the others
+     * are still building.
+     * @note The model shall not be changed until the future is ready. The Core object destruction waits for the
+     * queued compilations.
+     * @param model Model object acquired from Core::read_model
+     * @param device_name Name of a device to load a model to
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation
+     * @return A future of the compiled model object, it holds the exception if the compilation fails
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Reads a model and creates a compiled model from IR / ONNX / PDPD file without blocking the caller.
+     *
+     * The same as Core::compile_model_async for the model object, but the model is read on the pool thread too.
+     * @param model_path Path to a model
+     * @param device_name Name of a device to load a model to
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation
+     * @return A future of the compiled model object, it holds the exception if the reading or the compilation fails
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
     /**
      * @deprecated This method is deprecated. Please use other Core::add_extension methods
      * @brief Registers OpenVINO 1.0 extension to a Core object
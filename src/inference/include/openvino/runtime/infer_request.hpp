@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -265,6 +266,21 @@ public:
      */
     void cancel();
 
+    /**
+     * @brief Sets how the next inferences of the request are scheduled among the other requests of the compiled model
+     * @note Is supported by the plugins which run the inferences on the streams executor (e.g. CPU), the others throw
+     *       ov::NotImplemented
+     * @param latency_sensitive If true, the inference stages are executed before the queued stages of the other
+     *        (batch) requests
+     * @param timeout The deadline of the inference counted from its start. The queued stages of the requests with the
+     *        same latency sensitivity are executed in the earliest deadline first order. Zero means no deadline.
+     * @param drop_expired If true, the inference whose stage isn't started before the deadline fails with
+     *        ov::Cancelled
+     */
+    void set_scheduling(bool latency_sensitive,
+                        const std::chrono::microseconds timeout = std::chrono::microseconds{0},
+                        bool drop_expired = false);
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming operation
      * @note not all plugins provide meaningful data
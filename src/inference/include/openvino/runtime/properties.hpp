@@ -182,6 +182,22 @@ static constexpr Property<std::string, PropertyMutability::RO> model_name{"NETWO
 static constexpr Property<uint32_t, PropertyMutability::RO> optimal_number_of_infer_requests{
     "OPTIMAL_NUMBER_OF_INFER_REQUESTS"};
 
+/**
+ * @brief Read-only property of a compiled model to get the bytes of memory it holds by the category and the location
+ *
+ * The keys are "<category>/<location>/current" and "<category>/<location>/peak", the categories are "weights",
+ * "activations" and "io" (the part of the activations bound to the inputs and outputs), the plugins may add their own
+ * ones. The location is "total", the NUMA node ("numa<id>", "numa_unknown" for the pages not touched yet) or the
+ * allocation type of the device memory. The peak is the most of the memory the compiled model has held at once.
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::memory_statistics);
+ * auto weights = stats["weights/total/current"];
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_statistics{
+    "MEMORY_STATISTICS"};
+
 namespace hint {
 
 /**
@@ -389,6 +405,37 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief Read-only property of the Core to get the total time in milliseconds of each model loading phase in the
+ * process so far, without the external profilers
+ *
+ * The phases are named "<stage>/<phase>", the time of the stage itself is under its name, e.g. "read_model",
+ * "read_model/load" (reading and parsing the model files), "read_model/convert", "transformations" (the outermost
+ * pass managers) and "transformations/<pass name>", "plugin_load", "compile_model", "compile_model/plugin",
+ * "compile_model/cache_hash", "compile_model/cache_import", "compile_model/cache_export". The plugins add their own
+ * phases, e.g. "cpu_graph/create_primitives". The time of a phase includes the time of the phases run inside it.
+ *
+ * @code
+ * auto phases = core.get_property("", ov::load_time_breakdown);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, double>, PropertyMutability::RO> load_time_breakdown{
+    "LOAD_TIME_BREAKDOWN"};
+
+/**
+ * @brief Read-only property of the Core to get the durations of the ITT annotated sections of code measured in the
+ * process so far by the built-in counters backend, without the external profilers
+ *
+ * The backend is built with the ENABLE_PROFILING_COUNTERS option, the report is empty without it. Each line of the
+ * report is "<domain>\t<task>\t<count>\t<total_ms>\t<mean_ms>\t<max_ms>\t<p50_ms>\t<p99_ms>" after the header line.
+ * The OPENVINO_COUNTERS_DUMP=<file> environment variable writes the same report to the file at the process exit.
+ *
+ * @code
+ * auto report = core.get_property("", ov::profiling_counters);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> profiling_counters{"PROFILING_COUNTERS"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  *
@@ -438,6 +485,17 @@ namespace device {
  */
 static constexpr Property<std::string> id{"DEVICE_ID"};
 
+/**
+ * @brief The Core property restricting the devices probed by get_available_devices() to the comma-separated list
+ * of the device names, the plugins of the other devices aren't loaded. Empty value probes all the registered devices.
+ *
+ * @code
+ * core.set_property(ov::device::allow_list("CPU,GPU"));
+ * auto devices = core.get_available_devices();  // e.g. CPU, GPU.0, GPU.1
+ * @endcode
+ */
+static constexpr Property<std::string> allow_list{"DEVICE_ALLOW_LIST"};
+
 /**
  * @brief Type for device Priorities config option, with comma-separated devices listed in the desired priority
  */
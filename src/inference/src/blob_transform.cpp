@@ -4,18 +4,194 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #    include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#    include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#    include "cpu_x86_avx512/blob_transform_avx512.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+// The channels and the pixels are copied by the tiles of this size, so both the source and the destination lines
+// being read and written stay in the cache
+static constexpr size_t blob_copy_block = 16;
+
+// The gather indices of the vectored copy are 32-bit
+static inline bool fits_gather_indices(size_t stride) {
+    return stride <= static_cast<size_t>(std::numeric_limits<int32_t>::max()) / 16;
+}
+
+// Copies the row of the interleaved (channels last) blob to the planar one: dst[c, w] = src[w, c]
+template <InferenceEngine::Precision::ePrecision PRC>
+static void blob_copy_split_row(const typename InferenceEngine::PrecisionTrait<PRC>::value_type* src,
+                                typename InferenceEngine::PrecisionTrait<PRC>::value_type* dst,
+                                size_t C_src_stride,
+                                size_t W_src_stride,
+                                size_t C_dst_stride,
+                                size_t W_dst_stride,
+                                size_t C,
+                                size_t W) {
+#ifdef HAVE_SSE
+    if (C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+        if (PRC == Precision::U8) {
+            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src),
+                                    reinterpret_cast<uint8_t*>(dst),
+                                    0,
+                                    0,
+                                    0,
+                                    0,
+                                    C_dst_stride,
+                                    1,
+                                    1,
+                                    static_cast<int>(W));
+            return;
+        }
+
+        if (PRC == Precision::FP32) {
+            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src),
+                                     reinterpret_cast<float*>(dst),
+                                     0,
+                                     0,
+                                     0,
+                                     0,
+                                     C_dst_stride,
+                                     1,
+                                     1,
+                                     static_cast<int>(W));
+            return;
+        }
+    }
+#endif  // HAVE_SSE
+
+    if (PRC == Precision::FP32 && C_src_stride == 1 && W_dst_stride == 1 && fits_gather_indices(W_src_stride)) {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512f()) {
+            blob_copy_split_row_32bit_avx512(reinterpret_cast<const uint32_t*>(src),
+                                             reinterpret_cast<uint32_t*>(dst),
+                                             W_src_stride,
+                                             C_dst_stride,
+                                             C,
+                                             W);
+            return;
+        }
+#endif  // HAVE_AVX512
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            blob_copy_split_row_32bit_avx2(reinterpret_cast<const uint32_t*>(src),
+                                           reinterpret_cast<uint32_t*>(dst),
+                                           W_src_stride,
+                                           C_dst_stride,
+                                           C,
+                                           W);
+            return;
+        }
+#endif  // HAVE_AVX2
+    }
+
+    for (size_t c0 = 0; c0 < C; c0 += blob_copy_block) {
+        const size_t c1 = std::min(C, c0 + blob_copy_block);
+        for (size_t w = 0; w < W; w++) {
+            const auto* src_w = src + w * W_src_stride;
+            auto* dst_w = dst + w * W_dst_stride;
+            for (size_t c = c0; c < c1; c++) {
+                dst_w[c * C_dst_stride] = src_w[c * C_src_stride];
+            }
+        }
+    }
+}
+
+// Copies the row of the planar blob to the interleaved (channels last) one: dst[w, c] = src[c, w]
+template <InferenceEngine::Precision::ePrecision PRC>
+static void blob_copy_merge_row(const typename InferenceEngine::PrecisionTrait<PRC>::value_type* src,
+                                typename InferenceEngine::PrecisionTrait<PRC>::value_type* dst,
+                                size_t C_src_stride,
+                                size_t W_src_stride,
+                                size_t C_dst_stride,
+                                size_t W_dst_stride,
+                                size_t C,
+                                size_t W) {
+#ifdef HAVE_SSE
+    if (C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
+        if (PRC == Precision::U8) {
+            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src),
+                                    reinterpret_cast<uint8_t*>(dst),
+                                    0,
+                                    0,
+                                    C_src_stride,
+                                    0,
+                                    0,
+                                    1,
+                                    1,
+                                    static_cast<int>(W));
+            return;
+        }
+
+        if (PRC == Precision::FP32) {
+            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src),
+                                     reinterpret_cast<float*>(dst),
+                                     0,
+                                     0,
+                                     C_src_stride,
+                                     0,
+                                     0,
+                                     1,
+                                     1,
+                                     static_cast<int>(W));
+            return;
+        }
+    }
+#endif  // HAVE_SSE
+
+    if (PRC == Precision::FP32 && W_src_stride == 1 && C_dst_stride == 1 && fits_gather_indices(C_src_stride)) {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512f()) {
+            blob_copy_merge_row_32bit_avx512(reinterpret_cast<const uint32_t*>(src),
+                                             reinterpret_cast<uint32_t*>(dst),
+                                             C_src_stride,
+                                             W_dst_stride,
+                                             C,
+                                             W);
+            return;
+        }
+#endif  // HAVE_AVX512
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            blob_copy_merge_row_32bit_avx2(reinterpret_cast<const uint32_t*>(src),
+                                           reinterpret_cast<uint32_t*>(dst),
+                                           C_src_stride,
+                                           W_dst_stride,
+                                           C,
+                                           W);
+            return;
+        }
+#endif  // HAVE_AVX2
+    }
+
+    for (size_t w0 = 0; w0 < W; w0 += blob_copy_block) {
+        const size_t w1 = std::min(W, w0 + blob_copy_block);
+        for (size_t c = 0; c < C; c++) {
+            const auto* src_c = src + c * C_src_stride;
+            auto* dst_c = dst + c * C_dst_stride;
+            for (size_t w = w0; w < w1; w++) {
+                dst_c[w * W_dst_stride] = src_c[w * W_src_stride];
+            }
+        }
+    }
+}
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -49,102 +225,29 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
 
     dst_ptr += dst_blk_desc.getOffsetPadding();
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    H_src_stride,
-                                    N_dst_stride,
-                                    H_dst_stride,
-                                    C_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     H_src_stride,
-                                     N_dst_stride,
-                                     H_dst_stride,
-                                     C_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    H_src_stride,
-                                    C_src_stride,
-                                    N_dst_stride,
-                                    H_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     H_src_stride,
-                                     C_src_stride,
-                                     N_dst_stride,
-                                     H_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-
+    // the rows are independent, so they are copied in parallel
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            blob_copy_split_row<PRC>(src_ptr + n * N_src_stride + h * H_src_stride,
+                                     dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                                     C_src_stride,
+                                     W_src_stride,
+                                     C_dst_stride,
+                                     W_dst_stride,
+                                     C,
+                                     W);
+        });
     } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            blob_copy_merge_row<PRC>(src_ptr + n * N_src_stride + h * H_src_stride,
+                                     dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                                     C_src_stride,
+                                     W_src_stride,
+                                     C_dst_stride,
+                                     W_dst_stride,
+                                     C,
+                                     W);
+        });
     } else {
         for (size_t i = 0; i < N * C * H * W; i++) {
             dst_ptr[i] = src_ptr[i];
@@ -161,6 +264,7 @@ static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
         break;
 
     case Precision::FP16:
+    case Precision::BF16:
     case Precision::U16:
     case Precision::I16:
         blob_copy_4d_t<Precision::U16>(src, dst);
@@ -210,117 +314,29 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    D_src_stride,
-                                    H_src_stride,
-                                    N_dst_stride,
-                                    D_dst_stride,
-                                    H_dst_stride,
-                                    C_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(D),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     D_src_stride,
-                                     H_src_stride,
-                                     N_dst_stride,
-                                     D_dst_stride,
-                                     H_dst_stride,
-                                     C_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(D),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    D_src_stride,
-                                    H_src_stride,
-                                    C_src_stride,
-                                    N_dst_stride,
-                                    D_dst_stride,
-                                    H_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(D),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     D_src_stride,
-                                     H_src_stride,
-                                     C_src_stride,
-                                     N_dst_stride,
-                                     D_dst_stride,
-                                     H_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(D),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
+    // the rows are independent, so they are copied in parallel
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_split_row<PRC>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                                     dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                                     C_src_stride,
+                                     W_src_stride,
+                                     C_dst_stride,
+                                     W_dst_stride,
+                                     C,
+                                     W);
+        });
     } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_merge_row<PRC>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                                     dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                                     C_src_stride,
+                                     W_src_stride,
+                                     C_dst_stride,
+                                     W_dst_stride,
+                                     C,
+                                     W);
+        });
     } else {
         for (size_t i = 0; i < N * C * D * H * W; i++) {
             dst_ptr[i] = src_ptr[i];
@@ -337,6 +353,7 @@ static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
         break;
 
     case Precision::FP16:
+    case Precision::BF16:
     case Precision::U16:
     case Precision::I16:
         blob_copy_5d_t<Precision::U16>(src, dst);
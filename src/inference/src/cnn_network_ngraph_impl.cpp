@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/op/util/variable_extension.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/smart_reshape/set_batch_size.hpp"
@@ -50,6 +52,55 @@ using details::CNNNetworkNGraphImpl;
 using InferenceEngine::details::CNNNetworkNGraphImpl;
 using ngraph::Function;
 
+namespace {
+/**
+ * @brief Revalidates only the nodes depending on the reshaped parameters instead of the whole function. A node is
+ * revalidated if the types or shapes of its inputs changed or the values of its inputs could change (they are
+ * calculated from the shapes by ShapeOf), the variable operations are always revalidated.
+ */
+void revalidate_reshaped_nodes(const std::shared_ptr<Function>& function,
+                               const std::unordered_set<const ngraph::Node*>& reshaped_parameters) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CNNNetworkNGraphImpl::revalidate_reshaped_nodes");
+    std::unordered_set<const ngraph::Node*> changed_shapes, changed_values;
+    std::vector<std::pair<ngraph::element::Type, ngraph::PartialShape>> outputs;
+    for (const auto& node : function->get_ordered_ops()) {
+        bool inputs_changed = false, values_changed = false;
+        for (const auto& input : node->input_values()) {
+            inputs_changed = inputs_changed || changed_shapes.count(input.get_node());
+            values_changed = values_changed || changed_values.count(input.get_node());
+        }
+        if (!inputs_changed && !values_changed && !reshaped_parameters.count(node.get()) &&
+            !std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node))
+            continue;
+
+        outputs.clear();
+        for (const auto& output : node->outputs())
+            outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+        node->revalidate_and_infer_types();
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            if (outputs[i].first != node->get_output_element_type(i) ||
+                outputs[i].second != node->get_output_partial_shape(i)) {
+                changed_shapes.insert(node.get());
+                break;
+            }
+        }
+        if (values_changed || (inputs_changed && (ngraph::is_type<ngraph::op::v0::ShapeOf>(node) ||
+                                                  ngraph::is_type<ngraph::op::v3::ShapeOf>(node))))
+            changed_values.insert(node.get());
+    }
+}
+
+std::string shapes_signature(const ngraph::ParameterVector& parameters) {
+    std::stringstream signature;
+    for (const auto& parameter : parameters)
+        signature << parameter->get_friendly_name() << parameter->get_output_partial_shape(0) << ';';
+    return signature.str();
+}
+
+// The number of the specialized functions kept for the dynamic networks reshaped to the different shapes
+constexpr size_t max_specialized_functions = 8;
+}  // namespace
+
 void CNNNetworkNGraphImpl::createDataForResult(const ::ngraph::Output<::ngraph::Node>& output,
                                                const std::string& outName,
                                                DataPtr& ptr) {
@@ -207,6 +258,7 @@ CNNNetworkNGraphImpl::CNNNetworkNGraphImpl(const CNNNetwork& network) {
     OutputsDataMap outputs = network.getOutputsInfo();
 
     _tensorNames = net->_tensorNames;
+    _new_api = net->_new_api;
 
     for (const auto& outputInfo : outputs) {
         const auto& name = outputInfo.second->getName();
@@ -294,6 +346,7 @@ StatusCode CNNNetworkNGraphImpl::addOutput(const std::string& layerName,
                 auto result = make_shared<::ngraph::op::Result>(layer->output(outputIndex));
                 result->set_friendly_name(outputName);
                 _ngraph_function->add_results({result});
+                _specializedFunctions.clear();
                 // Check that we cannot add Result to layer with non unique friendly name
                 try {
                     validateFunctionNames();
@@ -424,26 +477,36 @@ void CNNNetworkNGraphImpl::reshape(const std::map<std::string, ngraph::PartialSh
 
     auto params = _ngraph_function->get_parameters();
 
-    bool parameter_replaced = false;
+    std::unordered_set<const ngraph::Node*> reshaped_parameters;
     for (size_t i = 0; i < params.size(); i++) {
         auto& param = params[i];
         if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
             continue;
         param->set_partial_shape(inputShapes.at(param->get_friendly_name()));
-        parameter_replaced = true;
+        reshaped_parameters.insert(param.get());
     }
-    if (parameter_replaced)
-        _ngraph_function->validate_nodes_and_infer_types();
+    if (!reshaped_parameters.empty())
+        revalidate_reshaped_nodes(_ngraph_function, reshaped_parameters);
 
     const auto& results = _ngraph_function->get_results();
     bool outputs_are_static = all_of(begin(results), end(results), [](const std::shared_ptr<ngraph::Node>& n) {
         return n->get_output_partial_shape(0).is_static();
     });
+    bool inputs_are_static = all_of(begin(params), end(params), [](const std::shared_ptr<ngraph::Node>& n) {
+        return n->get_output_partial_shape(0).is_static();
+    });
 
     {
         shared_ptr<Function> specialized_ngraph_function = nullptr;
-        if (outputs_are_static) {
+        // The 2.0 API network with the dynamic inputs may be compiled only by the plugins supporting the dynamic
+        // outputs, so its outputs are taken from the function as is, without the clone converted to the legacy
+        // operations. The static inputs keep the specialization: the legacy NMS gives the static outputs of the
+        // data dependent shapes to the plugins which allocate the output blobs by the network dims (e.g. GPU, MYRIAD).
+        if (outputs_are_static || (_new_api && !inputs_are_static)) {
             specialized_ngraph_function = _ngraph_function;
+        } else if (_specializedFunctions.count(shapes_signature(params))) {
+            // the function wasn't changed since it was specialized for these shapes
+            specialized_ngraph_function = _specializedFunctions.at(shapes_signature(params));
         } else {
             specialized_ngraph_function = ngraph::clone_function(*_ngraph_function);
             {
@@ -464,6 +527,9 @@ void CNNNetworkNGraphImpl::reshape(const std::map<std::string, ngraph::PartialSh
                 manager.run_passes(specialized_ngraph_function);
             }
             specialized_ngraph_function->validate_nodes_and_infer_types();
+            if (_specializedFunctions.size() >= max_specialized_functions)
+                _specializedFunctions.clear();
+            _specializedFunctions[shapes_signature(params)] = specialized_ngraph_function;
         }
 
 #if 0
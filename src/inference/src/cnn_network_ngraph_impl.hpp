@@ -71,6 +71,8 @@ public:
         return _ngraph_function;
     }
     std::shared_ptr<::ngraph::Function> getFunction() noexcept override {
+        // the function can be changed by the caller
+        _specializedFunctions.clear();
         return _ngraph_function;
     }
 
@@ -106,6 +108,8 @@ private:
     const std::vector<IExtensionPtr> _ie_extensions;
     std::unordered_map<std::string, std::string> _tensorNames;
     bool _new_api = false;
+    // Functions with the dynamism resolved for the legacy outputs by the input shapes signature
+    std::map<std::string, std::shared_ptr<::ngraph::Function>> _specializedFunctions;
 
     /**
      * @brief Create DataPtr for nGraph operation
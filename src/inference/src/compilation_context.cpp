@@ -12,12 +12,19 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -41,6 +48,245 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+// The data is hashed by the chunks in parallel, the hashes of the chunks are combined in order. Each chunk is hashed
+// by 8 independent 32 bit lanes, so the loop is vectorized by the compiler.
+uint64_t hash_data(const char* data, size_t size) {
+    constexpr size_t lanes_num = 8;
+    constexpr size_t chunk_size = 1 << 20;
+    auto hash_chunk = [](const char* chunk, size_t chunk_bytes) {
+        constexpr uint32_t prime = 0x9E3779B1u;
+        uint32_t lanes[lanes_num] = {1, 2, 3, 4, 5, 6, 7, 8};
+        const size_t step = sizeof(lanes);
+        size_t i = 0;
+        for (; i + step <= chunk_bytes; i += step) {
+            uint32_t words[lanes_num];
+            std::memcpy(words, chunk + i, step);
+            for (size_t l = 0; l < lanes_num; l++) {
+                const uint32_t x = lanes[l] ^ words[l];
+                lanes[l] = ((x << 13) | (x >> 19)) * prime;
+            }
+        }
+        uint64_t seed = chunk_bytes;
+        for (size_t l = 0; l < lanes_num; l++)
+            seed = hash_combine(seed, lanes[l]);
+        for (; i < chunk_bytes; i++)
+            seed = hash_combine(seed, chunk[i]);
+        return seed;
+    };
+
+    const size_t chunks_num = (size + chunk_size - 1) / chunk_size;
+    if (chunks_num <= 1)
+        return hash_chunk(data, size);
+
+    std::vector<uint64_t> hashes(chunks_num);
+    parallel_for(chunks_num, [&](size_t chunk) {
+        const size_t offset = chunk * chunk_size;
+        hashes[chunk] = hash_chunk(data + offset, std::min(chunk_size, size - offset));
+    });
+    uint64_t seed = size;
+    for (const auto& hash : hashes)
+        seed = hash_combine(seed, hash);
+    return seed;
+}
+
+uint64_t hash_rt_info(uint64_t seed, const ov::RTMap& rt) {
+    for (const auto& rtMapData : rt) {
+        seed = hash_combine(seed, rtMapData.first);
+        std::stringstream strm;
+        rtMapData.second.print(strm);
+        seed = hash_combine(seed, strm.str());
+    }
+    return seed;
+}
+
+// The IR frontend marks the models those weights are mapped from the file: {data address, size, file identity}
+constexpr const char* weights_mapping_key = "weights_mapping";
+
+/**
+ * @brief Hashes the attributes of the operations. The constants which data lies in the mapped weights file are hashed
+ * by their offsets in the file, the other constants are hashed by the data.
+ * The hash is incomplete if some attribute can't be hashed (e.g. the sub-graphs port maps).
+ */
+class AttributesHasher : public ov::AttributeVisitor {
+public:
+    AttributesHasher(uint64_t& seed, const std::vector<uint64_t>& weights_mapping)
+        : m_seed(seed),
+          m_weights_mapping(weights_mapping) {}
+
+    bool is_complete() const {
+        return m_complete;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            const auto data = reinterpret_cast<uint64_t>(buffer->get_ptr());
+            const uint64_t size = buffer->size();
+            m_seed = hash_combine(m_seed, size);
+            if (m_weights_mapping.size() == 3 && data >= m_weights_mapping[0] &&
+                data + size <= m_weights_mapping[0] + m_weights_mapping[1]) {
+                // the mapping is read-only, so the data is identified by the file and the offset in it
+                m_seed = hash_combine(m_seed, m_weights_mapping[2]);
+                m_seed = hash_combine(m_seed, data - m_weights_mapping[0]);
+            } else {
+                m_seed = hash_combine(m_seed, hash_data(buffer->get_ptr<char>(), size));
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else {
+            m_complete = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+
+private:
+    template <typename T>
+    void hash_value(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hash_vector(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
+
+    uint64_t& m_seed;
+    const std::vector<uint64_t>& m_weights_mapping;
+    bool m_complete = true;
+};
+
+/**
+ * @brief Hashes the topology of the model, the names, types and shapes of the outputs and the attributes of the
+ * operations without the serialization of the model.
+ * @return false if the model can't be hashed this way, so the serialization based hash must be used
+ */
+bool hash_model(const std::shared_ptr<ov::Model>& model, uint64_t& seed) {
+    std::vector<uint64_t> weights_mapping;
+    const auto& model_rt = model->get_rt_info();
+    const auto mapping = model_rt.find(weights_mapping_key);
+    if (mapping != model_rt.end() && mapping->second.is<std::vector<uint64_t>>())
+        weights_mapping = mapping->second.as<std::vector<uint64_t>>();
+
+    AttributesHasher hasher(seed, weights_mapping);
+    std::unordered_map<const ov::Node*, size_t> ids;
+    for (const auto& op : model->get_ordered_ops()) {
+        ids.emplace(op.get(), ids.size());
+        const auto& type_info = op->get_type_info();
+        seed = hash_combine(seed, std::string(type_info.name));
+        seed = hash_combine(seed, std::string(type_info.get_version()));
+        seed = hash_combine(seed, op->get_friendly_name());
+        for (const auto& input : op->inputs()) {
+            const auto& source = input.get_source_output();
+            seed = hash_combine(seed, ids.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+            seed = hash_rt_info(seed, input.get_rt_info());
+        }
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            const auto& shape = output.get_partial_shape();
+            seed = hash_combine(seed, shape.rank().is_dynamic());
+            if (shape.rank().is_static()) {
+                for (const auto& dim : shape) {
+                    seed = hash_combine(seed, dim.get_min_length());
+                    seed = hash_combine(seed, dim.get_max_length());
+                }
+            }
+            std::vector<std::string> names(output.get_names().begin(), output.get_names().end());
+            std::sort(names.begin(), names.end());
+            for (const auto& name : names)
+                seed = hash_combine(seed, name);
+            seed = hash_rt_info(seed, output.get_rt_info());
+        }
+        if (!op->visit_attributes(hasher) || !hasher.is_complete())
+            return false;
+    }
+    for (const auto& parameter : model->get_parameters())
+        seed = hash_combine(seed, ids.at(parameter.get()));
+    for (const auto& result : model->get_results())
+        seed = hash_combine(seed, ids.at(result.get()));
+    for (const auto& sink : model->get_sinks())
+        seed = hash_combine(seed, ids.at(sink.get()));
+    return true;
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -70,12 +316,17 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     IE_ASSERT(network.getFunction());
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function, the serialization is used only if the function can't be hashed directly
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(net.getFunction());
+    if (!hash_model(net.getFunction(), seed)) {
+        seed = 0;
+        ov::pass::Manager hash_manager;
+        hash_manager.register_pass<ov::pass::Hash>(seed);
+        hash_manager.run_passes(net.getFunction());
+    }
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
@@ -84,13 +335,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
 
     // 3. Add runtime information which may not be serialized
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = hash_combine(seed, strm.str());
-        }
+        seed = hash_rt_info(seed, op->get_rt_info());
     }
 
     // 4. Add inputs info
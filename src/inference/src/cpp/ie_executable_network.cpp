@@ -4,6 +4,10 @@
 
 #include "cpp/ie_executable_network.hpp"
 
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 #include "any_copy.hpp"
 #include "cpp/exception2status.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
@@ -118,6 +122,72 @@ ExecutableNetwork::operator bool() const noexcept {
 
 namespace ov {
 
+struct InferRequestPool {
+    void release(InferRequest request) {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (created > maxSize) {
+                // the pool was shrunk while the request was borrowed
+                created--;
+            } else {
+                idle.push_back(std::move(request));
+            }
+        }
+        released.notify_one();
+    }
+
+    std::mutex mutex;
+    std::condition_variable released;
+    std::vector<InferRequest> idle;
+    size_t created = 0;
+    size_t maxSize = 0;  // 0 - not set yet
+};
+
+PooledInferRequest::PooledInferRequest(const std::shared_ptr<InferRequestPool>& pool, InferRequest request)
+    : _pool{pool},
+      _request{std::move(request)} {}
+
+PooledInferRequest::PooledInferRequest(PooledInferRequest&& other) noexcept
+    : _pool{std::move(other._pool)},
+      _request{std::move(other._request)} {
+    other._pool = nullptr;
+}
+
+PooledInferRequest& PooledInferRequest::operator=(PooledInferRequest&& other) noexcept {
+    if (this != &other) {
+        release();
+        _pool = std::move(other._pool);
+        _request = std::move(other._request);
+        other._pool = nullptr;
+    }
+    return *this;
+}
+
+PooledInferRequest::~PooledInferRequest() {
+    release();
+}
+
+void PooledInferRequest::release() {
+    if (_pool != nullptr) {
+        _pool->release(std::move(_request));
+        _pool = nullptr;
+        _request = {};
+    }
+}
+
+InferRequest& PooledInferRequest::operator*() {
+    OPENVINO_ASSERT(_pool != nullptr, "PooledInferRequest owns no request.");
+    return _request;
+}
+
+InferRequest* PooledInferRequest::operator->() {
+    return &**this;
+}
+
+PooledInferRequest::operator bool() const noexcept {
+    return _pool != nullptr;
+}
+
 CompiledModel::~CompiledModel() {
     _impl = {};
 }
@@ -125,7 +195,8 @@ CompiledModel::~CompiledModel() {
 CompiledModel::CompiledModel(const std::shared_ptr<ie::IExecutableNetworkInternal>& impl,
                              const std::shared_ptr<void>& so)
     : _impl{impl},
-      _so{so} {
+      _so{so},
+      _pool{std::make_shared<InferRequestPool>()} {
     OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
 }
 
@@ -204,6 +275,56 @@ InferRequest CompiledModel::create_infer_request() {
     OV_EXEC_NET_CALL_STATEMENT(return {_impl->CreateInferRequest(), _so});
 }
 
+PooledInferRequest CompiledModel::acquire_infer_request() {
+    OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
+    {
+        std::unique_lock<std::mutex> lock{_pool->mutex};
+        if (0 == _pool->maxSize) {
+            unsigned int optimalSize = 1;
+            try {
+                optimalSize = get_property(ov::optimal_number_of_infer_requests);
+            } catch (const ov::Exception&) {
+                // the device doesn't report the optimal number of the requests, the pool grows by the explicit limit
+            }
+            _pool->maxSize = std::max(1u, optimalSize);
+        }
+        _pool->released.wait(lock, [this] {
+            return !_pool->idle.empty() || _pool->created < _pool->maxSize;
+        });
+        if (!_pool->idle.empty()) {
+            // the most recently used request is taken as its tensors are likely still in the cache
+            auto request = std::move(_pool->idle.back());
+            _pool->idle.pop_back();
+            return {_pool, std::move(request)};
+        }
+        _pool->created++;
+    }
+    try {
+        return {_pool, create_infer_request()};
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock{_pool->mutex};
+            _pool->created--;
+        }
+        _pool->released.notify_one();
+        throw;
+    }
+}
+
+void CompiledModel::set_infer_request_pool_size(size_t max_size) {
+    OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
+    OPENVINO_ASSERT(max_size > 0, "The infer request pool size should be positive.");
+    {
+        std::lock_guard<std::mutex> lock{_pool->mutex};
+        _pool->maxSize = max_size;
+        while (_pool->created > _pool->maxSize && !_pool->idle.empty()) {
+            _pool->idle.pop_back();
+            _pool->created--;
+        }
+    }
+    _pool->released.notify_all();
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_EXEC_NET_CALL_STATEMENT(_impl->Export(networkModel));
 }
@@ -299,7 +299,7 @@ void InferRequest::set_input_tensor(size_t idx, const Tensor& tensor) {
                         " was not found! The model has only ",
                         inputs.size(),
                         " inputs.");
-        set_tensor(inputs.at(idx)->output(0), tensor);
+        _impl->SetInputBlob(idx, tensor._impl);
     });
 }
 
@@ -308,7 +308,7 @@ void InferRequest::set_input_tensor(const Tensor& tensor) {
         const auto inputs = _impl->GetInputs();
         OPENVINO_ASSERT(inputs.size() == 1,
                         "set_input_tensor() must be called on a function with exactly one parameter.");
-        set_tensor(inputs.at(0)->output(0), tensor);
+        _impl->SetInputBlob(0, tensor._impl);
     });
 }
 
@@ -343,7 +343,7 @@ void InferRequest::set_output_tensor(size_t idx, const Tensor& tensor) {
                         " was not found! The model has only ",
                         outputs.size(),
                         " outputs.");
-        set_tensor(outputs.at(idx)->output(0), tensor);
+        _impl->SetOutputBlob(idx, tensor._impl);
     });
 }
 
@@ -352,7 +352,7 @@ void InferRequest::set_output_tensor(const Tensor& tensor) {
         const auto outputs = _impl->GetOutputs();
         OPENVINO_ASSERT(outputs.size() == 1,
                         "set_output_tensor() must be called on a function with exactly one parameter.");
-        set_tensor(outputs.at(0)->output(0), tensor);
+        _impl->SetOutputBlob(0, tensor._impl);
     });
 }
 
@@ -383,11 +383,11 @@ Tensor InferRequest::get_tensor(const std::string& name) {
 }
 
 Tensor InferRequest::get_input_tensor(size_t idx) {
-    OV_INFER_REQ_CALL_STATEMENT({ return get_tensor(_impl->GetInputs().at(idx)->output(0)); });
+    OV_INFER_REQ_CALL_STATEMENT({ return {_impl->GetInputBlob(idx), _so}; });
 }
 
 Tensor InferRequest::get_output_tensor(size_t idx) {
-    OV_INFER_REQ_CALL_STATEMENT({ return get_tensor(_impl->GetOutputs().at(idx)->output(0)); });
+    OV_INFER_REQ_CALL_STATEMENT({ return {_impl->GetOutputBlob(idx), _so}; });
 }
 
 Tensor InferRequest::get_input_tensor() {
@@ -396,7 +396,7 @@ Tensor InferRequest::get_input_tensor() {
         if (inputs.size() != 1) {
             throw ov::Exception("get_input_tensor() must be called on a function with exactly one parameter.");
         }
-        return get_tensor(inputs.at(0)->output(0));
+        return {_impl->GetInputBlob(0), _so};
     });
 }
 
@@ -406,7 +406,7 @@ Tensor InferRequest::get_output_tensor() {
         if (outputs.size() != 1) {
             throw ov::Exception("get_output_tensor() must be called on a function with exactly one parameter.");
         }
-        return get_tensor(outputs.at(0)->output(0));
+        return {_impl->GetOutputBlob(0), _so};
     });
 }
 
@@ -418,6 +418,12 @@ void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->Cancel();)
 }
 
+void InferRequest::set_scheduling(bool latency_sensitive,
+                                  const std::chrono::microseconds timeout,
+                                  bool drop_expired) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetScheduling(latency_sensitive, timeout, drop_expired);)
+}
+
 std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
     OV_INFER_REQ_CALL_STATEMENT({
         auto ieInfos = _impl->GetPerformanceCounts();
@@ -24,6 +24,23 @@
 
 namespace InferenceEngine {
 
+namespace {
+// the names the blobs of the function inputs and outputs are addressed by, the result is named by its source output
+std::vector<std::string> getBlobNames(const std::vector<std::shared_ptr<const ov::Node>>& nodes) {
+    std::vector<std::string> names;
+    names.reserve(nodes.size());
+    for (const auto& node : nodes) {
+        auto port = node->output(0);
+        if (ov::is_type<ov::op::v0::Result>(node)) {
+            const auto& source = node->input_value(0);
+            port = ov::Output<const ov::Node>(source.get_node(), source.get_index());
+        }
+        names.push_back(ngraph::op::util::create_ie_output_name(port));
+    }
+    return names;
+}
+}  // namespace
+
 IE_SUPPRESS_DEPRECATED_START
 
 IInferRequestInternal::~IInferRequestInternal() {}
@@ -36,7 +53,9 @@ IInferRequestInternal::IInferRequestInternal(const InputsDataMap& networkInputs,
 IInferRequestInternal::IInferRequestInternal(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                              const std::vector<std::shared_ptr<const ov::Node>>& outputs)
     : _parameters(inputs),
-      _results(outputs) {
+      _results(outputs),
+      _parameterNames(getBlobNames(inputs)),
+      _resultNames(getBlobNames(outputs)) {
     const auto& create_old_data = [](const ov::Output<const ov::Node>& output) -> InferenceEngine::DataPtr {
         auto name = ngraph::op::util::get_ie_output_name(output);
         auto shape = output.get_partial_shape();
@@ -81,6 +100,10 @@ void IInferRequestInternal::Cancel() {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetScheduling(bool, std::chrono::microseconds, bool) {
+    IE_THROW(NotImplemented);
+}
+
 std::map<std::string, InferenceEngineProfileInfo> IInferRequestInternal::GetPerformanceCounts() const {
     IE_THROW(NotImplemented);
 }
@@ -399,6 +422,28 @@ BatchedBlob::Ptr IInferRequestInternal::GetBlobs(const std::string& name) {
     return nullptr;
 }
 
+void IInferRequestInternal::SetInputBlob(size_t idx, const Blob::Ptr& data) {
+    SetBlob(_parameterNames.at(idx), data);
+}
+
+void IInferRequestInternal::SetOutputBlob(size_t idx, const Blob::Ptr& data) {
+    SetBlob(_resultNames.at(idx), data);
+}
+
+Blob::Ptr IInferRequestInternal::GetInputBlob(size_t idx) {
+    const auto& name = _parameterNames.at(idx);
+    OPENVINO_ASSERT(!GetBlobs(name),
+                    "get_tensor shall not be used together with batched "
+                    "set_tensors/set_input_tensors for name '",
+                    name,
+                    "'");
+    return GetBlob(name);
+}
+
+Blob::Ptr IInferRequestInternal::GetOutputBlob(size_t idx) {
+    return GetBlob(_resultNames.at(idx));
+}
+
 void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& data, const PreProcessInfo& info) {
     InputInfo::Ptr foundInput;
     DataPtr foundOutput;
@@ -641,6 +686,8 @@ void IInferRequestInternal::setModelInputsOutputs(const std::vector<std::shared_
                                                   const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
     _parameters = inputs;
     _results = outputs;
+    _parameterNames = getBlobNames(inputs);
+    _resultNames = getBlobNames(outputs);
 }
 
 const std::vector<std::shared_ptr<const ov::Node>>& IInferRequestInternal::GetInputs() const {
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+
+static inline __m256i strided_indices(size_t stride) {
+    return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride)));
+}
+
+void blob_copy_split_row_32bit_avx2(const uint32_t* src,
+                                    uint32_t* dst,
+                                    size_t W_src_stride,
+                                    size_t C_dst_stride,
+                                    size_t C,
+                                    size_t W) {
+    const __m256i indices = strided_indices(W_src_stride);
+    for (size_t c = 0; c < C; c++) {
+        const uint32_t* src_c = src + c;
+        uint32_t* dst_c = dst + c * C_dst_stride;
+
+        size_t w = 0;
+        for (; w + 8 <= W; w += 8) {
+            const __m256i r = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src_c + w * W_src_stride), indices, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_c + w), r);
+        }
+
+        for (; w < W; w++) {
+            dst_c[w] = src_c[w * W_src_stride];
+        }
+    }
+}
+
+void blob_copy_merge_row_32bit_avx2(const uint32_t* src,
+                                    uint32_t* dst,
+                                    size_t C_src_stride,
+                                    size_t W_dst_stride,
+                                    size_t C,
+                                    size_t W) {
+    const __m256i indices = strided_indices(C_src_stride);
+    for (size_t w = 0; w < W; w++) {
+        const uint32_t* src_w = src + w;
+        uint32_t* dst_w = dst + w * W_dst_stride;
+
+        size_t c = 0;
+        for (; c + 8 <= C; c += 8) {
+            const __m256i r = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src_w + c * C_src_stride), indices, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_w + c), r);
+        }
+
+        for (; c < C; c++) {
+            dst_w[c] = src_w[c * C_src_stride];
+        }
+    }
+}
+
+}  // namespace InferenceEngine
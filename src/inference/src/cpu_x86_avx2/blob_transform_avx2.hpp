@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX2 (w/o threads)
+//
+// Copy one row of the 32-bit elements (FP32, I32, U32) with any number of channels. The strides are in elements,
+// the gather indices are 32-bit, so 8 * stride shall fit into int32_t.
+//
+//------------------------------------------------------------------------
+
+// dst[c * C_dst_stride + w] = src[w * W_src_stride + c]
+void blob_copy_split_row_32bit_avx2(const uint32_t* src,
+                                    uint32_t* dst,
+                                    size_t W_src_stride,
+                                    size_t C_dst_stride,
+                                    size_t C,
+                                    size_t W);
+
+// dst[w * W_dst_stride + c] = src[c * C_src_stride + w]
+void blob_copy_merge_row_32bit_avx2(const uint32_t* src,
+                                    uint32_t* dst,
+                                    size_t C_src_stride,
+                                    size_t W_dst_stride,
+                                    size_t C,
+                                    size_t W);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+static inline __m256 f16tof32_avx2(__m128i x) {
+    const __m256i h = _mm256_cvtepu16_epi32(x);
+
+    // shift the exponent and the mantissa to their f32 positions and change the exponent bias from 15 to 127
+    __m256i u = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7FFF)), 13);
+    const __m256i exp = _mm256_and_si256(u, _mm256_set1_epi32(0x0F800000));
+    u = _mm256_add_epi32(u, _mm256_set1_epi32((127 - 15) << 23));
+
+    // NAN and INF get the maximal exponent, NAN is made quiet
+    const __m256i is_nan_inf = _mm256_cmpeq_epi32(exp, _mm256_set1_epi32(0x0F800000));
+    const __m256i is_nan = _mm256_andnot_si256(
+        _mm256_cmpeq_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x03FF)), _mm256_setzero_si256()),
+        is_nan_inf);
+    u = _mm256_add_epi32(u, _mm256_and_si256(is_nan_inf, _mm256_set1_epi32((128 - 16) << 23)));
+    u = _mm256_or_si256(u, _mm256_and_si256(is_nan, _mm256_set1_epi32(0x00400000)));
+
+    // zeros and denormals are normalized by the f32 subtraction, which is exact for them
+    const __m256i is_denormal = _mm256_cmpeq_epi32(exp, _mm256_setzero_si256());
+    const __m256i denormal = _mm256_castps_si256(
+        _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(u, _mm256_set1_epi32(1 << 23))),
+                      _mm256_castsi256_ps(_mm256_set1_epi32(113 << 23))));
+    u = _mm256_blendv_epi8(u, denormal, is_denormal);
+
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+    return _mm256_castsi256_ps(_mm256_or_si256(u, sign));
+}
+
+static inline __m128i f32tof16_avx2(__m256 x) {
+    const __m256i exp_mask = _mm256_set1_epi32(0x7F800000);
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    const __m256i v = _mm256_castps_si256(x);
+    const __m256i s = _mm256_and_si256(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x8000));
+    const __m256i a = _mm256_and_si256(v, _mm256_set1_epi32(0x7FFFFFFF));
+    const __m256i exp = _mm256_and_si256(a, exp_mask);
+
+    // round to nearest f16 by adding the half of f16 ULP
+    const __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(exp), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+    const __m256 r = _mm256_add_ps(_mm256_castsi256_ps(a), half_ulp);
+
+    // change exp bias from 127 to 15 and round to f16
+    __m256i res = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(r), _mm256_set1_epi32((127 - 15) << 23)), 13);
+    // more than maximal allowed value is saturated
+    res = _mm256_blendv_epi8(res,
+                             _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF),
+                             _mm256_castps_si256(_mm256_cmp_ps(r, max16, _CMP_GE_OQ)));
+    // between min16/2 and min16 is min16
+    res = _mm256_blendv_epi8(res, _mm256_set1_epi32(1 << 10), _mm256_castps_si256(_mm256_cmp_ps(r, min16, _CMP_LT_OQ)));
+    // less than min16/2 is 0
+    res = _mm256_blendv_epi8(res,
+                             _mm256_setzero_si256(),
+                             _mm256_castps_si256(_mm256_cmp_ps(r, _mm256_mul_ps(min16, _mm256_set1_ps(0.5f)), _CMP_LT_OQ)));
+    // NAN is made quiet, INF stays INF
+    const __m256i is_nan_inf = _mm256_cmpeq_epi32(exp, exp_mask);
+    const __m256i is_inf = _mm256_cmpeq_epi32(a, exp_mask);
+    const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(a, 23 - 10), _mm256_set1_epi32(0x0200));
+    const __m256i nan_inf = _mm256_blendv_epi8(nan, _mm256_set1_epi32(0x7C00), is_inf);
+    res = _mm256_blendv_epi8(res, nan_inf, is_nan_inf);
+
+    // the values fit into 16 bits, so the packing doesn't saturate
+    res = _mm256_or_si256(_mm256_and_si256(res, _mm256_set1_epi32(0xFFFF)), s);
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(res, res), 0xD8);
+    return _mm256_castsi256_si128(packed);
+}
+
+void f16tof32Arrays_avx2(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256 f = f16tof32_avx2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(f, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx2(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256 f = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), f32tof16_avx2(f));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
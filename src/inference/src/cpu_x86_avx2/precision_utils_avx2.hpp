@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// The half-precision conversions manually vectored for AVX2 (w/o threads)
+//
+// The results are bit-exact with the scalar f16tof32 / f32tof16, in particular f32tof16 rounds by adding the half
+// of ULP, flushes the denormals to zero and saturates, so the F16C conversions can't be used.
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_avx2(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_avx2(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx512/blob_transform_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512
+
+namespace InferenceEngine {
+
+static inline __m512i strided_indices(size_t stride) {
+    return _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                              _mm512_set1_epi32(static_cast<int>(stride)));
+}
+
+void blob_copy_split_row_32bit_avx512(const uint32_t* src,
+                                      uint32_t* dst,
+                                      size_t W_src_stride,
+                                      size_t C_dst_stride,
+                                      size_t C,
+                                      size_t W) {
+    const __m512i indices = strided_indices(W_src_stride);
+    for (size_t c = 0; c < C; c++) {
+        const uint32_t* src_c = src + c;
+        uint32_t* dst_c = dst + c * C_dst_stride;
+
+        size_t w = 0;
+        for (; w + 16 <= W; w += 16) {
+            const __m512i r = _mm512_i32gather_epi32(indices, src_c + w * W_src_stride, 4);
+            _mm512_storeu_si512(dst_c + w, r);
+        }
+
+        // the tail is gathered with the mask instead of the scalar loop
+        if (w < W) {
+            const __mmask16 mask = static_cast<__mmask16>((1u << (W - w)) - 1);
+            const __m512i r =
+                _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, indices, src_c + w * W_src_stride, 4);
+            _mm512_mask_storeu_epi32(dst_c + w, mask, r);
+        }
+    }
+}
+
+void blob_copy_merge_row_32bit_avx512(const uint32_t* src,
+                                      uint32_t* dst,
+                                      size_t C_src_stride,
+                                      size_t W_dst_stride,
+                                      size_t C,
+                                      size_t W) {
+    const __m512i indices = strided_indices(C_src_stride);
+    for (size_t w = 0; w < W; w++) {
+        const uint32_t* src_w = src + w;
+        uint32_t* dst_w = dst + w * W_dst_stride;
+
+        size_t c = 0;
+        for (; c + 16 <= C; c += 16) {
+            const __m512i r = _mm512_i32gather_epi32(indices, src_w + c * C_src_stride, 4);
+            _mm512_storeu_si512(dst_w + c, r);
+        }
+
+        if (c < C) {
+            const __mmask16 mask = static_cast<__mmask16>((1u << (C - c)) - 1);
+            const __m512i r =
+                _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, indices, src_w + c * C_src_stride, 4);
+            _mm512_mask_storeu_epi32(dst_w + c, mask, r);
+        }
+    }
+}
+
+}  // namespace InferenceEngine
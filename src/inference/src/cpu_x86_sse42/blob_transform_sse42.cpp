@@ -237,173 +237,4 @@ void blob_copy_4d_merge_f32c3(const float* src_ptr,
         }
 }
 
-void blob_copy_5d_split_u8c3(const uint8_t* src_ptr,
-                             uint8_t* dst_ptr,
-                             size_t N_src_stride,
-                             size_t D_src_stride,
-                             size_t H_src_stride,
-                             size_t N_dst_stride,
-                             size_t D_dst_stride,
-                             size_t H_dst_stride,
-                             size_t C_dst_stride,
-                             int N,
-                             int D,
-                             int H,
-                             int W) {
-    for (int n = 0; n < N; n++)
-        for (int d = 0; d < D; d++) {
-            for (int h = 0; h < H; h++) {
-                const uint8_t* src = src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride;
-                uint8_t* dst0 = dst_ptr + n * N_dst_stride + d * D_dst_stride + 0 * C_dst_stride + h * H_dst_stride;
-                uint8_t* dst1 = dst_ptr + n * N_dst_stride + d * D_dst_stride + 1 * C_dst_stride + h * H_dst_stride;
-                uint8_t* dst2 = dst_ptr + n * N_dst_stride + d * D_dst_stride + 2 * C_dst_stride + h * H_dst_stride;
-
-                int w = 0;
-
-                // SIMD128 manually
-                for (; w < W - 16; w += 16) {
-                    __m128i r0, r1, r2;
-                    mm_load_deinterleave(&src[3 * w], r0, r1, r2);
-                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst0 + w), r0);
-                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst1 + w), r1);
-                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst2 + w), r2);
-                }
-
-                for (; w < W; w++) {
-                    dst0[w] = src[3 * w + 0];
-                    dst1[w] = src[3 * w + 1];
-                    dst2[w] = src[3 * w + 2];
-                }
-            }
-        }
-}
-
-void blob_copy_5d_split_f32c3(const float* src_ptr,
-                              float* dst_ptr,
-                              size_t N_src_stride,
-                              size_t D_src_stride,
-                              size_t H_src_stride,
-                              size_t N_dst_stride,
-                              size_t D_dst_stride,
-                              size_t H_dst_stride,
-                              size_t C_dst_stride,
-                              int N,
-                              int D,
-                              int H,
-                              int W) {
-    for (int n = 0; n < N; n++)
-        for (int d = 0; d < D; d++) {
-            for (int h = 0; h < H; h++) {
-                const float* src = src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride;
-                float* dst0 = dst_ptr + n * N_dst_stride + d * D_dst_stride + 0 * C_dst_stride + h * H_dst_stride;
-                float* dst1 = dst_ptr + n * N_dst_stride + d * D_dst_stride + 1 * C_dst_stride + h * H_dst_stride;
-                float* dst2 = dst_ptr + n * N_dst_stride + d * D_dst_stride + 2 * C_dst_stride + h * H_dst_stride;
-
-                int w = 0;
-
-                // SIMD128 manually
-                for (; w < W - 4; w += 4) {
-                    __m128 r0, r1, r2;
-                    mm_load_deinterleave(&src[3 * w], r0, r1, r2);
-                    _mm_storeu_ps(&dst0[w], r0);
-                    _mm_storeu_ps(&dst1[w], r1);
-                    _mm_storeu_ps(&dst2[w], r2);
-                }
-
-                for (; w < W; w++) {
-                    dst0[w] = src[3 * w + 0];
-                    dst1[w] = src[3 * w + 1];
-                    dst2[w] = src[3 * w + 2];
-                }
-            }
-        }
-}
-
-void blob_copy_5d_merge_u8c3(const uint8_t* src_ptr,
-                             uint8_t* dst_ptr,
-                             size_t N_src_stride,
-                             size_t D_src_stride,
-                             size_t H_src_stride,
-                             size_t C_src_stride,
-                             size_t N_dst_stride,
-                             size_t D_dst_stride,
-                             size_t H_dst_stride,
-                             int N,
-                             int D,
-                             int H,
-                             int W) {
-    for (int n = 0; n < N; n++)
-        for (int d = 0; d < D; d++) {
-            for (int h = 0; h < H; h++) {
-                const uint8_t* src0 =
-                    src_ptr + n * N_src_stride + 0 * C_src_stride + d * D_src_stride + h * H_src_stride;
-                const uint8_t* src1 =
-                    src_ptr + n * N_src_stride + 1 * C_src_stride + d * D_src_stride + h * H_src_stride;
-                const uint8_t* src2 =
-                    src_ptr + n * N_src_stride + 2 * C_src_stride + d * D_src_stride + h * H_src_stride;
-
-                uint8_t* dst = dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride;
-
-                int w = 0;
-
-                // SIMD128 manually
-                for (; w < W - 16; w += 16) {
-                    __m128i r0, r1, r2;
-                    r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + w));
-                    r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + w));
-                    r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src2 + w));
-                    mm_store_interleave(&dst[3 * w], r0, r1, r2);
-                }
-
-                for (; w < W; w++) {
-                    dst[3 * w + 0] = src0[w];
-                    dst[3 * w + 1] = src1[w];
-                    dst[3 * w + 2] = src2[w];
-                }
-            }
-        }
-}
-
-void blob_copy_5d_merge_f32c3(const float* src_ptr,
-                              float* dst_ptr,
-                              size_t N_src_stride,
-                              size_t D_src_stride,
-                              size_t H_src_stride,
-                              size_t C_src_stride,
-                              size_t N_dst_stride,
-                              size_t D_dst_stride,
-                              size_t H_dst_stride,
-                              int N,
-                              int D,
-                              int H,
-                              int W) {
-    for (int n = 0; n < N; n++)
-        for (int d = 0; d < D; d++) {
-            for (int h = 0; h < H; h++) {
-                const float* src0 = src_ptr + n * N_src_stride + 0 * C_src_stride + d * D_src_stride + h * H_src_stride;
-                const float* src1 = src_ptr + n * N_src_stride + 1 * C_src_stride + d * D_src_stride + h * H_src_stride;
-                const float* src2 = src_ptr + n * N_src_stride + 2 * C_src_stride + d * D_src_stride + h * H_src_stride;
-
-                float* dst = dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride;
-
-                int w = 0;
-
-                // SIMD128 manually
-                for (; w < W - 4; w += 4) {
-                    __m128 r0, r1, r2;
-                    r0 = _mm_loadu_ps(&src0[w]);
-                    r1 = _mm_loadu_ps(&src1[w]);
-                    r2 = _mm_loadu_ps(&src2[w]);
-                    mm_store_interleave(&dst[3 * w], r0, r1, r2);
-                }
-
-                for (; w < W; w++) {
-                    dst[3 * w + 0] = src0[w];
-                    dst[3 * w + 1] = src1[w];
-                    dst[3 * w + 2] = src2[w];
-                }
-            }
-        }
-}
-
 }  // namespace InferenceEngine
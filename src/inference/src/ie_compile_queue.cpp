@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_compile_queue.hpp"
+
+#include <algorithm>
+
+namespace InferenceEngine {
+
+CompileQueue::CompileQueue(size_t maxThreads) : m_maxThreads(std::max<size_t>(maxThreads, 1)) {}
+
+CompileQueue::~CompileQueue() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopped = true;
+    }
+    m_queueCondVar.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void CompileQueue::push(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+        // every queued task which no idle thread is going to take starts a new thread while the limit allows
+        if (m_tasks.size() > m_idleThreads && m_threads.size() < m_maxThreads) {
+            m_threads.emplace_back(&CompileQueue::worker, this);
+        }
+    }
+    m_queueCondVar.notify_one();
+}
+
+void CompileQueue::worker() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idleThreads++;
+            m_queueCondVar.wait(lock, [this] {
+                return m_stopped || !m_tasks.empty();
+            });
+            m_idleThreads--;
+            // the queued tasks are finished even if the queue is stopped, so nobody waits for them forever
+            if (m_tasks.empty()) {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        try {
+            task();
+        } catch (...) {
+        }
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the Inference Engine Compile Queue class C++ API
+ *
+ * @file ie_compile_queue.hpp
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief This class runs the network compilation tasks on a bounded number of threads
+ * Several networks are compiled in parallel, but the machine isn't oversubscribed when many of them are queued at once
+ * The threads are started on demand, up to the limit, and live until the queue destruction
+ *
+ * Usage example:
+ *     CompileQueue queue(4);
+ *     queue.push([] { <compile the network> });
+ */
+class CompileQueue {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Constructs the queue, doesn't start the threads
+     *
+     * @param maxThreads Maximum number of the tasks running in parallel
+     */
+    explicit CompileQueue(size_t maxThreads);
+    CompileQueue(const CompileQueue&) = delete;
+    CompileQueue& operator=(const CompileQueue&) = delete;
+
+    /**
+     * @brief Destructor, runs the remaining queued tasks and joins the threads
+     */
+    ~CompileQueue();
+
+    /**
+     * @brief Queues the task. The task shall handle its exceptions, the escaped ones are ignored
+     *
+     * @param task The task to run on one of the queue threads
+     */
+    void push(Task task);
+
+private:
+    void worker();
+
+    const size_t m_maxThreads;
+    size_t m_idleThreads = 0;
+    bool m_stopped = false;
+    std::mutex m_mutex;
+    std::condition_variable m_queueCondVar;
+    std::deque<Task> m_tasks;
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace InferenceEngine
@@ -6,6 +6,9 @@
 
 #include <sys/stat.h>
 
+#include <exception>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -22,12 +25,15 @@
 #include "file_utils.h"
 #include "ie_cache_guard.hpp"
 #include "ie_cache_manager.hpp"
+#include "ie_compile_queue.hpp"
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_remote_context.hpp"
+#include "ie_system_conf.h"
+#include "load_time_stats.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -135,6 +141,9 @@ ov::AnyMap flatten_sub_properties(const std::string& device, const ov::AnyMap& p
 
 }  // namespace
 
+// Is called by the network loading as soon as the network is compiled, before it's exported to the cache
+using CompiledCallback = std::function<void(const ov::SoPtr<ie::IExecutableNetworkInternal>&)>;
+
 class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore> {
     mutable std::map<std::string, ov::InferencePlugin> plugins;
 
@@ -159,6 +168,13 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
                 config.erase(it);
             }
+
+            it = config.find(ov::device::allow_list.name());
+            if (it != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _deviceAllowList = ie::DeviceIDParser::getHeteroDevices(it->second);
+                config.erase(it);
+            }
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -167,9 +183,16 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig;
         }
 
+        // The devices probed by GetAvailableDevices, empty list means all the registered ones
+        std::vector<std::string> getDeviceAllowList() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _deviceAllowList;
+        }
+
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::vector<std::string> _deviceAllowList;
     };
 
     // Core settings (cache config, etc)
@@ -210,9 +233,16 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    // to create each plugin once, while the different plugins are created in parallel
+    mutable std::map<std::string, std::shared_ptr<std::mutex>> pluginLoadMutexes;
 
     const bool newAPI;
 
+    // Runs the asynchronous network loading, created on the first use. It's the last member as the running tasks use
+    // the plugins and the cache, so it finishes them first on destruction
+    std::once_flag compileQueueOnce;
+    std::unique_ptr<ie::CompileQueue> compileQueue;
+
     bool DeviceSupportsImportExport(const std::string& deviceName) const override {
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         auto plugin = GetCPPPluginByName(parsed._deviceName);
@@ -247,16 +277,25 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                                                  const ie::RemoteContext::Ptr& context,
                                                                  const std::string& blobID,
                                                                  const std::string& modelPath = std::string(),
-                                                                 bool forceDisableCache = false) {
+                                                                 bool forceDisableCache = false,
+                                                                 const CompiledCallback& onCompiled = {}) {
         OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_impl");
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
-        execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
-                              : plugin.compile_model(network, parsedConfig);
+        {
+            ov::load_time_stats::Scope scope{"compile_model/plugin"};
+            execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
+                                  : plugin.compile_model(network, parsedConfig);
+        }
+        if (onCompiled) {
+            // the network can be used already, while it's exported to the cache
+            onCompiled(execNetwork);
+        }
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
             try {
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
+                ov::load_time_stats::Scope scope{"compile_model/cache_export"};
                 cacheManager->writeCacheEntry(blobID, [&](std::ostream& networkStream) {
                     networkStream << ie::CompiledBlobHeader(
                         ie::GetInferenceEngineVersion()->buildNumber,
@@ -288,6 +327,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 OV_ITT_SCOPE(FIRST_INFERENCE,
                              ie::itt::domains::IE_LT,
                              "Core::LoadNetworkFromCache::ReadStreamAndImport");
+                ov::load_time_stats::Scope scope{"compile_model/cache_import"};
                 try {
                     ie::CompiledBlobHeader header;
                     networkStream >> header;
@@ -358,6 +398,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                      const std::string& deviceFamily,
                                      const ov::InferencePlugin& plugin,
                                      const std::map<std::string, std::string>& config) const {
+        ov::load_time_stats::Scope scope{"compile_model/cache_hash"};
         auto compileConfig = CreateCompileConfig(plugin, deviceFamily, config);
         return ie::NetworkCompilationContext::computeHash(network, compileConfig);
     }
@@ -366,6 +407,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                   const std::string& deviceFamily,
                                   const ov::InferencePlugin& plugin,
                                   const std::map<std::string, std::string>& config) const {
+        ov::load_time_stats::Scope scope{"compile_model/cache_hash"};
         auto compileConfig = CreateCompileConfig(plugin, deviceFamily, config);
         return ie::NetworkCompilationContext::computeHash(modelName, compileConfig);
     }
@@ -479,11 +521,19 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
+        ov::load_time_stats::Scope scope{"read_model"};
         return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model, const ie::Blob::CPtr& weights) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from memory");
+        ov::load_time_stats::Scope scope{"read_model"};
+        return InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI);
+    }
+
+    ie::CNNNetwork ReadNetwork(std::istream& model, std::istream& weights) const {
+        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from streams");
+        ov::load_time_stats::Scope scope{"read_model"};
         return InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI);
     }
 
@@ -500,6 +550,7 @@ public:
                                                           const std::shared_ptr<ie::RemoteContext>& context,
                                                           const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::RemoteContext");
+        ov::load_time_stats::Scope scope{"compile_model"};
         if (context == nullptr) {
             IE_THROW() << "Remote context is null";
         }
@@ -610,7 +661,15 @@ public:
     ie::SoExecutableNetworkInternal LoadNetwork(const ie::CNNNetwork& network,
                                                 const std::string& deviceNameOrig,
                                                 const std::map<std::string, std::string>& config) override {
+        return LoadNetwork(network, deviceNameOrig, config, {});
+    }
+
+    ie::SoExecutableNetworkInternal LoadNetwork(const ie::CNNNetwork& network,
+                                                const std::string& deviceNameOrig,
+                                                const std::map<std::string, std::string>& config,
+                                                const CompiledCallback& onCompiled) {
         OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::CNN");
+        ov::load_time_stats::Scope scope{"compile_model"};
         std::string deviceName = deviceNameOrig;
         std::map<std::string, std::string> config_with_batch = config;
         // if auto-batching is applicable, the below function will patch the device name and config accordingly:
@@ -631,7 +690,14 @@ public:
             auto lock = cacheGuard.getHashLock(hash);
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
             if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
+                res = compile_model_impl(network,
+                                         plugin,
+                                         parsed._config,
+                                         nullptr,
+                                         hash,
+                                         {},
+                                         forceDisableCache,
+                                         onCompiled);
             } else {
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
@@ -645,7 +711,15 @@ public:
     ie::SoExecutableNetworkInternal LoadNetwork(const std::string& modelPath,
                                                 const std::string& deviceName,
                                                 const std::map<std::string, std::string>& config) override {
+        return LoadNetwork(modelPath, deviceName, config, {});
+    }
+
+    ie::SoExecutableNetworkInternal LoadNetwork(const std::string& modelPath,
+                                                const std::string& deviceName,
+                                                const std::map<std::string, std::string>& config,
+                                                const CompiledCallback& onCompiled) {
         OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Path");
+        ov::load_time_stats::Scope scope{"compile_model"};
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
@@ -657,7 +731,14 @@ public:
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
             if (!loadedFromCache) {
                 auto cnnNetwork = ReadNetwork(modelPath, std::string());
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                res = compile_model_impl(cnnNetwork,
+                                         plugin,
+                                         parsed._config,
+                                         nullptr,
+                                         hash,
+                                         modelPath,
+                                         false,
+                                         onCompiled);
             }
         } else if (cacheManager) {
             res = plugin.compile_model(modelPath, parsed._config);
@@ -668,6 +749,45 @@ public:
         return {res._ptr, res._so};
     }
 
+    /**
+     * @brief Loads the network on the compile queue, so several networks are loaded in parallel
+     * @param load Loads the network, calls the callback as soon as the network is compiled
+     * @param onReady Is called once on the queue thread with the compiled (or imported) network or with the loading
+     * exception. The export of the compiled network to the cache continues after the call.
+     */
+    void LoadNetworkAsync(
+        std::function<ov::SoPtr<ie::IExecutableNetworkInternal>(const CompiledCallback&)> load,
+        std::function<void(const ov::SoPtr<ie::IExecutableNetworkInternal>&, const std::exception_ptr&)> onReady) {
+        std::call_once(compileQueueOnce, [this] {
+            // the compilation is mostly sequential, so the networks are compiled in parallel up to the cores number
+            const auto cores = ie::limitByCPUQuota(ie::getNumberOfCPUCores());
+            compileQueue.reset(new ie::CompileQueue(static_cast<size_t>(cores)));
+        });
+        compileQueue->push([load, onReady] {
+            bool isReady = false;
+            auto onCompiled = [&](const ov::SoPtr<ie::IExecutableNetworkInternal>& execNetwork) {
+                isReady = true;
+                onReady(execNetwork, nullptr);
+            };
+            try {
+                auto execNetwork = load(onCompiled);
+                if (!isReady) {
+                    isReady = true;
+                    onReady(execNetwork, nullptr);
+                }
+            } catch (const std::exception& ex) {
+                // the failed export of the already returned network only removes the cache entry
+                if (!isReady) {
+                    onReady({}, std::make_exception_ptr(ov::Exception(ex.what())));
+                }
+            } catch (...) {
+                if (!isReady) {
+                    onReady({}, std::make_exception_ptr(ov::Exception("Unexpected exception")));
+                }
+            }
+        });
+    }
+
     ie::SoExecutableNetworkInternal ImportNetwork(std::istream& networkModel,
                                                   const std::string& deviceName,
                                                   const std::map<std::string, std::string>& config) override {
@@ -768,10 +888,22 @@ public:
      * If there more than one device of specific type, they are enumerated with .# suffix.
      */
     std::vector<std::string> GetAvailableDevices() const override {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::GetAvailableDevices");
         std::vector<std::string> devices;
         const std::string propertyName = METRIC_KEY(AVAILABLE_DEVICES);
 
-        for (auto&& deviceName : GetListOfDevicesInRegistry()) {
+        auto deviceNames = GetListOfDevicesInRegistry();
+        const auto allowList = coreConfig.getDeviceAllowList();
+        if (!allowList.empty()) {
+            deviceNames.erase(std::remove_if(deviceNames.begin(),
+                                             deviceNames.end(),
+                                             [&](const std::string& deviceName) {
+                                                 return !util::contains(allowList, deviceName);
+                                             }),
+                              deviceNames.end());
+        }
+
+        auto getDevicesIDs = [&](const std::string& deviceName) {
             std::vector<std::string> devicesIDs;
             try {
                 const ie::Parameter p = GetMetric(deviceName, propertyName);
@@ -789,6 +921,22 @@ public:
                 IE_THROW() << "Unknown exception is thrown while trying to create the " << deviceName
                            << " device and call GetMetric";
             }
+            return devicesIDs;
+        };
+
+        // The plugins are loaded and probe their devices in parallel, the first device is probed on this thread
+        std::vector<std::future<std::vector<std::string>>> futures;
+        for (size_t i = 1; i < deviceNames.size(); ++i) {
+            try {
+                futures.push_back(std::async(std::launch::async, getDevicesIDs, std::cref(deviceNames[i])));
+            } catch (const std::system_error&) {
+                futures.push_back(std::async(std::launch::deferred, getDevicesIDs, std::cref(deviceNames[i])));
+            }
+        }
+
+        for (size_t i = 0; i < deviceNames.size(); ++i) {
+            const auto& deviceName = deviceNames[i];
+            auto devicesIDs = i == 0 ? getDevicesIDs(deviceName) : futures[i - 1].get();
 
             if (devicesIDs.size() > 1) {
                 for (auto&& deviceID : devicesIDs) {
@@ -823,22 +971,60 @@ public:
     ov::InferencePlugin GetCPPPluginByName(const std::string& pluginName) const {
         OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "CoreImpl::GetCPPPluginByName");
 
-        std::lock_guard<std::mutex> lock(pluginsMutex);
         auto deviceName = pluginName;
         if (deviceName == ov::DEFAULT_DEVICE_NAME)
             deviceName = "AUTO";
-        auto it = pluginRegistry.find(deviceName);
-        if (it == pluginRegistry.end()) {
-            if (pluginName == ov::DEFAULT_DEVICE_NAME)
-                IE_THROW() << "No device is provided, so AUTO device is used by default, which failed loading.";
-            else
-                IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+        auto findRegistered = [&]() {
+            auto it = pluginRegistry.find(deviceName);
+            if (it == pluginRegistry.end()) {
+                if (pluginName == ov::DEFAULT_DEVICE_NAME)
+                    IE_THROW() << "No device is provided, so AUTO device is used by default, which failed loading.";
+                else
+                    IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+            return it;
+        };
+
+        std::shared_ptr<std::mutex> loadMutex;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            findRegistered();
+            auto it_plugin = plugins.find(deviceName);
+            if (it_plugin != plugins.end()) {
+                return it_plugin->second;
+            }
+            auto& mutex = pluginLoadMutexes[deviceName];
+            if (!mutex) {
+                mutex = std::make_shared<std::mutex>();
+            }
+            loadMutex = mutex;
+        }
+
+        // Plugin is in registry, but not created, let's create. The plugins are created without holding
+        // pluginsMutex, so the different devices are loaded in parallel, the same device is loaded once
+        std::lock_guard<std::mutex> loadLock(*loadMutex);
+        PluginDescriptor desc;
+        std::vector<std::pair<std::string, PluginDescriptor>> deviceIDsDescs;
+        std::vector<ie::IExtensionPtr> registeredExtensions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = findRegistered();
+            auto it_plugin = plugins.find(deviceName);
+            if (it_plugin != plugins.end()) {
+                return it_plugin->second;
+            }
+            desc = it->second;
+            for (auto&& pluginDesc : pluginRegistry) {
+                if (pluginDesc.first.find(deviceName) != std::string::npos) {
+                    deviceIDsDescs.push_back(pluginDesc);
+                }
+            }
+            registeredExtensions = extensions;
         }
+        const auto registeredConfig = desc.defaultConfig;
 
-        // Plugin is in registry, but not created, let's create
-        auto it_plugin = plugins.find(deviceName);
-        if (it_plugin == plugins.end()) {
-            PluginDescriptor desc = it->second;
+        {
+            ov::load_time_stats::Scope scope{"plugin_load"};
             std::shared_ptr<void> so;
             try {
                 ov::InferencePlugin plugin;
@@ -865,7 +1051,7 @@ public:
 
                 // Add registered extensions to new plugin
                 allowNotImplemented([&]() {
-                    for (const auto& ext : extensions) {
+                    for (const auto& ext : registeredExtensions) {
                         plugin.add_extension(ext);
                     }
                 });
@@ -889,10 +1075,9 @@ public:
                         const std::string deviceKey =
                             supportsConfigDeviceID ? CONFIG_KEY_INTERNAL(CONFIG_DEVICE_ID) : CONFIG_KEY(DEVICE_ID);
 
-                        for (auto pluginDesc : pluginRegistry) {
+                        for (auto pluginDesc : deviceIDsDescs) {
                             InferenceEngine::DeviceIDParser parser(pluginDesc.first);
-                            if (pluginDesc.first.find(deviceName) != std::string::npos &&
-                                !parser.getDeviceID().empty()) {
+                            if (!parser.getDeviceID().empty()) {
                                 pluginDesc.second.defaultConfig[deviceKey] = parser.getDeviceID();
                                 plugin.set_config(pluginDesc.second.defaultConfig);
                             }
@@ -907,6 +1092,20 @@ public:
                     });
                 }
 
+                std::lock_guard<std::mutex> lock(pluginsMutex);
+                // the config and the extensions added while the plugin was created are only in the registry
+                auto it = pluginRegistry.find(deviceName);
+                if (it != pluginRegistry.end() && it->second.defaultConfig != registeredConfig) {
+                    allowNotImplemented([&]() {
+                        plugin.set_config(it->second.defaultConfig);
+                    });
+                }
+                allowNotImplemented([&]() {
+                    for (size_t i = registeredExtensions.size(); i < extensions.size(); ++i) {
+                        plugin.add_extension(extensions[i]);
+                    }
+                });
+
                 // add plugin as extension itself
                 if (desc.extensionCreateFunc) {  // static OpenVINO case
                     try {
@@ -927,9 +1126,7 @@ public:
                            << "Please, check your environment\n"
                            << ex.what() << "\n";
             }
-        } else {
-            return it_plugin->second;
-        };
+        }
     }
 
     /**
@@ -1603,6 +1800,10 @@ std::shared_ptr<ov::Model> Core::read_model(const std::string& model, const ov::
     OV_CORE_CALL_STATEMENT(return _impl->ReadNetwork(model, blob).getFunction(););
 }
 
+std::shared_ptr<ov::Model> Core::read_model(std::istream& model, std::istream& weights) const {
+    OV_CORE_CALL_STATEMENT(return _impl->ReadNetwork(model, weights).getFunction(););
+}
+
 namespace {
 
 ie::CNNNetwork toCNN(const std::shared_ptr<const ngraph::Function>& model) {
@@ -1649,6 +1850,54 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        auto promise = std::make_shared<std::promise<CompiledModel>>();
+        auto future = promise->get_future();
+        // the queue is finished before the core destruction, so the tasks don't need to hold it
+        CoreImpl* core = _impl.get();
+        auto network = toCNN(model);
+        auto parsedConfig = any_copy(flatten_sub_properties(deviceName, config));
+        _impl->LoadNetworkAsync(
+            [core, network, deviceName, parsedConfig](const CompiledCallback& onCompiled) {
+                return core->LoadNetwork(network, deviceName, parsedConfig, onCompiled);
+            },
+            [promise](const ov::SoPtr<ie::IExecutableNetworkInternal>& exec, const std::exception_ptr& error) {
+                if (error) {
+                    promise->set_exception(error);
+                } else {
+                    promise->set_value(CompiledModel{exec._ptr, exec._so});
+                }
+            });
+        return future;
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& modelPath,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        auto promise = std::make_shared<std::promise<CompiledModel>>();
+        auto future = promise->get_future();
+        CoreImpl* core = _impl.get();
+        auto parsedConfig = any_copy(flatten_sub_properties(deviceName, config));
+        _impl->LoadNetworkAsync(
+            [core, modelPath, deviceName, parsedConfig](const CompiledCallback& onCompiled) {
+                return core->LoadNetwork(modelPath, deviceName, parsedConfig, onCompiled);
+            },
+            [promise](const ov::SoPtr<ie::IExecutableNetworkInternal>& exec, const std::exception_ptr& error) {
+                if (error) {
+                    promise->set_exception(error);
+                } else {
+                    promise->set_value(CompiledModel{exec._ptr, exec._so});
+                }
+            });
+        return future;
+    });
+}
+
 void Core::add_extension(const ie::IExtensionPtr& extension) {
     OV_CORE_CALL_STATEMENT(_impl->AddExtension(extension););
 }
@@ -1752,6 +2001,13 @@ Any Core::get_property(const std::string& deviceName, const std::string& name, c
                     "get_config is also possible for the individual devices before creating the AUTO on top.");
 
     OV_CORE_CALL_STATEMENT({
+        // the properties of the Core itself are requested without the device name
+        if (deviceName.empty() && name == ov::load_time_breakdown.name()) {
+            return ov::Any{ov::load_time_stats::get()};
+        }
+        if (deviceName.empty() && name == ov::profiling_counters.name()) {
+            return ov::Any{openvino::itt::countersReport()};
+        }
         auto parsed = parseDeviceNameIntoConfig(deviceName, arguments);
         return _impl->GetCPPPluginByName(parsed._deviceName).get_property(name, parsed._config);
     });
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <streambuf>
 #include <string>
 
 #include "cnn_network_ngraph_impl.hpp"
@@ -24,6 +25,7 @@
 #endif
 #include "ie_itt.hpp"
 #include "legacy/ie_reader.hpp"
+#include "load_time_stats.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/variant.hpp"
@@ -453,6 +455,105 @@ std::vector<ov::Extension::Ptr> wrap_old_extensions(const std::vector<InferenceE
     return extensions;
 }
 
+/**
+ * @brief Read-only stream buffer over the model string, the model is parsed in place without the copy
+ * std::istringstream makes
+ */
+class StringViewStreamBuf final : public std::streambuf {
+public:
+    explicit StringViewStreamBuf(const std::string& str) {
+        char* begin = const_cast<char*>(str.data());
+        setg(begin, begin, begin + str.size());
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            base = egptr() - eback();
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const off_type offset = pos;
+        if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + offset, egptr());
+        return pos;
+    }
+};
+
+CNNNetwork ReadNetworkFromStreams(std::istream& modelStream,
+                                  const Blob::CPtr& weights,
+                                  std::istream* weightsStream,
+                                  const std::vector<IExtensionPtr>& exts,
+                                  const std::vector<ov::Extension::Ptr>& ov_exts,
+                                  bool newAPI) {
+#ifdef ENABLE_IR_V7_READER
+    // IR v7 obsolete code
+    {
+        // Register readers if it is needed
+        registerReaders();
+        assertIfIRv7LikeModel(modelStream);
+
+        for (auto it = readers.begin(); it != readers.end(); it++) {
+            auto reader = it->second;
+            if (reader->supportModel(modelStream)) {
+                OPENVINO_ASSERT(!newAPI, "Cannot read IR v7 from OpenVINO 2.0 API");
+                OPENVINO_ASSERT(!weightsStream, "Cannot read IR v7 with the weights stream");
+                if (weights)
+                    return reader->read(modelStream, weights, exts);
+                return reader->read(modelStream, exts);
+            }
+        }
+    }
+#endif  // ENABLE_IR_V7_READER
+
+    // Try to load with FrontEndManager
+    auto& manager = get_frontend_manager();
+    ov::frontend::FrontEnd::Ptr FE;
+    ov::frontend::InputModel::Ptr inputModel;
+
+    ov::AnyVector params{&modelStream};
+    if (weights) {
+        char* data = weights->cbuffer().as<char*>();
+        std::shared_ptr<ngraph::runtime::AlignedBuffer> weights_buffer =
+            std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, weights->byteSize(), weights);
+        params.emplace_back(weights_buffer);
+    } else if (weightsStream) {
+        // the frontends consume the stream themselves, so it isn't staged in memory or on disk in between
+        params.emplace_back(weightsStream);
+    }
+
+    {
+        ov::load_time_stats::Scope scope{"read_model/frontend_search"};
+        FE = manager.load_by_model(params);
+    }
+    if (FE) {
+        FE->add_extension(ov_exts);
+        if (!exts.empty())
+            FE->add_extension(wrap_old_extensions(exts));
+        ov::load_time_stats::Scope scope{"read_model/load"};
+        inputModel = FE->load(params);
+    }
+    if (inputModel) {
+        std::shared_ptr<ov::Model> ngFunc;
+        {
+            ov::load_time_stats::Scope scope{"read_model/convert"};
+            ngFunc = FE->convert(inputModel);
+        }
+        ov::load_time_stats::Scope scope{"read_model/postprocess"};
+        return convert_to_cnnnetwork(ngFunc, exts, newAPI);
+    }
+
+    IE_THROW(NetworkNotRead)
+        << "Unable to read the model. Please check if the model format is supported and model is correct.";
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath,
@@ -499,16 +600,26 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
         params.emplace_back(weights_path);
     }
 
-    FE = manager.load_by_model(params);
+    {
+        ov::load_time_stats::Scope scope{"read_model/frontend_search"};
+        FE = manager.load_by_model(params);
+    }
     if (FE) {
         FE->add_extension(ov_exts);
         if (!exts.empty())
             FE->add_extension(wrap_old_extensions(exts));
+        // the frontends read and parse the model files while loading
+        ov::load_time_stats::Scope scope{"read_model/load"};
         inputModel = FE->load(params);
     }
 
     if (inputModel) {
-        auto ngFunc = FE->convert(inputModel);
+        std::shared_ptr<ov::Model> ngFunc;
+        {
+            ov::load_time_stats::Scope scope{"read_model/convert"};
+            ngFunc = FE->convert(inputModel);
+        }
+        ov::load_time_stats::Scope scope{"read_model/postprocess"};
         return convert_to_cnnnetwork(ngFunc, exts, newAPI);
     }
 
@@ -527,55 +638,17 @@ CNNNetwork details::ReadNetwork(const std::string& model,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
                                 bool newAPI) {
-    std::istringstream modelStringStream(model);
-    std::istream& modelStream = modelStringStream;
-
-#ifdef ENABLE_IR_V7_READER
-    // IR v7 obsolete code
-    {
-        // Register readers if it is needed
-        registerReaders();
-        assertIfIRv7LikeModel(modelStream);
-
-        for (auto it = readers.begin(); it != readers.end(); it++) {
-            auto reader = it->second;
-            if (reader->supportModel(modelStream)) {
-                OPENVINO_ASSERT(!newAPI, "Cannot read IR v7 from OpenVINO 2.0 API");
-                if (weights)
-                    return reader->read(modelStream, weights, exts);
-                return reader->read(modelStream, exts);
-            }
-        }
-    }
-#endif  // ENABLE_IR_V7_READER
-
-    // Try to load with FrontEndManager
-    auto& manager = get_frontend_manager();
-    ov::frontend::FrontEnd::Ptr FE;
-    ov::frontend::InputModel::Ptr inputModel;
-
-    ov::AnyVector params{&modelStream};
-    if (weights) {
-        char* data = weights->cbuffer().as<char*>();
-        std::shared_ptr<ngraph::runtime::AlignedBuffer> weights_buffer =
-            std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, weights->byteSize(), weights);
-        params.emplace_back(weights_buffer);
-    }
-
-    FE = manager.load_by_model(params);
-    if (FE) {
-        FE->add_extension(ov_exts);
-        if (!exts.empty())
-            FE->add_extension(wrap_old_extensions(exts));
-        inputModel = FE->load(params);
-    }
-    if (inputModel) {
-        auto ngFunc = FE->convert(inputModel);
-        return convert_to_cnnnetwork(ngFunc, exts, newAPI);
-    }
+    StringViewStreamBuf modelBuf(model);
+    std::istream modelStream(&modelBuf);
+    return ReadNetworkFromStreams(modelStream, weights, nullptr, exts, ov_exts, newAPI);
+}
 
-    IE_THROW(NetworkNotRead)
-        << "Unable to read the model. Please check if the model format is supported and model is correct.";
+CNNNetwork details::ReadNetwork(std::istream& model,
+                                std::istream& weights,
+                                const std::vector<IExtensionPtr>& exts,
+                                const std::vector<ov::Extension::Ptr>& ov_exts,
+                                bool newAPI) {
+    return ReadNetworkFromStreams(model, nullptr, &weights, exts, ov_exts, newAPI);
 }
 
 }  // namespace InferenceEngine
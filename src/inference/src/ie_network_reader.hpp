@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <istream>
 #include <string>
 
 #include "cpp/ie_cnn_network.h"
@@ -43,6 +44,20 @@ CNNNetwork ReadNetwork(const std::string& model,
                        const std::vector<IExtensionPtr>& exts,
                        const std::vector<ov::Extension::Ptr>& ov_exts,
                        bool newAPI);
+/**
+ * @brief Reads the model and its weights from the streams, the weights stream is consumed by the frontend directly
+ * @param model stream with the model
+ * @param weights stream with the weights of the model, it's read to the end
+ * @param exts vector with extensions
+ * @param ov_exts vector with OpenVINO extensions
+ * @param newAPI Whether this function is called from OpenVINO 2.0 API
+ * @return CNNNetwork
+ */
+CNNNetwork ReadNetwork(std::istream& model,
+                       std::istream& weights,
+                       const std::vector<IExtensionPtr>& exts,
+                       const std::vector<ov::Extension::Ptr>& ov_exts,
+                       bool newAPI);
 
 }  // namespace details
 }  // namespace InferenceEngine
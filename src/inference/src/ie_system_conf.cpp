@@ -4,6 +4,7 @@
 
 #include "ie_system_conf.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <vector>
@@ -98,6 +99,9 @@ std::vector<int> getAvailableNUMANodes() {
 int getNumberOfLogicalCPUCores(bool) {
     return parallel_get_max_threads();
 }
+int getCPUQuota() {
+    return 0;
+}
 #else
 int getNumberOfLogicalCPUCores(bool bigCoresOnly) {
     int logical_cores = parallel_get_max_threads();
@@ -112,6 +116,11 @@ int getNumberOfLogicalCPUCores(bool bigCoresOnly) {
 }
 #endif
 
+int limitByCPUQuota(int threads) {
+    const auto quota = getCPUQuota();
+    return quota > 0 ? std::min(threads, quota) : threads;
+}
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
     return custom::info::numa_nodes();
@@ -8,6 +8,7 @@
 #include <iostream>
 #include <map>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -56,6 +57,96 @@ struct CPU {
     }
 };
 static CPU cpu;
+
+namespace {
+std::string readFirstLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// The quota of the cgroup is limited by the quotas of its ancestors, so the cgroup directories are visited up to the
+// mount point and the minimal quota is taken. The cgroup path is relative to the root of the cgroup namespace, if the
+// container doesn't have its own namespace the path doesn't exist in its mount and only the upper levels are found
+template <typename ReadQuota>
+int getHierarchyQuota(const std::string& mount, std::string path, ReadQuota readQuota) {
+    int result = 0;
+    while (true) {
+        const auto cpus = readQuota(mount + path);
+        if (cpus > 0 && (result == 0 || cpus < result))
+            result = cpus;
+        if (path.empty() || path == "/")
+            break;
+        path = path.substr(0, path.rfind('/'));
+    }
+    return result;
+}
+
+int quotaToCPUs(long long quota, long long period) {
+    return quota > 0 && period > 0 ? static_cast<int>((quota + period - 1) / period) : 0;
+}
+
+int readCgroupV2Quota(const std::string& dir) {
+    // "<quota> <period>", the quota is "max" if it isn't set
+    std::istringstream cpuMax(readFirstLine(dir + "/cpu.max"));
+    std::string quota;
+    long long period = 0;
+    if (!(cpuMax >> quota >> period) || quota == "max")
+        return 0;
+    return quotaToCPUs(std::stoll(quota), period);
+}
+
+int readCgroupV1Quota(const std::string& dir) {
+    // the quota is -1 if it isn't set
+    const auto quota = readFirstLine(dir + "/cpu.cfs_quota_us");
+    const auto period = readFirstLine(dir + "/cpu.cfs_period_us");
+    if (quota.empty() || period.empty())
+        return 0;
+    return quotaToCPUs(std::stoll(quota), std::stoll(period));
+}
+
+int readCPUQuota() {
+    int result = 0;
+    std::ifstream cgroups("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(cgroups, line)) {
+        // "<hierarchy id>:<controllers>:<path>", the cgroup v2 hierarchy doesn't have the controllers listed
+        const auto first = line.find(':');
+        const auto second = line.find(':', first + 1);
+        if (first == std::string::npos || second == std::string::npos)
+            continue;
+        const auto controllers = "," + line.substr(first + 1, second - first - 1) + ",";
+        const auto path = line.substr(second + 1);
+
+        int cpus = 0;
+        if (controllers == ",,") {
+            cpus = getHierarchyQuota("/sys/fs/cgroup", path, readCgroupV2Quota);
+        } else if (controllers.find(",cpu,") != std::string::npos) {
+            for (auto&& mount : {"/sys/fs/cgroup/cpu,cpuacct", "/sys/fs/cgroup/cpu"}) {
+                cpus = getHierarchyQuota(mount, path, readCgroupV1Quota);
+                if (cpus > 0)
+                    break;
+            }
+        }
+        if (cpus > 0 && (result == 0 || cpus < result))
+            result = cpus;
+    }
+    return result;
+}
+}  // namespace
+
+int getCPUQuota() {
+    static const int quota = [] {
+        try {
+            return readCPUQuota();
+        } catch (const std::exception&) {
+            return 0;
+        }
+    }();
+    return quota;
+}
+
 #if !((IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
     std::vector<int> nodes((0 == cpu._sockets) ? 1 : cpu._sockets);
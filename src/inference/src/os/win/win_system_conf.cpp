@@ -13,6 +13,21 @@
 #include "threading/ie_parallel_custom_arena.hpp"
 
 namespace InferenceEngine {
+int getCPUQuota() {
+    static const int quota = [] {
+        // the rate is in 1/100 of percent of all the processors, it's applied only if it's the hard cap
+        JOBOBJECT_CPU_RATE_CONTROL_INFORMATION info = {};
+        if (!QueryInformationJobObject(nullptr, JobObjectCpuRateControlInformation, &info, sizeof(info), nullptr))
+            return 0;
+        const DWORD enabled = JOB_OBJECT_CPU_RATE_CONTROL_ENABLE | JOB_OBJECT_CPU_RATE_CONTROL_HARD_CAP;
+        if ((info.ControlFlags & enabled) != enabled || info.CpuRate == 0)
+            return 0;
+        const auto processors = static_cast<long long>(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS));
+        return static_cast<int>((info.CpuRate * processors + 9999) / 10000);
+    }();
+    return quota;
+}
+
 int getNumberOfCPUCores(bool bigCoresOnly) {
     const int fallback_val = parallel_get_max_threads();
     DWORD sz = 0;
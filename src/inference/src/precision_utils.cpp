@@ -6,21 +6,61 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#    include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
+// The arrays are converted by the blocks of this size in parallel, the smaller arrays are converted by one thread
+static constexpr size_t convert_block = 16 * 1024;
+
+template <typename F>
+static void convert_by_blocks(size_t nelem, const F& convert) {
+    if (nelem <= convert_block) {
+        convert(0, nelem);
+        return;
+    }
+    const size_t nblocks = (nelem + convert_block - 1) / convert_block;
+    parallel_for(nblocks, [&](size_t block) {
+        const size_t begin = block * convert_block;
+        convert(begin, (std::min)(convert_block, nelem - begin));
+    });
+}
+
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
     const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
+    convert_by_blocks(nelem, [&](size_t begin, size_t count) {
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            f16tof32Arrays_avx2(dst + begin, _src + begin, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = begin; i < begin + count; i++) {
+            dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        }
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+    convert_by_blocks(nelem, [&](size_t begin, size_t count) {
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            f32tof16Arrays_avx2(dst + begin, src + begin, count, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = begin; i < begin + count; i++) {
+            dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+        }
+    });
 }
 
 // Function to convert F32 into F16
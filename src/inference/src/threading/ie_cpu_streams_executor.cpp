@@ -4,10 +4,14 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -84,6 +88,7 @@ struct CPUStreamsExecutor::Impl {
                             Config::PreferredCoreType::BIG == _impl->_config._threadPreferredCoreType
                                 ? custom::info::core_types().back()    // running on Big cores only
                                 : custom::info::core_types().front();  // running on Little cores only
+                        _isLittleCore = selected_core_type != custom::info::core_types().back();
                         _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
                                                                     .set_core_type(selected_core_type)
                                                                     .set_max_concurrency(concurrency)});
@@ -102,6 +107,7 @@ struct CPUStreamsExecutor::Impl {
                                 return p.second > streamId_wrapped;
                             })
                             ->first;
+                    _isLittleCore = selected_core_type != custom::info::core_types().back();
                     _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
                                                                 .set_core_type(selected_core_type)
                                                                 .set_max_concurrency(concurrency)});
@@ -172,6 +178,8 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl = nullptr;
         int _streamId = 0;
         int _numaNodeId = 0;
+        // the stream runs on the Little cores of the hybrid CPU
+        bool _isLittleCore = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -180,6 +188,97 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    // The tasks of the same priority ordered by the deadline (earliest deadline first), the tasks with the same
+    // deadline (e.g. without it) are kept in FIFO order
+    struct DeadlineQueue {
+        void push(Task task, Deadline deadline) {
+            // the tasks are usually pushed without the deadline or with the increasing ones, so the place is searched
+            // from the back
+            auto it = std::find_if(_tasks.rbegin(), _tasks.rend(), [&](const std::pair<Deadline, Task>& item) {
+                          return item.first <= deadline;
+                      }).base();
+            _tasks.emplace(it, deadline, std::move(task));
+        }
+
+        Task pop() {
+            auto task = std::move(_tasks.front().second);
+            _tasks.pop_front();
+            return task;
+        }
+
+        bool empty() const {
+            return _tasks.empty();
+        }
+
+        std::deque<std::pair<Deadline, Task>> _tasks;
+    };
+
+    // The queue of the stream thread in the work stealing mode. The tasks are pushed by any thread and pulled by the
+    // stream thread or stolen by the other streams of its NUMA node, so each queue has its own lock
+    struct StreamQueue {
+        bool push(Task task, Priority priority, Deadline deadline) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks[static_cast<size_t>(priority)].push(std::move(task), deadline);
+            _size[static_cast<size_t>(priority)]++;
+            return _isIdle;
+        }
+
+        bool tryPop(Priority priority, Task& task) {
+            // don't lock the queues which are known to be empty
+            if (0 == _size[static_cast<size_t>(priority)]) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto& tasks = _tasks[static_cast<size_t>(priority)];
+            if (tasks.empty()) {
+                return false;
+            }
+            task = tasks.pop();
+            _size[static_cast<size_t>(priority)]--;
+            return true;
+        }
+
+        bool empty() const {
+            return 0 == _size[static_cast<size_t>(Priority::BATCH)] &&
+                   0 == _size[static_cast<size_t>(Priority::LATENCY)];
+        }
+
+        void setIdle(bool isIdle) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isIdle = isIdle;
+        }
+
+        // wakes up the idle stream, so it pulls or steals the pushed task
+        bool wakeUp() {
+            if (!_isIdle) {
+                return false;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_isIdle || _wakeUp) {
+                    return false;
+                }
+                _wakeUp = true;
+            }
+            _queueCondVar.notify_one();
+            return true;
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _queueCondVar;
+        std::array<DeadlineQueue, 2> _tasks;
+        std::array<std::atomic<size_t>, 2> _size{{{0}, {0}}};
+        // the idle flag is set before the last attempt to pull a task, so the pushing thread either sees the stream
+        // idle or the stream sees the task
+        std::atomic<bool> _isIdle{false};
+        bool _wakeUp = false;
+        // -1 until the stream thread is started
+        std::atomic<int> _numaNodeId{-1};
+        std::atomic<bool> _isLittleCore{false};
+        // the moving average of the tasks execution time in nanoseconds, 0 until the first task is executed
+        std::atomic<int64_t> _taskDuration{0};
+    };
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams([this] {
@@ -215,7 +314,19 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._workStealing) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _streamQueues.emplace_back(new StreamQueue);
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            if (_config._workStealing) {
+                _threads.emplace_back([this, streamId] {
+                    openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                    RunStreamQueue(streamId);
+                });
+                continue;
+            }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
@@ -223,11 +334,14 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return !_taskQueues[0].empty() || !_taskQueues[1].empty() || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        // the latency tasks are pulled first
+                        auto& taskQueue = _taskQueues[static_cast<size_t>(Priority::LATENCY)].empty()
+                                              ? _taskQueues[static_cast<size_t>(Priority::BATCH)]
+                                              : _taskQueues[static_cast<size_t>(Priority::LATENCY)];
+                        if (!taskQueue.empty()) {
+                            task = taskQueue.pop();
                         }
                     }
                     if (task) {
@@ -238,14 +352,122 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, Priority priority, Deadline deadline) {
+        if (_config._workStealing) {
+            EnqueueToStream(std::move(task), priority, deadline);
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues[static_cast<size_t>(priority)].push(std::move(task), deadline);
         }
         _queueCondVar.notify_one();
     }
 
+    // the Little cores streams don't take the latency tasks if the Big cores streams are there to run them
+    bool CanRun(const StreamQueue& queue, Priority priority) const {
+        return !(Priority::LATENCY == priority && _config._latencyOnBigCores && queue._isLittleCore);
+    }
+
+    void EnqueueToStream(Task task, Priority priority, Deadline deadline) {
+        const auto streams = _streamQueues.size();
+        // the idle streams are preferred, the faster ones first, otherwise the stream expected to finish its queue
+        // first is used. The measured tasks duration routes the tasks away from the slower (e.g. Little cores)
+        // streams. The search starts at the round-robin position, so the streams with the same speed are loaded evenly
+        const auto start = _nextStreamQueue++ % streams;
+        auto target = streams;
+        auto targetIsIdle = false;
+        int64_t targetCost = 0;
+        for (size_t i = 0; i < streams; ++i) {
+            const auto streamId = (start + i) % streams;
+            const auto& queue = *_streamQueues[streamId];
+            if (!CanRun(queue, priority)) {
+                continue;
+            }
+            const bool isIdle = queue._isIdle;
+            const auto queued = queue._size[0] + queue._size[1] + (isIdle ? 0 : 1);
+            const auto cost = static_cast<int64_t>(queued + 1) * queue._taskDuration;
+            if (target == streams || (isIdle && !targetIsIdle) || (isIdle == targetIsIdle && cost < targetCost)) {
+                target = streamId;
+                targetIsIdle = isIdle;
+                targetCost = cost;
+            }
+        }
+        if (target == streams) {
+            // all the streams are on the Little cores
+            target = start;
+        }
+        auto& queue = *_streamQueues[target];
+        if (queue.push(std::move(task), priority, deadline) && queue.wakeUp()) {
+            return;
+        }
+        // the target stream is busy, so an idle stream of the same NUMA node is woken up to steal the task
+        const auto numaNodeId = queue._numaNodeId.load();
+        for (size_t i = 1; i < streams; ++i) {
+            auto& peer = *_streamQueues[(target + i) % streams];
+            if (peer._numaNodeId == numaNodeId && CanRun(peer, priority) && peer.wakeUp()) {
+                return;
+            }
+        }
+    }
+
+    // pulls the task from the queue of the stream or steals it from the other streams of the same NUMA node
+    bool PopTask(size_t streamId, Task& task) {
+        const auto streams = _streamQueues.size();
+        auto& queue = *_streamQueues[streamId];
+        const auto numaNodeId = queue._numaNodeId.load();
+        for (auto priority : {Priority::LATENCY, Priority::BATCH}) {
+            if (queue.tryPop(priority, task)) {
+                return true;
+            }
+            if (!CanRun(queue, priority)) {
+                continue;
+            }
+            for (size_t i = 1; i < streams; ++i) {
+                auto& peer = *_streamQueues[(streamId + i) % streams];
+                if (peer._numaNodeId == numaNodeId && peer.tryPop(priority, task)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void RunStreamQueue(size_t streamId) {
+        auto& stream = *(_streams.local());
+        auto& queue = *_streamQueues[streamId];
+        queue._numaNodeId = stream._numaNodeId;
+        queue._isLittleCore = stream._isLittleCore;
+        while (true) {
+            Task task;
+            if (!PopTask(streamId, task)) {
+                queue.setIdle(true);
+                if (!PopTask(streamId, task)) {
+                    std::unique_lock<std::mutex> lock(queue._mutex);
+                    queue._queueCondVar.wait(lock, [&] {
+                        return queue._wakeUp || !queue.empty() || _isStopped;
+                    });
+                    queue._wakeUp = false;
+                    queue._isIdle = false;
+                    // the queued tasks are finished before the stop, the tasks of the other streams are finished
+                    // by their own threads
+                    if (_isStopped && queue.empty()) {
+                        return;
+                    }
+                    continue;
+                }
+                queue.setIdle(false);
+            }
+            const auto start = std::chrono::steady_clock::now();
+            Execute(task, stream);
+            const auto duration =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            // the average follows the latest tasks, so it adapts to the changing load and frequency of the cores
+            const int64_t average = queue._taskDuration;
+            queue._taskDuration = average ? average + (duration - average) / 8 : std::max<int64_t>(duration, 1);
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -282,8 +504,12 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    // indexed by the priority
+    std::array<DeadlineQueue, 2> _taskQueues;
+    std::atomic<bool> _isStopped{false};
+    // the queues of the streams in the work stealing mode
+    std::vector<std::unique_ptr<StreamQueue>> _streamQueues;
+    std::atomic<size_t> _nextStreamQueue{0};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -314,6 +540,13 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    for (auto& queue : _impl->_streamQueues) {
+        // the stream either checks the stop flag before the lock or waits for the notification
+        {
+            std::lock_guard<std::mutex> lock(queue->_mutex);
+        }
+        queue->_queueCondVar.notify_all();
+    }
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -326,10 +559,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), Priority::BATCH);
+}
+
+void CPUStreamsExecutor::run(Task task, Priority priority, Deadline deadline) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority, deadline);
     }
 }
 
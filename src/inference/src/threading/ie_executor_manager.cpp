@@ -8,14 +8,24 @@
 #include <string>
 #include <utility>
 
+#include "ie_shared_streams_executor.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
 
 namespace InferenceEngine {
 namespace {
+bool isSameConfig(const IStreamsExecutor::Config& lhs, const IStreamsExecutor::Config& rhs) {
+    return lhs._name == rhs._name && lhs._streams == rhs._streams && lhs._threadsPerStream == rhs._threadsPerStream &&
+           lhs._threadBindingType == rhs._threadBindingType && lhs._threadBindingStep == rhs._threadBindingStep &&
+           lhs._threadBindingOffset == rhs._threadBindingOffset &&
+           (lhs._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
+            lhs._threadPreferredCoreType == rhs._threadPreferredCoreType);
+}
+
 class ExecutorManagerImpl : public ExecutorManager {
 public:
     ITaskExecutor::Ptr getExecutor(const std::string& id) override;
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) override;
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config, int weight) override;
     size_t getExecutorsNumber() const override;
     size_t getIdleCPUStreamsExecutorsNumber() const override;
     void clear(const std::string& id = {}) override;
@@ -23,6 +33,8 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    using SharedStreamsPoolEntry = std::pair<IStreamsExecutor::Config, std::weak_ptr<SharedStreamsPool>>;
+    std::vector<SharedStreamsPoolEntry> sharedStreamsPools;
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
 };
@@ -47,21 +59,35 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name && executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
-            if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
-                executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
-                return executor;
+        if (isSameConfig(it.first, config))
+            return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
     cpuStreamsExecutors.emplace_back(std::make_pair(config, newExec));
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                       int weight) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    // the pools of the released executors are forgotten
+    sharedStreamsPools.erase(std::remove_if(sharedStreamsPools.begin(),
+                                            sharedStreamsPools.end(),
+                                            [](const SharedStreamsPoolEntry& it) {
+                                                return it.second.expired();
+                                            }),
+                             sharedStreamsPools.end());
+    for (const auto& it : sharedStreamsPools) {
+        if (isSameConfig(it.first, config)) {
+            if (auto pool = it.second.lock())
+                return std::make_shared<SharedStreamsExecutor>(pool, weight);
+        }
+    }
+    auto pool = std::make_shared<SharedStreamsPool>(config);
+    sharedStreamsPools.emplace_back(std::make_pair(config, pool));
+    return std::make_shared<SharedStreamsExecutor>(pool, weight);
+}
+
 size_t ExecutorManagerImpl::getExecutorsNumber() const {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     return executors.size();
@@ -78,6 +104,7 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedStreamsPools.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -87,6 +114,13 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                                return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedStreamsPools.erase(
+            std::remove_if(sharedStreamsPools.begin(),
+                           sharedStreamsPools.end(),
+                           [&](const SharedStreamsPoolEntry& it) {
+                               return it.first._name == id;
+                           }),
+            sharedStreamsPools.end());
     }
 }
 
@@ -6,7 +6,6 @@
 
 #include <algorithm>
 #include <string>
-#include <thread>
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
@@ -34,7 +33,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
 int IStreamsExecutor::Config::GetDefaultNumStreams() {
     const int sockets = static_cast<int>(getAvailableNUMANodes().size());
     // bare minimum of streams (that evenly divides available number of core)
-    const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
+    const int num_cores = limitByCPUQuota(sockets == 1 ? getNumberOfLogicalCPUCores() : getNumberOfCPUCores());
     if (0 == num_cores % 4)
         return std::max(4, num_cores / 4);
     else if (0 == num_cores % 5)
@@ -242,8 +241,10 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
                              //      big-cores only, but the #cores is "enough" (pls see the logic above)
                              // it is usually beneficial not to use the hyper-threading (which is default)
                              : num_cores_default;
-    const auto threads =
-        streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
+    // the threads above the CPU quota of the container would be throttled
+    const auto threads = streamExecutorConfig._threads
+                             ? streamExecutorConfig._threads
+                             : (envThreads ? envThreads : limitByCPUQuota(hwCores));
     streamExecutorConfig._threadsPerStream =
         streamExecutorConfig._streams ? std::max(1, threads / streamExecutorConfig._streams) : threads;
     return streamExecutorConfig;
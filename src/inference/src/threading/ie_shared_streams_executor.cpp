@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_shared_streams_executor.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace InferenceEngine {
+namespace {
+IStreamsExecutor::Config MakePoolConfig(const IStreamsExecutor::Config& config) {
+    auto poolConfig = config;
+    // the pool always runs the tasks on its own streams, the calling threads aren't borrowed
+    poolConfig._streams = std::max(1, config._streams);
+    return poolConfig;
+}
+}  // namespace
+
+SharedStreamsPool::SharedStreamsPool(const IStreamsExecutor::Config& config)
+    : _streams{std::max(1, config._streams)},
+      _executor{MakePoolConfig(config)} {}
+
+std::shared_ptr<SharedStreamsPool::Lease> SharedStreamsPool::acquire(int weight) {
+    auto lease = std::make_shared<Lease>(std::max(1, weight));
+    std::lock_guard<std::mutex> lock{_mutex};
+    _leases.push_back(lease);
+    return lease;
+}
+
+void SharedStreamsPool::release(const std::shared_ptr<Lease>& lease) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    lease->_drained.wait(lock, [&] {
+        return lease->_tasks.empty() && 0 == lease->_running;
+    });
+    _leases.erase(std::remove(_leases.begin(), _leases.end(), lease), _leases.end());
+}
+
+void SharedStreamsPool::run(Lease& lease, Task task) {
+    std::vector<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        lease._tasks.push_back(std::move(task));
+        tasks = schedule();
+    }
+    dispatch(tasks);
+}
+
+std::vector<Task> SharedStreamsPool::schedule() {
+    std::vector<Task> tasks;
+    while (_running < _streams) {
+        // the lease having the lowest running tasks to weight ratio, the ties are broken round robin
+        Lease* next = nullptr;
+        for (size_t i = 0; i < _leases.size(); ++i) {
+            auto& lease = *_leases[(_nextLease + i) % _leases.size()];
+            if (!lease._tasks.empty() &&
+                (nullptr == next || lease._running * next->_weight < next->_running * lease._weight)) {
+                next = &lease;
+            }
+        }
+        if (nullptr == next) {
+            break;
+        }
+        _nextLease = (_nextLease + 1) % _leases.size();
+        auto task = std::move(next->_tasks.front());
+        next->_tasks.pop_front();
+        next->_running++;
+        _running++;
+        // the lease outlives its running tasks, as it's released only after they are done
+        tasks.emplace_back([this, next, task] {
+            try {
+                task();
+            } catch (...) {
+                onTaskDone(*next);
+                throw;
+            }
+            onTaskDone(*next);
+        });
+    }
+    return tasks;
+}
+
+void SharedStreamsPool::dispatch(std::vector<Task>& tasks) {
+    // the executor is called out of the lock, as it may run the task in the calling thread
+    for (auto&& task : tasks) {
+        _executor.run(std::move(task));
+    }
+}
+
+void SharedStreamsPool::onTaskDone(Lease& lease) {
+    std::vector<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _running--;
+        tasks = schedule();
+    }
+    dispatch(tasks);
+    // the lease is marked as done only now, so the pool isn't destroyed by the lease release while it's still used here
+    std::lock_guard<std::mutex> lock{_mutex};
+    lease._running--;
+    if (lease._tasks.empty() && 0 == lease._running) {
+        lease._drained.notify_all();
+    }
+}
+
+SharedStreamsExecutor::SharedStreamsExecutor(const SharedStreamsPool::Ptr& pool, int weight)
+    : _pool{pool},
+      _lease{pool->acquire(weight)} {}
+
+SharedStreamsExecutor::~SharedStreamsExecutor() {
+    _pool->release(_lease);
+}
+
+void SharedStreamsExecutor::run(Task task) {
+    _pool->run(*_lease, std::move(task));
+}
+
+void SharedStreamsExecutor::Execute(Task task) {
+    _pool->executor().Execute(std::move(task));
+}
+
+int SharedStreamsExecutor::GetStreamId() {
+    return _pool->executor().GetStreamId();
+}
+
+int SharedStreamsExecutor::GetNumaNodeId() {
+    return _pool->executor().GetNumaNodeId();
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "threading/ie_cpu_streams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The pool of the CPU streams shared by several executors (the leases), e.g. by all the compiled models of a
+ * process, so the models running concurrently don't oversubscribe the cores with the executors of their own.
+ * At most as many tasks as there are streams are handed to the pool at once. The queued tasks of the leases are
+ * dispatched as the streams are freed: the lease with the lowest ratio of its running tasks to its weight goes first,
+ * so the streams are shared in proportion to the weights, while an idle lease doesn't keep its share from the others
+ */
+class SharedStreamsPool {
+public:
+    using Ptr = std::shared_ptr<SharedStreamsPool>;
+
+    struct Lease {
+        explicit Lease(int weight) : _weight{weight} {}
+        const int _weight;
+        std::deque<Task> _tasks;
+        int _running = 0;
+        std::condition_variable _drained;
+    };
+
+    explicit SharedStreamsPool(const IStreamsExecutor::Config& config);
+
+    std::shared_ptr<Lease> acquire(int weight);
+    /**
+     * @brief Waits for the queued and the running tasks of the lease and removes the lease from the pool
+     */
+    void release(const std::shared_ptr<Lease>& lease);
+    void run(Lease& lease, Task task);
+
+    IStreamsExecutor& executor() {
+        return _executor;
+    }
+
+private:
+    std::vector<Task> schedule();
+    void dispatch(std::vector<Task>& tasks);
+    void onTaskDone(Lease& lease);
+
+    const int _streams;
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<Lease>> _leases;
+    size_t _nextLease = 0;
+    int _running = 0;
+    CPUStreamsExecutor _executor;
+};
+
+/**
+ * @brief The executor of a single client of the shared streams pool. The stream id is the id of the pool stream
+ * running the task, so it's in the [0, pool streams number) range
+ */
+class SharedStreamsExecutor : public IStreamsExecutor {
+public:
+    SharedStreamsExecutor(const SharedStreamsPool::Ptr& pool, int weight);
+    ~SharedStreamsExecutor() override;
+
+    void run(Task task) override;
+    void Execute(Task task) override;
+    int GetStreamId() override;
+    int GetNumaNodeId() override;
+
+private:
+    SharedStreamsPool::Ptr _pool;
+    std::shared_ptr<SharedStreamsPool::Lease> _lease;
+};
+
+}  // namespace InferenceEngine
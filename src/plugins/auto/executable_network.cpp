@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -14,6 +16,7 @@
 #include "ie_icore.hpp"
 #include "ie_metric_helpers.hpp"
 #include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "executable_network.hpp"
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
@@ -85,6 +88,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto loadAwareScheduling = _config.find(CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING));
+    _loadAwareScheduling = loadAwareScheduling != _config.end() &&
+                           loadAwareScheduling->second.as<std::string>() == PluginConfigParams::YES;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -117,6 +123,10 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
     workerRequests.resize(numRequests);
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+    _serviceTimes[device] = std::unique_ptr<DeviceServiceTime>(new DeviceServiceTime);
+    auto* serviceTimePtr = _serviceTimes[device].get();
+    _requestStats[device] = std::unique_ptr<DeviceRequestStats>(new DeviceRequestStats);
+    auto* requestStatsPtr = _requestStats[device].get();
     idleWorkerRequests.set_capacity(numRequests);
     int num = 0;
     for (auto&& workerRequest : workerRequests) {
@@ -125,7 +135,13 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
         workerRequestPtr->_index = num++;
         IE_ASSERT(idleWorkerRequests.try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr)) == true);
         workerRequest._inferRequest->SetCallback(
-            [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this, device, idleWorkerRequestsPtr, serviceTimePtr, requestStatsPtr]
+            (std::exception_ptr exceptionPtr) mutable {
+                const auto execMs = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                serviceTimePtr->Update(execMs);
+                requestStatsPtr->Add(std::chrono::duration<double, std::milli>(
+                    workerRequestPtr->_startTime - workerRequestPtr->_enqueueTime).count(), execMs);
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
                 {
@@ -173,6 +189,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
     _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = strDevices;
 
     std::string profilingTask = "MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork:AutoMode";
+    _loadStartTime = std::chrono::steady_clock::now();
 
     // loadContext[ACTUALDEVICE] is always enabled,
     // when there is CPU and there are more than two devices, loadContext[CPU] is enabled
@@ -271,6 +288,17 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
         _executor->run(_loadContext[ACTUALDEVICE].task);
         auto recycleTask = [this]() mutable {
             WaitActualNetworkReady();
+            const auto switchStart = std::chrono::steady_clock::now();
+            if (_loadContext[ACTUALDEVICE].isAlready) {
+                std::lock_guard<std::mutex> lock(_confMutex);
+                _switchStats["ACTUAL_READY_MS"] =
+                    std::chrono::duration<float, std::milli>(switchStart - _loadStartTime).count();
+            }
+            // the helper stays to take the requests the accelerator has no idle request for
+            if (_context.cpuOverflow)
+                return;
+            // the popped requests are not returned to the idle queue, so they are counted over the iterations
+            size_t destroynum = 0;
             while (!_exitFlag && _loadContext[ACTUALDEVICE].isAlready) {
                 // handle the case of ACTUAL faster than CPU
                 _loadContext[CPU].future.wait();
@@ -281,17 +309,22 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
                 }
                 // late enough to check the idle queue now
                 // second, check the idle queue if all requests are in place
-                size_t destroynum = 0;
                 std::pair<int, WorkerInferRequest*> worker;
                 while (_idleWorkerRequests["CPU_HELP"].try_pop(worker)) {
                     destroynum++;
                     _cpuHelpInferCount += worker.second->_inferCount;
                 }
                 if (destroynum == _workerRequests["CPU_HELP"].size()) {
+                    MigrateVariableStates(_workerRequests["CPU_HELP"],
+                                          _workerRequests[_loadContext[ACTUALDEVICE].workName]);
                     std::lock_guard<std::mutex> lock(_confMutex);
                     _workerRequests["CPU_HELP"].clear();
                     _loadContext[CPU].executableNetwork._ptr.reset();
                     _loadContext[CPU].executableNetwork._so.reset();
+                    _switchStats["SWITCH_MS"] =
+                        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - switchStart).count();
+                    LOG_INFO("[AUTOPLUGIN]:CPU_HELP released in %f ms after the accelerator got ready",
+                             _switchStats["SWITCH_MS"]);
                     break;
                 }
             }
@@ -446,6 +479,13 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             // _acceleratorDevice could be the same as _cpuDevice, such as AUTO:CPU
             if (_loadContext[ACTUALDEVICE].isAlready) {
                 devices.push_back(_loadContext[ACTUALDEVICE].deviceInfo);
+                // the tasks go to the helper only when the accelerator has no idle request
+                if (_context.cpuOverflow && _loadContext[CPU].isAlready &&
+                    _loadContext[ACTUALDEVICE].workName != _loadContext[CPU].deviceInfo.deviceName) {
+                    auto deviceInfo = _loadContext[CPU].deviceInfo;
+                    deviceInfo.deviceName = _loadContext[CPU].workName;
+                    devices.push_back(std::move(deviceInfo));
+                }
             } else {
                 // replace deviceName with workName, so schedule can select correct
                 // idleWorkerQueue
@@ -460,11 +500,16 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             return _devicePriorities;
         }();
     }
-    for (auto&& device : devices) {
-        if (!preferred_device.empty() && (device.deviceName != preferred_device))
-            continue;
-        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+    if (_loadAwareScheduling && preferred_device.empty()) {
+        if (RunPipelineTaskByExpectedCompletion(inferPipelineTask, devices))
             return;
+    } else {
+        for (auto&& device : devices) {
+            if (!preferred_device.empty() && (device.deviceName != preferred_device))
+                continue;
+            if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+                return;
+            }
         }
     }
 
@@ -482,6 +527,7 @@ bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
   std::pair<int, WorkerInferRequest*> worker;
   if (idleWorkerRequests.try_pop(worker)) {
       workerRequestPtr = worker.second;
+      workerRequestPtr->_startTime = std::chrono::steady_clock::now();
       IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
       _thisWorkerInferRequest = workerRequestPtr;
       {
@@ -494,8 +540,114 @@ bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
   return false;
 }
 
+void MultiDeviceExecutableNetwork::MigrateVariableStates(const std::vector<WorkerInferRequest>& from,
+                                                         const std::vector<WorkerInferRequest>& to) {
+    // the user requests are not bound to the worker ones, so the states are carried over by the index of the request
+    if (to.empty())
+        return;
+    for (size_t i = 0; i < from.size(); i++) {
+        try {
+            auto toStates = to[i % to.size()]._inferRequest->QueryState();
+            for (auto&& fromState : from[i]._inferRequest->QueryState()) {
+                auto toState = std::find_if(toStates.begin(), toStates.end(),
+                    [&](const std::shared_ptr<IVariableStateInternal>& state) {
+                        return state->GetName() == fromState->GetName();
+                    });
+                if (toState != toStates.end())
+                    (*toState)->SetState(std::const_pointer_cast<Blob>(fromState->GetState()));
+            }
+        } catch (const InferenceEngine::Exception& iie) {
+            LOG_DEBUG("[AUTOPLUGIN]:the variable states are not migrated from CPU_HELP: %s", iie.what());
+            return;
+        }
+    }
+}
+
+void MultiDeviceExecutableNetwork::DeviceServiceTime::Update(double timeMs) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // the weight of the new sample in the moving average
+    constexpr double weight = 0.1;
+    _timeMs = _timeMs ? _timeMs + weight * (timeMs - _timeMs) : timeMs;
+}
+
+double MultiDeviceExecutableNetwork::DeviceServiceTime::Get() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _timeMs;
+}
+
+void MultiDeviceExecutableNetwork::DeviceRequestStats::Add(double queueMs, double execMs) {
+    // the percentiles are of the window of the last samples
+    constexpr size_t window = 1024;
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_queueMs.size() < window) {
+        _queueMs.push_back(static_cast<float>(queueMs));
+        _execMs.push_back(static_cast<float>(execMs));
+    } else {
+        _queueMs[_count % window] = static_cast<float>(queueMs);
+        _execMs[_count % window] = static_cast<float>(execMs);
+    }
+    _count++;
+}
+
+void MultiDeviceExecutableNetwork::DeviceRequestStats::Report(const std::string& device,
+                                                              std::map<std::string, float>& stats) const {
+    std::vector<float> queueMs, execMs;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        stats[device + ":COUNT"] = static_cast<float>(_count);
+        queueMs = _queueMs;
+        execMs = _execMs;
+    }
+    if (queueMs.empty())
+        return;
+    auto percentiles = [&](const std::string& name, std::vector<float>& samples) {
+        for (auto&& percentile : {50, 90, 99}) {
+            auto nth = samples.begin() + (samples.size() - 1) * percentile / 100;
+            std::nth_element(samples.begin(), nth, samples.end());
+            stats[device + ":" + name + "_P" + std::to_string(percentile) + "_MS"] = *nth;
+        }
+    };
+    percentiles("QUEUE", queueMs);
+    percentiles("EXEC", execMs);
+}
+
+bool MultiDeviceExecutableNetwork::RunPipelineTaskByExpectedCompletion(Task& inferPipelineTask,
+                                                                       const std::vector<DeviceInformation>& devices) {
+    // the devices are tried from the fastest one, the ones with no estimate yet go first to get it
+    std::vector<std::pair<double, const DeviceInformation*>> byServiceTime;
+    for (auto&& device : devices) {
+        auto serviceTime = _serviceTimes.find(device.deviceName);
+        byServiceTime.emplace_back(serviceTime == _serviceTimes.end() ? 0 : serviceTime->second->Get(), &device);
+    }
+    std::stable_sort(byServiceTime.begin(), byServiceTime.end(),
+                     [](const std::pair<double, const DeviceInformation*>& a,
+                        const std::pair<double, const DeviceInformation*>& b) { return a.first < b.first; });
+
+    // the task waits for a busy device until one of its requests frees, i.e. a service time / #requests on average,
+    // it's held for that device if it completes there earlier than on the slower idle one. The request of the busy
+    // device picks the task up from the queue on its completion
+    double busyCompletion = std::numeric_limits<double>::max();
+    for (auto&& device : byServiceTime) {
+        const auto serviceTime = device.first;
+        const auto& deviceName = device.second->deviceName;
+        if (serviceTime > 0 && busyCompletion < serviceTime)
+            return false;
+        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[deviceName], ""))
+            return true;
+        const auto numRequests = _workerRequests[deviceName].size();
+        if (serviceTime > 0 && numRequests)
+            busyCompletion = std::min(busyCompletion, serviceTime + serviceTime / numRequests);
+    }
+    return false;
+}
+
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
-    ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
+    // the task may wait in the queue for an idle request, the worker request it's run on records the time it came
+    const auto enqueueTime = std::chrono::steady_clock::now();
+    ScheduleToWorkerInferRequest([inferPipelineTask, enqueueTime] {
+        _thisWorkerInferRequest->_enqueueTime = enqueueTime;
+        inferPipelineTask();
+    }, _thisPreferredDeviceName);
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
@@ -800,6 +952,19 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, real);
         }
 
+        if (name == PluginConfigInternalParams::METRIC_AUTO_SWITCH_STATS) {
+            std::lock_guard<std::mutex> lock(_confMutex);
+            return decltype(_switchStats)(_switchStats);
+        }
+
+        if (name == PluginConfigInternalParams::METRIC_MULTI_REQUEST_STATS) {
+            std::map<std::string, float> stats;
+            std::lock_guard<std::mutex> lock(_confMutex);
+            for (auto&& requestStats : _requestStats)
+                requestStats.second->Report(requestStats.first, stats);
+            return decltype(stats)(stats);
+        }
+
         if (_loadContext[ACTUALDEVICE].isAlready) {
             return _loadContext[ACTUALDEVICE].executableNetwork->GetMetric(name);
         }
@@ -819,6 +984,11 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
            }
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == PluginConfigInternalParams::METRIC_MULTI_REQUEST_STATS) {
+        std::map<std::string, float> stats;
+        for (auto&& requestStats : _requestStats)
+            requestStats.second->Report(requestStats.first, stats);
+        return decltype(stats)(stats);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         auto it = _networksPerDevice.begin();
         IE_ASSERT(it != _networksPerDevice.end());
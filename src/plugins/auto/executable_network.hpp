@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <unordered_map>
 #include <map>
@@ -46,6 +47,8 @@ struct AutoContext {
     bool           needPerfCounters = {false};
     unsigned int   modelPriority = 0;
     bool           batchingDisabled = {false};
+    bool           cpuOverflow = {false};
+    bool           cumulativeThroughput = {false};
 };
 
 struct AutoLoadContext {
@@ -86,6 +89,26 @@ public:
         std::exception_ptr                        _exceptionPtr = nullptr;
         unsigned int                              _inferCount = 0;
         int                                       _index = 0;
+        std::chrono::steady_clock::time_point     _startTime;
+        std::chrono::steady_clock::time_point     _enqueueTime;
+    };
+    // the moving average of the time the requests of a device take from the start to the completion
+    struct DeviceServiceTime {
+        void Update(double timeMs);
+        double Get() const;
+
+        mutable std::mutex                        _mutex;
+        double                                    _timeMs = 0;
+    };
+    // the times the last requests of a device waited for an idle request and took on the device
+    struct DeviceRequestStats {
+        void Add(double queueMs, double execMs);
+        void Report(const std::string& device, std::map<std::string, float>& stats) const;
+
+        mutable std::mutex                        _mutex;
+        size_t                                    _count = 0;
+        std::vector<float>                        _queueMs;
+        std::vector<float>                        _execMs;
     };
     using NotBusyWorkerRequests = InferenceEngine::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
 
@@ -129,6 +152,8 @@ public:
     DeviceMap<std::unique_ptr<InferenceEngine::ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<std::unique_ptr<DeviceServiceTime>>               _serviceTimes;
+    DeviceMap<std::unique_ptr<DeviceRequestStats>>              _requestStats;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
@@ -140,6 +165,10 @@ private:
     static bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask,
                                 NotBusyWorkerRequests& idleWorkerRequests,
                                 const DeviceName& preferred_device);
+    static void MigrateVariableStates(const std::vector<WorkerInferRequest>& from,
+                                      const std::vector<WorkerInferRequest>& to);
+    bool RunPipelineTaskByExpectedCompletion(InferenceEngine::Task& inferPipelineTask,
+                                             const std::vector<DeviceInformation>& devices);
     void TryToLoadNetWork(AutoLoadContext& context,
                           const std::string& modelPath,
                           const InferenceEngine::CNNNetwork& network);
@@ -150,6 +179,7 @@ private:
     MultiDeviceInferencePlugin*                                         _multiPlugin = nullptr;
     AutoContext                                                         _context;
     bool                                                                _workModeIsAUTO = {false};
+    bool                                                                _loadAwareScheduling = {false};
     mutable std::once_flag                                              _oc;
     std::once_flag                                                      _firstLoadOC;
     std::future<void>                                                   _firstLoadFuture;
@@ -159,6 +189,8 @@ private:
     bool                                                                _exitFlag = {false};
     const InferenceEngine::CNNNetwork                                   _network;
     int                                                                 _cpuHelpInferCount = 0;
+    std::chrono::steady_clock::time_point                               _loadStartTime;
+    std::map<std::string, float>                                        _switchStats;
 };
 
 }  // namespace MultiDevicePlugin
@@ -59,6 +59,9 @@ namespace {
                     auto res = PerfHintsConfig::SupportedKeys();
                     res.push_back(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
                     res.push_back(CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO));
+                    res.push_back(CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING));
+                    res.push_back(CONFIG_KEY_INTERNAL(AUTO_CPU_OVERFLOW));
+                    res.push_back(CONFIG_KEY_INTERNAL(AUTO_CUMULATIVE_THROUGHPUT));
                     res.push_back(ov::enable_profiling.name());
                     res.push_back(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS);
                     res.push_back(ov::hint::model_priority.name());
@@ -257,7 +260,7 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         CheckConfig(fullConfig, context, filterConfig);
         // filter the device that supports filter configure
         auto strDevices = GetDeviceList(fullConfig);
-        auto metaDevices = ParseMetaDevices(strDevices, fullConfig);
+        metaDevices = ParseMetaDevices(strDevices, fullConfig);
         auto supportDevicesByConfig = FilterDevice(metaDevices, filterConfig);
         if (supportDevicesByConfig.size() == 0) {
              IE_THROW() << "There is no device support the configure";
@@ -284,19 +287,31 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
                             });
              if (tmpiter != fullConfig.end())
                  deviceConfig.insert({tmpiter->first, tmpiter->second});
+             // the requests count of each device is its optimal one for the throughput unless another hint is set
+             if (context.cumulativeThroughput)
+                 deviceConfig.insert({PluginConfigParams::KEY_PERFORMANCE_HINT, PluginConfigParams::THROUGHPUT});
              iter->config = deviceConfig;
              strDevices += iter->deviceName;
              strDevices += ((iter + 1) == supportDevices.end()) ? "" : ",";
         }
-        return std::make_shared<MultiDeviceExecutableNetwork>(modelPath, network, supportDevices, strDevices, this, context, context.needPerfCounters);
+        if (!context.cumulativeThroughput)
+            return std::make_shared<MultiDeviceExecutableNetwork>(modelPath, network, supportDevices, strDevices, this, context, context.needPerfCounters);
+        // load to all the devices and schedule the requests to them the MULTI way
+        metaDevices = supportDevices;
+        multiNetworkConfig.insert({MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES, strDevices});
+        multiNetworkConfig.insert({CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING), PluginConfigParams::YES});
+    } else {
+        if (priorities == fullConfig.end()) {
+            IE_THROW() << "KEY_MULTI_DEVICE_PRIORITIES key is not set for " << GetName() << " device";
+        } else {  // for use case -d MULTI:xPU or -d AUTO:xPU
+            metaDevices = ParseMetaDevices(priorities->second, fullConfig);
+            multiNetworkConfig.insert(*priorities);
+        }
+        auto loadAwareScheduling = fullConfig.find(CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING));
+        if (loadAwareScheduling != fullConfig.end())
+            multiNetworkConfig.insert(*loadAwareScheduling);
     }
     OV_ITT_SCOPED_TASK(itt::domains::MULTIPlugin, "MultiDeviceInferencePlugin::LoadNetworkImpl:MultiMode");
-    if (priorities == fullConfig.end()) {
-        IE_THROW() << "KEY_MULTI_DEVICE_PRIORITIES key is not set for " << GetName() << " device";
-    } else {  // for use case -d MULTI:xPU or -d AUTO:xPU
-        metaDevices = ParseMetaDevices(priorities->second, fullConfig);
-        multiNetworkConfig.insert(*priorities);
-    }
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -610,6 +625,24 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 context.batchingDisabled = true;
                 continue;
             }
+        } else if (kvp.first == CONFIG_KEY_INTERNAL(AUTO_CPU_OVERFLOW)) {
+            if (kvp.second == PluginConfigParams::YES) {
+                context.cpuOverflow = true;
+            } else if (kvp.second == PluginConfigParams::NO) {
+                context.cpuOverflow = false;
+            } else {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
+        } else if (kvp.first == CONFIG_KEY_INTERNAL(AUTO_CUMULATIVE_THROUGHPUT)) {
+            if (kvp.second == PluginConfigParams::YES) {
+                context.cumulativeThroughput = true;
+            } else if (kvp.second == PluginConfigParams::NO) {
+                context.cumulativeThroughput = false;
+            } else {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
         } else if (std::find(perf_hints_configs.begin(), perf_hints_configs.end(), kvp.first) != perf_hints_configs.end()) {
             PerfHintsConfig::CheckConfigAndValue(kvp);
         } else if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), kvp.first)) {
@@ -5,10 +5,12 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <blob_factory.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <ie_performance_hints.hpp>
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -24,7 +26,9 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)};
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob, size_t batch_id, size_t batch_num) {
@@ -265,13 +269,78 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::BindBlobsToBatchIfPossible(AutoBatchExecutableNetwork::WorkerInferRequest& worker,
+                                                       const std::vector<AutoBatchInferRequest*>& requests) {
+    auto& batchedRequest = worker._inferRequestBatched;
+    auto bind = [&](const std::string& name, const BlobMap AutoBatchInferRequest::*blobs) {
+        auto batched = worker._batchedBlobs.find(name);
+        if (batched == worker._batchedBlobs.end())
+            batched = worker._batchedBlobs.emplace(name, batchedRequest->GetBlob(name)).first;
+        auto batchedBlob = as<MemoryBlob>(batched->second);
+        if (!batchedBlob)
+            return;
+        const auto batchedSize = batchedBlob->byteSize();
+        const auto sliceSize = batchedSize / requests.size();
+
+        // the user blobs of the slots, the same blob for all of them (e.g. constants) is left as is
+        std::vector<const char*> slices(requests.size(), nullptr);
+        bool contiguous = true;
+        for (auto request : requests) {
+            auto blob = as<MemoryBlob>((request->*blobs).at(name));
+            if (!blob || blob->byteSize() != sliceSize || sliceSize == batchedSize ||
+                blob->getTensorDesc().getPrecision() != batchedBlob->getTensorDesc().getPrecision()) {
+                contiguous = false;
+                break;
+            }
+            slices[request->_batchId] = blob->rmap().as<const char*>();
+        }
+        for (size_t b = 1; contiguous && b < slices.size(); b++)
+            contiguous = slices[b] && slices[b] == slices[0] + b * sliceSize;
+
+        Blob::Ptr target = batched->second;
+        if (contiguous && slices[0] != batchedBlob->rmap().as<const char*>())
+            target = make_blob_with_precision(batchedBlob->getTensorDesc(), const_cast<char*>(slices[0]));
+        auto current = as<MemoryBlob>(batchedRequest->GetBlob(name));
+        if (!current || current->rmap().as<const char*>() != as<MemoryBlob>(target)->rmap().as<const char*>())
+            batchedRequest->SetBlob(name, target);
+    };
+    for (const auto& it : requests.front()->_networkInputs)
+        bind(it.first, &AutoBatchInferRequest::_inputs);
+    for (const auto& it : requests.front()->_networkOutputs)
+        bind(it.first, &AutoBatchInferRequest::_outputs);
+}
+
+void AutoBatchInferRequest::CopyInputsToPartialBatch(SoIInferRequestInternal& req, size_t batch_id, size_t num_batch) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, batch_id, num_batch);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromPartialBatch(SoIInferRequestInternal& req,
+                                                        size_t batch_id,
+                                                        size_t num_batch) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, batch_id, num_batch);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -279,13 +348,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -297,7 +366,11 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
     }
 }
 
@@ -321,6 +394,7 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            workerInferRequest._adaptiveTimeout->onRequestArrival();
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
@@ -336,7 +410,8 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
                       auto& batchReq = this->_inferRequest->_myBatchedRequestWrapper;
                       if (batchReq._exceptionPtr)  // when the batchN execution failed
                           std::rethrow_exception(batchReq._exceptionPtr);
-                      // in the case of non-batched execution the blobs were set explicitly
+                      // in the case of non-batched execution the blobs were set explicitly,
+                      // the partial batch copied the outputs on its completion
                       if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                           this->_inferRequest->_wasBatchedRequestUsed)
                           this->_inferRequest->CopyOutputsIfNeeded();
@@ -357,10 +432,72 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
     StopAndWait();
 }
 
+// ------------------------------AdaptiveBatchTimeout----------------------------
+namespace {
+// the weight of the new sample in the moving averages
+constexpr double movingAverageWeight = 0.1;
+
+void updateMovingAverage(double& average, double sample) {
+    average = average ? average + movingAverageWeight * (sample - average) : sample;
+}
+}  // namespace
+
+void AdaptiveBatchTimeout::onRequestArrival() {
+    if (!isEnabled())
+        return;
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_hasArrival)
+        updateMovingAverage(_interArrivalMs,
+                            std::chrono::duration<double, std::milli>(now - _lastArrival).count());
+    _lastArrival = now;
+    _hasArrival = true;
+}
+
+void AdaptiveBatchTimeout::onExecuted(bool batched, double latencyMs) {
+    if (!isEnabled())
+        return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    updateMovingAverage(batched ? _batchLatencyMs : _batch1LatencyMs, latencyMs);
+}
+
+unsigned int AdaptiveBatchTimeout::getTimeout(unsigned int maxTimeout, int batchSize, size_t numWorkers) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!isEnabled()) {
+        _timeout = maxTimeout;
+        return _timeout;
+    }
+    const double budget = static_cast<double>(_latencyTarget) - _batchLatencyMs;
+    double timeout = budget;
+    if (_interArrivalMs) {
+        // the time the batch of the worker is collected in: the mean and the 99th percentile of the Poisson arrivals
+        const double arrivals = batchSize - 1;
+        const double workerInterArrival = _interArrivalMs * std::max<size_t>(numWorkers, 1);
+        const double toFillMean = workerInterArrival * arrivals;
+        const double toFill99 = workerInterArrival * (arrivals + 2.33 * std::sqrt(arrivals));
+        if (toFill99 <= budget)
+            timeout = toFill99;
+        else if (toFillMean > budget)
+            timeout = 0;
+    }
+    _timeout = std::min(maxTimeout, static_cast<unsigned int>(std::max(1.0, std::ceil(timeout))));
+    return _timeout;
+}
+
+std::map<std::string, float> AdaptiveBatchTimeout::getStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {{"LATENCY_TARGET_MS", static_cast<float>(_latencyTarget)},
+            {"TIMEOUT_MS", static_cast<float>(_timeout)},
+            {"ARRIVAL_RATE", _interArrivalMs ? static_cast<float>(1000.0 / _interArrivalMs) : 0.f},
+            {"BATCH_LATENCY_MS", static_cast<float>(_batchLatencyMs)},
+            {"BATCH1_LATENCY_MS", static_cast<float>(_batch1LatencyMs)}};
+}
+
 // ------------------------------AutoBatchExecutableNetwork----------------------------
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
+    const std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>>& networksWithPartialBatch,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const bool needPerfCounters)
@@ -368,6 +505,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksWithPartialBatch{networksWithPartialBatch},
       _config{config},
       _needPerfCounters{needPerfCounters} {
     // WA for gcc 4.8 ( fails compilation with member init-list)
@@ -375,6 +513,9 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_target = config.find(CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET));
+    if (latency_target != config.end())
+        _adaptiveTimeout.setLatencyTarget(ParseLatencyTargetValue(latency_target->second.as<std::string>()));
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -392,6 +533,14 @@ unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s)
     return val;
 }
 
+unsigned int AutoBatchExecutableNetwork::ParseLatencyTargetValue(const std::string& s) {
+    auto val = std::stoi(s);
+    if (val < 0)
+        IE_THROW(ParameterMismatch) << "Value for the " << CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)
+                                    << " should be unsigned int";
+    return val;
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _network->GetContext();
 }
@@ -434,11 +583,20 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         auto workerRequestPtr = _workerRequests.back().get();
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
+        for (auto& partial : _networksWithPartialBatch)
+            workerRequestPtr->_inferRequestsPartialBatch.emplace_back(
+                partial.first,
+                SoIInferRequestInternal{partial.second->CreateInferRequest(), partial.second._so});
+        workerRequestPtr->_adaptiveTimeout = &_adaptiveTimeout;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                _adaptiveTimeout.onExecuted(true,
+                                            std::chrono::duration<double, std::milli>(
+                                                std::chrono::steady_clock::now() - workerRequestPtr->_batchStart)
+                                                .count());
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -451,9 +609,15 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
             while (1) {
                 std::cv_status status;
+                size_t numWorkers;
+                {
+                    std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+                    numWorkers = _workerRequests.size();
+                }
+                const auto timeout = _adaptiveTimeout.getTimeout(_timeOut, workerRequestPtr->_batchSize, numWorkers);
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(timeout));
                 }
                 if (_terminate) {
                     break;
@@ -463,29 +627,76 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     const int sz = workerRequestPtr->_tasks.size();
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                        std::vector<AutoBatchInferRequest*> requests(sz);
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
-                            t.first->_inferRequest->CopyInputsIfNeeded();
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
+                            requests[n] = t.first->_inferRequest.get();
+                            requests[n]->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        // the bound blobs are skipped by the copies as they are the slices of the batched ones
+                        AutoBatchInferRequest::BindBlobsToBatchIfPossible(*workerRequestPtr, requests);
+                        for (auto request : requests)
+                            request->CopyInputsIfNeeded();
+                        workerRequestPtr->_batchStart = std::chrono::steady_clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // timeout to collect the batch is over, have to execute the requests with the largest smaller
+                        // batches that fit them and the rest in the batch1 mode
+                        std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(sz);
+                        // popping all tasks collected by the moment of the time-out
+                        for (int n = 0; n < sz; n++)
+                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
+                        // the partial batches as the index of the request and the first task
+                        std::vector<std::pair<size_t, int>> partialBatches;
+                        int firstBatch1 = 0;
+                        for (size_t r = 0; r < workerRequestPtr->_inferRequestsPartialBatch.size(); r++) {
+                            const int batch = workerRequestPtr->_inferRequestsPartialBatch[r].first;
+                            if (sz - firstBatch1 >= batch) {
+                                partialBatches.emplace_back(r, firstBatch1);
+                                firstBatch1 += batch;
+                            }
+                        }
+                        const int executions = static_cast<int>(partialBatches.size()) + sz - firstBatch1;
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        const auto start = std::chrono::steady_clock::now();
+                        for (auto& partialBatch : partialBatches) {
+                            auto& req = workerRequestPtr->_inferRequestsPartialBatch[partialBatch.first];
+                            const int batch = req.first;
+                            const int first = partialBatch.second;
+                            for (int n = 0; n < batch; n++) {
+                                auto& t = tasks[first + n];
+                                t.first->_inferRequest->CopyInputsToPartialBatch(req.second, n, batch);
+                                t.first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                            }
+                            req.second->SetCallback(
+                                [&tasks, &req, batch, first, executions, &arrived, &all_completed](
+                                    std::exception_ptr p) {
+                                    for (int n = 0; n < batch; n++) {
+                                        auto& t = tasks[first + n];
+                                        if (p)
+                                            t.first->_inferRequest->_exceptionPtr = p;
+                                        else
+                                            t.first->_inferRequest->CopyOutputsFromPartialBatch(req.second, n, batch);
+                                        t.second();
+                                    }
+                                    if (executions == ++arrived)
+                                        all_completed.set_value();
+                                });
+                            req.second->StartAsync();
+                        }
+                        for (int n = firstBatch1; n < sz; n++) {
+                            auto& t = tasks[n];
                             t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, executions, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
                                         t.first->_inferRequest->_exceptionPtr = p;
                                     t.second();
-                                    if (sz == ++arrived)
+                                    if (executions == ++arrived)
                                         all_completed.set_value();
                                 });
                             t.first->_inferRequest->_wasBatchedRequestUsed =
@@ -494,6 +705,9 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequestWithoutBatch->StartAsync();
                         }
                         all_completed_future.get();
+                        _adaptiveTimeout.onExecuted(
+                            false,
+                            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -527,12 +741,16 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 }
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
-    auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == config.end() || config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
-        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
+    for (auto&& kvp : config) {
+        if (kvp.first == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+            _timeOut = ParseTimeoutValue(kvp.second.as<std::string>());
+        } else if (kvp.first == CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)) {
+            _adaptiveTimeout.setLatencyTarget(ParseLatencyTargetValue(kvp.second.as<std::string>()));
+        } else {
+            IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                       << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and the " << CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET);
+        }
+        _config[kvp.first] = kvp.second;
     }
 }
 
@@ -568,15 +786,19 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, reqs);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _network->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == PluginConfigInternalParams::METRIC_AUTO_BATCH_TIMEOUT_STATS) {
+        return _adaptiveTimeout.getStats();
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS,
                              {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+                              METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              PluginConfigInternalParams::METRIC_AUTO_BATCH_TIMEOUT_STATS});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        // only the timeouts can be changed on the fly
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)});
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -679,14 +901,14 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception& e) {
                 IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                    << " Expecting unsigned int value for " << name << " got " << val;
             }
         }
     }
@@ -705,6 +927,7 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)] = "0";  // the fixed timeout by default
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -854,8 +1077,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
-    InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
-    if (metaDevice.batchForDevice > 1) {
+    auto loadNetworkWithBatch = [&](int batch) -> InferenceEngine::SoExecutableNetworkInternal {
         try {
             CNNNetwork clonedNetwork(InferenceEngine::details::cloneNetwork(network));
             const InputsDataMap inputInfo = clonedNetwork.getInputsInfo();
@@ -868,15 +1090,29 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
                     layout == InferenceEngine::Layout::NCHW || layout == InferenceEngine::Layout::NHWC ||
                     layout == InferenceEngine::Layout::NDHWC) {
                     assert(1 == shapes[item.first][0]);  // do not reshape/re-batch originally batched networks
-                    shapes[item.first][0] = metaDevice.batchForDevice;
+                    shapes[item.first][0] = batch;
                 }
             }
             clonedNetwork.reshape(shapes);
-            executableNetworkWithBatch =
-                ctx ? GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, ctx, deviceConfigNoAutoBatch)
-                    : GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfigNoAutoBatch);
+            return ctx ? GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, ctx, deviceConfigNoAutoBatch)
+                       : GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfigNoAutoBatch);
         } catch (...) {
-            executableNetworkWithBatch = {nullptr, nullptr};
+            return {nullptr, nullptr};
+        }
+    };
+
+    InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
+    if (metaDevice.batchForDevice > 1)
+        executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
+
+    // the ladder of the halved batches the partially collected batch is executed with on the time-out,
+    // the networks which fail to load are skipped
+    std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>> executableNetworksWithPartialBatch;
+    if (executableNetworkWithBatch) {
+        for (int batch = metaDevice.batchForDevice / 2; batch > 1; batch /= 2) {
+            auto executableNetwork = loadNetworkWithBatch(batch);
+            if (executableNetwork)
+                executableNetworksWithPartialBatch.emplace_back(batch, executableNetwork);
         }
     }
 
@@ -887,6 +1123,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
+                                                        executableNetworksWithPartialBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         enablePerfCounters);
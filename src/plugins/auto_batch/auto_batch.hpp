@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -29,6 +30,40 @@ struct DeviceInformation {
     int batchForDevice;
 };
 
+/**
+ * @brief Picks the time the worker waits for its batch to be collected from the arrival rate of the requests and the
+ * device latency of the batched and the batch1 executions. The batch fills with the 99th percentile of the Poisson
+ * arrivals, so the timeout is the time it takes unless the latency target is missed then. Otherwise it's the time left
+ * to the target after the batched execution, or the smallest one when the batch can't be filled in time even on average,
+ * as the requests are executed with batch1 on the time-out anyway
+ */
+class AdaptiveBatchTimeout {
+public:
+    void setLatencyTarget(unsigned int ms) {
+        _latencyTarget = ms;
+    }
+    bool isEnabled() const {
+        return _latencyTarget != 0;
+    }
+    // thread-safe, called for every request submitted to the worker
+    void onRequestArrival();
+    void onExecuted(bool batched, double latencyMs);
+    // the timeout in ms, the configured one is the upper bound. The requests are spread over the workers, so each one
+    // receives its share of the arrivals
+    unsigned int getTimeout(unsigned int maxTimeout, int batchSize, size_t numWorkers);
+    std::map<std::string, float> getStats() const;
+
+private:
+    std::atomic_uint _latencyTarget = {0};  // in ms
+    mutable std::mutex _mutex;
+    std::chrono::steady_clock::time_point _lastArrival;
+    bool _hasArrival = false;
+    double _interArrivalMs = 0;  // the moving averages
+    double _batchLatencyMs = 0;
+    double _batch1LatencyMs = 0;
+    unsigned int _timeout = 0;
+};
+
 class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
@@ -37,17 +72,24 @@ public:
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
         int _batchSize;
+        // the requests of the smaller batched networks, in the descending order of the batch
+        std::vector<std::pair<int, InferenceEngine::SoIInferRequestInternal>> _inferRequestsPartialBatch;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        std::chrono::steady_clock::time_point _batchStart;
+        // the blobs the batched request was created with, the user blobs may be bound instead of them
+        std::map<std::string, InferenceEngine::Blob::Ptr> _batchedBlobs;
+        AdaptiveBatchTimeout* _adaptiveTimeout = nullptr;
     };
 
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
+        const std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>>& networksWithPartialBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const bool needPerfCounters = false);
@@ -68,10 +110,13 @@ public:
 
 protected:
     static unsigned int ParseTimeoutValue(const std::string&);
+    static unsigned int ParseLatencyTargetValue(const std::string&);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    // the networks with the smaller batches the partially collected batch is executed with
+    std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>> _networksWithPartialBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -81,6 +126,7 @@ protected:
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    AdaptiveBatchTimeout _adaptiveTimeout;
 };
 
 class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -104,18 +150,30 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // binds the batched request to the user blobs of the collected requests when they are the consecutive slices of one
+    // memory region, so the batch is assembled with no copy, and restores the batched blobs otherwise
+    static void BindBlobsToBatchIfPossible(AutoBatchExecutableNetwork::WorkerInferRequest& worker,
+                                           const std::vector<AutoBatchInferRequest*>& requests);
+    // copies the blobs to or from the batch_id slice of the request with the smaller batch
+    void CopyInputsToPartialBatch(InferenceEngine::SoIInferRequestInternal& req, size_t batch_id, size_t num_batch);
+    void CopyOutputsFromPartialBatch(InferenceEngine::SoIInferRequestInternal& req, size_t batch_id, size_t num_batch);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfMap;
 
 protected:
     bool _needPerfCounters = false;
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest();
     size_t _batchId;
     size_t _batchSize;
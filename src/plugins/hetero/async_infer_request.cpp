@@ -17,6 +17,31 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
+        if (_heteroInferRequest->IsPipelined()) {
+            struct SubRequestExecutor : ITaskExecutor {
+                SubRequestExecutor(HeteroInferRequest& heteroInferRequest, std::size_t subgraph)
+                    : _heteroInferRequest(heteroInferRequest),
+                      _subgraph(subgraph) {}
+                void run(Task task) override {
+                    _heteroInferRequest.RunSubRequest(_subgraph, [this, task](std::exception_ptr exceptionPtr) {
+                        _exceptionPtr = exceptionPtr;
+                        task();
+                    });
+                };
+                HeteroInferRequest& _heteroInferRequest;
+                std::size_t _subgraph;
+                std::exception_ptr _exceptionPtr;
+            };
+
+            auto subRequestExecutor = std::make_shared<SubRequestExecutor>(*_heteroInferRequest, requestId);
+            _pipeline.emplace_back(subRequestExecutor, [subRequestExecutor] {
+                if (nullptr != subRequestExecutor->_exceptionPtr) {
+                    std::rethrow_exception(subRequestExecutor->_exceptionPtr);
+                }
+            });
+            continue;
+        }
+
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
@@ -50,7 +75,8 @@ StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch (...) {
         for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
-            requestDesc._request->Wait(InferRequest::RESULT_READY);
+            if (requestDesc._request)
+                requestDesc._request->Wait(InferRequest::RESULT_READY);
         }
         throw;
     }
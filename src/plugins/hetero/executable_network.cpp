@@ -789,36 +789,51 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
     }
 }
 
-IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
-    const std::vector<std::shared_ptr<const ov::Node>>& inputs,
-    const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
-    if (!this->_plugin)
-        return nullptr;
-    const auto& core = _plugin->GetCore();
-    if (!core || !core->isNewAPI())
-        return nullptr;
+bool HeteroExecutableNetwork::IsPipelined() const {
+    auto it = _config.find(CONFIG_KEY_INTERNAL(HETERO_PIPELINED_EXECUTION));
+    return it != _config.end() && it->second == YES;
+}
+
+const std::vector<SubRequestPool::Ptr>& HeteroExecutableNetwork::GetSubRequestPools() {
+    std::call_once(_subRequestPoolsOnce, [this] {
+        for (auto&& subnetwork : _networks) {
+            auto& network = subnetwork._network;
+            auto numRequests = network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            _subRequestPools.push_back(std::make_shared<SubRequestPool>(network, std::max(numRequests, 1u)));
+        }
+    });
+    return _subRequestPools;
+}
+
+HeteroInferRequest::SubRequestsList HeteroExecutableNetwork::CreateSubRequestsList() {
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        if (IsPipelined()) {
+            desc._pool = GetSubRequestPools()[index];
+        }
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
-    return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
+    return inferRequests;
+}
+
+IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
+    const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+    const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
+    if (!this->_plugin)
+        return nullptr;
+    const auto& core = _plugin->GetCore();
+    if (!core || !core->isNewAPI())
+        return nullptr;
+    return std::make_shared<HeteroInferRequest>(inputs, outputs, CreateSubRequestsList(), _blobNameMap);
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                            OutputsDataMap networkOutputs) {
-    HeteroInferRequest::SubRequestsList inferRequests;
-    int index = 0;
-    for (auto&& subnetwork : _networks) {
-        HeteroInferRequest::SubRequestDesc desc;
-        desc._network = subnetwork._network;
-        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
-        inferRequests.push_back(desc);
-    }
-    return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
+    return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, CreateSubRequestsList(), _blobNameMap);
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
@@ -837,6 +852,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         } else {
             result = std::string{};
         }
+    } else if (name == CONFIG_KEY_INTERNAL(HETERO_PIPELINED_EXECUTION)) {
+        result = IsPipelined();
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -921,7 +938,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
-                                                     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
+                                                     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+                                                     CONFIG_KEY_INTERNAL(HETERO_PIPELINED_EXECUTION)};
 
         {
             std::vector<::Metrics> pluginConfigKeys;
@@ -944,8 +962,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto numRequests =
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            // in the pipelined mode all the subgraph requests are kept busy with the different HETERO requests
+            value = IsPipelined() ? value + numRequests : std::max(value, numRequests);
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
@@ -13,6 +13,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -65,6 +66,9 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    bool IsPipelined() const;
+    const std::vector<SubRequestPool::Ptr>& GetSubRequestPools();
+    HeteroInferRequest::SubRequestsList CreateSubRequestsList();
 
     struct NetworkDesc {
         std::string _device;
@@ -77,6 +81,8 @@ private:
     std::string _name;
     std::map<std::string, std::string> _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::once_flag _subRequestPoolsOnce;
+    std::vector<SubRequestPool::Ptr> _subRequestPools;
 };
 
 }  // namespace HeteroPlugin
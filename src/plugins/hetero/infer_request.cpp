@@ -7,8 +7,10 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <blob_factory.hpp>
 #include <cassert>
 #include <description_buffer.hpp>
+#include <future>
 #include <ie_algorithm.hpp>
 #include <map>
 #include <string>
@@ -19,6 +21,111 @@ using namespace HeteroPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+// the context of the subgraph the intermediate blob is read by, its host blobs are the memory the device reads in
+// place, e.g. the USM host memory of GPU. The CPU reads any host memory in place, so the blob of the producer is kept
+RemoteContext::Ptr ConsumerContext(const SoExecutableNetworkInternal& network) {
+    try {
+        auto context = network->GetContext();
+        if (context && context->getDeviceName().find("CPU") != 0) {
+            return context;
+        }
+    } catch (const NotImplemented&) {
+    }
+    return nullptr;
+}
+
+// the contexts of the subgraphs reading the intermediate blobs by the names of the blobs
+std::unordered_map<std::string, RemoteContext::Ptr> ConsumerContexts(
+    const HeteroInferRequest::SubRequestsList& inferRequests,
+    const InputsDataMap& networkInputs,
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
+    std::unordered_map<std::string, RemoteContext::Ptr> contexts;
+    for (auto&& desc : inferRequests) {
+        RemoteContext::Ptr context;
+        bool queried = false;
+        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
+            if (InferenceEngine::details::contains(networkInputs, inputInfo.first)) {
+                continue;
+            }
+            if (!queried) {
+                context = ConsumerContext(desc._network);
+                queried = true;
+            }
+            if (context) {
+                auto itName = subgraphInputToOutputBlobNames.find(inputInfo.first);
+                contexts.emplace(itName != subgraphInputToOutputBlobNames.end() ? itName->second : inputInfo.first,
+                                 context);
+            }
+        }
+    }
+    return contexts;
+}
+
+Blob::Ptr CreateHostBlob(const RemoteContext::Ptr& context, const TensorDesc& desc) {
+    Blob::Ptr blob = context ? context->CreateHostBlob(desc) : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+}  // namespace
+
+SubRequestPool::SubRequestPool(const SoExecutableNetworkInternal& network, size_t size) : _workers(size) {
+    for (auto&& worker : _workers) {
+        worker._request = {network->CreateInferRequest(), network._so};
+        worker._request->setModelInputsOutputs(network->getInputs(), network->getOutputs());
+        auto* workerPtr = &worker;
+        worker._request->SetCallback([this, workerPtr](std::exception_ptr exceptionPtr) {
+            auto done = std::move(workerPtr->_done);
+            done(exceptionPtr);
+            Release(*workerPtr);
+        });
+        _idleWorkers.push_back(workerPtr);
+    }
+}
+
+void SubRequestPool::Run(Bind bind, Done done) {
+    Worker* worker = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_idleWorkers.empty()) {
+            _waiting.emplace(std::move(bind), std::move(done));
+            return;
+        }
+        worker = _idleWorkers.back();
+        _idleWorkers.pop_back();
+    }
+    Start(*worker, bind, std::move(done));
+}
+
+void SubRequestPool::Start(Worker& worker, const Bind& bind, Done done) {
+    std::exception_ptr exceptionPtr;
+    try {
+        bind(worker._request);
+        worker._done = done;
+        worker._request->StartAsync();
+        return;
+    } catch (...) {
+        exceptionPtr = std::current_exception();
+    }
+    worker._done = {};
+    Release(worker);
+    done(exceptionPtr);
+}
+
+void SubRequestPool::Release(Worker& worker) {
+    std::pair<Bind, Done> next;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_waiting.empty()) {
+            _idleWorkers.push_back(&worker);
+            return;
+        }
+        next = std::move(_waiting.front());
+        _waiting.pop();
+    }
+    Start(worker, next.first, std::move(next.second));
+}
+
 HeteroInferRequest::HeteroInferRequest(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs,
@@ -45,6 +152,14 @@ void HeteroInferRequest::CreateInferRequest(
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
+    if (IsPipelined()) {
+        CreatePipelinedBlobs(subgraphInputToOutputBlobNames);
+        return;
+    }
+
+    // the producer writes the intermediate blob straight to the memory the consumer reads
+    const auto consumerContexts = ConsumerContexts(_inferRequests, _networkInputs, subgraphInputToOutputBlobNames);
+
     auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r, bool output) {
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
@@ -56,7 +171,12 @@ void HeteroInferRequest::CreateInferRequest(
                 _subRequestFromBlobName.emplace(blobName, r._ptr.get());
             } else {
                 auto blob = r->GetBlob(blobName);
-                _blobs.emplace(intermediateBlobName, r->GetBlob(blobName));
+                auto itContext = consumerContexts.find(intermediateBlobName);
+                if (itContext != consumerContexts.end()) {
+                    blob = CreateHostBlob(itContext->second, blob->getTensorDesc());
+                    r->SetBlob(blobName, blob);
+                }
+                _blobs.emplace(intermediateBlobName, blob);
             }
         } else {
             if (InferenceEngine::details::contains(_networkInputs, blobName)) {
@@ -85,7 +205,82 @@ void HeteroInferRequest::CreateInferRequest(
     }
 }
 
+void HeteroInferRequest::CreatePipelinedBlobs(
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
+    auto intermediateBlobName = [&](const std::string& blobName) {
+        auto itName = subgraphInputToOutputBlobNames.find(blobName);
+        return itName != subgraphInputToOutputBlobNames.end() ? itName->second : blobName;
+    };
+    const auto consumerContexts = ConsumerContexts(_inferRequests, _networkInputs, subgraphInputToOutputBlobNames);
+    auto createBlob = [&](const std::string& blobName, const TensorDesc& desc) {
+        if (_blobs.find(blobName) == _blobs.end()) {
+            auto itContext = consumerContexts.find(blobName);
+            _blobs.emplace(blobName,
+                           CreateHostBlob(itContext != consumerContexts.end() ? itContext->second : nullptr, desc));
+        }
+    };
+
+    // the blobs are owned by this request, as the requests of the pools run the subgraphs of any HETERO request
+    _subgraphBlobNames.resize(_inferRequests.size());
+    for (size_t i = 0; i < _inferRequests.size(); ++i) {
+        for (auto&& outputInfo : _inferRequests[i]._network->GetOutputsInfo()) {
+            auto blobName = InferenceEngine::details::contains(_networkOutputs, outputInfo.first)
+                                ? outputInfo.first
+                                : intermediateBlobName(outputInfo.first);
+            createBlob(blobName, outputInfo.second->getTensorDesc());
+            _subgraphBlobNames[i].emplace_back(outputInfo.first, blobName);
+        }
+    }
+
+    for (size_t i = 0; i < _inferRequests.size(); ++i) {
+        for (auto&& inputInfo : _inferRequests[i]._network->GetInputsInfo()) {
+            auto blobName = inputInfo.first;
+            if (InferenceEngine::details::contains(_networkInputs, blobName)) {
+                createBlob(blobName, inputInfo.second->getTensorDesc());
+            } else {
+                blobName = intermediateBlobName(blobName);
+                if (_blobs.find(blobName) == _blobs.end()) {
+                    IE_THROW() << "Internal error: no subgraph output is connected to the input " << inputInfo.first;
+                }
+            }
+            _subgraphBlobNames[i].emplace_back(inputInfo.first, blobName);
+        }
+    }
+}
+
+bool HeteroInferRequest::IsPipelined() const {
+    return !_inferRequests.empty() && _inferRequests.front()._pool != nullptr;
+}
+
+void HeteroInferRequest::RunSubRequest(size_t subgraph, SubRequestPool::Done done) {
+    _inferRequests[subgraph]._pool->Run(
+        [this, subgraph](const SoIInferRequestInternal& request) {
+            for (auto&& blobNames : _subgraphBlobNames[subgraph]) {
+                auto& blob = _blobs.at(blobNames.second);
+                if (InferenceEngine::details::contains(_networkInputs, blobNames.second)) {
+                    request->SetBlob(blobNames.first, blob, GetPreProcess(blobNames.second));
+                } else {
+                    request->SetBlob(blobNames.first, blob);
+                }
+            }
+            _inferRequests[subgraph]._request = request;
+        },
+        std::move(done));
+}
+
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    if (IsPipelined()) {
+        auto itBlob = _blobs.find(name);
+        if (itBlob == _blobs.end() || (!InferenceEngine::details::contains(_networkInputs, name) &&
+                                       !InferenceEngine::details::contains(_networkOutputs, name))) {
+            IE_THROW() << "There is no infer requests binded to blob with name: " << name;
+        }
+        if (!blob) {
+            IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+        }
+        itBlob->second = blob;
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -94,6 +289,14 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name) {
+    if (IsPipelined()) {
+        auto itBlob = _blobs.find(name);
+        if (itBlob == _blobs.end() || (!InferenceEngine::details::contains(_networkInputs, name) &&
+                                       !InferenceEngine::details::contains(_networkOutputs, name))) {
+            IE_THROW() << "There is no infer requests binded to blob with name: " << name;
+        }
+        return itBlob->second;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -102,6 +305,15 @@ InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name)
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob, const PreProcessInfo& info) {
+    if (IsPipelined()) {
+        // the pre-processing is run by the request of the pool, so it's kept for the time the blob is bound to it
+        if (!InferenceEngine::details::contains(_networkInputs, name)) {
+            IE_THROW() << "Pre-process can't be set to output blob";
+        }
+        SetBlob(name, blob);
+        _preProcess[name] = info;
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -110,6 +322,13 @@ void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob,
 }
 
 const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const std::string& name) const {
+    if (IsPipelined()) {
+        auto itPreProcess = _preProcess.find(name);
+        if (itPreProcess != _preProcess.end()) {
+            return itPreProcess->second;
+        }
+        return IInferRequestInternal::GetPreProcess(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -118,6 +337,22 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (IsPipelined()) {
+        for (size_t i = 0; i < _inferRequests.size(); ++i) {
+            OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, _inferRequests[i]._profilingTask);
+            auto promise = std::make_shared<std::promise<void>>();
+            auto future = promise->get_future();
+            RunSubRequest(i, [promise](std::exception_ptr exceptionPtr) {
+                if (exceptionPtr) {
+                    promise->set_exception(exceptionPtr);
+                } else {
+                    promise->set_value();
+                }
+            });
+            future.get();
+        }
+        return;
+    }
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
@@ -129,6 +364,9 @@ void HeteroInferRequest::InferImpl() {
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
+        // the subgraph has not run yet in the pipelined mode
+        if (!_inferRequests[i]._request)
+            continue;
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
         for (auto&& r : perfMapRequest) {
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
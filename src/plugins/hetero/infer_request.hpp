@@ -8,15 +8,51 @@
 
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
+#include <queue>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace HeteroPlugin {
 
+/**
+ * @brief The requests of a subgraph shared by all the HETERO requests in the pipelined mode. The subgraph of a HETERO
+ *        request runs on an idle request of the pool, the ones waiting for it are queued and started as the requests
+ *        complete, so each device works on the subgraphs of the different HETERO requests at the same time
+ */
+class SubRequestPool {
+public:
+    using Ptr = std::shared_ptr<SubRequestPool>;
+    // binds the blobs of the HETERO request to the request of the pool before it's started
+    using Bind = std::function<void(const InferenceEngine::SoIInferRequestInternal&)>;
+    // is called with the exception of the inference, if any, once the request completes
+    using Done = std::function<void(std::exception_ptr)>;
+
+    SubRequestPool(const InferenceEngine::SoExecutableNetworkInternal& network, size_t size);
+
+    void Run(Bind bind, Done done);
+
+private:
+    struct Worker {
+        InferenceEngine::SoIInferRequestInternal _request;
+        Done _done;
+    };
+
+    void Start(Worker& worker, const Bind& bind, Done done);
+    void Release(Worker& worker);
+
+    std::vector<Worker> _workers;
+    std::mutex _mutex;
+    std::vector<Worker*> _idleWorkers;
+    std::queue<std::pair<Bind, Done>> _waiting;
+};
+
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -25,6 +61,8 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        // the subgraphs run on the requests of the pools in the pipelined mode, _request is then the last one used
+        SubRequestPool::Ptr _pool;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -40,6 +78,13 @@ public:
 
     void InferImpl() override;
 
+    bool IsPipelined() const;
+
+    /**
+     * @brief Runs the subgraph on a request of its pool with the blobs of this request in the pipelined mode
+     */
+    void RunSubRequest(size_t subgraph, SubRequestPool::Done done);
+
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) override;
 
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
@@ -58,6 +103,11 @@ public:
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+    void CreatePipelinedBlobs(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+
+    // the subgraph blob names and the names of the blobs of this request they are bound to in the pipelined mode
+    std::vector<std::vector<std::pair<std::string, std::string>>> _subgraphBlobNames;
+    std::map<std::string, InferenceEngine::PreProcessInfo> _preProcess;
 };
 
 }  // namespace HeteroPlugin
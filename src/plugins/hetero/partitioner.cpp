@@ -0,0 +1,322 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "partitioner.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/util/op_types.hpp"
+
+using namespace HeteroPlugin;
+
+namespace {
+
+// the transfer of a tensor between the subgraphs: the latency in us and the bandwidth in bytes per us
+constexpr double transferLatency = 20.;
+constexpr double transferBandwidth = 10000.;
+constexpr double infinity = std::numeric_limits<double>::infinity();
+constexpr double epsilon = 1e-9;
+
+double elementsCount(const ov::PartialShape& shape) {
+    return shape.is_static() ? static_cast<double>(ov::shape_size(shape.to_shape())) : 1.;
+}
+
+// the multiply-adds of the convolutions and the matrix multiplications, the elements read and written by the rest
+double operationsCount(const ov::Node* node) {
+    double outputs = 0.;
+    for (auto&& output : node->outputs()) {
+        outputs += elementsCount(output.get_partial_shape());
+    }
+    auto reduction = [&]() -> double {
+        if (node->get_input_size() < 2 || node->get_input_partial_shape(1).is_dynamic())
+            return 0.;
+        const auto weights = node->get_input_shape(1);
+        const auto weightsCount = static_cast<double>(ov::shape_size(weights));
+        if (ov::is_type<ov::op::v1::Convolution>(node) && weights.size() > 0 && weights[0]) {
+            return weightsCount / weights[0];
+        } else if (ov::is_type<ov::op::v1::GroupConvolution>(node) && weights.size() > 1 && weights[0] * weights[1]) {
+            return weightsCount / (weights[0] * weights[1]);
+        } else if (ov::is_type<ov::op::v1::ConvolutionBackpropData>(node) && weights.size() > 1 && weights[1]) {
+            return weightsCount / weights[1];
+        } else if (ov::is_type<ov::op::v1::GroupConvolutionBackpropData>(node) && weights.size() > 2 &&
+                   weights[0] * weights[2]) {
+            return weightsCount / (weights[0] * weights[2]);
+        } else if (auto matMul = dynamic_cast<const ov::op::v0::MatMul*>(node)) {
+            const auto& shape = node->get_input_partial_shape(0);
+            if (shape.rank().is_dynamic() || shape.size() == 0)
+                return 0.;
+            const auto& dim =
+                shape.size() > 1 && matMul->get_transpose_a() ? shape[shape.size() - 2] : shape[shape.size() - 1];
+            return dim.is_static() ? static_cast<double>(dim.get_length()) : 0.;
+        }
+        return 0.;
+    }();
+    if (reduction > 0.)
+        return 2. * outputs * reduction;
+
+    double inputs = 0.;
+    for (auto&& input : node->inputs()) {
+        inputs += elementsCount(input.get_partial_shape());
+    }
+    return inputs + outputs;
+}
+
+class MaxFlow {
+public:
+    explicit MaxFlow(size_t size) : _graph(size), _level(size), _next(size) {}
+
+    void addEdge(size_t from, size_t to, double capacity, double reverseCapacity = 0.) {
+        _graph[from].push_back({to, capacity, _graph[to].size()});
+        _graph[to].push_back({from, reverseCapacity, _graph[from].size() - 1});
+    }
+
+    void run(size_t source, size_t sink) {
+        while (levels(source, sink)) {
+            std::fill(_next.begin(), _next.end(), 0);
+            while (push(source, sink, infinity) > epsilon) {
+            }
+        }
+    }
+
+    // the nodes reachable from the source in the residual graph once the flow is maximal
+    std::vector<bool> sourceSide(size_t source) const {
+        std::vector<bool> visited(_graph.size(), false);
+        std::queue<size_t> queue;
+        queue.push(source);
+        visited[source] = true;
+        while (!queue.empty()) {
+            auto node = queue.front();
+            queue.pop();
+            for (auto&& edge : _graph[node]) {
+                if (edge.capacity > epsilon && !visited[edge.to]) {
+                    visited[edge.to] = true;
+                    queue.push(edge.to);
+                }
+            }
+        }
+        return visited;
+    }
+
+private:
+    struct Edge {
+        size_t to;
+        double capacity;
+        size_t reverse;
+    };
+
+    bool levels(size_t source, size_t sink) {
+        std::fill(_level.begin(), _level.end(), -1);
+        std::queue<size_t> queue;
+        queue.push(source);
+        _level[source] = 0;
+        while (!queue.empty()) {
+            auto node = queue.front();
+            queue.pop();
+            for (auto&& edge : _graph[node]) {
+                if (edge.capacity > epsilon && _level[edge.to] < 0) {
+                    _level[edge.to] = _level[node] + 1;
+                    queue.push(edge.to);
+                }
+            }
+        }
+        return _level[sink] >= 0;
+    }
+
+    double push(size_t node, size_t sink, double flow) {
+        if (node == sink)
+            return flow;
+        for (auto& i = _next[node]; i < _graph[node].size(); ++i) {
+            auto& edge = _graph[node][i];
+            if (edge.capacity <= epsilon || _level[edge.to] != _level[node] + 1)
+                continue;
+            auto pushed = push(edge.to, sink, std::min(flow, edge.capacity));
+            if (pushed > epsilon) {
+                edge.capacity -= pushed;
+                _graph[edge.to][edge.reverse].capacity += pushed;
+                return pushed;
+            }
+        }
+        return 0.;
+    }
+
+    std::vector<std::vector<Edge>> _graph;
+    std::vector<int> _level;
+    std::vector<size_t> _next;
+};
+
+struct Link {
+    size_t from;
+    size_t to;
+    double cost;
+};
+
+double totalCost(const std::vector<std::vector<double>>& costs,
+                 const std::vector<Link>& links,
+                 const std::vector<size_t>& labels) {
+    double cost = 0.;
+    for (size_t i = 0; i < labels.size(); ++i) {
+        cost += costs[i][labels[i]];
+    }
+    for (auto&& link : links) {
+        if (labels[link.from] != labels[link.to])
+            cost += link.cost;
+    }
+    return cost;
+}
+
+// moves any subset of the nodes to the alpha device if it decreases the cost: the nodes on the source side of the
+// minimal cut take alpha, the ones on the sink side keep their device
+std::vector<size_t> expand(const std::vector<std::vector<double>>& costs,
+                           const std::vector<Link>& links,
+                           const std::vector<size_t>& labels,
+                           size_t alpha) {
+    const auto size = labels.size();
+    size_t auxiliary = size + 2;
+    for (auto&& link : links) {
+        if (labels[link.from] != labels[link.to] && labels[link.from] != alpha && labels[link.to] != alpha)
+            ++auxiliary;
+    }
+    const size_t source = size;
+    const size_t sink = size + 1;
+    MaxFlow flow(auxiliary);
+    for (size_t i = 0; i < size; ++i) {
+        // the link from the source is cut if the node keeps its device, the one to the sink if it takes alpha
+        flow.addEdge(source, i, labels[i] == alpha ? infinity : costs[i][labels[i]]);
+        flow.addEdge(i, sink, costs[i][alpha]);
+    }
+    auxiliary = size + 2;
+    for (auto&& link : links) {
+        const auto from = labels[link.from];
+        const auto to = labels[link.to];
+        if (from == alpha && to == alpha) {
+            continue;
+        } else if (from == to) {
+            // the transfer is needed if only one of the nodes takes alpha
+            flow.addEdge(link.from, link.to, link.cost, link.cost);
+        } else if (from == alpha) {
+            flow.addEdge(source, link.to, link.cost);
+        } else if (to == alpha) {
+            flow.addEdge(source, link.from, link.cost);
+        } else {
+            // the transfer is avoided only if both nodes take alpha
+            flow.addEdge(source, auxiliary, link.cost);
+            flow.addEdge(auxiliary, link.from, infinity);
+            flow.addEdge(auxiliary, link.to, infinity);
+            ++auxiliary;
+        }
+    }
+    flow.run(source, sink);
+    const auto sourceSide = flow.sourceSide(source);
+    auto expanded = labels;
+    for (size_t i = 0; i < size; ++i) {
+        if (sourceSide[i])
+            expanded[i] = alpha;
+    }
+    return expanded;
+}
+
+}  // namespace
+
+std::map<std::string, std::string> HeteroPlugin::partitionByCost(
+    const std::shared_ptr<const ov::Model>& model,
+    const std::vector<std::string>& devices,
+    const std::map<std::string, InferenceEngine::QueryNetworkResult>& queryResults,
+    const std::map<std::string, double>& deviceGops) {
+    auto isSupported = [&](const std::string& name, const std::string& device) {
+        auto itResult = queryResults.find(device);
+        return itResult != queryResults.end() && itResult->second.supportedLayersMap.count(name) != 0;
+    };
+    auto firstSupporting = [&](const std::string& name) {
+        return std::find_if(devices.begin(), devices.end(), [&](const std::string& device) {
+            return isSupported(name, device);
+        });
+    };
+    auto isAuxiliary = [](const ov::Node* node) {
+        return ov::op::util::is_constant(node) || ov::op::util::is_parameter(node) || ov::op::util::is_output(node);
+    };
+
+    std::vector<const ov::Node*> nodes;
+    std::unordered_map<const ov::Node*, size_t> indices;
+    std::vector<std::vector<double>> costs;
+    std::vector<size_t> labels;
+    for (auto&& node : model->get_ordered_ops()) {
+        const auto& name = node->get_friendly_name();
+        auto itDevice = firstSupporting(name);
+        if (isAuxiliary(node.get()) || itDevice == devices.end())
+            continue;
+        const auto operations = operationsCount(node.get());
+        std::vector<double> nodeCosts;
+        for (auto&& device : devices) {
+            auto itGops = deviceGops.find(device);
+            const auto gops = itGops != deviceGops.end() && itGops->second > 0. ? itGops->second : 1.;
+            // 1 GOPS is 1e3 operations per us
+            nodeCosts.push_back(isSupported(name, device) ? operations / (gops * 1e3) : infinity);
+        }
+        indices.emplace(node.get(), nodes.size());
+        nodes.push_back(node.get());
+        costs.push_back(std::move(nodeCosts));
+        // the expansions of the other devices start from the host, so the first one gives the exact minimum for two
+        labels.push_back(isSupported(name, devices.back()) ? devices.size() - 1
+                                                           : static_cast<size_t>(itDevice - devices.begin()));
+    }
+
+    std::vector<Link> links;
+    for (auto&& node : nodes) {
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            auto itSource = indices.find(source.get_node());
+            if (itSource == indices.end())
+                continue;
+            const auto bytes = elementsCount(source.get_partial_shape()) * source.get_element_type().size();
+            links.push_back({itSource->second, indices.at(node), transferLatency + bytes / transferBandwidth});
+        }
+    }
+
+    auto cost = totalCost(costs, links, labels);
+    for (bool improved = true; improved;) {
+        improved = false;
+        for (size_t alpha = 0; alpha < devices.size(); ++alpha) {
+            auto expanded = expand(costs, links, labels, alpha);
+            auto expandedCost = totalCost(costs, links, expanded);
+            if (expandedCost < cost - epsilon) {
+                labels = std::move(expanded);
+                cost = expandedCost;
+                improved = true;
+            }
+        }
+    }
+
+    std::map<std::string, std::string> affinities;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        affinities.emplace(nodes[i]->get_friendly_name(), devices[labels[i]]);
+    }
+    // the constants and the parameters go with their first consumer, the results with their producer as the
+    // executable network assigns the ones the devices don't report
+    for (auto&& node : model->get_ordered_ops()) {
+        if (!isAuxiliary(node.get()))
+            continue;
+        const ov::Node* neighbour = nullptr;
+        if (ov::op::util::is_output(node.get())) {
+            neighbour = node->get_input_node_ptr(0);
+        } else if (node->get_output_size() && !node->output(0).get_target_inputs().empty()) {
+            neighbour = node->output(0).get_target_inputs().begin()->get_node();
+        }
+        auto itNeighbour = neighbour ? indices.find(neighbour) : indices.end();
+        if (itNeighbour != indices.end()) {
+            affinities.emplace(node->get_friendly_name(), devices[labels[itNeighbour->second]]);
+        } else {
+            auto itDevice = firstSupporting(node->get_friendly_name());
+            if (itDevice != devices.end())
+                affinities.emplace(node->get_friendly_name(), *itDevice);
+        }
+    }
+    return affinities;
+}
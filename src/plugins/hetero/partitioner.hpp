@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ie_common.h"
+#include "openvino/core/model.hpp"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Assigns the operations to the devices minimizing the estimated latency of the model: the sum of the operation
+ *        costs on their devices and of the transfers of the tensors between the subgraphs. The cost of an operation is
+ *        the estimate of its operations count divided by the GOPS of the device, the cost of a transfer is a fixed
+ *        latency plus the tensor size divided by the bandwidth, so a small island of operations costs more to transfer
+ *        than to compute on the device of its neighbours.
+ *        The assignment starts from the host device, the last one in the priority order, for the operations it
+ *        supports and is improved by the min-cut alpha-expansion moves over the devices until the cost does not
+ *        decrease, for two devices it's the exact minimum
+ * @param model The model to partition
+ * @param devices The devices in the priority order
+ * @param queryResults The operations each device supports
+ * @param deviceGops The operations per second (1e9) of each device
+ * @return The devices of the operations which are supported by any device
+ */
+std::map<std::string, std::string> partitionByCost(
+    const std::shared_ptr<const ov::Model>& model,
+    const std::vector<std::string>& devices,
+    const std::map<std::string, InferenceEngine::QueryNetworkResult>& queryResults,
+    const std::map<std::string, double>& deviceGops);
+
+}  // namespace HeteroPlugin
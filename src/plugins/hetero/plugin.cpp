@@ -12,8 +12,10 @@
 #include <utility>
 #include <fstream>
 #include <unordered_set>
+#include <thread>
 #include "ie_plugin_config.hpp"
 #include "executable_network.hpp"
+#include "partitioner.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <openvino/runtime/properties.hpp>
 // clang-format on
@@ -42,7 +44,9 @@ const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
-                                                                  CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
+                                                                  CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_PIPELINED_EXECUTION),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_COST_BASED_AFFINITY)};
 
     return supported_configKeys;
 }
@@ -149,9 +153,18 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
-    for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+    auto costBased = tconfig.find(CONFIG_KEY_INTERNAL(HETERO_COST_BASED_AFFINITY));
+    if (costBased != tconfig.end() && costBased->second == YES) {
+        std::map<std::string, double> deviceGops;
+        for (auto&& deviceName : fallbackDevices) {
+            deviceGops[deviceName] = DeviceGops(deviceName);
+        }
+        qr.supportedLayersMap = partitionByCost(function, fallbackDevices, queryResults, deviceGops);
+    } else {
+        for (auto&& deviceName : fallbackDevices) {
+            for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+                qr.supportedLayersMap.emplace(layerQueryResult);
+            }
         }
     }
 
@@ -210,12 +223,40 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
     return resArch;
 }
 
+double Engine::DeviceGops(const std::string& device) const {
+    InferenceEngine::DeviceIDParser parser(device);
+    auto supportedMetricKeys =
+        GetCore()->GetMetric(parser.getDeviceName(), METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    if (std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), METRIC_KEY(DEVICE_GOPS)) !=
+        supportedMetricKeys.end()) {
+        auto gops = GetCore()->GetMetric(device, METRIC_KEY(DEVICE_GOPS));
+        if (gops.is<std::map<Precision, float>>()) {
+            auto gopsPerPrecision = gops.as<std::map<Precision, float>>();
+            auto it = gopsPerPrecision.find(Precision::FP32);
+            if (it != gopsPerPrecision.end() && it->second > 0.f)
+                return it->second;
+        } else if (gops.is<std::map<ov::element::Type, float>>()) {
+            auto gopsPerType = gops.as<std::map<ov::element::Type, float>>();
+            auto it = gopsPerType.find(ov::element::f32);
+            if (it != gopsPerType.end() && it->second > 0.f)
+                return it->second;
+        }
+    }
+    // the FP32 multiply-adds of 8-wide vectors at 2 GHz per core for the devices which don't report their GOPS
+    return 32. * std::max(std::thread::hardware_concurrency(), 1u);
+}
+
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
     if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
         auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == CONFIG_KEY_INTERNAL(HETERO_PIPELINED_EXECUTION) ||
+               name == CONFIG_KEY_INTERNAL(HETERO_COST_BASED_AFFINITY)) {
+        auto it = _config.find(name);
+        bool enabled = it != _config.end() && it->second == YES;
+        return {enabled};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -49,5 +49,6 @@ public:
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string& deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
+    double DeviceGops(const std::string& device) const;
 };
 }  // namespace HeteroPlugin
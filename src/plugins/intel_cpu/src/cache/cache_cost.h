@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include <mkldnn.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Reports the bytes held by a cached value: the value object itself by default
+ */
+template<typename Value>
+size_t cacheByteSize(const Value&) noexcept {
+    return sizeof(Value);
+}
+
+namespace detail {
+inline size_t primitiveExtraBytes(const mkldnn::primitive& primitive, std::true_type) noexcept {
+    int64_t consumption = 0;
+    if (!primitive.get() ||
+        dnnl_primitive_desc_query(primitive.get_primitive_desc(), dnnl_query_memory_consumption_s64, 0, &consumption)
+            != dnnl_success)
+        return 0;
+    return consumption > 0 ? static_cast<size_t>(consumption) : 0;
+}
+
+template<typename T>
+size_t primitiveExtraBytes(const T&, std::false_type) noexcept {
+    return 0;
+}
+}  // namespace detail
+
+/**
+ * @brief Reports the bytes held by a shared value: the pointer, the pointee object and, for the oneDNN primitives, the
+ *        extra memory the primitive owns (e.g. the scratchpad). The JIT code can't be queried, so it isn't counted
+ */
+template<typename T>
+size_t cacheByteSize(const std::shared_ptr<T>& value) noexcept {
+    if (!value)
+        return sizeof(value);
+    return sizeof(value) + sizeof(T) +
+           detail::primitiveExtraBytes(*value, std::is_base_of<mkldnn::primitive, T>());
+}
+
+/**
+ * @brief The cost policy of the runtime parameters caches. Each record costs 1 by default, so the capacity is the
+ *        maximum number of records. With the cost in bytes each record costs the bytes its value holds (see
+ *        cacheByteSize), so the capacity is the memory budget of the cache.
+ */
+template<typename Value>
+struct RuntimeCacheCost {
+    explicit RuntimeCacheCost(bool inBytes = false) : inBytes(inBytes) {}
+
+    size_t operator()(const Value& value) const noexcept {
+        return inBytes ? cacheByteSize(value) : 1;
+    }
+
+    bool inBytes;
+};
+
+}  // namespace MKLDNNPlugin
@@ -5,7 +5,10 @@
 #pragma once
 
 #include <memory>
+#include <algorithm>
 #include <functional>
+#include <mutex>
+#include <vector>
 #include "lru_cache.h"
 
 namespace MKLDNNPlugin {
@@ -25,9 +28,12 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
  * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ *         interface, the cost_type of its records and must have constructor of type ImplType(size_t, cost_type).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The records are distributed over a number of shards by the key hash. Each shard has its own lock, so the entry may be
+ *       safely accessed from several threads, while lookups of different keys rarely contend. The builder is called outside
+ *       of the lock, thus concurrent misses of the same key may build the value more than once, the last result is stored.
  */
 
 template<typename KeyType,
@@ -38,7 +44,22 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    /**
+     * @param capacity is the maximum accumulated cost (see CacheCost) of the records for the whole entry, it's evenly split
+     *        between the shards
+     * @param shards is the number of independently locked parts of the storage
+     * @param costFunc reports the cost of the records
+     */
+    explicit CacheEntry(size_t capacity, size_t shards = 1,
+                        const typename ImplType::cost_type& costFunc = typename ImplType::cost_type())
+        : _capacity(capacity) {
+        shards = std::max<size_t>(1, std::min(shards, capacity));
+        const size_t shardCapacity = capacity ? (capacity + shards - 1) / shards : 0;
+        _shards.reserve(shards);
+        for (size_t i = 0; i < shards; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity, costFunc));
+        }
+    }
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -49,23 +70,49 @@ public:
      */
 
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
-        if (0 == _impl.getCapacity()) {
+        if (0 == _capacity) {
             // fast track
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
+        auto& shard = getShard(key);
         auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
+        ValType retVal;
+        {
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            retVal = shard._impl.get(key);
+        }
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
             retVal = builder(key);
-            if (retVal != retEmpty)
-                _impl.put(key, retVal);
+            if (retVal != retEmpty) {
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                shard._impl.put(key, retVal);
+            }
         }
         return {retVal, retStatus};
     }
 
-public:
-    ImplType _impl;
+    /**
+     * @brief Returns the total capacity of the entry
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct Shard {
+        Shard(size_t capacity, const typename ImplType::cost_type& costFunc) : _impl(capacity, costFunc) {}
+        std::mutex _mutex;
+        ImplType _impl;
+    };
+
+    Shard& getShard(const KeyType& key) {
+        return _shards.size() == 1 ? *_shards.front() : *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+    }
+
+private:
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
 };
 }// namespace MKLDNNPlugin
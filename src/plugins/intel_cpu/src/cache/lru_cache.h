@@ -4,29 +4,56 @@
 
 #pragma once
 
-#include <list>
+#include <cstddef>
 #include <unordered_map>
+#include <utility>
 
 /**
  * @brief This is yet another implementation of a preemptive cache with LRU eviction policy.
  * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ * @tparam CostType is a callable type that reports the cost of a cached value. The capacity limits the accumulated cost of
+ *         all the cached records, so e.g. a cost in bytes turns the capacity into a memory budget. By default CacheCost is used.
  *
- * @attention This cache implementation IS NOT THREAD SAFE!
+ * @note The LRU order is an intrusive list threaded through the hash map nodes, so neither a hit nor a touch allocates and
+ *       inserting a new record performs a single allocation.
+ *
+ * @attention This cache implementation IS NOT THREAD SAFE! Use CacheEntry to access the cache from several threads.
  */
 
 namespace MKLDNNPlugin {
 
-template<typename Key, typename Value>
+/**
+ * @brief Reports the cost of a cached value. Each record costs 1 unless the trait is specialized for the value type,
+ *        so by default the cache capacity is the maximum number of records.
+ *        See RuntimeCacheCost for the policy reporting the size of the values in bytes.
+ */
+template<typename Value>
+struct CacheCost {
+    size_t operator()(const Value&) const noexcept {
+        return 1;
+    }
+};
+
+template<typename Key, typename Value, typename CostType = CacheCost<Value>>
 class LruCache {
 public:
     using value_type = std::pair<Key, Value>;
+    using cost_type = CostType;
 
 public:
-    explicit LruCache(size_t capacity) : _capacity(capacity) {}
+    explicit LruCache(size_t capacity, CostType costFunc = CostType())
+        : _costFunc(std::move(costFunc)), _capacity(capacity) {
+        _head.prev = &_head;
+        _head.next = &_head;
+    }
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
 
     /**
-     * @brief Puts the value associated with the key into the cache.
+     * @brief Puts the value associated with the key into the cache. A value costing more than the whole capacity is
+     *        rejected and the cache stays unchanged.
      * @param key
      * @param value
      */
@@ -35,16 +62,28 @@ public:
         if (0 == _capacity) {
             return;
         }
+        const size_t cost = _costFunc(val);
+        if (cost > _capacity) {
+            // the record can't be stored anyway, so it mustn't evict the others
+            return;
+        }
         auto mapItr = _cacheMapper.find(key);
         if (mapItr != _cacheMapper.end()) {
-            touch(mapItr->second);
-            mapItr->second->second = val;
+            auto& node = mapItr->second;
+            touch(&node);
+            _totalCost = _totalCost - node.cost + cost;
+            node.value = val;
+            node.cost = cost;
         } else {
-            if (_cacheMapper.size() == _capacity) {
-                evict(1);
-            }
-            auto itr = _lruList.insert(_lruList.begin(), {key, val});
-            _cacheMapper.insert({key, itr});
+            auto result = _cacheMapper.emplace(key, Node{val, cost});
+            auto& node = result.first->second;
+            node.key = &result.first->first;
+            link(&node);
+            _totalCost += cost;
+        }
+        // the most recently used record is evicted last and its own cost fits the capacity, so it's always kept
+        while (_totalCost > _capacity) {
+            evict(1);
         }
     }
 
@@ -60,8 +99,8 @@ public:
             return Value();
         }
 
-        touch(itr->second);
-        return _lruList.front().second;
+        touch(&itr->second);
+        return itr->second.value;
     }
 
     /**
@@ -70,9 +109,11 @@ public:
      */
 
     void evict(size_t n) {
-        for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
-            _cacheMapper.erase(_lruList.back().first);
-            _lruList.pop_back();
+        for (size_t i = 0; i < n && _head.prev != &_head; ++i) {
+            Node* last = _head.prev;
+            unlink(last);
+            _totalCost -= last->cost;
+            _cacheMapper.erase(_cacheMapper.find(*last->key));
         }
     }
 
@@ -80,9 +121,23 @@ public:
      * @brief Returns the current capacity value
      * @return the current capacity value
      */
-     size_t getCapacity() const noexcept {
-         return _capacity;
-     }
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the accumulated cost of all the cached records
+     */
+    size_t getCost() const noexcept {
+        return _totalCost;
+    }
+
+    /**
+     * @brief Returns the number of the cached records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
 
 private:
     struct key_hasher {
@@ -91,16 +146,42 @@ private:
         }
     };
 
-    using lru_list_type = std::list<value_type>;
-    using cache_map_value_type = typename lru_list_type::iterator;
+    struct Node {
+        Node() = default;
+        Node(const Value& val, size_t valCost) : value(val), cost(valCost) {}
 
-    void touch(typename lru_list_type::iterator itr) {
-        _lruList.splice(_lruList.begin(), _lruList, itr);
+        Value value{};
+        size_t cost = 0;
+        const Key* key = nullptr;
+        Node* prev = nullptr;
+        Node* next = nullptr;
+    };
+
+    void link(Node* node) {
+        node->prev = &_head;
+        node->next = _head.next;
+        _head.next->prev = node;
+        _head.next = node;
+    }
+
+    void unlink(Node* node) {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    void touch(Node* node) {
+        if (_head.next != node) {
+            unlink(node);
+            link(node);
+        }
     }
 
-    lru_list_type _lruList;
-    std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
+    // references to the unordered_map elements stay valid on rehashing, so the list may point directly to them
+    std::unordered_map<Key, Node, key_hasher> _cacheMapper;
+    Node _head;
+    CostType _costFunc;
+    size_t _totalCost = 0;
     size_t _capacity;
 };
 
-} // namespace MKLDNNPlugin
\ No newline at end of file
+} // namespace MKLDNNPlugin
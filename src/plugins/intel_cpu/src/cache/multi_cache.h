@@ -7,20 +7,24 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "cache_cost.h"
 
 namespace MKLDNNPlugin {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache is thread safe, so a single instance may be shared between several graphs (streams or compiled models).
+ *       The number of shards defines how many independently locked parts each entry is split into and should be increased
+ *       for the caches which are accessed concurrently.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, LruCache<KeyType, ValueType, RuntimeCacheCost<ValueType>>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -28,9 +32,20 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param shards is the number of independently locked parts of each entry
+    * @param costInBytes the capacity is the memory budget in bytes of each entry rather than the records limit,
+    *        each record costs the bytes held by its value (see RuntimeCacheCost)
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t shards = 1, bool costInBytes = false)
+        : _capacity(capacity), _shards(shards), _costInBytes(costInBytes) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _shards(other._shards),
+                                          _costInBytes(other._costInBytes),
+                                          _hits(other._hits.load()), _misses(other._misses.load()) {
+        std::lock_guard<std::mutex> lock(other._mutex);
+        _storage = other._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,7 +60,34 @@ public:
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
         auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        auto result = entry->getOrCreate(key, std::move(builder));
+        (result.second == CacheEntryBase::LookUpStatus::Hit ? _hits : _misses).fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    /**
+    * @brief Returns the capacity of each entry, the records limit or the bytes budget if isCostInBytes()
+    */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    bool isCostInBytes() const noexcept {
+        return _costInBytes;
+    }
+
+    /**
+    * @brief Returns the number of the lookups which found the value in the cache
+    */
+    uint64_t getHits() const noexcept {
+        return _hits.load(std::memory_order_relaxed);
+    }
+
+    /**
+    * @brief Returns the number of the lookups which built the value, i.e. the number of the created (recompiled) objects
+    */
+    uint64_t getMisses() const noexcept {
+        return _misses.load(std::memory_order_relaxed);
     }
 
 private:
@@ -57,6 +99,11 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shards;
+    bool _costInBytes;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -70,9 +117,10 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _shards, RuntimeCacheCost<ValueType>(_costInBytes))});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shapes_profile.h"
+
+#include <ie_system_conf.h>
+#include <file_utils.h>
+#include <mkldnn_weights_cache.hpp>
+
+#include <fstream>
+#include <sstream>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::string getIsaTag() {
+    using namespace InferenceEngine;
+    if (with_cpu_x86_bfloat16())
+        return "avx512_core_bf16";
+    if (with_cpu_x86_avx512_core())
+        return "avx512_core";
+    if (with_cpu_x86_avx2())
+        return "avx2";
+    if (with_cpu_x86_sse42())
+        return "sse42";
+    return "any";
+}
+
+std::string getModelSignature(const std::shared_ptr<const ov::Model>& model) {
+    std::stringstream ss;
+    ss << model->get_friendly_name() << ';';
+    for (const auto& param : model->get_parameters()) {
+        ss << param->get_friendly_name() << ':' << param->get_element_type() << param->get_partial_shape() << ';';
+    }
+    for (const auto& op : model->get_ordered_ops()) {
+        ss << op->get_type_info().name << ',';
+    }
+    return ss.str();
+}
+
+}  // namespace
+
+ShapesProfile::ShapesProfile(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model) {
+    const auto signature = getModelSignature(model);
+    const auto hash = SimpleDataHash().hash(reinterpret_cast<const unsigned char*>(signature.data()), signature.size());
+    std::stringstream name;
+    name << "cpu_shapes_" << getIsaTag() << '_' << std::hex << hash << ".txt";
+    _filePath = FileUtils::makePath(cacheDir, name.str());
+    load();
+}
+
+// the file consists of the records one per line, each record is:
+// <inputs number> [<name length> <name> <rank> <dim 0> ... <dim rank-1>] ...
+void ShapesProfile::load() {
+    std::ifstream file(_filePath);
+    if (!file.is_open())
+        return;
+
+    std::string line;
+    while (_loaded.size() < maxRecords && std::getline(file, line)) {
+        std::istringstream ss(line);
+        size_t inputsNum = 0;
+        if (!(ss >> inputsNum))
+            continue;
+        InputShapes record;
+        bool valid = true;
+        for (size_t i = 0; i < inputsNum && valid; i++) {
+            size_t nameLength = 0, rank = 0;
+            valid = static_cast<bool>(ss >> nameLength) && ss.get() == ' ';
+            std::string inputName(nameLength, '\0');
+            valid = valid && ss.read(&inputName[0], nameLength) && (ss >> rank);
+            InferenceEngine::SizeVector dims(rank);
+            for (size_t d = 0; d < rank && valid; d++)
+                valid = static_cast<bool>(ss >> dims[d]);
+            record[inputName] = dims;
+        }
+        if (valid && _known.insert(record).second)
+            _loaded.push_back(record);
+    }
+}
+
+void ShapesProfile::record(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_known.size() >= maxRecords || !_known.insert(shapes).second)
+        return;
+
+    std::stringstream ss;
+    ss << shapes.size();
+    for (const auto& input : shapes) {
+        ss << ' ' << input.first.size() << ' ' << input.first << ' ' << input.second.size();
+        for (const auto dim : input.second)
+            ss << ' ' << dim;
+    }
+    ss << '\n';
+
+    // the profile is just an optimization hint, so failing to write it is not an error
+    std::ofstream file(_filePath, std::ios::app);
+    if (file.is_open())
+        file << ss.str();
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <openvino/core/model.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Persistent record of the input shapes a dynamic model was executed with.
+ *
+ * oneDNN doesn't provide a way to serialize the generated CPU code, so the JIT kernels and primitives can't be stored
+ * in the cache directory as is. Instead the input shapes seen at runtime are stored there, so the next time the same model
+ * is compiled on a machine with the same ISA these shapes are used to warm up the runtime caches before the first real
+ * request arrives.
+ *
+ * The profile file name is derived from the CPU ISA and the model signature (inputs and operations), so incompatible
+ * profiles are never picked up.
+ *
+ * Is a thread safe
+ */
+class ShapesProfile {
+public:
+    using Ptr = std::shared_ptr<ShapesProfile>;
+    using InputShapes = std::map<std::string, InferenceEngine::SizeVector>;
+
+    ShapesProfile(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model);
+
+    /**
+     * @brief Returns the records which were loaded from the cache directory
+     */
+    const std::vector<InputShapes>& getLoadedRecords() const {
+        return _loaded;
+    }
+
+    /**
+     * @brief Adds the shapes to the profile and appends them to the profile file if they are new
+     * @param shapes input names to input dims map
+     */
+    void record(const InputShapes& shapes);
+
+private:
+    void load();
+
+    static constexpr size_t maxRecords = 64;
+
+    std::string _filePath;
+    std::vector<InputShapes> _loaded;
+    std::set<InputShapes> _known;
+    std::mutex _mutex;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,11 +7,14 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <cctype>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include "utils/cpu_isa.h"
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "openvino/core/type/element_type_traits.hpp"
@@ -21,6 +24,63 @@ namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+namespace {
+// "name:PRECISION;name:PRECISION", the name may contain ':' itself, so the precision follows the last one
+std::map<std::string, Precision> parsePrecisionMap(const std::string& str) {
+    std::map<std::string, Precision> precisions;
+    std::stringstream ss(str);
+    std::string entry;
+    while (std::getline(ss, entry, ';')) {
+        if (entry.empty())
+            continue;
+        const auto separator = entry.rfind(':');
+        if (separator == std::string::npos || separator == 0)
+            IE_THROW() << "Expected the entries as name:precision, got '" << entry << "'";
+        const auto precision = entry.substr(separator + 1);
+        if (precision == "BF16")
+            precisions[entry.substr(0, separator)] = Precision::BF16;
+        else if (precision == "FP32")
+            precisions[entry.substr(0, separator)] = Precision::FP32;
+        else
+            IE_THROW() << "Expected only BF16/FP32 precisions, got '" << precision << "'";
+    }
+    return precisions;
+}
+
+// e.g. "data[1,3,224,224],info[1,3];data[1,3,320,320],info[1,3]"
+std::vector<std::map<std::string, SizeVector>> parseShapeSpecializations(const std::string& str) {
+    std::vector<std::map<std::string, SizeVector>> specializations;
+    std::stringstream ss(str);
+    std::string entry;
+    while (std::getline(ss, entry, ';')) {
+        if (entry.empty())
+            continue;
+        std::map<std::string, SizeVector> shapes;
+        size_t pos = 0;
+        while (pos < entry.size()) {
+            const auto open = entry.find('[', pos);
+            const auto close = entry.find(']', pos);
+            if (open == std::string::npos || close == std::string::npos || close < open || open == pos)
+                IE_THROW() << "Expected the shapes as name[d0,d1,...], got '" << entry << "'";
+            SizeVector dims;
+            std::stringstream dimsStream(entry.substr(open + 1, close - open - 1));
+            std::string dim;
+            while (std::getline(dimsStream, dim, ',')) {
+                if (dim.empty() || !std::all_of(dim.begin(), dim.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+                    IE_THROW() << "Expected only non negative integer dimensions, got '" << dim << "'";
+                dims.push_back(std::stoul(dim));
+            }
+            shapes[entry.substr(pos, open - pos)] = dims;
+            pos = close + 1;
+            if (pos < entry.size() && entry[pos++] != ',')
+                IE_THROW() << "Expected the shapes of a set separated by ',', got '" << entry << "'";
+        }
+        specializations.push_back(shapes);
+    }
+    return specializations;
+}
+}  // namespace
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -146,6 +206,187 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED == key) {
+            if (val == PluginConfigParams::YES) rtCacheShared = true;
+            else if (val == PluginConfigParams::NO) rtCacheShared = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED_BYTES == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED_BYTES
+                           << ". Expected only integer numbers";
+            }
+            // the negative values mean the records limit as zero does
+            rtCacheSharedBytes = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY == key) {
+            if (val == PluginConfigInternalParams::REPLICATE)
+                weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+            else if (val == PluginConfigInternalParams::INTERLEAVE)
+                weightsNumaPolicy = WeightsNumaPolicy::Interleave;
+            else if (val == PluginConfigInternalParams::SINGLE_NODE)
+                weightsNumaPolicy = WeightsNumaPolicy::SingleNode;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY
+                           << ". Expected only " << PluginConfigInternalParams::REPLICATE << "/"
+                           << PluginConfigInternalParams::INTERLEAVE << "/" << PluginConfigInternalParams::SINGLE_NODE;
+        } else if (PluginConfigInternalParams::KEY_CPU_PIPELINED_STREAMS == key) {
+            if (val == PluginConfigParams::YES) pipelinedStreams = true;
+            else if (val == PluginConfigParams::NO) pipelinedStreams = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PIPELINED_STREAMS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_BATCH_SPLIT_MIN_SIZE == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_BATCH_SPLIT_MIN_SIZE
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_BATCH_SPLIT_MIN_SIZE
+                           << ". Expected only non negative numbers";
+            batchSplitMinSize = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS_POOL == key) {
+            if (val == PluginConfigParams::YES) sharedStreamsPool = true;
+            else if (val == PluginConfigParams::NO) sharedStreamsPool = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS_POOL
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS == key) {
+            if (val == PluginConfigParams::YES) sharedWeights = true;
+            else if (val == PluginConfigParams::NO) sharedWeights = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_EXECUTION_TRACE_CAPACITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EXECUTION_TRACE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value disables the tracing as zero does
+            executionTraceCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_STREAM_GRAPHS_IDLE_TIMEOUT == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STREAM_GRAPHS_IDLE_TIMEOUT
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STREAM_GRAPHS_IDLE_TIMEOUT
+                           << ". Expected only non negative numbers";
+            streamGraphsIdleTimeout = val_i;
+        } else if (PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_RATE == key) {
+            float val_f = -1.0f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_RATE
+                           << ". Expected only floating point numbers";
+            }
+            if (!(val_f >= 0.0f && val_f <= 1.0f))
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_RATE
+                           << ". Expected only values from 0 to 1";
+            fcSparseWeightsRate = val_f;
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION == key) {
+            if (val == PluginConfigParams::NO)
+                fcWeightsCompression = WeightsCompression::None;
+            else if (val == PluginConfigInternalParams::INT8)
+                fcWeightsCompression = WeightsCompression::Int8;
+            else if (val == PluginConfigInternalParams::INT4)
+                fcWeightsCompression = WeightsCompression::Int4;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION
+                           << ". Expected only " << PluginConfigParams::NO << "/" << PluginConfigInternalParams::INT8 << "/"
+                           << PluginConfigInternalParams::INT4;
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION_GROUP_SIZE == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION_GROUP_SIZE
+                           << ". Expected only integer numbers";
+            }
+            if (val_i <= 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION_GROUP_SIZE
+                           << ". Expected only positive numbers";
+            fcWeightsCompressionGroupSize = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_TENSOR_PARALLEL == key) {
+            if (val == PluginConfigParams::YES) fcTensorParallel = true;
+            else if (val == PluginConfigParams::NO) fcTensorParallel = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TENSOR_PARALLEL
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION == key) {
+            if (val == PluginConfigParams::YES) attentionFusion = true;
+            else if (val == PluginConfigParams::NO) attentionFusion = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPE_BUCKETS == key) {
+            try {
+                shapeBuckets = ShapeBuckets(val);
+            } catch (const InferenceEngine::Exception& ex) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPE_BUCKETS
+                           << ". " << ex.what();
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPE_SPECIALIZATIONS == key) {
+            try {
+                shapeSpecializations = parseShapeSpecializations(val);
+            } catch (const InferenceEngine::Exception& ex) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPE_SPECIALIZATIONS
+                           << ". " << ex.what();
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_BF16_AUTO_MIXED_PRECISION == key) {
+            if (val == PluginConfigParams::YES) bf16AutoMixedPrecision = true;
+            else if (val == PluginConfigParams::NO) bf16AutoMixedPrecision = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_BF16_AUTO_MIXED_PRECISION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_BF16_PRECISION_MAP == key) {
+            try {
+                bf16PrecisionMap = parsePrecisionMap(val);
+            } catch (const InferenceEngine::Exception& ex) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_BF16_PRECISION_MAP
+                           << ". " << ex.what();
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_MAX_ISA == key) {
+            if (!isa::isValidName(val))
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MAX_ISA
+                           << ". Expected only oneDNN ISA names, e.g. AVX512_CORE_AMX, AVX512_CORE_BF16, AVX2 or ALL";
+            // the limit is applied to the whole process, so it can't differ between the models
+            isa::setMaxCpuIsa(val);
+            maxIsa = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::NO)
+                hugePages = hugepages::Mode::None;
+            else if (val == PluginConfigInternalParams::TRANSPARENT)
+                hugePages = hugepages::Mode::Transparent;
+            else if (val == PluginConfigInternalParams::EXPLICIT)
+                hugePages = hugepages::Mode::Explicit;
+            else if (val == PluginConfigInternalParams::EXPLICIT_1G)
+                hugePages = hugepages::Mode::Explicit1G;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only " << PluginConfigParams::NO << "/" << PluginConfigInternalParams::TRANSPARENT << "/"
+                           << PluginConfigInternalParams::EXPLICIT << "/" << PluginConfigInternalParams::EXPLICIT_1G;
+            // the allocator is shared by the whole process, so the mode applies to the memory of all the models
+            hugepages::setMode(hugePages);
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -6,10 +6,15 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
+#include <ie_precision.hpp>
+#include <ie_common.h>
 #include "utils/debug_capabilities.h"
+#include "utils/shape_buckets.h"
+#include "utils/huge_pages.h"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -21,12 +26,49 @@ struct Config {
         On,
     };
 
+    enum class WeightsNumaPolicy {
+        Replicate,
+        Interleave,
+        SingleNode,
+    };
+
+    enum class WeightsCompression {
+        None,
+        Int8,
+        Int4,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    bool rtCacheShared = false;
+    size_t rtCacheSharedBytes = 0ul;
+    ShapeBuckets shapeBuckets;
+    // the input shapes sets the static networks are compiled for besides the dynamic one, by the input names
+    std::vector<std::map<std::string, InferenceEngine::SizeVector>> shapeSpecializations;
+    WeightsNumaPolicy weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+    bool pipelinedStreams = false;
+    // 0 means the batch of a request isn't split between the streams
+    size_t batchSplitMinSize = 0;
+    bool sharedStreamsPool = false;
+    bool sharedWeights = false;
+    // milliseconds, 0 means the stream graphs aren't released
+    int streamGraphsIdleTimeout = 0;
+    bool parallelBranches = false;
+    size_t executionTraceCapacity = 0;
+    float fcSparseWeightsRate = 1.0f;
+    WeightsCompression fcWeightsCompression = WeightsCompression::None;
+    size_t fcWeightsCompressionGroupSize = 128;
+    bool fcTensorParallel = false;
+    bool attentionFusion = true;
+    std::string maxIsa = "ALL";
+    hugepages::Mode hugePages = hugepages::Mode::None;
+    bool bf16AutoMixedPrecision = false;
+    // the precisions of the nodes set explicitly by the original names, are applied only if BF16 is enforced
+    std::map<std::string, InferenceEngine::Precision> bf16PrecisionMap;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
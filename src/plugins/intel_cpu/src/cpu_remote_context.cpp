@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_remote_context.h"
+
+#include <algorithm>
+
+#include <blob_factory.hpp>
+#include <ie_system_conf.h>
+#include <openvino/runtime/allocator.hpp>
+#include "utils/huge_pages.h"
+#include "utils/numa_utils.h"
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+constexpr size_t cacheLineSize = 64;
+
+class PooledHostAllocator : public IAllocator {
+public:
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+    void unlock(void* handle) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        try {
+            return _pool.allocate(size, cacheLineSize);
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        try {
+            _pool.deallocate(handle);
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+private:
+    ov::Allocator _pool = ov::get_pooled_allocator();
+};
+}  // namespace
+
+constexpr const char* CPURemoteContext::numaNodeIdKey;
+
+void* CPUHostAllocator::alloc(size_t size) noexcept {
+    auto mode = hugepages::getMode();
+    if (_forceHugePages && mode == hugepages::Mode::None)
+        mode = hugepages::Mode::Transparent;
+    void* ptr = hugepages::allocate(size, cacheLineSize, mode);
+    // the pages aren't touched yet, so they are placed on the node on the first write
+    if (nullptr != ptr && _numaNodeId >= 0)
+        numa::bindToNode(ptr, size, _numaNodeId);
+    return ptr;
+}
+
+bool CPUHostAllocator::free(void* handle) noexcept {
+    hugepages::free(handle);
+    return true;
+}
+
+const std::shared_ptr<CPUHostAllocator>& CPUHostAllocator::getDefault() {
+    static const auto allocator = std::make_shared<CPUHostAllocator>();
+    return allocator;
+}
+
+std::shared_ptr<IAllocator> CPUHostAllocator::getForIO() {
+    // each blob keeps its allocator, so the blobs created before the mode change are released correctly
+    if (hugepages::getMode() != hugepages::Mode::None)
+        return getDefault();
+    static const auto pooled = std::make_shared<PooledHostAllocator>();
+    return pooled;
+}
+
+CPURemoteContext::CPURemoteContext(const ParamMap& params) {
+    for (const auto& param : params) {
+        if (param.first != numaNodeIdKey)
+            IE_THROW(NotFound) << "Unsupported CPU context parameter: " << param.first;
+        _numaNodeId = param.second.as<int>();
+        const auto numaNodes = getAvailableNUMANodes();
+        if (_numaNodeId != -1 && std::find(numaNodes.begin(), numaNodes.end(), _numaNodeId) == numaNodes.end())
+            IE_THROW() << "Wrong value " << _numaNodeId << " for the CPU context parameter " << numaNodeIdKey
+                       << ", the NUMA node doesn't exist";
+    }
+    // the context tensors are backed by the huge pages even if the plugin memory is not
+    _allocator = std::make_shared<CPUHostAllocator>(_numaNodeId, true);
+}
+
+std::string CPURemoteContext::getDeviceName() const noexcept {
+    return "CPU";
+}
+
+RemoteBlob::Ptr CPURemoteContext::CreateBlob(const TensorDesc& tensorDesc, const ParamMap& params) {
+    if (!params.empty())
+        IE_THROW(NotImplemented) << "The CPU context tensors can't wrap the user memory";
+    auto self = std::dynamic_pointer_cast<CPURemoteContext>(shared_from_this());
+    return std::make_shared<CPURemoteBlob>(self, CreateHostBlob(tensorDesc));
+}
+
+MemoryBlob::Ptr CPURemoteContext::CreateHostBlob(const TensorDesc& tensorDesc) {
+    return std::dynamic_pointer_cast<MemoryBlob>(make_blob_with_precision(tensorDesc, _allocator));
+}
+
+ParamMap CPURemoteContext::getParams() const {
+    return {{numaNodeIdKey, _numaNodeId}};
+}
+
+CPURemoteBlob::CPURemoteBlob(const CPURemoteContext::Ptr& context, const MemoryBlob::Ptr& hostBlob)
+    : RemoteBlob(hostBlob->getTensorDesc()),
+      _context(context),
+      _hostBlob(hostBlob),
+      _allocator(CPUHostAllocator::getDefault()) {}
+
+ParamMap CPURemoteBlob::getParams() const {
+    return _context->getParams();
+}
+
+std::string CPURemoteBlob::getDeviceName() const noexcept {
+    return _context->getDeviceName();
+}
+
+std::shared_ptr<RemoteContext> CPURemoteBlob::getContext() const noexcept {
+    return _context;
+}
+
+const std::shared_ptr<IAllocator>& CPURemoteBlob::getAllocator() const noexcept {
+    // only locks the handle, the memory is owned by the host blob
+    return _allocator;
+}
+
+void* CPURemoteBlob::getHandle() const noexcept {
+    return const_cast<void*>(_hostBlob->cbuffer().as<const void*>());
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_remote_context.hpp>
+
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Allocates the host memory the CPU plugin binds to the graph inputs and outputs with no copy: the memory is
+ *        aligned to the cache line, the big regions are backed by the huge pages of the CPU_HUGE_PAGES mode, and the
+ *        pages are bound to the NUMA node if it's given
+ */
+class CPUHostAllocator : public InferenceEngine::IAllocator {
+public:
+    /**
+     * @param forceHugePages makes the big regions use at least the transparent huge pages even if the mode is NO
+     */
+    explicit CPUHostAllocator(int numaNodeId = -1, bool forceHugePages = false)
+        : _numaNodeId(numaNodeId), _forceHugePages(forceHugePages) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+    void unlock(void* handle) noexcept override {}
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief The allocator of the host memory with the default placement
+     */
+    static const std::shared_ptr<CPUHostAllocator>& getDefault();
+
+    /**
+     * @brief The allocator of the I/O blobs created by the infer requests. While the huge pages are off, it's the pooled
+     *        allocator of the runtime, so the outputs reallocated for the varying shapes reuse the released memory
+     */
+    static std::shared_ptr<InferenceEngine::IAllocator> getForIO();
+
+private:
+    const int _numaNodeId;
+    const bool _forceHugePages;
+};
+
+/**
+ * @brief The CPU context. Its tensors are the ordinary host memory allocated by the CPUHostAllocator, so the decoders
+ *        may write the frames straight to the memory the inference reads. The only context parameter is NUMA_NODE_ID,
+ *        the node the memory is placed on, -1 (the default) means the system placement
+ */
+class CPURemoteContext : public InferenceEngine::RemoteContext {
+public:
+    using Ptr = std::shared_ptr<CPURemoteContext>;
+
+    static constexpr const char* numaNodeIdKey = "NUMA_NODE_ID";
+
+    explicit CPURemoteContext(const InferenceEngine::ParamMap& params = {});
+
+    std::string getDeviceName() const noexcept override;
+    InferenceEngine::RemoteBlob::Ptr CreateBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                                                const InferenceEngine::ParamMap& params = {}) override;
+    InferenceEngine::MemoryBlob::Ptr CreateHostBlob(const InferenceEngine::TensorDesc& tensorDesc) override;
+    InferenceEngine::ParamMap getParams() const override;
+
+private:
+    int _numaNodeId = -1;
+    std::shared_ptr<CPUHostAllocator> _allocator;
+};
+
+/**
+ * @brief The tensor of the CPU context, a host blob which is also reported as the remote one
+ */
+class CPURemoteBlob : public InferenceEngine::RemoteBlob {
+public:
+    CPURemoteBlob(const CPURemoteContext::Ptr& context, const InferenceEngine::MemoryBlob::Ptr& hostBlob);
+
+    void allocate() noexcept override {
+        _hostBlob->allocate();
+    }
+    bool deallocate() noexcept override {
+        return _hostBlob->deallocate();
+    }
+    InferenceEngine::LockedMemory<void> buffer() noexcept override {
+        return _hostBlob->buffer();
+    }
+    InferenceEngine::LockedMemory<const void> cbuffer() const noexcept override {
+        return _hostBlob->cbuffer();
+    }
+    InferenceEngine::LockedMemory<void> rwmap() noexcept override {
+        return _hostBlob->rwmap();
+    }
+    InferenceEngine::LockedMemory<const void> rmap() const noexcept override {
+        return _hostBlob->rmap();
+    }
+    InferenceEngine::LockedMemory<void> wmap() noexcept override {
+        return _hostBlob->wmap();
+    }
+
+    InferenceEngine::ParamMap getParams() const override;
+    std::string getDeviceName() const noexcept override;
+    std::shared_ptr<InferenceEngine::RemoteContext> getContext() const noexcept override;
+
+protected:
+    const std::shared_ptr<InferenceEngine::IAllocator>& getAllocator() const noexcept override;
+    void* getHandle() const noexcept override;
+
+private:
+    CPURemoteContext::Ptr _context;
+    InferenceEngine::MemoryBlob::Ptr _hostBlob;
+    std::shared_ptr<InferenceEngine::IAllocator> _allocator;
+};
+
+}  // namespace MKLDNNPlugin
@@ -50,6 +50,17 @@ MKLDNNPlugin::CPUTargetMachine::CPUTargetMachine(dnnl::impl::cpu::x64::cpu_isa_t
     jitters[ngraph::snippets::op::VectorStore::get_type_info_static()] = CREATE_EMITTER(StoreEmitter);
     jitters[ngraph::snippets::op::ScalarStore::get_type_info_static()] = CREATE_EMITTER(ScalarStoreEmitter);
 
+    jitters[ngraph::snippets::op::ReduceStore::get_type_info_static()] = CREATE_EMITTER(ReduceStoreEmitter);
+
+    // reductions
+    jitters[ngraph::snippets::op::ReduceInit::get_type_info_static()] = CREATE_EMITTER(ReduceInitEmitter);
+    jitters[ngraph::snippets::op::Reduce::get_type_info_static()] = CREATE_EMITTER(ReduceEmitter);
+    jitters[ngraph::snippets::op::ScalarReduce::get_type_info_static()] = CREATE_EMITTER(ScalarReduceEmitter);
+
+    // spills
+    jitters[ngraph::snippets::op::Spill::get_type_info_static()] = CREATE_EMITTER(SpillEmitter);
+    jitters[ngraph::snippets::op::Reload::get_type_info_static()] = CREATE_EMITTER(ReloadEmitter);
+
     jitters[ngraph::snippets::op::Scalar::get_type_info_static()] = CREATE_EMITTER(ScalarEmitter);
     jitters[ngraph::snippets::op::BroadcastMove::get_type_info_static()] = CREATE_EMITTER(FakeBroadcastEmitter);
     // jitters[ngraph::snippets::op::Nop::get_type_info_static()] = CREATE_EMITTER(NopEmitter); // Not supported
@@ -18,6 +18,10 @@ namespace MKLDNNPlugin {
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // the scheduling info of the kernels compiled with is_dynamic, the layout is the same as in jit_snippets_compile_args
+    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
@@ -25,6 +29,9 @@ struct jit_snippets_compile_args {
     int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
     std::vector<size_t> output_dims = {};
+    // the scheduler dims and offsets above aren't used, they are read from jit_snippets_call_args instead,
+    // so the kernel serves all the shapes with the same rank and broadcasting of the innermost dimension
+    bool is_dynamic = false;
 };
 ///
 /// \brief    Kernel is the only entry point to Codogen Jit compilation. Kernel calculates appropriate data offsets,
@@ -40,11 +47,12 @@ struct jit_snippets_compile_args {
 ///         }
 ///     }
 /// }
-/// Note that Kernel params are passed directly to the emit_code(). The vector of inputs should contain 2 arguments, the
+/// Note that Kernel params are passed directly to the emit_code(). The vector of inputs should contain 3 arguments, the
 /// output vector should be empty. Input parameters
 ///
 /// \param      in[0]       The number of the node inputs
 /// \param      in[1]      The number of the node outputs
+/// \param      in[2]      The number of the stack slots for the spilled vector registers
 ///
 // Todo: Scheduler dims and offsets are currently calculated in MKLDNN Subgraph node and passed to the KernelEmitter.
 //  However, it seems more natural to calculate all the offsets right in the Kernel op, because the calculation is
@@ -76,8 +84,8 @@ public:
 private:
     void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
                             const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
-        if (in.size() != 2)
-            IE_THROW() << "KernelEmitter got invalid number of inputs. Expected 2, got " << in.size();
+        if (in.size() != 3)
+            IE_THROW() << "KernelEmitter got invalid number of inputs. Expected 3, got " << in.size();
         if (out.size() != 0)
             IE_THROW() << "KernelEmitter got unexpected output arguments.";
         const size_t num_params = in[0] + in[1];
@@ -98,6 +106,7 @@ private:
         const size_t num_inputs = in[0];
         const size_t num_outputs = in[1];
         const size_t num_params = num_inputs + num_outputs;
+        const size_t spill_slots = in[2];
         int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
         const int64_t harness_num_dims = jcp.output_dims.size() - 1;
 
@@ -106,8 +115,20 @@ private:
         Xbyak::Reg64 reg_tmp_64 { dnnl::impl::cpu::x64::abi_not_param1};
 
         h->preamble();
+        // rbp is saved by the preamble and isn't used by the emitters, so it addresses the spill slots
+        if (spill_slots > 0) {
+            h->sub(h->rsp, spill_slots * get_vec_length());
+            h->mov(h->rbp, h->rsp);
+        }
 
         std::vector<Reg64> regs(num_params);
+        auto init_ptrs_with_runtime_offsets = [&](Reg64 pointer, size_t offsets_idx) {
+            for (int j = 0; j < harness_num_dims; j++) {
+                h->mov(reg_tmp_64, h->ptr[reg_const_params + GET_OFF(data_offsets) + (offsets_idx + j) * sizeof(int64_t)]);
+                h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp_64);
+            }
+        };
         auto init_ptrs_with_offsets = [&](Reg64 pointer, const int64_t *offsets) {
             for (int j = 0; j < harness_num_dims; j++) {
                 if (jcp.output_dims[j] != 1 && offsets[j] != 0) {
@@ -123,13 +144,18 @@ private:
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
             else
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-            init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
+            if (jcp.is_dynamic)
+                init_ptrs_with_runtime_offsets(regs[i], i * harness_num_dims);
+            else
+                init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
         }
 
         for (auto& c : code) {
             c.first->emit_code(c.second.first, c.second.second, pool, gpr);
         }
 
+        if (spill_slots > 0)
+            h->add(h->rsp, spill_slots * get_vec_length());
         h->postamble();
     }
 
@@ -210,6 +236,10 @@ private:
         std::vector<Reg64> regs(num_params);
         for (auto i = 0; dim == 0 && i < num_params; i++)
             regs[i] = Reg64(reg64_tmp_start + i);
+        if (jcp.is_dynamic) {
+            emit_runtime_loop(inc, previous_inc, num_params, dim, amount, regs, pool, local_gpr);
+            return;
+        }
         // Loop processing could be simplified in some cases
         if (inc > jcp.scheduler_dims[dim]) {
             return;
@@ -252,6 +282,36 @@ private:
         }
     }
 
+    // The work amount is known only at runtime, so the tile is always a loop. Kernel keeps the call args pointer in
+    // abi_param2 and the enclosed emitters preserve it. The scalar tile proceeds with the amount left by the vector one.
+    void emit_runtime_loop(size_t inc, size_t previous_inc, size_t num_params, size_t dim, const Reg64& amount,
+                           const std::vector<Reg64>& regs, const std::vector<size_t>& pool, const std::vector<size_t>& local_gpr) const {
+        Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
+        std::array<Label, 2> for_body;
+
+        if (previous_inc == 0)
+            h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
+        h->cmp(amount, inc);
+        h->jl(for_body[0], CodeGenerator::T_NEAR);
+
+        h->L(for_body[1]);
+        {
+            h->push(amount);
+            for (auto& c : code) {
+                c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
+            }
+            h->pop(amount);
+            for (auto i = 0; dim == 0 && i < num_params; i++) {
+                h->add(regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+            }
+            h->sub(amount, inc);
+            h->cmp(amount, inc);
+            h->jge(for_body[1], CodeGenerator::T_NEAR);
+        }
+
+        h->L(for_body[0]);
+    }
+
     // A = <42, 17>
     // B = < 1, 17>
     // for (auto k = 0; k < dom_0; k++) { // 42
@@ -632,4 +692,291 @@ private:
     bool shouldPostIncrement;
 };
 
-} // namespace MKLDNNPlugin
\ No newline at end of file
+///
+/// Reduction emitters:
+///
+/// The accumulator of a reduction is a vector register which isn't reused by the other values of the snippet.
+/// ReduceInit fills it with the identity before the inner tiles, Reduce and ScalarReduce accumulate the vector and
+/// the tail elements, ReduceStore reduces its lanes after the inner tiles and stores a single value per row.
+class ReduceInitEmitter : public jit_emitter {
+public:
+    ReduceInitEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), kind(ov::as_type_ptr<ngraph::snippets::op::ReduceInit>(n)->get_kind()) {
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+            push_arg_entry_of("minus_inf", 0xff800000, true);
+        prepare_table();
+    }
+
+    size_t get_inputs_num() const override {return 0;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_acc = Vmm(out[0]);
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max) {
+            h->uni_vbroadcastss(vmm_acc, table_val("minus_inf"));
+        } else {
+            h->uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+        }
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), kind(ov::as_type_ptr<ngraph::snippets::op::Reduce>(n)->get_kind()) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src0 = Vmm(in[0]);
+        Vmm vmm_acc = Vmm(out[0]);
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max) {
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src0);
+        } else {
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_src0);
+        }
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+class ScalarReduceEmitter : public jit_emitter {
+public:
+    ScalarReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), kind(ov::as_type_ptr<ngraph::snippets::op::Reduce>(n)->get_kind()) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_acc = Vmm(out[0]);
+        Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+        // Only the first lane of the source holds the tail element, the other ones keep the results of the previous ops
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max) {
+            // maximum is idempotent, so the element may be accumulated by all the lanes
+            h->uni_vbroadcastss(vmm_aux, Xmm(in[0]));
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_aux);
+        } else {
+            h->uni_vpxor(vmm_aux, vmm_aux, vmm_aux);
+            h->uni_vmovss(Xmm(aux_vec_idxs[0]), Xmm(in[0]));
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_aux);
+        }
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+class ReduceStoreEmitter : public MemoryEmitter {
+public:
+    ReduceStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : MemoryEmitter(h, isa, n), kind(ov::as_type_ptr<ngraph::snippets::op::ReduceStore>(n)->get_kind()) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    void horiz_ps(const Xmm& xmm, const Operand& op) const {
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max) {
+            h->uni_vmaxps(xmm, xmm, op);
+        } else {
+            h->uni_vaddps(xmm, xmm, op);
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        Reg64 out_reg(ea);
+        Xmm xmm_acc = Xmm(in[0]);
+        Xmm xmm_aux = Xmm(aux_vec_idxs[0]);
+        // the accumulator is reinitialized before the next row, so its lanes are reduced in place
+        if (isa == dnnl::impl::cpu::x64::avx512_common) {
+            h->vextractf64x4(Ymm(xmm_aux.getIdx()), Zmm(xmm_acc.getIdx()), 1);
+            horiz_ps(Ymm(xmm_acc.getIdx()), Ymm(xmm_aux.getIdx()));
+        }
+        if (isa != dnnl::impl::cpu::x64::sse41) {
+            h->vextractf128(xmm_aux, Ymm(xmm_acc.getIdx()), 1);
+            horiz_ps(xmm_acc, xmm_aux);
+        }
+        h->uni_vmovhlps(xmm_aux, xmm_aux, xmm_acc);  // aux: f(3), f(4), ...
+        horiz_ps(xmm_acc, xmm_aux);                  // acc: f(1, 3), f(2, 4), ...
+        h->uni_vmovshdup(xmm_aux, xmm_acc);          // aux: f(2, 4), f(2, 4), ...
+        horiz_ps(xmm_acc, xmm_aux);                  // acc: f(1, 2, 3, 4), ...
+        h->uni_vmovss(h->ptr[out_reg], xmm_acc);
+        h->add(out_reg, sizeof(float));
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+///
+/// Spill emitters:
+///
+/// The values which don't fit the vector registers are kept in the stack slots allocated by KernelEmitter. The slots
+/// are addressed relative to rbp because the tiles push and pop the general-purpose registers around the loop bodies.
+class SpillEmitter : public jit_emitter {
+public:
+    SpillEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), slot(ov::as_type_ptr<ngraph::snippets::op::Spill>(n)->get_slot()) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        h->uni_vmovups(h->ptr[h->rbp + slot * get_vec_length()], Vmm(in[0]));
+    }
+
+private:
+    size_t slot;
+};
+
+class ReloadEmitter : public jit_emitter {
+public:
+    ReloadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), slot(ov::as_type_ptr<ngraph::snippets::op::Reload>(n)->get_slot()) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        h->uni_vmovups(Vmm(out[0]), h->ptr[h->rbp + slot * get_vec_length()]);
+    }
+
+private:
+    size_t slot;
+};
+
+} // namespace MKLDNNPlugin
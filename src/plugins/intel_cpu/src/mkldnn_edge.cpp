@@ -276,6 +276,25 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
     status = Status::Allocated;
 }
 
+void MKLDNNEdge::allocate(DnnlMemoryMngrPtr memMngr) {
+    if (status != Status::NeedAllocation)
+        return;
+
+    if (memoryPtr)
+        IE_THROW() << "Unexpected behaviour: status == NeedAllocation but memory is already allocated.";
+
+    auto& inputDesc = getInputDesc();
+    auto& outputDesc = getOutputDesc();
+    if (!inputDesc.isCompatible(outputDesc))
+        IE_THROW() << "Cannot allocate memory for incompatible descriptors.";
+
+    auto parentPtr = getParent();
+    memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
+
+    memoryPtr->Create(inputDesc, memMngr);
+    status = Status::Allocated;
+}
+
 std::string MKLDNNEdge::name() const {
     auto parentPtr = getParent();
     auto childPtr = getChild();
@@ -287,7 +306,7 @@ std::string MKLDNNEdge::name() const {
     return  result.str();
 }
 
-void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
+void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const std::string& key) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -297,7 +316,8 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        externalKey = key.empty() ? name() : key;
+        auto ptr = weightsCache->findOrCreate(externalKey, alloc, false);
         memoryPtr = *ptr;
         useExternalMemory = true;
         status = Status::Allocated;
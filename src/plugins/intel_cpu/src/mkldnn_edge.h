@@ -50,7 +50,13 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
+    void allocate(DnnlMemoryMngrPtr memMngr);
+    /**
+     * @brief Allocates the memory in the weights cache, if any
+     * @param key The key of the memory in the cache, the edge name is used if empty
+     */
+    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const std::string& key = {});
+    const std::string& getExternalKey() const { return externalKey; }
     void reuse(MKLDNNMemoryPtr ptr);
     void validate();
     void drop();
@@ -87,6 +93,7 @@ private:
     int child_port;
 
     bool useExternalMemory = false;
+    std::string externalKey;
     MKLDNNEdgeWeakPtr memoryFromEdge;
     MKLDNNMemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
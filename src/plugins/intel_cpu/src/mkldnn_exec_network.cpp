@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <blob_factory.hpp>
 #include <precision_utils.h>
 #include "mkldnn_exec_network.h"
 
@@ -13,6 +14,7 @@
 #include "mkldnn_serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "utils/numa_utils.h"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -20,13 +22,20 @@
 #endif
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
+#include <ngraph/log.hpp>
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/op/util/read_value_base.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -64,12 +73,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
                                      NumaNodesWeights &numaNodesWeights,
+                                     const MultiCachePtr &sharedRtCache,
                                      const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _sharedRtCache(sharedRtCache),
     _network(network) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
@@ -88,6 +99,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
+    } else if (_cfg.sharedStreamsPool && 0 != _cfg.streamExecutorConfig._streams) {
+        // the pool is configured the same way for all the models, so they all lease the streams of the single pool
+        auto poolConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(
+            {"CPUSharedStreamsExecutor", InferenceEngine::IStreamsExecutor::Config::GetDefaultNumStreams(), 0,
+             _cfg.streamExecutorConfig._threadBindingType});
+        _taskExecutor = _plugin->executorManager()->getSharedCPUStreamsExecutor(poolConfig, _cfg.streamExecutorConfig._streams);
+        // the requests may run on any of the pool streams, so there is the graph per pool stream
+        _cfg.streamExecutorConfig._streams = poolConfig._streams;
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
@@ -109,20 +128,59 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    if (_cfg.executionTraceCapacity > 0) {
+        _tracer = std::make_shared<ExecutionTracer>(_cfg.executionTraceCapacity);
+    }
+
+    const auto numaNodes = getAvailableNUMANodes();
+    if (_cfg.fcTensorParallel && numaNodes.size() > 1) {
+        // a stream per NUMA node, the FullyConnected nodes of all the graphs split their weights between the streams
+        _tensorParallelExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUTensorParallelExecutor", static_cast<int>(numaNodes.size()), 0,
+                                     IStreamsExecutor::ThreadBindingType::NUMA});
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
+    // the pipelined streams share a single graph which stages are executed by the requests of different streams concurrently
+    const bool pipelinedStreams = _cfg.pipelinedStreams && streams > 1 && !function->is_dynamic() && _cfg.batchLimit == 0 &&
+                                  !ngraph::op::util::has_op_with_type<ov::op::util::ReadValueBase>(function);
+    _graphs.resize(pipelinedStreams ? 1 : streams);
+
+    // the sub-batches are inferred by the graphs of the other streams, so the batch must be the only dynamic dimension
+    // and the model must not keep the state between the requests
+    auto isBatchOnlyDynamic = [](const ov::PartialShape& shape) {
+        if (shape.rank().is_dynamic() || shape.rank().get_length() == 0 || shape[0].is_static())
+            return false;
+        return std::all_of(shape.begin() + 1, shape.end(), [](const ov::Dimension& dim) {
+            return dim.is_static();
+        });
+    };
+    const auto& parameters = function->get_parameters();
+    const auto& results = function->get_results();
+    const bool splittableBatch = !parameters.empty() &&
+        std::all_of(parameters.begin(), parameters.end(), [&](const std::shared_ptr<ngraph::op::v0::Parameter>& parameter) {
+            return isBatchOnlyDynamic(parameter->get_output_partial_shape(0));
+        }) &&
+        std::all_of(results.begin(), results.end(), [&](const std::shared_ptr<ngraph::op::v0::Result>& result) {
+            return isBatchOnlyDynamic(result->get_input_partial_shape(0));
+        });
+    if (splittableBatch && streams > 1 && !pipelinedStreams && !cfg.exclusiveAsyncRequests && _cfg.batchLimit == 0 &&
+        !ngraph::op::util::has_op_with_type<ov::op::util::ReadValueBase>(function))
+        _batchSplitMinSize = _cfg.batchSplitMinSize;
     if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
-        }
-        _taskExecutor->runAndWait(tasks);
+        // only the graph of a single stream is created eagerly, so the model is checked to be compilable. The graphs of
+        // the other streams are created on their first use and share the weights with it through the weights cache
+        _taskExecutor->runAndWait({[this] {
+            MKLDNNExecNetwork::GetGraph();
+        }});
     } else {
         MKLDNNExecNetwork::GetGraph();
     }
 
+    if (!_cfg.cache_dir.empty() && function->is_dynamic()) {
+        _shapesProfile = std::make_shared<ShapesProfile>(_cfg.cache_dir, function);
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -133,15 +191,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (!memoryNode) {
                     IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
                 }
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(memoryNode->getVariableName(), memoryNode->getStorage()));
             }
         }
     }
@@ -160,11 +210,23 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                MKLDNNWeightsSharing::Ptr weightsCache;
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    graphLock._graph.setSelectedDescriptors(_selectedDescriptors);
+                    // disable weights caching if graph was created only once, unless the weights are shared with the other models
+                    if (_cfg.streamExecutorConfig._streams != 1 || _cfg.sharedWeights)
+                        weightsCache = _numaNodesWeights.get(numaNodeId, _cfg.weightsNumaPolicy);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.setTracer(_tracer);
+                graphLock._graph.setTensorParallelExecutor(_tensorParallelExecutor);
+                graphLock._graph._numaNodeId = numaNodeId;
+                graphLock._graph.CreateGraph(_network, extensionManager, weightsCache, _sharedRtCache);
+                // the first created graph is the template the graphs of the other streams replay the selection of
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                if (!_selectedDescriptors)
+                    _selectedDescriptors = graphLock._graph.getSelectedDescriptors();
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -178,13 +240,37 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
             std::rethrow_exception(exception);
         }
     }
+    if (_cfg.streamGraphsIdleTimeout > 0) {
+        graphLock._graph._lastUsed = std::chrono::steady_clock::now();
+        ReleaseIdleGraphs(graphLock._graph);
+    }
     return graphLock;
 }
 
+void MKLDNNExecNetwork::ReleaseIdleGraphs(const Graph& current) const {
+    const auto now = std::chrono::steady_clock::now();
+    const auto timeout = std::chrono::milliseconds(_cfg.streamGraphsIdleTimeout);
+    // the graphs are checked at most once per timeout by one of the callers
+    auto nextCheck = _nextIdleGraphsCheck.load();
+    if (now.time_since_epoch().count() < nextCheck ||
+        !_nextIdleGraphsCheck.compare_exchange_strong(nextCheck, (now + timeout).time_since_epoch().count()))
+        return;
+    for (auto& graph : _graphs) {
+        if (&graph == &current)
+            continue;
+        // the graphs being used right now are skipped, they are obviously not idle
+        std::unique_lock<std::mutex> lock{graph._mutex, std::try_to_lock};
+        if (lock && graph.IsReady() && 0 == graph._users && now - graph._lastUsed > timeout)
+            graph.Release();
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
         _cfg.readProperties(properties);
+        // the properties may change the selection, so the graphs created later search for it again
+        _selectedDescriptors = nullptr;
     }
     for (auto& g : _graphs) {
         auto graphLock = Graph::Lock(g);
@@ -195,9 +281,76 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
+    // I/O information is set after the network construction, so the warm up is done on the first request creation
+    if (_shapesProfile && !_shapesProfile->getLoadedRecords().empty()) {
+        std::call_once(_warmUpFlag, [this] {
+            WarmUp();
+        });
+    }
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
 
+void MKLDNNExecNetwork::WarmUp() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "WarmUp");
+    const auto& records = _shapesProfile->getLoadedRecords();
+    auto warmUpGraph = [&] {
+        // the profile may be outdated or the shapes may be incompatible with the model, it's just a hint, so the
+        // failure is reported and the graph is left to be prepared by the inference
+        try {
+            auto request = CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+            for (const auto& record : records) {
+                for (const auto& input : record) {
+                    const auto& desc = request->GetBlob(input.first)->getTensorDesc();
+                    auto blob = make_blob_with_precision(
+                        TensorDesc(desc.getPrecision(), input.second, TensorDesc::getLayoutByDims(input.second)));
+                    blob->allocate();
+                    std::memset(blob->buffer(), 0, blob->byteSize());
+                    request->SetBlob(input.first, blob);
+                }
+                request->Infer();
+            }
+        } catch (const std::exception& e) {
+            NGRAPH_WARN << "CPU plugin: the warm up of " << _name << " with the recorded shapes failed: " << e.what();
+        } catch (...) {
+            NGRAPH_WARN << "CPU plugin: the warm up of " << _name << " with the recorded shapes failed";
+        }
+    };
+
+    if (_cfg.streamExecutorConfig._streams == 0) {
+        warmUpGraph();
+        return;
+    }
+    if (_graphs.size() == 1) {
+        _taskExecutor->runAndWait({warmUpGraph});
+        return;
+    }
+
+    // the executor doesn't post the tasks to the given streams, but a stream runs one task at a time, so the tasks
+    // waiting for each other to start occupy all the streams and each one warms up the graph of its own stream
+    const auto streams = _graphs.size();
+    std::mutex mutex;
+    std::condition_variable allStarted;
+    std::set<int> streamIds;
+    size_t started = 0;
+    auto warmUpStream = [&] {
+        auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            started++;
+            if (streamsExecutor)
+                streamIds.insert(streamsExecutor->GetStreamId() % static_cast<int>(streams));
+            allStarted.notify_all();
+            // the streams busy with other tasks don't stop the warm up of the idle ones for long
+            allStarted.wait_for(lock, std::chrono::seconds(10), [&] { return started == streams; });
+        }
+        warmUpGraph();
+    };
+    _taskExecutor->runAndWait(std::vector<Task>(streams, warmUpStream));
+    if (streamIds.size() != streams)
+        NGRAPH_WARN << "CPU plugin: only " << streamIds.size() << " of " << streams << " streams of " << _name
+                    << " were warmed up with the recorded shapes";
+}
+
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
@@ -248,6 +401,7 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(ov::memory_statistics.name());
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -262,11 +416,127 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_WEIGHTS_NUMA_BYTES) {
+        // the weights are shared only when there are several streams
+        std::map<int, size_t> bytes;
+        if (graph.weightsCache) {
+            bytes = _numaNodesWeights.getBytesPerNumaNode(graph.getProperty().weightsNumaPolicy);
+        }
+        return bytes;
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_BF16_PRECISION_MAP) {
+        return graph.GetBF16PrecisionMap();
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_EXECUTION_TRACE) {
+        if (!_tracer)
+            IE_THROW() << "The execution tracing is disabled, set " << PluginConfigInternalParams::KEY_CPU_EXECUTION_TRACE_CAPACITY
+                       << " to enable it";
+        return _tracer->dumpChromeTrace();
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_RUNTIME_CACHE_STATS) {
+        // the graphs have own caches or share one, each cache is counted once
+        std::set<MultiCachePtr> caches{graph.getRuntimeCache()};
+        for (auto& g : _graphs) {
+            if (&g == &graph)
+                continue;
+            // the graphs being created right now are skipped, their lookups are counted by the next query
+            std::unique_lock<std::mutex> lock{g._mutex, std::try_to_lock};
+            if (lock && g.IsReady())
+                caches.insert(g.getRuntimeCache());
+        }
+        std::map<std::string, uint64_t> stats{{"hits", 0}, {"misses", 0}};
+        for (auto& cache : caches) {
+            if (cache) {
+                stats["hits"] += cache->getHits();
+                stats["misses"] += cache->getMisses();
+            }
+        }
+        return stats;
+    } else if (name == ov::memory_statistics) {
+        return GetMemoryStatistics(&graph);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+std::map<std::string, uint64_t> MKLDNNExecNetwork::GetMemoryStatistics(const Graph* current) const {
+    // the blocks are merged by the address, so the weights shared by the streams are counted once
+    std::unordered_map<const void*, size_t> weights;
+    std::unordered_map<const void*, size_t> activations;
+    std::map<int, uint64_t> dynamicActivations;
+    uint64_t io = 0;
+    uint64_t activationsPeak = 0;
+    for (auto& g : _graphs) {
+        // the graphs being created right now are skipped, their memory is counted by the next query
+        std::unique_lock<std::mutex> lock;
+        if (&g != current) {
+            lock = std::unique_lock<std::mutex>{g._mutex, std::try_to_lock};
+            if (!lock)
+                continue;
+        }
+        const auto usage = g.GetMemoryUsage();
+        weights.insert(usage.weights.begin(), usage.weights.end());
+        activations.insert(usage.activations.begin(), usage.activations.end());
+        if (usage.dynamicActivations)
+            dynamicActivations[g._numaNodeId] += usage.dynamicActivations;
+        io += usage.io;
+        activationsPeak += g.GetActivationsPeak();
+    }
+
+    std::map<std::string, uint64_t> stats;
+    auto location = [](int numaNode) {
+        return numaNode < 0 ? std::string("numa_unknown") : "numa" + std::to_string(numaNode);
+    };
+    auto addBlocks = [&](const std::string& category, const std::unordered_map<const void*, size_t>& blocks) {
+        for (const auto& block : blocks) {
+            // the partially covered pages aren't queried, they are attributed to the node of the most of the block
+            auto nodesBytes = numa::getBytesPerNode(block.first, block.second);
+            size_t placed = 0;
+            std::pair<int, size_t> mainNode{-1, 0};
+            for (const auto& nodeBytes : nodesBytes) {
+                placed += nodeBytes.second;
+                if (nodeBytes.second > mainNode.second)
+                    mainNode = nodeBytes;
+            }
+            nodesBytes[mainNode.first] += block.second - std::min(placed, block.second);
+            for (const auto& nodeBytes : nodesBytes) {
+                if (nodeBytes.second)
+                    stats[category + "/" + location(nodeBytes.first) + "/current"] += nodeBytes.second;
+            }
+            stats[category + "/total/current"] += block.second;
+        }
+    };
+    addBlocks("weights", weights);
+    addBlocks("activations", activations);
+    for (const auto& nodeBytes : dynamicActivations) {
+        stats["activations/" + location(nodeBytes.first) + "/current"] += nodeBytes.second;
+        stats["activations/total/current"] += nodeBytes.second;
+    }
+    stats["io/total/current"] = io;
+    stats.emplace("weights/total/current", 0);
+    stats.emplace("activations/total/current", 0);
+
+    {
+        // the graph activations peak survives the graph release, the other peaks are the highest values queried
+        std::lock_guard<std::mutex> lock{_memoryPeaksMutex};
+        auto& activationsTotalPeak = _memoryPeaks["activations/total/peak"];
+        activationsTotalPeak = std::max<uint64_t>(activationsTotalPeak, activationsPeak);
+        for (const auto& stat : stats) {
+            const auto key = stat.first.substr(0, stat.first.rfind('/')) + "/peak";
+            auto& peak = _memoryPeaks[key];
+            peak = std::max(peak, stat.second);
+        }
+        stats.insert(_memoryPeaks.begin(), _memoryPeaks.end());
+    }
+
+    for (const auto& specialization : _shapeSpecializations) {
+        for (const auto& stat : specialization.network->GetMemoryStatistics(nullptr))
+            stats[stat.first] += stat.second;
+    }
+    return stats;
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> MKLDNNExecNetwork::GetContext() const {
+    return _context ? _context : _plugin->GetDefaultContext({});
+}
+
 InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
@@ -295,6 +565,7 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::memory_statistics.name()),
         };
     }
 
@@ -392,3 +663,8 @@ void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
 }
+
+void MKLDNNExecNetwork::addShapeSpecialization(const std::map<std::string, InferenceEngine::SizeVector>& shapes,
+                                               const std::shared_ptr<MKLDNNExecNetwork>& network) {
+    _shapeSpecializations.push_back({shapes, network});
+}
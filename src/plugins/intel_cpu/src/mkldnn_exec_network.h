@@ -9,8 +9,11 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "cache/shapes_profile.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <vector>
 #include <memory>
 #include <map>
@@ -35,6 +38,7 @@ public:
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const MultiCachePtr &sharedRtCache,
                       const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
 
     void setProperty(const std::map<std::string, std::string> &properties);
@@ -43,10 +47,22 @@ public:
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
 
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+
+    void setContext(const std::shared_ptr<InferenceEngine::RemoteContext>& context) {
+        _context = context;
+    }
+
     std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
 
     void Export(std::ostream& modelStream) override;
 
+    /**
+     * @brief Makes the requests with the given input shapes be inferred by the static network compiled for them
+     */
+    void addShapeSpecialization(const std::map<std::string, InferenceEngine::SizeVector>& shapes,
+                                const std::shared_ptr<MKLDNNExecNetwork>& network);
+
 protected:
     friend class MKLDNNInferRequestBase;
     MKLDNNExtensionManager::Ptr extensionManager;
@@ -58,6 +74,11 @@ protected:
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        // the number of the infer requests referring to the graph, such graph isn't released when it's idle
+        std::atomic_int _users = {0};
+        std::chrono::steady_clock::time_point _lastUsed;
+        // the NUMA node of the stream which created the graph, its dynamic memory is placed there
+        int _numaNodeId = -1;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             Graph&                          _graph;
@@ -67,6 +88,32 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // runtime parameters cache shared between graphs, nullptr means each graph creates its own one
+    MultiCachePtr                               _sharedRtCache;
+    // input shapes of a dynamic model persisted in the cache dir, nullptr if it's not applicable
+    ShapesProfile::Ptr                          _shapesProfile;
+    std::once_flag                              _warmUpFlag;
+    // records the execution of the graphs of all the streams, nullptr if the tracing is disabled
+    ExecutionTracer::Ptr                        _tracer;
+    // a stream per NUMA node executing the parts of the large FullyConnected weights, nullptr if it's not applied
+    InferenceEngine::IStreamsExecutor::Ptr      _tensorParallelExecutor;
+    // the minimal size of the sub-batches the request batch is split into between the streams, 0 if it's not split
+    std::atomic<size_t>                         _batchSplitMinSize = {0};
+    // the descriptors selected by the first created graph, nullptr until then, guarded by _cfgMutex
+    mutable MKLDNNGraph::SelectedDescriptors::Ptr _selectedDescriptors;
+    // the context the network is compiled with, nullptr means the default context of the plugin
+    std::shared_ptr<InferenceEngine::RemoteContext> _context;
+    // the time of the next idle stream graphs check, in the steady clock ticks
+    mutable std::atomic<std::chrono::steady_clock::rep> _nextIdleGraphsCheck = {0};
+    struct ShapeSpecialization {
+        std::map<std::string, InferenceEngine::SizeVector> shapes;
+        std::shared_ptr<MKLDNNExecNetwork>                 network;
+    };
+    // the static networks compiled for the KEY_CPU_SHAPE_SPECIALIZATIONS input shapes, are set only at the compilation
+    std::vector<ShapeSpecialization>            _shapeSpecializations;
+    // the highest values of the memory statistics reported so far, by the "<category>/<location>/peak" key
+    mutable std::mutex                          _memoryPeaksMutex;
+    mutable std::map<std::string, uint64_t>     _memoryPeaks;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -74,13 +121,30 @@ protected:
      */
     Graph::Lock GetGraph() const;
 
+    /**
+     * @brief Releases the graphs of the streams unused for longer than the timeout and not referred by the requests
+     */
+    void ReleaseIdleGraphs(const Graph& current) const;
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
+    /**
+     * @brief Runs the graphs of all the streams with the input shapes stored in the shapes profile, so the primitives
+     *        for these shapes are created and cached before the first real request
+     */
+    void WarmUp();
+
     bool isLegacyAPI() const;
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const Graph& graph) const;
+
+    /**
+     * @brief Collects the ov::memory_statistics of the graphs of all the streams and of the shape specializations
+     * @param current the graph locked by the caller, the other graphs being created right now are skipped
+     */
+    std::map<std::string, uint64_t> GetMemoryStatistics(const Graph* current) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,8 +3,12 @@
 //
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <string>
 #include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -13,6 +17,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <numeric>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -23,8 +28,12 @@
 #include "mkldnn_itt.h"
 #include "mkldnn_infer_request.h"
 #include <nodes/mkldnn_input_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_conv_node.h>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -41,14 +50,25 @@
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
+#include <ngraph/log.hpp>
 #include <ngraph/variant.hpp>
 #include <ngraph/ops.hpp>
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
+#include <load_time_stats.hpp>
+#include "ie_parallel.hpp"
+#include "utils/cpu_affinity.h"
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#include <tbb/task_scheduler_observer.h>
+#endif
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -62,18 +82,26 @@ mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
-        MKLDNNWeightsSharing::Ptr &w_cache) {
+        MKLDNNWeightsSharing::Ptr &w_cache, const MultiCachePtr &rtCache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
 
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // the caller decides whether the weights are cached, so the body graphs of the nodes (e.g. TensorIterator) which
+    // are created with the default config share their constants with the other streams as the parent graph does
+    weightsCache = w_cache;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    // use the externally provided (shared between streams or compiled models) cache if any
+    rtParamsCache = rtCache ? rtCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
-    Replicate(net, extMgr);
-    InitGraph();
+    {
+        ov::load_time_stats::Scope scope{"cpu_graph/replicate"};
+        Replicate(net, extMgr);
+    }
+    {
+        ov::load_time_stats::Scope scope{"cpu_graph/init"};
+        InitGraph();
+    }
 
     status = Ready;
 
@@ -81,9 +109,9 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 }
 
 template void MKLDNNGraph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const MultiCachePtr&);
 template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const MultiCachePtr&);
 
 void MKLDNNGraph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -116,6 +144,12 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, co
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        if (node->getType() == FullyConnected) {
+            auto fcNode = std::static_pointer_cast<MKLDNNFullyConnectedNode>(node);
+            fcNode->setMinSparseRate(config.fcSparseWeightsRate);
+            fcNode->setWeightsCompression(config.fcWeightsCompression, config.fcWeightsCompressionGroupSize);
+            fcNode->setTensorParallelExecutor(tensorParallelExecutor);
+        }
 
         graphNodes.push_back(node);
 
@@ -210,6 +244,12 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        if (node->getType() == FullyConnected) {
+            auto fcNode = std::static_pointer_cast<MKLDNNFullyConnectedNode>(node);
+            fcNode->setMinSparseRate(config.fcSparseWeightsRate);
+            fcNode->setWeightsCompression(config.fcWeightsCompression, config.fcWeightsCompressionGroupSize);
+            fcNode->setTensorParallelExecutor(tensorParallelExecutor);
+        }
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -320,6 +360,8 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    RecordDescriptors();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -327,6 +369,10 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    SplitToPipelineStages();
+
+    SplitToParallelLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -338,7 +384,19 @@ void MKLDNNGraph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    RegisterTraceNames();
+
+    InitVariableStorages();
+
+    InitPipelineStages();
+
+    InitParallelLevels();
+
     ExecuteConstantNodesOnly();
+
+    InitShapesPlanCache();
+
+    InitShapeBuckets();
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -348,29 +406,187 @@ void MKLDNNGraph::InitNodes() {
     }
 }
 
+namespace {
+/* Calls the function for each node in parallel. The nodes read the state of their neighbours (e.g. Concat and
+ * Convolution check whether their parents are constant), so the state the nodes resolve lazily is resolved here for
+ * all the nodes in advance: MKLDNNNode::isConstant() walks and writes the constness of the neighbours on the first
+ * call. After that the neighbours are only read and the caches the nodes share are locked, so the calls are
+ * independent. The costs of the nodes differ by orders of magnitude, so each thread takes the next node once it's done
+ * with the previous one. The exception of the first failed node in the order is rethrown */
+template <typename Func>
+void parallelForNodes(const std::vector<MKLDNNNodePtr>& nodes, const Func& func) {
+    for (const auto& node : nodes)
+        node->isConstant();
+
+    std::vector<std::exception_ptr> errors(nodes.size());
+    std::atomic<size_t> next{0};
+    parallel_nt(nodes.size() > 1 ? 0 : 1, [&](const int, const int) {
+        for (auto i = next++; i < nodes.size(); i = next++) {
+            try {
+                func(nodes[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
 void MKLDNNGraph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
 
-    for (auto &node : graphNodes) {
+    // the descriptors of the node depend on its own shapes and precisions and on the constness of its neighbours,
+    // which is resolved before the parallel loop, oneDNN descriptors are created here
+    parallelForNodes(graphNodes, [&](const MKLDNNNodePtr& node) {
         if (node->getType() == Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    });
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
-    }
+    if (ReplayDescriptors())
+        return;
 
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    MinimizeReorders();
+}
+
+bool MKLDNNGraph::ReplayDescriptors() {
+    if (!replayedDescriptors)
+        return false;
+    const auto& selected = replayedDescriptors->nodes;
+    if (selected.size() != graphNodes.size())
+        return false;
+    for (const auto& node : graphNodes) {
+        auto found = selected.find(node->getName());
+        if (found == selected.end() || found->second.second != node->getSupportedPrimitiveDescriptors().size())
+            return false;
+    }
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ReplayDescriptors");
+    for (const auto& node : graphNodes)
+        node->selectPrimitiveDescriptorByIndex(selected.at(node->getName()).first);
+    return true;
+}
+
+void MKLDNNGraph::RecordDescriptors() {
+    auto descriptors = std::make_shared<SelectedDescriptors>();
+    for (const auto& node : graphNodes) {
+        const auto pd = node->getSelectedPrimitiveDescriptor();
+        const auto index = pd ? static_cast<int>(pd - node->getSupportedPrimitiveDescriptors().data()) : -1;
+        // the selection can't be replayed by the names which aren't unique
+        const auto supported = node->getSupportedPrimitiveDescriptors().size();
+        if (!descriptors->nodes.emplace(node->getName(), std::make_pair(index, supported)).second) {
+            selectedDescriptors = nullptr;
+            return;
+        }
+    }
+    selectedDescriptors = descriptors;
+}
+
+namespace {
+// the bytes the reorder between the descriptors copies, an edge of the undefined size counts as a byte
+size_t getReorderBytes(const MemoryDesc& parentDesc, const MemoryDesc& childDesc) {
+    if (childDesc.isCompatible(parentDesc))
+        return 0;
+    const auto& shape = parentDesc.getShape();
+    return shape.isStatic() ? shape.getElementsCount() * parentDesc.getPrecision().size() : 1;
+}
+
+bool hasInPlacePorts(const NodeConfig& config) {
+    return std::any_of(config.inConfs.begin(), config.inConfs.end(), [](const PortConfig& conf) { return conf.inPlace() >= 0; }) ||
+           std::any_of(config.outConfs.begin(), config.outConfs.end(), [](const PortConfig& conf) { return conf.inPlace() >= 0; });
+}
+
+// the bytes of the reorders on the edges of the node if the node selects the config, the reorders of the constants
+// are executed once on the graph creation, so they are free
+size_t getReorderBytes(const MKLDNNNodePtr& node, const NodeConfig& config) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        const auto edge = node->getParentEdgeAt(i);
+        const auto parent = edge->getParent();
+        const auto parentPd = parent->getSelectedPrimitiveDescriptor();
+        if ((parent->isConstant() && !node->isConstant()) || !parentPd)
+            continue;
+        const auto& parentConfs = parentPd->getConfig().outConfs;
+        if (edge->getInputNum() >= parentConfs.size() || edge->getOutputNum() >= config.inConfs.size())
+            continue;
+        bytes += getReorderBytes(*parentConfs[edge->getInputNum()].getMemDesc(), *config.inConfs[edge->getOutputNum()].getMemDesc());
+    }
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        const auto child = edge->getChild();
+        const auto childPd = child->getSelectedPrimitiveDescriptor();
+        if ((node->isConstant() && !child->isConstant()) || !childPd)
+            continue;
+        const auto& childConfs = childPd->getConfig().inConfs;
+        if (edge->getOutputNum() >= childConfs.size() || edge->getInputNum() >= config.outConfs.size())
+            continue;
+        bytes += getReorderBytes(*config.outConfs[edge->getInputNum()].getMemDesc(), *childConfs[edge->getOutputNum()].getMemDesc());
+    }
+    return bytes;
+}
+}  // namespace
+
+void MKLDNNGraph::MinimizeReorders() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::MinimizeReorders");
+    /* The nodes select the descriptors greedily in the topological order matching the already selected parents only,
+     * so a layout chosen early may force the reorders on the rest of the graph. Each node switches to the descriptor of
+     * the same implementation type which minimizes the bytes reordered on its edges until no node improves. The total
+     * bytes decrease on each switch, so the refinement converges. The implementation priorities of the nodes are kept,
+     * the nodes working in place are excluded since their descriptors depend on the neighbours */
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto& node : graphNodes) {
+            if (one_of(node->getType(), Input, Output, Concatenation, Split))
+                continue;
+            const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+            if (!selectedPd || hasInPlacePorts(selectedPd->getConfig()))
+                continue;
+
+            const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+            const auto& selectedConfig = selectedPd->getConfig();
+            size_t bestBytes = getReorderBytes(node, selectedConfig);
+            int best = -1;
+            for (size_t i = 0; i < supportedPds.size() && bestBytes > 0; i++) {
+                const auto& config = supportedPds[i].getConfig();
+                if (&supportedPds[i] == selectedPd || supportedPds[i].getImplementationType() != selectedPd->getImplementationType() ||
+                    config.inConfs.size() != selectedConfig.inConfs.size() || config.outConfs.size() != selectedConfig.outConfs.size() ||
+                    hasInPlacePorts(config))
+                    continue;
+                const auto bytes = getReorderBytes(node, config);
+                if (bytes < bestBytes) {
+                    bestBytes = bytes;
+                    best = static_cast<int>(i);
+                }
+            }
+            if (best >= 0) {
+                node->selectPrimitiveDescriptorByIndex(best);
+                changed = true;
+            }
+        }
+    }
 }
 
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
@@ -397,8 +613,385 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+void MKLDNNGraph::RegisterTraceNames() {
+    traceIds.clear();
+    if (!tracer)
+        return;
+
+    for (const auto& node : graphNodes) {
+        const auto pd = node->getSelectedPrimitiveDescriptor();
+        traceIds[node.get()] = tracer->registerName(node->getName(), node->getTypeStr(),
+                                                    pd ? impl_type_to_string(pd->getImplementationType()) : "");
+    }
+}
+
+void MKLDNNGraph::InitVariableStorages() {
+    variableStorages.clear();
+    for (const auto& node : graphNodes) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+        if (!memoryNode)
+            IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+        variableStorages[memoryNode->getVariableName()] = memoryNode->getStorage();
+    }
+}
+
+// The stages are balanced by the amount of the memory accessed by the nodes, which is the reasonable estimation of
+// the execution time for the memory bound models.
+static size_t estimateExecutionCost(const MKLDNNNodePtr& node) {
+    if (one_of(node->getType(), Input, Output))
+        return 0;
+
+    size_t cost = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        cost += node->getParentEdgeAt(i)->getDesc().getCurrentMemSize();
+    }
+    std::unordered_set<int> outputPorts;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        if (outputPorts.insert(edge->getInputNum()).second)
+            cost += edge->getDesc().getCurrentMemSize();
+    }
+    return cost;
+}
+
+void MKLDNNGraph::SplitToPipelineStages() {
+    pipelineOrder.clear();
+    pipelineStages.clear();
+
+    const auto streams = config.streamExecutorConfig._streams;
+    if (!config.pipelinedStreams || streams < 2 || graphHasDynamicInput || config.batchLimit > 0)
+        return;
+
+    std::vector<MKLDNNNodePtr> nodes;
+    std::vector<size_t> costs;
+    size_t totalCost = 0;
+    for (const auto& node : graphNodes) {
+        // the states are kept between the inferences, so the requests can't be executed concurrently
+        if (one_of(node->getType(), MemoryInput, MemoryOutput))
+            return;
+        if (node->isConstant())
+            continue;
+
+        nodes.push_back(node);
+        costs.push_back(estimateExecutionCost(node));
+        totalCost += costs.back();
+    }
+
+    const size_t stagesNum = std::min(static_cast<size_t>(streams),
+                                      static_cast<size_t>(std::count_if(costs.begin(), costs.end(), [](size_t cost) { return cost != 0; })));
+    if (stagesNum < 2)
+        return;
+
+    // the stages are the contiguous parts of the topological order, so the data flows from the earlier stages only
+    size_t accumulatedCost = 0;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        size_t stage = std::min((accumulatedCost + costs[i] / 2) * stagesNum / totalCost, stagesNum - 1);
+        accumulatedCost += costs[i];
+        // the inputs are filled within the first stage and the outputs are read within the last one
+        if (nodes[i]->getType() == Input)
+            stage = 0;
+        else if (nodes[i]->getType() == Output)
+            stage = stagesNum - 1;
+        pipelineOrder[nodes[i].get()] = 2 * stage;
+    }
+
+    // The edges between the stages are cut by the copies executed on the stage transition, so the memory of each stage
+    // is accessed only by the request owning the stage. The edge crossing several stages is cut at each transition.
+    for (size_t transition = 0; transition + 1 < stagesNum; transition++) {
+        std::map<std::pair<const MKLDNNNode*, int>, MKLDNNNodePtr> copies;
+        const auto edges = graphEdges;
+        for (const auto& edge : edges) {
+            if (edge->isDropped())
+                continue;
+
+            const auto parent = edge->getParent();
+            const auto child = edge->getChild();
+            if (parent->isConstant() || GetPipelineStage(parent) > transition || GetPipelineStage(child) <= transition)
+                continue;
+
+            auto& copy = copies[{parent.get(), edge->getInputNum()}];
+            if (!copy) {
+                const std::string name = parent->getName() + "_pipeline_stage_" + std::to_string(transition + 1) + "_" +
+                                         std::to_string(edge->getInputNum());
+                copy = InsertReorder(edge, name, edge->getInputDesc(), edge->getInputDesc());
+                pipelineOrder[copy.get()] = 2 * (transition + 1) - 1;
+            } else {
+                const int childPort = edge->getOutputNum();
+                edge->drop();
+                MKLDNNEdgePtr newEdge(new MKLDNNEdge(copy, child, 0, childPort));
+                copy->addEdge(newEdge);
+                graphEdges.push_back(newEdge);
+            }
+        }
+        RemoveDroppedEdges();
+    }
+
+    SortTopologically();
+
+    // the topological order is kept by the stable sort since the data flows from the earlier stages only
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [this](const MKLDNNNodePtr& lhs, const MKLDNNNodePtr& rhs) {
+        const auto lhsOrder = pipelineOrder.find(lhs.get());
+        const auto rhsOrder = pipelineOrder.find(rhs.get());
+        return (lhsOrder == pipelineOrder.end() ? 0 : lhsOrder->second) < (rhsOrder == pipelineOrder.end() ? 0 : rhsOrder->second);
+    });
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        graphNodes[i]->execIndex = static_cast<int>(i);
+    }
+
+    pipelineStages = std::vector<PipelineStage>(stagesNum);
+}
+
+void MKLDNNGraph::InitPipelineStages() {
+    if (pipelineStages.empty())
+        return;
+
+    // the executable nodes are already grouped by the stages
+    size_t begin = 0;
+    for (size_t stage = 0; stage < pipelineStages.size(); stage++) {
+        auto isTransition = [&](size_t i) {
+            const auto order = pipelineOrder.find(executableGraphNodes[i].get());
+            return order != pipelineOrder.end() && order->second == 2 * stage - 1;
+        };
+        auto isStage = [&](size_t i) {
+            const auto order = pipelineOrder.find(executableGraphNodes[i].get());
+            return order == pipelineOrder.end() || order->second <= 2 * stage;
+        };
+
+        auto& pipelineStage = pipelineStages[stage];
+        pipelineStage.begin = begin;
+        size_t i = begin;
+        while (stage != 0 && i < executableGraphNodes.size() && isTransition(i))
+            i++;
+        pipelineStage.transitionEnd = i;
+        while (i < executableGraphNodes.size() && isStage(i))
+            i++;
+        pipelineStage.end = i;
+        begin = i;
+    }
+    if (begin != executableGraphNodes.size())
+        IE_THROW() << "Cannot split the graph " << _name << " to the pipeline stages";
+}
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+namespace {
+// Keeps the threads of the node arena on the CPUs of the stream executing the graph. The exclusive CPUs are given to
+// the threads one by one like the core binding of the stream does, otherwise each thread may run on any of the CPUs.
+class NodeArenaObserver : public tbb::task_scheduler_observer {
+public:
+    NodeArenaObserver(tbb::task_arena& arena, std::vector<int> cpus, bool exclusive)
+        : tbb::task_scheduler_observer(arena), cpus(std::move(cpus)), exclusive(exclusive) {
+        observe(true);
+    }
+
+    ~NodeArenaObserver() override {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        previousCpus() = affinity::getCurrentThreadCpus();
+        if (exclusive) {
+            const auto threadIdx = static_cast<size_t>(std::max(tbb::this_task_arena::current_thread_index(), 0));
+            affinity::pinCurrentThread({cpus[threadIdx % cpus.size()]});
+        } else {
+            affinity::pinCurrentThread(cpus);
+        }
+    }
+
+    void on_scheduler_exit(bool) override {
+        // the thread is returned to the stream arena or to the pool with the affinity it had
+        affinity::pinCurrentThread(previousCpus());
+    }
+
+private:
+    static std::vector<int>& previousCpus() {
+        static thread_local std::vector<int> previous;
+        return previous;
+    }
+
+    std::vector<int> cpus;
+    bool exclusive;
+};
+
+// the CPUs of the threads of the current arena, which are bound by the streams executor
+std::vector<int> getArenaCpus(int threadsNum) {
+    std::set<int> cpus;
+    std::mutex cpusMutex;
+    parallel_nt_static(threadsNum, [&](int, int) {
+        const auto threadCpus = affinity::getCurrentThreadCpus();
+        std::lock_guard<std::mutex> lock{cpusMutex};
+        cpus.insert(threadCpus.begin(), threadCpus.end());
+    });
+    return {cpus.begin(), cpus.end()};
+}
+}  // namespace
+#endif
+
+struct MKLDNNGraph::ParallelLevel {
+    size_t begin = 0;
+    size_t end = 0;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+    // declared after the arenas to stop observing before the arenas are destroyed
+    std::vector<std::unique_ptr<tbb::task_scheduler_observer>> observers;
+#endif
+    std::vector<mkldnn::stream> streams;
+};
+
+void MKLDNNGraph::SplitToParallelLevels() {
+    parallelLevelOf.clear();
+    parallelLevels.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches || IsPipelined() || graphHasDynamicInput || config.batchLimit > 0)
+        return;
+
+    for (const auto& node : graphNodes) {
+        // the states are kept between the inferences, so the order of the memory nodes matters
+        if (one_of(node->getType(), MemoryInput, MemoryOutput))
+            return;
+    }
+
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int level = 1;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            const auto parentLevel = parallelLevelOf.find(edge->getParent().get());
+            if (parentLevel != parallelLevelOf.end())
+                level = std::max(level, parentLevel->second + 1);
+
+            // the node writing to the memory of its input in-place keeps the order with the other nodes reading it
+            for (const auto& peer : edge->getParent()->getChildEdgesAtPort(edge->getInputNum())) {
+                const auto peerLevel = parallelLevelOf.find(peer->getChild().get());
+                if (peer != edge && peerLevel != parallelLevelOf.end() &&
+                    (edge->inPlace(MKLDNNEdge::LOOK_DOWN) || peer->inPlace(MKLDNNEdge::LOOK_DOWN)))
+                    level = std::max(level, peerLevel->second + 1);
+            }
+        }
+        parallelLevelOf[node.get()] = level;
+    }
+
+    // the topological order is kept by the stable sort since each node is placed to a later level than its parents
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [this](const MKLDNNNodePtr& lhs, const MKLDNNNodePtr& rhs) {
+        const auto lhsLevel = parallelLevelOf.find(lhs.get());
+        const auto rhsLevel = parallelLevelOf.find(rhs.get());
+        return (lhsLevel == parallelLevelOf.end() ? 0 : lhsLevel->second) < (rhsLevel == parallelLevelOf.end() ? 0 : rhsLevel->second);
+    });
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        graphNodes[i]->execIndex = static_cast<int>(i);
+    }
+#endif
+}
+
+void MKLDNNGraph::InitParallelLevels() {
+    if (parallelLevelOf.empty())
+        return;
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the graph is created by the stream which executes it
+    const int threadsNum = parallel_get_max_threads();
+
+    // The node arenas have their own threads, so they are bound to the CPUs of the stream the same way as the stream
+    // threads are: one CPU per thread with the core binding, any of the stream CPUs (e.g. of its NUMA node) otherwise.
+    // With the core binding the CPUs are split between the nodes like the threads are.
+    const auto bindingType = config.streamExecutorConfig._threadBindingType;
+    const bool exclusiveCpus = bindingType == IStreamsExecutor::ThreadBindingType::CORES;
+    const auto streamCpus = bindingType == IStreamsExecutor::ThreadBindingType::NONE ? std::vector<int>{}
+                                                                                      : getArenaCpus(threadsNum);
+
+    bool hasParallelNodes = false;
+    for (size_t begin = 0; begin < executableGraphNodes.size();) {
+        const int level = parallelLevelOf.at(executableGraphNodes[begin].get());
+        size_t end = begin + 1;
+        while (end < executableGraphNodes.size() && parallelLevelOf.at(executableGraphNodes[end].get()) == level)
+            end++;
+
+        auto parallelLevel = std::make_shared<ParallelLevel>();
+        parallelLevel->begin = begin;
+        parallelLevel->end = end;
+        if (end - begin > 1) {
+            hasParallelNodes = true;
+
+            std::vector<size_t> costs;
+            for (size_t i = begin; i < end; i++) {
+                costs.push_back(estimateExecutionCost(executableGraphNodes[i]));
+            }
+            const size_t totalCost = std::accumulate(costs.begin(), costs.end(), size_t(0));
+            size_t firstCpu = 0;
+            for (const auto cost : costs) {
+                // the threads are split between the nodes in proportion to the costs
+                const size_t share = std::max<size_t>(
+                    totalCost == 0 ? threadsNum / costs.size() : threadsNum * cost / totalCost, 1);
+                std::unique_ptr<tbb::task_arena> arena(new tbb::task_arena(static_cast<int>(share)));
+                if (!streamCpus.empty()) {
+                    std::vector<int> cpus = streamCpus;
+                    if (exclusiveCpus) {
+                        cpus.clear();
+                        for (size_t i = 0; i < share; i++)
+                            cpus.push_back(streamCpus[(firstCpu + i) % streamCpus.size()]);
+                        firstCpu += share;
+                    }
+                    // the arena is initialized to be observed before any thread joins it
+                    arena->initialize();
+                    parallelLevel->observers.emplace_back(new NodeArenaObserver(*arena, std::move(cpus), exclusiveCpus));
+                }
+                parallelLevel->arenas.push_back(std::move(arena));
+                parallelLevel->streams.emplace_back(eng);
+            }
+        }
+        parallelLevels.push_back(parallelLevel);
+        begin = end;
+    }
+
+    // there are no independent nodes, so the graph is executed sequentially
+    if (!hasParallelNodes)
+        parallelLevels.clear();
+#endif
+}
+
+void MKLDNNGraph::ExecuteParallelLevels(MKLDNNInferRequestBase* request, const mkldnn::stream& stream) const {
+    for (const auto& parallelLevel : parallelLevels) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (parallelLevel->end - parallelLevel->begin == 1) {
+            const auto& node = executableGraphNodes[parallelLevel->begin];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        tbb::task_group group;
+        for (size_t i = parallelLevel->begin; i < parallelLevel->end; i++) {
+            group.run([this, &parallelLevel, i] {
+                const auto idx = i - parallelLevel->begin;
+                parallelLevel->arenas[idx]->execute([&] {
+                    const auto& node = executableGraphNodes[i];
+                    VERBOSE(node, config.verbose);
+                    PERF(node, config.collectPerfCounters);
+                    ExecuteNode(node, parallelLevel->streams[idx]);
+                });
+            });
+        }
+        group.wait();
+#endif
+    }
+}
+
+size_t MKLDNNGraph::GetPipelineStage(const MKLDNNNodePtr& node) const {
+    const auto order = pipelineOrder.find(node.get());
+    return order == pipelineOrder.end() ? 0 : (order->second + 1) / 2;
+}
+
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
+    ov::load_time_stats::Scope scope{"cpu_graph/constant_nodes"};
     mkldnn::stream stream(eng);
 
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
@@ -412,7 +1005,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->getExternalKey());
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -585,6 +1178,69 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+std::string MKLDNNGraph::getConstantKey(const MKLDNNEdgePtr& edge) const {
+    // the output of the constant subgraph is identified by the content of the constants it's computed from and by the
+    // nodes computing it, so the models sharing the weights share the computed (e.g. reordered) weights as well.
+    // The nodes are listed in the post order referring to the inputs by the indices, so the key reflects the structure
+    auto descKey = [](const MemoryDesc& desc) {
+        return desc.getPrecision().name() + std::string(",") + desc.getShape().toString() + "," +
+               desc.serializeFormat();
+    };
+    auto nodeKey = [](const MKLDNNNodePtr& node) {
+        return node->getTypeStr() + "," + std::to_string(static_cast<int>(node->getAlgorithm())) + "," +
+               node->getAttributesKey();
+    };
+
+    // the weights cache is shared by the models, so the output which can't be identified stays within the graph
+    const auto unsharedKey = edge->name() + "_graph" + std::to_string(reinterpret_cast<uintptr_t>(this));
+
+    std::string key = edge->name();
+    std::unordered_map<MKLDNNNode*, size_t> indices;
+    // the node and whether its inputs are listed already
+    std::vector<std::pair<MKLDNNNodePtr, bool>> nodes{{edge->getParent(), false}};
+    while (!nodes.empty()) {
+        auto node = nodes.back().first;
+        const bool inputsListed = nodes.back().second;
+        nodes.pop_back();
+        if (indices.count(node.get()))
+            continue;
+        if (!inputsListed && node->getType() != Input) {
+            nodes.emplace_back(node, true);
+            for (size_t i = node->getParentEdges().size(); i > 0; i--)
+                nodes.emplace_back(node->getParentEdgeAt(i - 1)->getParent(), false);
+            continue;
+        }
+
+        key += ";";
+        if (node->getType() == Input) {
+            const auto& weightsKey = std::static_pointer_cast<MKLDNNInputNode>(node)->getWeightsKey();
+            if (weightsKey.empty())
+                return unsharedKey;
+            key += weightsKey;
+        } else {
+            if (node->hasIncompleteAttributes())
+                return unsharedKey;
+            key += nodeKey(node);
+            for (const auto& fused : node->getFusedWith()) {
+                if (fused->hasIncompleteAttributes())
+                    return unsharedKey;
+                key += "+" + nodeKey(fused);
+            }
+            // the inputs are referred by the node index, the output port and the memory descriptor
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                const auto parentEdge = node->getParentEdgeAt(i);
+                key += "," + std::to_string(indices.at(parentEdge->getParent().get())) + ":" +
+                       std::to_string(parentEdge->getInputNum()) + ":" + descKey(parentEdge->getDesc());
+            }
+        }
+        const size_t index = indices.size();
+        indices[node.get()] = index;
+    }
+    // the computed weights layout depends on the model, e.g. on the input shapes the primitives are chosen for
+    key += ";" + std::to_string(edge->getInputNum()) + ":" + descKey(edge->getDesc());
+    return key;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -600,7 +1256,7 @@ void MKLDNNGraph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<MKLDNNInputNode>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<MKLDNNMemory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(weightsCache);
+                    edge->externalAllocate(weightsCache, getConstantKey(edge));
                 }
                 erase = true;
             }
@@ -618,19 +1274,29 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // the nodes of a parallel level are executed concurrently, so the memory is reused only between the levels
+    auto getExecTime = [this](const MKLDNNNodePtr& node) {
+        const auto level = parallelLevelOf.find(node.get());
+        return level == parallelLevelOf.end() ? node->execIndex : level->second;
+    };
+
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
+    // the memory is reused only within a pipeline stage, since the stages are executed concurrently
+    std::vector<size_t> boxStages(edge_clusters.size(), 0);
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecTime(edge->getParent());
+            int e_finish = getExecTime(edge->getChild());
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
             }
 
             int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
+            if (e_start < box.start)
+                boxStages[i] = GetPipelineStage(edge->getParent());
             box.start = std::min(e_start, box.start);
             box.finish = std::max(e_finish, box.finish);
             box.size =  std::max(e_size, box.size);
@@ -659,8 +1325,26 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    std::vector<int64_t> offsets(boxes.size());
+    int64_t total_blocks = 0;
+    const size_t stagesNum = std::max<size_t>(pipelineStages.size(), 1);
+    for (size_t stage = 0; stage < stagesNum; stage++) {
+        std::vector<MemorySolver::Box> stageBoxes;
+        for (size_t i = 0; i < boxes.size(); i++) {
+            if (boxStages[i] == stage)
+                stageBoxes.push_back(boxes[i]);
+        }
+        if (stageBoxes.empty())
+            continue;
+
+        MemorySolver memSolver(stageBoxes);
+        const int64_t stage_blocks = memSolver.solve();
+        for (const auto& box : stageBoxes) {
+            offsets[box.id] = total_blocks + memSolver.getOffset(static_cast<int>(box.id));
+        }
+        total_blocks += stage_blocks;
+    }
+    size_t total_size = static_cast<size_t>(total_blocks) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
@@ -674,7 +1358,7 @@ void MKLDNNGraph::AllocateWithReuse() {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int64_t offset = offsets[i];
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
                 edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
@@ -692,6 +1376,104 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::AllocateDynamicEdges() {
+    dynamicArena.reset();
+    outputMemoryMngrs.clear();
+
+    // the root edge (which allocates memory) of each cluster and all the edges sharing its memory
+    std::vector<std::pair<MKLDNNEdgePtr, std::vector<MKLDNNEdgePtr>>> clusters;
+    std::unordered_map<MKLDNNEdgePtr, size_t> clusterIndices;
+    for (auto& edge : graphEdges) {
+        auto root = edge;
+        while (root->getStatus() == MKLDNNEdge::Status::NotAllocated) {
+            auto sharedEdge = root->getSharedEdge(std::nothrow);
+            if (!sharedEdge)
+                break;
+            root = sharedEdge;
+        }
+        // the edges with defined upper bound are placed by the memory solver
+        if (root->getStatus() != MKLDNNEdge::Status::NeedAllocation || root->hasDefinedMaxSize())
+            continue;
+
+        auto clusterIt = clusterIndices.find(root);
+        if (clusterIt == clusterIndices.end()) {
+            clusterIt = clusterIndices.emplace(root, clusters.size()).first;
+            clusters.emplace_back(root, std::vector<MKLDNNEdgePtr>{});
+        }
+        if (edge != root)
+            clusters[clusterIt->second].second.push_back(edge);
+    }
+
+    std::vector<MemorySolver::Box> boxes;
+    std::vector<MKLDNNEdgePtr> roots;
+    for (auto& cluster : clusters) {
+        auto& edges = cluster.second;
+        edges.push_back(cluster.first);
+
+        // The arena memory is moved between inferences, so the clusters holding data across inferences
+        // (constants, graph inputs and outputs, states) are allocated separately.
+        bool isArenaCompatible = true;
+        bool isOutputBindable = true;
+        MKLDNNNodePtr outputNode;
+        MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(boxes.size()) };
+        for (auto& edge : edges) {
+            const auto parent = edge->getParent();
+            const auto child = edge->getChild();
+            if (parent->isConstant() || one_of(parent->getType(), Input, MemoryInput) || child->getType() == MemoryOutput) {
+                isArenaCompatible = false;
+                isOutputBindable = false;
+            } else if (child->getType() == Output) {
+                isArenaCompatible = false;
+                // the memory may be bound to the only user output buffer
+                isOutputBindable = isOutputBindable && !outputNode;
+                outputNode = child;
+            }
+            box.start = std::min(parent->execIndex, box.start);
+            box.finish = std::max(child->execIndex, box.finish);
+        }
+
+        if (isArenaCompatible) {
+            boxes.push_back(box);
+            roots.push_back(cluster.first);
+        } else if (isOutputBindable && outputNode) {
+            auto outputName = std::find_if(outputNodesMap.begin(), outputNodesMap.end(),
+                                           [&](const std::pair<const std::string, MKLDNNNodePtr>& output) {
+                                               return output.second == outputNode;
+                                           });
+            if (outputName == outputNodesMap.end())
+                continue;
+            auto mngr = new MemoryMngrWithExternalAllocator();
+            auto dnnlMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(mngr));
+            cluster.first->allocate(dnnlMngr);
+            outputMemoryMngrs[outputName->first] = {dnnlMngr, mngr};
+        }
+    }
+
+    if (boxes.empty())
+        return;
+
+    dynamicArena = std::make_shared<DynamicMemoryArena>(std::move(boxes));
+    for (size_t i = 0; i < roots.size(); i++) {
+        roots[i]->allocate(dynamicArena->createMemoryMngr(i));
+    }
+}
+
+bool MKLDNNGraph::BindOutputAllocator(const std::string& name, MemoryMngrWithExternalAllocator::Allocator allocator) {
+    auto output = outputMemoryMngrs.find(name);
+    if (output == outputMemoryMngrs.end())
+        return false;
+
+    auto owner = output->second.first.lock();
+    if (!owner)
+        return false;
+
+    const auto& desc = getOutputNodeByName(name)->getParentEdgeAt(0)->getMemory().getDesc();
+    const size_t size = desc.isDefined() ? desc.getCurrentMemSize() : 0;
+    if (output->second.second->setAllocator(std::move(allocator), size))
+        owner->notifyUpdate();
+    return true;
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -703,6 +1485,10 @@ void MKLDNNGraph::Allocate() {
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
+    // Place the dynamic edges with unknown upper bound to the grow-only arena,
+    // the dynamic outputs memory may be bound to the user buffers
+    AllocateDynamicEdges();
+
     // Create dummy memory with undefined desc for edges that are need allocation but has not been allocated withing mem solver
     for (auto& edge : graphEdges) edge->allocate();
 
@@ -711,14 +1497,281 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    UpdateActivationsBytes();
+}
+
+void MKLDNNGraph::UpdateActivationsBytes() {
+    dynamicActivationsBytes = dynamicArena ? dynamicArena->getSize() : 0;
+    const size_t bytes = (memWorkspace ? memWorkspace->GetSize() : 0) + dynamicActivationsBytes;
+    if (bytes > activationsPeak)
+        activationsPeak = bytes;
+}
+
+MKLDNNGraph::MemoryUsage MKLDNNGraph::GetMemoryUsage() const {
+    MemoryUsage usage;
+    if (status != Ready)
+        return usage;
+
+    // the constant memory isn't changed by the inference, the constants shared by several edges are counted once
+    for (const auto& edge : graphEdges) {
+        if (!edge->getParent()->isConstant())
+            continue;
+        const auto& memory = edge->getMemoryPtr();
+        if (!memory || !memory->isAllocated())
+            continue;
+        auto& bytes = usage.weights[memory->GetData()];
+        bytes = std::max(bytes, memory->GetSize());
+    }
+
+    if (memWorkspace && memWorkspace->GetSize())
+        usage.activations[memWorkspace->GetData()] = memWorkspace->GetSize();
+    usage.dynamicActivations = dynamicActivationsBytes;
+
+    // the dynamic inputs and outputs are in the arena, only the static ones are counted separately
+    auto addIoBytes = [&usage](const MKLDNNEdgePtr& edge) {
+        if (!edge->getParent()->isConstant() && edge->getDesc().isDefined())
+            usage.io += edge->getDesc().getCurrentMemSize();
+    };
+    for (const auto& input : inputNodesMap) {
+        if (!input.second->getChildEdges().empty())
+            addIoBytes(input.second->getChildEdgeAt(0));
+    }
+    for (const auto& output : outputNodesMap) {
+        if (!output.second->getParentEdges().empty())
+            addIoBytes(output.second->getParentEdgeAt(0));
+    }
+    return usage;
 }
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // The primitives of the static nodes are compiled here, the JIT kernels including. Allocate() has already run, so
+    // the edges memory (descs, managers and in-place views) is complete and is only read by the nodes here: e.g. the
+    // static nodes prepare the parameters from the memory of their edges, MKLDNNMemoryInputNode creates its data
+    // store by the desc of its child edge memory. A node writes only its own state (the state store is zero filled),
+    // the constness of the nodes is resolved in advance, and the weights and runtime caches shared by the nodes are
+    // locked. The constant subgraphs are executed after all the primitives are created, so no node may read the
+    // computed constant values here
+    ov::load_time_stats::Scope scope{"cpu_graph/create_primitives"};
+    parallelForNodes(graphNodes, [](const MKLDNNNodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
+    });
+}
+
+// Creates a view to the leading part of the planar memory with the given dims not greater than the memory dims
+static MKLDNNMemoryPtr makePlanarSubView(const MKLDNNMemory& mem, const VectorDims& dims) {
+    const auto desc = mem.GetDescWithType<BlockedMemoryDesc>();
+    const auto viewDesc = std::make_shared<CpuBlockedMemoryDesc>(desc->getPrecision(), Shape(dims), dims, desc->getOrder(),
+                                                                 0, VectorDims(dims.size(), 0), desc->getStrides());
+    auto view = std::make_shared<MKLDNNMemory>(mem.getEngine());
+    view->Create(viewDesc, mem.GetData(), false);
+    return view;
+}
+
+namespace {
+enum class TailSafety {
+    Unsafe,    // the valid outputs depend on the tails
+    Safe,      // the valid outputs don't depend on the tails, the tails of the outputs may be any
+    ZeroTail,  // the valid outputs don't depend on the tails, the tails of the outputs stay zero
+};
+
+// Tells how the node treats the tails of its padded inputs. The element-wise nodes keep the positions of the axes, so
+// any tails are safe for them, but only some of them (e.g. Multiply, Relu) keep the tails zero. The zero tails are
+// neutral to the sums of MatMul and FullyConnected and equal to the implicit zero padding of Convolution, so these
+// nodes are safe only for the zero tails. The outputs of MatMul and FullyConnected keep the tails zero without the bias
+// and the fused operations, the windows of Convolution mix the valid values into the output tails. The strided and the
+// auto padded convolutions change their windows or pads with the input dims, so the valid outputs would be shifted.
+// E.g. Softmax, pooling or reductions along the padded axis mix the tails into the valid values.
+TailSafety getTailSafety(const MKLDNNNodePtr& node, bool zeroTails, bool hasNotPaddedInputs) {
+    switch (node->getType()) {
+    case Output:
+    case Subgraph:
+        return TailSafety::Safe;
+    case Convert:
+    case Reorder:
+    case Transpose:
+        return zeroTails ? TailSafety::ZeroTail : TailSafety::Safe;
+    case Eltwise: {
+        // the not padded inputs are broadcast to the tails
+        const bool keepsZeros = node->getFusedWith().empty() &&
+            (one_of(node->getAlgorithm(), EltwiseMultiply, EltwiseRelu) ||
+             (one_of(node->getAlgorithm(), EltwiseAdd, EltwiseSubtract) && !hasNotPaddedInputs));
+        return zeroTails && keepsZeros ? TailSafety::ZeroTail : TailSafety::Safe;
+    }
+    case MatMul:
+    case FullyConnected: {
+        if (!zeroTails)
+            return TailSafety::Unsafe;
+        const bool withBias = node->getType() == FullyConnected && node->getParentEdges().size() > 2;
+        return node->getFusedWith().empty() && !withBias ? TailSafety::ZeroTail : TailSafety::Safe;
+    }
+    case Convolution: {
+        const auto conv = std::dynamic_pointer_cast<MKLDNNConvolutionNode>(node);
+        if (!zeroTails || !conv || conv->isAutoPadding())
+            return TailSafety::Unsafe;
+        const auto& strides = conv->getStride();
+        const bool strided = std::any_of(strides.begin(), strides.end(), [](size_t stride) { return stride != 1; });
+        return strided ? TailSafety::Unsafe : TailSafety::Safe;
+    }
+    default:
+        return TailSafety::Unsafe;
+    }
+}
+}  // namespace
+
+void MKLDNNGraph::InitShapeBuckets() {
+    paddedIO.clear();
+    unpaddedInputDims.clear();
+    if (!graphHasDynamicInput || config.shapeBuckets.empty()) {
+        return;
+    }
+
+    // the padded inputs and cropped outputs are accessed through strided views, so only planar memory is supported
+    auto isPlanar = [](const MKLDNNEdgePtr& edge) {
+        return edge->getMemory().getDesc().hasLayoutType(LayoutType::ncsp);
+    };
+
+    std::unordered_set<std::string> paddedOutputs;
+    for (const auto& output : outputNodesMap) {
+        const auto& node = output.second;
+        if (node->isDynamicNode()) {
+            if (!isPlanar(node->getParentEdgeAt(0)))
+                return;
+            paddedOutputs.insert(output.first);
+        }
+    }
+
+    std::vector<MKLDNNNodePtr> paddedPath;
+    std::unordered_set<std::string> paddedInputs;
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        if (!node->isDynamicNode() || node->getChildEdges().empty() || !isPlanar(node->getChildEdgeAt(0)))
+            continue;
+        if (!_normalizePreprocMap.count(input.first)) {
+            paddedInputs.insert(input.first);
+            paddedPath.push_back(node);
+        }
+    }
+
+    // There are no tail masks, so the inputs are padded only if all the nodes consuming the padded data are tail safe.
+    // The padded inputs have the zero tails, whether the tails stay zero is propagated in the topological order.
+    std::unordered_map<const MKLDNNNode*, bool> zeroTailOf;
+    for (const auto& node : paddedPath)
+        zeroTailOf[node.get()] = true;
+    for (const auto& node : graphNodes) {
+        if (zeroTailOf.count(node.get()))
+            continue;
+
+        bool hasPaddedInputs = false;
+        bool hasNotPaddedInputs = false;
+        bool zeroTails = true;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto zeroTail = zeroTailOf.find(node->getParentEdgeAt(i)->getParent().get());
+            if (zeroTail == zeroTailOf.end()) {
+                hasNotPaddedInputs = true;
+            } else {
+                hasPaddedInputs = true;
+                zeroTails = zeroTails && zeroTail->second;
+            }
+        }
+        if (!hasPaddedInputs)
+            continue;
+
+        const auto safety = getTailSafety(node, zeroTails, hasNotPaddedInputs);
+        if (safety == TailSafety::Unsafe) {
+            NGRAPH_DEBUG << "CPU plugin: the shape buckets are disabled, " << node->getName() << " isn't tail safe";
+            return;
+        }
+        zeroTailOf[node.get()] = safety == TailSafety::ZeroTail;
+    }
+
+    paddedIO.insert(paddedInputs.begin(), paddedInputs.end());
+    paddedIO.insert(paddedOutputs.begin(), paddedOutputs.end());
+}
+
+VectorDims MKLDNNGraph::PadInputDims(const std::string& name, const VectorDims& dims) {
+    if (!IsPaddedIO(name) || !inputNodesMap.count(name))
+        return dims;
+
+    const auto& shape = inputNodesMap[name]->getOutputShapeAtPort(0);
+    const auto& minDims = shape.getMinDims();
+    const auto& maxDims = shape.getMaxDims();
+    if (dims.size() != maxDims.size())
+        return dims;
+
+    VectorDims padded(dims);
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (minDims[i] == maxDims[i])
+            continue;
+        padded[i] = config.shapeBuckets.roundUp(dims[i], maxDims[i]);
     }
+    if (padded != dims)
+        unpaddedInputDims[name] = dims;
+    return padded;
+}
+
+std::unordered_map<const MKLDNNEdge*, VectorDims> MKLDNNGraph::InferUnpaddedDims() const {
+    // the dims of the edges which differ from the executed ones if the inputs aren't padded
+    std::unordered_map<const MKLDNNEdge*, VectorDims> unpadded;
+    for (const auto& input : unpaddedInputDims) {
+        const auto& node = inputNodesMap.at(input.first);
+        for (const auto& edge : node->getChildEdgesAtPort(0))
+            unpadded[edge.get()] = input.second;
+    }
+
+    // graphNodes are sorted topologically, so the dims are propagated from the inputs by the shape inference of the nodes
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Input || node->getType() == Output || !node->shapeInference)
+            continue;
+
+        const auto& ranks = node->shapeInference->get_input_ranks();
+        std::vector<Shape> shapes;
+        uint32_t changedPorts = 0;
+        for (size_t port = 0; port < ranks.size() && port < node->getParentEdges().size(); port++) {
+            const auto edge = node->getParentEdgesAtPort(port)[0];
+            const auto found = unpadded.find(edge.get());
+            if (found != unpadded.end())
+                changedPorts |= 1u << port;
+            shapes.emplace_back(ranks[port] == 0 ? VectorDims{} : found != unpadded.end() ? found->second : edge->getMemory().getStaticDims());
+        }
+        if (!changedPorts)
+            continue;
+
+        // the values of the padded data don't define the unpadded shapes, so such outputs aren't cropped
+        const auto valuesMask = node->getShapeInferValuesMask();
+        if (valuesMask & changedPorts)
+            continue;
+
+        std::vector<VectorDims> outDims;
+        try {
+            outDims = node->shapeInferGeneric(shapes, valuesMask);
+        } catch (...) {
+            continue;
+        }
+        for (size_t port = 0; port < outDims.size() && port < node->outputShapes.size(); port++) {
+            for (const auto& edge : node->getChildEdgesAtPort(port)) {
+                if (edge->getMemory().getStaticDims() != outDims[port])
+                    unpadded[edge.get()] = outDims[port];
+            }
+        }
+    }
+    return unpadded;
+}
+
+bool MKLDNNGraph::IsInputNormalizedOnPush(const std::string& name, const InferenceEngine::TensorDesc& desc) const {
+    if (!_normalizePreprocMap.count(name) || desc.getPrecision() != Precision::U8 || !one_of(desc.getLayout(), NCHW, NHWC))
+        return false;
+
+    auto input = inputNodesMap.find(name);
+    if (input == inputNodesMap.end() || input->second->isDynamicNode() || input->second->getChildEdges().empty())
+        return false;
+
+    const auto& memDesc = input->second->getChildEdgeAt(0)->getMemory().getDesc();
+    return memDesc.getPrecision() == Precision::FP32 &&
+           (memDesc.hasLayoutType(LayoutType::ncsp) || memDesc.hasLayoutType(LayoutType::nspc)) &&
+           memDesc.getShape().getStaticDims() == desc.getDims();
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -731,6 +1784,15 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         auto childEdge = node->getChildEdgeAt(0);
         const auto& outDims = node->getOutputShapeAtPort(0);
 
+        if (IsInputNormalizedOnPush(name, inTensorDesc)) {
+            // the conversion, the layout change and the normalization are done in a single pass over the image
+            auto& mem = childEdge->getMemory();
+            const auto outLayout = mem.getDesc().hasLayoutType(LayoutType::ncsp) ? NCHW : NHWC;
+            _normalizePreprocMap[name].NormalizeImage(outDims, in->cbuffer().as<const uint8_t *>(), inTensorDesc.getLayout(),
+                                                      reinterpret_cast<float *>(mem.GetData()), outLayout);
+            return;
+        }
+
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = childEdge->getMemory().GetData();
 
@@ -740,7 +1802,14 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             MKLDNNMemory ext_mem(eng);
             ext_mem.Create(ext_tdesc, ext_data_ptr, false);
 
-            childEdge->getMemory().SetData(ext_mem, 0, false);
+            const auto& inDims = inTensorDesc.getDims();
+            if (node->isDynamicNode() && childEdge->getMemory().getStaticDims() != inDims) {
+                // the input is padded up to the shape bucket, so the data is copied to its leading part and the tails are zeroed
+                childEdge->getMemoryPtr()->FillZero();
+                makePlanarSubView(childEdge->getMemory(), inDims)->SetData(ext_mem, 0, false);
+            } else {
+                childEdge->getMemory().SetData(ext_mem, 0, false);
+            }
         }
 
         // todo: make sure 'name' exists in this map...
@@ -761,6 +1830,8 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
+    const auto unpaddedDims = unpaddedInputDims.empty() ? std::unordered_map<const MKLDNNEdge*, VectorDims>{} : InferUnpaddedDims();
+
     for (auto &outputMap : outputNodesMap) {
         auto name = outputMap.first;
         auto node = outputMap.second;
@@ -789,7 +1860,18 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
                              std::accumulate(actualDesc.getDims().begin(), actualDesc.getDims().end(), (size_t)1, std::multiplies<size_t>()) == 1);
         }
 
-        const auto &outDims = intr_blob.getStaticDims();
+        auto outDims = intr_blob.getStaticDims();
+        bool isCropped = false;
+        const auto croppedDims = unpaddedDims.find(parentEdge.get());
+        if (croppedDims != unpaddedDims.end() && IsPaddedIO(name)) {
+            // the output is cropped to the dims it has with the original input dims, if they are a leading part of it
+            const auto& dims = croppedDims->second;
+            isCropped = dims.size() == outDims.size() &&
+                        std::equal(dims.begin(), dims.end(), outDims.begin(), [](Dim lhs, Dim rhs) { return lhs <= rhs; });
+            if (isCropped)
+                outDims = dims;
+        }
+
         if (out[name]->getTensorDesc().getDims() != outDims && !isScalarOutput) {
             // WA: because input/output info initially contains non empty dims, order etc.
             // and setDims (called inside setShape) can't correct modify blocked desc for desc with blocked layout
@@ -807,6 +1889,17 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         auto srcPrec = actualDesc.getPrecision();
         auto dstPrec = expectedDesc.getPrecision();
 
+        if (isCropped) {
+            auto outBlobDesc = expectedDesc.getLayout() == InferenceEngine::Layout::ANY
+                                ? DnnlBlockedMemoryDesc(expectedDesc.getPrecision(), Shape(outDims))
+                                : MemoryDescUtils::convertToDnnlBlockedMemoryDesc(expectedDesc);
+            MKLDNNMemory outBloMem(eng);
+            outBloMem.Create(outBlobDesc, ext_blob->buffer(), false);
+
+            outBloMem.SetData(*makePlanarSubView(intr_blob, outDims), 0, false);
+            continue;
+        }
+
         if (srcPrec == dstPrec && ext_blob->byteSize() != intr_blob.GetSize())
                 IE_THROW() << "Output blob byte size is not equal network output byte size ("
                                    << ext_blob->byteSize() << "!=" << intr_blob.GetSize() << ").";
@@ -844,15 +1937,24 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
-inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const {
+inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream,
+                                     const std::vector<VectorDims>* outputShapes) const {
     DUMP(node, config, infer_count);
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
 
+    const auto traceStart = tracer ? tracer->now() : 0;
+
     if (node->isDynamicNode()) {
-        node->executeDynamic(stream);
+        node->executeDynamic(stream, outputShapes);
     } else {
         node->execute(stream);
     }
+
+    if (tracer) {
+        const auto traceId = traceIds.find(node.get());
+        if (traceId != traceIds.end())
+            tracer->record(traceId->second, traceStart, tracer->now());
+    }
 }
 
 void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request, int batch) {
@@ -862,18 +1964,238 @@ void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (dynamicArena && dynamicArena->relayout()) {
+        // the memory of the dynamic edges was moved, so the nodes must not reuse the pointers kept in the prepared params
+        for (const auto& node : executableGraphNodes) {
+            if (node->isDynamicNode())
+                node->lastInputDims.clear();
+        }
+        UpdateActivationsBytes();
+    }
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+    ShapesPlanKey planKey;
+    std::shared_ptr<ShapesPlan> plan;
+    if (shapesPlanCache) {
+        planKey = GetShapesPlanKey();
+        plan = shapesPlanCache->get(planKey);
+    }
+
+    if (!parallelLevels.empty()) {
+        ExecuteParallelLevels(request, stream);
+    } else {
+        for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+            const auto& node = executableGraphNodes[i];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream, plan ? &(*plan)[i] : nullptr);
+        }
+    }
+
+    if (shapesPlanCache && !plan) {
+        RecordShapesPlan(planKey);
+    }
+
+    if (infer_count != -1) infer_count++;
+}
+
+void MKLDNNGraph::InferStatic(const mkldnn::stream& stream) {
+    if (!parallelLevels.empty()) {
+        ExecuteParallelLevels(nullptr, stream);
+    } else {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream);
+        }
+    }
+
+    if (infer_count != -1) infer_count++;
+}
+
+bool MKLDNNGraph::IsInputMemoryRebindable(const MKLDNNNodePtr& inputNode) {
+    for (auto& childEdge : inputNode->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << inputNode->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant())
+            return false;
+
+        if (child->getType() == Concatenation) {
+            auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool MKLDNNGraph::IsOutputMemoryRebindable(const MKLDNNNodePtr& outputNode) {
+    auto parentEdge = outputNode->getParentEdgeAt(0);
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+void MKLDNNGraph::InferPipelined(MKLDNNInferRequestBase* request, const std::function<void()>& pushInputs,
+                                 const std::function<void()>& pullOutputs) {
+    if (!IsReady()) {
+        IE_THROW() << "Wrong state. Topology is not ready.";
+    }
+
+    mkldnn::stream stream(eng);
+
+    auto execute = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const auto& node = executableGraphNodes[i];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
+    };
+
+    std::unique_lock<std::mutex> stageLock(pipelineStages.front().mutex);
+    pushInputs();
+    for (size_t stage = 0; stage < pipelineStages.size(); stage++) {
+        auto& pipelineStage = pipelineStages[stage];
+        if (stage != 0) {
+            // the next stage is acquired before the current one is released, so the requests never overtake each other
+            // and the transition nodes read the data of the previous stage while it's still owned
+            std::unique_lock<std::mutex> prevStageLock(std::move(stageLock));
+            stageLock = std::unique_lock<std::mutex>(pipelineStage.mutex);
+            execute(pipelineStage.begin, pipelineStage.transitionEnd);
+        }
+        execute(pipelineStage.transitionEnd, pipelineStage.end);
     }
+    pullOutputs();
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::InitShapesPlanCache() {
+    // enough to cover the typical clusters of the input shapes (e.g. sequence lengths)
+    constexpr size_t shapesPlanCacheCapacity = 64;
+
+    shapesPlanCache.reset();
+    if (!graphHasDynamicInput || config.rtCacheCapacity == 0) {
+        return;
+    }
+
+    // The recorded output shapes may be reused only if the shapes of each node are defined by the graph input shapes.
+    // That is true when all the data values the nodes shape inference depends on are either constant or computed from
+    // the shapes only (e.g. ShapeOf subgraphs).
+    std::unordered_map<const MKLDNNNode*, bool> valuesDefinedByShapes;
+    for (const auto& node : graphNodes) {
+        bool definedByShapes = node->isConstant() || node->getType() == ShapeOf;
+        if (!definedByShapes && !one_of(node->getType(), Input, MemoryInput)) {
+            definedByShapes = true;
+            for (size_t i = 0; i < node->getParentEdges().size() && definedByShapes; i++) {
+                definedByShapes = valuesDefinedByShapes[node->getParentEdgeAt(i)->getParent().get()];
+            }
+        }
+        valuesDefinedByShapes[node.get()] = definedByShapes;
+
+        if (!node->isDynamicNode())
+            continue;
+
+        const auto valuesMask = node->getShapeInferValuesMask();
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            const auto port = edge->getOutputNum();
+            const bool dependsOnValues = valuesMask == MKLDNNNode::ALL_PORTS_MASK || (port < 32 && (valuesMask & PortMask(port)));
+            if (dependsOnValues && !valuesDefinedByShapes[edge->getParent().get()]) {
+                return;
+            }
+        }
+    }
+
+    shapesPlanCache = std::make_shared<ShapesPlanCache>(shapesPlanCacheCapacity);
+}
+
+size_t MKLDNNGraph::ShapesPlanKey::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
+bool MKLDNNGraph::ShapesPlanKey::operator==(const ShapesPlanKey& rhs) const {
+    return inputDims == rhs.inputDims;
+}
+
+MKLDNNGraph::ShapesPlanKey MKLDNNGraph::GetShapesPlanKey() const {
+    ShapesPlanKey key;
+    key.inputDims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        if (node->isDynamicNode() && !node->getChildEdges().empty()) {
+            key.inputDims.push_back(node->getChildEdgeAt(0)->getMemory().getStaticDims());
+        }
+    }
+    return key;
+}
+
+void MKLDNNGraph::RecordShapesPlan(const ShapesPlanKey& key) {
+    auto plan = std::make_shared<ShapesPlan>(executableGraphNodes.size());
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto& node = executableGraphNodes[i];
+        if (!node->isDynamicNode())
+            continue;
+        auto& outputDims = (*plan)[i];
+        outputDims.reserve(node->outputShapes.size());
+        for (size_t port = 0; port < node->outputShapes.size(); port++) {
+            outputDims.push_back(node->getChildEdgesAtPort(port)[0]->getMemory().getStaticDims());
+        }
+    }
+    shapesPlanCache->put(key, plan);
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1256,29 +2578,85 @@ void MKLDNNGraph::EnforceBF16() {
         searchForNodesToSkip(node, nodesToSkip);
     }
 
+    /* The auto mixed precision additionally keeps in FP32 the nodes which accuracy suffers from BF16 most:
+     * the normalizations computing the statistics, the inputs of the softmax and the last projections before the outputs */
+    std::unordered_set<MKLDNNNodePtr> sensitiveNodes;
+    if (config.bf16AutoMixedPrecision) {
+        for (const auto& node : graphNodes) {
+            if (one_of(node->getType(), Softmax, LogSoftmax)) {
+                sensitiveNodes.insert(node);
+                for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                    const auto& parent = node->getParentEdgeAt(i)->getParent();
+                    if (parent->getType() != Input)
+                        sensitiveNodes.insert(parent);
+                }
+            } else if (node->getType() == MVN) {
+                sensitiveNodes.insert(node);
+            }
+        }
+        // the graph tail is kept in FP32 anyway, the significant nodes it starts from are the last projections
+        for (const auto& node : graphNodes) {
+            if (!nodesToSkip.count(node) && node->getType() != Output)
+                continue;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                const auto& parent = node->getParentEdgeAt(i)->getParent();
+                if (one_of(parent->getType(), FullyConnected, MatMul))
+                    sensitiveNodes.insert(parent);
+            }
+        }
+    }
+
+    bf16PrecisionMap.clear();
     for (const auto& node : graphNodes) {
-        if (nodesToSkip.count(node) && !node->enforceBF16evenForGraphTail)
+        if (node->getType() == Input || node->getType() == Output)
             continue;
 
-        if (node->getType() != Input && node->getType() != Output) {
-            for (size_t i = 0; i < node->getOriginalInputsNumber(); i++) {
-                const auto &parent = node->getParentEdgesAtPort(i)[0]->getParent();
-                /* Skip BF16 enforcement for nodes after Constant Inputs for maintaining precision for fusing.
-                 * Precision conversion to BF16 does automatically, if convolution follows up after Constant Inputs
-                 * and if activation is BF16 */
-                if (!(parent->getType() == Input && parent->isConstant() &&
-                      node->getType() != Concatenation) && // Concatenation node is exception because it doesn't change an accuracy for BF16 activation
-                    !(parent->getType() == Input && node->getType() == Eltwise) && // exclude Eltwise after Input since it supports conversion to BF16
-                    node->getOriginalInputPrecisionAtPort(i) == Precision::FP32)
-                    node->setOriginalInputPrecisionAtPort(i, Precision::BF16);
-            }
+        bool isFloatingPoint = false;
+        for (size_t i = 0; i < node->getOriginalInputsNumber(); i++)
+            isFloatingPoint = isFloatingPoint || node->getOriginalInputPrecisionAtPort(i) == Precision::FP32;
+        for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++)
+            isFloatingPoint = isFloatingPoint || node->getOriginalOutputPrecisionAtPort(i) == Precision::FP32;
+        if (!isFloatingPoint)
+            continue;
+        bf16PrecisionMap[node->getName()] = Precision::FP32;
 
-            for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
-                if (node->getOriginalOutputPrecisionAtPort(i) == Precision::FP32)
-                    node->setOriginalOutputPrecisionAtPort(i, Precision::BF16);
-            }
+        // the precisions set explicitly override the rules
+        const auto explicitPrecision = config.bf16PrecisionMap.find(node->getName());
+        if (explicitPrecision != config.bf16PrecisionMap.end()) {
+            if (explicitPrecision->second != Precision::BF16)
+                continue;
+        } else if ((nodesToSkip.count(node) && !node->enforceBF16evenForGraphTail) || sensitiveNodes.count(node)) {
+            continue;
         }
+
+        for (size_t i = 0; i < node->getOriginalInputsNumber(); i++) {
+            const auto &parent = node->getParentEdgesAtPort(i)[0]->getParent();
+            /* Skip BF16 enforcement for nodes after Constant Inputs for maintaining precision for fusing.
+             * Precision conversion to BF16 does automatically, if convolution follows up after Constant Inputs
+             * and if activation is BF16 */
+            if (!(parent->getType() == Input && parent->isConstant() &&
+                  node->getType() != Concatenation) && // Concatenation node is exception because it doesn't change an accuracy for BF16 activation
+                !(parent->getType() == Input && node->getType() == Eltwise) && // exclude Eltwise after Input since it supports conversion to BF16
+                node->getOriginalInputPrecisionAtPort(i) == Precision::FP32)
+                node->setOriginalInputPrecisionAtPort(i, Precision::BF16);
+        }
+
+        for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
+            if (node->getOriginalOutputPrecisionAtPort(i) == Precision::FP32)
+                node->setOriginalOutputPrecisionAtPort(i, Precision::BF16);
+        }
+        bf16PrecisionMap[node->getName()] = Precision::BF16;
+    }
+}
+
+std::string MKLDNNGraph::GetBF16PrecisionMap() const {
+    std::string str;
+    for (const auto& precision : bf16PrecisionMap) {
+        if (!str.empty())
+            str += ';';
+        str += precision.first + ':' + precision.second.name();
     }
+    return str;
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNGraph::dump() const {
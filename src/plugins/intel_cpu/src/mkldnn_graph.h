@@ -11,14 +11,22 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
+#include "mkldnn_memory_arena.h"
+#include "utils/execution_tracer.h"
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <mutex>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequestBase;
+struct MKLDNNVariableStorage;
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -39,26 +47,200 @@ public:
         return (GetStatus() == Ready);
     }
 
+    /**
+     * @brief Drops the nodes and the memory of the graph, it's ready again after the next CreateGraph() call
+     */
+    void Release() {
+        ForgetGraphData();
+        constantGraphNodes.clear();
+        executableGraphNodes.clear();
+        pipelineOrder.clear();
+        pipelineStages.clear();
+        parallelLevelOf.clear();
+        parallelLevels.clear();
+        traceIds.clear();
+        variableStorages.clear();
+        outputMemoryMngrs.clear();
+        memWorkspace.reset();
+        dynamicArena.reset();
+        dynamicActivationsBytes = 0;
+    }
+
+    /**
+     * @brief Returns the storage of the variable in this graph, nullptr if the graph has no such variable.
+     *        Each graph of the compiled model has its own storages, so a state is pushed to the graph it's inferred with.
+     */
+    std::shared_ptr<MKLDNNVariableStorage> GetVariableStorage(const std::string& name) const {
+        auto storage = variableStorages.find(name);
+        return storage == variableStorages.end() ? nullptr : storage->second;
+    }
+
+    /**
+     * @brief Returns the runtime parameters cache of the graph, it may be shared with the other graphs
+     */
+    MultiCachePtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
+    /**
+     * @brief The memory the graph holds, the blocks are keyed by the address, so the ones shared with the other graphs
+     *        (e.g. the cached weights) may be counted once
+     */
+    struct MemoryUsage {
+        std::unordered_map<const void*, size_t> weights;
+        // the workspace of the static edges
+        std::unordered_map<const void*, size_t> activations;
+        // the grow-only arena of the dynamic edges, it's reallocated by the inference, so only its size is reported
+        size_t dynamicActivations = 0;
+        // the part of the activations bound to the graph inputs and outputs
+        size_t io = 0;
+    };
+
+    /**
+     * @brief Reports the memory of the graph, may be called while the graph is being inferred
+     */
+    MemoryUsage GetMemoryUsage() const;
+
+    /**
+     * @brief Returns the most of the activations memory the graph has held at once, isn't reset by Release()
+     */
+    size_t GetActivationsPeak() const noexcept {
+        return activationsPeak;
+    }
+
     void setConfig(const Config &cfg);
     const Config& getConfig() const;
 
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets the tracer recording the execution of the nodes, must be called before the graph creation
+     */
+    void setTracer(const ExecutionTracer::Ptr& executionTracer) {
+        tracer = executionTracer;
+    }
+
+    /**
+     * @brief Sets the executor with a stream per NUMA node splitting the large FullyConnected weights between the nodes,
+     *        must be called before the graph creation
+     */
+    void setTensorParallelExecutor(const InferenceEngine::IStreamsExecutor::Ptr& executor) {
+        tensorParallelExecutor = executor;
+    }
+
+    /**
+     * @brief The primitive descriptors selected by the graph nodes, by the node name. The graph created from the same
+     *        network with the same config selects the same descriptors, so the selection may be replayed
+     */
+    struct SelectedDescriptors {
+        using Ptr = std::shared_ptr<const SelectedDescriptors>;
+        // the selected descriptor index and the number of the supported descriptors
+        std::unordered_map<std::string, std::pair<int, size_t>> nodes;
+    };
+
+    /**
+     * @brief Makes the graph select the given descriptors instead of searching for the optimal ones, the search is done
+     *        anyway if the descriptors don't match the nodes. Must be called before the graph creation
+     */
+    void setSelectedDescriptors(const SelectedDescriptors::Ptr& descriptors) {
+        replayedDescriptors = descriptors;
+    }
+
+    /**
+     * @brief Returns the descriptors selected by the nodes of the created graph, nullptr if the node names are not unique
+     */
+    SelectedDescriptors::Ptr getSelectedDescriptors() const {
+        return selectedDescriptors;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const MKLDNNExtensionManager::Ptr& extMgr,
-                     MKLDNNWeightsSharing::Ptr &w_cache);
+                     MKLDNNWeightsSharing::Ptr &w_cache,
+                     const MultiCachePtr &rtCache = nullptr);
 
     bool hasMeanImageFor(const std::string& name) {
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
+    /**
+     * @brief Checks whether the input data of the description is converted and normalized by PushInputData() directly
+     *        into the graph memory, so the caller doesn't need to convert the precision of the input beforehand
+     */
+    bool IsInputNormalizedOnPush(const std::string& name, const InferenceEngine::TensorDesc& desc) const;
+
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequestBase* request = nullptr, int batch = -1);
 
+    /**
+     * @brief Executes the nodes of the static graph with the stream of the caller, without the per inference bookkeeping
+     *        of Infer(). Is intended for the bodies executed many times within a single inference (e.g. TensorIterator)
+     */
+    void InferStatic(const mkldnn::stream& stream);
+
+    /**
+     * @brief Checks whether the memory of the input node child edges may be pointed to an external buffer, that is
+     *        none of the children is constant, works in place or shares the memory of the input with its outputs
+     */
+    static bool IsInputMemoryRebindable(const MKLDNNNodePtr& inputNode);
+
+    /**
+     * @brief Checks whether the memory of the output node parent edge may be pointed to an external buffer, that is
+     *        the producers writing to this memory are neither constant nor in place and have no other consumers
+     */
+    static bool IsOutputMemoryRebindable(const MKLDNNNodePtr& outputNode);
+
+    /**
+     * @brief Runs the request through the pipeline stages of the graph. Each stage is owned by a single request at a time
+     *        and the next stage is acquired before the current one is released, so the requests follow each other
+     *        through the stages and several requests are executed concurrently.
+     * @param pushInputs is called within the first stage to fill the graph inputs
+     * @param pullOutputs is called within the last stage to read the graph outputs
+     */
+    void InferPipelined(MKLDNNInferRequestBase* request, const std::function<void()>& pushInputs,
+                        const std::function<void()>& pullOutputs);
+
+    bool IsPipelined() const {
+        return !pipelineStages.empty();
+    }
+
+    /**
+     * @brief Returns the precisions the floating point nodes are executed with if BF16 is enforced in the format of
+     *        KEY_CPU_BF16_PRECISION_MAP, so the map may be edited and passed back to compile the model, otherwise is empty
+     */
+    std::string GetBF16PrecisionMap() const;
+
+    /**
+     * @brief Rounds the dynamic dimensions of the input up according to the shape buckets policy.
+     *        The original dims are remembered to crop the outputs back within the current inference.
+     * @param name input name
+     * @param dims the actual dims of the input data
+     * @return the dims the input is executed with
+     */
+    VectorDims PadInputDims(const std::string& name, const VectorDims& dims);
+
+    void ResetPaddedDims() {
+        unpaddedInputDims.clear();
+    }
+
+    /**
+     * @brief Binds the memory of the dynamic output to the buffers provided by the allocator, so the output is written
+     *        directly to them. The allocator returns nullptr if it can't provide the buffer of the requested size,
+     *        the empty allocator unbinds the output.
+     * @return false if the output memory can't be bound
+     */
+    bool BindOutputAllocator(const std::string& name, MemoryMngrWithExternalAllocator::Allocator allocator);
+
+    /**
+     * @brief Checks whether the memory of the input or output may be padded, so it can't share the user buffer
+     */
+    bool IsPaddedIO(const std::string& name) const {
+        return paddedIO.count(name) != 0;
+    }
+
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -207,6 +389,13 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // the memory of the dynamic edges which upper bound is unknown
+    DynamicMemoryArenaPtr dynamicArena;
+    // the arena size and the activations peak are read by the memory statistics queries concurrently with the inference
+    std::atomic<size_t> dynamicActivationsBytes{0};
+    std::atomic<size_t> activationsPeak{0};
+    // the managers of the dynamic outputs memory which may be bound to the user buffers
+    std::unordered_map<std::string, std::pair<std::weak_ptr<DnnlMemoryMngr>, MemoryMngrWithExternalAllocator*>> outputMemoryMngrs;
 
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
@@ -224,14 +413,31 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void MinimizeReorders();
+    // selects the descriptors set by setSelectedDescriptors(), returns false if they don't match the nodes
+    bool ReplayDescriptors();
+    void RecordDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    std::string getConstantKey(const MKLDNNEdgePtr& edge) const;
+    void AllocateDynamicEdges();
+    void UpdateActivationsBytes();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
-    void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
+    void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream,
+                     const std::vector<VectorDims>* outputShapes = nullptr) const;
     void ExecuteConstantNodesOnly() const;
+    void InitShapesPlanCache();
+    void InitShapeBuckets();
+    void SplitToPipelineStages();
+    void InitPipelineStages();
+    void RegisterTraceNames();
+    void InitVariableStorages();
+    void SplitToParallelLevels();
+    void InitParallelLevels();
+    void ExecuteParallelLevels(MKLDNNInferRequestBase* request, const mkldnn::stream& stream) const;
 
     friend class MKLDNNInferRequestBase;
     friend class MKLDNNLegacyInferRequest;
@@ -251,7 +457,72 @@ private:
 
     MultiCachePtr rtParamsCache;
 
+    /**
+     * @brief The output shapes of all the executable nodes recorded for particular shapes of the graph inputs.
+     *        Is used to skip the nodes shape inference when the graph is executed with the same input shapes again.
+     */
+    struct ShapesPlanKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const ShapesPlanKey& rhs) const;
+    };
+    using ShapesPlan = std::vector<std::vector<VectorDims>>;
+    using ShapesPlanCache = LruCache<ShapesPlanKey, std::shared_ptr<ShapesPlan>>;
+
+    ShapesPlanKey GetShapesPlanKey() const;
+    void RecordShapesPlan(const ShapesPlanKey& key);
+
+    // is null if the shapes of the graph can't be defined by the input shapes only
+    std::shared_ptr<ShapesPlanCache> shapesPlanCache;
+
+    // inputs and outputs which memory may be padded up to the shape buckets
+    std::unordered_set<std::string> paddedIO;
+    // the original dims of the inputs padded within the current inference
+    std::unordered_map<std::string, VectorDims> unpaddedInputDims;
+    // propagates the original input dims through the graph, returns the edges whose dims differ from the padded ones
+    std::unordered_map<const MKLDNNEdge*, VectorDims> InferUnpaddedDims() const;
+
+    /**
+     * @brief The range of executableGraphNodes executed by a single request at a time. The transition nodes copy
+     *        the data produced by the previous stages and are executed while the previous stage is still owned.
+     */
+    struct PipelineStage {
+        size_t begin = 0;
+        size_t transitionEnd = 0;
+        size_t end = 0;
+        std::mutex mutex;
+    };
+
+    // 2 * stage index for the nodes of the stage, 2 * stage index - 1 for the transition nodes of the stage
+    std::unordered_map<const MKLDNNNode*, size_t> pipelineOrder;
+    // is empty if the graph isn't pipelined
+    std::vector<PipelineStage> pipelineStages;
+
+    size_t GetPipelineStage(const MKLDNNNodePtr& node) const;
+
+    /**
+     * @brief The range of executableGraphNodes having no dependencies on each other, so they are executed concurrently
+     */
+    struct ParallelLevel;
+
+    // the dependency level of each non constant node, the constant nodes precede the level 1
+    std::unordered_map<const MKLDNNNode*, int> parallelLevelOf;
+    // is empty if the independent nodes are executed sequentially
+    std::vector<std::shared_ptr<ParallelLevel>> parallelLevels;
+
+    // is null if the execution isn't traced
+    ExecutionTracer::Ptr tracer;
+    // is null if the FullyConnected weights aren't split between the NUMA nodes
+    InferenceEngine::IStreamsExecutor::Ptr tensorParallelExecutor;
+    SelectedDescriptors::Ptr replayedDescriptors;
+    SelectedDescriptors::Ptr selectedDescriptors;
+    std::unordered_map<const MKLDNNNode*, uint32_t> traceIds;
+    std::unordered_map<std::string, std::shared_ptr<MKLDNNVariableStorage>> variableStorages;
+
     void EnforceBF16();
+    // the precisions chosen by EnforceBF16 by the original node names
+    std::map<std::string, InferenceEngine::Precision> bf16PrecisionMap;
 };
 
 }  // namespace MKLDNNPlugin
@@ -146,6 +146,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInputConvertAndEltwise");
+    FuseInputConvertAndEltwise(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndTranspose");
+    FuseColorConvertAndTranspose(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "reshapeRnnSeq");
     reshapeRnnSeq(graph);
     graph.RemoveDroppedNodes();
@@ -730,6 +738,11 @@ void MKLDNNGraphOptimizer::FuseMatMulAndSimpleOperation(MKLDNNGraph &graph) {
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
+    auto getFusedOutputPrecision = [](const MKLDNNNodePtr &node) {
+        return !node->fusedWith.empty() ? node->fusedWith[node->fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0)
+                                        : node->getOriginalOutputPrecisionAtPort(0);
+    };
+
     auto isConvolutionNode = [](const MKLDNNNodePtr &node) {
         return node->getType() == Convolution;
     };
@@ -763,8 +776,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
                 dimsEqualStrong(inDims[inDims.size() - 2], outDims[outDims.size() - 2]) &&
                 is1x1Convolution(conv) &&  // TODO [oneDNN] : fusing is permitted only with 1x1 convolutions
                 everyone_is(1, strides[strides.size() - 1], strides[strides.size() - 2]) &&
-                everyone_is(0, paddings[paddings.size() - 1], paddings[paddings.size() - 2]) &&
-                !conv->canBeExecutedInInt8();
+                everyone_is(0, paddings[paddings.size() - 1], paddings[paddings.size() - 2]);
         if (!isSupportedParams) return false;
 
         return node->getChildEdges().size() == 1 && isConvolutionNode(node->getChildEdgeAt(0)->getChild());
@@ -785,23 +797,22 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
         if (convParent == nullptr)
             IE_THROW() << "Cannot cast to convolution node " << parentNode->getName();
 
-        if (!everyone_is(Precision::FP32, convParent->getOriginalOutputPrecisionAtPort(0), convChild->getOriginalInputPrecisionAtPort(0),
-                convChild->getOriginalOutputPrecisionAtPort(0)))
-            return false;
-
-        auto parentOutputPrecision = !parentNode->fusedWith.empty()
-                ? parentNode->fusedWith[parentNode->fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0)
-                : parentNode->getOriginalOutputPrecisionAtPort(0);
-
-        auto childOutputPrecision = !childNode->fusedWith.empty()
-                ? childNode->fusedWith[childNode->fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0)
-                : childNode->getOriginalOutputPrecisionAtPort(0);
+        auto parentOutputPrecision = getFusedOutputPrecision(parentNode);
+        auto childOutputPrecision = getFusedOutputPrecision(childNode);
 
-        if (!everyone_is(Precision::FP32, parentOutputPrecision, childOutputPrecision))
+        if (!convChild->inputZeroPoints.empty() || !convChild->weightsZeroPoints.empty())
             return false;
 
-        if (!convChild->inputZeroPoints.empty() || !convChild->weightsZeroPoints.empty())
+        // The fused dw convolution reads the u8 output of the int8 1x1 convolution with the s8 weights, the scales are
+        // the post ops fused into the dw convolution. The other precisions are computed in fp32
+        if (convParent->canBeExecutedInInt8() || convChild->canBeExecutedInInt8()) {
+            if (!convParent->canBeExecutedInInt8() || !convChild->canBeExecutedInInt8() ||
+                    parentOutputPrecision != Precision::U8 || !one_of(childOutputPrecision, Precision::U8, Precision::I8, Precision::FP32))
+                return false;
+        } else if (!everyone_is(Precision::FP32, convParent->getOriginalOutputPrecisionAtPort(0), convChild->getOriginalInputPrecisionAtPort(0),
+                                convChild->getOriginalOutputPrecisionAtPort(0), parentOutputPrecision, childOutputPrecision)) {
             return false;
+        }
 
         bool withBias = convChild->getOriginalInputPrecisions().size() == 3;
 
@@ -828,11 +839,12 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
 
         auto inDims = childNode->inputShapes[0].getStaticDims();
         auto outDims = childNode->outputShapes[0].getStaticDims();
-        int elemSize = childNode->getOriginalOutputPrecisionAtPort(0).size();
+        int inElemSize = getFusedOutputPrecision(parentNode).size();
+        int outElemSize = getFusedOutputPrecision(childNode).size();
 
         int L3_cache_size = utils::get_cache_size(3, false);
-        int dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * elemSize;
-        int dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * elemSize;
+        int dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * inElemSize;
+        int dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * outElemSize;
 
         auto parentConvolutionNode = std::dynamic_pointer_cast<MKLDNNConvolutionNode>(parentNode);
         if (parentConvolutionNode == nullptr)
@@ -1467,6 +1479,12 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
                 return false;
             }
 
+            // The parent has the only child, so the inputs the nodes share can't make a cycle. They become several
+            // inputs of the fused node reading the same memory, which the eltwise kernel supports, so the DAGs like
+            // x * f(x) are fused as well. The FakeQuantize inputs become the post op data, so they are still avoided
+            if (childNode->getType() == Eltwise)
+                continue;
+
             // Avoid cycle dependencies
             for (auto &parentParentEdge : parentNode->getParentEdges()) {
                 if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
@@ -1583,6 +1601,84 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseInputConvertAndEltwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // The preprocessing of the integer inputs converts them to FP32 before the first Eltwise (mean, scale).
+    // The Eltwise JIT kernel loads the integer input as is and converts it in the registers, it computes in FP32 since
+    // none of its emitters computes in these precisions, so the FP32 copy of the whole input isn't needed.
+    auto isSuitableConvertNode = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+        if (node->getParentEdgeAt(0)->getParent()->getType() != Input)
+            return false;
+        return one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8, Precision::U16, Precision::I16) &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isSuitableEltwiseNode = [](const MKLDNNNodePtr& node, int port) {
+        // the reference Eltwise implementation reads all the inputs as FP32
+        return node->getType() == Eltwise && impl::cpu::x64::mayiuse(impl::cpu::x64::sse41) &&
+               node->getInputShapeAtPort(0).getRank() <= MAX_ELTWISE_DIM_RANK &&
+               port < node->getOriginalInputsNumber() && node->getOriginalInputPrecisionAtPort(port) == Precision::FP32;
+    };
+
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableConvertNode(graphNode))
+            continue;
+
+        const auto childEdge = graphNode->getChildEdgeAt(0);
+        const auto eltwiseNode = childEdge->getChild();
+        const auto port = childEdge->getOutputNum();
+        if (!isSuitableEltwiseNode(eltwiseNode, port))
+            continue;
+
+        eltwiseNode->setOriginalInputPrecisionAtPort(port, graphNode->getOriginalInputPrecisionAtPort(0));
+        graph.DropNode(graphNode);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseColorConvertAndTranspose(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // ColorConvert produces the interleaved NHWC pixels, the models usually take NCHW right after it,
+    // so it writes the channels as the separate planes instead of the Transpose copying the whole image once more.
+    auto isSuitableParentNode = [](const MKLDNNNodePtr& node) {
+        return node->getType() == ColorConvert && node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    auto isSuitableChildNode = [](const MKLDNNNodePtr& parentNode, const MKLDNNNodePtr& childNode) {
+        if (childNode->getType() != Transpose || childNode->getParentEdges().size() != 2)
+            return false;
+
+        const auto orderNode = childNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (orderNode->getType() != Input || !orderNode->isConstant())
+            return false;
+
+        auto transposeNode = std::dynamic_pointer_cast<MKLDNNTransposeNode>(childNode);
+        return transposeNode && transposeNode->getOrder() == InferenceEngine::SizeVector{0, 3, 1, 2} &&
+               childNode->getOriginalOutputPrecisionAtPort(0) == parentNode->getOriginalOutputPrecisionAtPort(0);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parentNode = graphNodes[i];
+        if (!isSuitableParentNode(parentNode))
+            continue;
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(parentNode, childNode))
+            continue;
+
+        childNode->fuseInto(parentNode);
+        parentNode->outputShapes[0] = childNode->getOutputShapeAtPort(0);
+
+        auto orderEdge = childNode->getParentEdgesAtPort(1)[0];
+        orderEdge->drop();
+        graph.RemoveEdge(orderEdge);
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
     std::set<MKLDNNNodePtr> processed;
     int graphNodesSize = graph.GetNodes().size();
@@ -1628,30 +1724,62 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
 void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
+    // The eltwise kernel reads the inputs with the dims of 1 with the zero strides, so the Broadcast and the Tile which
+    // only expand such dims are views the eltwise can compute itself, the expanded tensor isn't written to the memory
+    auto isSuitableParentNode = [](const MKLDNNNodePtr& node) {
+        if (!one_of(node->getType(), Broadcast, Tile) || node->isDynamicNode() || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto& inDims = node->getInputShapeAtPort(0).getStaticDims();
+        const auto& outDims = node->getOutputShapeAtPort(0).getStaticDims();
+        // the dims of the explicit Broadcast of the lower rank aren't aligned to the right as the eltwise aligns them
+        if (inDims.size() > outDims.size() || (node->getType() == Broadcast && inDims.size() != outDims.size()))
+            return false;
+
+        const auto rankDiff = outDims.size() - inDims.size();
+        for (size_t i = 0; i < inDims.size(); i++) {
+            if (inDims[i] != outDims[i + rankDiff] && inDims[i] != 1)
+                return false;
+        }
+        return true;
+    };
+
+    auto isSuitableChildNode = [](const MKLDNNNodePtr& parentNode, const MKLDNNNodePtr& childNode) {
+        if (childNode->getType() != Eltwise || childNode->isDynamicNode())
+            return false;
+
+        // the other input has to keep the output shape of the eltwise without the expanded one
+        const auto& outShape = childNode->getOutputShapeAtPort(0);
+        if (parentNode->getOutputShapeAtPort(0) != outShape)
+            return false;
+
+        const auto port = parentNode->getChildEdgeAt(0)->getOutputNum();
+        for (size_t i = 0; i < childNode->getParentEdges().size(); i++) {
+            if (i != port && childNode->getInputShapeAtPort(i) == outShape)
+                return true;
+        }
+        return false;
+    };
+
     for (auto &graphNode : graphNodes) {
-        if (graphNode->getType() != Generic
-                || graphNode->getTypeStr() != "Broadcast"
-                || graphNode->getChildEdges().size() != 1lu
-                || graphNode->getChildEdgeAt(0)->getChild()->getType() != Eltwise)
+        if (!isSuitableParentNode(graphNode))
             continue;
 
-        MKLDNNNodePtr& broadcastNode = graphNode;
-        MKLDNNNodePtr eltwiseNode = broadcastNode->getChildEdgeAt(0)->getChild();
-        eltwiseNode->inputShapes[broadcastNode->getChildEdgeAt(0)->getOutputNum()]
-                = broadcastNode->getInputShapeAtPort(0);
+        MKLDNNNodePtr& expandNode = graphNode;
+        MKLDNNNodePtr eltwiseNode = expandNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(expandNode, eltwiseNode))
+            continue;
 
-        auto& edges = graph.GetEdges();
-        for (size_t i = 1lu; i < broadcastNode->getParentEdges().size(); i++) {
-            auto constParent = broadcastNode->getParentEdgesAtPort(i)[0]->getParent();
-            for (auto it = edges.begin(); it != edges.end(); it++) {
-                if ((*it) == constParent->getChildEdgeAt(0)) {
-                    edges.erase(it);
-                    constParent->remove();
-                    break;
-                }
-            }
+        eltwiseNode->inputShapes[expandNode->getChildEdgeAt(0)->getOutputNum()] = expandNode->getInputShapeAtPort(0);
+
+        // the target shape, the axes mapping and the repeats
+        auto parentEdges = expandNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getOutputNum() != 0)
+                graph.RemoveEdge(p_edge);
         }
-        graph.DropNode(broadcastNode);
+        graph.DropNode(expandNode);
     }
 }
 
@@ -4,12 +4,13 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
-#include <nodes/mkldnn_concat_node.h>
-#include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include <ie_common.h>
 #include "mkldnn_exec_network.h"
@@ -19,6 +20,7 @@
 #include "nodes/mkldnn_memory_node.hpp"
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
+#include "cpu_remote_context.h"
 #include <debug.h>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
@@ -32,7 +34,7 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::CreateInferRequest() {
 
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
-    graph = &(execNetwork->GetGraph()._graph);
+    setGraph(execNetwork->GetGraph()._graph);
 
     initBlobs();
 
@@ -45,26 +47,31 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::CreateInferRequest() {
             if (!memoryNode) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
-
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
-
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            memoryStates.emplace_back(new MKLDNNVariableState(memoryNode->getVariableName(), memoryNode->getStorage()));
         }
     }
 }
 
 MKLDNNPlugin::MKLDNNInferRequestBase::~MKLDNNInferRequestBase() {
+    if (graph)
+        static_cast<MKLDNNExecNetwork::Graph*>(graph)->_users--;
     --(execNetwork->_numRequests);
 }
 
+void MKLDNNPlugin::MKLDNNInferRequestBase::setGraph(MKLDNNGraph& newGraph) {
+    if (graph == &newGraph)
+        return;
+    // all the graphs of the requests are the ones of the compiled model streams
+    static_cast<MKLDNNExecNetwork::Graph&>(newGraph)._users++;
+    if (graph)
+        static_cast<MKLDNNExecNetwork::Graph*>(graph)->_users--;
+    graph = &newGraph;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     auto& tensorDesc = inputBlob->getTensorDesc();
-    bool needConvert = inPrec != tensorDesc.getPrecision();
+    // the graph converts the u8 images to be normalized by itself, within the same pass as the normalization
+    bool needConvert = inPrec != tensorDesc.getPrecision() && !graph->IsInputNormalizedOnPush(inputName, tensorDesc);
 
     const void* srcData = inputBlob->cbuffer().as<const void *>();
     if (srcData == nullptr) {
@@ -90,72 +97,99 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(const std::string& inputNam
 }
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
+    for (const auto& state : memoryStates) {
+        auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+        if (!cur_state) {
+            IE_THROW() << "Cannot cast " << state->GetName() << " to MKLDNNVariableState";
         }
+        // the request may be inferred with another graph than the previous time, e.g. of another stream
+        cur_state->push(graph->GetVariableStorage(cur_state->GetName()));
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+    for (const auto& state : memoryStates) {
+        auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+        if (!cur_state) {
+            IE_THROW() << "Cannot cast " << state->GetName() << " to MKLDNNVariableState";
         }
+        cur_state->pull();
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
+    graph->ResetPaddedDims();
     for (const auto &blob : _inputs) {
         const auto inputNode = cpuInputNodes.find(blob.first);
         if (inputNode == cpuInputNodes.end())
             IE_THROW() << "CPU execution graph doesn't contain input node with name: " << blob.first;
         if (inputNode->second->isDynamicNode()) {
-            inputNode->second->redefineOutputMemory({blob.second->getTensorDesc().getDims()});
+            inputNode->second->redefineOutputMemory({graph->PadInputDims(blob.first, blob.second->getTensorDesc().getDims())});
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::updateShapesProfile() {
+    const auto& profile = execNetwork->_shapesProfile;
+    if (!profile)
+        return;
+
+    bool changed = _lastInputShapes.size() != _inputs.size();
+    for (const auto &blob : _inputs) {
+        const auto& dims = blob.second->getTensorDesc().getDims();
+        auto& lastDims = _lastInputShapes[blob.first];
+        if (lastDims != dims) {
+            lastDims = dims;
+            changed = true;
         }
     }
+    if (changed)
+        profile->record(_lastInputShapes);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
+    const auto& tracer = execNetwork->_tracer;
+    if (tracer) {
+        auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->_taskExecutor.get());
+        ExecutionTracer::setCurrentStream(streamsExecutor ? streamsExecutor->GetStreamId() : -1);
+    }
+    ExecutionTracer::Scope inferTrace(tracer, ExecutionTracer::INFER);
+
+    if (!execNetwork->_shapeSpecializations.empty() && InferBySpecialization())
+        return;
+
+    if (execNetwork->_batchSplitMinSize && InferByBatchParts())
+        return;
+
+    const auto waitStart = tracer ? tracer->now() : 0;
     auto graphLock = execNetwork->GetGraph();
-    graph = &(graphLock._graph);
+    if (tracer)
+        tracer->record(ExecutionTracer::WAIT, waitStart, tracer->now());
+    setGraph(graphLock._graph);
+
+    if (graph->IsPipelined()) {
+        // the stages of the graph are owned by the requests separately, so the graph memory can't refer to the blobs of
+        // the particular request and the data are always copied
+        graphLock.unlock();
+
+        ThrowIfCanceled();
+
+        execDataPreprocessing(_inputs);
+
+        graph->InferPipelined(this, [this] { PushInputData(); }, [this] { graph->PullOutputData(_outputs); });
+        return;
+    }
 
     ThrowIfCanceled();
 
-    if (graph->hasDynamicInput())
+    if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
+        updateShapesProfile();
+    }
 
     execDataPreprocessing(_inputs);
 
@@ -169,15 +203,244 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::InferImpl() {
         PushStates();
     }
 
-    graph->Infer(this, m_curBatch);
+    bindDynamicOutputs();
+    try {
+        graph->Infer(this, m_curBatch);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
+        if (memoryStates.size() != 0) {
+            PullStates();
+        }
+
+        ThrowIfCanceled();
+
+        graph->PullOutputData(_outputs);
+    } catch (...) {
+        unbindDynamicOutputs();
+        throw;
+    }
+    // the graph memory must not refer to the user blobs outside of the request inference
+    unbindDynamicOutputs();
+}
+
+namespace {
+
+// the blob is sliced by the batch if the batch is its outermost dimension and the blob isn't padded
+bool isSliceableByBatch(const InferenceEngine::Blob::Ptr& blob) {
+    const auto& desc = blob->getTensorDesc();
+    if (blob->is<InferenceEngine::CompoundBlob>() || desc.getDims().empty() ||
+        desc.getLayout() == InferenceEngine::Layout::ANY || desc.getLayout() == InferenceEngine::Layout::BLOCKED)
+        return false;
+    return desc.getBlockingDesc().getOrder()[0] == 0 &&
+           desc == InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout());
+}
+
+InferenceEngine::Blob::Ptr sliceByBatch(const InferenceEngine::Blob::Ptr& blob, size_t begin, size_t end) {
+    const auto& desc = blob->getTensorDesc();
+    auto dims = desc.getDims();
+    const size_t batchBytes = blob->byteSize() / dims[0];
+    dims[0] = end - begin;
+    return make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims, desc.getLayout()),
+                                    blob->buffer().as<uint8_t*>() + begin * batchBytes);
+}
+
+struct BatchPartsJob {
+    std::vector<std::shared_ptr<MKLDNNPlugin::MKLDNNInferRequestBase>> requests;
+    std::vector<std::exception_ptr> errors;
+    std::atomic<size_t> next = {0};
+    std::mutex mutex;
+    std::condition_variable finishedCondition;
+    size_t finished = 0;
+};
+
+}  // namespace
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::InferByBatchParts() {
+    // the legacy API requests may convert the input precisions and be preprocessed, so they are never split
+    const size_t minPartSize = execNetwork->_batchSplitMinSize;
+    if (_batchPart || minPartSize == 0 || _parameters.empty() || !_preProcData.empty())
+        return false;
+
+    size_t batch = 0;
+    for (const auto& input : _inputs) {
+        if (!isSliceableByBatch(input.second) || (batch != 0 && input.second->getTensorDesc().getDims()[0] != batch))
+            return false;
+        batch = input.second->getTensorDesc().getDims()[0];
+    }
+    const size_t parts = std::min(execNetwork->_graphs.size(), batch / minPartSize);
+    if (parts < 2)
+        return false;
+
+    // the batch is the only dynamic dimension of the outputs, so their shapes are known before the inference
+    for (const auto& result : _results) {
+        auto& blob = _outputs[ngraph::op::util::get_ie_output_name(result->input_value(0))];
+        auto dims = result->get_input_partial_shape(0).get_min_shape();
+        dims[0] = batch;
+        if (blob->getTensorDesc().getDims() != dims)
+            blob->setShape(dims);
+        if (!isSliceableByBatch(blob))
+            return false;
+    }
+
+    while (_batchParts.size() < parts) {
+        auto request = std::static_pointer_cast<MKLDNNInferRequestBase>(execNetwork->CreateInferRequestImpl(_parameters, _results));
+        if (!request)
+            return false;
+        request->_batchPart = true;
+        _batchParts.push_back(request);
     }
 
     ThrowIfCanceled();
 
-    graph->PullOutputData(_outputs);
+    auto job = std::make_shared<BatchPartsJob>();
+    job->requests.assign(_batchParts.begin(), _batchParts.begin() + parts);
+    job->errors.resize(parts);
+    for (size_t p = 0; p < parts; p++) {
+        const size_t begin = batch * p / parts;
+        const size_t end = batch * (p + 1) / parts;
+        for (const auto& input : _inputs)
+            job->requests[p]->SetBlob(input.first, sliceByBatch(input.second, begin, end));
+        for (const auto& output : _outputs)
+            job->requests[p]->SetBlob(output.first, sliceByBatch(output.second, begin, end));
+    }
+
+    auto inferNextPart = [](const std::shared_ptr<BatchPartsJob>& job) {
+        const size_t part = job->next++;
+        if (part >= job->requests.size())
+            return false;
+        try {
+            job->requests[part]->InferImpl();
+        } catch (...) {
+            job->errors[part] = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock{job->mutex};
+        if (++job->finished == job->requests.size())
+            job->finishedCondition.notify_all();
+        return true;
+    };
+    // the parts not taken by the other streams yet are inferred by this request itself, so it never waits for the
+    // streams busy with the other requests
+    for (size_t p = 1; p < parts; p++) {
+        execNetwork->_taskExecutor->run([job, inferNextPart] {
+            inferNextPart(job);
+        });
+    }
+    while (inferNextPart(job)) {
+    }
+    {
+        std::unique_lock<std::mutex> lock{job->mutex};
+        job->finishedCondition.wait(lock, [&] {
+            return job->finished == job->requests.size();
+        });
+    }
+    for (const auto& error : job->errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    for (size_t p = 0; p < parts; p++) {
+        const size_t partBatch = batch * (p + 1) / parts - batch * p / parts;
+        for (const auto& output : _outputs) {
+            const auto& dims = job->requests[p]->_outputs[output.first]->getTensorDesc().getDims();
+            if (dims.empty() || dims[0] != partBatch) {
+                // the model changes the batch on the way to the outputs, so it's inferred as a whole from now on
+                execNetwork->_batchSplitMinSize = 0;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::InferBySpecialization() {
+    // the legacy API requests may convert the input precisions and be preprocessed, so they use the dynamic graph
+    if (_parameters.empty() || !_preProcData.empty())
+        return false;
+
+    const auto& specializations = execNetwork->_shapeSpecializations;
+    auto isMatched = [&](const std::map<std::string, InferenceEngine::SizeVector>& shapes) {
+        for (const auto& input : _inputs) {
+            const auto shape = shapes.find(input.first);
+            if (shape != shapes.end() && input.second->getTensorDesc().getDims() != shape->second)
+                return false;
+        }
+        return true;
+    };
+    size_t index = 0;
+    while (index < specializations.size() && !isMatched(specializations[index].shapes))
+        index++;
+    if (index == specializations.size())
+        return false;
+
+    if (_specializedRequests.size() != specializations.size())
+        _specializedRequests.resize(specializations.size());
+    auto& request = _specializedRequests[index];
+    if (!request) {
+        const auto& network = specializations[index].network;
+        request = std::static_pointer_cast<MKLDNNInferRequestBase>(
+            network->CreateInferRequestImpl(network->getInputs(), network->getOutputs()));
+    }
+
+    // the static network reads and writes the blobs of this request, the dynamic outputs get the static shapes
+    for (const auto& input : _inputs)
+        request->SetBlob(input.first, input.second);
+    for (const auto& output : _outputs) {
+        const auto& dims = request->_outputs[output.first]->getTensorDesc().getDims();
+        if (output.second->getTensorDesc().getDims() != dims)
+            output.second->setShape(dims);
+        request->SetBlob(output.first, output.second);
+    }
+
+    ThrowIfCanceled();
+
+    request->InferImpl();
+    return true;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::isOutputBlobCompatible(const InferenceEngine::TensorDesc& blobDesc, const MemoryDesc& desc) {
+    if (blobDesc.getLayout() == InferenceEngine::Layout::ANY || !desc.isDefined())
+        return false;
+    // the blob may have different strides for the dims equal to 1 or be padded in the same way
+    return desc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc));
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::bindDynamicOutputs() {
+    if (!graph->hasDynamicInput() || graph->getProperty().batchLimit)
+        return;
+
+    for (const auto& output : _outputs) {
+        const auto& name = output.first;
+        const auto outputNode = graph->getOutputNodeByName(name);
+        if (!outputNode->isDynamicNode() || graph->IsPaddedIO(name))
+            continue;
+
+        const auto& blob = output.second;
+        const auto& blobDesc = blob->getTensorDesc();
+        const auto& desc = outputNode->getParentEdgeAt(0)->getMemory().getDesc();
+        // the output is written directly only if no conversion is performed on pulling the data
+        if (blobDesc.getPrecision() != desc.getPrecision() || !desc.hasLayoutType(LayoutType::ncsp) ||
+            blobDesc.getLayout() != InferenceEngine::TensorDesc::getLayoutByRank(blobDesc.getDims().size()))
+            continue;
+
+        void* ptr = blob->buffer();
+        const size_t capacity = blob->byteSize();
+        if (!ptr || capacity == 0)
+            continue;
+
+        // the bigger output is copied and the blob is enlarged by its own allocator, so the next inferences with the
+        // same shapes write to the blob directly
+        auto allocator = [ptr, capacity](size_t size) -> void* {
+            return size <= capacity ? ptr : nullptr;
+        };
+        if (graph->BindOutputAllocator(name, allocator))
+            _boundOutputs.push_back(name);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::unbindDynamicOutputs() {
+    for (const auto& name : _boundOutputs) {
+        graph->BindOutputAllocator(name, nullptr);
+    }
+    _boundOutputs.clear();
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequestBase::GetPerformanceCounts() const {
@@ -194,63 +457,18 @@ static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::changeDefaultPtr() {
     for (auto& it : externalPtr) {
+        // the padded memory can't share the user buffer
+        if (graph->IsPaddedIO(it.first))
+            continue;
         const auto& inputNodesMap = graph->GetInputNodesMap();
         auto input = inputNodesMap.find(it.first);
         if (input != inputNodesMap.end()) {
             MKLDNNNodePtr inputNodePtr = input->second;
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
                 continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
             // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Concatenation) {
-                    auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
+            if (MKLDNNGraph::IsInputMemoryRebindable(inputNodePtr)) {
+                for (auto& edge : inputNodePtr->getChildEdges()) {
                     auto e = edge.lock();
                     if (!e)
                         IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
@@ -269,31 +487,7 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (MKLDNNGraph::IsOutputMemoryRebindable(output->second))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -496,7 +690,7 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
+        if (!isDynamic && isOutputBlobCompatible(blobDesc, desc) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -529,7 +723,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
                 InferenceEngine::TensorDesc desc = _networkInputs[name]->getTensorDesc();
                 bool isDynamic = input->second->isDynamicNode();
 
-                _inputs[name] = make_blob_with_precision(desc);
+                _inputs[name] = make_blob_with_precision(desc, CPUHostAllocator::getForIO());
                 _inputs[name]->allocate();
 
                 if (!isDynamic &&
@@ -574,7 +768,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
                         InferenceEngine::TensorDesc desc = _networkOutputs[name]->getTensorDesc();
                         desc.setPrecision(normalizeToSupportedPrecision(desc.getPrecision()));
 
-                        data = make_blob_with_precision(desc);
+                        data = make_blob_with_precision(desc, CPUHostAllocator::getForIO());
                         data->allocate();
                     } else {
                         const auto &expectedTensorDesc = isDynamic ? InferenceEngine::TensorDesc(desc.getPrecision(),
@@ -610,7 +804,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
                     }
 
                     _outputs[name] = data;
-                    if (!isDynamic && !externalPtr.count(name) && data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(desc) &&
+                    if (!isDynamic && !externalPtr.count(name) && isOutputBlobCompatible(data->getTensorDesc(), desc) &&
                         !graph->getProperty().batchLimit) {
                         externalPtr[name] = data->buffer();
                     }
@@ -663,6 +857,17 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(const std::vector<std::shar
     }
 
     CreateInferRequest();
+
+    const auto blobByName = [](InferenceEngine::BlobMap& blobs, const std::string& name) -> InferenceEngine::Blob::Ptr* {
+        auto it = blobs.find(name);
+        return it != blobs.end() ? &it->second : nullptr;
+    };
+    for (const auto& in : inputs) {
+        inputBlobsByIndex.push_back(blobByName(_inputs, ngraph::op::util::get_ie_output_name(ngraph::Output<const ngraph::Node>(in))));
+    }
+    for (const auto& out : outputs) {
+        outputBlobsByIndex.push_back(blobByName(_outputs, ngraph::op::util::get_ie_output_name(out->input_value(0))));
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::initBlobs() {
@@ -763,7 +968,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
+        if (!isDynamic && isOutputBlobCompatible(blobDesc, desc) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -802,7 +1007,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
+                _inputs[name] = make_blob_with_precision(desc, CPUHostAllocator::getForIO());
                 _inputs[name]->allocate();
 
                 if (!isDynamic &&
@@ -837,7 +1042,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
+                    data = make_blob_with_precision(desc, CPUHostAllocator::getForIO());
                     data->allocate();
                 } else {
                     if (!shape.compatible(ov::PartialShape(data->getTensorDesc().getDims()))) {
@@ -855,7 +1060,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
                 _outputs[name] = data;
                 if (!isDynamic && !externalPtr.count(name) &&
-                    data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(output->second->getParentEdgesAtPort(0)[0]->getMemory().getDesc()) &&
+                    isOutputBlobCompatible(data->getTensorDesc(), output->second->getParentEdgesAtPort(0)[0]->getMemory().getDesc()) &&
                         !graph->getProperty().batchLimit) {
                     externalPtr[name] = data->buffer();
                 }
@@ -873,6 +1078,23 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     return data;
 }
 
+// there are no batched inputs to check here, the plugin doesn't implement SetBlobsImpl
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetInputBlob(size_t idx) {
+    if (!graph || !graph->IsReady())
+        IE_THROW() << "Graph is not ready!";
+
+    const auto blob = inputBlobsByIndex.at(idx);
+    return blob ? *blob : IInferRequestInternal::GetInputBlob(idx);
+}
+
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetOutputBlob(size_t idx) {
+    if (!graph || !graph->IsReady())
+        IE_THROW() << "Graph is not ready!";
+
+    const auto blob = outputBlobsByIndex.at(idx);
+    return blob ? *blob : IInferRequestInternal::GetOutputBlob(idx);
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     for (auto input : _inputs) {
         auto inputName = input.first;
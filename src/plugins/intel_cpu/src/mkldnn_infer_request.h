@@ -50,12 +50,19 @@ protected:
     : IInferRequestInternal(inputs, outputs), execNetwork(execNetwork_) {}
 
     void CreateInferRequest();
+    // refers to the graph of the compiled model, so it's not released while the request may use it
+    void setGraph(MKLDNNGraph& newGraph);
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
+    /**
+     * @brief Checks whether the graph may write the output directly to the memory of the blob with the given tensor desc
+     */
+    static bool isOutputBlobCompatible(const InferenceEngine::TensorDesc& blobDesc, const MemoryDesc& desc);
+
     MKLDNNGraph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
 
@@ -63,12 +70,34 @@ private:
     void PushStates();
     void PullStates();
     void redefineMemoryForInputNodes();
+    void updateShapesProfile();
+    void bindDynamicOutputs();
+    void unbindDynamicOutputs();
 
     void changeDefaultPtr();
+    /**
+     * @brief Infers the batch by the sub-batches on several streams at once if the compiled model allows it, the
+     *        sub-batches refer to the slices of the request blobs
+     * @return false if the batch isn't split, so the request is inferred as a whole
+     */
+    bool InferByBatchParts();
+    /**
+     * @brief Infers the request by the static network compiled for its input shapes if the compiled model has one
+     * @return false if there is no such network, so the request is inferred by the dynamic graph
+     */
+    bool InferBySpecialization();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    std::map<std::string, InferenceEngine::SizeVector> _lastInputShapes;
+    std::vector<std::string> _boundOutputs;
+    // the requests inferring the sub-batches of this request, a sub-batch request is never split itself
+    std::vector<std::shared_ptr<MKLDNNInferRequestBase>> _batchParts;
+    bool _batchPart = false;
+    // the requests of the static networks compiled for the input shapes specializations, created on the first use
+    std::vector<std::shared_ptr<MKLDNNInferRequestBase>> _specializedRequests;
 };
 
 class MKLDNNLegacyInferRequest : public MKLDNNInferRequestBase {
@@ -92,12 +121,17 @@ public:
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
+    InferenceEngine::Blob::Ptr GetInputBlob(size_t idx) override;
+    InferenceEngine::Blob::Ptr GetOutputBlob(size_t idx) override;
 private:
     void PushInputData() override;
     void initBlobs() override;
 
     std::unordered_map<std::string, std::shared_ptr<const ov::Node>> modelInputsMap;
     std::unordered_map<std::string, std::shared_ptr<const ov::Node>> modelOutputsMap;
+    // the entries of _inputs and _outputs by the model port index, these are never erased, so the pointers stay valid
+    std::vector<InferenceEngine::Blob::Ptr*> inputBlobsByIndex;
+    std::vector<InferenceEngine::Blob::Ptr*> outputBlobsByIndex;
 };
 
 }  // namespace MKLDNNPlugin
@@ -17,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/huge_pages.h"
 
 using namespace InferenceEngine;
 using namespace mkldnn;
@@ -177,7 +178,7 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        void *ptr = hugepages::allocate(size, cacheLineSize);
         if (!ptr) {
             throw std::bad_alloc();
         }
@@ -196,7 +197,39 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
 void MemoryMngrWithReuse::release(void *ptr) {}
 
 void MemoryMngrWithReuse::destroy(void *ptr) {
-    dnnl::impl::free(ptr);
+    hugepages::free(ptr);
+}
+
+void* MemoryMngrWithExternalAllocator::getRawPtr() const noexcept {
+    return _allocated ? _allocated : _internal->getRawPtr();
+}
+
+void MemoryMngrWithExternalAllocator::setExtBuff(void *ptr, size_t size) {
+    _allocated = nullptr;
+    _internal->setExtBuff(ptr, size);
+}
+
+bool MemoryMngrWithExternalAllocator::resize(size_t size) {
+    if (_allocator) {
+        if (void* ptr = _allocator(size)) {
+            const bool bufferChanged = ptr != _allocated;
+            _allocated = ptr;
+            return bufferChanged;
+        }
+    }
+
+    const bool wasAllocated = _allocated != nullptr;
+    _allocated = nullptr;
+    return _internal->resize(size) || wasAllocated;
+}
+
+bool MemoryMngrWithExternalAllocator::hasExtBuffer() const noexcept {
+    return _allocated != nullptr || _internal->hasExtBuffer();
+}
+
+bool MemoryMngrWithExternalAllocator::setAllocator(Allocator allocator, size_t size) {
+    _allocator = std::move(allocator);
+    return resize(size);
 }
 
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
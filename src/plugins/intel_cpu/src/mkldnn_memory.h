@@ -89,6 +89,34 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief A memory manager which may use the buffers provided by an external allocator callback.
+ *        The allocator is asked for the buffer on each resize, the internal reusable buffer is used when the allocator
+ *        is not set or can't provide the buffer of the requested size.
+ */
+class MemoryMngrWithExternalAllocator : public IMemoryMngr {
+public:
+    using Allocator = std::function<void*(size_t size)>;
+
+    MemoryMngrWithExternalAllocator() : _internal(new MemoryMngrWithReuse()) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    /**
+     * @brief Sets the allocator, the empty one returns the manager to the internal buffer
+     * @param size - size of the currently used memory in bytes
+     * @return status whether the buffer was changed
+     */
+    bool setAllocator(Allocator allocator, size_t size);
+
+private:
+    Allocator _allocator;
+    void* _allocated = nullptr;
+    std::unique_ptr<IMemoryMngr> _internal;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
@@ -101,8 +129,7 @@ public:
     bool hasExtBuffer() const noexcept override;
     void registerMemory(MKLDNNMemory* memPtr);
     void unregisterMemory(MKLDNNMemory* memPtr);
-
-private:
+    // updates the registered memory objects when the underlying buffer is moved outside of resize/setExtBuff calls
     void notifyUpdate();
 
 private:
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_arena.h"
+
+#include "utils/general_utils.h"
+#include "utils/huge_pages.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+void release(void *ptr) {}
+
+void destroy(void *ptr) {
+    hugepages::free(ptr);
+}
+
+void* allocate(size_t size, int alignment) {
+    void *ptr = hugepages::allocate(size, alignment);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+}  // namespace
+
+constexpr int64_t DynamicMemoryArena::alignment;
+
+DynamicMemoryArena::DynamicMemoryArena(std::vector<MemorySolver::Box> boxes)
+    : _boxes(std::move(boxes)), _offsets(_boxes.size(), 0), _mngrs(_boxes.size()), _data(nullptr, release) {
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        if (_boxes[i].id != static_cast<int>(i))
+            IE_THROW() << "Unexpected dynamic memory arena box id: " << _boxes[i].id << " at index " << i;
+        _boxes[i].size = 0;
+    }
+}
+
+DnnlMemoryMngrPtr DynamicMemoryArena::createMemoryMngr(size_t cluster) {
+    IE_ASSERT(cluster < _boxes.size());
+    auto mngr = new ArenaMemoryMngr(shared_from_this(), cluster);
+    auto dnnlMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(mngr));
+    _mngrs[cluster] = {dnnlMngr, mngr};
+    return dnnlMngr;
+}
+
+void* DynamicMemoryArena::getPtr(size_t cluster) const noexcept {
+    if (!_data || _boxes[cluster].size == 0)
+        return nullptr;
+    return static_cast<int8_t*>(_data.get()) + _offsets[cluster] * alignment;
+}
+
+size_t DynamicMemoryArena::getCapacity(size_t cluster) const noexcept {
+    return static_cast<size_t>(_boxes[cluster].size * alignment);
+}
+
+void DynamicMemoryArena::request(size_t cluster, size_t size) {
+    const auto units = static_cast<int64_t>(div_up(size, alignment));
+    if (units > _boxes[cluster].size) {
+        _boxes[cluster].size = units;
+        _dirty = true;
+    }
+}
+
+bool DynamicMemoryArena::relayout() {
+    if (!_dirty)
+        return false;
+    _dirty = false;
+
+    MemorySolver memSolver(_boxes);
+    const auto totalSize = static_cast<size_t>(memSolver.solve() * alignment);
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        _offsets[i] = memSolver.getOffset(static_cast<int>(i));
+    }
+
+    // the buffer only grows, so after the warm-up the same buffer is reused for any shapes seen before
+    if (totalSize > _size) {
+        _data.reset();
+        _data = decltype(_data)(allocate(totalSize, alignment), destroy);
+        _size = totalSize;
+    }
+
+    for (auto& cluster : _mngrs) {
+        if (auto owner = cluster.owner.lock()) {
+            cluster.mngr->reset();
+            owner->notifyUpdate();
+        }
+    }
+    return true;
+}
+
+ArenaMemoryMngr::ArenaMemoryMngr(DynamicMemoryArenaPtr arena, size_t cluster)
+    : _arena(std::move(arena)), _cluster(cluster), _fallback(nullptr, release) {}
+
+void* ArenaMemoryMngr::getRawPtr() const noexcept {
+    switch (_mode) {
+    case Mode::External:
+        return _extPtr;
+    case Mode::Fallback:
+        return _fallback.get();
+    default:
+        return _arena->getPtr(_cluster);
+    }
+}
+
+void ArenaMemoryMngr::setExtBuff(void *ptr, size_t size) {
+    _mode = Mode::External;
+    _extPtr = ptr;
+    _size = size;
+}
+
+bool ArenaMemoryMngr::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    const size_t capacity = _mode == Mode::Arena ? _arena->getCapacity(_cluster) : _size;
+    if (size <= capacity) {
+        return false;
+    }
+
+    // the arena can't grow in the middle of the inference since the other clusters hold data,
+    // so the cluster is separately allocated until the next relayout
+    _arena->request(_cluster, size);
+    _fallback = decltype(_fallback)(allocate(size, cacheLineSize), destroy);
+    _mode = Mode::Fallback;
+    _size = size;
+    return true;
+}
+
+bool ArenaMemoryMngr::hasExtBuffer() const noexcept {
+    return _mode == Mode::External;
+}
+
+void ArenaMemoryMngr::reset() noexcept {
+    if (_mode == Mode::Fallback) {
+        _fallback.reset();
+        _mode = Mode::Arena;
+        _size = 0;
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory.h"
+#include "memory_solver.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class ArenaMemoryMngr;
+
+/**
+ * @brief A grow-only buffer shared by the clusters of the dynamic edges, which upper bound is unknown at compile time.
+ *        The clusters are placed in the buffer by the MemorySolver according to their high-water marks, so the clusters
+ *        which don't coexist in time share the same memory.
+ *        When a cluster requests more memory than it's planned, it falls back to a separate allocation for the rest of the
+ *        current inference, the high-water mark is updated and the buffer is re-solved on the next relayout() call.
+ *        Therefore after a warm-up the dynamic inference performs no allocations at all.
+ */
+class DynamicMemoryArena : public std::enable_shared_from_this<DynamicMemoryArena> {
+public:
+    /**
+     * @param boxes the clusters life time, the boxes id must be equal to their index, the size is ignored
+     */
+    explicit DynamicMemoryArena(std::vector<MemorySolver::Box> boxes);
+
+    /**
+     * @brief Creates the memory manager of the cluster
+     * @param cluster the cluster index
+     */
+    DnnlMemoryMngrPtr createMemoryMngr(size_t cluster);
+
+    /**
+     * @brief Re-solves the buffer for the updated high-water marks, must be called only when no data have to be preserved.
+     * @return whether the clusters memory was moved
+     */
+    bool relayout();
+
+    size_t getSize() const noexcept {
+        return _size;
+    }
+
+private:
+    friend class ArenaMemoryMngr;
+
+    void* getPtr(size_t cluster) const noexcept;
+    size_t getCapacity(size_t cluster) const noexcept;
+    void request(size_t cluster, size_t size);
+
+    static constexpr int64_t alignment = 64;  // bytes
+
+    std::vector<MemorySolver::Box> _boxes;
+    std::vector<int64_t> _offsets;
+    struct ClusterMngr {
+        std::weak_ptr<DnnlMemoryMngr> owner;
+        ArenaMemoryMngr* mngr = nullptr;  // is valid while the owner is alive
+    };
+    std::vector<ClusterMngr> _mngrs;
+    std::unique_ptr<void, void (*)(void *)> _data;
+    size_t _size = 0;
+    bool _dirty = false;
+};
+
+using DynamicMemoryArenaPtr = std::shared_ptr<DynamicMemoryArena>;
+
+/**
+ * @brief The memory manager of the DynamicMemoryArena cluster
+ */
+class ArenaMemoryMngr : public IMemoryMngr {
+public:
+    ArenaMemoryMngr(DynamicMemoryArenaPtr arena, size_t cluster);
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    /**
+     * @brief Returns the cluster memory back to the arena buffer
+     */
+    void reset() noexcept;
+
+private:
+    enum class Mode {
+        Arena,
+        Fallback,
+        External,
+    };
+
+    DynamicMemoryArenaPtr _arena;
+    size_t _cluster;
+    Mode _mode = Mode::Arena;
+    size_t _size = 0ul;
+    void* _extPtr = nullptr;
+    std::unique_ptr<void, void (*)(void *)> _fallback;
+};
+
+}  // namespace MKLDNNPlugin
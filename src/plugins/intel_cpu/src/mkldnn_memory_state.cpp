@@ -10,8 +10,101 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+MKLDNNVariableState::~MKLDNNVariableState() {
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    if (storage->owner == this)
+        storage->owner = nullptr;
+}
+
 void  MKLDNNVariableState::Reset() {
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    inStorage = false;
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    inStorage = false;
+    state = newState;
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    flush();
+    return state;
+}
+
+void MKLDNNVariableState::flush() const {
+    if (!inStorage || storage->owner != this || storage->buffer == state)
+        return;
+
+    cpu_memcpy(state->buffer(), storage->memory->GetData(), state->byteSize());
+    // the storage still holds the same value, so it stays the latest until the next inference or change
+}
+
+bool MKLDNNVariableState::canBind() const {
+    const auto& memory = storage->memory;
+    return memory->getDesc().isDefined() && state->byteSize() == memory->GetSize() &&
+           state->buffer().as<void*>() != nullptr;
+}
+
+void MKLDNNVariableState::bind(const Blob::Ptr& blob) {
+    if (storage->buffer == blob)
+        return;
+
+    storage->memory->setDataHandle(blob->buffer().as<void*>());
+    storage->buffer = blob;
+}
+
+const Blob::Ptr& MKLDNNVariableState::internalBuffer() {
+    if (!storage->internal) {
+        storage->internal = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->memory->getDesc()));
+        storage->internal->allocate();
+    }
+    return storage->internal;
+}
+
+void MKLDNNVariableState::detach() {
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    flush();
+    inStorage = false;
+    if (storage->owner == this)
+        storage->owner = nullptr;
+    // the graph of the storage may be inferred by another request, which must not write to the blob of this state
+    if (storage->buffer == state)
+        bind(internalBuffer());
+}
+
+void MKLDNNVariableState::push(const MKLDNNVariableStorage::Ptr& graphStorage) {
+    if (!graphStorage)
+        IE_THROW() << "The graph has no storage of the variable " << GetName();
+    if (graphStorage != storage) {
+        detach();
+        storage = graphStorage;
+    }
+
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    if (storage->owner == this && (inStorage || storage->buffer == state))
+        return;
+
+    if (storage->owner && storage->owner != this) {
+        storage->owner->flush();
+        storage->owner->inStorage = false;
+    }
+    if (canBind()) {
+        bind(state);
+    } else {
+        // the memory must not stay bound to the blob of another state, it would be overwritten
+        if (storage->buffer)
+            bind(internalBuffer());
+        cpu_memcpy(storage->memory->GetData(), state->cbuffer().as<const void*>(), state->byteSize());
+    }
+    storage->owner = this;
+}
+
+void MKLDNNVariableState::pull() {
+    std::lock_guard<std::mutex> lock{storage->mutex};
+    inStorage = true;
+}
+
 }  // namespace MKLDNNPlugin
@@ -10,20 +10,80 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace MKLDNNPlugin {
 
+class MKLDNNVariableState;
+
+/**
+ * @brief The storage of a variable in the graph, shared by the states of all the infer requests executed with the graph.
+ *        Keeps the state which value the storage holds. The storage memory is bound to the blob of that state, so the
+ *        graph reads and writes the state in place and switching the states only swaps the data handle. The value is
+ *        copied only for the state blobs which can't be bound (e.g. of another size).
+ */
+struct MKLDNNVariableStorage {
+    using Ptr = std::shared_ptr<MKLDNNVariableStorage>;
+
+    explicit MKLDNNVariableStorage(MKLDNNMemoryPtr memory) : memory(std::move(memory)) {}
+
+    MKLDNNMemoryPtr memory;
+    std::mutex mutex;
+    // the state whose latest value is in the memory, nullptr if there is no such state
+    MKLDNNVariableState* owner = nullptr;
+    // the blob the memory is bound to, keeps the buffer alive while the graph uses it
+    InferenceEngine::Blob::Ptr buffer;
+    // the own buffer of the storage used to copy the states which can't be bound, allocated on demand
+    InferenceEngine::Blob::Ptr internal;
+};
+
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+    MKLDNNVariableState(std::string name, MKLDNNVariableStorage::Ptr storage) :
+            InferenceEngine::IVariableStateInternal{name}, storage(std::move(storage)) {
+        const auto& memory = this->storage->memory;
+        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(memory->getDesc()));
         state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        cpu_memcpy(state->buffer(), memory->GetData(), memory->GetSize());
     }
+    ~MKLDNNVariableState();
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * @brief Makes the storage of the graph the request is inferred with hold the value of the state before the inference.
+     *        The storage is bound to the state blob, the value is copied only if the blob can't be bound and the storage
+     *        holds the value of another state or the state was changed by the user. If the request has moved to
+     *        another graph, the latest value is taken from the previous storage first.
+     */
+    void push(const MKLDNNVariableStorage::Ptr& graphStorage);
+
+    /**
+     * @brief Marks the value of the storage after the inference as the latest value of the state.
+     *        The value is copied to the state blob lazily: when it's requested or another state is pushed.
+     */
+    void pull();
+
+private:
+    // copies the storage to the blob if the storage holds the latest value, the storage mutex must be locked
+    void flush() const;
+    // whether the storage memory may use the state blob as its buffer
+    bool canBind() const;
+    // points the storage memory to the blob, the storage mutex must be locked
+    void bind(const InferenceEngine::Blob::Ptr& blob);
+    // returns the own buffer of the storage, the storage mutex must be locked
+    const InferenceEngine::Blob::Ptr& internalBuffer();
+    // moves the latest value from the storage to the blob and unbinds the storage from the blob
+    void detach();
+
+    // the storage of the graph the state was pushed to last
+    MKLDNNVariableStorage::Ptr storage;
+    // the latest value is in the storage rather than in the blob
+    mutable bool inStorage = false;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -38,6 +38,7 @@
 #include <nodes/mkldnn_normalize_node.h>
 #include <nodes/mkldnn_reduce_node.h>
 #include <nodes/mkldnn_tensoriterator_node.h>
+#include <transformations/utils/attributes_serializer.hpp>
 #include <nodes/mkldnn_scatter_update_node.h>
 #include <nodes/mkldnn_interpolate_node.h>
 #include <nodes/mkldnn_depth_to_space_node.h>
@@ -68,6 +69,8 @@ using namespace openvino;
 
 using namespace InferenceEngine::details;
 
+constexpr uint32_t MKLDNNNode::ALL_PORTS_MASK;
+
 MKLDNNNode::NodesFactory & MKLDNNNode::factory() {
     static NodesFactory factoryInstance;
     return factoryInstance;
@@ -115,6 +118,15 @@ MKLDNNNode::MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::en
         shapeInference = make_shape_inference(op);
     }
 
+    // the constants are identified by their content, the other operations by the attributes
+    if (w_cache && !ngraph::op::is_constant(op)) {
+        ngraph::op::util::AttributesSerializer serializer(attributesKey);
+        if (!op->visit_attributes(serializer) || !serializer.is_complete()) {
+            attributesKey.clear();
+            incompleteAttributes = true;
+        }
+    }
+
     const auto& rtInfo = op->get_rt_info();
     if (rtInfo.count("originalLayersNames")) {
         originalLayers = getRTInfoValue(rtInfo, "originalLayersNames");
@@ -514,9 +526,9 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
-void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
+void MKLDNNNode::executeDynamic(mkldnn::stream strm, const std::vector<VectorDims>* outputShapes) {
     if (needShapeInfer()) {
-        redefineOutputMemory(shapeInfer());
+        redefineOutputMemory(outputShapes ? *outputShapes : shapeInfer());
     }
     if (isExecutable()) {
         if (needPrepareParams()) {
@@ -553,6 +565,16 @@ void MKLDNNNode::redefineOutputMemory(const std::vector<VectorDims> &newOutputSh
     }
 }
 
+void MKLDNNNode::reserveOutputMemory(size_t port, const VectorDims &upperBoundDims) {
+    const size_t upperBoundSize = getBaseMemDescAtOutputPort(port)->cloneWithNewDims(upperBoundDims)->getCurrentMemSize();
+    for (const auto& edge : getChildEdgesAtPort(port)) {
+        const auto& mngr = edge->getMemoryPtr()->getDnnlMemoryMngr();
+        // the external buffer (e.g. the user blob of the output) is not replaced by the internal allocation
+        if (mngr && !mngr->hasExtBuffer())
+            mngr->resize(upperBoundSize);
+    }
+}
+
 void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
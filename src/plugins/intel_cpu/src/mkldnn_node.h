@@ -331,8 +331,21 @@ public:
     void resolveInPlaceEdges();
 
     virtual void execute(mkldnn::stream strm);
-    void executeDynamic(mkldnn::stream strm);
+    /**
+     * @brief Executes the dynamic node
+     * @param strm is the stream to execute at
+     * @param outputShapes is the output shapes already known for the current input shapes (e.g. recorded by the graph for
+     *        the same graph input shapes), if it's provided the shape inference is skipped
+     */
+    void executeDynamic(mkldnn::stream strm, const std::vector<VectorDims>* outputShapes = nullptr);
     void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
+    /**
+     * @brief Reserves the output memory for the upper bound of the data-dependent output shape, so the output memory
+     *        is not reallocated when the output shape known only after the computation grows up to the bound
+     * @param port is the output port
+     * @param upperBoundDims is the upper bound of the output shape derived from the input shapes
+     */
+    void reserveOutputMemory(size_t port, const VectorDims &upperBoundDims);
 
     virtual void initSupportedPrimitiveDescriptors();
 
@@ -419,6 +432,19 @@ public:
         return typeStr;
     }
 
+    /**
+     * @brief Returns the serialized attributes of the original operation if the weights are shared, so the constant
+     *        subgraphs computing the shared weights are told apart. Empty for the nodes inserted by the plugin
+     */
+    const std::string & getAttributesKey() const {
+        return attributesKey;
+    }
+
+    // the attributes of the original operation can't be serialized, so the node can't identify the shared weights
+    bool hasIncompleteAttributes() const {
+        return incompleteAttributes;
+    }
+
     void setTypeStr(const std::string &typeStr) {
         this->typeStr = typeStr;
     }
@@ -721,6 +747,15 @@ protected:
 
     bool inputShapesModified() const;
     virtual bool needShapeInfer() const;
+    /**
+     * @brief Returns the mask of the input ports whose data values (and not only shapes) define the output shapes.
+     *        The nodes, which compute the output shapes during the execution or keep some state in shapeInfer(), report
+     *        all the ports.
+     */
+    virtual uint32_t getShapeInferValuesMask() const {
+        return 0;
+    }
+    static constexpr uint32_t ALL_PORTS_MASK = 0xFFFFFFFF;
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& inputDims, uint32_t value_port_mask = 0) const;
     std::vector<VectorDims> shapeInferGeneric(uint32_t value_port_mask = 0) const;
     virtual std::vector<VectorDims> shapeInfer() const;
@@ -757,6 +792,8 @@ private:
 
     std::string name;
     std::string typeStr;
+    std::string attributesKey;
+    bool incompleteAttributes = false;
     Type type;
     int execIndex = -1;
 
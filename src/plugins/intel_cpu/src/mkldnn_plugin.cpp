@@ -9,6 +9,8 @@
 #include "mkldnn_extension.h"
 #include "mkldnn_itt.h"
 #include "mkldnn_serialize.h"
+#include "utils/cpu_isa.h"
+#include "utils/huge_pages.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -22,6 +24,7 @@
 #include <ie_system_conf.h>
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <openvino/op/util/read_value_base.hpp>
 
 #include <transformations/opset_conversions/convert_opset3_to_opset2.hpp>
 #include <transformations/opset_conversions/convert_opset2_to_opset1.hpp>
@@ -84,6 +87,7 @@
 #include <transformations/utils/utils.hpp>
 #include <snippets/pass/collapse_subgraph.hpp>
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
+#include "ngraph_transformations/scaled_dot_product_attention_fusion.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
@@ -166,7 +170,7 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(const std::shared_ptr<ngraph::Function>& nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets) {
+                                               const bool _enableSnippets, const bool _enableAttentionFusion) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -266,31 +270,23 @@ static void TransformationUpToCPUSpecificOpSet(const std::shared_ptr<ngraph::Fun
     };
 
     // Sequences supported by the plugin shouldn't be converted to TensorIterator.
-    // sequence_length input is not supported in all Sequences, so if is_seq_len_provided() == true, we
-    // should always convert to TensorIterator.
+    // The sequences shorter than the max length are executed by the plugin by the segments of the fixed active batch.
     // RNN/GRU/LSTM Sequences are supported with clip == 0, and with default activations.
     auto isSequencePrimitiveSupported = [](const_node_ptr &node) -> bool {
         const auto& data = node->input(0);
         const auto& data_pshape = data.get_partial_shape();
         if (data_pshape.rank().is_static() && data_pshape.rank().get_length() > 1 && !data_pshape[1].is_static())
             return false;
-        auto max_seq_len = data.get_shape().at(1);
         if (const auto &rnn_seq = std::dynamic_pointer_cast<const ngraph::opset6::RNNSequence>(node)) {
-            return rnn_seq->get_clip() == 0.0f &&
-                   !ngraph::op::util::is_seq_len_provided(rnn_seq->get_input_node_shared_ptr(2),
-                                                          max_seq_len);
+            return rnn_seq->get_clip() == 0.0f;
         } else if (const auto &gru_seq = std::dynamic_pointer_cast<const ngraph::opset6::GRUSequence>(
                 node)) {
             return gru_seq->get_clip() == 0.0f &&
-                   gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"} &&
-                   !ngraph::op::util::is_seq_len_provided(gru_seq->get_input_node_shared_ptr(2),
-                                                          max_seq_len);
+                   gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"};
         } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ngraph::opset6::LSTMSequence>(
                 node)) {
             return lstm_seq->get_clip() == 0.0f &&
-                   lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"} &&
-                   !ngraph::op::util::is_seq_len_provided(lstm_seq->get_input_node_shared_ptr(3),
-                                                          max_seq_len);
+                   lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"};
         }
         return false;
     };
@@ -521,6 +517,9 @@ static void TransformationUpToCPUSpecificOpSet(const std::shared_ptr<ngraph::Fun
     });
 
     postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>();
+    // the attention is fused before the tokenization, so the snippets don't take the scaling and the mask of the scores
+    if (_enableAttentionFusion)
+        postLPTPassManager.register_pass<ScaledDotProductAttentionFusion>();
     postLPTPassManager.run_passes(nGraphFunc);
 
     if (!useLpt && _enableSnippets && with_cpu_x86_avx2()) {
@@ -538,7 +537,7 @@ static void TransformationUpToCPUSpecificOpSet(const std::shared_ptr<ngraph::Fun
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -552,9 +551,10 @@ static void TransformationUpToCPUSpecificOpSet(const std::shared_ptr<ngraph::Fun
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets,
+                           const bool _enableAttentionFusion) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, _enableAttentionFusion);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
@@ -599,8 +599,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& attentionFusionProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION);
+    const bool enableAttentionFusion = attentionFusionProp != config.end() ? attentionFusionProp->second == PluginConfigParams::YES
+                                                                           : engConfig.attentionFusion;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, enableAttentionFusion);
 
     // Here the OV perf modes are turned into specific settings (as we need the network for better params selection)
     const auto& mode = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
@@ -640,8 +643,8 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
                 ov::MemBandwidthPressure networkToleranceForLowCache = ov::MemBandwidthPressureTolerance(
                         clonedNetwork.getFunction(),
                         L2_cache_size, memThresholdAssumeLimitedForISA);
-                // num of phys CPU cores (most aggressive value for #streams)
-                const auto num_cores = getNumberOfCPUCores();
+                // num of phys CPU cores within the CPU quota (most aggressive value for #streams)
+                const auto num_cores = limitByCPUQuota(getNumberOfCPUCores());
                 // less aggressive
                 const auto num_streams_less_aggressive = num_cores / 2;
                 // default #streams value (most conservative)
@@ -684,7 +687,75 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, shared_from_this());
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing,
+                                                           getSharedRuntimeCache(conf), shared_from_this());
+
+    // the states are kept by the graphs, so the stateful models can't switch between the networks
+    const auto& function = network.getFunction();
+    if (!conf.shapeSpecializations.empty() && function && function->is_dynamic() && conf.batchLimit == 0 &&
+        !ngraph::op::util::has_op_with_type<ov::op::util::ReadValueBase>(function)) {
+        // the specializations are compiled from the original model, so the static shapes are propagated before all
+        // the transformations and the static networks don't create the specializations themselves
+        auto specializationConfig = config;
+        specializationConfig[PluginConfigInternalParams::KEY_CPU_SHAPE_SPECIALIZATIONS] = "";
+        for (const auto& shapes : conf.shapeSpecializations) {
+            CNNNetwork specializedNetwork = InferenceEngine::details::cloneNetwork(network);
+            specializedNetwork.reshape(shapes);
+            if (specializedNetwork.getFunction()->is_dynamic())
+                IE_THROW() << "The shapes specialization of the model " << network.getName()
+                           << " doesn't define all its dynamic inputs";
+            auto specializedExecNetwork = std::static_pointer_cast<MKLDNNExecNetwork>(
+                LoadExeNetworkImpl(specializedNetwork, specializationConfig));
+            SetExeNetworkInfo(specializedExecNetwork, constMapCast(specializedNetwork.getInputsInfo()),
+                              constMapCast(specializedNetwork.getOutputsInfo()));
+            SetExeNetworkInfo(specializedExecNetwork, specializedNetwork.getFunction());
+            execNetwork->addShapeSpecialization(shapes, specializedExecNetwork);
+        }
+    }
+    return execNetwork;
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
+                           const std::shared_ptr<InferenceEngine::RemoteContext>& context,
+                           const std::map<std::string, std::string> &config) {
+    if (!std::dynamic_pointer_cast<CPURemoteContext>(context))
+        IE_THROW() << "CPU plugin can't compile the network with the context of "
+                   << (context ? context->getDeviceName() : "null");
+    auto execNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(LoadExeNetworkImpl(network, config));
+    execNetwork->setContext(context);
+    return execNetwork;
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> Engine::CreateContext(const InferenceEngine::ParamMap& params) {
+    return std::make_shared<CPURemoteContext>(params);
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> Engine::GetDefaultContext(const InferenceEngine::ParamMap& params) {
+    // the parameters of the default context are fixed, the context with other ones is created by CreateContext
+    std::lock_guard<std::mutex> lock{defaultContextMutex};
+    if (!defaultContext)
+        defaultContext = std::make_shared<CPURemoteContext>();
+    return defaultContext;
+}
+
+MultiCachePtr Engine::getSharedRuntimeCache(const Config& config) {
+    if (!config.rtCacheShared)
+        return nullptr;
+
+    // the model config only opts in, the limits are the plugin ones, so they don't depend on the model compiled first
+    const bool costInBytes = engConfig.rtCacheSharedBytes != 0;
+    const size_t capacity = costInBytes ? engConfig.rtCacheSharedBytes : engConfig.rtCacheCapacity;
+
+    std::lock_guard<std::mutex> lock{sharedRtCacheMutex};
+    // the models compiled before the limits are changed keep the previous cache
+    if (!sharedRtCache || sharedRtCache->getCapacity() != capacity || sharedRtCache->isCostInBytes() != costInBytes) {
+        // the cache is accessed by all the streams of all the compiled models, so split it into a number of
+        // independently locked shards to keep the contention low
+        const auto shards = static_cast<size_t>(std::max(1, parallel_get_max_threads()));
+        sharedRtCache = std::make_shared<MultiCache>(capacity, shards, costInBytes);
+    }
+    return sharedRtCache;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -811,6 +882,18 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
     } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
         IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_EFFECTIVE_ISA) {
+        return isa::getEffectiveCpuIsa();
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_EFFECTIVE_TOPOLOGY) {
+        const std::map<std::string, int> topology = {
+            {"numa_nodes", static_cast<int>(getAvailableNUMANodes().size())},
+            {"physical_cores", getNumberOfCPUCores()},
+            {"logical_cores", getNumberOfLogicalCPUCores()},
+            {"cpu_quota", getCPUQuota()},
+        };
+        return topology;
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_HUGE_PAGES_BYTES) {
+        return hugepages::getBytes();
     }
 
     IE_CPU_PLUGIN_THROW() << "Unsupported metric key: " << name;
@@ -907,7 +990,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16 && with_cpu_x86_avx512_core()));
-        Transformation(clonedNetwork, enableLPT, enableSnippets);
+        Transformation(clonedNetwork, enableLPT, enableSnippets, conf.attentionFusion);
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
@@ -990,7 +1073,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing, shared_from_this());
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing,
+                                                           getSharedRuntimeCache(conf), shared_from_this());
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
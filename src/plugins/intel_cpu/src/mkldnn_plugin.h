@@ -6,6 +6,7 @@
 
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "mkldnn_exec_network.h"
+#include "cpu_remote_context.h"
 
 #include <string>
 #include <map>
@@ -14,6 +15,7 @@
 #include <functional>
 #include <vector>
 #include <cfloat>
+#include <mutex>
 
 namespace MKLDNNPlugin {
 
@@ -40,15 +42,31 @@ public:
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
                                                      const std::map<std::string, std::string>& config) override;
 
+    std::shared_ptr<InferenceEngine::RemoteContext> CreateContext(const InferenceEngine::ParamMap& params) override;
+
+    std::shared_ptr<InferenceEngine::RemoteContext> GetDefaultContext(const InferenceEngine::ParamMap& params) override;
+
+protected:
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+    LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
+                       const std::shared_ptr<InferenceEngine::RemoteContext>& context,
+                       const std::map<std::string, std::string> &config) override;
+
 private:
     bool isLegacyAPI() const;
 
+    MultiCachePtr getSharedRuntimeCache(const Config& config);
+
     InferenceEngine::Parameter GetMetricLegacy(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const;
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const;
 
     Config engConfig;
     NumaNodesWeights weightsSharing;
+    std::mutex sharedRtCacheMutex;
+    MultiCachePtr sharedRtCache;
+    std::mutex defaultContextMutex;
+    CPURemoteContext::Ptr defaultContext;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
     bool streamsSet = false;
     const std::string deviceFullName;
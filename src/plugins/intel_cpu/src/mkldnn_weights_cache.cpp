@@ -3,9 +3,13 @@
 //
 
 #include "mkldnn_weights_cache.hpp"
+#include "utils/general_utils.h"
+#include "utils/numa_utils.h"
 
+#include <ie_parallel.hpp>
 #include <ie_system_conf.h>
 #include <memory>
+#include <sstream>
 
 namespace MKLDNNPlugin {
 
@@ -45,6 +49,7 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            place(newPtr);
             ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -54,6 +59,38 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreateEqual(
+                            const std::string& key,
+                            std::function<MKLDNNMemoryPtr(void)> create,
+                            std::function<bool(const MKLDNNMemory&)> equal,
+                            std::string& resolvedKey) {
+    for (size_t collisions = 0;; collisions++) {
+        resolvedKey = collisions ? key + "_collision" + std::to_string(collisions) : key;
+        MKLDNNMemoryInfo::Ptr ptr;
+        MKLDNNMemoryPtr newPtr;
+        {
+            std::unique_lock<std::mutex> lock(guard);
+            auto found = sharedWeights.find(resolvedKey);
+
+            if (found == sharedWeights.end()
+                || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
+                newPtr = create();
+                place(newPtr);
+                ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, true);
+                sharedWeights[resolvedKey] = ptr;
+                return std::make_shared<MKLDNNSharedMemory>(std::unique_lock<std::mutex>(ptr->guard, std::defer_lock),
+                                                            ptr, newPtr);
+            }
+        }
+        // the content is compared out of the cache lock, the memory being filled is waited for
+        std::unique_lock<std::mutex> memoryLock(ptr->guard, std::defer_lock);
+        if (!ptr->valid.load(std::memory_order_acquire))
+            memoryLock.lock();
+        if (equal(*newPtr))
+            return std::make_shared<MKLDNNSharedMemory>(std::move(memoryLock), ptr, newPtr);
+    }
+}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
     MKLDNNMemoryInfo::Ptr ptr;
     MKLDNNMemoryPtr newPtr;
@@ -70,9 +107,104 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+std::string MKLDNNWeightsSharing::getContentKey(const std::shared_ptr<ngraph::op::Constant>& constant) {
+    {
+        std::lock_guard<std::mutex> lock(contentKeysGuard);
+        auto found = contentKeys.find(constant.get());
+        // the node might have been destroyed and another one created at the same address
+        if (found != contentKeys.end() && found->second.first.lock() == constant)
+            return found->second.second;
+    }
+
+    // the chunks are hashed in parallel, then the hashes of the chunks are hashed
+    static constexpr size_t chunkSize = 1 << 20;
+    const auto data = static_cast<const unsigned char*>(constant->get_data_ptr());
+    const size_t size = constant->get_byte_size();
+    std::vector<uint64_t> chunkHashes(div_up(size, chunkSize));
+    InferenceEngine::parallel_for(chunkHashes.size(), [&](size_t i) {
+        chunkHashes[i] = simpleCRC.hash(data + i * chunkSize, std::min(chunkSize, size - i * chunkSize));
+    });
+    const auto hash = simpleCRC.hash(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                                     chunkHashes.size() * sizeof(uint64_t));
+
+    std::stringstream key;
+    key << "content_" << constant->get_element_type() << "_" << constant->get_shape() << "_" << size << "_" << hash;
+
+    std::lock_guard<std::mutex> lock(contentKeysGuard);
+    if (contentKeys.size() >= contentKeysPruneSize) {
+        for (auto it = contentKeys.begin(); it != contentKeys.end();) {
+            it = it->second.first.expired() ? contentKeys.erase(it) : std::next(it);
+        }
+        contentKeysPruneSize = std::max<size_t>(64, contentKeys.size() * 2);
+    }
+    contentKeys[constant.get()] = {constant, key.str()};
+    return key.str();
+}
+
+void MKLDNNWeightsSharing::place(const MKLDNNMemoryPtr& memory) const {
+    if (numaNodes.empty() || !memory || !memory->isAllocated())
+        return;
+
+    // the placement is a hint, so the weights stay where they are if it's not supported by the system
+    if (numaNodes.size() == 1)
+        numa::bindToNode(memory->GetData(), memory->GetSize(), numaNodes.front());
+    else
+        numa::interleave(memory->GetData(), memory->GetSize(), numaNodes);
+}
+
+std::map<int, size_t> MKLDNNWeightsSharing::getBytesPerNumaNode() const {
+    std::map<int, size_t> bytes;
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& weights : sharedWeights) {
+        const auto memory = weights.second ? weights.second->sharedMemory.lock() : nullptr;
+        if (!memory || !memory->isAllocated())
+            continue;
+        for (const auto& nodeBytes : numa::getBytesPerNode(memory->GetData(), memory->GetSize()))
+            bytes[nodeBytes.first] += nodeBytes.second;
+    }
+    return bytes;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    // the explicit placement makes sense only for the multi-node systems
+    const bool isMultiNode = numaNodes.size() > 1;
+    for (auto numa_id : numaNodes)
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(isMultiNode ? std::vector<int>{numa_id} : std::vector<int>{});
+    _interleaved = isMultiNode ? std::make_shared<MKLDNNWeightsSharing>(numaNodes) : _cache_map.begin()->second;
+}
+
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::get(int numaNodeId, Config::WeightsNumaPolicy policy) {
+    switch (policy) {
+    case Config::WeightsNumaPolicy::SingleNode:
+        return _cache_map.begin()->second;
+    case Config::WeightsNumaPolicy::Interleave:
+        return _interleaved;
+    default:
+        return (*this)[numaNodeId];
+    }
+}
+
+std::map<int, size_t> NumaNodesWeights::getBytesPerNumaNode(Config::WeightsNumaPolicy policy) const {
+    std::vector<MKLDNNWeightsSharing::Ptr> caches;
+    switch (policy) {
+    case Config::WeightsNumaPolicy::SingleNode:
+        caches.push_back(_cache_map.begin()->second);
+        break;
+    case Config::WeightsNumaPolicy::Interleave:
+        caches.push_back(_interleaved);
+        break;
+    default:
+        for (const auto& cache : _cache_map)
+            caches.push_back(cache.second);
+    }
+
+    std::map<int, size_t> bytes;
+    for (const auto& cache : caches) {
+        for (const auto& nodeBytes : cache->getBytesPerNumaNode())
+            bytes[nodeBytes.first] += nodeBytes.second;
+    }
+    return bytes;
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <ngraph/op/constant.hpp>
+#include "config.h"
 
 #include <unordered_map>
 #include <functional>
@@ -13,6 +15,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -69,6 +72,12 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    /**
+     * @param numaNodes NUMA nodes the created memory is placed on: the memory is bound to the single node or interleaved
+     *        over several ones, no explicit placement is performed if empty
+     */
+    explicit MKLDNNWeightsSharing(std::vector<int> numaNodes = {}) : numaNodes(std::move(numaNodes)) {}
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -91,13 +100,41 @@ public:
                                          std::function<MKLDNNMemoryPtr(void)> create,
                                          bool valid = true);
 
+    /**
+     * @brief Returns the cached memory only if the equal function confirms its content, since the content keys are
+     *        hashes and may collide. The memory of the colliding key is cached by the key with the next suffix
+     * @param resolvedKey the key the memory is actually cached by, it identifies the content without collisions
+     */
+    MKLDNNSharedMemory::Ptr findOrCreateEqual(const std::string& key,
+                                              std::function<MKLDNNMemoryPtr(void)> create,
+                                              std::function<bool(const MKLDNNMemory&)> equal,
+                                              std::string& resolvedKey);
+
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * @brief Returns the key identifying the constant by its content, so the same weights of the different models
+     *        share the cached memory. The data is hashed once per constant, the key is remembered while it's alive
+     */
+    std::string getContentKey(const std::shared_ptr<ngraph::op::Constant>& constant);
+
+    /**
+     * @brief Reports where the cached memory is physically placed
+     * @return the number of bytes per NUMA node, -1 stands for the bytes which placement is unknown
+     */
+    std::map<int, size_t> getBytesPerNumaNode() const;
+
 protected:
+    void place(const MKLDNNMemoryPtr& memory) const;
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    std::mutex contentKeysGuard;
+    std::unordered_map<const ngraph::Node*, std::pair<std::weak_ptr<ngraph::Node>, std::string>> contentKeys;
+    size_t contentKeysPruneSize = 64;
+    const std::vector<int> numaNodes;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -113,8 +150,22 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Returns the memory caching store for the stream running on the NUMA node according to the policy:
+     *        Replicate - the store of the stream NUMA node, the weights are replicated on each node;
+     *        SingleNode - the store of the first NUMA node shared by all the streams;
+     *        Interleave - the store shared by all the streams, which memory is interleaved over all the NUMA nodes.
+     */
+    MKLDNNWeightsSharing::Ptr& get(int numaNodeId, Config::WeightsNumaPolicy policy);
+
+    /**
+     * @brief Reports the physical placement of the weights of all the stores used with the policy
+     */
+    std::map<int, size_t> getBytesPerNumaNode(Config::WeightsNumaPolicy policy) const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    MKLDNNWeightsSharing::Ptr _interleaved;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node>& Q,
+                                                                           const ngraph::Output<Node>& K,
+                                                                           const ngraph::Output<Node>& V,
+                                                                           const float scale,
+                                                                           const bool key_transposed)
+    : Op({Q, K, V}), m_scale(scale), m_key_transposed(key_transposed) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node>& Q,
+                                                                           const ngraph::Output<Node>& K,
+                                                                           const ngraph::Output<Node>& V,
+                                                                           const ngraph::Output<Node>& mask,
+                                                                           const float scale,
+                                                                           const bool key_transposed)
+    : Op({Q, K, V, mask}), m_scale(scale), m_key_transposed(key_transposed) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledDotProductAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                                             m_scale, m_key_transposed);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                                             m_scale, m_key_transposed);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+}
+
+void MKLDNNPlugin::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    const auto q_pshape = get_input_partial_shape(0);
+    const auto k_pshape = get_input_partial_shape(1);
+    const auto v_pshape = get_input_partial_shape(2);
+
+    ngraph::PartialShape output_pshape = ngraph::PartialShape::dynamic();
+    if (q_pshape.rank().is_static() && k_pshape.rank().is_static() && v_pshape.rank().is_static()) {
+        const auto rank = q_pshape.rank().get_length();
+        NODE_VALIDATION_CHECK(this,
+            rank >= 2 && k_pshape.rank().get_length() == rank && v_pshape.rank().get_length() == rank,
+            "Query, key and value must have the same rank not less than 2. Current values are: ",
+            q_pshape, ", ", k_pshape, ", ", v_pshape, ".");
+
+        const auto& head_size = q_pshape[rank - 1];
+        const auto& key_head_size = m_key_transposed ? k_pshape[rank - 1] : k_pshape[rank - 2];
+        const auto& key_length = m_key_transposed ? k_pshape[rank - 2] : k_pshape[rank - 1];
+        NODE_VALIDATION_CHECK(this,
+            head_size.compatible(key_head_size) && key_length.compatible(v_pshape[rank - 2]),
+            "Query, key and value shapes are inconsistent: ", q_pshape, ", ", k_pshape, ", ", v_pshape, ".");
+
+        auto batch_pshape = [rank](const ngraph::PartialShape& pshape) {
+            return ngraph::PartialShape(std::vector<ngraph::Dimension>(pshape.begin(), pshape.begin() + (rank - 2)));
+        };
+        auto scores_pshape = batch_pshape(q_pshape);
+        NODE_VALIDATION_CHECK(this,
+            ngraph::PartialShape::broadcast_merge_into(scores_pshape, batch_pshape(k_pshape), ngraph::op::AutoBroadcastType::NUMPY) &&
+            ngraph::PartialShape::broadcast_merge_into(scores_pshape, batch_pshape(v_pshape), ngraph::op::AutoBroadcastType::NUMPY),
+            "Batch dimensions of query, key and value aren't broadcastable: ", q_pshape, ", ", k_pshape, ", ", v_pshape, ".");
+        scores_pshape.push_back(q_pshape[rank - 2]);
+        scores_pshape.push_back(key_length);
+
+        if (input_size == 4) {
+            const auto& mask_pshape = get_input_partial_shape(3);
+            NODE_VALIDATION_CHECK(this,
+                mask_pshape.rank().is_dynamic() || mask_pshape.rank().get_length() <= rank,
+                "Mask rank must not be greater than the rank of the scores. Current value is: ", mask_pshape, ".");
+            NODE_VALIDATION_CHECK(this,
+                ngraph::PartialShape::broadcast_merge_into(scores_pshape, mask_pshape, ngraph::op::AutoBroadcastType::NUMPY),
+                "Mask isn't broadcastable to the scores: ", mask_pshape, ", ", scores_pshape, ".");
+        }
+
+        output_pshape = scores_pshape;
+        output_pshape[rank - 1] = v_pshape[rank - 1];
+    }
+
+    set_output_type(0, get_input_element_type(0), output_pshape);
+}
+
+bool MKLDNNPlugin::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("key_transposed", m_key_transposed);
+    return true;
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Computes softmax(Q * K^T * scale + mask) * V over the last two dimensions of the inputs:
+ *        Q [B1, ..., Bn, Lq, D], K [B1, ..., Bn, Lk, D] (or [B1, ..., Bn, D, Lk] if the key isn't transposed),
+ *        V [B1, ..., Bn, Lk, Dv] and the optional mask broadcastable to [B1, ..., Bn, Lq, Lk].
+ *        The result is [B1, ..., Bn, Lq, Dv]. The batch dimensions of the inputs and the mask are broadcast by the numpy
+ *        rules as by the MatMul and Add operations of the fused subgraph.
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::Output<Node> &Q,
+                                  const ngraph::Output<Node> &K,
+                                  const ngraph::Output<Node> &V,
+                                  float scale,
+                                  bool key_transposed);
+
+    ScaledDotProductAttentionNode(const ngraph::Output<Node> &Q,
+                                  const ngraph::Output<Node> &K,
+                                  const ngraph::Output<Node> &V,
+                                  const ngraph::Output<Node> &mask,
+                                  float scale,
+                                  bool key_transposed);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_key_transposed() const { return m_key_transposed; }
+
+private:
+    float m_scale = 1.f;
+    bool m_key_transposed = true;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_fusion.hpp"
+#include "op/scaled_dot_product_attention.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+bool hasSingleConsumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool getScalarValue(const ngraph::Output<ngraph::Node>& output, float& value) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+int64_t getSoftmaxAxis(const std::shared_ptr<ngraph::Node>& node, int64_t rank) {
+    if (const auto softmax = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(node))
+        return static_cast<int64_t>(softmax->get_axis());
+    if (const auto softmax = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(node))
+        return softmax->get_axis() < 0 ? softmax->get_axis() + rank : softmax->get_axis();
+    return -1;
+}
+}  // namespace
+
+MKLDNNPlugin::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::consumers_count(1));
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, ngraph::pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        const auto outMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output.at(matmul).get_node_shared_ptr());
+        const auto softmaxNode = pattern_to_output.at(softmax).get_node_shared_ptr();
+        if (!outMatMul || outMatMul->get_transpose_a() || outMatMul->get_transpose_b() || transformation_callback(outMatMul))
+            return false;
+
+        const auto rank = outMatMul->get_output_partial_shape(0).rank();
+        if (rank.is_dynamic() || rank.get_length() < 2 || getSoftmaxAxis(softmaxNode, rank.get_length()) != rank.get_length() - 1)
+            return false;
+
+        ngraph::NodeVector fused{outMatMul, softmaxNode};
+        auto scores = softmaxNode->input_value(0);
+
+        // the mask is added to the scaled scores, so the scores are the input coming from the MatMul chain
+        ngraph::Output<ngraph::Node> mask;
+        if (ngraph::is_type<ngraph::opset1::Add>(scores.get_node()) && hasSingleConsumer(scores)) {
+            const auto add = scores.get_node_shared_ptr();
+            auto isScoresInput = [](const ngraph::Output<ngraph::Node>& input) {
+                return hasSingleConsumer(input) &&
+                       (ngraph::is_type<ngraph::opset1::MatMul>(input.get_node()) ||
+                        ngraph::is_type<ngraph::opset1::Multiply>(input.get_node()) ||
+                        ngraph::is_type<ngraph::opset1::Divide>(input.get_node()));
+            };
+            const size_t scoresPort = isScoresInput(add->input_value(0)) ? 0 : 1;
+            if (!isScoresInput(add->input_value(scoresPort)))
+                return false;
+            mask = add->input_value(1 - scoresPort);
+            scores = add->input_value(scoresPort);
+            fused.push_back(add);
+        }
+
+        float scale = 1.f;
+        if ((ngraph::is_type<ngraph::opset1::Multiply>(scores.get_node()) || ngraph::is_type<ngraph::opset1::Divide>(scores.get_node())) &&
+            hasSingleConsumer(scores)) {
+            const auto scaleNode = scores.get_node_shared_ptr();
+            const bool isDivide = ngraph::is_type<ngraph::opset1::Divide>(scaleNode);
+            size_t scoresPort = 0;
+            if (!getScalarValue(scaleNode->input_value(1), scale)) {
+                if (isDivide || !getScalarValue(scaleNode->input_value(0), scale))
+                    return false;
+                scoresPort = 1;
+            }
+            if (isDivide) {
+                if (scale == 0.f)
+                    return false;
+                scale = 1.f / scale;
+            }
+            scores = scaleNode->input_value(scoresPort);
+            fused.push_back(scaleNode);
+        }
+
+        const auto inMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(scores.get_node_shared_ptr());
+        if (!inMatMul || inMatMul->get_transpose_a() || !hasSingleConsumer(scores))
+            return false;
+        fused.push_back(inMatMul);
+
+        const auto query = inMatMul->input_value(0);
+        const auto key = inMatMul->input_value(1);
+        const auto value = outMatMul->input_value(1);
+        auto isSupportedInput = [&](const ngraph::Output<ngraph::Node>& input) {
+            return input.get_element_type() == ngraph::element::f32 && input.get_partial_shape().rank() == rank;
+        };
+        if (!isSupportedInput(query) || !isSupportedInput(key) || !isSupportedInput(value))
+            return false;
+        if (mask.get_node() && (mask.get_element_type() != ngraph::element::f32 || mask.get_partial_shape().rank().is_dynamic() ||
+                                mask.get_partial_shape().rank().get_length() > rank.get_length()))
+            return false;
+
+        std::shared_ptr<ngraph::Node> attention;
+        if (mask.get_node()) {
+            attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(query, key, value, mask, scale, inMatMul->get_transpose_b());
+        } else {
+            attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(query, key, value, scale, inMatMul->get_transpose_b());
+        }
+        // the node broadcasts the batch dimensions and the mask as the subgraph does, so the shapes only have to agree
+        if (!attention->get_output_partial_shape(0).compatible(outMatMul->get_output_partial_shape(0)))
+            return false;
+        attention->set_friendly_name(outMatMul->get_friendly_name());
+        ngraph::copy_runtime_info(fused, attention);
+        ngraph::replace_node(outMatMul, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "ScaledDotProductAttentionFusion");
+    this->register_matcher(m, callback);
+}
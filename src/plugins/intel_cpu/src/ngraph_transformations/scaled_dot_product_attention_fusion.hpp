@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Fuses MatMul(Q, K) -> [Multiply/Divide by scalar] -> [Add(mask)] -> Softmax(last axis) -> MatMul(., V)
+ *        into ScaledDotProductAttention, so the attention scores aren't materialized.
+ */
+class ScaledDotProductAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledDotProductAttentionFusion();
+};
+
+}  // namespace MKLDNNPlugin
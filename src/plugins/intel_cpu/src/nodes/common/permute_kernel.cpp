@@ -23,6 +23,7 @@ using namespace mkldnn::impl::utils;
 using namespace Xbyak;
 
 #define GET_OFF(field) offsetof(jit_args_permute, field)
+#define GET_TILE_OFF(field) offsetof(jit_args_transpose_tile, field)
 
 template <cpu_isa_t isa>
 struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_generator {
@@ -139,6 +140,117 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(1);
 };
 
+// Transposes the 8x8 tiles of the 32-bit elements in the registers: the source rows are read by the vectors of 8
+// elements and become the destination columns
+struct jit_transpose_tile_kernel_32bit : public jit_uni_transpose_tile_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_transpose_tile_kernel_32bit)
+
+    explicit jit_transpose_tile_kernel_32bit(jit_transpose_tile_config_params jcp_) : jit_uni_transpose_tile_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_TILE_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_TILE_OFF(dst)]);
+        mov(reg_src_row_len, ptr[reg_params + GET_TILE_OFF(src_row_len)]);
+        mov(reg_dst_row_len, ptr[reg_params + GET_TILE_OFF(dst_row_len)]);
+        mov(reg_src_stride, jcp.src_stride);
+        mov(reg_dst_stride, jcp.dst_stride);
+
+        Xbyak::Label src_rows_loop_label;
+        Xbyak::Label src_rows_loop_end_label;
+        Xbyak::Label src_row_loop_label;
+        Xbyak::Label src_row_loop_end_label;
+
+        // the tiles of the same source rows are written to the consecutive destination rows
+        L(src_rows_loop_label); {
+            cmp(reg_dst_row_len, 0);
+            jle(src_rows_loop_end_label, T_NEAR);
+
+            mov(reg_work_amount, reg_src_row_len);
+            mov(aux_reg_src, reg_src);
+            mov(aux_reg_dst, reg_dst);
+            L(src_row_loop_label); {
+                cmp(reg_work_amount, 0);
+                jle(src_row_loop_end_label, T_NEAR);
+
+                transpose_tile();
+
+                add(aux_reg_src, tile_size * sizeof(float));
+                mov(reg_ptr, jcp.dst_stride * tile_size);
+                add(aux_reg_dst, reg_ptr);
+                sub(reg_work_amount, tile_size);
+
+                jmp(src_row_loop_label, T_NEAR);
+            }
+            L(src_row_loop_end_label);
+
+            mov(reg_ptr, jcp.src_stride * tile_size);
+            add(reg_src, reg_ptr);
+            add(reg_dst, tile_size * sizeof(float));
+            sub(reg_dst_row_len, tile_size);
+
+            jmp(src_rows_loop_label, T_NEAR);
+        }
+        L(src_rows_loop_end_label);
+
+        this->postamble();
+    }
+
+private:
+    static constexpr size_t tile_size = 8;
+
+    void transpose_tile() {
+        mov(reg_ptr, aux_reg_src);
+        for (size_t i = 0; i < tile_size; i++) {
+            vmovups(Ymm(i), ptr[reg_ptr]);
+            add(reg_ptr, reg_src_stride);
+        }
+
+        // the pairs of the rows are interleaved: (0 1) (2 3) ...
+        for (size_t i = 0; i < tile_size; i += 2) {
+            vunpcklps(Ymm(tile_size + i), Ymm(i), Ymm(i + 1));
+            vunpckhps(Ymm(tile_size + i + 1), Ymm(i), Ymm(i + 1));
+        }
+        // the quads of the rows are gathered in the 128-bit lanes
+        for (size_t i = 0; i < tile_size; i += 4) {
+            vshufps(Ymm(i), Ymm(tile_size + i), Ymm(tile_size + i + 2), 0x44);
+            vshufps(Ymm(i + 1), Ymm(tile_size + i), Ymm(tile_size + i + 2), 0xEE);
+            vshufps(Ymm(i + 2), Ymm(tile_size + i + 1), Ymm(tile_size + i + 3), 0x44);
+            vshufps(Ymm(i + 3), Ymm(tile_size + i + 1), Ymm(tile_size + i + 3), 0xEE);
+        }
+        // the lower and the upper lanes make the columns 0-3 and 4-7
+        for (size_t i = 0; i < tile_size / 2; i++) {
+            vperm2f128(Ymm(tile_size + i), Ymm(i), Ymm(i + tile_size / 2), 0x20);
+            vperm2f128(Ymm(tile_size + i + tile_size / 2), Ymm(i), Ymm(i + tile_size / 2), 0x31);
+        }
+
+        mov(reg_ptr, aux_reg_dst);
+        for (size_t i = 0; i < tile_size; i++) {
+            vmovups(ptr[reg_ptr], Ymm(tile_size + i));
+            add(reg_ptr, reg_dst_stride);
+        }
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_src_row_len = r10;
+    Xbyak::Reg64 reg_dst_row_len = r11;
+    Xbyak::Reg64 aux_reg_src = r12;
+    Xbyak::Reg64 aux_reg_dst = r13;
+    Xbyak::Reg64 reg_src_stride = r14;
+    Xbyak::Reg64 reg_dst_stride = r15;
+    Xbyak::Reg64 reg_work_amount = rbx;
+    Xbyak::Reg64 reg_ptr = rax;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+};
+
 PermuteKernel::PermuteKernel(const PermuteParams& params) : params(params) {
     prepareParams();
 }
@@ -265,9 +377,41 @@ void PermuteKernel::prepareParams() {
 
     if (permute_kernel)
         permute_kernel->create_ker();
+
+    prepareTranspose();
+}
+
+void PermuteKernel::prepareTranspose() {
+    const size_t ndims = jcp.ndims;
+    if (ndims < 2 || jcp.dst_strides[ndims - 1] != 1 || jcp.src_strides[ndims - 1] == 1)
+        return;
+    if (!one_of(jcp.data_size, 1, 2, 4, 8))
+        return;
+
+    const size_t src_inner_dim = std::distance(jcp.src_strides.begin(),
+                                               std::find(jcp.src_strides.begin(), jcp.src_strides.end() - 1, 1));
+    // the small matrices are copied faster by the permute kernel
+    if (src_inner_dim == ndims - 1 || jcp.dst_block_dims[src_inner_dim] < 8 || jcp.dst_block_dims[ndims - 1] < 8)
+        return;
+
+    is_transpose = true;
+    transpose_src_inner_dim = src_inner_dim;
+
+    if (jcp.data_size == sizeof(float) && mayiuse(cpu::x64::avx2)) {
+        jit_transpose_tile_config_params tile_jcp;
+        tile_jcp.src_stride = jcp.src_strides[ndims - 1] * jcp.data_size;
+        tile_jcp.dst_stride = jcp.dst_strides[src_inner_dim] * jcp.data_size;
+        transpose_kernel.reset(new jit_transpose_tile_kernel_32bit(tile_jcp));
+        transpose_kernel->create_ker();
+    }
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (is_transpose) {
+        transposeExecute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -278,6 +422,11 @@ void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const in
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data) {
     SizeVector dst_dims = jcp.dst_block_dims;
+    if (is_transpose) {
+        transposeExecute(src_data, dst_data, dst_dims[0]);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, dst_dims[0]);
         return;
@@ -335,6 +484,98 @@ void PermuteKernel::optimizedExecute(const uint8_t* src_data, uint8_t* dst_data,
     return;
 }
 
+template <typename T>
+static void transpose_block_ref(const uint8_t* src_data, uint8_t* dst_data, size_t src_row_len, size_t dst_row_len,
+                                size_t src_row_stride, size_t dst_row_stride) {
+    const T* src = reinterpret_cast<const T*>(src_data);
+    T* dst = reinterpret_cast<T*>(dst_data);
+    for (size_t i = 0; i < dst_row_len; i++) {
+        for (size_t j = 0; j < src_row_len; j++) {
+            dst[j * dst_row_stride + i] = src[i * src_row_stride + j];
+        }
+    }
+}
+
+void PermuteKernel::transposeExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    // the blocks of both the source and the destination rows stay in L1, the kernel transposes them by the tiles
+    static constexpr size_t block_size = 64;
+    static constexpr size_t tile_size = 8;
+
+    SizeVector dst_dims = jcp.dst_block_dims;
+    const SizeVector& dst_strides = jcp.dst_strides;
+    const SizeVector& src_strides = jcp.src_strides;
+    const size_t data_size = jcp.data_size;
+    const size_t ndims = dst_dims.size();
+
+    if (dst_dims[0] != mb)
+        dst_dims[0] = mb;
+
+    // the source rows are contiguous along src_inner_dim, the destination rows are contiguous along the last one
+    const size_t src_inner_dim = transpose_src_inner_dim;
+    const size_t dst_inner_dim = ndims - 1;
+    const size_t src_row_len = dst_dims[src_inner_dim];
+    const size_t dst_row_len = dst_dims[dst_inner_dim];
+    const size_t src_row_stride = src_strides[dst_inner_dim];
+    const size_t dst_row_stride = dst_strides[src_inner_dim];
+
+    SizeVector outer_dims, outer_src_strides, outer_dst_strides;
+    for (size_t i = 0; i < ndims; i++) {
+        if (i != src_inner_dim && i != dst_inner_dim) {
+            outer_dims.push_back(dst_dims[i]);
+            outer_src_strides.push_back(src_strides[i]);
+            outer_dst_strides.push_back(dst_strides[i]);
+        }
+    }
+    const size_t outer_work_amount = std::accumulate(outer_dims.begin(), outer_dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+    auto transpose_ref = [&](const uint8_t* src, uint8_t* dst, size_t src_len, size_t dst_len) {
+        switch (data_size) {
+            case 1: transpose_block_ref<uint8_t>(src, dst, src_len, dst_len, src_row_stride, dst_row_stride); break;
+            case 2: transpose_block_ref<uint16_t>(src, dst, src_len, dst_len, src_row_stride, dst_row_stride); break;
+            case 4: transpose_block_ref<uint32_t>(src, dst, src_len, dst_len, src_row_stride, dst_row_stride); break;
+            case 8: transpose_block_ref<uint64_t>(src, dst, src_len, dst_len, src_row_stride, dst_row_stride); break;
+        }
+    };
+
+    parallel_for3d(outer_work_amount, div_up(src_row_len, block_size), div_up(dst_row_len, block_size),
+                   [&](size_t outer, size_t src_block, size_t dst_block) {
+        size_t src_off = 0, dst_off = 0;
+        for (int j = outer_dims.size() - 1; j >= 0; j--) {
+            const size_t idx = outer % outer_dims[j];
+            outer /= outer_dims[j];
+            src_off += idx * outer_src_strides[j];
+            dst_off += idx * outer_dst_strides[j];
+        }
+        const size_t src_start = src_block * block_size;
+        const size_t dst_start = dst_block * block_size;
+        src_off += src_start + dst_start * src_row_stride;
+        dst_off += dst_start + src_start * dst_row_stride;
+        const uint8_t* src = src_data + src_off * data_size;
+        uint8_t* dst = dst_data + dst_off * data_size;
+        const size_t src_len = std::min(block_size, src_row_len - src_start);
+        const size_t dst_len = std::min(block_size, dst_row_len - dst_start);
+
+        size_t src_tiled_len = 0, dst_tiled_len = 0;
+        if (transpose_kernel) {
+            src_tiled_len = src_len / tile_size * tile_size;
+            dst_tiled_len = dst_len / tile_size * tile_size;
+            if (src_tiled_len > 0 && dst_tiled_len > 0) {
+                auto arg = jit_args_transpose_tile();
+                arg.src = src;
+                arg.dst = dst;
+                arg.src_row_len = src_tiled_len;
+                arg.dst_row_len = dst_tiled_len;
+                (*transpose_kernel)(&arg);
+            }
+        }
+        // the tails of the source rows, then the tails of the destination rows
+        transpose_ref(src + src_tiled_len * data_size, dst + src_tiled_len * dst_row_stride * data_size,
+                      src_len - src_tiled_len, dst_tiled_len);
+        transpose_ref(src + dst_tiled_len * src_row_stride * data_size, dst + dst_tiled_len * data_size,
+                      src_len, dst_len - dst_tiled_len);
+    });
+}
+
 static inline size_t parallel_init(size_t start, size_t nDims, const SizeVector& dims, SizeVector& indexes) {
     for (int j = nDims - 1; j >= 0; j--) {
         indexes[j] = start % dims[j];
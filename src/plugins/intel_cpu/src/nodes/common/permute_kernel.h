@@ -54,6 +54,36 @@ struct jit_uni_permute_kernel {
     jit_permute_config_params jcp;
 };
 
+struct jit_transpose_tile_config_params {
+    // the byte strides of the source rows and the destination rows
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+struct jit_args_transpose_tile {
+    const void* src;
+    void* dst;
+    // the number of the elements in the source and the destination rows, both are multiples of the tile size
+    size_t src_row_len;
+    size_t dst_row_len;
+};
+
+struct jit_uni_transpose_tile_kernel {
+    void (*ker_)(const jit_args_transpose_tile *);
+
+    void operator()(const jit_args_transpose_tile *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_transpose_tile_kernel(jit_transpose_tile_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_transpose_tile_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_transpose_tile_config_params jcp;
+};
+
 class PermuteKernel {
 public:
     PermuteKernel(const PermuteParams& params);
@@ -67,11 +97,19 @@ public:
 private:
     void prepareParams();
 
+    void prepareTranspose();
+
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    void transposeExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
+    // the permutations moving the source innermost dimension out of the destination innermost one are done as
+    // the blocked 2D transposes of these dimensions
+    bool is_transpose = false;
+    size_t transpose_src_inner_dim = 0;
+    std::shared_ptr<jit_uni_transpose_tile_kernel> transpose_kernel;
     PermuteParams params;
 };
 
@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 using namespace InferenceEngine;
@@ -30,11 +32,24 @@ struct jit_args_softmax {
     size_t src_stride;
     size_t dst_stride;
     size_t work_amount;
+    // the per lane max and sum written by the inner reduction, the broadcasted max and 1/sum read by the inner normalization
+    float* max;
+    float* sum;
+};
+
+enum class jit_softmax_mode {
+    // softmax across the strided vectors, each lane is a separate row
+    across,
+    // the online max and sum of the contiguous row, dst isn't written
+    inner_reduce,
+    // dst = exp(src - max) / sum of the contiguous row
+    inner_normalize
 };
 
 struct jit_softmax_config_params {
     Precision src_dt;
     Precision dst_dt;
+    jit_softmax_mode mode = jit_softmax_mode::across;
 };
 
 
@@ -75,6 +90,157 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
         mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
         mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
 
+        if (jcp_.mode == jit_softmax_mode::inner_reduce)
+            inner_reduce();
+        else if (jcp_.mode == jit_softmax_mode::inner_normalize)
+            inner_normalize();
+        else
+            across();
+
+        this->postamble();
+
+        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
+            emu_vcvtneps2bf16->emit_data();
+
+        exp_injector->prepare_table();
+
+        if (jcp_.mode == jit_softmax_mode::inner_reduce)
+            prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 aux_reg_src = r13;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 aux_reg_dst = r15;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 aux_reg_work_amount = r12;
+    Xbyak::Reg64 reg_src_stride = r14;
+    Xbyak::Reg64 reg_dst_stride = r10;
+    Xbyak::Reg64 reg_table = rbp;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_mask = Vmm(0);
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_max = Vmm(2);
+    Vmm vmm_exp_sum = Vmm(3);
+    Vmm vmm_exp = Vmm(4);
+    Vmm vmm_aux = Vmm(5);
+    Vmm vmm_one = Vmm(6);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_table;
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    jit_softmax_config_params jcp_;
+
+    /*
+     * Single pass over the row: every lane keeps its running max m and the sum s of exp(x - m), a new value x updates
+     * them by the only exponent e = exp(-|x - m|): s = s * e + 1 if x > m, otherwise s = s + e
+     */
+    void inner_reduce() {
+        Xbyak::Label reduce_loop_label;
+        Xbyak::Label reduce_loop_end_label;
+
+        mov(reg_table, l_table);
+        uni_vmovups(vmm_one, ptr[reg_table]);
+
+        mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_src, reg_src);
+        load_vector(vmm_max, ptr[aux_reg_src], jcp_.src_dt);
+        uni_vpxor(vmm_exp_sum, vmm_exp_sum, vmm_exp_sum);
+        L(reduce_loop_label); {
+            cmp(aux_reg_work_amount, 0);
+            jle(reduce_loop_end_label, T_NEAR);
+
+            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
+
+            uni_vmovups(vmm_exp, vmm_val);
+            uni_vsubps(vmm_exp, vmm_exp, vmm_max);
+            uni_vmovups(vmm_aux, vmm_max);
+            uni_vsubps(vmm_aux, vmm_aux, vmm_val);
+            uni_vminps(vmm_exp, vmm_exp, vmm_aux);
+            exp_injector->compute_vector_range(vmm_exp.getIdx(), vmm_exp.getIdx() + 1);
+
+            uni_vmovups(vmm_aux, vmm_exp_sum);
+            uni_vmulps(vmm_aux, vmm_aux, vmm_exp);
+            uni_vaddps(vmm_aux, vmm_aux, vmm_one);
+            uni_vaddps(vmm_exp_sum, vmm_exp_sum, vmm_exp);
+
+            if (isa == x64::avx512_common) {
+                vcmpps(k_mask, vmm_val, vmm_max, _cmp_nle_us);
+                vblendmps(vmm_exp_sum | k_mask, vmm_exp_sum, vmm_aux);
+            } else {
+                uni_vmovups(vmm_mask, vmm_val);
+                uni_vcmpgtps(vmm_mask, vmm_mask, vmm_max);
+                uni_vblendvps(vmm_exp_sum, vmm_exp_sum, vmm_aux, vmm_mask);
+            }
+            uni_vmaxps(vmm_max, vmm_max, vmm_val);
+
+            add(aux_reg_src, reg_src_stride);
+            sub(aux_reg_work_amount, 1);
+
+            jmp(reduce_loop_label, T_NEAR);
+        }
+
+        L(reduce_loop_end_label);
+
+        mov(aux_reg_dst, ptr[reg_params + GET_OFF(max)]);
+        uni_vmovups(ptr[aux_reg_dst], vmm_max);
+        mov(aux_reg_dst, ptr[reg_params + GET_OFF(sum)]);
+        uni_vmovups(ptr[aux_reg_dst], vmm_exp_sum);
+    }
+
+    void inner_normalize() {
+        Xbyak::Label normalize_loop_label;
+        Xbyak::Label normalize_loop_end_label;
+
+        mov(aux_reg_src, ptr[reg_params + GET_OFF(max)]);
+        uni_vbroadcastss(vmm_max, ptr[aux_reg_src]);
+        mov(aux_reg_src, ptr[reg_params + GET_OFF(sum)]);
+        uni_vbroadcastss(vmm_exp_sum, ptr[aux_reg_src]);
+
+        mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_src, reg_src);
+        mov(aux_reg_dst, reg_dst);
+        L(normalize_loop_label); {
+            cmp(aux_reg_work_amount, 0);
+            jle(normalize_loop_end_label, T_NEAR);
+
+            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
+
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            uni_vmulps(vmm_val, vmm_val, vmm_exp_sum);
+
+            store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
+
+            add(aux_reg_src, reg_src_stride);
+            add(aux_reg_dst, reg_dst_stride);
+            sub(aux_reg_work_amount, 1);
+
+            jmp(normalize_loop_label, T_NEAR);
+        }
+
+        L(normalize_loop_end_label);
+    }
+
+    void prepare_table() {
+        align(64);
+        L(l_table);
+        for (size_t d = 0; d < vlen / sizeof(float); ++d) {
+            dd(float2int(1.0f));
+        }
+    }
+
+    void across() {
         Xbyak::Label max_loop_label;
         Xbyak::Label max_loop_end_label;
         Xbyak::Label exp_loop_label;
@@ -159,42 +325,8 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
         }
 
         L(div_loop_end_label);
-
-        this->postamble();
-
-        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
-            emu_vcvtneps2bf16->emit_data();
-
-        exp_injector->prepare_table();
     }
 
-private:
-    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
-    size_t vlen = cpu_isa_traits<isa>::vlen;
-
-    Xbyak::Reg64 reg_src = r8;
-    Xbyak::Reg64 aux_reg_src = r13;
-    Xbyak::Reg64 reg_dst = r9;
-    Xbyak::Reg64 aux_reg_dst = r15;
-    Xbyak::Reg64 reg_work_amount = r11;
-    Xbyak::Reg64 aux_reg_work_amount = r12;
-    Xbyak::Reg64 reg_src_stride = r14;
-    Xbyak::Reg64 reg_dst_stride = r10;
-    Xbyak::Reg64 reg_params = abi_param1;
-
-    Vmm vmm_mask = Vmm(0);
-    Vmm vmm_val = Vmm(1);
-    Vmm vmm_max = Vmm(2);
-    Vmm vmm_exp_sum = Vmm(3);
-
-    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
-
-    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
-
-    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
-
-    jit_softmax_config_params jcp_;
-
     inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, Precision src_dt) {
         switch (src_dt) {
             case Precision::FP32:
@@ -240,23 +372,123 @@ SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     auto jcp = jit_softmax_config_params();
     jcp.src_dt = inpPrc;
     jcp.dst_dt = outPrc;
+    auto inner_reduce_jcp = jcp;
+    inner_reduce_jcp.mode = jit_softmax_mode::inner_reduce;
+    auto inner_normalize_jcp = jcp;
+    inner_normalize_jcp.mode = jit_softmax_mode::inner_normalize;
 
     if (mayiuse(x64::avx512_common)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(jcp));
+        softmax_inner_reduce_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(inner_reduce_jcp));
+        softmax_inner_normalize_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(inner_normalize_jcp));
         block_size = 16;
     } else if (mayiuse(x64::avx2)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(jcp));
+        softmax_inner_reduce_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(inner_reduce_jcp));
+        softmax_inner_normalize_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(inner_normalize_jcp));
         block_size = 8;
     } else if (mayiuse(x64::sse41)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(jcp));
+        softmax_inner_reduce_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(inner_reduce_jcp));
+        softmax_inner_normalize_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(inner_normalize_jcp));
         block_size = 4;
     }
-    if (softmax_kernel)
+    if (softmax_kernel) {
         softmax_kernel->create_ker();
+        softmax_inner_reduce_kernel->create_ker();
+        softmax_inner_normalize_kernel->create_ker();
+    }
+}
+
+namespace {
+// Merges the running max and sum of exp(x - max) of the two parts of a row
+inline void softmax_merge(float& max, float& sum, float part_max, float part_sum) {
+    if (part_max > max) {
+        sum = sum * std::exp(max - part_max) + part_sum;
+        max = part_max;
+    } else {
+        sum += part_sum * std::exp(part_max - max);
+    }
+}
+}  // namespace
+
+template<typename in_data_t, typename out_data_t>
+void SoftmaxGeneric::calculate_inner(const in_data_t *src_data, out_data_t *dst_data, int B, int C) {
+    // the rows are processed by the chunks fitting into L2, so the vocabulary sized rows are split between the threads
+    const int chunk_size = block_size * 1024;
+    const int chunks_num = (C + chunk_size - 1) / chunk_size;
+    std::vector<float> chunk_max(static_cast<size_t>(B) * chunks_num);
+    std::vector<float> chunk_sum(static_cast<size_t>(B) * chunks_num);
+
+    parallel_for2d(B, chunks_num, [&](int b, int ic) {
+        const int start = ic * chunk_size;
+        const int len = (std::min)(chunk_size, C - start);
+        const in_data_t *psrc = src_data + static_cast<size_t>(b) * C + start;
+
+        float max = -std::numeric_limits<float>::infinity();
+        float sum = 0.f;
+        const int blocks_num = softmax_inner_reduce_kernel ? len / block_size : 0;
+        if (blocks_num > 0) {
+            float lane_max[16];
+            float lane_sum[16];
+            auto arg = jit_args_softmax();
+            arg.src = psrc;
+            arg.src_stride = block_size * sizeof(in_data_t);
+            arg.work_amount = static_cast<size_t>(blocks_num);
+            arg.max = lane_max;
+            arg.sum = lane_sum;
+            (*softmax_inner_reduce_kernel)(&arg);
+            for (int l = 0; l < block_size; l++)
+                softmax_merge(max, sum, lane_max[l], lane_sum[l]);
+        }
+        for (int i = blocks_num * block_size; i < len; i++)
+            softmax_merge(max, sum, psrc[i], 1.f);
+
+        chunk_max[b * chunks_num + ic] = max;
+        chunk_sum[b * chunks_num + ic] = sum;
+    });
+
+    for (int b = 0; b < B; b++) {
+        float max = chunk_max[b * chunks_num];
+        float sum = chunk_sum[b * chunks_num];
+        for (int ic = 1; ic < chunks_num; ic++)
+            softmax_merge(max, sum, chunk_max[b * chunks_num + ic], chunk_sum[b * chunks_num + ic]);
+        chunk_max[b * chunks_num] = max;
+        chunk_sum[b * chunks_num] = 1.f / sum;
+    }
+
+    parallel_for2d(B, chunks_num, [&](int b, int ic) {
+        const int start = ic * chunk_size;
+        const int len = (std::min)(chunk_size, C - start);
+        const in_data_t *psrc = src_data + static_cast<size_t>(b) * C + start;
+        out_data_t *pdst = dst_data + static_cast<size_t>(b) * C + start;
+        float max = chunk_max[b * chunks_num];
+        float inv_sum = chunk_sum[b * chunks_num];
+
+        const int blocks_num = softmax_inner_normalize_kernel ? len / block_size : 0;
+        if (blocks_num > 0) {
+            auto arg = jit_args_softmax();
+            arg.src = psrc;
+            arg.dst = pdst;
+            arg.src_stride = block_size * sizeof(in_data_t);
+            arg.dst_stride = block_size * sizeof(out_data_t);
+            arg.work_amount = static_cast<size_t>(blocks_num);
+            arg.max = &max;
+            arg.sum = &inv_sum;
+            (*softmax_inner_normalize_kernel)(&arg);
+        }
+        for (int i = blocks_num * block_size; i < len; i++)
+            pdst[i] = std::exp(psrc[i] - max) * inv_sum;
+    });
 }
 
 template<typename in_data_t, typename out_data_t>
 void SoftmaxGeneric::calculate(const in_data_t *src_data, out_data_t *dst_data, int B, int C, int H, int W) {
+    if (H * W == 1) {
+        calculate_inner(src_data, dst_data, B, C);
+        return;
+    }
+
     for (int b = 0; b < B; b++) {
         int tail_start = 0;
         if (softmax_kernel) {
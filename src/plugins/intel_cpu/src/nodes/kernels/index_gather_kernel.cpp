@@ -0,0 +1,131 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "index_gather_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl::cpu;
+
+namespace MKLDNNPlugin {
+
+const unsigned jitIndexGatherKernelBase::incVec[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+#define GET_OFF(field) offsetof(indexGatherJitExecArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniIndexGatherKernel<isa>::jitUniIndexGatherKernel(const jIndexGatherConfParams& jcp) :
+        jitIndexGatherKernelBase(jcp), x64::jit_generator() {
+    if (jcp.sliceRank == 0lu || jcp.sliceRank > maxSliceRank)
+        IE_THROW() << "Index gather kernel does not support slice rank " << jcp.sliceRank;
+    vlen = x64::cpu_isa_traits<isa>::vlen;
+    dataElPerVec = vlen / dataTypeSize;
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniIndexGatherKernel<isa>::create_ker() {
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create Index Gather kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniIndexGatherKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regSrc, ptr[regParams + GET_OFF(src)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regIndices, ptr[regParams + GET_OFF(indices)]);
+    mov(regWorkAmount, ptr[regParams + GET_OFF(workAmount)]);
+
+    mov(regAux, ptr[regParams + GET_OFF(idxMuls)]);
+    for (uint64_t i = 0; i < jcp.sliceRank; i++)
+        uni_vpbroadcastd(vmmIdxMuls[i], ptr[regAux + i * indicesTypeSize]);
+
+    if (jcp.sliceRank > 1lu) {
+        // The shifts of the first index of each element in the indices row.
+        broadcastConst(vmmIdxShiftsB, jcp.sliceRank * indicesTypeSize);
+        mov(regAux, reinterpret_cast<uintptr_t>(incVec));
+        uni_vpmulld(vmmIdxShiftsB, vmmIdxShiftsB, ptr[regAux]);
+    }
+    if (jcp.addPosition) {
+        uni_vpbroadcastd(vmmPosition, ptr[regParams + GET_OFF(position)]);
+        mov(regAux, reinterpret_cast<uintptr_t>(incVec));
+        uni_vpaddd(vmmPosition, vmmPosition, ptr[regAux]);
+        broadcastConst(vmmVecLen, dataElPerVec);
+    }
+
+    Xbyak::Label lLoop, lEnd;
+    L(lLoop);
+    {
+        cmp(regWorkAmount, dataElPerVec);
+        jl(lEnd, T_NEAR);
+
+        calcOffsets();
+        fillMask(kGatherMask);
+        uniVpGatherDd(vmmDst, ptr[regSrc + vmmOffsets * dataTypeSize], kGatherMask);
+        uni_vmovups(ptr[regDst], vmmDst);
+
+        add(regIndices, vlen * jcp.sliceRank);
+        add(regDst, vlen);
+        sub(regWorkAmount, dataElPerVec);
+        jmp(lLoop, T_NEAR);
+    }
+    L(lEnd);
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniIndexGatherKernel<isa>::calcOffsets() {
+    if (jcp.sliceRank == 1lu) {
+        uni_vpmulld(vmmOffsets, vmmIdxMuls[0], ptr[regIndices]);
+    } else {
+        for (uint64_t i = 0; i < jcp.sliceRank; i++) {
+            fillMask(kGatherMask);
+            uniVpGatherDd(vmmIdx, ptr[regIndices + vmmIdxShiftsB + i * indicesTypeSize], kGatherMask);
+            if (i == 0) {
+                uni_vpmulld(vmmOffsets, vmmIdx, vmmIdxMuls[i]);
+            } else {
+                uni_vpmulld(vmmIdx, vmmIdx, vmmIdxMuls[i]);
+                uni_vpaddd(vmmOffsets, vmmOffsets, vmmIdx);
+            }
+        }
+    }
+    if (jcp.addPosition) {
+        uni_vpaddd(vmmOffsets, vmmOffsets, vmmPosition);
+        uni_vpaddd(vmmPosition, vmmPosition, vmmVecLen);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniIndexGatherKernel<isa>::broadcastConst(Vmm& vDst, uint32_t value) {
+    Xbyak::Xmm xDst = Xbyak::Xmm(vDst.getIdx());
+    mov(reg32Aux, value);
+    uni_vmovd(xDst, reg32Aux);
+    uni_vpbroadcastd(vDst, xDst);
+}
+
+template <>
+void jitUniIndexGatherKernel<x64::avx2>::uniVpGatherDd(Vmm& vDst, const Xbyak::Address& srcAddr, Vmask& kMask) {
+    vpgatherdd(vDst, srcAddr, kMask);
+}
+template <>
+void jitUniIndexGatherKernel<x64::avx512_common>::uniVpGatherDd(Vmm& vDst, const Xbyak::Address& srcAddr, Vmask& kMask) {
+    vpgatherdd(vDst | kMask, srcAddr);
+}
+
+template <>
+void jitUniIndexGatherKernel<x64::avx2>::fillMask(Vmask& kMask) {
+    vpcmpeqd(kMask, kMask, kMask);
+}
+template <>
+void jitUniIndexGatherKernel<x64::avx512_common>::fillMask(Vmask& kMask) {
+    kxnorw(kMask, kMask, kMask);
+}
+
+template struct jitUniIndexGatherKernel<x64::avx2>;
+template struct jitUniIndexGatherKernel<x64::avx512_common>;
+
+}  // namespace MKLDNNPlugin
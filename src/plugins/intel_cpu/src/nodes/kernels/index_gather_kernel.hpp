@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Index gather kernel gathers 32 bit elements by the offsets calculated from the indices:
+//     dst[i] = src[indices[i * sliceRank] * idxMuls[0] + ... + indices[i * sliceRank + sliceRank - 1] * idxMuls[sliceRank - 1] + (position + i)]
+// where the position term is added only if 'addPosition' is set.
+// 1. GatherND uses 'sliceRank' indices per element, the indices of the element are gathered from the indices row.
+// 2. GatherElements uses one index per element. The position is added when the axis isn't the innermost one,
+// i.e. the elements of the row are shifted by the axis stride.
+// The kernel processes only the whole vectors, the tail (workAmount % dataElPerVec) is left to the caller.
+
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <mkldnn_types.h>
+
+namespace MKLDNNPlugin {
+
+struct jIndexGatherConfParams {
+    uint64_t sliceRank = 1lu;
+    bool addPosition = false;
+};
+
+struct indexGatherJitExecArgs {
+    const void* src;
+    const int* indices;
+    void* dst;
+    const int* idxMuls;
+    uint64_t workAmount = 0lu;
+    int position = 0;
+};
+
+struct jitIndexGatherKernelBase {
+    void (*ker_)(const indexGatherJitExecArgs *);
+    void operator()(const indexGatherJitExecArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit jitIndexGatherKernelBase(const jIndexGatherConfParams& jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jitIndexGatherKernelBase() {}
+
+    virtual void create_ker() = 0;
+    uint64_t getDataElPerVec() const {
+        return dataElPerVec;
+    }
+    const jIndexGatherConfParams& getConfParams() const {
+        return jcp;
+    }
+
+    // the multipliers of the indices are kept in the registers
+    static constexpr uint64_t maxSliceRank = 4lu;
+
+protected:
+    jIndexGatherConfParams jcp;
+    uint64_t vlen = 0lu;
+    uint64_t dataElPerVec = 0lu;
+    static const unsigned incVec[16];
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniIndexGatherKernel : public jitIndexGatherKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniIndexGatherKernel)
+
+    explicit jitUniIndexGatherKernel(const jIndexGatherConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    using Vmask = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Opmask>::type;
+    static const uint32_t dataTypeSize = sizeof(uint32_t);
+    static const uint32_t indicesTypeSize = sizeof(int);
+
+    // Suffix B means "In Bytes".
+    // 64b registers.
+    const Xbyak::Reg64& regSrc = r8;
+    const Xbyak::Reg64& regDst = r9;
+    const Xbyak::Reg64& regIndices = r10;
+    const Xbyak::Reg64& regWorkAmount = r11;
+    const Xbyak::Reg64& regAux = r12;
+
+    const Xbyak::Reg64& regParams = dnnl::impl::cpu::x64::abi_param1;
+
+    // 32b registers.
+    Xbyak::Reg32 reg32Aux = Xbyak::Reg32(regAux.getIdx());
+
+    // Do not use k0 with gather instruction!
+    Vmask kGatherMask = Vmask(isa == dnnl::impl::cpu::x64::avx2 ? 15 : 1);
+
+    Vmm vmmIdxMuls[maxSliceRank] = {Vmm(0), Vmm(1), Vmm(2), Vmm(3)};
+    Vmm vmmOffsets = Vmm(4);
+    Vmm vmmIdx = Vmm(5);
+    Vmm vmmDst = Vmm(6);
+    Vmm vmmPosition = Vmm(7);
+    Vmm vmmVecLen = Vmm(8);
+    Vmm vmmIdxShiftsB = Vmm(9);
+
+    void uniVpGatherDd(Vmm& vDst, const Xbyak::Address& srcAddr, Vmask& kMask);
+    void fillMask(Vmask& kMask);
+    void broadcastConst(Vmm& vDst, uint32_t value);
+    void calcOffsets();
+};
+
+}  // namespace MKLDNNPlugin
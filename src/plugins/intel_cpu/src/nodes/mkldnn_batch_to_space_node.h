@@ -22,6 +22,7 @@ public:
     bool created() const override;
 
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(1, 2, 3); }
     bool needPrepareParams() const override { return false; };
     void executeDynamicImpl(mkldnn::stream strm) override;
 
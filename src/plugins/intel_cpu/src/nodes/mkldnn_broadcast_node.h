@@ -31,6 +31,7 @@ protected:
     void prepareParams() override;
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(TARGET_SHAPE_IDX, AXES_MAPPING_IDX); }
 
 private:
     void plainExecute(mkldnn::stream strm);
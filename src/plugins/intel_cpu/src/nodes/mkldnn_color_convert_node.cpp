@@ -58,9 +58,10 @@ Converter::shapeInfer() const {
     const auto & dims = inputDims(0);
     if (dims.size() != 4)
         IE_THROW() <<"NV12Converter node has incorrect input dimensions";
-    return singlePlane()
-                ? Shapes { { dims[N_DIM], dims[H_DIM] * 2 / 3, dims[W_DIM], 3 } }
-                : Shapes { { dims[N_DIM], dims[H_DIM], dims[W_DIM], 3 } };
+    const auto height = singlePlane() ? dims[H_DIM] * 2 / 3 : dims[H_DIM];
+    return _planarOutput
+                ? Shapes { { dims[N_DIM], 3, height, dims[W_DIM] } }
+                : Shapes { { dims[N_DIM], height, dims[W_DIM], 3 } };
 }
 
 bool Converter::singlePlane() const {
@@ -92,7 +93,9 @@ struct jit_uni_converter : public jit_kernel {
         const void * y;
         const void * u;
         const void * v;
-        void * dst;
+        void * dst;             // The pixels of the row or the R plane of the planar output
+        void * dst_g;           // The G plane of the planar output
+        void * dst_b;           // The B plane of the planar output
         size_t width;
         uint8_t colorFormat;    // RGB: 0, BGR: !=0
     };
@@ -106,7 +109,7 @@ struct jit_uni_converter : public jit_kernel {
     }
 
 protected:
-    jit_uni_converter();
+    explicit jit_uni_converter(bool planar);
 
     template<size_t N>
     void yuv_to_rgb(const variable<float[N]> & y,
@@ -115,7 +118,16 @@ protected:
                     const variable<uint8_t> & color_format,
                     bool round);
     template<typename T, size_t N>
+    void store_rgb(const variable<T*> & dst,
+                   const variable<T*> & dst_g,
+                   const variable<T*> & dst_b,
+                   const variable<float[N]> & a,
+                   const variable<float[N]> & b,
+                   const variable<float[N]> & c);
+    template<typename T, size_t N>
     void store_tail(const variable<T*> & dst,
+                    const variable<T*> & dst_g,
+                    const variable<T*> & dst_b,
                     const variable<float[N]> & a,
                     const variable<float[N]> & b,
                     const variable<float[N]> & c,
@@ -123,10 +135,12 @@ protected:
 
     function_t _fn;
     variable<const float*> _consts;
+    const bool _planar;
 };
 
-jit_uni_converter::jit_uni_converter()
-    : _consts(*this) {
+jit_uni_converter::jit_uni_converter(bool planar)
+    : _consts(*this)
+    , _planar(planar) {
 }
 
 void jit_uni_converter::init() {
@@ -247,17 +261,54 @@ void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
     clip(g, y, u);
     clip(b, y, u);
 
+    if (_planar) {
+        // the color format is applied by the plane pointers
+        y = r;
+        u = g;
+        v = b;
+        return;
+    }
+
     _if(color_format == 0)
     ._then([&]{ blend(r, g, b, y, u, v); })
     ._else([&]{ blend(b, g, r, y, u, v); });
 }
 
+template<typename T, size_t N>
+void jit_uni_converter::store_rgb(const variable<T*> & dst,
+                                  const variable<T*> & dst_g,
+                                  const variable<T*> & dst_b,
+                                  const variable<float[N]> & a,
+                                  const variable<float[N]> & b,
+                                  const variable<float[N]> & c) {
+    const size_t step = N * sizeof(T);
+
+    if (_planar) {
+        store(dst, a);      dst += step;
+        store(dst_g, b);    dst_g += step;
+        store(dst_b, c);    dst_b += step;
+    } else {
+        store(dst, a);  dst += step;
+        store(dst, b);  dst += step;
+        store(dst, c);  dst += step;
+    }
+}
+
 template<typename T, size_t N>
 void jit_uni_converter::store_tail(const variable<T*> & dst,
+                                   const variable<T*> & dst_g,
+                                   const variable<T*> & dst_b,
                                    const variable<float[N]> & a,
                                    const variable<float[N]> & b,
                                    const variable<float[N]> & c,
                                    const variable<size_t> & size) {
+    if (_planar) {
+        store(dst, a, size);
+        store(dst_g, b, size);
+        store(dst_b, c, size);
+        return;
+    }
+
     const size_t step = N * sizeof(T);
     auto s = stack(3 * step);
 
@@ -273,6 +324,27 @@ void jit_uni_converter::store_tail(const variable<T*> & dst,
     copy<T>(ptr[dst], s.pointer(), copy_size);
 }
 
+// Points the kernel arguments to the output row h of the image
+template<typename T>
+void set_output_row(jit_uni_converter::Params & args,
+                    T* dst,
+                    size_t batch,
+                    size_t h,
+                    size_t height,
+                    size_t width,
+                    const MKLDNNColorConvertNode::Converter::ColorFormat & colorFormat,
+                    bool planar) {
+    T* out = dst + batch * width * height * 3;
+    if (planar) {
+        out += h * width;
+        args.dst = out + colorFormat[0] * width * height;
+        args.dst_g = out + colorFormat[1] * width * height;
+        args.dst_b = out + colorFormat[2] * width * height;
+    } else {
+        args.dst = args.dst_g = args.dst_b = out + h * width * 3;
+    }
+}
+
 namespace nv12 {
 
 MKLDNNColorConvertNode::Converter::PrimitiveDescs supportedPrimitiveDescs(MKLDNNNode *node) {
@@ -332,6 +404,9 @@ void RefConverter::convert(const T* y,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
+    const size_t pixel_stride = _planarOutput ? 1 : 3;
+    const size_t channel_stride = _planarOutput ? width * height : 1;
+
     InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
         T* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
@@ -345,9 +420,9 @@ void RefConverter::convert(const T* y,
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
             T r, g, b;
             std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
-            out[y_index * 3 + _colorFormat[0]] = r;
-            out[y_index * 3 + _colorFormat[1]] = g;
-            out[y_index * 3 + _colorFormat[2]] = b;
+            out[y_index * pixel_stride + _colorFormat[0] * channel_stride] = r;
+            out[y_index * pixel_stride + _colorFormat[1] * channel_stride] = g;
+            out[y_index * pixel_stride + _colorFormat[2] * channel_stride] = b;
         }
     });
 }
@@ -407,6 +482,11 @@ class JitConverter;
 
 template<typename T, size_t N>
 class JitConverter<T[N]> : public jit_uni_converter {
+public:
+    explicit JitConverter(bool planar)
+        : jit_uni_converter(planar) {
+    }
+
 private:
     void generate() override;
     std::tuple<variable<float[N]>,
@@ -427,6 +507,8 @@ void JitConverter<T[N]>::generate() {
     auto src_y = arg<const T*>(&Params::y);
     auto src_uv = arg<const T*>(&Params::u);
     auto dst = arg<T*>(&Params::dst);
+    auto dst_g = arg<T*>(&Params::dst_g);
+    auto dst_b = arg<T*>(&Params::dst_b);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
 
@@ -434,7 +516,6 @@ void JitConverter<T[N]>::generate() {
     _consts = data;
 
     const size_t reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
 
     width >>= reg_capacity_log;
 
@@ -448,9 +529,7 @@ void JitConverter<T[N]>::generate() {
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
 
-        store(dst, y);  dst += step;
-        store(dst, u);  dst += step;
-        store(dst, v);  dst += step;
+        store_rgb(dst, dst_g, dst_b, y, u, v);
     });
 
     mov(width, argPtr(&Params::width));
@@ -472,7 +551,7 @@ void JitConverter<T[N]>::generate() {
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
 
-        store_tail(dst, y, u, v, width);
+        store_tail(dst, dst_g, dst_b, y, u, v, width);
     });
 
     postamble();
@@ -517,20 +596,20 @@ JitConverter<T[N]>::unpack_uv(const variable<float[N]> & uv) {
 }
 
 template<typename T>
-const jit_uni_converter & jit_converter_create() {
-    auto createKernel = []() {
+const jit_uni_converter & jit_converter_create(bool planar) {
+    auto createKernel = [](bool planar) {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_common)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16]>(planar);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8]>(planar);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4]>(planar);
             kernel.reset(converter);
             converter->init();
         } else {
@@ -540,14 +619,19 @@ const jit_uni_converter & jit_converter_create() {
         return std::move(kernel);
     };
 
-    static auto kernel = createKernel();
+    if (planar) {
+        static auto kernel = createKernel(true);
+        return *kernel;
+    }
+
+    static auto kernel = createKernel(false);
 
     return *kernel;
 }
 
 template<typename T>
-const jit_uni_converter & jit_converter_get() {
-    return jit_converter_create<T>();
+const jit_uni_converter & jit_converter_get(bool planar) {
+    return jit_converter_create<T>(planar);
 }
 
 template<typename T>
@@ -555,11 +639,11 @@ class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
     SinglePlaneConvert(MKLDNNNode *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T>(_planarOutput);
     }
 
     void execute(mkldnn::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T>(_planarOutput);
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -577,7 +661,7 @@ public:
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = args.v = uv + batch * stride_uv + (h / 2) * width;
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            set_output_row(args, dst, batch, h, height, width, _colorFormat, _planarOutput);
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -590,11 +674,11 @@ class TwoPlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
     TwoPlaneConvert(MKLDNNNode *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T>(_planarOutput);
     }
 
     void execute(mkldnn::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T>(_planarOutput);
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -612,7 +696,7 @@ public:
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = args.v = uv + batch * stride_uv + (h / 2) * width;
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            set_output_row(args, dst, batch, h, height, width, _colorFormat, _planarOutput);
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -683,6 +767,9 @@ void RefConverter::convert(const T* y,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
+    const size_t pixel_stride = _planarOutput ? 1 : 3;
+    const size_t channel_stride = _planarOutput ? width * height : 1;
+
     InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
         T* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
@@ -697,9 +784,9 @@ void RefConverter::convert(const T* y,
             auto v_val = static_cast<float>(v_ptr[uv_index]);
             T r, g, b;
             std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
-            out[y_index * 3 + _colorFormat[0]] = r;
-            out[y_index * 3 + _colorFormat[1]] = g;
-            out[y_index * 3 + _colorFormat[2]] = b;
+            out[y_index * pixel_stride + _colorFormat[0] * channel_stride] = r;
+            out[y_index * pixel_stride + _colorFormat[1] * channel_stride] = g;
+            out[y_index * pixel_stride + _colorFormat[2] * channel_stride] = b;
         }
     });
 }
@@ -761,6 +848,11 @@ class JitConverter;
 
 template<typename T, size_t N>
 class JitConverter<T[N]> : public jit_uni_converter {
+public:
+    explicit JitConverter(bool planar)
+        : jit_uni_converter(planar) {
+    }
+
 private:
     void generate() override;
     std::tuple<variable<float[N]>,
@@ -782,6 +874,8 @@ void JitConverter<T[N]>::generate() {
     auto src_u = arg<const T*>(&Params::u);
     auto src_v = arg<const T*>(&Params::v);
     auto dst = arg<T*>(&Params::dst);
+    auto dst_g = arg<T*>(&Params::dst_g);
+    auto dst_b = arg<T*>(&Params::dst_b);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
 
@@ -789,7 +883,6 @@ void JitConverter<T[N]>::generate() {
     _consts = data;
 
     const size_t reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
 
     width >>= reg_capacity_log;
 
@@ -803,9 +896,7 @@ void JitConverter<T[N]>::generate() {
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
 
-        store(dst, y);  dst += step;
-        store(dst, u);  dst += step;
-        store(dst, v);  dst += step;
+        store_rgb(dst, dst_g, dst_b, y, u, v);
     });
 
     mov(width, argPtr(&Params::width));
@@ -827,7 +918,7 @@ void JitConverter<T[N]>::generate() {
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
 
-        store_tail(dst, y, u, v, width);
+        store_tail(dst, dst_g, dst_b, y, u, v, width);
     });
 
     postamble();
@@ -866,20 +957,20 @@ void JitConverter<T[N]>::unpack_uv(const variable<float[N]> & u,
 }
 
 template<typename T>
-const jit_uni_converter & jit_converter_create() {
-    auto createKernel = []() {
+const jit_uni_converter & jit_converter_create(bool planar) {
+    auto createKernel = [](bool planar) {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_common)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16]>(planar);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8]>(planar);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4]>(planar);
             kernel.reset(converter);
             converter->init();
         } else {
@@ -889,14 +980,19 @@ const jit_uni_converter & jit_converter_create() {
         return std::move(kernel);
     };
 
-    static auto kernel = createKernel();
+    if (planar) {
+        static auto kernel = createKernel(true);
+        return *kernel;
+    }
+
+    static auto kernel = createKernel(false);
 
     return *kernel;
 }
 
 template<typename T>
-const jit_uni_converter & jit_converter_get() {
-    return jit_converter_create<T>();
+const jit_uni_converter & jit_converter_get(bool planar) {
+    return jit_converter_create<T>(planar);
 }
 
 template<typename T>
@@ -904,11 +1000,11 @@ class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
     SinglePlaneConvert(MKLDNNNode *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T>(_planarOutput);
     }
 
     void execute(mkldnn::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T>(_planarOutput);
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -928,7 +1024,7 @@ public:
             args.y = y + batch * stride_y + h * width;
             args.u = u + batch * stride_uv + (h / 2) * (width / 2);
             args.v = v + batch * stride_uv + (h / 2) * (width / 2);
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            set_output_row(args, dst, batch, h, height, width, _colorFormat, _planarOutput);
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -941,11 +1037,11 @@ class ThreePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
     ThreePlaneConvert(MKLDNNNode *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T>(_planarOutput);
     }
 
     void execute(mkldnn::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T>(_planarOutput);
         const auto & dims = inputDims(0);
 
         const T* y = static_cast<const T*>(input(0));
@@ -965,7 +1061,7 @@ public:
             args.y = y + batch * stride_y + h * width;
             args.u = u + batch * stride_uv + (h / 2) * (width / 2);
             args.v = v + batch * stride_uv + (h / 2) * (width / 2);
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            set_output_row(args, dst, batch, h, height, width, _colorFormat, _planarOutput);
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -979,7 +1075,8 @@ public:
 
 MKLDNNColorConvertNode::Converter::Converter(MKLDNNNode *node, const ColorFormat & colorFormat)
     : _node(node)
-    , _colorFormat(colorFormat) {
+    , _colorFormat(colorFormat)
+    , _planarOutput(node->isFusedWith(Transpose)) {
 }
 
 InferenceEngine::Precision MKLDNNColorConvertNode::Converter::inputPrecision(size_t idx) const {
@@ -75,6 +75,7 @@ public:
 protected:
     MKLDNNNode *_node;
     ColorFormat _colorFormat;   // RGB: {0,1,2}, BGR: {2,1,0}
+    bool _planarOutput;         // The Transpose to NCHW is fused, the channels are written as the separate planes
 };
 
 }  // namespace MKLDNNPlugin
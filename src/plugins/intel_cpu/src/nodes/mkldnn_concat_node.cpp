@@ -85,13 +85,6 @@ void MKLDNNConcatNode::getSupportedDescriptors() {
         }
     }
 
-    // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
-        const auto& childDims = outputShapes[0].getStaticDims();
-        if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
-            canBeInPlace = true;
-    }
 }
 
 void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
@@ -180,7 +173,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     }
 
     // TODO [DS]: inplace
-    if (!canBeInPlace || std::any_of(inputShapes.begin(), inputShapes.end(), [](const Shape& shape) { return shape.hasZeroDims(); }))
+    if (isDynamicNode() || std::any_of(inputShapes.begin(), inputShapes.end(), [](const Shape& shape) { return shape.hasZeroDims(); }))
         return;
 
     // Optimized inplace case
@@ -193,6 +186,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         const auto &blkDims = denseOutDesc->getBlockDims();
         auto numOfDim = blkDims.size();
 
+        // we need the first blocked dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat.
+        // The blocked dims are checked rather than the logical ones, so e.g. a concat over H of the nChw16c tensors with 16 channels
+        // is still inplace
+        if (!std::all_of(blkDims.begin(), blkDims.begin() + axis, [](size_t dim) { return dim == 1; }))
+            continue;
+
         SizeVector offsets(numOfDim, 0lu);
         SizeVector strides(numOfDim);
         strides.back() = 1lu;
@@ -218,6 +217,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
             config.inConfs[i].setMemDesc(std::make_shared<CpuBlockedMemoryDesc>(inputPrecision, shape, srcBlkDims, order, offset, offsets, strides), mask);
         }
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        canBeInPlace = true;
     }
 }
 
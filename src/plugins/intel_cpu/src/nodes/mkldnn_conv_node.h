@@ -60,6 +60,8 @@ public:
     }
 
     bool isWinograd() const { return isWino; }
+    // the pads are computed from the input dims (SAME_UPPER, SAME_LOWER)
+    bool isAutoPadding() const { return autoPadding; }
 
 protected:
     InferenceEngine::Precision fusedEltwisePrecision(const MKLDNNNodePtr& fusingNode) const;
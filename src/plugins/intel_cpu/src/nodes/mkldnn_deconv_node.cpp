@@ -24,11 +24,82 @@
 #include <utils/shape_inference/shape_inference.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "convolution_shape_inference.hpp"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+struct DeconvKey {
+    DnnlMemoryDescCPtr inp0;
+    DnnlMemoryDescCPtr inp1;
+    // the weights reordered for the int8 deconvolution, null if the int8 implementation isn't available
+    DnnlMemoryDescCPtr int8Wgh;
+    DnnlMemoryDescCPtr out;
+
+    std::vector<ptrdiff_t> stride;
+    std::vector<ptrdiff_t> dilation;
+    ov::CoordinateDiff paddingL;
+    ov::CoordinateDiff paddingR;
+
+    bool isInt8;
+
+    mkldnn::primitive_attr attr;
+    impl_desc_type implType;
+
+    size_t hash() const;
+    bool operator==(const DeconvKey& rhs) const;
+};
+
+size_t DeconvKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+
+    for (const auto& ptr : {inp0, inp1, int8Wgh, out}) {
+        if (ptr) {
+            seed = hash_combine(seed, get_md_hash(ptr->getDnnlDesc().data));
+        }
+    }
+
+    seed = get_vector_hash(seed, stride);
+    seed = get_vector_hash(seed, dilation);
+    seed = get_vector_hash(seed, paddingL);
+    seed = get_vector_hash(seed, paddingR);
+
+    seed = hash_combine(seed, isInt8);
+
+    seed = hash_combine(seed, get_attr_hash(*attr.get()));
+    seed = hash_combine(seed, implType);
+    return seed;
+}
+
+bool DeconvKey::operator==(const DeconvKey &rhs) const {
+    bool retVal = true;
+    if (inp0 != rhs.inp0) {
+        retVal = retVal && inp0 && rhs.inp0 && inp0->getDnnlDesc() == rhs.inp0->getDnnlDesc();
+    }
+    if (inp1 != rhs.inp1) {
+        retVal = retVal && inp1 && rhs.inp1 && inp1->getDnnlDesc() == rhs.inp1->getDnnlDesc();
+    }
+    if (int8Wgh != rhs.int8Wgh) {
+        retVal = retVal && int8Wgh && rhs.int8Wgh && int8Wgh->getDnnlDesc() == rhs.int8Wgh->getDnnlDesc();
+    }
+    if (out != rhs.out) {
+        retVal = retVal && out && rhs.out && out->getDnnlDesc() == rhs.out->getDnnlDesc();
+    }
+
+    retVal = retVal && stride == rhs.stride && dilation == rhs.dilation &&
+             paddingL == rhs.paddingL && paddingR == rhs.paddingR &&
+             isInt8 == rhs.isInt8;
+
+    retVal = retVal && *attr.get() == *rhs.attr.get() && implType == rhs.implType;
+    return retVal;
+}
+} // namespace
+
 bool MKLDNNDeconvolutionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (std::dynamic_pointer_cast<const ngraph::opset1::ConvolutionBackpropData>(op) == nullptr &&
@@ -485,66 +556,6 @@ std::shared_ptr<MKLDNNDescriptor> MKLDNNDeconvolutionNode::createInt8MkldnnDecon
     return std::make_shared<MKLDNNDescriptor>(createDescriptorInternalInt8(srcDesc, wghDesc, dstDesc));
 }
 
-void MKLDNNDeconvolutionNode::createDeconvPrim(std::shared_ptr<MKLDNNDescriptor> desc,
-                                               MKLDNNMemoryPtr srcMemPtr,
-                                               MKLDNNMemoryPtr wghMemPtr,
-                                               MKLDNNMemoryPtr dstMemPtr,
-                                               AttrPtr attr,
-                                               impl_desc_type selectedImpl) {
-    auto itpd = desc->createPrimitiveDescriptorIterator(getEngine(), *attr);
-
-    while (static_cast<bool>(itpd)) {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
-
-        if (impl_type == selectedImpl) {
-            if (isInt8) {
-                if (internalBlobMemory.empty()) {
-                    prepareMemory(itpd);
-                }
-                auto prim_desc = deconvolution_forward::primitive_desc(itpd.get());
-                execPtr = std::make_shared<DeconvExecutorInt8>(prim_desc,
-                                                               srcMemPtr->GetPrimitive().get_desc(),
-                                                               internalBlobMemory.front()->GetPrimitive().get_desc(),
-                                                               dstMemPtr->GetPrimitive().get_desc(),
-                                                               getEngine());
-            } else {
-                auto prim_desc = convolution_backward_data::primitive_desc(itpd.get());
-                execPtr = std::make_shared<DeconvExecutorDefault>(prim_desc,
-                                                                  srcMemPtr->GetPrimitive().get_desc(),
-                                                                  wghMemPtr->GetPrimitive().get_desc(),
-                                                                  dstMemPtr->GetPrimitive().get_desc(),
-                                                                  getEngine());
-            }
-            return;
-        }
-
-        if (!itpd.next_impl()) {
-            auto inDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(srcMemPtr->getStaticDims()),
-                                                                                       memory::data_type::f32,
-                                                                                       memory::format_tag::any);
-            auto wghDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(wghMemPtr->getStaticDims()),
-                                                                                        memory::data_type::f32,
-                                                                                        memory::format_tag::any);
-            auto outDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(dstMemPtr->getStaticDims()),
-                                                                                        memory::data_type::f32,
-                                                                                        memory::format_tag::any);
-
-            std::shared_ptr<MKLDNNDescriptor> anyDeconvDesc = createDefaultMkldnnDeconvDesc(inDesc, wghDesc, outDesc, false);
-            auto anyDeconvItpd = anyDeconvDesc->createPrimitiveDescriptorIterator(getEngine(), *attr);
-            if (static_cast<bool>(anyDeconvItpd)) {
-                auto prim_desc = convolution_backward_data::primitive_desc(anyDeconvItpd.get());
-                execPtr = std::make_shared<DeconvExecutorDefault>(prim_desc,
-                                                                  srcMemPtr->GetPrimitive().get_desc(),
-                                                                  wghMemPtr->GetPrimitive().get_desc(),
-                                                                  dstMemPtr->GetPrimitive().get_desc(),
-                                                                  getEngine());
-                return;
-            }
-        }
-    }
-    IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
-}
-
 void MKLDNNDeconvolutionNode::prepareParams() {
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto wghMemPtr = getParentEdgesAtPort(1)[0]->getMemoryPtr();
@@ -584,29 +595,92 @@ void MKLDNNDeconvolutionNode::prepareParams() {
         pAttrLocal = initPrimitiveAttr();
     }
 
-    const auto in_candidate = inMemoryDesc->getDnnlDesc();
-    const auto out_candidate = outMemoryDesc->getDnnlDesc();
-
-    mkldnn::memory::desc wgh_candidate;
-    if (isInt8) {
-        if (internalBlobMemory.empty()) {
-            wgh_candidate = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(int8WeightDims), memory::data_type::s8, memory::format_tag::any);
-        } else {
-            wgh_candidate = internalBlobMemory.front()->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+    if (isInt8 && internalBlobMemory.empty()) {
+        // the internal weights are reordered once to the layout of the selected implementation
+        mkldnn::memory::desc wgh_candidate(MKLDNNExtensionUtils::convertToDnnlDims(int8WeightDims), memory::data_type::s8, memory::format_tag::any);
+        auto desc = createInt8MkldnnDeconvDesc(inMemoryDesc->getDnnlDesc(), wgh_candidate, outMemoryDesc->getDnnlDesc());
+        auto itpd = desc->createPrimitiveDescriptorIterator(getEngine(), *pAttrLocal);
+        while (static_cast<bool>(itpd)) {
+            if (parse_impl_name(itpd.impl_info_str()) == selected_pd->getImplementationType()) {
+                prepareMemory(itpd);
+                break;
+            }
+            if (!itpd.next_impl())
+                break;
         }
-    } else {
-        wgh_candidate = getParentEdgesAtPort(1).front()->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
     }
 
-    std::shared_ptr<MKLDNNDescriptor> desc;
-    if (isInt8) {
-        desc = createInt8MkldnnDeconvDesc(in_candidate, wgh_candidate, out_candidate);
-    } else {
-        desc = createDefaultMkldnnDeconvDesc(in_candidate, wgh_candidate, out_candidate,
-                                             selected_pd->getImplementationType() == MKLDNNPlugin::impl_desc_type::jit_avx512_winograd);
+    DnnlMemoryDescCPtr int8WghDesc = nullptr;
+    if (isInt8 && !internalBlobMemory.empty()) {
+        int8WghDesc = internalBlobMemory.front()->GetDescWithType<DnnlMemoryDesc>();
     }
 
-    createDeconvPrim(desc, srcMemPtr, wghMemPtr, dstMemPtr, pAttrLocal, selected_pd->getImplementationType());
+    DeconvKey key = {inMemoryDesc, wghMemPtr->GetDescWithType<DnnlMemoryDesc>(), int8WghDesc, outMemoryDesc,
+                     stride, dilation, paddingL, paddingR, isInt8, *pAttrLocal, selected_pd->getImplementationType()};
+
+    auto engine = getEngine();
+    auto builder = [this, &engine](const DeconvKey& key) -> executorPtr {
+        std::shared_ptr<MKLDNNDescriptor> desc;
+        if (key.isInt8) {
+            if (key.int8Wgh) {
+                desc = createInt8MkldnnDeconvDesc(key.inp0->getDnnlDesc(), key.int8Wgh->getDnnlDesc(), key.out->getDnnlDesc());
+            }
+        } else {
+            desc = createDefaultMkldnnDeconvDesc(key.inp0->getDnnlDesc(), key.inp1->getDnnlDesc(), key.out->getDnnlDesc(),
+                                                 key.implType == MKLDNNPlugin::impl_desc_type::jit_avx512_winograd);
+        }
+
+        if (desc) {
+            auto itpd = desc->createPrimitiveDescriptorIterator(engine, key.attr);
+            while (static_cast<bool>(itpd)) {
+                impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+
+                if (impl_type == key.implType) {
+                    if (key.isInt8) {
+                        auto prim_desc = deconvolution_forward::primitive_desc(itpd.get());
+                        return std::make_shared<DeconvExecutorInt8>(prim_desc,
+                                                                    key.inp0->getDnnlDesc(),
+                                                                    key.int8Wgh->getDnnlDesc(),
+                                                                    key.out->getDnnlDesc(),
+                                                                    engine);
+                    }
+                    auto prim_desc = convolution_backward_data::primitive_desc(itpd.get());
+                    return std::make_shared<DeconvExecutorDefault>(prim_desc,
+                                                                   key.inp0->getDnnlDesc(),
+                                                                   key.inp1->getDnnlDesc(),
+                                                                   key.out->getDnnlDesc(),
+                                                                   engine);
+                }
+
+                if (!itpd.next_impl())
+                    break;
+            }
+        }
+
+        auto inDesc = mkldnn::memory::desc(key.inp0->getDnnlDesc().dims(), memory::data_type::f32, memory::format_tag::any);
+        auto wghDesc = mkldnn::memory::desc(key.inp1->getDnnlDesc().dims(), memory::data_type::f32, memory::format_tag::any);
+        auto outDesc = mkldnn::memory::desc(key.out->getDnnlDesc().dims(), memory::data_type::f32, memory::format_tag::any);
+
+        std::shared_ptr<MKLDNNDescriptor> anyDeconvDesc = createDefaultMkldnnDeconvDesc(inDesc, wghDesc, outDesc, false);
+        auto anyDeconvItpd = anyDeconvDesc->createPrimitiveDescriptorIterator(engine, key.attr);
+        if (static_cast<bool>(anyDeconvItpd)) {
+            auto prim_desc = convolution_backward_data::primitive_desc(anyDeconvItpd.get());
+            return std::make_shared<DeconvExecutorDefault>(prim_desc,
+                                                           key.inp0->getDnnlDesc(),
+                                                           key.inp1->getDnnlDesc(),
+                                                           key.out->getDnnlDesc(),
+                                                           engine);
+        }
+        return nullptr;
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+
+    execPtr = result.first;
+    if (!execPtr) {
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+    }
 
     if (std::dynamic_pointer_cast<DeconvExecutorInt8>(execPtr)) {
         primArgs = {{DNNL_ARG_SRC, srcMemPtr->GetPrimitive()},
@@ -617,7 +691,7 @@ void MKLDNNDeconvolutionNode::prepareParams() {
                     {DNNL_ARG_WEIGHTS, wghMemPtr->GetPrimitive()},
                     {DNNL_ARG_DIFF_SRC, dstMemPtr->GetPrimitive()}};
     }
-    MKLDNNNode::appendPostOpArgs(attr, primArgs, binaryPostOpsArgs);
+    MKLDNNNode::appendPostOpArgs(*pAttrLocal, primArgs, binaryPostOpsArgs);
 }
 
 void MKLDNNDeconvolutionNode::createPrimitive() {
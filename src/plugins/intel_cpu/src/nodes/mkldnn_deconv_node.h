@@ -52,6 +52,7 @@ public:
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return externOutShape ? PortMask(2) : 0; }
 
 private:
     using executorPtr = std::shared_ptr<DnnlExecutor>;
@@ -120,13 +121,6 @@ private:
                                                                  const mkldnn::memory::desc& wghDesc,
                                                                  const mkldnn::memory::desc& dstDesc) const;
 
-    void createDeconvPrim(std::shared_ptr<MKLDNNDescriptor> desc,
-                          MKLDNNMemoryPtr srcMemPtr,
-                          MKLDNNMemoryPtr wghMemPtr,
-                          MKLDNNMemoryPtr dstMemPtr,
-                          AttrPtr attr,
-                          impl_desc_type selectedImpl);
-
     std::string errorPrefix;
 
     bool canBeExecutedInInt8() const;
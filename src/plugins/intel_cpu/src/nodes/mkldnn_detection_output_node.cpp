@@ -4,6 +4,7 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <mutex>
 
 #include "mkldnn/ie_mkldnn.h"
@@ -263,30 +264,30 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
     }
 
     // NMS
-    for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
-                if (c != backgroundClassId) {  // Ignore background class
-                    int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pdetections = detectionsData + n * classesNum + c;
-
-                    const float *pboxes;
-                    const float *psizes;
-                    if (isShareLoc) {
-                        pboxes = decodedBboxesData + n * 4 * priorsNum;
-                        psizes = bboxSizesData + n * priorsNum;
-                    } else {
-                        pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
-                        psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
-                    }
-
-                    NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+    if (!decreaseClassId) {
+        // Caffe style, the classes of all images are independent
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                int *pdetections = detectionsData + n * classesNum + c;
+
+                const float *pboxes;
+                const float *psizes;
+                if (isShareLoc) {
+                    pboxes = decodedBboxesData + n * 4 * priorsNum;
+                    psizes = bboxSizesData + n * priorsNum;
+                } else {
+                    pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+                    psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
                 }
-            });
-        } else {
-            // MXNet style
+
+                NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+            }
+        });
+    } else {
+        // MXNet style, the candidates of the image are shared between its classes
+        parallel_for(imgNum, [&](int n) {
             int *pbuffer = indicesBufData + n * classesNum * priorsNum;
             int *pdetections = detectionsData + n * classesNum;
             int *pindices = indicesData + n * classesNum * priorsNum;
@@ -294,45 +295,49 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
             const float *psizes = bboxSizesData + n * locNumForClasses * priorsNum;
 
             NMSMX(pbuffer, pdetections, pindices, pboxes, psizes);
-        }
-
-        int detectionsTotal = 0;
-        detectionsTotal = parallel_sum(classesNum, detectionsTotal, [&](size_t c)->int {
-            return detectionsData[n * classesNum + c];
         });
+    }
+
+    for (int n = 0; n < imgNum; ++n) {
+        // offsets of the class detections in the combined list of this image
+        int *pdetections = detectionsData + n * classesNum;
+        std::vector<int> classOffsets(classesNum + 1, 0);
+        for (int c = 0; c < classesNum; ++c) {
+            classOffsets[c + 1] = classOffsets[c] + pdetections[c];
+        }
+        const int detectionsTotal = classOffsets[classesNum];
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap(detectionsTotal);
 
-            std::mutex mtx;
             parallel_for(classesNum, [&](int c) {
-                int detections = detectionsData[n * classesNum + c];
+                int detections = pdetections[c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
 
                 float *pconf  = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
 
+                auto *pmap = confIndicesClassMap.data() + classOffsets[c];
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
+                    pmap[i] = std::make_pair(pconf[pr], std::make_pair(c, pr));
                 }
             });
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only the keep_topk best detections are kept, so the rest of the list is not sorted
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
-            memset(detectionsData + n * classesNum, 0, classesNum * sizeof(int));
+            memset(pdetections, 0, classesNum * sizeof(int));
 
             for (size_t j = 0; j < confIndicesClassMap.size(); ++j) {
                 int cls = confIndicesClassMap[j].second.first;
                 int pr = confIndicesClassMap[j].second.second;
                 int *pindices = indicesData + n * classesNum * priorsNum + cls * priorsNum;
-                pindices[detectionsData[n * classesNum + cls]] = pr;
-                detectionsData[n * classesNum + cls]++;
+                pindices[pdetections[cls]] = pr;
+                pdetections[cls]++;
             }
         }
     }
@@ -848,46 +853,50 @@ inline void MKLDNNDetectionOutputNode::generateOutput(float* reorderedConfData,
     }
     memset(dstData, 0, dstDataSize);
 
-    // set final detection result to output blob
-    int count = 0;
-    for (int n = 0; n < imgNum; ++n) {
+    // set final detection result to output blob, the offset of each image class is the prefix sum of the previous detections
+    std::vector<int> outOffsets(imgNum * classesNum + 1, 0);
+    for (int i = 0; i < imgNum * classesNum; ++i) {
+        outOffsets[i + 1] = outOffsets[i] + detectionsData[i];
+    }
+    const int count = outOffsets[imgNum * classesNum];
+
+    parallel_for2d(imgNum, classesNum, [&](int n, int c) {
         const float *pconf   = reorderedConfData + n * confInfoLen * classesNum;
         const float *pboxes  = decodedBboxesData + n * priorsNum * 4 * locNumForClasses;
         const int *pindices  = indicesData + n * classesNum * priorsNum;
 
-        for (int c = 0; c < classesNum; ++c) {
-            for (int i = 0; i < detectionsData[n * classesNum + c]; ++i) {
-                int prIdx = pindices[c * priorsNum + i];
-
-                dstData[count * DETECTION_SIZE + 0] = static_cast<float>(n);
-                dstData[count * DETECTION_SIZE + 1] = static_cast<float>(decreaseClassId ? c-1 : c);
-                dstData[count * DETECTION_SIZE + 2] = pconf[c * confInfoLen + prIdx];
-
-                float xmin = isShareLoc ? pboxes[prIdx * 4 + 0] :
-                             pboxes[c * 4 * priorsNum + prIdx * 4 + 0];
-                float ymin = isShareLoc ? pboxes[prIdx * 4 + 1] :
-                             pboxes[c * 4 * priorsNum + prIdx * 4 + 1];
-                float xmax = isShareLoc ? pboxes[prIdx * 4 + 2] :
-                             pboxes[c * 4 * priorsNum + prIdx * 4 + 2];
-                float ymax = isShareLoc ? pboxes[prIdx * 4 + 3] :
-                             pboxes[c * 4 * priorsNum + prIdx * 4 + 3];
-
-                if (clipAfterNMS) {
-                    xmin = (std::max)(0.0f, (std::min)(1.0f, xmin));
-                    ymin = (std::max)(0.0f, (std::min)(1.0f, ymin));
-                    xmax = (std::max)(0.0f, (std::min)(1.0f, xmax));
-                    ymax = (std::max)(0.0f, (std::min)(1.0f, ymax));
-                }
+        float *pdst = dstData + outOffsets[n * classesNum + c] * DETECTION_SIZE;
+        for (int i = 0; i < detectionsData[n * classesNum + c]; ++i) {
+            int prIdx = pindices[c * priorsNum + i];
+
+            pdst[0] = static_cast<float>(n);
+            pdst[1] = static_cast<float>(decreaseClassId ? c-1 : c);
+            pdst[2] = pconf[c * confInfoLen + prIdx];
+
+            float xmin = isShareLoc ? pboxes[prIdx * 4 + 0] :
+                         pboxes[c * 4 * priorsNum + prIdx * 4 + 0];
+            float ymin = isShareLoc ? pboxes[prIdx * 4 + 1] :
+                         pboxes[c * 4 * priorsNum + prIdx * 4 + 1];
+            float xmax = isShareLoc ? pboxes[prIdx * 4 + 2] :
+                         pboxes[c * 4 * priorsNum + prIdx * 4 + 2];
+            float ymax = isShareLoc ? pboxes[prIdx * 4 + 3] :
+                         pboxes[c * 4 * priorsNum + prIdx * 4 + 3];
+
+            if (clipAfterNMS) {
+                xmin = (std::max)(0.0f, (std::min)(1.0f, xmin));
+                ymin = (std::max)(0.0f, (std::min)(1.0f, ymin));
+                xmax = (std::max)(0.0f, (std::min)(1.0f, xmax));
+                ymax = (std::max)(0.0f, (std::min)(1.0f, ymax));
+            }
 
-                dstData[count * DETECTION_SIZE + 3] = xmin;
-                dstData[count * DETECTION_SIZE + 4] = ymin;
-                dstData[count * DETECTION_SIZE + 5] = xmax;
-                dstData[count * DETECTION_SIZE + 6] = ymax;
+            pdst[3] = xmin;
+            pdst[4] = ymin;
+            pdst[5] = xmax;
+            pdst[6] = ymax;
 
-                ++count;
-            }
+            pdst += DETECTION_SIZE;
         }
-    }
+    });
 
     if (count < numResults) {
         // marker at end of boxes list
@@ -13,6 +13,7 @@
 #include "mkldnn/ie_mkldnn.h"
 #include "utils/general_utils.h"
 #include "common/cpu_memcpy.h"
+#include <common/primitive_hashing_utils.hpp>
 #include <ngraph/opsets/opset7.hpp>
 
 using namespace mkldnn;
@@ -240,9 +241,17 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
+        // the power of two FFT computes its twiddle factors on the fly
+        if (fftPlans.find(nComplex) == fftPlans.end() && !IsPowerOfTwo(nComplex)) {
+            auto builder = [](const FFTPlanKey& key) {
+                return std::make_shared<const FFTPlan>(key.nComplex, key.inverse);
+            };
+            auto cache = getRuntimeCache();
+            auto result = cache->getOrCreate(FFTPlanKey{nComplex, inverse}, builder);
+            if (!result.first) {
+                IE_THROW() << layerErrorPrefix << " FFT plan was not created for the length " << nComplex;
+            }
+            fftPlans[nComplex] = result.first;
         }
     }
 
@@ -262,12 +271,7 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
 
     // 1d case
     if (inputDataEdge->getMemory().GetShape().getRank() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
+        transformLine(output, outputShape[0], true);
     } else {
         dftNd(output, outputStrides);
     }
@@ -282,27 +286,26 @@ void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStride
         const size_t outputLen = outputComplexLen * 2;
 
         std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        }
+        size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
+        do {
+            parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
+                std::vector<float> gatheredData(outputLen);
+                auto parallelIterationCounter = iterationCounter;
+                parallelIterationCounter[parallelDimIndex] = dim;
+                gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+                transformLine(gatheredData.data(), outputComplexLen);
+                applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+            });
+            iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
+        } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
+    }
+}
+
+void MKLDNNDFTNode::transformLine(float* data, size_t nComplex, bool parallelize) const {
+    if (IsPowerOfTwo(nComplex)) {
+        fft(data, nComplex * 2, parallelize);
+    } else {
+        fftPlans.find(nComplex)->second->execute(data);
     }
 }
 
@@ -368,50 +371,180 @@ void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const
     }
 }
 
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
+size_t MKLDNNDFTNode::FFTPlanKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, nComplex);
+    seed = hash_combine(seed, inverse);
+    return seed;
+}
+
+bool MKLDNNDFTNode::FFTPlanKey::operator==(const FFTPlanKey& rhs) const {
+    return nComplex == rhs.nComplex && inverse == rhs.inverse;
+}
+
+namespace {
+constexpr double pi = 3.141592653589793238462643;
+
+// The radices above it make the butterflies slower than the Bluestein convolution
+constexpr size_t maxRadix = 32;
 
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
+inline std::complex<float> complexProd(const std::complex<float>& lhs, const std::complex<float>& rhs) {
+    return {getRealFromComplexProd(lhs.real(), lhs.imag(), rhs.real(), rhs.imag()),
+            getImaginaryFromComplexProd(lhs.real(), lhs.imag(), rhs.real(), rhs.imag())};
+}
+
+// The radix 4 goes first, then the prime factors in the increasing order
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> factors;
+    while (n % 4 == 0) {
+        factors.push_back(4);
+        n /= 4;
+    }
+    for (size_t p = 2; p * p <= n; ++p) {
+        while (n % p == 0) {
+            factors.push_back(p);
+            n /= p;
         }
+    }
+    if (n > 1) {
+        factors.push_back(n);
+    }
+    return factors;
+}
+} // namespace
 
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
+MKLDNNDFTNode::FFTPlan::FFTPlan(size_t nComplex, bool inverse) : nComplex(nComplex), inverse(inverse) {
+    const double sign = inverse ? 1.0 : -1.0;
+    factors = factorize(nComplex);
+    if (factors.empty() || factors.back() <= maxRadix) {
+        twiddles.resize(nComplex);
+        for (size_t k = 0; k < nComplex; ++k) {
+            const double phase = sign * 2.0 * pi * static_cast<double>(k) / static_cast<double>(nComplex);
+            twiddles[k] = Complex(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
         }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
+        return;
+    }
+
+    // X_k = w_k * sum_j (x_j * w_j) * conj(w_(k - j)), where w_k = exp(sign * i * pi * k^2 / n)
+    factors.clear();
+    size_t convolutionLen = 1;
+    while (convolutionLen < 2 * nComplex - 1) {
+        convolutionLen *= 2;
+    }
+    convolutionPlan = std::make_shared<const FFTPlan>(convolutionLen, false);
+
+    chirp.resize(nComplex);
+    for (size_t k = 0; k < nComplex; ++k) {
+        // k^2 is reduced modulo 2n to keep the phase accurate for the long signals
+        const uint64_t k2 = static_cast<uint64_t>(k) * k % (2 * nComplex);
+        const double phase = sign * pi * static_cast<double>(k2) / static_cast<double>(nComplex);
+        chirp[k] = Complex(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+    }
+
+    // the kernel is normalized to compute the inverse FFT of the convolution by the forward one
+    kernel.assign(convolutionLen, Complex(0.f, 0.f));
+    const float norm = 1.f / static_cast<float>(convolutionLen);
+    kernel[0] = std::conj(chirp[0]) * norm;
+    for (size_t k = 1; k < nComplex; ++k) {
+        kernel[k] = kernel[convolutionLen - k] = std::conj(chirp[k]) * norm;
+    }
+    convolutionPlan->execute(reinterpret_cast<float*>(kernel.data()));
 }
 
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
+void MKLDNNDFTNode::FFTPlan::execute(float* data) const {
+    auto* complexData = reinterpret_cast<Complex*>(data);
+    if (convolutionPlan) {
+        bluestein(complexData);
+    } else {
+        std::vector<Complex> input(complexData, complexData + nComplex);
+        transform(input.data(), complexData, nComplex, 1, 0);
+    }
+
+    if (inverse) {
+        for (size_t k = 0; k < 2 * nComplex; ++k) {
+            data[k] /= nComplex;
         }
-    });
-    return twiddles;
+    }
+}
+
+/* Decimation in time, the sub-transforms of the length n / p are computed for the every p-th input */
+void MKLDNNDFTNode::FFTPlan::transform(const Complex* in, Complex* out, size_t n, size_t stride, size_t factorIndex) const {
+    if (n == 1) {
+        out[0] = in[0];
+        return;
+    }
+    const size_t p = factors[factorIndex];
+    const size_t m = n / p;
+    for (size_t q = 0; q < p; ++q) {
+        transform(in + q * stride, out + q * m, m, stride * p, factorIndex + 1);
+    }
+
+    // W_n^j is twiddles[j * stride]
+    if (p == 2) {
+        for (size_t k = 0; k < m; ++k) {
+            const Complex even = out[k];
+            const Complex odd = complexProd(out[k + m], twiddles[k * stride]);
+            out[k] = even + odd;
+            out[k + m] = even - odd;
+        }
+    } else if (p == 4) {
+        for (size_t k = 0; k < m; ++k) {
+            const Complex t0 = out[k];
+            const Complex t1 = complexProd(out[k + m], twiddles[k * stride]);
+            const Complex t2 = complexProd(out[k + 2 * m], twiddles[2 * k * stride]);
+            const Complex t3 = complexProd(out[k + 3 * m], twiddles[3 * k * stride]);
+            const Complex sum02 = t0 + t2;
+            const Complex diff02 = t0 - t2;
+            const Complex sum13 = t1 + t3;
+            // (t1 - t3) multiplied by W_4 which is -i for the forward transform and i for the inverse one
+            const Complex diff13 = inverse ? Complex(t3.imag() - t1.imag(), t1.real() - t3.real())
+                                           : Complex(t1.imag() - t3.imag(), t3.real() - t1.real());
+            out[k] = sum02 + sum13;
+            out[k + m] = diff02 + diff13;
+            out[k + 2 * m] = sum02 - sum13;
+            out[k + 3 * m] = diff02 - diff13;
+        }
+    } else {
+        const size_t radixStride = stride * m;
+        std::vector<Complex> twiddled(p);
+        for (size_t k = 0; k < m; ++k) {
+            for (size_t q = 0; q < p; ++q) {
+                twiddled[q] = complexProd(out[k + q * m], twiddles[q * k * stride]);
+            }
+            for (size_t s = 0; s < p; ++s) {
+                Complex sum = twiddled[0];
+                size_t power = 0;
+                for (size_t q = 1; q < p; ++q) {
+                    power += s;
+                    if (power >= p)
+                        power -= p;
+                    sum += complexProd(twiddled[q], twiddles[power * radixStride]);
+                }
+                out[k + s * m] = sum;
+            }
+        }
+    }
+}
+
+void MKLDNNDFTNode::FFTPlan::bluestein(Complex* data) const {
+    const size_t convolutionLen = kernel.size();
+    std::vector<Complex> buffer(convolutionLen, Complex(0.f, 0.f));
+    for (size_t k = 0; k < nComplex; ++k) {
+        buffer[k] = complexProd(data[k], chirp[k]);
+    }
+    auto* bufferData = reinterpret_cast<float*>(buffer.data());
+    convolutionPlan->execute(bufferData);
+    // the inverse FFT is conj(FFT(conj(x))), the kernel includes the normalization
+    for (size_t k = 0; k < convolutionLen; ++k) {
+        buffer[k] = std::conj(complexProd(buffer[k], kernel[k]));
+    }
+    convolutionPlan->execute(bufferData);
+    for (size_t k = 0; k < nComplex; ++k) {
+        data[k] = complexProd(std::conj(buffer[k]), chirp[k]);
+    }
 }
 
 bool MKLDNNDFTNode::created() const {
@@ -5,6 +5,10 @@
 #pragma once
 
 #include <ie_common.h>
+#include <complex>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 #include <mkldnn_node.h>
 #include <string>
 
@@ -23,14 +27,43 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    struct FFTPlanKey {
+        size_t nComplex;
+        bool inverse;
+        size_t hash() const;
+        bool operator==(const FFTPlanKey& rhs) const;
+    };
+
+    // Mixed radix FFT of the length which isn't a power of two, the lengths with the large prime factors are
+    // transformed by the Bluestein algorithm
+    class FFTPlan {
+    public:
+        FFTPlan(size_t nComplex, bool inverse);
+        void execute(float* data) const;
+
+    private:
+        using Complex = std::complex<float>;
+
+        void transform(const Complex* in, Complex* out, size_t n, size_t stride, size_t factorIndex) const;
+        void bluestein(Complex* data) const;
+
+        size_t nComplex;
+        bool inverse;
+        std::vector<size_t> factors;
+        // W_n^k for k in [0, n)
+        std::vector<Complex> twiddles;
+        // Bluestein chirp, FFT of the convolution kernel and the power of two FFT computing the convolution
+        std::vector<Complex> chirp;
+        std::vector<Complex> kernel;
+        std::shared_ptr<const FFTPlan> convolutionPlan;
+    };
+
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
     void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
-
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
+    void transformLine(float* data, size_t nComplex, bool parallelize = false) const;
 
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    std::unordered_map<size_t, std::shared_ptr<const FFTPlan>> fftPlans;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -10,9 +10,250 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/jit_generator.hpp>
+#include <emitters/jit_bf16_emitters.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_sum_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_sum_kernel_f32 : public jit_uni_emb_bag_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_sum_kernel_f32)
+
+    explicit jit_uni_emb_bag_sum_kernel_f32(jit_emb_bag_sum_config_params jcp) : jit_uni_emb_bag_sum_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        if (jcp_.data_prc == Precision::BF16 && !mayiuse(avx512_core_bf16))
+            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_row_stride, ptr[reg_params + GET_OFF(row_stride)]);
+
+        Xbyak::Label unrolled_loop_label;
+        Xbyak::Label vector_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        // the columns are processed by blocks, so the accumulators of a block stay in the registers for the whole bag
+        L(unrolled_loop_label); {
+            cmp(reg_work_amount, unroll * step);
+            jl(vector_loop_label, T_NEAR);
+
+            sum_bag(unroll, step);
+
+            jmp(unrolled_loop_label, T_NEAR);
+        }
+
+        L(vector_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            sum_bag(1, step);
+
+            jmp(vector_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 1);
+            jl(exit_label, T_NEAR);
+
+            sum_bag(1, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        if (emu_vcvtneps2bf16)
+            emu_vcvtneps2bf16->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+    static constexpr int unroll = 4;
+    // the rows of the indices that far ahead are prefetched, the table is usually too large to be cached
+    static constexpr int prefetch_distance = 8;
+    static constexpr int cache_line_size = 64;
+    static constexpr int idx_size = sizeof(int);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_indices = r10;
+    Xbyak::Reg64 reg_indices_num = r11;
+    Xbyak::Reg64 reg_weights = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_row_stride = r14;
+    Xbyak::Reg64 reg_i = r15;
+    Xbyak::Reg64 reg_row = rax;
+    Xbyak::Reg64 reg_aux = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // vmm_acc(0) - vmm_acc(unroll - 1) are the accumulators
+    Vmm vmm_acc(int i) { return Vmm(i); }
+    Vmm vmm_val(int i) { return Vmm(unroll + 1 + i); }
+    Vmm vmm_weight = Vmm(unroll);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(unroll);
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+
+    // sums the bag rows for vec_num vectors of elt_num elements and moves to the next columns
+    inline void sum_bag(int vec_num, int elt_num) {
+        for (int v = 0; v < vec_num; v++)
+            uni_vpxor(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+
+        Xbyak::Label weighted_label;
+        Xbyak::Label store_label;
+        cmp(reg_weights, 0);
+        jne(weighted_label, T_NEAR);
+        sum_rows(vec_num, elt_num, false);
+        jmp(store_label, T_NEAR);
+        L(weighted_label);
+        sum_rows(vec_num, elt_num, true);
+        L(store_label);
+
+        for (int v = 0; v < vec_num; v++) {
+            if (elt_num == 1)
+                store_scalar(ptr[reg_dst + v * elt_num * jcp_.data_size], Xbyak::Xmm(vmm_acc(v).getIdx()));
+            else
+                store_vector(ptr[reg_dst + v * elt_num * jcp_.data_size], vmm_acc(v));
+        }
+
+        add(reg_src, vec_num * elt_num * jcp_.data_size);
+        add(reg_dst, vec_num * elt_num * jcp_.data_size);
+        sub(reg_work_amount, vec_num * elt_num);
+    }
+
+    inline void sum_rows(int vec_num, int elt_num, bool weighted) {
+        Xbyak::Label rows_loop_label;
+        Xbyak::Label rows_loop_end_label;
+        xor_(reg_i, reg_i);
+        L(rows_loop_label); {
+            cmp(reg_i, reg_indices_num);
+            jge(rows_loop_end_label, T_NEAR);
+
+            Xbyak::Label prefetch_end_label;
+            lea(reg_aux, ptr[reg_i + prefetch_distance]);
+            cmp(reg_aux, reg_indices_num);
+            jge(prefetch_end_label, T_NEAR);
+            movsxd(reg_aux, dword[reg_indices + reg_aux * idx_size]);
+            imul(reg_aux, reg_row_stride);
+            add(reg_aux, reg_src);
+            for (int offset = 0; offset < vec_num * elt_num * jcp_.data_size; offset += cache_line_size)
+                prefetcht0(ptr[reg_aux + offset]);
+            L(prefetch_end_label);
+
+            movsxd(reg_row, dword[reg_indices + reg_i * idx_size]);
+            imul(reg_row, reg_row_stride);
+            add(reg_row, reg_src);
+
+            if (weighted) {
+                load_scalar(xmm_weight, ptr[reg_weights + reg_i * jcp_.data_size]);
+                uni_vbroadcastss(vmm_weight, xmm_weight);
+            }
+            for (int v = 0; v < vec_num; v++) {
+                if (elt_num == 1)
+                    load_scalar(Xbyak::Xmm(vmm_val(v).getIdx()), ptr[reg_row + v * elt_num * jcp_.data_size]);
+                else
+                    load_vector(vmm_val(v), ptr[reg_row + v * elt_num * jcp_.data_size]);
+
+                if (weighted)
+                    uni_vfmadd231ps(vmm_acc(v), vmm_val(v), vmm_weight);
+                else
+                    uni_vaddps(vmm_acc(v), vmm_acc(v), vmm_val(v));
+            }
+
+            add(reg_i, 1);
+            jmp(rows_loop_label, T_NEAR);
+        }
+        L(rows_loop_end_label);
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op) {
+        switch (jcp_.data_prc) {
+            case Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            default:
+                assert(!"unknown data_prc");
+        }
+    }
+    // rounds the floats to the nearest even BF16 values placed to the lower half of the register
+    inline void convert_to_bf16(Vmm vmm_dst) {
+        Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
+        if (mayiuse(avx512_core_bf16))
+            vcvtneps2bf16(ymm_dst, vmm_dst);
+        else
+            emu_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
+    }
+    inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst) {
+        Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
+
+        switch (jcp_.data_prc) {
+            case Precision::FP32:
+                uni_vmovups(op, vmm_dst);
+                break;
+            case Precision::BF16:
+                convert_to_bf16(vmm_dst);
+                vmovdqu16(op, ymm_dst);
+                break;
+            default:
+                assert(!"unknown data_prc");
+        }
+    }
+    inline void load_scalar(Xbyak::Xmm xmm_src, const Xbyak::Address &op) {
+        switch (jcp_.data_prc) {
+            case Precision::FP32:
+                uni_vmovss(xmm_src, op);
+                break;
+            case Precision::BF16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0x0);
+                uni_vpslld(xmm_src, xmm_src, 16);
+                break;
+            default:
+                assert(!"unknown data_prc");
+        }
+    }
+    inline void store_scalar(const Xbyak::Address &op, Xbyak::Xmm xmm_dst) {
+        switch (jcp_.data_prc) {
+            case Precision::FP32:
+                uni_vmovss(op, xmm_dst);
+                break;
+            case Precision::BF16:
+                // the tail is rounded as the vectors are, the whole register is converted since the BF16 tables are
+                // executed by the avx512 kernel only
+                convert_to_bf16(Vmm(xmm_dst.getIdx()));
+                uni_vpextrw(op, xmm_dst, 0x0);
+                break;
+            default:
+                assert(!"unknown data_prc");
+        }
+    }
+};
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -36,11 +277,49 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape) {
+void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape, const Precision& tablePrc) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    // the kernel doesn't depend on the shapes, so it's created once
+    if (!_kernel && (tablePrc == Precision::FP32 || tablePrc == Precision::BF16)) {
+        jit_emb_bag_sum_config_params jcp;
+        jcp.data_prc = tablePrc;
+        jcp.data_size = static_cast<int>(tablePrc.size());
+
+        if (mayiuse(x64::avx512_common)) {
+            _kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<x64::avx512_common>(jcp));
+        } else if (mayiuse(x64::avx2)) {
+            _kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<x64::avx2>(jcp));
+        } else if (mayiuse(x64::sse41)) {
+            _kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<x64::sse41>(jcp));
+        }
+
+        if (_kernel)
+            _kernel->create_ker();
+    }
+}
+
+Precision MKLDNNEmbeddingBagSumNode::getTablePrecision(const Precision& originalPrc) {
+    if (originalPrc == Precision::BF16 && !mayiuse(x64::avx512_core))
+        return Precision::FP32;
+    return originalPrc;
+}
+
+impl_desc_type MKLDNNEmbeddingBagSumNode::getImplType(const Precision& tablePrc) {
+    if (tablePrc != Precision::FP32 && tablePrc != Precision::BF16)
+        return impl_desc_type::ref_any;
+
+    if (mayiuse(x64::avx512_common)) {
+        return impl_desc_type::jit_avx512;
+    } else if (mayiuse(x64::avx2)) {
+        return impl_desc_type::jit_avx2;
+    } else if (mayiuse(x64::sse41)) {
+        return impl_desc_type::jit_sse42;
+    }
+    return impl_desc_type::ref_any;
 }
 
 template<typename T>
@@ -115,8 +394,60 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNEmbeddingBagSumNode::processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                               const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const size_t dataSize = static_cast<size_t>(_kernel->jcp_.data_size);
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                indicesSize = 0lu;
+
+            // the kernel doesn't check the indices, so the whole bag is validated in advance
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            auto arg = jit_emb_bag_sum_call_args();
+            arg.src = srcData;
+            arg.indices = indices;
+            arg.indices_num = indicesSize;
+            arg.weights = withWeights && _withWeights ? weightsData + weightsIdx * dataSize : nullptr;
+            arg.dst = dstData + obi * _embDepth * dataSize;
+            arg.work_amount = _embDepth;
+            arg.row_stride = _embDepth * dataSize;
+            (*_kernel)(&arg);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    // the kernel is created for the FP32 and BF16 tables only
+    if (_kernel) {
+        return processDataJit(srcData, weightsData, dstData, inDims, outDims);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
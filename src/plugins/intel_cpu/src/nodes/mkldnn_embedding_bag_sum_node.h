@@ -12,6 +12,37 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_sum_config_params {
+    InferenceEngine::Precision data_prc;  // precision of the embedding table, the per sample weights and the output
+    int data_size;
+};
+
+struct jit_emb_bag_sum_call_args {
+    const void *src;      // embedding table
+    const int *indices;   // indices of the bag rows
+    size_t indices_num;
+    const void *weights;  // per sample weights of the bag rows, nullptr if the bag isn't weighted
+    void *dst;            // output row of the bag
+    size_t work_amount;   // embedding depth
+    size_t row_stride;    // embedding table row size in bytes
+};
+
+struct jit_uni_emb_bag_sum_kernel {
+    void (*ker_)(const jit_emb_bag_sum_call_args *);
+
+    void operator()(const jit_emb_bag_sum_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_sum_kernel(jit_emb_bag_sum_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_sum_config_params jcp_;
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -35,11 +66,17 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrc);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+
+    // BF16 tables are kept only if the JIT kernel can read them, otherwise they are converted to FP32
+    static InferenceEngine::Precision getTablePrecision(const InferenceEngine::Precision& originalPrc);
+    static impl_desc_type getImplType(const InferenceEngine::Precision& tablePrc);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -49,6 +86,8 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_sum_kernel> _kernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -28,6 +28,7 @@ public:
 protected:
     void prepareParams() override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(NUM_SEGMENTS_IDX); }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
 private:
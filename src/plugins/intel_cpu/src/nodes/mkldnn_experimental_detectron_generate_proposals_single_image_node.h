@@ -20,6 +20,7 @@ public:
     bool created() const override;
 
     bool needShapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     bool needPrepareParams() const override;
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
@@ -19,6 +19,7 @@ public:
     bool created() const override;
 
     bool needShapeInfer() const override { return false; };
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     bool needPrepareParams() const override { return false; };
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); };
 
@@ -5,6 +5,7 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_input_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
@@ -16,10 +17,20 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
 #include <common/primitive_hashing_utils.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include "common/cpu_memcpy.h"
+#include "ie_parallel.hpp"
+#include "utils/numa_utils.h"
+#include <ie_system_conf.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numeric>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
 
 namespace {
 
@@ -71,8 +82,377 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+#define GET_OFF(field) offsetof(jit_sparse_fc_call_args, field)
+
+// the kernel keeps the accumulators of all the rows in the registers, so the rows of the call are limited by max_rows
+template <cpu_isa_t isa>
+struct jit_uni_sparse_fc_kernel_f32 : public jit_uni_sparse_fc_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_fc_kernel_f32)
+
+    jit_uni_sparse_fc_kernel_f32() : jit_uni_sparse_fc_kernel(isa == avx512_common ? 8 : 4), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        mov(reg_values, ptr[reg_params + GET_OFF(values)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_nnz, ptr[reg_params + GET_OFF(nnz)]);
+        mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+
+        Xbyak::Label exit_label;
+        for (size_t rows = max_rows; rows > 0; rows--) {
+            Xbyak::Label next_label;
+            cmp(reg_rows, rows);
+            jne(next_label, T_NEAR);
+            compute(rows);
+            jmp(exit_label, T_NEAR);
+            L(next_label);
+        }
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const size_t vec_per_block = MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK / (vlen / sizeof(float));
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_src_stride = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_dst_stride = r11;
+    Xbyak::Reg64 reg_values = r12;
+    Xbyak::Reg64 reg_indices = r13;
+    Xbyak::Reg64 reg_nnz = r14;
+    Xbyak::Reg64 reg_k = r15;
+    Xbyak::Reg64 reg_aux = rax;
+    Xbyak::Reg64 reg_bias = rbx;
+    Xbyak::Reg64 reg_rows = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_acc(size_t row, size_t v) const {
+        return Vmm(row * vec_per_block + v);
+    }
+    Vmm vmm_weights(size_t v) const {
+        return Vmm(max_rows * vec_per_block + v);
+    }
+    Vmm vmm_src() const {
+        return Vmm(max_rows * vec_per_block + vec_per_block);
+    }
+
+    void compute(size_t rows) {
+        Xbyak::Label no_bias_label, init_end_label;
+        cmp(reg_bias, 0);
+        je(no_bias_label, T_NEAR);
+        for (size_t r = 0; r < rows; r++)
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vmovups(vmm_acc(r, v), ptr[reg_bias + v * vlen]);
+        jmp(init_end_label, T_NEAR);
+        L(no_bias_label);
+        for (size_t r = 0; r < rows; r++)
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vpxor(vmm_acc(r, v), vmm_acc(r, v), vmm_acc(r, v));
+        L(init_end_label);
+
+        // each non-zero block is multiplied by the input channel of all the rows
+        Xbyak::Label loop_label, loop_end_label;
+        xor_(reg_k, reg_k);
+        L(loop_label);
+        {
+            cmp(reg_k, reg_nnz);
+            jge(loop_end_label, T_NEAR);
+
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vmovups(vmm_weights(v), ptr[reg_values + v * vlen]);
+
+            movsxd(reg_aux, dword[reg_indices + reg_k * sizeof(int)]);
+            lea(reg_aux, ptr[reg_src + reg_aux * sizeof(float)]);
+            for (size_t r = 0; r < rows; r++) {
+                uni_vbroadcastss(vmm_src(), ptr[reg_aux]);
+                for (size_t v = 0; v < vec_per_block; v++)
+                    uni_vfmadd231ps(vmm_acc(r, v), vmm_weights(v), vmm_src());
+                if (r + 1 < rows)
+                    add(reg_aux, reg_src_stride);
+            }
+
+            add(reg_values, MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK * sizeof(float));
+            add(reg_k, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        mov(reg_aux, reg_dst);
+        for (size_t r = 0; r < rows; r++) {
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vmovups(ptr[reg_aux + v * vlen], vmm_acc(r, v));
+            if (r + 1 < rows)
+                add(reg_aux, reg_dst_stride);
+        }
+    }
+};
+
+#undef GET_OFF
+#define GET_OFF(field) offsetof(jit_compressed_fc_call_args, field)
+
+// the weights are dequantized in the registers as (q - zero_point) * scale right before the multiplication, so only the
+// quantized weights are read from memory
+template <cpu_isa_t isa>
+struct jit_uni_compressed_fc_kernel_f32 : public jit_uni_compressed_fc_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_compressed_fc_kernel_f32)
+
+    explicit jit_uni_compressed_fc_kernel_f32(size_t bits)
+        : jit_uni_compressed_fc_kernel(isa == avx512_common ? 8 : 4, bits), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_zero_points, ptr[reg_params + GET_OFF(zero_points)]);
+        mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+        mov(reg_ic, ptr[reg_params + GET_OFF(ic)]);
+        mov(reg_group_size, ptr[reg_params + GET_OFF(group_size)]);
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+
+        if (bits == 4) {
+            mov(reg_aux.cvt32(), 0xF);
+            vmovd(Xbyak::Xmm(vmm_mask().getIdx()), reg_aux.cvt32());
+            vpbroadcastd(vmm_mask(), Xbyak::Xmm(vmm_mask().getIdx()));
+        }
+
+        Xbyak::Label exit_label;
+        for (size_t rows = max_rows; rows > 0; rows--) {
+            Xbyak::Label next_label;
+            cmp(reg_rows, rows);
+            jne(next_label, T_NEAR);
+            compute(rows);
+            jmp(exit_label, T_NEAR);
+            L(next_label);
+        }
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const size_t vec_per_block = MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK / (vlen / sizeof(float));
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_src_stride = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_dst_stride = r11;
+    Xbyak::Reg64 reg_weights = r12;
+    Xbyak::Reg64 reg_scales = r13;
+    Xbyak::Reg64 reg_zero_points = r14;
+    Xbyak::Reg64 reg_ic = r15;
+    Xbyak::Reg64 reg_len = rax;
+    Xbyak::Reg64 reg_aux = rbx;
+    Xbyak::Reg64 reg_group_size = rsi;
+    Xbyak::Reg64 reg_bias = rbp;
+    Xbyak::Reg64 reg_rows = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // the accumulators are followed by the weights, the zero points, the scales, the input, the mask and the temporary
+    Vmm vmm_acc(size_t row, size_t v) const {
+        return Vmm(row * vec_per_block + v);
+    }
+    Vmm vmm_weights(size_t v) const {
+        return Vmm(max_rows * vec_per_block + v);
+    }
+    Vmm vmm_zero_point(size_t v) const {
+        return Vmm(max_rows * vec_per_block + vec_per_block + v);
+    }
+    Vmm vmm_scale(size_t v) const {
+        return Vmm(max_rows * vec_per_block + 2 * vec_per_block + v);
+    }
+    Vmm vmm_src() const {
+        return Vmm(max_rows * vec_per_block + 3 * vec_per_block);
+    }
+    Vmm vmm_mask() const {
+        return Vmm(max_rows * vec_per_block + 3 * vec_per_block + 1);
+    }
+    // is used by avx512 only
+    Vmm vmm_tmp() const {
+        return Vmm(max_rows * vec_per_block + 3 * vec_per_block + 2);
+    }
+
+    // the 4 bit weights of the output channels i and i + 8 of the block are packed to the low and the high half of the byte i
+    void load_weights() {
+        if (bits == 8) {
+            for (size_t v = 0; v < vec_per_block; v++)
+                vpmovzxbd(vmm_weights(v), ptr[reg_weights + v * (vlen / sizeof(float))]);
+        } else if (isa == avx512_common) {
+            const Xbyak::Ymm ymm_low(vmm_weights(0).getIdx());
+            const Xbyak::Ymm ymm_high(vmm_tmp().getIdx());
+            vpmovzxbd(ymm_low, ptr[reg_weights]);
+            vpsrld(ymm_high, ymm_low, 4);
+            vpand(ymm_low, ymm_low, Xbyak::Ymm(vmm_mask().getIdx()));
+            vinserti64x4(Xbyak::Zmm(ymm_low.getIdx()), Xbyak::Zmm(ymm_low.getIdx()), ymm_high, 1);
+        } else {
+            vpmovzxbd(vmm_weights(0), ptr[reg_weights]);
+            vpsrld(vmm_weights(1), vmm_weights(0), 4);
+            vpand(vmm_weights(0), vmm_weights(0), vmm_mask());
+        }
+
+        for (size_t v = 0; v < vec_per_block; v++) {
+            uni_vcvtdq2ps(vmm_weights(v), vmm_weights(v));
+            uni_vsubps(vmm_weights(v), vmm_weights(v), vmm_zero_point(v));
+            uni_vmulps(vmm_weights(v), vmm_weights(v), vmm_scale(v));
+        }
+        add(reg_weights, MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK * bits / 8);
+    }
+
+    void compute(size_t rows) {
+        Xbyak::Label no_bias_label, init_end_label;
+        cmp(reg_bias, 0);
+        je(no_bias_label, T_NEAR);
+        for (size_t r = 0; r < rows; r++)
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vmovups(vmm_acc(r, v), ptr[reg_bias + v * vlen]);
+        jmp(init_end_label, T_NEAR);
+        L(no_bias_label);
+        for (size_t r = 0; r < rows; r++)
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vpxor(vmm_acc(r, v), vmm_acc(r, v), vmm_acc(r, v));
+        L(init_end_label);
+
+        Xbyak::Label group_loop_label, group_end_label, ic_loop_label;
+        L(group_loop_label);
+        {
+            cmp(reg_ic, 0);
+            jle(group_end_label, T_NEAR);
+
+            for (size_t v = 0; v < vec_per_block; v++) {
+                uni_vmovups(vmm_zero_point(v), ptr[reg_zero_points + v * vlen]);
+                uni_vmovups(vmm_scale(v), ptr[reg_scales + v * vlen]);
+            }
+            add(reg_zero_points, MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK * sizeof(float));
+            add(reg_scales, MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK * sizeof(float));
+
+            // the last group may be shorter
+            mov(reg_len, reg_group_size);
+            cmp(reg_ic, reg_len);
+            cmovl(reg_len, reg_ic);
+            sub(reg_ic, reg_len);
+
+            L(ic_loop_label);
+            {
+                load_weights();
+
+                mov(reg_aux, reg_src);
+                for (size_t r = 0; r < rows; r++) {
+                    uni_vbroadcastss(vmm_src(), ptr[reg_aux]);
+                    for (size_t v = 0; v < vec_per_block; v++)
+                        uni_vfmadd231ps(vmm_acc(r, v), vmm_weights(v), vmm_src());
+                    if (r + 1 < rows)
+                        add(reg_aux, reg_src_stride);
+                }
+                add(reg_src, sizeof(float));
+
+                sub(reg_len, 1);
+                jnz(ic_loop_label, T_NEAR);
+            }
+            jmp(group_loop_label, T_NEAR);
+        }
+        L(group_end_label);
+
+        mov(reg_aux, reg_dst);
+        for (size_t r = 0; r < rows; r++) {
+            for (size_t v = 0; v < vec_per_block; v++)
+                uni_vmovups(ptr[reg_aux + v * vlen], vmm_acc(r, v));
+            if (r + 1 < rows)
+                add(reg_aux, reg_dst_stride);
+        }
+    }
+};
+
+// the kernels process up to 8 rows per call
+constexpr size_t MAX_KERNEL_ROWS = 8;
+
+// the smaller weights fit the caches of a socket, so their split between the NUMA nodes doesn't pay off
+constexpr size_t TENSOR_PARALLEL_MIN_WEIGHTS_BYTES = 4 * 1024 * 1024;
+
+// runs the kernel for each block of max_rows rows by WEIGHTS_OC_BLOCK output channels of the output channel blocks
+// [ocbBegin, ocbEnd), the weights arguments of the output channel block are set by setWeights
+template <typename Args, typename Kernel, typename SetWeights>
+void executeByOcBlocks(Kernel& kernel, const float* src, float* dst, const float* bias, size_t M, size_t IC, size_t OC,
+                       size_t ocbBegin, size_t ocbEnd, const SetWeights& setWeights) {
+    constexpr size_t ocBlock = MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK;
+    const size_t maxRows = kernel.max_rows;
+
+    parallel_for2d(div_up(M, maxRows), ocbEnd - ocbBegin, [&](size_t mb, size_t ocbIdx) {
+        const size_t ocb = ocbBegin + ocbIdx;
+        const size_t rowBegin = mb * maxRows;
+        const size_t ocBegin = ocb * ocBlock;
+
+        auto arg = Args();
+        arg.src = src + rowBegin * IC;
+        arg.src_stride = IC * sizeof(float);
+        arg.rows = std::min(maxRows, M - rowBegin);
+        setWeights(arg, ocb);
+
+        if (ocBegin + ocBlock <= OC) {
+            arg.dst = dst + rowBegin * OC + ocBegin;
+            arg.dst_stride = OC * sizeof(float);
+            arg.bias = bias ? bias + ocBegin : nullptr;
+            kernel(&arg);
+            return;
+        }
+
+        // the tail block is computed in full into the scratch, then its valid output channels are copied
+        const size_t ocTail = OC - ocBegin;
+        float dstBlock[MAX_KERNEL_ROWS * ocBlock];
+        float biasBlock[ocBlock] = {};
+        if (bias)
+            cpu_memcpy(biasBlock, bias + ocBegin, ocTail * sizeof(float));
+        arg.dst = dstBlock;
+        arg.dst_stride = ocBlock * sizeof(float);
+        arg.bias = bias ? biasBlock : nullptr;
+        kernel(&arg);
+        for (size_t r = 0; r < arg.rows; r++)
+            cpu_memcpy(dst + (rowBegin + r) * OC + ocBegin, dstBlock + r * ocBlock, ocTail * sizeof(float));
+    });
+}
+
+// whether the block of the output channels by the input channel contains the zero weights only
+bool isZeroWeightsBlock(const float* weights, size_t OC, size_t IC, size_t ocb, size_t ic) {
+    const size_t ocBegin = ocb * MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK;
+    const size_t ocEnd = std::min(ocBegin + MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK, OC);
+    for (size_t oc = ocBegin; oc < ocEnd; oc++) {
+        if (weights[oc * IC + ic] != 0.0f)
+            return false;
+    }
+    return true;
+}
+
 } // namespace
 
+constexpr size_t MKLDNNFullyConnectedNode::WEIGHTS_OC_BLOCK;
+
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto fc = std::dynamic_pointer_cast<const FullyConnectedNode>(op);
@@ -193,6 +573,13 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
     outDims = isDynamicNode() ? makeDummyOutputDims(inDims) : getOutputShapeAtPort(0).getStaticDims();
 
+    const bool isFP32 = inputDataType == memory::data_type::f32 && outputDataType == memory::data_type::f32 &&
+                        weightsDataType == memory::data_type::f32;
+    useSparseWeights = isFP32 && canUseSparseWeights();
+    useCompressedWeights = isFP32 && !useSparseWeights && canUseCompressedWeights();
+    if (useSparseWeights || useCompressedWeights)
+        return;
+
     for (auto format : getAvailableFormatsForDims(getInputShapeAtPort(0))) {
         auto in_candidate = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(inDims), inputDataType, format);
         auto out_candidate = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(outDims), outputDataType, mkldnn::memory::format_tag::any);
@@ -222,6 +609,15 @@ void MKLDNNFullyConnectedNode::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
+    if (useSparseWeights) {
+        prepareSparseWeights();
+        return;
+    }
+    if (useCompressedWeights) {
+        prepareCompressedWeights();
+        return;
+    }
+
     AttrPtr attr = std::make_shared<mkldnn::primitive_attr>();
     setPostOps(*attr, dstMemPtr->getStaticDims());
 
@@ -327,6 +723,15 @@ void MKLDNNFullyConnectedNode::prepareParams() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (useSparseWeights) {
+        executeSparse();
+        return;
+    }
+    if (useCompressedWeights) {
+        executeCompressed();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -353,6 +758,315 @@ void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+const float* MKLDNNFullyConnectedNode::getConstantWeights() const {
+    const auto& weightsShape = getInputShapeAtPort(WEIGHTS_ID);
+    const auto inRank = getInputShapeAtPort(DATA_ID).getRank();
+    if (!one_of(inRank, 2u, 3u) || weightsShape.getRank() != 2 || !weightsShape.isStatic())
+        return nullptr;
+
+    // only the Constant inputs hold the memory
+    const auto weightsInput = std::dynamic_pointer_cast<MKLDNNInputNode>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!weightsInput)
+        return nullptr;
+    const auto weightsMem = weightsInput->getMemoryPtr();
+    if (!weightsMem || weightsMem->getDesc().getPrecision() != Precision::FP32)
+        return nullptr;
+    return reinterpret_cast<const float*>(weightsMem->GetPtr());
+}
+
+bool MKLDNNFullyConnectedNode::canUseSparseWeights() const {
+    // the post ops are applied by the oneDNN primitive only
+    if (minSparseRate >= 1.0f || !fusedWith.empty() || !mayiuse(avx2))
+        return false;
+
+    const auto* weights = getConstantWeights();
+    if (!weights)
+        return false;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t OCB = div_up(OC, WEIGHTS_OC_BLOCK);
+
+    size_t zeroBlocks = 0;
+    for (size_t ocb = 0; ocb < OCB; ocb++) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (isZeroWeightsBlock(weights, OC, IC, ocb, ic))
+                zeroBlocks++;
+        }
+    }
+    return zeroBlocks > 0 && zeroBlocks >= minSparseRate * OCB * IC;
+}
+
+void MKLDNNFullyConnectedNode::prepareSparseWeights() {
+    if (sparseKernel)
+        return;
+
+    const auto& weightsMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    const auto& weightsDims = weightsMem.getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t OCB = div_up(OC, WEIGHTS_OC_BLOCK);
+    const auto* weights = reinterpret_cast<const float*>(weightsMem.GetPtr());
+
+    // the blocks of each output channel block are stored by the ascending input channel
+    std::vector<int> offsets(OCB + 1, 0);
+    std::vector<int> indices;
+    std::vector<float> values;
+    for (size_t ocb = 0; ocb < OCB; ocb++) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (isZeroWeightsBlock(weights, OC, IC, ocb, ic))
+                continue;
+
+            indices.push_back(static_cast<int>(ic));
+            for (size_t oc = ocb * WEIGHTS_OC_BLOCK; oc < (ocb + 1) * WEIGHTS_OC_BLOCK; oc++)
+                values.push_back(oc < OC ? weights[oc * IC + ic] : 0.0f);
+        }
+        offsets[ocb + 1] = static_cast<int>(indices.size());
+    }
+    indices.insert(indices.begin(), offsets.begin(), offsets.end());
+    // an empty memory can't be created
+    if (values.empty())
+        values.resize(WEIGHTS_OC_BLOCK, 0.0f);
+
+    auto createMemory = [this](memory::data_type dataType, const void* data, size_t count, size_t elemSize) {
+        return [=]() {
+            MKLDNNMemoryPtr mem = std::make_shared<MKLDNNMemory>(getEngine());
+            mem->Create(DnnlBlockedMemoryDesc(Shape(VectorDims{count}), dataType, memory::format_tag::x));
+            cpu_memcpy(mem->GetPtr(), data, count * elemSize);
+            return mem;
+        };
+    };
+    auto createValues = createMemory(memory::data_type::f32, values.data(), values.size(), sizeof(float));
+    auto createIndices = createMemory(memory::data_type::s32, indices.data(), indices.size(), sizeof(int));
+
+    if (weightCache) {
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", weights);
+        const auto key = getName() + "_sparse_" + std::to_string(OC) + "x" + std::to_string(IC) + "_" + ptr;
+        sparseValues = *weightCache->findOrCreate(key + "_values", createValues);
+        sparseIndices = *weightCache->findOrCreate(key + "_indices", createIndices);
+    } else {
+        sparseValues = createValues();
+        sparseIndices = createIndices();
+    }
+    splitWeightsByNumaNodes(sparseValues->GetPtr(), OCB, [&](size_t ocb) {
+        return offsets[ocb] * WEIGHTS_OC_BLOCK * sizeof(float);
+    });
+
+    if (mayiuse(avx512_common)) {
+        sparseKernel.reset(new jit_uni_sparse_fc_kernel_f32<avx512_common>());
+    } else {
+        sparseKernel.reset(new jit_uni_sparse_fc_kernel_f32<avx2>());
+    }
+    sparseKernel->create_ker();
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    const auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t OC = dstMem.getStaticDims().back();
+    const size_t OCB = div_up(OC, WEIGHTS_OC_BLOCK);
+
+    const auto* src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    auto* dst = reinterpret_cast<float*>(dstMem.GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr())
+                                   : nullptr;
+    const auto* values = reinterpret_cast<const float*>(sparseValues->GetPtr());
+    const auto* offsets = reinterpret_cast<const int*>(sparseIndices->GetPtr());
+    const int* indices = offsets + OCB + 1;
+
+    executeByNumaNodes(M, OCB, [&](size_t ocbBegin, size_t ocbEnd) {
+        executeByOcBlocks<jit_sparse_fc_call_args>(*sparseKernel, src, dst, bias, M, IC, OC, ocbBegin, ocbEnd,
+            [&](jit_sparse_fc_call_args& arg, size_t ocb) {
+                arg.values = values + offsets[ocb] * WEIGHTS_OC_BLOCK;
+                arg.indices = indices + offsets[ocb];
+                arg.nnz = offsets[ocb + 1] - offsets[ocb];
+            });
+    });
+}
+
+bool MKLDNNFullyConnectedNode::canUseCompressedWeights() const {
+    // the post ops are applied by the oneDNN primitive only
+    if (weightsCompression == Config::WeightsCompression::None || !fusedWith.empty() || !mayiuse(avx2))
+        return false;
+
+    return getConstantWeights() != nullptr;
+}
+
+void MKLDNNFullyConnectedNode::prepareCompressedWeights() {
+    if (compressedKernel)
+        return;
+
+    const auto& weightsMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    const auto& weightsDims = weightsMem.getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t OCB = div_up(OC, WEIGHTS_OC_BLOCK);
+    const size_t groupsNum = div_up(IC, compressionGroupSize);
+    const auto* weights = reinterpret_cast<const float*>(weightsMem.GetPtr());
+
+    const size_t bits = weightsCompression == Config::WeightsCompression::Int8 ? 8 : 4;
+    const float maxLevel = static_cast<float>((1 << bits) - 1);
+    const size_t blockBytes = WEIGHTS_OC_BLOCK * bits / 8;
+
+    // the padded output channels keep the zero scales, so they are computed as zeros
+    std::vector<uint8_t> packed(OCB * IC * blockBytes, 0);
+    std::vector<float> params(2 * OCB * groupsNum * WEIGHTS_OC_BLOCK, 0.0f);
+    float* scales = params.data();
+    float* zeroPoints = params.data() + OCB * groupsNum * WEIGHTS_OC_BLOCK;
+
+    parallel_for2d(OCB, groupsNum, [&](size_t ocb, size_t g) {
+        const size_t icBegin = g * compressionGroupSize;
+        const size_t icEnd = std::min(icBegin + compressionGroupSize, IC);
+        for (size_t i = 0; i < WEIGHTS_OC_BLOCK; i++) {
+            const size_t oc = ocb * WEIGHTS_OC_BLOCK + i;
+            if (oc >= OC)
+                break;
+
+            const float* row = weights + oc * IC;
+            const auto minMax = std::minmax_element(row + icBegin, row + icEnd);
+            const float minVal = *minMax.first;
+            float scale = (*minMax.second - minVal) / maxLevel;
+            if (scale == 0.0f)
+                scale = 1.0f;
+
+            const size_t paramsIdx = (ocb * groupsNum + g) * WEIGHTS_OC_BLOCK + i;
+            scales[paramsIdx] = scale;
+            zeroPoints[paramsIdx] = -minVal / scale;
+
+            for (size_t ic = icBegin; ic < icEnd; ic++) {
+                const float level = std::min(std::max(std::round((row[ic] - minVal) / scale), 0.0f), maxLevel);
+                const auto q = static_cast<uint8_t>(level);
+                uint8_t* block = packed.data() + (ocb * IC + ic) * blockBytes;
+                if (bits == 8) {
+                    block[i] = q;
+                } else {
+                    // the channels i and i + 8 share the byte, both are processed by this thread
+                    const size_t half = WEIGHTS_OC_BLOCK / 2;
+                    block[i % half] |= static_cast<uint8_t>(i < half ? q : q << 4);
+                }
+            }
+        }
+    });
+
+    auto createMemory = [this](memory::data_type dataType, const void* data, size_t count, size_t elemSize) {
+        return [=]() {
+            MKLDNNMemoryPtr mem = std::make_shared<MKLDNNMemory>(getEngine());
+            mem->Create(DnnlBlockedMemoryDesc(Shape(VectorDims{count}), dataType, memory::format_tag::x));
+            cpu_memcpy(mem->GetPtr(), data, count * elemSize);
+            return mem;
+        };
+    };
+    auto createWeights = createMemory(memory::data_type::u8, packed.data(), packed.size(), sizeof(uint8_t));
+    auto createParams = createMemory(memory::data_type::f32, params.data(), params.size(), sizeof(float));
+
+    if (weightCache) {
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", weights);
+        const auto key = getName() + "_compressed_" + std::to_string(bits) + "_" + std::to_string(compressionGroupSize) +
+                         "_" + std::to_string(OC) + "x" + std::to_string(IC) + "_" + ptr;
+        compressedWeights = *weightCache->findOrCreate(key + "_weights", createWeights);
+        compressedParams = *weightCache->findOrCreate(key + "_params", createParams);
+    } else {
+        compressedWeights = createWeights();
+        compressedParams = createParams();
+    }
+    splitWeightsByNumaNodes(compressedWeights->GetPtr(), OCB, [&](size_t ocb) {
+        return ocb * IC * blockBytes;
+    });
+
+    if (mayiuse(avx512_common)) {
+        compressedKernel.reset(new jit_uni_compressed_fc_kernel_f32<avx512_common>(bits));
+    } else {
+        compressedKernel.reset(new jit_uni_compressed_fc_kernel_f32<avx2>(bits));
+    }
+    compressedKernel->create_ker();
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    const auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t OC = dstMem.getStaticDims().back();
+    const size_t OCB = div_up(OC, WEIGHTS_OC_BLOCK);
+    const size_t groupsNum = div_up(IC, compressionGroupSize);
+
+    const auto* src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    auto* dst = reinterpret_cast<float*>(dstMem.GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr())
+                                   : nullptr;
+    const auto* weights = reinterpret_cast<const uint8_t*>(compressedWeights->GetPtr());
+    const auto* scales = reinterpret_cast<const float*>(compressedParams->GetPtr());
+    const auto* zeroPoints = scales + OCB * groupsNum * WEIGHTS_OC_BLOCK;
+    const size_t blockBytes = WEIGHTS_OC_BLOCK * compressedKernel->bits / 8;
+
+    executeByNumaNodes(M, OCB, [&](size_t ocbBegin, size_t ocbEnd) {
+        executeByOcBlocks<jit_compressed_fc_call_args>(*compressedKernel, src, dst, bias, M, IC, OC, ocbBegin, ocbEnd,
+            [&](jit_compressed_fc_call_args& arg, size_t ocb) {
+                arg.weights = weights + ocb * IC * blockBytes;
+                arg.scales = scales + ocb * groupsNum * WEIGHTS_OC_BLOCK;
+                arg.zero_points = zeroPoints + ocb * groupsNum * WEIGHTS_OC_BLOCK;
+                arg.ic = IC;
+                arg.group_size = compressionGroupSize;
+            });
+    });
+}
+
+void MKLDNNFullyConnectedNode::splitWeightsByNumaNodes(const void* weights, size_t OCB,
+                                                       const std::function<size_t(size_t)>& ocbOffset) {
+    tensorParallelNumaNodes.clear();
+    if (!tensorParallelExecutor || ocbOffset(OCB) < TENSOR_PARALLEL_MIN_WEIGHTS_BYTES)
+        return;
+
+    const auto numaNodes = getAvailableNUMANodes();
+    const size_t parts = std::min(numaNodes.size(), OCB);
+    if (parts < 2)
+        return;
+
+    // the output channels are independent, so each node writes its own part of the output and nothing is reduced
+    tensorParallelNumaNodes.assign(numaNodes.begin(), numaNodes.begin() + parts);
+    const auto* bytes = static_cast<const uint8_t*>(weights);
+    for (size_t p = 0; p < parts; p++) {
+        const size_t begin = ocbOffset(OCB * p / parts);
+        const size_t end = ocbOffset(OCB * (p + 1) / parts);
+        numa::bindToNode(bytes + begin, end - begin, tensorParallelNumaNodes[p]);
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeByNumaNodes(size_t M, size_t OCB, const std::function<void(size_t, size_t)>& execute) {
+    // the more rows reuse the weights from the caches, so the execution isn't bound by the memory bandwidth
+    const size_t parts = tensorParallelNumaNodes.size();
+    if (parts < 2 || M > MAX_KERNEL_ROWS) {
+        execute(0, OCB);
+        return;
+    }
+
+    std::unique_ptr<std::atomic<bool>[]> claimed(new std::atomic<bool>[parts]);
+    for (size_t p = 0; p < parts; p++)
+        claimed[p] = false;
+    auto claimAndExecute = [&](size_t p) {
+        if (!claimed[p].exchange(true))
+            execute(OCB * p / parts, OCB * (p + 1) / parts);
+    };
+
+    // the stream executes the part placed on its NUMA node first, then the parts not taken by the other streams yet
+    std::vector<InferenceEngine::Task> tasks(parts, [&] {
+        const auto node = std::find(tensorParallelNumaNodes.begin(), tensorParallelNumaNodes.end(),
+                                    tensorParallelExecutor->GetNumaNodeId());
+        if (node != tensorParallelNumaNodes.end())
+            claimAndExecute(static_cast<size_t>(std::distance(tensorParallelNumaNodes.begin(), node)));
+        for (size_t p = 0; p < parts; p++)
+            claimAndExecute(p);
+    });
+    tensorParallelExecutor->runAndWait(tasks);
+}
+
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
@@ -499,6 +1213,9 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useSparseWeights || useCompressedWeights)
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -520,6 +1237,15 @@ void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useSparseWeights || useCompressedWeights) {
+        std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, Precision::FP32}, {LayoutType::ncsp, Precision::FP32}};
+        if (withBiases)
+            inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}},
+                             mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -6,12 +6,73 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "config.h"
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace MKLDNNPlugin {
 
+struct jit_sparse_fc_call_args {
+    const float *src;      // the first input row
+    size_t src_stride;     // the distance between the input rows in bytes
+    float *dst;            // the output channel block of the first output row
+    size_t dst_stride;     // the distance between the output rows in bytes
+    const float *values;   // the weights of the non-zero blocks of the output channel block
+    const int *indices;    // the input channel of each non-zero block
+    size_t nnz;            // the number of the non-zero blocks
+    const float *bias;     // the biases of the output channel block, nullptr if there are no biases
+    size_t rows;           // the number of the rows, up to the kernel max_rows
+};
+
+struct jit_uni_sparse_fc_kernel {
+    void (*ker_)(const jit_sparse_fc_call_args *);
+
+    void operator()(const jit_sparse_fc_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_sparse_fc_kernel(size_t max_rows) : ker_(nullptr), max_rows(max_rows) {}
+    virtual ~jit_uni_sparse_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    const size_t max_rows;
+};
+
+struct jit_compressed_fc_call_args {
+    const float *src;            // the first input row
+    size_t src_stride;           // the distance between the input rows in bytes
+    float *dst;                  // the output channel block of the first output row
+    size_t dst_stride;           // the distance between the output rows in bytes
+    const uint8_t *weights;      // the quantized weights of the output channel block
+    const float *scales;         // the scales of each group of the output channel block
+    const float *zero_points;    // the zero points of each group of the output channel block
+    const float *bias;           // the biases of the output channel block, nullptr if there are no biases
+    size_t ic;                   // the number of the input channels
+    size_t group_size;           // the number of the input channels sharing the scales and the zero points
+    size_t rows;                 // the number of the rows, up to the kernel max_rows
+};
+
+struct jit_uni_compressed_fc_kernel {
+    void (*ker_)(const jit_compressed_fc_call_args *);
+
+    void operator()(const jit_compressed_fc_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_compressed_fc_kernel(size_t max_rows, size_t bits) : ker_(nullptr), max_rows(max_rows), bits(bits) {}
+    virtual ~jit_uni_compressed_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    const size_t max_rows;
+    const size_t bits;  // 8 or 4 bits per weight
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -52,6 +113,22 @@ public:
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
 
+    void setMinSparseRate(float rate) {
+        minSparseRate = rate;
+    }
+
+    void setWeightsCompression(Config::WeightsCompression compression, size_t groupSize) {
+        weightsCompression = compression;
+        compressionGroupSize = groupSize;
+    }
+
+    void setTensorParallelExecutor(const InferenceEngine::IStreamsExecutor::Ptr& executor) {
+        tensorParallelExecutor = executor;
+    }
+
+    // the weights block of the sparse and compressed formats: WEIGHTS_OC_BLOCK output channels by 1 input channel
+    static constexpr size_t WEIGHTS_OC_BLOCK = 16;
+
 private:
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
@@ -64,8 +141,44 @@ private:
 
     void setPostOps(mkldnn::primitive_attr &attr, const VectorDims &dims, bool initWeights = false);
 
+    const float* getConstantWeights() const;
+
+    bool canUseSparseWeights() const;
+    void prepareSparseWeights();
+    void executeSparse();
+
+    bool canUseCompressedWeights() const;
+    void prepareCompressedWeights();
+    void executeCompressed();
+
+    // splits the large weights by the output channel blocks between the NUMA nodes and binds each part to its node,
+    // ocbOffset returns the byte offset of the output channel block, ocbOffset(OCB) is the size of the weights
+    void splitWeightsByNumaNodes(const void* weights, size_t OCB, const std::function<size_t(size_t)>& ocbOffset);
+    // executes the output channel blocks [0, OCB) by the ranges passed to execute, the blocks are split between the NUMA
+    // nodes if the weights are split and the few rows make the execution bound by the weights bandwidth
+    void executeByNumaNodes(size_t M, size_t OCB, const std::function<void(size_t, size_t)>& execute);
+
     bool withBiases = false;
 
+    // the constant weights are executed in the block-sparse format if the share of the zero blocks isn't less than the rate
+    float minSparseRate = 1.0f;
+    bool useSparseWeights = false;
+    MKLDNNMemoryPtr sparseValues;   // WEIGHTS_OC_BLOCK weights of each non-zero block
+    MKLDNNMemoryPtr sparseIndices;  // the offsets of the output channel blocks followed by the input channels of the blocks
+    std::shared_ptr<jit_uni_sparse_fc_kernel> sparseKernel;
+
+    // the constant weights are quantized per group of the input channels and dequantized by the kernel on the fly
+    Config::WeightsCompression weightsCompression = Config::WeightsCompression::None;
+    size_t compressionGroupSize = 128;
+    bool useCompressedWeights = false;
+    MKLDNNMemoryPtr compressedWeights;  // the quantized weights of each output channel block, input channel major
+    MKLDNNMemoryPtr compressedParams;   // the scales of each output channel block and group followed by the zero points
+    std::shared_ptr<jit_uni_compressed_fc_kernel> compressedKernel;
+
+    // the sparse and compressed weights are split by the output channel blocks between the NUMA nodes of the streams
+    InferenceEngine::IStreamsExecutor::Ptr tensorParallelExecutor;
+    std::vector<int> tensorParallelNumaNodes;  // the NUMA node of each part, empty if the weights aren't split
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
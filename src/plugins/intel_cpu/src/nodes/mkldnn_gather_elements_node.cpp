@@ -14,6 +14,7 @@
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 bool MKLDNNGatherElementsNode::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -67,6 +68,28 @@ void MKLDNNGatherElementsNode::prepareParams() {
             strideAx1Diff_ *= dataDims[i];
         strideAx1Diff_ -= strideAxDst_ * dstDims[axis_];
     }
+
+    useJit_ = false;
+    if (dataTypeSize_ != sizeof(int32_t))
+        return;
+    // the position along the row is added to the offsets only if the rows are laid along the axis stride
+    const bool addPosition = strideAxDst_ > 1;
+    if (!jitKernel_ || jitKernel_->getConfParams().addPosition != addPosition) {
+        jIndexGatherConfParams jcp;
+        jcp.addPosition = addPosition;
+        jitKernel_.reset();
+        if (x64::mayiuse(x64::avx512_common)) {
+            jitKernel_.reset(new jitUniIndexGatherKernel<x64::avx512_common>(jcp));
+        } else if (x64::mayiuse(x64::avx2)) {
+            jitKernel_.reset(new jitUniIndexGatherKernel<x64::avx2>(jcp));
+        }
+        if (jitKernel_)
+            jitKernel_->create_ker();
+    }
+    if (jitKernel_) {
+        const int rowLength = addPosition ? strideAxDst_ : dstAxDim_;
+        useJit_ = rowLength >= static_cast<int>(jitKernel_->getDataElPerVec());
+    }
 }
 
 void MKLDNNGatherElementsNode::initSupportedPrimitiveDescriptors() {
@@ -131,7 +154,50 @@ void MKLDNNGatherElementsNode::directExecution() {
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNGatherElementsNode::jitExecution() {
+    const auto *srcData = reinterpret_cast<const int32_t *>(getParentEdgeAt(dataIndex_)->getMemoryPtr()->GetPtr());
+    const auto *indices = reinterpret_cast<const int *>(getParentEdgeAt(indicesIndex_)->getMemoryPtr()->GetPtr());
+    auto *dstData = reinterpret_cast<int32_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const int outSize = getChildEdgesAtPort(0)[0]->getMemory().GetShape().getElementsCount();
+    const bool addPosition = jitKernel_->getConfParams().addPosition;
+    const int rowLength = addPosition ? strideAxDst_ : dstAxDim_;
+    const int dataElPerVec = jitKernel_->getDataElPerVec();
+    auto threadBody = [&](const int ithr, const int nthr) {
+        int start(0lu), end(0lu);
+        splitter(outSize, nthr, ithr, start, end);
+
+        // the row of the destination is gathered from src[rowBase + position * addPosition + indices[o] * strideAxDst_]
+        while (start < end) {
+            const int axStrideIt = start % strideAxDst_;
+            const int dstAxIdx = (start / strideAxDst_) % dstAxDim_;
+            const int dstShift0 = (start / strideAxDst_ / dstAxDim_) * strideAx1Diff_;
+            const int rowBase = start - axStrideIt + dstShift0 - dstAxIdx * strideAxDst_;
+            const int count = std::min(rowLength - start % rowLength, end - start);
+
+            indexGatherJitExecArgs arg;
+            arg.src = srcData + rowBase;
+            arg.indices = indices + start;
+            arg.dst = dstData + start;
+            arg.idxMuls = &strideAxDst_;
+            arg.workAmount = count;
+            arg.position = axStrideIt;
+            (*jitKernel_)(&arg);
+
+            for (int o = start + count - count % dataElPerVec; o < start + count; o++) {
+                const int position = addPosition ? axStrideIt + o - start : 0;
+                dstData[o] = srcData[rowBase + position + indices[o] * strideAxDst_];
+            }
+            start += count;
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNGatherElementsNode::execute(mkldnn::stream strm) {
+    if (useJit_)
+        return jitExecution();
     switch (dataTypeSize_) {
         case sizeof(PrecisionTrait<Precision::I32>::value_type):
             return directExecution<PrecisionTrait<Precision::I32>::value_type>();
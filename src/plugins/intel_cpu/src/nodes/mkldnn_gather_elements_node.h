@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "kernels/index_gather_kernel.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -38,8 +39,13 @@ private:
     int strideAx1Diff_ = 0;
     std::string errorPrefix_;
 
+    // 32 bit data is gathered by the rows: along the axis if it is the innermost one, otherwise along the axis stride
+    std::shared_ptr<jitIndexGatherKernelBase> jitKernel_;
+    bool useJit_ = false;
+
     template <typename dataType>
     void directExecution();
+    void jitExecution();
 };
 
 }  // namespace MKLDNNPlugin
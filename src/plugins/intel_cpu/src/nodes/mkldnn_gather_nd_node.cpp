@@ -15,6 +15,7 @@
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 #define THROW_ERROR IE_THROW() << "GatherND layer with name '" << getName() << "' "
 
@@ -97,10 +98,25 @@ void MKLDNNGatherNDNode::prepareParams() {
     attrs.srcStrides = srcMemPtr->GetDescWithType<BlockedMemoryDesc>()->getStrides();
     attrs.dstElementCount = dstMemPtr->GetShape().getElementsCount();
     attrs.sliceRank =  idxMemPtr->getStaticDims().back();
-    execPtr = std::make_shared<GatherNDExecutor>(attrs);
+
+    const bool jitApplicable = attrs.dataSize == sizeof(int32_t) && attrs.sliceRank > 0lu &&
+                               attrs.sliceRank <= jitIndexGatherKernelBase::maxSliceRank;
+    if (jitApplicable && (!jitKernel || jitKernel->getConfParams().sliceRank != attrs.sliceRank)) {
+        jIndexGatherConfParams jcp;
+        jcp.sliceRank = attrs.sliceRank;
+        if (x64::mayiuse(x64::avx512_common)) {
+            jitKernel.reset(new jitUniIndexGatherKernel<x64::avx512_common>(jcp));
+        } else if (x64::mayiuse(x64::avx2)) {
+            jitKernel.reset(new jitUniIndexGatherKernel<x64::avx2>(jcp));
+        }
+        if (jitKernel)
+            jitKernel->create_ker();
+    }
+    execPtr = std::make_shared<GatherNDExecutor>(attrs, jitApplicable ? jitKernel : nullptr);
 }
 
-MKLDNNGatherNDNode::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs) : dataSize(attrs.dataSize), sliceRank(attrs.sliceRank) {
+MKLDNNGatherNDNode::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs, const std::shared_ptr<jitIndexGatherKernelBase>& jitKernel)
+        : dataSize(attrs.dataSize), sliceRank(attrs.sliceRank) {
     batchSize = std::accumulate(attrs.srcDims.begin(), attrs.srcDims.begin() + attrs.batchDims, 1lu, std::multiplies<size_t>());
     dataLength = std::accumulate(attrs.srcDims.begin() + sliceRank + attrs.batchDims, attrs.srcDims.end(), 1lu,
                                  std::multiplies<size_t>());
@@ -121,6 +137,9 @@ MKLDNNGatherNDNode::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes&
         dataLength *= dataSize;
         srcBatchStride *= dataSize;
         dstBatchStride *= dataSize;
+    } else if (jitKernel) {
+        this->jitKernel = jitKernel;
+        srcShiftsI32.assign(srcShifts.begin(), srcShifts.end());
     }
 }
 
@@ -138,6 +157,10 @@ void MKLDNNGatherNDNode::GatherNDExecutor::exec(const MKLDNNMemoryPtr& srcMemPtr
         gatherBlocks(srcMemPtr, idxMemPtr, dstMemPtr);
         return;
     }
+    if (jitKernel) {
+        gatherElementwiseJit(srcMemPtr, idxMemPtr, dstMemPtr);
+        return;
+    }
 
     GatherNDContext ctx { this, srcMemPtr, idxMemPtr, dstMemPtr };
     OV_SWITCH(MKLDNNPlugin, GatherNDEmitter, ctx, dataSize,
@@ -219,6 +242,48 @@ void MKLDNNGatherNDNode::GatherNDExecutor::gatherElementwise(const MKLDNNMemoryP
     });
 }
 
+void MKLDNNGatherNDNode::GatherNDExecutor::gatherElementwiseJit(const MKLDNNMemoryPtr& srcMemPtr, const MKLDNNMemoryPtr& idxMemPtr,
+                                                                MKLDNNMemoryPtr& dstMemPtr) {
+    const int32_t* srcData = reinterpret_cast<const int32_t*>(srcMemPtr->GetPtr());
+    const int32_t* indices = reinterpret_cast<const int32_t*>(idxMemPtr->GetPtr());
+    int32_t* dstData = reinterpret_cast<int32_t*>(dstMemPtr->GetPtr());
+    const size_t dataElPerVec = jitKernel->getDataElPerVec();
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(workAmount, nthr, ithr, start, end);
+        size_t b = start / cycles;
+        size_t j = start % cycles;
+
+        // the kernel gathers the whole vectors of the batch part of the thread, the tail is gathered here
+        while (start < end) {
+            const size_t count = std::min(cycles - j, end - start);
+            const int32_t* shiftedSrcData = srcData + b * srcBatchStride;
+            const int32_t* shiftedIndices = indices + b * idxBatchStride + j * sliceRank;
+            int32_t* shiftedDstData = dstData + b * dstBatchStride + j;
+
+            indexGatherJitExecArgs arg;
+            arg.src = shiftedSrcData;
+            arg.indices = shiftedIndices;
+            arg.dst = shiftedDstData;
+            arg.idxMuls = srcShiftsI32.data();
+            arg.workAmount = count;
+            (*jitKernel)(&arg);
+
+            for (size_t k = count - count % dataElPerVec; k < count; k++) {
+                size_t dataIdx = 0lu;
+                for (size_t i = 0lu; i < sliceRank; i++)
+                    dataIdx += srcShifts[i] * shiftedIndices[k * sliceRank + i];
+                shiftedDstData[k] = shiftedSrcData[dataIdx];
+            }
+
+            start += count;
+            b++;
+            j = 0lu;
+        }
+    });
+}
+
 void MKLDNNGatherNDNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
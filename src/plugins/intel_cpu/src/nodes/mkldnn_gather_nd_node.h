@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "kernels/index_gather_kernel.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -39,13 +40,14 @@ private:
     } attrs;
 
     struct GatherNDExecutor {
-        GatherNDExecutor(const GatherNDAttributes& attrs);
+        GatherNDExecutor(const GatherNDAttributes& attrs, const std::shared_ptr<jitIndexGatherKernelBase>& jitKernel);
         ~GatherNDExecutor() = default;
         void exec(const MKLDNNMemoryPtr& srcMemPtr, const MKLDNNMemoryPtr& idxMemPtr, MKLDNNMemoryPtr& dstMemPtr);
 
     private:
         template <typename dataType>
         void gatherElementwise(const MKLDNNMemoryPtr& srcMemPtr, const MKLDNNMemoryPtr& idxMemPtr, MKLDNNMemoryPtr& dstMemPtr);
+        void gatherElementwiseJit(const MKLDNNMemoryPtr& srcMemPtr, const MKLDNNMemoryPtr& idxMemPtr, MKLDNNMemoryPtr& dstMemPtr);
         void gatherBlocks(const MKLDNNMemoryPtr& srcMemPtr, const MKLDNNMemoryPtr& idxMemPtr, MKLDNNMemoryPtr& dstMemPtr);
 
         size_t batchSize = 1lu;
@@ -60,6 +62,10 @@ private:
         size_t dstBatchStride = 1lu;
         VectorDims srcShifts;
 
+        // the elementwise gathering of 32 bit data, the shifts are passed to the kernel as the index multipliers
+        std::shared_ptr<jitIndexGatherKernelBase> jitKernel;
+        std::vector<int> srcShiftsI32;
+
         struct GatherNDContext {
             GatherNDExecutor* executor;
             const MKLDNNMemoryPtr srcMemPtr;
@@ -80,6 +86,9 @@ private:
 
     using executorPtr = std::shared_ptr<GatherNDExecutor>;
     executorPtr execPtr = nullptr;
+
+    // shared by the executors, recreated only if the slice rank changes
+    std::shared_ptr<jitIndexGatherKernelBase> jitKernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -48,6 +48,7 @@ protected:
     bool needPrepareParams() const override;
     void prepareParams() override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(1, 2, 3); }
 
 private:
     void initShortParams(threadExecParams& p, uint64_t start);
@@ -9,19 +9,38 @@
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 using namespace MKLDNNPlugin;
 
 MKLDNNIfNode::PortMapHelper::PortMapHelper(const MKLDNNMemoryPtr &from, const std::deque<MKLDNNMemoryPtr>& to,
-                                           const mkldnn::engine& eng) : srcMemPtr(from), dstMemPtrs(to) {
+                                           const mkldnn::engine& eng, const Sharing sharing)
+                                           : srcMemPtr(from), dstMemPtrs(to), sharing(sharing) {
     size = 0;
     if (srcMemPtr->getDesc().isDefined())
         size = srcMemPtr->GetSize();
 }
 
+void MKLDNNIfNode::PortMapHelper::bind() {
+    if (sharing == Sharing::ToMemories) {
+        void* ptr = srcMemPtr->GetData();
+        for (auto& dstMemPtr : dstMemPtrs) {
+            if (dstMemPtr->GetData() != ptr)
+                dstMemPtr->setDataHandle(ptr);
+        }
+    } else if (sharing == Sharing::FromMemory) {
+        void* ptr = dstMemPtrs.front()->GetData();
+        if (srcMemPtr->GetData() != ptr)
+            srcMemPtr->setDataHandle(ptr);
+    }
+}
+
 void MKLDNNIfNode::PortMapHelper::execute(mkldnn::stream& strm) {
+    if (sharing != Sharing::None)
+        return;
+
     // if output shapes are changed,
     // after subgraph inference we should redefine out memory of 'If'
     redefineTo();
@@ -75,6 +94,7 @@ void MKLDNNIfNode::getSupportedDescriptors() {
     for (const auto &param : ifOp->get_then_body()->get_parameters()) {
         auto inNode = inMapThen.find(param->get_friendly_name());
         if (inNode != inMapThen.end()) {
+            inputNodesThen.push_back(inNode->second);
             inputMemThen.push_back(getToMemories(inNode->second.get(), 0));
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have input with name: "
@@ -86,6 +106,7 @@ void MKLDNNIfNode::getSupportedDescriptors() {
     for (const auto &param : ifOp->get_else_body()->get_parameters()) {
         auto inNode = inMapElse.find(param->get_friendly_name());
         if (inNode != inMapElse.end()) {
+            inputNodesElse.push_back(inNode->second);
             inputMemElse.push_back(getToMemories(inNode->second.get(), 0));
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have input with name: "
@@ -100,6 +121,7 @@ void MKLDNNIfNode::getSupportedDescriptors() {
         auto outNode = outMapThen.find(inputID);
         if (outNode != outMapThen.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
+            outputNodesThen.push_back(outNode->second);
             outputMemThen.push_back(outMem);
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have output with name: "
@@ -114,6 +136,7 @@ void MKLDNNIfNode::getSupportedDescriptors() {
         auto outNode = outMapElse.find(inputID);
         if (outNode != outMapElse.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
+            outputNodesElse.push_back(outNode->second);
             outputMemElse.push_back(outMem);
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have output with name: "
@@ -187,27 +210,52 @@ void MKLDNNIfNode::createPrimitive() {
 void MKLDNNIfNode::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
     auto &inputPortMap = isThen ? thenInputPortMap : elseInputPortMap;
     auto &inputMems = isThen ? inputMemThen : inputMemElse;
+    auto &inputNodes = isThen ? inputNodesThen : inputNodesElse;
     auto &beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
     for (auto& map_rule : inputPortMap) {
         auto &fromMem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &toMems = inputMems[map_rule.to];
 
-        beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        // the body reads the outer memory directly, if none of the body nodes may write to its input
+        auto sharing = PortMapHelper::Sharing::None;
+        if (isSharable(fromMem, toMems.front()) && MKLDNNGraph::IsInputMemoryRebindable(inputNodes[map_rule.to]))
+            sharing = PortMapHelper::Sharing::ToMemories;
+
+        beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng, sharing));
     }
 }
 
 void MKLDNNIfNode::prepareAfterMappers(const bool isThen, const dnnl::engine& eng) {
     auto &outputPortMap = isThen ? thenOutputPortMap : elseOutputPortMap;
     auto &outputMems = isThen ? outputMemThen : outputMemElse;
+    auto &outputNodes = isThen ? outputNodesThen : outputNodesElse;
     auto &afterMappers = isThen ? afterThenMappers : afterElseMappers;
     for (auto& map_rule : outputPortMap) {
         auto toMems = getToMemories(this, map_rule.from);
         auto &fromMem = outputMems[map_rule.to];
 
-        afterMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        // the body writes the outer memory directly, if the body output is produced by a single node and the same
+        // body output is not mapped to another output of If
+        auto sharing = PortMapHelper::Sharing::None;
+        const auto& outputNode = outputNodes[map_rule.to];
+        const bool isMappedOnce = std::count_if(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& rule) {
+            return rule.to == map_rule.to;
+        }) == 1;
+        if (isMappedOnce && isSharable(fromMem, toMems.front()) &&
+            outputNode->getParentEdgeAt(0)->getParent()->getType() != Input &&
+            MKLDNNGraph::IsOutputMemoryRebindable(outputNode))
+            sharing = PortMapHelper::Sharing::FromMemory;
+
+        afterMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng, sharing));
     }
 }
 
+bool MKLDNNIfNode::isSharable(const MKLDNNMemoryPtr& from, const MKLDNNMemoryPtr& to) const {
+    // the dynamic memory is redefined after the body inference, so it is copied
+    return !isDynamicNode() && from->getDesc().isDefined() && to->getDesc().isDefined() &&
+           from->getDesc().isCompatible(to->getDesc());
+}
+
 std::deque<MKLDNNMemoryPtr> MKLDNNIfNode::getToMemories(const MKLDNNNode* node, const size_t port) const {
     std::deque<MKLDNNMemoryPtr> memories;
     for (auto edge : node->getChildEdgesAtPort(port))
@@ -222,6 +270,11 @@ void MKLDNNIfNode::execute(mkldnn::stream strm) {
     auto& afterMappers = condition ? afterThenMappers : afterElseMappers;
     auto& subGraph = condition ? subGraphThen : subGraphElse;
 
+    for (auto &mapper : beforeMappers)
+        mapper->bind();
+    for (auto &mapper : afterMappers)
+        mapper->bind();
+
     for (auto &mapper : beforeMappers)
         mapper->execute(strm);
     subGraph.ResetInferCount();
@@ -31,12 +31,14 @@ protected:
     void executeDynamicImpl(mkldnn::stream strm) override;
     bool needPrepareParams() const override { return false; };
     bool needShapeInfer() const override { return false; }
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
 
 private:
     void prepareBeforeMappers(const bool isThen, const dnnl::engine& eng);
     void prepareAfterMappers(const bool isThen, const dnnl::engine& eng);
 
     std::deque<MKLDNNMemoryPtr> getToMemories(const MKLDNNNode* node, const size_t port) const;
+    bool isSharable(const MKLDNNMemoryPtr& from, const MKLDNNMemoryPtr& to) const;
 
     struct PortMap {
         int from; /**< Index of external/internal out data */
@@ -45,8 +47,17 @@ private:
 
     class PortMapHelper {
     public:
-        PortMapHelper(const MKLDNNMemoryPtr& from, const std::deque<MKLDNNMemoryPtr>& to, const mkldnn::engine& eng);
+        enum class Sharing {
+            None,        /**< the memory is copied after the binding */
+            ToMemories,  /**< the "to" memories point to the buffer of the "from" memory */
+            FromMemory   /**< the "from" memory points to the buffer of the first "to" memory */
+        };
+
+        PortMapHelper(const MKLDNNMemoryPtr& from, const std::deque<MKLDNNMemoryPtr>& to, const mkldnn::engine& eng,
+                      const Sharing sharing = Sharing::None);
         ~PortMapHelper() = default;
+        // points the shared memory to the current buffer, since the buffers of the outer edges may be changed between inferences
+        void bind();
         void execute(mkldnn::stream& strm);
 
     private:
@@ -54,6 +65,7 @@ private:
 
         MKLDNNMemoryPtr srcMemPtr;
         std::deque<MKLDNNMemoryPtr> dstMemPtrs;
+        Sharing sharing;
 
         ptrdiff_t size;
     };
@@ -61,6 +73,7 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph subGraphThen;
     MKLDNNGraph subGraphElse;
+    std::vector<MKLDNNNodePtr> inputNodesThen, inputNodesElse, outputNodesThen, outputNodesElse;
     std::vector<std::deque<MKLDNNMemoryPtr>> inputMemThen, inputMemElse;
     std::deque<MKLDNNMemoryPtr> outputMemThen, outputMemElse;
 
@@ -6,6 +6,7 @@
 #include "common/cpu_memcpy.h"
 #include "mkldnn_extension_utils.h"
 
+#include <cstring>
 #include <string>
 #include <tuple>
 #include <algorithm>
@@ -330,16 +331,26 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
         return false;
     };
 
-    auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
-        return getName()
-                + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
-    };
-
     if (weightCache) {
-        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        // the constant is keyed by its content, so the same weights of the streams and of the compiled models are shared
+        // the key is a hash, so the content of the cached memory is compared as well, the memory of the colliding
+        // constants is cached by the distinct keys
+        auto isEqualBlob = [&, this] (const MKLDNNMemory& memory) {
+            if (memory.GetSize() != constOp->get_byte_size())
+                return false;
+            if (prec != InferenceEngine::Precision::FP32)
+                return std::memcmp(memory.GetPtr(), constOp->get_data_ptr(), constOp->get_byte_size()) == 0;
+            // the cloned blob has the subnormals set to zero
+            auto cached = static_cast<const uint32_t*>(memory.GetPtr());
+            auto u32data = constOp->get_data_ptr<uint32_t>();
+            for (size_t i = 0; i < constOp->get_byte_size() / sizeof(uint32_t); ++i) {
+                if (cached[i] != ((u32data[i] & (0xFF << 23)) == 0 ? 0 : u32data[i]))
+                    return false;
+            }
+            return true;
+        };
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreateEqual(weightCache->getContentKey(constOp), cloneBlob,
+                                                              isEqualBlob, weightsKey);
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new MKLDNNMemory(getEngine());
@@ -367,6 +378,10 @@ void MKLDNNInputNode::withMeanImage() {
     isMeanImage = true;
 }
 
+const std::string& MKLDNNInputNode::getWeightsKey() const {
+    return weightsKey;
+}
+
 MKLDNNMemoryCPtr MKLDNNInputNode::getMemoryPtr() const {
     return memoryPtr;
 }
@@ -24,6 +24,8 @@ public:
 
     void withMeanImage();
     MKLDNNMemoryCPtr getMemoryPtr() const;
+    // the key of the constant memory in the weights cache, empty if the cache isn't used
+    const std::string& getWeightsKey() const;
 
     void executeDynamicImpl(mkldnn::stream strm) override {}
     bool isExecutable() const override {
@@ -39,6 +41,7 @@ private:
 private:
     std::shared_ptr<ngraph::op::Constant> constOp;
     MKLDNNMemoryCPtr memoryPtr;
+    std::string weightsKey;
     bool isMeanImage = false;
 };
 
@@ -1816,7 +1816,9 @@ MKLDNNInterpolateNode::MKLDNNInterpolateNode(const std::shared_ptr<ngraph::Node>
         if (interpMode == ngInterpMode::nearest) {
             interpAttrs.mode = InterpolateMode::nearest;
         } else if (interpMode == ngInterpMode::linear) {
-            if (dataRank < 5) {
+            // without antialiasing the triangle filter of the width 2 is the linear interpolation between the two nearest
+            // input points, so the JIT kernels of linear_onnx are used. Only the antialiased 5D case needs the wide filter.
+            if (dataRank < 5 || !interpAttr.antialias) {
                 interpAttrs.mode = InterpolateMode::linear_onnx;
             } else {
                 interpAttrs.mode = InterpolateMode::linear;
@@ -109,6 +109,7 @@ public:
 
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(TARGET_SHAPE_ID, SCALES_ID, AXES_ID); }
     bool needPrepareParams() const override;
     void prepareParams() override;
 
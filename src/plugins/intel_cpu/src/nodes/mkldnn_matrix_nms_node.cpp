@@ -370,6 +370,10 @@ void MKLDNNMatrixNmsNode::execute(mkldnn::stream strm) {
     // TODO [DS NMS]: remove when nodes from models where nms is not last node in model supports DS
     if (isDynamicNode()) {
         size_t totalBox = std::accumulate(m_numPerBatch.begin(), m_numPerBatch.end(), 0);
+        // the outputs are bounded by the boxes kept per batch
+        const size_t maxTotalBox = m_maxBoxesPerBatch * m_numBatches;
+        reserveOutputMemory(NMS_SELECTED_OUTPUTS, {maxTotalBox, 6});
+        reserveOutputMemory(NMS_SELECTED_INDICES, {maxTotalBox, 1});
         redefineOutputMemory({{totalBox, 6}, {totalBox, 1}, {m_numBatches}});
     }
     float* selectedOutputs = reinterpret_cast<float*>(selectedOutputsMemPtr->GetPtr());
@@ -36,6 +36,7 @@ public:
     void executeDynamicImpl(mkldnn::stream strm) override;
 
     bool needShapeInfer() const override { return false; }
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     void prepareParams() override;
 
 private:
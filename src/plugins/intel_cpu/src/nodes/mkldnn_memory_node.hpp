@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include "ie_algorithm.hpp"
 #include "mkldnn_input_node.h"
+#include "mkldnn_memory_state.h"
 #include <mkldnn_node.h>
 #include <string>
 #include <memory>
@@ -23,6 +24,10 @@ class MKLDNNMemoryNode {
     std::string getId() {
         return _id;
     }
+    // the id without the suffix with the pair id, which is internal information, is the name of the variable
+    std::string getVariableName() {
+        return _id.substr(0, _id.find("/id="));
+    }
     virtual void setInputNode(MKLDNNNode *) = 0;
 };
 class MKLDNNMemoryOutputNode;
@@ -99,8 +104,10 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    MKLDNNVariableStorage::Ptr getStorage();
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNVariableStorage::Ptr storage;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -263,6 +263,10 @@ void MKLDNNMultiClassNmsNode::execute(mkldnn::stream strm) {
     // TODO [DS NMS]: remove when nodes from models where nms is not last node in model supports DS
     if (isDynamicNode()) {
         size_t totalBox = std::accumulate(m_selected_num.begin(), m_selected_num.end(), 0);
+        // the outputs are bounded by the boxes kept per batch
+        const size_t maxTotalBox = m_maxBoxesPerBatch * m_numBatches;
+        reserveOutputMemory(NMS_SELECTEDOUTPUTS, {maxTotalBox, 6});
+        reserveOutputMemory(NMS_SELECTEDINDICES, {maxTotalBox, 1});
         redefineOutputMemory({{totalBox, 6}, {totalBox, 1}, {m_numBatches}});
     }
     int* selected_indices = reinterpret_cast<int*>(selectedIndicesMemPtr->GetPtr());
@@ -327,6 +331,39 @@ float MKLDNNMultiClassNmsNode::intersectionOverUnion(const float* boxesI, const
     return intersection_area / (areaI + areaJ - intersection_area);
 }
 
+void MKLDNNMultiClassNmsNode::selectedBoxes::push(const float* box, float norm) {
+    ymin[size] = box[0];
+    xmin[size] = box[1];
+    ymax[size] = box[2];
+    xmax[size] = box[3];
+    area[size] = (box[2] - box[0] + norm) * (box[3] - box[1] + norm);
+    size++;
+}
+
+bool MKLDNNMultiClassNmsNode::selectedBoxes::suppress(const float* box, float norm, float iouThreshold) const {
+    const float yminI = box[0];
+    const float xminI = box[1];
+    const float ymaxI = box[2];
+    const float xmaxI = box[3];
+    const float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
+
+    // the same computations as intersectionOverUnion, the blocks exit early like the box-by-box loop does
+    const size_t blockSize = 16;
+    for (size_t start = 0; start < size; start += blockSize) {
+        const size_t end = (std::min)(start + blockSize, size);
+        int suppressed = 0;
+        for (size_t j = start; j < end; j++) {
+            const float intersectionArea = (std::max)((std::min)(ymaxI, ymax[j]) - (std::max)(yminI, ymin[j]) + norm, 0.f) *
+                                           (std::max)((std::min)(xmaxI, xmax[j]) - (std::max)(xminI, xmin[j]) + norm, 0.f);
+            const float iou = (areaI <= 0.f || area[j] <= 0.f) ? 0.f : intersectionArea / (areaI + area[j] - intersectionArea);
+            suppressed |= static_cast<int>(iou >= iouThreshold);
+        }
+        if (suppressed)
+            return true;
+    }
+    return false;
+}
+
 void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
@@ -407,25 +444,23 @@ void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* sco
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
+                // only the first max_out_box candidates are examined, so the rest doesn't need sorting
+                size_t max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                std::partial_sort(sorted_boxes.begin(), sorted_boxes.begin() + max_out_box, sorted_boxes.end(),
+                    [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                        return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                    });
+                const float norm = static_cast<float>(m_normalized == false);
+                selectedBoxes selected(max_out_box);
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+                selected.push(&boxesPtr[sorted_boxes[0].second * 4], norm);
                 io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
                 for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+                    bool box_is_selected = !selected.suppress(&boxesPtr[sorted_boxes[box_idx].second * 4], norm, m_iouThreshold);
 
                     if (box_is_selected) {
+                        selected.push(&boxesPtr[sorted_boxes[box_idx].second * 4], norm);
                         m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
                             sorted_boxes[box_idx].second);
                         io_selection_size++;
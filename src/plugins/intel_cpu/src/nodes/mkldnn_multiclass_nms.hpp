@@ -32,6 +32,7 @@ public:
     void executeDynamicImpl(mkldnn::stream strm) override;
 
     bool needShapeInfer() const override { return false; }
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     void prepareParams() override;
 
 private:
@@ -84,6 +85,18 @@ private:
         int suppress_begin_index;
     };
 
+    // the coordinates of the selected boxes are stored by components, so the IoU of a candidate
+    // with a block of the selected boxes is computed by a vectorized loop
+    struct selectedBoxes {
+        explicit selectedBoxes(size_t capacity) : ymin(capacity), xmin(capacity), ymax(capacity), xmax(capacity), area(capacity) {}
+        void push(const float* box, float norm);
+        // whether IoU of the box with any of the selected boxes is not less than the threshold
+        bool suppress(const float* box, float norm, float iouThreshold) const;
+
+        std::vector<float> ymin, xmin, ymax, xmax, area;
+        size_t size = 0;
+    };
+
     std::vector<filteredBoxes> m_filtBoxes;
 
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
@@ -790,6 +790,8 @@ void MKLDNNNonMaxSuppressionNode::execute(mkldnn::stream strm) {
 
     // TODO [DS NMS]: remove when nodes from models where nms is not last node in model supports DS
     if (isDynamicNode()) {
+        reserveOutputMemory(NMS_SELECTEDINDICES, {maxNumberOfBoxes, 3});
+        reserveOutputMemory(NMS_SELECTEDSCORES, {maxNumberOfBoxes, 3});
         VectorDims newDims{validOutputs, 3};
         redefineOutputMemory({newDims, newDims, {1}});
     }
@@ -99,6 +99,7 @@ public:
 
     bool isExecutable() const override;
     bool needShapeInfer() const override { return false; }
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     void prepareParams() override;
 
 private:
@@ -5,6 +5,7 @@
 #include "mkldnn_non_zero.h"
 #include <ngraph/opsets/opset3.hpp>
 #include <utils/bfloat16.hpp>
+#include "ie_parallel.hpp"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -59,21 +60,30 @@ void MKLDNNNonZeroNode::initSupportedPrimitiveDescriptors() {
 }
 
 template <typename T>
-size_t MKLDNNNonZeroNode::getNonZeroElementsCount(const T* src, const Shape& inShape) {
-    T zero = 0;
-    size_t count = 0;
-    size_t inSize = inShape.getElementsCount();
-    if (inShape.getRank() == 0) {
-        if (src[0] != zero)
-            count = 1;
-    } else {
-        for (size_t i = 0; i < inSize; i++) {
+size_t MKLDNNNonZeroNode::collectNonZeroIndices(const T* src, size_t inSize) {
+    const T zero = 0;
+    const size_t partsNum = parallel_get_max_threads();
+    threadIndices.resize(partsNum);
+    threadOffsets.resize(partsNum + 1);
+
+    parallel_for(partsNum, [&](size_t part) {
+        size_t start = 0, end = 0;
+        splitter(inSize, partsNum, part, start, end);
+        auto& indices = threadIndices[part];
+        indices.clear();
+        for (size_t i = start; i < end; i++) {
             if (src[i] != zero)
-                count++;
+                indices.push_back(i);
         }
+    });
+
+    threadOffsets[0] = 0;
+    for (size_t part = 0; part < partsNum; part++) {
+        threadOffsets[part + 1] = threadOffsets[part] + threadIndices[part].size();
     }
-    return count;
+    return threadOffsets[partsNum];
 }
+
 namespace {
 struct NonZeroContext {
     MKLDNNNonZeroNode &node;
@@ -103,37 +113,38 @@ void MKLDNNNonZeroNode::execute(mkldnn::stream strm) {
 }
 template <typename T>
 void MKLDNNNonZeroNode::executeSpecified() {
-    T zero = 0;
     T *src = reinterpret_cast<T *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     Shape inShape = getParentEdgeAt(0)->getMemory().GetShape();
     size_t inRank = inShape.getRank();
-    size_t nonZeroCount = getNonZeroElementsCount(src, inShape);
+    size_t inSize = inShape.getElementsCount();
+    // the input is scanned once, the indices of the non-zero elements are compacted to the per-thread buffers
+    size_t nonZeroCount = collectNonZeroIndices(src, inRank == 0 ? 1 : inSize);
 
     if (isDynamicNode()) {
+        // the output can't exceed the indices of all the input elements, so it isn't reallocated when the count grows
+        reserveOutputMemory(0, {inRank, inSize});
         VectorDims newDims{inRank, nonZeroCount};
         redefineOutputMemory({newDims});
     }
     int *dst = reinterpret_cast<int *>(dstMemPtr->GetPtr());
-    size_t inSize = inShape.getElementsCount();
     auto srcStrides = getParentEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     if (nonZeroCount == 0)
         return;
     if (inShape.getRank() == 0) {
         dst[0] = 0;
     } else {
-        size_t colIndex = 0, outIndex = 0;
-        for (size_t i = 0; i < inSize; i++) {
-            if (src[i] != zero) {
-                size_t temp = i;
+        parallel_for(threadIndices.size(), [&](size_t part) {
+            size_t colIndex = threadOffsets[part];
+            for (auto index : threadIndices[part]) {
+                size_t temp = index;
                 for (size_t j = 0; j < inRank; j++) {
-                    outIndex = j * nonZeroCount + colIndex;
-                    dst[outIndex] = temp / srcStrides[j];
+                    dst[j * nonZeroCount + colIndex] = temp / srcStrides[j];
                     temp = temp % srcStrides[j];
                 }
                 colIndex++;
             }
-        }
+        });
     }
 }
 
@@ -21,6 +21,7 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool needShapeInfer() const override {return false;};
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     bool needPrepareParams() const override {return false;};
     void executeDynamicImpl(mkldnn::stream strm) override;
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
@@ -34,7 +35,11 @@ private:
     template<typename T>
     struct NonZeroExecute;
     template <typename T>
-    size_t getNonZeroElementsCount(const T* arg, const Shape& arg_shape);
+    size_t collectNonZeroIndices(const T* src, size_t inSize);
+
+    // the linear indices of the non-zero elements found by each thread part of the input, keep the capacity between calls
+    std::vector<std::vector<size_t>> threadIndices;
+    std::vector<size_t> threadOffsets;
 };
 
 }  // namespace MKLDNNPlugin
@@ -25,6 +25,7 @@ public:
 
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     bool needPrepareParams() const override { return false; };
     void executeDynamicImpl(mkldnn::stream strm) override;
 
@@ -27,6 +27,7 @@ public:
 
 protected:
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(PADS_BEGIN_ID, PADS_END_ID); }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
 private:
@@ -24,6 +24,7 @@ public:
 
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(0); }
     bool needPrepareParams() const override;
 
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
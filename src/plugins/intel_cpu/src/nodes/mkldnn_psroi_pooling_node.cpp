@@ -328,18 +328,64 @@ void MKLDNNPSROIPoolingNode::executeBilinear(const inputType *srcData, outputTyp
     size_t numBins = spatialBinsX * spatialBinsY;
     const int binCount = nh * nw;
 
+    // the sample positions and weights depend only on the output bin, so they are computed once per ROI
+    // and shared by all the channels
+    struct BilinearSample {
+        bool inside;
+        int topLeft, topRight, bottomLeft, bottomRight;
+        float xWeight, yWeight;
+    };
+    std::vector<BilinearSample> samples(binCount * numBins);
+    for (int h = 0; h < nh; h++) {
+        for (int w = 0; w < nw; w++) {
+            for (size_t binY = 0; binY < spatialBinsY; binY++) {
+                const float boxYmin = roiStartH + (binY + 0) * (roiHeight / spatialBinsY);
+                const float boxYmax = roiStartH + (binY + 1) * (roiHeight / spatialBinsY);
+                const float heightScale = nh > 1 ? (boxYmax - boxYmin) * (height - 1) / (pooledHeight - 1) : 0.0f;
+                const float inY = nh > 1 ? (h * heightScale + boxYmin * (height - 1)) : 0.5f * (boxYmin + boxYmax) * (height - 1);
+                for (size_t binX = 0; binX < spatialBinsX; binX++) {
+                    const float boxXmin = roiStartW + (binX + 0) * (roiWidth / spatialBinsX);
+                    const float boxXmax = roiStartW + (binX + 1) * (roiWidth / spatialBinsX);
+
+                    const float widthScale = nw > 1 ? (boxXmax - boxXmin) * (width - 1) / (pooledWidth - 1) : 0.0f;
+                    const float inX = nw > 1 ? (w * widthScale + boxXmin * (width - 1)) : 0.5f * (boxXmin + boxXmax) * (width - 1);
+
+                    auto &sample = samples[(h * nw + w) * numBins + binY * spatialBinsX + binX];
+                    sample.inside = !(inY < 0 || inY > height - 1 || inX < 0 || inX > width - 1);
+                    if (sample.inside) {
+                        const int topYIndex = static_cast<int>(floorf(inY));
+                        int bottomYIndex = static_cast<int>(ceilf(inY));
+                        const int leftXIndex = static_cast<int>(floorf(inX));
+                        int rightXIndex = static_cast<int>(ceilf(inX));
+
+                        if (rightXIndex > width - 1) rightXIndex = width - 1;
+                        if (bottomYIndex > height - 1) bottomYIndex = height - 1;
+
+                        sample.topLeft = topYIndex * hInputStride + leftXIndex * wInputStride;
+                        sample.topRight = topYIndex * hInputStride + rightXIndex * wInputStride;
+                        sample.bottomLeft = bottomYIndex * hInputStride + leftXIndex * wInputStride;
+                        sample.bottomRight = bottomYIndex * hInputStride + rightXIndex * wInputStride;
+                        sample.xWeight = inX - leftXIndex;
+                        sample.yWeight = inY - topYIndex;
+                    }
+                }
+            }
+        }
+    }
+
     auto bilinearPsroi = [&] (int c, int h, int w, int binOffOut, int outBlkRes) {
         float accum = 0.0f;
         int binOffIn, inBlkRes;
         size_t dstIndex = binOffOut + h * hOutputStride + w * wOutputStride + outBlkRes;
         dstData[dstIndex] = 0;
 
+        const BilinearSample *binSamples = &samples[(h * nw + w) * numBins];
         for (size_t binY = 0; binY < spatialBinsY; binY++) {
-            const float boxYmin = roiStartH + (binY + 0) * (roiHeight / spatialBinsY);
-            const float boxYmax = roiStartH + (binY + 1) * (roiHeight / spatialBinsY);
-            const float heightScale = nh > 1 ? (boxYmax - boxYmin) * (height - 1) / (pooledHeight - 1) : 0.0f;
-            const float inY = nh > 1 ? (h * heightScale + boxYmin * (height - 1)) : 0.5f * (boxYmin + boxYmax) * (height - 1);
             for (size_t binX = 0; binX < spatialBinsX; binX++) {
+                const auto &sample = binSamples[binY * spatialBinsX + binX];
+                if (!sample.inside)
+                    continue;
+
                 size_t gc = c + (binY * spatialBinsX + binX) * nc;
                 if (srcDesc.hasLayoutType(LayoutType::nspc)) {
                     binOffIn = roiBatchInd * channels * height * width + gc;
@@ -350,38 +396,17 @@ void MKLDNNPSROIPoolingNode::executeBilinear(const inputType *srcData, outputTyp
                     inBlkRes = ((srcDesc.hasLayoutType(LayoutType::nCsp16c) || srcDesc.hasLayoutType(LayoutType::nCsp8c))
                                 ? gc % inBlockSize : 0);
                 }
-                const auto *bottomData = srcData + binOffIn;
-
-                const float boxXmin = roiStartW + (binX + 0) * (roiWidth / spatialBinsX);
-                const float boxXmax = roiStartW + (binX + 1) * (roiWidth / spatialBinsX);
-
-                const float widthScale = nw > 1 ? (boxXmax - boxXmin) * (width - 1) / (pooledWidth - 1) : 0.0f;
-                const float inX = nw > 1 ? (w * widthScale + boxXmin * (width - 1)) : 0.5f * (boxXmin + boxXmax) * (width - 1);
-
-                if (!(inY < 0 || inY > height - 1 || inX < 0 || inX > width - 1)) {
-                    const int topYIndex = static_cast<int>(floorf(inY));
-                    int bottomYIndex = static_cast<int>(ceilf(inY));
-                    const int leftXIndex = static_cast<int>(floorf(inX));
-                    int rightXIndex = static_cast<int>(ceilf(inX));
+                const auto *bottomData = srcData + binOffIn + inBlkRes;
 
-                    if (rightXIndex > width - 1) rightXIndex = width - 1;
-                    if (bottomYIndex > height - 1) bottomYIndex = height - 1;
+                const float topLeft = bottomData[sample.topLeft];
+                const float topRight = bottomData[sample.topRight];
+                const float bottomLeft = bottomData[sample.bottomLeft];
+                const float bottomRight = bottomData[sample.bottomRight];
 
-                    auto topLeftIndex = topYIndex * hInputStride + leftXIndex * wInputStride + inBlkRes;
-                    auto topRightIndex = topYIndex * hInputStride + rightXIndex * wInputStride + inBlkRes;
-                    auto bottomLeftIndex = bottomYIndex * hInputStride + leftXIndex * wInputStride + inBlkRes;
-                    auto bottomRightIndex = bottomYIndex * hInputStride + rightXIndex * wInputStride + inBlkRes;
+                const float top = topLeft + (topRight - topLeft) * sample.xWeight;
+                const float bottom = bottomLeft + (bottomRight - bottomLeft) * sample.xWeight;
 
-                    const float topLeft = bottomData[topLeftIndex];
-                    const float topRight = bottomData[topRightIndex];
-                    const float bottomLeft = bottomData[bottomLeftIndex];
-                    const float bottomRight = bottomData[bottomRightIndex];
-
-                    const float top = topLeft + (topRight - topLeft) * (inX - leftXIndex);
-                    const float bottom = bottomLeft + (bottomRight - bottomLeft) * (inX - leftXIndex);
-
-                    accum += top + (bottom - top) * (inY - topYIndex);
-                }
+                accum += top + (bottom - top) * sample.yWeight;
             }
         }
         accum /= numBins;
@@ -20,6 +20,7 @@ public:
     bool needPrepareParams() const override {return false;};
     bool needShapeInfer() const override {return false;};
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(RANGE_START, RANGE_LIMIT, RANGE_DELTA); }
     void executeDynamicImpl(mkldnn::stream strm) override;
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
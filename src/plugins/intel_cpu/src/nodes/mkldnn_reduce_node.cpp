@@ -72,6 +72,9 @@ using namespace Xbyak;
                                          uint8_t    *out_ptr_ncd   = out_ptr_n    + dst_data_size * (ocb * OD + od) * OH * OW * blk_size;
 
 namespace {
+// the minimal number of the input elements reduced by a thread to a partial result
+constexpr size_t reduce_min_part_size = 4096;
+
 struct ReduceKey {
     jit_reduce_config_params jcp;
     mkldnn::post_ops postOps;
@@ -89,6 +92,7 @@ size_t ReduceKey::hash() const {
     seed = hash_combine(seed, jcp.reduce_mode);
     seed = hash_combine(seed, jcp.src_dt);
     seed = hash_combine(seed, jcp.dst_dt);
+    seed = hash_combine(seed, jcp.post_dst_dt);
     seed = get_post_op_hash(seed, *postOps.get());
 
     return seed;
@@ -96,7 +100,8 @@ size_t ReduceKey::hash() const {
 
 bool ReduceKey::operator==(const ReduceKey &rhs) const {
     return jcp.layout == rhs.jcp.layout && jcp.reduce_mode == rhs.jcp.reduce_mode &&
-           jcp.src_dt == rhs.jcp.src_dt && jcp.dst_dt == rhs.jcp.dst_dt && *postOps.get() == *rhs.postOps.get();
+           jcp.src_dt == rhs.jcp.src_dt && jcp.dst_dt == rhs.jcp.dst_dt && jcp.post_dst_dt == rhs.jcp.post_dst_dt &&
+           *postOps.get() == *rhs.postOps.get();
 }
 } // namespace
 
@@ -1114,6 +1119,7 @@ struct jit_uni_reduce_post_kernel_f32 : public jit_uni_reduce_post_kernel, publi
 
         planar_layout = jcp_.layout == ReduceLayoutType::reduce_ncsp || jcp_.layout == ReduceLayoutType::reduce_nspc;
 
+        mov(reg_src, ptr[reg_params + GET_OFF_POST(src)]);
         mov(reg_dst, ptr[reg_params + GET_OFF_POST(dst)]);
         mov(reg_work_amount, ptr[reg_params + GET_OFF_POST(work_amount)]);
         mov(reg_channel_size, ptr[reg_params + GET_OFF_POST(channel_size)]);
@@ -1173,6 +1179,7 @@ private:
     size_t vlen = cpu_isa_traits<isa>::vlen;
     bool planar_layout = false;
 
+    Xbyak::Reg64 reg_src = rbp;
     Xbyak::Reg64 reg_dst = r8;
     Xbyak::Reg64 reg_work_amount = r9;
     Xbyak::Reg64 reg_total_work_amount = r10;
@@ -1235,23 +1242,23 @@ private:
                 jl(reduce_loop_end_label, T_NEAR);
 
                 // load
-                load_vector(vmm_dst, ptr[reg_dst], jcp_.dst_dt);
+                load_vector(vmm_dst, ptr[reg_src], jcp_.dst_dt);
                 if (isa == cpu::x64::sse41)
-                    load_vector(vmm_dst_aux, ptr[reg_dst + 4 * jcp_.dst_data_size], jcp_.dst_dt);
+                    load_vector(vmm_dst_aux, ptr[reg_src + 4 * jcp_.dst_data_size], jcp_.dst_dt);
 
                 // reduce and store
                 horiz_reduce_store(vmm_dst, jcp_.dst_dt);
                 if (isa == cpu::x64::sse41)
                     horiz_reduce_store(vmm_dst_aux, jcp_.dst_dt, true);
 
-                add(reg_dst, step * jcp_.dst_data_size);
+                add(reg_src, step * jcp_.dst_data_size);
                 sub(reg_work_amount, step);
 
                 jmp(reduce_loop_label, T_NEAR);
             }
             L(reduce_loop_end_label);
 
-            mov(reg_dst, ptr[reg_params + GET_OFF_POST(dst)]);
+            mov(reg_src, ptr[reg_params + GET_OFF_POST(src)]);
             mov(reg_work_amount, ptr[reg_params + GET_OFF_POST(work_amount)]);
         }
 
@@ -1273,26 +1280,27 @@ private:
                     cmp(reg_work_amount, step);
                     jl(reduce_loop_end_label, T_NEAR);
 
-                    load_vector(vmm_dst, ptr[reg_dst], jcp_.dst_dt);
+                    load_vector(vmm_dst, ptr[reg_src], jcp_.dst_dt);
                     reduce_map_kernel(vmm_dst);
                     if (attr_.post_ops_.len() != 0)
-                        apply_post_ops(jcp_.dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
-                    store_vector(ptr[reg_dst], vmm_dst, jcp_.dst_dt);
+                        apply_post_ops(jcp_.post_dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
+                    store_vector(ptr[reg_dst], vmm_dst, jcp_.post_dst_dt);
 
                     if (isa == cpu::x64::sse41) {
-                        load_vector(vmm_dst, ptr[reg_dst + 4 * jcp_.dst_data_size], jcp_.dst_dt);
+                        load_vector(vmm_dst, ptr[reg_src + 4 * jcp_.dst_data_size], jcp_.dst_dt);
                         reduce_map_kernel(vmm_dst);
                         if (attr_.post_ops_.len() != 0) {
                             if (jcp_.layout != ReduceLayoutType::reduce_ncsp)
                                 add(reg_oc_off, 4 * sizeof(float));
-                            apply_post_ops(jcp_.dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
+                            apply_post_ops(jcp_.post_dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
                             if (jcp_.layout != ReduceLayoutType::reduce_ncsp)
                                 sub(reg_oc_off, 4 * sizeof(float));
                         }
-                        store_vector(ptr[reg_dst + 4 * jcp_.dst_data_size], vmm_dst, jcp_.dst_dt);
+                        store_vector(ptr[reg_dst + 4 * jcp_.post_dst_data_size], vmm_dst, jcp_.post_dst_dt);
                     }
 
-                    add(reg_dst, step * jcp_.dst_data_size);
+                    add(reg_src, step * jcp_.dst_data_size);
+                    add(reg_dst, step * jcp_.post_dst_data_size);
                     if (jcp_.layout == ReduceLayoutType::reduce_nspc && attr_.post_ops_.len() != 0)
                         add(reg_oc_off, step * sizeof(float));
                     sub(reg_work_amount, step);
@@ -1311,21 +1319,22 @@ private:
                         cmp(reg_work_amount, step);
                         jl(reduce_loop_end_label, T_NEAR);
 
-                        load_vector(vmm_dst, ptr[reg_dst], jcp_.dst_dt);
-                        apply_post_ops(jcp_.dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
-                        store_vector(ptr[reg_dst], vmm_dst, jcp_.dst_dt);
+                        load_vector(vmm_dst, ptr[reg_src], jcp_.dst_dt);
+                        apply_post_ops(jcp_.post_dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
+                        store_vector(ptr[reg_dst], vmm_dst, jcp_.post_dst_dt);
 
                         if (isa == cpu::x64::sse41) {
-                            load_vector(vmm_dst, ptr[reg_dst + 4 * jcp_.dst_data_size], jcp_.dst_dt);
+                            load_vector(vmm_dst, ptr[reg_src + 4 * jcp_.dst_data_size], jcp_.dst_dt);
                             if (jcp_.layout != ReduceLayoutType::reduce_ncsp)
                                 add(reg_oc_off, 4 * sizeof(float));
-                            apply_post_ops(jcp_.dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
+                            apply_post_ops(jcp_.post_dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
                             if (jcp_.layout != ReduceLayoutType::reduce_ncsp)
                                 sub(reg_oc_off, 4 * sizeof(float));
-                            store_vector(ptr[reg_dst + 4 * jcp_.dst_data_size], vmm_dst, jcp_.dst_dt);
+                            store_vector(ptr[reg_dst + 4 * jcp_.post_dst_data_size], vmm_dst, jcp_.post_dst_dt);
                         }
 
-                        add(reg_dst, step * jcp_.dst_data_size);
+                        add(reg_src, step * jcp_.dst_data_size);
+                        add(reg_dst, step * jcp_.post_dst_data_size);
                         if (jcp_.layout == ReduceLayoutType::reduce_nspc && attr_.post_ops_.len() != 0)
                             add(reg_oc_off, step * sizeof(float));
                         sub(reg_work_amount, step);
@@ -1356,17 +1365,18 @@ private:
                 jl(reduce_loop_end_label, T_NEAR);
 
                 // load
-                load_scalar(xmm_dst, ptr[reg_dst], jcp_.dst_dt);
+                load_scalar(xmm_dst, ptr[reg_src], jcp_.dst_dt);
 
                 // reduce
                 reduce_map_kernel_scalar(xmm_dst);
 
                 // store
                 if (attr_.post_ops_.len() != 0)
-                    apply_post_ops(jcp_.dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
-                store_scalar(ptr[reg_dst], xmm_dst, jcp_.dst_dt);
+                    apply_post_ops(jcp_.post_dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
+                store_scalar(ptr[reg_dst], xmm_dst, jcp_.post_dst_dt);
 
-                add(reg_dst, step * jcp_.dst_data_size);
+                add(reg_src, step * jcp_.dst_data_size);
+                add(reg_dst, step * jcp_.post_dst_data_size);
                 if (jcp_.layout == ReduceLayoutType::reduce_nspc && attr_.post_ops_.len() != 0)
                     add(reg_oc_off, step * sizeof(float));
                 sub(reg_work_amount, step);
@@ -1386,13 +1396,14 @@ private:
                     jl(reduce_loop_end_label, T_NEAR);
 
                     // load
-                    load_scalar(xmm_dst, ptr[reg_dst], jcp_.dst_dt);
+                    load_scalar(xmm_dst, ptr[reg_src], jcp_.dst_dt);
 
                     // store
-                    apply_post_ops(jcp_.dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
-                    store_scalar(ptr[reg_dst], xmm_dst, jcp_.dst_dt);
+                    apply_post_ops(jcp_.post_dst_dt, jcp_.layout == ReduceLayoutType::reduce_ncsp);
+                    store_scalar(ptr[reg_dst], xmm_dst, jcp_.post_dst_dt);
 
-                    add(reg_dst, step * jcp_.dst_data_size);
+                    add(reg_src, step * jcp_.dst_data_size);
+                    add(reg_dst, step * jcp_.post_dst_data_size);
                     if (jcp_.layout == ReduceLayoutType::reduce_nspc && attr_.post_ops_.len() != 0)
                         add(reg_oc_off, step * sizeof(float));
                     sub(reg_work_amount, step);
@@ -1629,10 +1640,10 @@ private:
         uni_vmovhlps(xmm_aux3, xmm_aux3, xmm_dst); // aux3:f(3,4),f(4,4),4,4
         horiz_ps(xmm_dst, xmm_aux3);               // dst:f(1,2,3,4),...
         if (load_embedded) {
-            load_scalar(xmm_aux3, ptr[reg_dst], dst_dt);
+            load_scalar(xmm_aux3, ptr[reg_src], dst_dt);
             horiz_ps(xmm_dst, xmm_aux3);
         }
-        store_scalar(ptr[reg_dst], xmm_dst, dst_dt);
+        store_scalar(ptr[reg_src], xmm_dst, dst_dt);
     }
 
     inline void horiz_ps(const Xmm& xmm, const Operand& op) {
@@ -1808,8 +1819,16 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    // In jit mode the output memory is used as an intermediate accumulator for certain reduce modes as well. If the fused post ops
+    // (e.g. FakeQuantize) lower the output precision for such modes, the values are accumulated in FP32 intermediate memory instead,
+    // and the post kernel converts them to the output precision, so the int8 post ops don't cost the accuracy.
+    fuse_low_precision = jit_mode && !fusedWith.empty() && getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+                         one_of(output_prec, Precision::U8, Precision::I8) &&
+                         !one_of(algorithm, ReduceAnd, ReduceOr, ReduceMin, ReduceMax);
+    intermediate_prec = fuse_low_precision ? Precision(Precision::FP32) : output_prec;
+
     src_data_size = input_prec.size();
-    dst_data_size = output_prec.size();
+    dst_data_size = intermediate_prec.size();
 
     NodeConfig config;
     config.dynBatchSupport = false;
@@ -1852,7 +1871,8 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
                     pushDesc(LayoutType::nspc, LayoutType::nspc, input_prec, output_prec, impl_type);
                     pushDesc(LayoutType::nCsp8c, LayoutType::nCsp8c, input_prec, output_prec, impl_type);
                 }
-            } else {
+            } else if (!fuse_low_precision) {
+                // the hybrid layouts convert the intermediate memory to the output one byte-wise
                 if (mayiuse(cpu::x64::avx512_common)) {
                     pushDesc(LayoutType::nspc, LayoutType::ncsp, input_prec, output_prec, impl_type);
                     pushDesc(LayoutType::nCsp16c, LayoutType::ncsp, input_prec, output_prec, impl_type);
@@ -1887,6 +1907,9 @@ void MKLDNNReduceNode::prepareParams() {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     const SizeVector &dst_dims = dstMemPtr->getDesc().getShape().getDims();
     dst_size = dstMemPtr->GetSize();
+    if (fuse_low_precision) {
+        intermediate_data.resize(dst_size / output_prec.size() * intermediate_prec.size());
+    }
     calc_process_dst_dims(reduce_axes, dst_dims);
     if (jit_mode) {
         set_reduce_dim_flags();
@@ -1957,9 +1980,11 @@ void MKLDNNReduceNode::createPrimitive() {
     auto selectedPD = getSelectedPrimitiveDescriptor();
     jcp = jit_reduce_config_params();
     jcp.src_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().inConfs[REDUCE_DATA].getMemDesc()->getPrecision());
-    jcp.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().outConfs[0].getMemDesc()->getPrecision());
+    jcp.post_dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().outConfs[0].getMemDesc()->getPrecision());
+    jcp.dst_dt = fuse_low_precision ? MKLDNNExtensionUtils::IEPrecisionToDataType(intermediate_prec) : jcp.post_dst_dt;
     jcp.src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.src_dt);
     jcp.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.dst_dt);
+    jcp.post_dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.post_dst_dt);
     jcp.layout = layout;
     jcp.reduce_mode = getAlgorithm();
 
@@ -2014,21 +2039,29 @@ void MKLDNNReduceNode::execute(mkldnn::stream strm) {
 }
 
 void MKLDNNReduceNode::reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size) {
-    init_dst_data(out_ptr, dst_size);
+    // the values are accumulated in the intermediate memory and the post kernel writes them to the output one
+    uint8_t *proc_ptr = out_ptr;
+    if (fuse_low_precision) {
+        proc_ptr = intermediate_data.data();
+        dst_size = intermediate_data.size();
+    }
+
+    init_dst_data(proc_ptr, dst_size);
     reduce_stride = IW;
 
     if (layout == ReduceLayoutType::reduce_ncsp || layout == ReduceLayoutType::reduce_nspc) {
-        reduce_PLN(in_ptr, out_ptr);
+        reduce_PLN(in_ptr, proc_ptr);
     } else {
         if (ReduceC && (IC % blk_size)) {
-            reduce_BLK_concern_padding(in_ptr, out_ptr);
+            reduce_BLK_concern_padding(in_ptr, proc_ptr);
         } else {
-            reduce_BLK(in_ptr, out_ptr);
+            reduce_BLK(in_ptr, proc_ptr);
         }
     }
 
+    reduce_kernel_post_process(proc_ptr, out_ptr);
+
     if (is_hybrid_layout) {
-        uint8_t *proc_ptr = out_ptr;
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         out_ptr = reinterpret_cast<uint8_t *>(dstMemPtr->GetPtr());
         if (layout == ReduceLayoutType::reduce_nspc) {
@@ -2043,15 +2076,39 @@ void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
     if (ReduceN && !ReduceC && !ReduceD && !ReduceH && !ReduceW) {
         size_t IA = IC * ID * IH * IW;
         reduce_stride = IA;
-        parallel_for(IA / blk_size, [&](size_t iba){
-            size_t oba = iba;
-            reduce_kernel_process(in_ptr + iba * blk_size * src_data_size, out_ptr + oba * blk_size * dst_data_size,
-                                  blk_size, 0, IB);
-        });
+        auto reduce_rows = [&](const uint8_t *in_p, uint8_t *out_p, size_t rows) {
+            parallel_for(IA / blk_size, [&](size_t iba){
+                size_t oba = iba;
+                reduce_kernel_process(in_p + iba * blk_size * src_data_size, out_p + oba * blk_size * dst_data_size,
+                                      blk_size, 0, rows);
+            });
 
-        size_t tail_start = IA / blk_size * blk_size;
-        reduce_kernel_process(in_ptr + tail_start * src_data_size, out_ptr + tail_start * dst_data_size,
-                              IA - tail_start, 0, IB);
+            size_t tail_start = IA / blk_size * blk_size;
+            reduce_kernel_process(in_p + tail_start * src_data_size, out_p + tail_start * dst_data_size,
+                                  IA - tail_start, 0, rows);
+        };
+
+        // few columns of many rows: the rows are split between the threads, the partial rows are reduced in the order
+        const size_t threads_num = parallel_get_max_threads();
+        const size_t parts_num = std::min(threads_num, IB * IA / reduce_min_part_size);
+        if (IA / blk_size < threads_num && parts_num > 1 && parts_num <= IB && can_merge_partials()) {
+            std::vector<uint8_t> partials(parts_num * IA * dst_data_size);
+            init_dst_data(partials.data(), partials.size());
+            parallel_for(parts_num, [&](size_t part) {
+                size_t start = 0, end = 0;
+                splitter(IB, parts_num, part, start, end);
+                for (size_t iba = 0; iba < IA / blk_size; iba++) {
+                    reduce_kernel_process(in_ptr + (start * IA + iba * blk_size) * src_data_size,
+                                          partials.data() + (part * IA + iba * blk_size) * dst_data_size, blk_size, 0, end - start);
+                }
+                size_t tail_start = IA / blk_size * blk_size;
+                reduce_kernel_process(in_ptr + (start * IA + tail_start) * src_data_size,
+                                      partials.data() + (part * IA + tail_start) * dst_data_size, IA - tail_start, 0, end - start);
+            });
+            reduce_rows(partials.data(), out_ptr, parts_num);
+        } else {
+            reduce_rows(in_ptr, out_ptr, IB);
+        }
     } else {
         for (size_t ib = 0; ib < IB; ib++) {
             size_t ob = ReduceN ? 0 : ib; GET_PTR_N_PLN;
@@ -2094,12 +2151,24 @@ void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
                     }
                 }
             } else if (ReduceH && ReduceW) {
-                for (size_t ic = 0; ic < IC; ic++) {
-                    size_t oc = ReduceC ? 0 : ic; GET_PTR_NC_PLN;
-                    for (size_t id = 0; id < ID; id++) {
-                        size_t od = ReduceD ? 0 : id; GET_PTR_NCD_PLN;
-                        reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW, 1);
-                    }
+                if (OC == 1 && OD == 1) {
+                    reduce_parallel_partials(in_ptr_n, out_ptr_n, IC * ID * IH * IW, 1);
+                } else if (ReduceC) {
+                    parallel_for(ID, [&](size_t id) {
+                        for (size_t ic = 0; ic < IC; ic++) {
+                            size_t oc = 0; GET_PTR_NC_PLN;
+                            size_t od = id; GET_PTR_NCD_PLN;
+                            reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW, 1);
+                        }
+                    });
+                } else {
+                    parallel_for(IC, [&](size_t ic) {
+                        size_t oc = ic; GET_PTR_NC_PLN;
+                        for (size_t id = 0; id < ID; id++) {
+                            size_t od = 0; GET_PTR_NCD_PLN;
+                            reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW, 1);
+                        }
+                    });
                 }
             } else if (!ReduceH && ReduceW) {
                 for (size_t ic = 0; ic < IC; ic++) {
@@ -2189,8 +2258,6 @@ void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
             }
         }
     }
-
-    reduce_kernel_post_process(out_ptr);
 }
 
 void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
@@ -2205,24 +2272,7 @@ void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
                 reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW * blk_size);
             });
         } else if (ReduceC && ReduceD && ReduceH && ReduceW) {
-            if (input_prec != output_prec || getAlgorithm() == ReduceL2 ||
-                 algorithm == ReduceLogSumExp || algorithm == ReduceSumSquare) {
-                reduce_kernel_process(in_ptr_n, out_ptr_n, ICB * ID * IH * IW * blk_size);
-            } else {
-                // reduce parallelly
-                // step1: !ReduceC && ReduceD && ReduceH && ReduceW
-                size_t prc_size = ICB * blk_size * dst_data_size;
-                std::vector<uint8_t> vec_prc(prc_size);
-                init_dst_data(vec_prc.data(), prc_size);
-                uint8_t *out_ptr_n_cp = out_ptr_n;
-                out_ptr_n = vec_prc.data();
-                parallel_for(ICB, [&](size_t icb) {
-                    size_t ocb = icb; GET_PTR_NC_BLK;
-                    reduce_kernel_process(in_ptr_nc, out_ptr_nc, ID * IH * IW * blk_size);
-                });
-                // step2: ReduceC
-                reduce_kernel_process(out_ptr_n, out_ptr_n_cp, ICB * blk_size);
-            }
+            reduce_parallel_partials(in_ptr_n, out_ptr_n, ICB * ID * IH * IW * blk_size, 2);
         } else if (ReduceW) {
             for (size_t icb = 0; icb < ICB; icb++) {
                 size_t ocb = ReduceC ? 0 : icb; GET_PTR_NC_BLK;
@@ -2259,8 +2309,6 @@ void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
             }
         }
     }
-
-    reduce_kernel_post_process(out_ptr);
 }
 
 void MKLDNNReduceNode::reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t *out_ptr) {
@@ -2343,8 +2391,6 @@ void MKLDNNReduceNode::reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t
             }
         }
     }
-
-    reduce_kernel_post_process(out_ptr);
 }
 
 inline void MKLDNNReduceNode::reduce_kernel_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount,
@@ -2361,14 +2407,45 @@ inline void MKLDNNReduceNode::reduce_kernel_process(const uint8_t *in_p, uint8_t
     (*reduce_kernel)(&arg);
 }
 
-inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr) {
+// The contiguous input is reduced to the single output (an element if reduce_w is 1, a block otherwise) in two levels:
+// the parts of the input are reduced to the partial results in parallel, then the partials are reduced to the output
+// in the order of the parts, so the result doesn't depend on the threads scheduling.
+void MKLDNNReduceNode::reduce_parallel_partials(const uint8_t *in_ptr, uint8_t *out_ptr, size_t work_amount, size_t reduce_w) {
+    const size_t out_size = reduce_w == 1 ? 1 : blk_size;
+    const size_t work_blocks = work_amount / out_size;
+    const size_t parts_num = std::min(static_cast<size_t>(parallel_get_max_threads()), work_amount / reduce_min_part_size);
+    if (parts_num < 2 || !can_merge_partials()) {
+        reduce_kernel_process(in_ptr, out_ptr, work_amount, reduce_w);
+        return;
+    }
+
+    std::vector<uint8_t> partials(parts_num * out_size * dst_data_size);
+    init_dst_data(partials.data(), partials.size());
+    parallel_for(parts_num, [&](size_t part) {
+        size_t start = 0, end = 0;
+        splitter(work_blocks, parts_num, part, start, end);
+        reduce_kernel_process(in_ptr + start * out_size * src_data_size, partials.data() + part * out_size * dst_data_size,
+                              (end - start) * out_size, reduce_w);
+    });
+    reduce_kernel_process(partials.data(), out_ptr, parts_num * out_size, reduce_w);
+}
+
+// The partial results can be reduced by the same kernel if they have the input precision and the kernel doesn't map
+// the input values before the accumulation.
+inline bool MKLDNNReduceNode::can_merge_partials() const {
+    return input_prec == intermediate_prec && !one_of(getAlgorithm(), ReduceL2, ReduceLogSumExp, ReduceSumSquare);
+}
+
+inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *proc_ptr, uint8_t *out_ptr) {
+    const size_t post_dst_data_size = jcp.post_dst_data_size;
     const size_t integerDivisor = IB * IC * ID * IH * IW / (OB * OC * OD * OH * OW);
     const float divisor = static_cast<float>(integerDivisor);
     if (layout == ReduceLayoutType::reduce_ncsp || layout == ReduceLayoutType::reduce_nspc) {
         parallel_for2d(OB, OC, [&](size_t ob, size_t oc) {
-            uint8_t *out_p = out_ptr + (ob * OC + oc) * OD * OH * OW * dst_data_size;
+            const size_t offset = (ob * OC + oc) * OD * OH * OW;
             auto arg = jit_reduce_post_call_args();
-            arg.dst = static_cast<void *>(out_p);
+            arg.src = static_cast<void *>(proc_ptr + offset * dst_data_size);
+            arg.dst = static_cast<void *>(out_ptr + offset * post_dst_data_size);
             arg.oc_off = layout == ReduceLayoutType::reduce_nspc ? 0 : oc * sizeof(float);
             arg.channel_size = layout == ReduceLayoutType::reduce_nspc ? OW : OC; // OW is related to nspc-ncsp dimension reinterpret
             arg.work_amount = OD * OH * OW;
@@ -2379,9 +2456,10 @@ inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr) {
     } else {
         size_t OCB = div_up(OC, blk_size);
         parallel_for2d(OB, OCB, [&](size_t ob, size_t ocb) {
-            uint8_t *out_p = out_ptr + (ob * OCB + ocb) * OD * OH * OW * blk_size * dst_data_size;
+            const size_t offset = (ob * OCB + ocb) * OD * OH * OW * blk_size;
             auto arg = jit_reduce_post_call_args();
-            arg.dst = static_cast<void *>(out_p);
+            arg.src = static_cast<void *>(proc_ptr + offset * dst_data_size);
+            arg.dst = static_cast<void *>(out_ptr + offset * post_dst_data_size);
             arg.reduce_c = ReduceC ? 1 : 0;
             arg.oc_off = ocb * blk_size * sizeof(float);
             arg.work_amount = OD * OH * OW * blk_size;
@@ -2537,55 +2615,55 @@ inline void MKLDNNReduceNode::init_dst_data(uint8_t *out_ptr, size_t dst_size) {
             break;
         case ReduceAnd:
         case ReduceProd:
-            if (output_prec == Precision::FP32) {
+            if (intermediate_prec == Precision::FP32) {
                 auto out_p = reinterpret_cast<float *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = static_cast<float>(1); });
-            } else if (output_prec == Precision::I32) {
+            } else if (intermediate_prec == Precision::I32) {
                 auto out_p = reinterpret_cast<int32_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = static_cast<int32_t>(1); });
-            } else if (output_prec == Precision::BF16) {
+            } else if (intermediate_prec == Precision::BF16) {
                 auto out_p = reinterpret_cast<bfloat16_t*>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = static_cast<bfloat16_t>(1); });
-            } else if (output_prec == Precision::U8) {
+            } else if (intermediate_prec == Precision::U8) {
                 auto out_p = reinterpret_cast<uint8_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = static_cast<uint8_t>(1); });
-            } else if (output_prec == Precision::I8) {
+            } else if (intermediate_prec == Precision::I8) {
                 auto out_p = reinterpret_cast<int8_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = static_cast<int8_t>(1); });
             }
             break;
         case ReduceMax:
-            if (output_prec == Precision::FP32) {
+            if (intermediate_prec == Precision::FP32) {
                 auto out_p = reinterpret_cast<float *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<float>::lowest(); });
-            } else if (output_prec == Precision::I32) {
+            } else if (intermediate_prec == Precision::I32) {
                 auto out_p = reinterpret_cast<int32_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<int32_t>::min(); });
-            } else if (output_prec == Precision::BF16) {
+            } else if (intermediate_prec == Precision::BF16) {
                 auto out_p = reinterpret_cast<bfloat16_t*>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<bfloat16_t>::lowest(); });
-            } else if (output_prec == Precision::U8) {
+            } else if (intermediate_prec == Precision::U8) {
                 auto out_p = reinterpret_cast<uint8_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<uint8_t>::min(); });
-            } else if (output_prec == Precision::I8) {
+            } else if (intermediate_prec == Precision::I8) {
                 auto out_p = reinterpret_cast<int8_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<int8_t>::min(); });
             }
             break;
         case ReduceMin:
-            if (output_prec == Precision::FP32) {
+            if (intermediate_prec == Precision::FP32) {
                 auto out_p = reinterpret_cast<float *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<float>::max(); });
-            } else if (output_prec == Precision::I32) {
+            } else if (intermediate_prec == Precision::I32) {
                 auto out_p = reinterpret_cast<int32_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<int32_t>::max(); });
-            } else if (output_prec == Precision::BF16) {
+            } else if (intermediate_prec == Precision::BF16) {
                 auto out_p = reinterpret_cast<bfloat16_t*>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<bfloat16_t>::max(); });
-            } else if (output_prec == Precision::U8) {
+            } else if (intermediate_prec == Precision::U8) {
                 auto out_p = reinterpret_cast<uint8_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<uint8_t>::max(); });
-            } else if (output_prec == Precision::I8) {
+            } else if (intermediate_prec == Precision::I8) {
                 auto out_p = reinterpret_cast<int8_t *>(out_ptr);
                 parallel_for(dst_size / dst_data_size, [&](size_t i) { out_p[i] = std::numeric_limits<int8_t>::max(); });
             }
@@ -2942,11 +3020,13 @@ bool MKLDNNReduceNode::canFuse(const MKLDNNNodePtr& node) const {
     }
 
     // In jit mode we use the output memory as an intermediate accumulator for certain reduce modes.
-    // If the post ops node has a lower precision for such modes, post ops fusing won't be supposted, in order to avoid accuracy loss.
+    // If the post ops node has a lower precision for such modes, only the int8 ones are fused, since the values are accumulated
+    // in FP32 intermediate memory then. Other ones (e.g. BF16) aren't fused in order to avoid accuracy loss.
     if (output_prec == Precision::FP32 &&
         !node->getOriginalOutputPrecisions().empty() && node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32) {
         if (algorithm != ReduceAnd && algorithm != ReduceOr &&
-            algorithm != ReduceMin && algorithm != ReduceMax) {
+            algorithm != ReduceMin && algorithm != ReduceMax &&
+            !one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::U8, Precision::I8)) {
             return false;
         }
     }
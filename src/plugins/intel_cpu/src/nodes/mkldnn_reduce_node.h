@@ -23,8 +23,10 @@ struct jit_reduce_config_params {
     Algorithm reduce_mode;
     mkldnn::memory::data_type src_dt;
     mkldnn::memory::data_type dst_dt;
+    mkldnn::memory::data_type post_dst_dt;  // the post kernel output, differs from dst_dt if the values are accumulated in an intermediate memory
     int src_data_size;
     int dst_data_size;
+    int post_dst_data_size;
 };
 
 struct jit_reduce_call_args {
@@ -38,7 +40,7 @@ struct jit_reduce_call_args {
 };
 
 struct jit_reduce_post_call_args {
-    const void *src;
+    void *src;              // the reduced values, differs from dst if they are accumulated in an intermediate memory
     void *dst;
     size_t work_amount;
     size_t reduce_c = 2;    // only used in blocked layout [1: reduce channel dimension] [0: reduce other dimension] [other value: N/A]
@@ -92,6 +94,7 @@ public:
     bool created() const override;
     void execute(mkldnn::stream strm) override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(REDUCE_INDEXES); }
     void executeDynamicImpl(mkldnn::stream strm) override;
     bool canFuse(const MKLDNNNodePtr& node) const override;
     bool canBeInPlace() const override {
@@ -108,7 +111,9 @@ private:
     void reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t *out_ptr);
     inline void reduce_kernel_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount,
                                       size_t reduce_w = 2, size_t work_batch = 1, const int *tab_idx = NULL);
-    inline void reduce_kernel_post_process(uint8_t *out_ptr);
+    void reduce_parallel_partials(const uint8_t *in_ptr, uint8_t *out_ptr, size_t work_amount, size_t reduce_w);
+    inline bool can_merge_partials() const;
+    inline void reduce_kernel_post_process(uint8_t *proc_ptr, uint8_t *out_ptr);
     inline void init_dst_data(uint8_t *out_ptr, size_t dst_size);
     inline void create_working_memory();
     inline void calc_process_dst_dims(std::vector<int> &reduce_axes, const InferenceEngine::SizeVector &dst_dim);
@@ -132,13 +137,14 @@ private:
     bool keep_dims = true;
     bool is_hybrid_layout = false;
     bool compile_post_kernel = true;
+    bool fuse_low_precision = false;
     bool ReduceN, ReduceC, ReduceD, ReduceH, ReduceW;
     size_t IB, IC, ID, IH, IW;
     size_t OB, OC, OD, OH, OW;
     size_t src_data_size, dst_data_size;
     size_t reduce_stride;
     ReduceLayoutType layout;
-    InferenceEngine::Precision input_prec, output_prec;
+    InferenceEngine::Precision input_prec, output_prec, intermediate_prec;
     InferenceEngine::SizeVector src_dims;
     InferenceEngine::SizeVector process_dst_dims;
     InferenceEngine::SizeVector axes_for_reduction;
@@ -151,6 +157,7 @@ private:
     std::vector<const void*> postOpsDataPtrs;
 
     std::shared_ptr<mkldnn::memory> prc_mem;
+    std::vector<uint8_t> intermediate_data;
 
     std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
     std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
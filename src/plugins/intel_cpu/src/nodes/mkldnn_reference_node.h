@@ -20,6 +20,7 @@ public:
 
     std::vector<VectorDims> shapeInfer() const override;
     bool needShapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
     bool needPrepareParams() const override { return false; }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
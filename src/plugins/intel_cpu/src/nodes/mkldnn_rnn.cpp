@@ -11,9 +11,14 @@
 #include <mkldnn_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <transformations/utils/utils.hpp>
+#include "ie_parallel.hpp"
 
 #include <ngraph/node.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <string>
 #include <utility>
 
@@ -117,6 +122,8 @@ struct RNNKey {
     const std::vector<DnnlBlockedMemoryDescPtr> outDataDescs;
     const std::vector<mkldnn::memory::desc> wDescs;
     mkldnn::algorithm cellType;
+    mkldnn::algorithm cellAct;
+    mkldnn::rnn_direction direction;
 
     size_t hash() const;
     bool operator==(const RNNKey& rhs) const;
@@ -140,12 +147,14 @@ size_t RNNKey::hash() const {
         seed = hash_combine(seed, get_md_hash(desc.data));
     }
     seed = hash_combine(seed, cellType);
+    seed = hash_combine(seed, cellAct);
+    seed = hash_combine(seed, direction);
     return seed;
 }
 
 bool RNNKey::operator==(const RNNKey& rhs) const {
     if (inDataDescs.size() != rhs.inDataDescs.size() || outDataDescs.size() != rhs.outDataDescs.size() || wDescs.size() != rhs.wDescs.size() ||
-            cellType != rhs.cellType)
+            cellType != rhs.cellType || cellAct != rhs.cellAct || direction != rhs.direction)
         return false;
 
     for (size_t i = 0lu; i < inDataDescs.size(); i++) {
@@ -154,8 +163,8 @@ bool RNNKey::operator==(const RNNKey& rhs) const {
             return false;
     }
     for (size_t i = 0lu; i < outDataDescs.size(); i++) {
-        if (outDataDescs[i] != rhs.outDataDescs[i] && (outDataDescs[i] == nullptr || rhs.outDataDescs[i] ||
-                outDataDescs[i]->getDnnlDesc() == rhs.outDataDescs[i]->getDnnlDesc()))
+        if (outDataDescs[i] != rhs.outDataDescs[i] && (outDataDescs[i] == nullptr || rhs.outDataDescs[i] == nullptr ||
+                outDataDescs[i]->getDnnlDesc() != rhs.outDataDescs[i]->getDnnlDesc()))
             return false;
     }
     for (size_t i = 0lu; i < wDescs.size(); i++) {
@@ -308,6 +317,12 @@ MKLDNNRNN::MKLDNNRNN(const std::shared_ptr<ov::Node>& op, const mkldnn::engine&
         }
 
         initSequence();
+
+        // the sequences shorter than the max length are executed by the segments of the fixed active batch, their
+        // primitives share the weights, so the weights format mustn't depend on the primitive shapes
+        variableLengths = ngraph::op::util::is_seq_len_provided(op->get_input_node_shared_ptr(S + 1), T.maxVal);
+        if (variableLengths)
+            wFormat = mkldnn::memory::format_tag::ldigo;
     }
 }
 
@@ -679,70 +694,93 @@ void MKLDNNRNN::copyWeightsData() {
         fillBiases<Precision::FP32>(gate_map);
 }
 
-void MKLDNNRNN::fillDescs() {
-    descs.clear();
-
-    switch (cell_type) {
+// the descriptors of the layer data, the hidden state and the cell state are at the indices 0, 1 and 2 of the key
+static MKLDNNDescriptor createRnnDescriptor(const RNNKey& key) {
+    switch (key.cellType) {
         case mkldnn::algorithm::vanilla_rnn: {
             MKLDNNDescriptor desc(std::make_shared<vanilla_rnn_forward::desc>(
                                         prop_kind::forward_scoring,
-                                        cell_act,
-                                        direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                                        key.cellAct,
+                                        key.direction,
+                    /* In Data       */ key.inDataDescs[0]->getDnnlDesc(),
+                    /* In State      */ key.inDataDescs[1]->getDnnlDesc(),
+                    /* Weights data  */ key.wDescs[0],
+                    /* Weights state */ key.wDescs[1],
+                    /* Bias          */ key.wDescs[2],
+                    /* Out Data      */ key.outDataDescs[0]->getDnnlDesc(),
+                    /* Out State     */ key.outDataDescs[1]->getDnnlDesc()));
+            return desc;
+        }
         case mkldnn::algorithm::vanilla_gru: {
             MKLDNNDescriptor desc(std::make_shared<gru_forward::desc>(
                                         prop_kind::forward_scoring,
-                                        direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                                        key.direction,
+                    /* In Data       */ key.inDataDescs[0]->getDnnlDesc(),
+                    /* In State      */ key.inDataDescs[1]->getDnnlDesc(),
+                    /* Weights data  */ key.wDescs[0],
+                    /* Weights state */ key.wDescs[1],
+                    /* Bias          */ key.wDescs[2],
+                    /* Out Data      */ key.outDataDescs[0]->getDnnlDesc(),
+                    /* Out State     */ key.outDataDescs[1]->getDnnlDesc()));
+            return desc;
+        }
         case mkldnn::algorithm::lbr_gru: {
             MKLDNNDescriptor desc(std::make_shared<lbr_gru_forward::desc>(
                                         prop_kind::forward_scoring,
-                                        direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                                        key.direction,
+                    /* In Data       */ key.inDataDescs[0]->getDnnlDesc(),
+                    /* In State      */ key.inDataDescs[1]->getDnnlDesc(),
+                    /* Weights data  */ key.wDescs[0],
+                    /* Weights state */ key.wDescs[1],
+                    /* Bias          */ key.wDescs[2],
+                    /* Out Data      */ key.outDataDescs[0]->getDnnlDesc(),
+                    /* Out State     */ key.outDataDescs[1]->getDnnlDesc()));
+            return desc;
+        }
         case mkldnn::algorithm::vanilla_lstm: {
             MKLDNNDescriptor desc(std::make_shared<lstm_forward::desc>(
                                         prop_kind::forward_scoring,
-                                        direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* In State C    */ inDataDescs[RNNInOutKind::CellState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Out State C   */ outDataDescs[RNNInOutKind::CellState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                                        key.direction,
+                    /* In Data       */ key.inDataDescs[0]->getDnnlDesc(),
+                    /* In State      */ key.inDataDescs[1]->getDnnlDesc(),
+                    /* In State C    */ key.inDataDescs[2]->getDnnlDesc(),
+                    /* Weights data  */ key.wDescs[0],
+                    /* Weights state */ key.wDescs[1],
+                    /* Bias          */ key.wDescs[2],
+                    /* Out Data      */ key.outDataDescs[0]->getDnnlDesc(),
+                    /* Out State     */ key.outDataDescs[1]->getDnnlDesc(),
+                    /* Out State C   */ key.outDataDescs[2]->getDnnlDesc()));
+            return desc;
+        }
         default:
-            THROW_ERROR << "has unknown cell type.";
+            IE_THROW() << "Unknown RNN cell type";
     }
 }
 
+static std::shared_ptr<mkldnn::primitive> createRnnPrimitive(const RNNKey& key, const mkldnn::engine& engine) {
+    auto desc = createRnnDescriptor(key);
+    if (key.cellType == mkldnn::algorithm::vanilla_rnn) {
+        std::shared_ptr<vanilla_rnn_forward::desc> rnnDesc = desc;
+        return std::make_shared<vanilla_rnn_forward>(vanilla_rnn_forward::primitive_desc(*rnnDesc, engine));
+    } else if (key.cellType == mkldnn::algorithm::vanilla_gru) {
+        std::shared_ptr<gru_forward::desc> rnnDesc = desc;
+        return std::make_shared<gru_forward>(gru_forward::primitive_desc(*rnnDesc, engine));
+    } else if (key.cellType == mkldnn::algorithm::lbr_gru) {
+        std::shared_ptr<lbr_gru_forward::desc> rnnDesc = desc;
+        return std::make_shared<lbr_gru_forward>(lbr_gru_forward::primitive_desc(*rnnDesc, engine));
+    } else if (key.cellType == mkldnn::algorithm::vanilla_lstm) {
+        std::shared_ptr<lstm_forward::desc> rnnDesc = desc;
+        return std::make_shared<lstm_forward>(lstm_forward::primitive_desc(*rnnDesc, engine));
+    } else {
+        return nullptr;
+    }
+}
+
+void MKLDNNRNN::fillDescs() {
+    descs.clear();
+    descs.push_back(createRnnDescriptor(RNNKey{inDataDescs, outDataDescs, wDescs, cell_type, cell_act, direction}));
+}
+
 void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                  const std::vector<MemoryDescPtr> &outputDesc) {
     if (descs.empty()) {
@@ -810,7 +848,7 @@ void MKLDNNRNN::prepareParams() {
     bool wFormatWasChanged = false;
     // WA To avoid different weights layer and iter formats in FP32 case.
     if (dataPrecision == Precision::FP32) {
-        if (SL != 1 || B < optimalBatchSize) {
+        if (variableLengths || SL != 1 || B < optimalBatchSize) {
             if (wFormat != mkldnn::memory::format_tag::ldigo) {
                 wFormat = mkldnn::memory::format_tag::ldigo;
                 wFormatWasChanged = true;
@@ -827,26 +865,11 @@ void MKLDNNRNN::prepareParams() {
         wDescs[1] = mkldnn::memory::desc(statesDims, dataType, wFormat);
     }
 
-    RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type };
+    RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type, cell_act, direction };
 
     auto builder = [this](const RNNKey& key) -> std::shared_ptr<mkldnn::primitive> {
         fillDescs();
-
-        if (key.cellType == mkldnn::algorithm::vanilla_rnn) {
-            std::shared_ptr<vanilla_rnn_forward::desc> desc = descs[0];
-            return std::make_shared<vanilla_rnn_forward>(vanilla_rnn_forward::primitive_desc(*desc, getEngine()));
-        } else if (key.cellType == mkldnn::algorithm::vanilla_gru) {
-            std::shared_ptr<gru_forward::desc> desc = descs[0];
-            return std::make_shared<gru_forward>(gru_forward::primitive_desc(*desc, getEngine()));
-        } else if (key.cellType == mkldnn::algorithm::lbr_gru) {
-            std::shared_ptr<lbr_gru_forward::desc> desc = descs[0];
-            return std::make_shared<lbr_gru_forward>(lbr_gru_forward::primitive_desc(*desc, getEngine()));
-        } else if (key.cellType == mkldnn::algorithm::vanilla_lstm) {
-            std::shared_ptr<lstm_forward::desc> desc = descs[0];
-            return std::make_shared<lstm_forward>(lstm_forward::primitive_desc(*desc, getEngine()));
-        } else {
-            return nullptr;
-        }
+        return createRnnPrimitive(key, getEngine());
     };
 
     auto cache = getRuntimeCache();
@@ -877,6 +900,9 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     if (!prim)
         THROW_ERROR << "does not have initialized primitive to execute.";
 
+    if (variableLengths && executeBySegments(strm))
+        return;
+
     const auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     const auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
@@ -914,6 +940,129 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     (*prim).execute(strm, args);
 }
 
+bool MKLDNNRNN::executeBySegments(mkldnn::stream strm) {
+    const auto& srcMem = getParentEdgeAt(0)->getMemory();
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t B = srcDims[0];
+    const size_t SL = srcDims[1];
+    const auto* seqLengths = reinterpret_cast<const int32_t*>(getParentEdgeAt(S + 1)->getMemoryPtr()->GetPtr());
+
+    // the sequences are sorted by the descending length, so the sequences active at a timestep are the first ones
+    std::vector<size_t> lengths(B);
+    for (size_t b = 0; b < B; b++)
+        lengths[b] = static_cast<size_t>(std::min(std::max(seqLengths[b], 0), static_cast<int32_t>(SL)));
+    if (std::all_of(lengths.begin(), lengths.end(), [SL](size_t length) { return length == SL; }))
+        return false;
+    std::vector<size_t> order(B);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return lengths[lhs] > lengths[rhs];
+    });
+
+    const auto& dataPrecision = getOriginalInputPrecisionAtPort(0);
+    const auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(dataPrecision);
+    const size_t dataSize = dataPrecision.size();
+    const size_t srcRowSize = DC * dataSize;
+    const size_t dstRowSize = SC * dataSize;
+    const size_t cellRowSize = SC * sizeof(float);
+    const bool reverse = direction == rnn_direction::unidirectional_right2left;
+
+    // the data is [SL, B, C] in memory, the states are [B, SC], the states of the sequences are kept in the sorted order
+    const auto* src = reinterpret_cast<const uint8_t*>(srcMem.GetPtr());
+    auto* dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    std::vector<uint8_t> states[2][2];
+    const size_t stateRowSizes[2] = {dstRowSize, cellRowSize};
+    for (size_t s = 0; s < S; s++) {
+        const auto* initState = reinterpret_cast<const uint8_t*>(getParentEdgeAt(s + 1)->getMemoryPtr()->GetPtr());
+        states[s][0].resize(B * stateRowSizes[s]);
+        states[s][1].resize(B * stateRowSizes[s]);
+        for (size_t j = 0; j < B; j++)
+            cpu_memcpy(&states[s][0][j * stateRowSizes[s]], initState + order[j] * stateRowSizes[s], stateRowSizes[s]);
+    }
+    std::vector<uint8_t> segmentSrc(SL * B * srcRowSize);
+    std::vector<uint8_t> segmentDst(SL * B * dstRowSize);
+
+    const auto& wghDataMem = internalBlobMemory[0];
+    const auto& wghStatMem = internalBlobMemory[1];
+    const auto& wghBiasMem = internalBlobMemory[2];
+    const int stateInTags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
+    const int stateOutTags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+    const memory::data_type stateTypes[] {dataType, memory::data_type::f32};
+
+    size_t active = B;
+    while (active > 0 && lengths[order[active - 1]] == 0)
+        active--;
+    // the step is the timestep for the forward direction, the step k of the reverse sequence is its timestep length - 1 - k
+    size_t stepBegin = 0;
+    while (active > 0) {
+        const size_t stepEnd = lengths[order[active - 1]];
+        const size_t steps = stepEnd - stepBegin;
+        auto timestep = [&](size_t j, size_t step) {
+            return reverse ? lengths[order[j]] - 1 - step : step;
+        };
+
+        parallel_for2d(steps, active, [&](size_t k, size_t j) {
+            const size_t t = timestep(j, stepBegin + k);
+            cpu_memcpy(&segmentSrc[(k * active + j) * srcRowSize], src + (t * B + order[j]) * srcRowSize, srcRowSize);
+        });
+
+        const Shape stateShape{L, D, active, SC};
+        std::vector<DnnlBlockedMemoryDescPtr> inDescs{
+            std::make_shared<DnnlBlockedMemoryDesc>(Shape{steps, active, DC}, dataType, memory::format_tag::tnc)};
+        std::vector<DnnlBlockedMemoryDescPtr> outDescs{
+            std::make_shared<DnnlBlockedMemoryDesc>(Shape{steps, active, SC}, dataType, memory::format_tag::tnc)};
+        for (size_t s = 0; s < S; s++) {
+            inDescs.push_back(std::make_shared<DnnlBlockedMemoryDesc>(stateShape, stateTypes[s], memory::format_tag::ldnc));
+            outDescs.push_back(std::make_shared<DnnlBlockedMemoryDesc>(stateShape, stateTypes[s], memory::format_tag::ldnc));
+        }
+        // the gathered steps are executed in the forward direction regardless of the sequence direction
+        RNNKey key = { inDescs, outDescs, wDescs, cell_type, cell_act, rnn_direction::unidirectional_left2right };
+        auto result = getRuntimeCache()->getOrCreate(key, [this](const RNNKey& key) {
+            return createRnnPrimitive(key, getEngine());
+        });
+        if (!result.first)
+            THROW_ERROR << "does not have the primitive for the sequences segment.";
+
+        std::unordered_map<int, memory> args {
+            {DNNL_ARG_SRC_LAYER,     memory(inDescs[0]->getDnnlDesc(), getEngine(), segmentSrc.data())},
+            {DNNL_ARG_WEIGHTS_LAYER, wghDataMem->GetPrimitive()},
+            {DNNL_ARG_WEIGHTS_ITER,  wghStatMem->GetPrimitive()},
+            {DNNL_ARG_BIAS,          wghBiasMem->GetPrimitive()},
+            {DNNL_ARG_DST_LAYER,     memory(outDescs[0]->getDnnlDesc(), getEngine(), segmentDst.data())},
+        };
+        for (size_t s = 0; s < S; s++) {
+            args[stateInTags[s]] = memory(inDescs[s + 1]->getDnnlDesc(), getEngine(), states[s][0].data());
+            args[stateOutTags[s]] = memory(outDescs[s + 1]->getDnnlDesc(), getEngine(), states[s][1].data());
+        }
+        result.first->execute(strm, args);
+
+        parallel_for2d(steps, active, [&](size_t k, size_t j) {
+            const size_t t = timestep(j, stepBegin + k);
+            cpu_memcpy(dst + (t * B + order[j]) * dstRowSize, &segmentDst[(k * active + j) * dstRowSize], dstRowSize);
+        });
+        for (size_t s = 0; s < S; s++)
+            cpu_memcpy(states[s][0].data(), states[s][1].data(), active * stateRowSizes[s]);
+
+        stepBegin = stepEnd;
+        while (active > 0 && lengths[order[active - 1]] <= stepBegin)
+            active--;
+    }
+
+    // the timesteps after the end of the sequence are zeros
+    parallel_for2d(SL, B, [&](size_t t, size_t b) {
+        if (t >= lengths[b])
+            std::memset(dst + (t * B + b) * dstRowSize, 0, dstRowSize);
+    });
+    // the final states of the sequences are the ones of their last timesteps
+    const size_t outStates = std::min(S, outputShapes.size() - 1);
+    for (size_t s = 0; s < outStates; s++) {
+        auto* lastState = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(s + 1)[0]->getMemoryPtr()->GetPtr());
+        for (size_t j = 0; j < B; j++)
+            cpu_memcpy(lastState + order[j] * stateRowSizes[s], &states[s][0][j * stateRowSizes[s]], stateRowSizes[s]);
+    }
+    return true;
+}
+
 void MKLDNNRNN::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
@@ -54,12 +54,22 @@ private:
 
     void copyWeightsData();
 
+    /**
+     * @brief Executes the sequences of the different lengths by the segments of the timesteps the same sequences are
+     *        active at, the padded timesteps aren't computed
+     * @return false if all the sequences have the max length, so the sequence primitive is executed as is
+     */
+    bool executeBySegments(mkldnn::stream strm);
+
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
 
     /** Native order if [batch, seq, data], other case is [seq, batch, data] */
     bool nativeOrder = true;
 
+    /** The sequence lengths may be less than the max length, so the padded timesteps are skipped */
+    bool variableLengths = false;
+
     /** Direction of iteration through sequence dimension */
     mkldnn::rnn_direction direction = mkldnn::rnn_direction::unidirectional;
 
@@ -0,0 +1,388 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_scaled_dot_product_attention_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+#include <mkldnn.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_args_attention_exp, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_attention_exp_kernel_f32 : public jit_uni_attention_exp_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_attention_exp_kernel_f32)
+
+    jit_uni_attention_exp_kernel_f32() : jit_uni_attention_exp_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    // scores = exp(scores - max), sum = the per lane sums of the exponents, work_amount is the multiple of the vector
+    void generate() override {
+        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.f));
+
+        this->preamble();
+
+        mov(reg_scores, ptr[reg_params + GET_OFF(scores)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_aux, ptr[reg_params + GET_OFF(max)]);
+        uni_vbroadcastss(vmm_max, ptr[reg_aux]);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+        Xbyak::Label exp_loop_label;
+        Xbyak::Label exp_loop_end_label;
+        L(exp_loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(exp_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_scores]);
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            uni_vmovups(ptr[reg_scores], vmm_val);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+
+            add(reg_scores, vlen);
+            sub(reg_work_amount, vlen / sizeof(float));
+
+            jmp(exp_loop_label, T_NEAR);
+        }
+        L(exp_loop_end_label);
+
+        mov(reg_aux, ptr[reg_params + GET_OFF(sum)]);
+        uni_vmovups(ptr[reg_aux], vmm_sum);
+
+        this->postamble();
+
+        exp_injector->prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_scores = r8;
+    Xbyak::Reg64 reg_work_amount = r9;
+    Xbyak::Reg64 reg_aux = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_max = Vmm(2);
+    Vmm vmm_sum = Vmm(3);
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+};
+
+namespace {
+// the row-major C = alpha * op(A) * op(B) + beta * C
+void gemm(char transA, char transB, size_t M, size_t N, size_t K, float alpha, const float* A, size_t lda,
+          const float* B, size_t ldb, float beta, float* C, size_t ldc) {
+    const auto status = mkldnn::sgemm(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    if (status != mkldnn::status::success)
+        IE_THROW() << "ScaledDotProductAttention node failed to compute the product of the blocks";
+}
+}  // namespace
+
+constexpr size_t MKLDNNScaledDotProductAttentionNode::QUERY_BLOCK;
+constexpr size_t MKLDNNScaledDotProductAttentionNode::KEY_BLOCK;
+constexpr size_t MKLDNNScaledDotProductAttentionNode::MAX_EXP_BLOCK;
+
+bool MKLDNNScaledDotProductAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto attention = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+        if (!attention) {
+            errorMessage = "Only ScaledDotProductAttention operation from the CPU plugin opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                                         MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention node with name '" + getName() + "'";
+    const auto attention = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+
+    if ((inputShapes.size() != 3 && inputShapes.size() != 4) || outputShapes.size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    scale = attention->get_scale();
+    keyTransposed = attention->get_key_transposed();
+    withMask = inputShapes.size() == 4;
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type implType = impl_desc_type::ref_any;
+    if (mayiuse(x64::avx512_common)) {
+        implType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(x64::avx2)) {
+        implType = impl_desc_type::jit_avx2;
+    } else if (mayiuse(x64::sse41)) {
+        implType = impl_desc_type::jit_sse42;
+    }
+
+    std::vector<PortConfigurator> inConfs(inputShapes.size(), {LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         implType);
+}
+
+void MKLDNNScaledDotProductAttentionNode::createPrimitive() {
+    expBlock = 1;
+    if (mayiuse(x64::avx512_common)) {
+        expKernel.reset(new jit_uni_attention_exp_kernel_f32<x64::avx512_common>());
+        expBlock = 16;
+    } else if (mayiuse(x64::avx2)) {
+        expKernel.reset(new jit_uni_attention_exp_kernel_f32<x64::avx2>());
+        expBlock = 8;
+    } else if (mayiuse(x64::sse41)) {
+        expKernel.reset(new jit_uni_attention_exp_kernel_f32<x64::sse41>());
+        expBlock = 4;
+    }
+
+    if (expKernel)
+        expKernel->create_ker();
+
+    MKLDNNNode::createPrimitive();
+}
+
+namespace {
+// the strides of the dims aligned to the target dims from the right, 0 where the dims are broadcast
+VectorDims getBroadcastStrides(const VectorDims& dims, const VectorDims& targetDims) {
+    VectorDims strides(targetDims.size(), 0);
+    size_t stride = 1;
+    for (size_t i = 0; i < dims.size(); i++) {
+        const size_t idx = dims.size() - 1 - i;
+        const size_t targetIdx = targetDims.size() - 1 - i;
+        if (dims[idx] != targetDims[targetIdx] && dims[idx] != 1)
+            IE_THROW() << "Dims " << vec2str(dims) << " aren't broadcastable to " << vec2str(targetDims);
+        strides[targetIdx] = dims[idx] == 1 ? 0 : stride;
+        stride *= dims[idx];
+    }
+    return strides;
+}
+
+// the offsets of the matrices (the last two dims) of the input for each batch of the target dims
+std::vector<size_t> getBatchOffsets(const VectorDims& strides, const VectorDims& targetDims) {
+    const size_t batchRank = targetDims.size() - 2;
+    const size_t batchSize = std::accumulate(targetDims.begin(), targetDims.begin() + batchRank, size_t(1), std::multiplies<size_t>());
+    std::vector<size_t> offsets(batchSize, 0);
+    for (size_t b = 0; b < batchSize; b++) {
+        size_t idx = b;
+        for (size_t i = batchRank; i > 0; i--) {
+            offsets[b] += (idx % targetDims[i - 1]) * strides[i - 1];
+            idx /= targetDims[i - 1];
+        }
+    }
+    return offsets;
+}
+}  // namespace
+
+void MKLDNNScaledDotProductAttentionNode::prepareParams() {
+    const auto& queryDims = getParentEdgesAtPort(Q_ID)[0]->getMemory().getStaticDims();
+    const auto& keyDims = getParentEdgesAtPort(K_ID)[0]->getMemory().getStaticDims();
+    const auto& valueDims = getParentEdgesAtPort(V_ID)[0]->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const size_t rank = dstDims.size();
+
+    if (queryDims.size() != rank || keyDims.size() != rank || valueDims.size() != rank)
+        IE_THROW() << errorPrefix << " has inputs of different ranks";
+
+    // the batch dimensions of the inputs and the mask are broadcast to the ones of the output, which shape inference
+    // merged by the numpy rules, so the runtime shapes broadcast as the fused MatMul and Add operations do
+    VectorDims batchDims(dstDims.begin(), dstDims.end() - 2);
+    batchSize = std::accumulate(batchDims.begin(), batchDims.end(), size_t(1), std::multiplies<size_t>());
+    queryLength = dstDims[rank - 2];
+    headSize = queryDims[rank - 1];
+    keyLength = keyTransposed ? keyDims[rank - 2] : keyDims[rank - 1];
+    valueHeadSize = valueDims[rank - 1];
+    if ((keyTransposed ? keyDims[rank - 1] : keyDims[rank - 2]) != headSize || valueDims[rank - 2] != keyLength ||
+        dstDims[rank - 1] != valueHeadSize)
+        IE_THROW() << errorPrefix << " has inconsistent shapes of the query, key and value";
+
+    auto withMatrix = [&](size_t rows, size_t cols) {
+        VectorDims dims(batchDims);
+        dims.push_back(rows);
+        dims.push_back(cols);
+        return dims;
+    };
+    const auto queryTargetDims = withMatrix(queryLength, headSize);
+    const auto queryStrides = getBroadcastStrides(queryDims, queryTargetDims);
+    queryBatchOffsets = getBatchOffsets(queryStrides, queryTargetDims);
+    // the single query row is broadcast to all the rows of the mask
+    queryRowStride = queryStrides[rank - 2];
+
+    const auto keyTargetDims = withMatrix(keyDims[rank - 2], keyDims[rank - 1]);
+    keyBatchOffsets = getBatchOffsets(getBroadcastStrides(keyDims, keyTargetDims), keyTargetDims);
+    const auto valueTargetDims = withMatrix(keyLength, valueHeadSize);
+    valueBatchOffsets = getBatchOffsets(getBroadcastStrides(valueDims, valueTargetDims), valueTargetDims);
+
+    maskBatchOffsets.assign(batchSize, 0);
+    maskQueryStride = 0;
+    maskKeyStride = 0;
+    if (withMask) {
+        // the mask dims are aligned to the scores dims [..., Lq, Lk] from the right and broadcast where they are 1
+        const auto& maskDims = getParentEdgesAtPort(MASK_ID)[0]->getMemory().getStaticDims();
+        if (maskDims.size() > rank)
+            IE_THROW() << errorPrefix << " has the mask of the rank greater than the rank of the scores";
+
+        const auto scoresDims = withMatrix(queryLength, keyLength);
+        const auto strides = getBroadcastStrides(maskDims, scoresDims);
+        maskQueryStride = strides[rank - 2];
+        maskKeyStride = strides[rank - 1];
+        maskBatchOffsets = getBatchOffsets(strides, scoresDims);
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
+float MKLDNNScaledDotProductAttentionNode::expRow(float* scores, size_t cols, float max, float* laneSums) const {
+    if (expKernel) {
+        // the padding of the row up to the vector is -inf, so its exponents are zeros
+        const size_t paddedCols = rnd_up(cols, expBlock);
+        std::fill(scores + cols, scores + paddedCols, -std::numeric_limits<float>::infinity());
+
+        jit_args_attention_exp args;
+        args.scores = scores;
+        args.max = &max;
+        args.sum = laneSums;
+        args.work_amount = paddedCols;
+        (*expKernel)(&args);
+        return std::accumulate(laneSums, laneSums + expBlock, 0.f);
+    }
+
+    float sum = 0.f;
+    for (size_t j = 0; j < cols; j++) {
+        scores[j] = std::exp(scores[j] - max);
+        sum += scores[j];
+    }
+    return sum;
+}
+
+void MKLDNNScaledDotProductAttentionNode::executeBlock(const float* query, const float* key, const float* value, const float* mask, float* dst,
+                                                       size_t batch, size_t queryBegin, float* scratch) const {
+    const size_t rows = std::min(QUERY_BLOCK, queryLength - queryBegin);
+    float* scores = scratch;
+    float* acc = scores + QUERY_BLOCK * KEY_BLOCK;
+    float* rowMax = acc + QUERY_BLOCK * valueHeadSize;
+    float* rowSum = rowMax + QUERY_BLOCK;
+    float* laneSums = rowSum + QUERY_BLOCK;
+    float* queryRows = laneSums + MAX_EXP_BLOCK;
+
+    const float* q = query + queryBatchOffsets[batch] + queryBegin * queryRowStride;
+    const float* k = key + keyBatchOffsets[batch];
+    const float* v = value + valueBatchOffsets[batch];
+    const float* m = withMask ? mask + maskBatchOffsets[batch] + queryBegin * maskQueryStride : nullptr;
+
+    // the single query row broadcast to the rows of the mask is repeated for the product
+    if (queryRowStride != headSize) {
+        for (size_t r = 0; r < rows; r++)
+            std::copy(q + r * queryRowStride, q + r * queryRowStride + headSize, queryRows + r * headSize);
+        q = queryRows;
+    }
+
+    std::fill(acc, acc + rows * valueHeadSize, 0.f);
+    std::fill(rowMax, rowMax + rows, -std::numeric_limits<float>::infinity());
+    std::fill(rowSum, rowSum + rows, 0.f);
+
+    for (size_t keyBegin = 0; keyBegin < keyLength; keyBegin += KEY_BLOCK) {
+        const size_t cols = std::min(KEY_BLOCK, keyLength - keyBegin);
+        if (keyTransposed)
+            gemm('N', 'T', rows, cols, headSize, scale, q, headSize, k + keyBegin * headSize, headSize, 0.f, scores, KEY_BLOCK);
+        else
+            gemm('N', 'N', rows, cols, headSize, scale, q, headSize, k + keyBegin, keyLength, 0.f, scores, KEY_BLOCK);
+
+        for (size_t r = 0; r < rows; r++) {
+            float* s = scores + r * KEY_BLOCK;
+            const float* mRow = m ? m + r * maskQueryStride + keyBegin * maskKeyStride : nullptr;
+            if (mRow) {
+                for (size_t j = 0; j < cols; j++)
+                    s[j] += mRow[j * maskKeyStride];
+            }
+            const float blockMax = *std::max_element(s, s + cols);
+
+            // the row is fully masked so far, so the block adds nothing to the output
+            const float newMax = std::max(rowMax[r], blockMax);
+            if (newMax == -std::numeric_limits<float>::infinity()) {
+                std::fill(s, s + cols, 0.f);
+                continue;
+            }
+
+            const float correction = std::exp(rowMax[r] - newMax);
+            if (correction != 1.f) {
+                float* a = acc + r * valueHeadSize;
+                for (size_t x = 0; x < valueHeadSize; x++)
+                    a[x] *= correction;
+            }
+            rowSum[r] = rowSum[r] * correction + expRow(s, cols, newMax, laneSums);
+            rowMax[r] = newMax;
+        }
+
+        gemm('N', 'N', rows, valueHeadSize, cols, 1.f, scores, KEY_BLOCK, v + keyBegin * valueHeadSize, valueHeadSize,
+             1.f, acc, valueHeadSize);
+    }
+
+    float* out = dst + (batch * queryLength + queryBegin) * valueHeadSize;
+    for (size_t r = 0; r < rows; r++) {
+        const float norm = rowSum[r] > 0.f ? 1.f / rowSum[r] : 0.f;
+        for (size_t x = 0; x < valueHeadSize; x++)
+            out[r * valueHeadSize + x] = acc[r * valueHeadSize + x] * norm;
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    const auto* query = reinterpret_cast<const float*>(getParentEdgeAt(Q_ID)->getMemoryPtr()->GetPtr());
+    const auto* key = reinterpret_cast<const float*>(getParentEdgeAt(K_ID)->getMemoryPtr()->GetPtr());
+    const auto* value = reinterpret_cast<const float*>(getParentEdgeAt(V_ID)->getMemoryPtr()->GetPtr());
+    const auto* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    const size_t scratchPerThread = QUERY_BLOCK * KEY_BLOCK + QUERY_BLOCK * valueHeadSize + 2 * QUERY_BLOCK + MAX_EXP_BLOCK +
+                                    QUERY_BLOCK * headSize;
+    const int threadsNum = parallel_get_max_threads();
+    if (scratchpad.size() < threadsNum * scratchPerThread)
+        scratchpad.resize(threadsNum * scratchPerThread);
+
+    const size_t queryBlocks = div_up(queryLength, QUERY_BLOCK);
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        float* scratch = scratchpad.data() + ithr * scratchPerThread;
+        for_2d(ithr, nthr, batchSize, queryBlocks, [&](size_t b, size_t qb) {
+            executeBlock(query, key, value, mask, dst, b, qb * QUERY_BLOCK, scratch);
+        });
+    });
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention)
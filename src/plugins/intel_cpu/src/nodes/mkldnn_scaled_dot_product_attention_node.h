@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_args_attention_exp {
+    float* scores;
+    const float* max;
+    // the per lane sums of the exponents
+    float* sum;
+    size_t work_amount;
+};
+
+struct jit_uni_attention_exp_kernel {
+    void (*ker_)(const jit_args_attention_exp *);
+
+    void operator()(const jit_args_attention_exp *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_attention_exp_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_attention_exp_kernel() {}
+};
+
+/**
+ * @brief Computes the attention tile by tile with the online softmax: each block of the queries iterates over the blocks of
+ *        the keys, keeps the running maximum and sum of the exponents and rescales the accumulated output when the maximum
+ *        grows. So only a block of the scores per thread is kept instead of the whole [..., Lq, Lk] scores tensor.
+ *        The products of the blocks are computed by the oneDNN sgemm, the exponents of the scores by the JIT kernel.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    static constexpr size_t QUERY_BLOCK = 32;
+    // the rows of the scores are padded to the vector length of the exponent kernel, so it's the multiple of 16
+    static constexpr size_t KEY_BLOCK = 128;
+    static constexpr size_t MAX_EXP_BLOCK = 16;
+
+private:
+    void executeBlock(const float* query, const float* key, const float* value, const float* mask, float* dst,
+                      size_t batch, size_t queryBegin, float* scratch) const;
+    // replaces the scores of the row with exp(score - max) and returns their sum
+    float expRow(float* scores, size_t cols, float max, float* laneSums) const;
+
+    static constexpr size_t Q_ID = 0;
+    static constexpr size_t K_ID = 1;
+    static constexpr size_t V_ID = 2;
+    static constexpr size_t MASK_ID = 3;
+
+    float scale = 1.f;
+    bool keyTransposed = true;
+    bool withMask = false;
+
+    size_t batchSize = 0;
+    size_t queryLength = 0;
+    size_t keyLength = 0;
+    size_t headSize = 0;
+    size_t valueHeadSize = 0;
+
+    // the offsets of the batches of the inputs broadcast to the output batch dimensions
+    std::vector<size_t> queryBatchOffsets;
+    std::vector<size_t> keyBatchOffsets;
+    std::vector<size_t> valueBatchOffsets;
+    // the stride of the query rows, 0 if the single row is broadcast
+    size_t queryRowStride = 0;
+
+    // the offsets of the batches in the mask and the strides of the query and key dimensions, 0 if broadcast
+    std::vector<size_t> maskBatchOffsets;
+    size_t maskQueryStride = 0;
+    size_t maskKeyStride = 0;
+
+    std::vector<float> scratchpad;
+
+    std::shared_ptr<jit_uni_attention_exp_kernel> expKernel;
+    size_t expBlock = 1;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
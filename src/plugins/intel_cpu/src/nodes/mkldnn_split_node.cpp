@@ -155,13 +155,10 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
         }
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
 
-        if (itr->first == LayoutType::ncsp) {
-            // at least the plain layout can be optimized inplace.
+        // the plain and the channel blocked layouts can be optimized inplace, since their blocked dims up to the axis match the logical ones.
+        // The outputs are the strided views of the input, so e.g. a split over H in nChw16c doesn't copy the data as well
+        if (one_of(itr->first, LayoutType::ncsp, LayoutType::nCsp8c, LayoutType::nCsp16c)) {
             pdIndexesToReuse.emplace_back(supportedPrimitiveDescriptors.size() - 1);
-        } else if (itr->first == LayoutType::nCsp8c || itr->first == LayoutType::nCsp16c) {
-            if (axis < 2) {
-                pdIndexesToReuse.emplace_back(supportedPrimitiveDescriptors.size() - 1);
-            }
         }
     }
 
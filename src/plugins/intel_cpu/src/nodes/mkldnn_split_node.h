@@ -30,6 +30,7 @@ public:
     bool needPrepareParams() const override;
     void prepareParams() override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(1, 2); }
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
 
 private:
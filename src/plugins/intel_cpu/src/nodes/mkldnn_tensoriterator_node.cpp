@@ -4,6 +4,8 @@
 
 #include "mkldnn_tensoriterator_node.h"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -70,6 +72,12 @@ static std::vector<MKLDNNMemoryPtr> getToMemories(const MKLDNNNode* node, const
     return memories;
 }
 
+// whether the plain memories of the same precision may be copied directly, without the reorder primitive
+static bool isPlainCopyable(const MKLDNNMemoryPtr& src, const MKLDNNMemoryPtr& dst) {
+    return src->getDesc().hasLayoutType(LayoutType::ncsp) && dst->getDesc().hasLayoutType(LayoutType::ncsp) &&
+           src->getDesc().getPrecision() == dst->getDesc().getPrecision();
+}
+
 static void nullifyUndefinedDims(VectorDims& dims) {
     std::transform(dims.begin(), dims.end(), dims.begin(), [](const size_t& dim) {
         return dim == Shape::UNDEFINED_DIM ? 0 : dim;
@@ -121,11 +129,32 @@ public:
             mem_holder_dst = chunk_mem;
         }
         reorder = {mem_holder_src, mem_holder_dst};
+
+        use_copy = isPlainCopyable(from, to);
+        if (use_copy) {
+            full = full_blob;
+            part = part_blob;
+            copy_count = std::accumulate(part_dims.begin(), part_dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+            copy_len = part_blob->GetSize() / copy_count;
+            full_outer_stride_in_byte = full_blob->GetSize() / copy_count;
+        }
     }
 
     void execute(mkldnn::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        if (use_copy) {
+            auto full_ptr = static_cast<uint8_t *>(full->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+            auto part_ptr = static_cast<uint8_t *>(part->GetPtr());
+            for (size_t i = 0; i < copy_count; i++) {
+                if (sliced_src)
+                    cpu_memcpy(part_ptr + i * copy_len, full_ptr + i * full_outer_stride_in_byte, copy_len);
+                else
+                    cpu_memcpy(full_ptr + i * full_outer_stride_in_byte, part_ptr + i * copy_len, copy_len);
+            }
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
         chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
                                           chunk_offset_in_byte + chunk_stride_in_byte * iter);
@@ -141,6 +170,86 @@ private:
     mkldnn::memory full_mem;
 
     int iter_count;
+
+    bool use_copy = false;
+    MKLDNNMemoryPtr full;
+    MKLDNNMemoryPtr part;
+    size_t copy_count = 1;
+    size_t copy_len = 0;
+    size_t full_outer_stride_in_byte = 0;
+};
+
+/**
+ * Points the body input memories to the chunk of the sliced input instead of copying the chunk.
+ * Is applicable if each chunk is a contiguous part of the plain input and the body input memory may be rebound.
+ */
+class PortSliceViewHelper : public PortMapHelper {
+public:
+    PortSliceViewHelper(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNMemoryPtr> &to, const PortMap &slice_rule)
+                        : full(from), parts(to) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = from->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        chunk_stride_in_byte = to.front()->GetSize();
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        if (slice_rule.stride < 0)
+            chunk_stride_in_byte = -chunk_stride_in_byte;
+    }
+
+    static bool isApplicable(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNMemoryPtr> &to, const PortMap &slice_rule) {
+        if (!isPlainCopyable(from, to.front()))
+            return false;
+
+        const auto& full_dims = from->getStaticDims();
+        auto part_dims = full_dims;
+        part_dims[slice_rule.axis] = std::abs(slice_rule.stride);
+        // the chunks are contiguous if there are no outer dimensions
+        return to.front()->getStaticDims() == part_dims &&
+               std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; });
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &part : parts)
+            part->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MKLDNNMemoryPtr full;
+    std::vector<MKLDNNMemoryPtr> parts;
+
+    int iter_count;
+};
+
+/**
+ * Points the body input memories to the invariant input instead of copying it once per execution.
+ * Is applicable if the body never writes to this input, i.e. the input memory may be rebound and is not a back edge target.
+ */
+class PortInvariantViewHelper : public PortMapHelper {
+public:
+    PortInvariantViewHelper(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNMemoryPtr> &to) : full(from), views(to) {}
+
+    static bool isApplicable(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNMemoryPtr> &to) {
+        return isPlainCopyable(from, to.front()) && from->getStaticDims() == to.front()->getStaticDims();
+    }
+
+    void execute(mkldnn::stream strm, int iter = -1) override {
+        // the outer memory may be pointed to another buffer between inferences
+        auto ptr = full->GetData();
+        for (auto &view : views) {
+            if (view->GetData() != ptr)
+                view->setDataHandle(ptr);
+        }
+    }
+
+private:
+    MKLDNNMemoryPtr full;
+    std::vector<MKLDNNMemoryPtr> views;
 };
 
 class BackEdgePortHelper : public PortMapHelper {
@@ -149,13 +258,29 @@ public:
         mem_holder_src = from->GetPrimitive();
         mem_holder_dst = to->GetPrimitive();
         reorder = {mem_holder_src, mem_holder_dst};
+
+        use_copy = isPlainCopyable(from, to) && from->GetSize() == to->GetSize();
+        if (use_copy) {
+            src = from;
+            dst = to;
+        }
     }
 
     void execute(mkldnn::stream strm, int iter = -1) override {
         if (iter != 0) {
-            reorder.execute(strm, mem_holder_src, mem_holder_dst);
+            if (use_copy) {
+                if (src->GetPtr() != dst->GetPtr())
+                    cpu_memcpy(dst->GetPtr(), src->GetPtr(), dst->GetSize());
+            } else {
+                reorder.execute(strm, mem_holder_src, mem_holder_dst);
+            }
         }
     }
+
+private:
+    bool use_copy = false;
+    MKLDNNMemoryPtr src;
+    MKLDNNMemoryPtr dst;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -371,6 +496,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -523,7 +649,7 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
         for (auto &mapper : before_mappers)
             mapper->execute(strm, i);
 
-        sub_graph.Infer();
+        sub_graph.InferStatic(strm);
 
         continue_cond = continue_cond_check->getStatus();
 
@@ -578,8 +704,19 @@ void MKLDNNTensorIteratorNode::prepareInputPorts() {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
 
-        if (map_rule.axis == -1)
+        const bool isBackEdgeTarget = std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& back_edge) {
+            return back_edge.to == map_rule.to;
+        });
+        if (map_rule.axis == -1 && !isDynamicNode() && !isBackEdgeTarget &&
+            MKLDNNGraph::IsInputMemoryRebindable(input_nodes[map_rule.to]) &&
+            PortInvariantViewHelper::isApplicable(from_mem, input_mems[map_rule.to]))
+            first_mappers.emplace_back(std::make_shared<PortInvariantViewHelper>(from_mem, input_mems[map_rule.to]));
+        else if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (!isDynamicNode() && MKLDNNGraph::IsInputMemoryRebindable(input_nodes[map_rule.to]) &&
+                 PortSliceViewHelper::isApplicable(from_mem, input_mems[map_rule.to], map_rule))
+            before_mappers.emplace_back(
+                    std::make_shared<PortSliceViewHelper>(from_mem, input_mems[map_rule.to], map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
@@ -110,6 +110,7 @@ protected:
     //  needShapeInfer() should return false
     //  because we cannot resolve the output dimensions before the inference is completed
     bool needShapeInfer() const override { return false; };
+    uint32_t getShapeInferValuesMask() const override { return ALL_PORTS_MASK; }
 
     bool needPrepareParams() const override;
     void prepareParams() override;
@@ -134,6 +135,7 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<std::vector<MKLDNNMemoryPtr>> input_mems;
+    std::vector<MKLDNNNodePtr> input_nodes;
     std::vector<MKLDNNMemoryPtr> output_mem;
 
     std::vector<std::shared_ptr<PortMapHelper>>
@@ -27,6 +27,7 @@ protected:
     void prepareParams() override;
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(TILE_REPEATS); }
 
 private:
     void plainExecute(mkldnn::stream strm);
@@ -1843,6 +1843,7 @@ MKLDNNTopKNode::MKLDNNTopKNode(const std::shared_ptr<ngraph::Node>& op, const mk
 
         top_k = 0;
         preset_params_done = false;
+        chunk_num = 1;
         vec_idx_seq.clear();
         vec_idx_block.clear();
 
@@ -2033,6 +2034,22 @@ void MKLDNNTopKNode::prepareParams() {
             }
         }
 
+        // [case 4]: the heap sort processes each row by a single thread, so if there are less rows than threads and the
+        //           axis is long compared to top_k, the rows are split into chunks: top_k of each chunk are selected in
+        //           parallel, then chunk_num * top_k candidates of each row are merged by one more heap sort.
+        //           each chunk is at least 16 * top_k long, so the merge is cheap in comparison with the selection.
+        chunk_num = 1;
+        if (algorithm == TopKAlgorithm::topk_heap_sort && I == 1 && top_k > 0) {
+            const size_t nthr = parallel_get_max_threads();
+            const size_t min_chunk_len = std::max(static_cast<size_t>(16 * top_k), static_cast<size_t>(1024));
+            if (O < nthr)
+                chunk_num = std::max(std::min(nthr / O, axis_dim / min_chunk_len), static_cast<size_t>(1));
+            if (chunk_num > 1) {
+                vec_chunk_ptr.resize(O * chunk_num * top_k * data_size);
+                vec_chunk_idx.resize(O * chunk_num * top_k);
+            }
+        }
+
         prepare_original_idx();
     } else { //reference mode
         int j;
@@ -2156,6 +2173,8 @@ void MKLDNNTopKNode::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8
                 topk_kernel_process(in_ptr_a, out_ptr_a, out_idx_ptr_a, process_ptr_a, process_idx_ptr_a, work_amount);
             });
         }
+    } else if (chunk_num > 1) { // [planar layout with topk on the innermost dimension split into chunks]
+        topk_chunks_process(in_ptr, out_ptr, out_idx_ptr);
     } else { // [planar layout] [blocked layout with topk on non-C]
         parallel_for2d(O, I / blk_size, [&](size_t o, size_t k) {
             const uint8_t *in_ptr_a = in_ptr + (o * A * I + k * blk_size) * data_size;
@@ -2182,6 +2201,42 @@ void MKLDNNTopKNode::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8
     }
 }
 
+void MKLDNNTopKNode::topk_chunks_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    uint8_t *chunk_ptr = vec_chunk_ptr.data();
+    int *chunk_idx_ptr = vec_chunk_idx.data();
+    const size_t candidates = chunk_num * top_k;
+
+    // the chunk lengths differ by 1 at most, so each chunk has at least top_k elements
+    parallel_for2d(O, chunk_num, [&](size_t o, size_t c) {
+        size_t start = axis_dim * c / chunk_num;
+        size_t end = axis_dim * (c + 1) / chunk_num;
+        size_t offset = o * candidates + c * top_k;
+        topk_heap_kernel_process(in_ptr + (o * A + start) * data_size, chunk_ptr + offset * data_size,
+                                 reinterpret_cast<uint8_t *>(chunk_idx_ptr + offset), vec_idx_seq.data() + start, end - start);
+    });
+
+    // the candidates keep their original indices, so they are merged as a row of length chunk_num * top_k
+    parallel_for(O, [&](size_t o) {
+        size_t offset = o * candidates;
+        topk_heap_kernel_process(chunk_ptr + offset * data_size, out_ptr + o * top_k * data_size,
+                                 out_idx_ptr + o * top_k * sizeof(int32_t), chunk_idx_ptr + offset, candidates);
+    });
+}
+
+inline void MKLDNNTopKNode::topk_heap_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
+                                                     const int *src_idx, size_t len) {
+    auto arg = jit_topk_call_args();
+    arg.src = static_cast<const void *>(in_p);
+    arg.dst = static_cast<void *>(out_p);
+    arg.index = static_cast<void *>(out_idx_p);
+    arg.work_amount = 1;
+    arg.axis_dim = len;
+    arg.top_k = static_cast<size_t>(top_k);
+    arg.sort_stride = 1;
+    arg.idx_seq_buf = src_idx;
+    (*topk_kernel)(&arg);
+}
+
 inline void MKLDNNTopKNode::topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
                                                 uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount) {
     auto arg = jit_topk_call_args();
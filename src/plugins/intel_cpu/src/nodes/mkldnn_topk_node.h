@@ -83,6 +83,7 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    uint32_t getShapeInferValuesMask() const override { return PortMask(1); }
     bool needPrepareParams() const override;
     void prepareParams() override;
     void createPrimitive() override;
@@ -98,8 +99,11 @@ public:
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
+    void topk_chunks_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
+    inline void topk_heap_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
+                                         const int *src_idx, size_t len);
     inline static int count(InferenceEngine::SizeVector dims, size_t start_ind, size_t end_ind);
     inline static int count(InferenceEngine::SizeVector dims, size_t start_ind = 0);
     inline void bitonic_push_idx(int p, int n, std::vector<int> &vec, int &cnt, bool cmp_val = true);
@@ -126,6 +130,7 @@ private:
     int dim, before_num;
     bool bubble_inplace;
     bool preset_params_done;
+    size_t chunk_num;        // number of the chunks the innermost axis is split into for the heap sort, 1 if not split
 
     InferenceEngine::SizeVector src_dims, dst_dims;
     TopKLayoutType layout;
@@ -140,6 +145,9 @@ private:
     std::vector<uint8_t> vec_process_ptr;
     std::vector<uint8_t> vec_process_idx_ptr;
 
+    std::vector<uint8_t> vec_chunk_ptr;
+    std::vector<int> vec_chunk_idx;
+
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel;
 
     std::string errorPrefix;
@@ -107,6 +107,31 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
     });
 }
 
+// Moves the topn greatest items (by comp) to the beginning of the vector in the sorted order.
+// When the vector is much longer than topn, each thread selects the topn candidates of its part first,
+// so only the candidates of all parts are sorted.
+template <typename T, typename Compare>
+static void parallel_partial_sort(std::vector<T>& items, int topn, Compare comp) {
+    const int num_items = static_cast<int>(items.size());
+    const int num_parts = parallel_get_max_threads();
+    if (num_parts < 2 || topn < 1 || num_items < 4 * num_parts * topn) {
+        std::partial_sort(items.begin(), items.begin() + topn, items.end(), comp);
+        return;
+    }
+
+    // every part is longer than topn, so it gives exactly topn candidates
+    std::vector<T> candidates(num_parts * topn);
+    parallel_for(num_parts, [&](int part) {
+        int start = 0, end = 0;
+        splitter(num_items, num_parts, part, start, end);
+        std::nth_element(items.begin() + start, items.begin() + start + topn - 1, items.begin() + end, comp);
+        std::copy(items.begin() + start, items.begin() + start + topn, candidates.begin() + part * topn);
+    });
+
+    std::partial_sort(candidates.begin(), candidates.begin() + topn, candidates.end(), comp);
+    std::copy(candidates.begin(), candidates.begin() + topn, items.begin());
+}
+
 static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn, bool store_prob) {
     if (store_prob) {
         parallel_for(pre_nms_topn, [&](size_t i) {
@@ -365,10 +390,10 @@ void proposal_exec(const float* input0, const float* input1,
                                 min_box_H, min_box_W, conf.feat_stride_,
                                 conf.box_coordinate_scale_, conf.box_size_scale_,
                                 conf.coordinates_offset, conf.initial_clip, conf.swap_xy, conf.clip_before_nms);
-        std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                          [](const ProposalBox &struct1, const ProposalBox &struct2) {
-                              return (struct1.score > struct2.score);
-                          });
+        parallel_partial_sort(proposals_, pre_nms_topn,
+                              [](const ProposalBox &struct1, const ProposalBox &struct2) {
+                                  return (struct1.score > struct2.score);
+                              });
 
         unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn, store_prob);
         nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], roi_indices, &num_rois, 0, conf.nms_thresh_,
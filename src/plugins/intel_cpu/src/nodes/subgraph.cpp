@@ -22,6 +22,7 @@
 #include <ie_ngraph_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/cpu_generator.hpp"
 
 using namespace MKLDNNPlugin;
@@ -31,24 +32,34 @@ using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::cpu::x64;
 using namespace Xbyak;
 
+namespace {
+// Creates a deep local copy of the snippet to perform canonicalization & code generation
+// Todo: Probably better to implement a proper copy constructor
+std::shared_ptr<ngraph::snippets::op::Subgraph> copySnippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original) {
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : original->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*original->get_body().get());
+    auto snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original, snippet);
+    snippet->set_friendly_name(original->get_friendly_name());
+    return snippet;
+}
+}  // namespace
+
 MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(op, eng, cache) {
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_common) ?
         dnnl::impl::cpu::x64::avx512_common : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        originalSnippet = copySnippet(tmp_snippet);
+        const auto& ops = originalSnippet->get_body()->get_ordered_ops();
+        hasReductions = std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& n) {
+            return ngraph::snippets::op::is_innermost_reduction(n);
+        });
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
@@ -69,11 +80,11 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -125,7 +136,8 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
         for (size_t i = 0; i < inputShapes.size(); i++) {
             BlockedMemoryDesc::CmpMask inputMask = BLOCKED_DESC_SKIP_OFFSET_MASK;
             PortConfig portConfig;
-            portConfig.inPlace((!i && canBeInPlace()) ? 0 : -1);
+            // the broadcasting of the dynamic inputs is known only at runtime
+            portConfig.inPlace((!i && !isDynamicNode() && canBeInPlace()) ? 0 : -1);
             portConfig.constant(false);
             if (inputShapes[i].getDims()[0] == 1) {
                 inputMask.reset(0); // accepts any stride on batch axis
@@ -166,7 +178,26 @@ void MKLDNNSnippetNode::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
 }
 
-void MKLDNNSnippetNode::createPrimitive() {
+size_t MKLDNNSnippetNode::DynamicKernelKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    for (const auto& dims : broadcastedDims)
+        seed = get_vector_hash(seed, dims);
+    for (const auto& order : orders)
+        seed = get_vector_hash(seed, order);
+    return seed;
+}
+
+bool MKLDNNSnippetNode::DynamicKernelKey::operator==(const DynamicKernelKey& rhs) const {
+    return broadcastedDims == rhs.broadcastedDims && orders == rhs.orders;
+}
+
+void MKLDNNSnippetNode::prepareParams() {
+    // the canonicalization reshapes the body, so each shape is scheduled on a fresh copy of the snippet
+    snippet = copySnippet(originalSnippet);
+    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
@@ -176,14 +207,42 @@ void MKLDNNSnippetNode::createPrimitive() {
     // but in future some interface should be defined in order to communicate schedule for a kernel
     // or generate schedule for a kernel.
     // Here kernel is generated for most warying dimension by default.
-    generate();
+    if (!isDynamicNode()) {
+        generate();
+        return;
+    }
+
+    copy_scheduling_info(schedulingArgs);
+    DynamicKernelKey key;
+    auto addToKey = [&key](const MKLDNNEdgePtr& edge) {
+        const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
+        VectorDims dims = blockedDesc->getBlockDims();
+        std::transform(dims.begin(), dims.end(), dims.begin(), [](size_t d) {
+            return d == 1 ? d : Shape::UNDEFINED_DIM;
+        });
+        key.broadcastedDims.push_back(dims);
+        key.orders.push_back(blockedDesc->getOrder());
+    };
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        addToKey(getParentEdgesAtPort(i)[0]);
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        addToKey(getChildEdgesAtPort(i)[0]);
+
+    dynamicKernel = dynamicKernels.get(key);
+    if (!dynamicKernel) {
+        generate();
+        dynamicKernel = std::make_shared<DynamicKernel>(DynamicKernel{snippet, schedule});
+        dynamicKernels.put(key, dynamicKernel);
+    }
+    schedule = dynamicKernel->schedule;
 }
 
 void MKLDNNSnippetNode::execute(dnnl::stream strm) {
     if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "MKLDNNSnippetNode can't use Optimized implementation and can't fallback to reference";
     }
-    jit_snippets_call_args call_args;
+    // the scheduling info is used only by the kernels of the dynamic nodes
+    jit_snippets_call_args call_args = schedulingArgs;
     for (size_t i = 0; i < srcMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(srcMemPtrs[i]->GetData()) + start_offset_in[i];
 
@@ -197,6 +256,10 @@ void MKLDNNSnippetNode::execute(dnnl::stream strm) {
     }
 }
 
+void MKLDNNSnippetNode::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 bool MKLDNNSnippetNode::created() const {
     return getType() == Subgraph;
 }
@@ -261,6 +324,16 @@ static auto collapseLastDims(std::vector<size_t>& dims, size_t dimsToCollapse) -
 }
 
 void MKLDNNSnippetNode::define_schedule() {
+    // the schedule of a dynamic node is defined again for each shape
+    dims_in.clear();
+    dims_out.clear();
+    offsets_in.clear();
+    offsets_out.clear();
+    sch_dims.clear();
+    sch_offsets_in.clear();
+    sch_offsets_out.clear();
+    tileRank = 1;
+
     auto edgeToBlockedShape = [](const MKLDNNEdgePtr& edge) {
         const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
         ngraph::Shape shape(blockedDesc->getBlockDims());
@@ -347,7 +420,7 @@ void MKLDNNSnippetNode::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
+            bool canCollapse = !hasReductions;
             for (size_t i = 0; i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
@@ -408,7 +481,9 @@ void MKLDNNSnippetNode::define_schedule() {
 
             for (size_t i = 0; i < offsets_out.size(); i++) {
                 int64_t offset = offsets_out[i][tensorRank - 2];
-                sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+                // the stores of the reductions advance the pointer once per row
+                const bool isReduced = dims_out[i].back() == 1 && exec_domain.back() != 1;
+                sch_offsets_out[i] = offset - (isReduced ? 1 : exec_domain.back()) * dataSize;
             }
         }
     };
@@ -426,25 +501,31 @@ void MKLDNNSnippetNode::define_schedule() {
     initSchedulingInfo();
 }
 
-void MKLDNNSnippetNode::generate() {
-    jit_snippets_compile_args jcp;
-    jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
+template <typename Args>
+void MKLDNNSnippetNode::copy_scheduling_info(Args& args) {
+    std::copy(sch_dims.begin(), sch_dims.end(), args.scheduler_dims);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), args.scheduler_offsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &args.scheduler_offsets[sch_offsets_in.size()]);
+    size_t harness_num_dims = exec_domain.size() - 1;
     if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
         canUseOptimizedImpl = false;
         harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
     }
     for (size_t i = 0; i < inputShapes.size(); i++) {
         auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &args.data_offsets[i * harness_num_dims]);
     }
     for (size_t i = 0; i < outputShapes.size(); i++) {
         auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &args.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
     }
+}
+
+void MKLDNNSnippetNode::generate() {
+    jit_snippets_compile_args jcp;
+    jcp.output_dims = exec_domain;
+    jcp.is_dynamic = isDynamicNode();
+    copy_scheduling_info(jcp);
     schedule = snippet->generate(reinterpret_cast<void*>(&jcp));
 }
 
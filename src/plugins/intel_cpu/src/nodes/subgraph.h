@@ -11,6 +11,7 @@
 #include "emitters/jit_snippets_emitters.hpp"
 
 #include "mkldnn_node.h"
+#include "cache/lru_cache.h"
 #include "snippets/op/subgraph.hpp"
 
 #include <array>
@@ -29,28 +30,34 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void selectOptimalPrimitiveDescriptor() override;
 
-    // Here we convert to canonical for & jit everything
-    void createPrimitive() override;
-
     bool created() const override;
 
+    // Here we convert to canonical for & jit everything
+    void prepareParams() override;
+
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
 
 private:
     static const size_t rank6D {6};
+    static const size_t dynamicKernelsCapacity {16};
 
     typedef void (*kernel)(const void *, const void *);
 
     void define_schedule();
 
+    template <typename Args>
+    void copy_scheduling_info(Args& args);
+
     void generate();
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
 
-    // Local copy of subgraph node for canonization & code generation
+    // Local copy of subgraph node, which is copied again for each canonization & code generation
+    std::shared_ptr<ngraph::snippets::op::Subgraph> originalSnippet;
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
     // Holds generated snippet with information about how to schedule it
@@ -86,6 +93,27 @@ private:
     std::vector<int64_t> sch_offsets_in = {};
     std::vector<int64_t> sch_offsets_out = {};
     bool canUseOptimizedImpl = true;
+    // the reductions over the innermost dimension need the planar layout and the rows which aren't collapsed
+    bool hasReductions = false;
+
+    // The kernels of a dynamic node read the scheduling info from the call args, so the generated code depends only on
+    // the layouts and on which dimensions are broadcasted. The key keeps the dimensions equal to 1 and the others are
+    // replaced by Shape::UNDEFINED_DIM.
+    struct DynamicKernelKey {
+        std::vector<VectorDims> broadcastedDims;
+        std::vector<VectorDims> orders;
+
+        size_t hash() const;
+        bool operator==(const DynamicKernelKey& rhs) const;
+    };
+    // the code is owned by the generator of the snippet, so the snippet is kept together with the schedule
+    struct DynamicKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+    LruCache<DynamicKernelKey, std::shared_ptr<DynamicKernel>> dynamicKernels {dynamicKernelsCapacity};
+    std::shared_ptr<DynamicKernel> dynamicKernel;
+    jit_snippets_call_args schedulingArgs;
 };
 
 }  // namespace MKLDNNPlugin
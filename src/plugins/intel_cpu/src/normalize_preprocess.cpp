@@ -119,3 +119,49 @@ void NormalizePreprocess::NormalizeImage(const Shape &inputShape, float *input,
         IE_THROW() << "Preprocessing error: meanValues and stdScales arrays are inconsistent.";
     }
 }
+
+void NormalizePreprocess::NormalizeImage(const Shape &inputShape, const uint8_t *input, Layout inLayout,
+                                         float *output, Layout outLayout) const {
+    IE_ASSERT(input != nullptr && output != nullptr);
+
+    const auto inputDims = inputShape.getStaticDims();
+    if (inputDims.size() != 4) {
+        IE_THROW() << "Expecting input as 4 dimension blob with format NxCxHxW.";
+    }
+
+    if (!one_of(inLayout, NCHW, NHWC) || !one_of(outLayout, NCHW, NHWC)) {
+        IE_THROW() << "Expecting input layout NCHW or NHWC.";
+    }
+
+    const size_t MB = inputDims[0];
+    const size_t C = inputDims[1];
+    const size_t spatial = inputDims[2] * inputDims[3];
+
+    // strides of the channel and spatial dimensions
+    const size_t inStrideC = inLayout == NCHW ? spatial : 1;
+    const size_t inStrideS = inLayout == NCHW ? 1 : C;
+    const size_t outStrideC = outLayout == NCHW ? spatial : 1;
+    const size_t outStrideS = outLayout == NCHW ? 1 : C;
+
+    if (meanBuffer && meanBuffer->size()) {
+        const float * meanBufferValues = meanBuffer->readOnly();
+
+        parallel_for2d(MB, spatial, [&](size_t mb, size_t i) {
+            const uint8_t *src = input + mb * C * spatial + i * inStrideS;
+            float *dst = output + mb * C * spatial + i * outStrideS;
+            for (size_t c = 0; c < C; c++) {
+                dst[c * outStrideC] = static_cast<float>(src[c * inStrideC]) - meanBufferValues[c * spatial + i];
+            }
+        });
+    } else if (!meanValues.empty() && !stdScales.empty()) {
+        parallel_for2d(MB, spatial, [&](size_t mb, size_t i) {
+            const uint8_t *src = input + mb * C * spatial + i * inStrideS;
+            float *dst = output + mb * C * spatial + i * outStrideS;
+            for (size_t c = 0; c < C; c++) {
+                dst[c * outStrideC] = (static_cast<float>(src[c * inStrideC]) - meanValues[c]) / stdScales[c];
+            }
+        });
+    } else {
+        IE_THROW() << "Preprocessing error: meanValues and stdScales arrays are inconsistent.";
+    }
+}
@@ -21,6 +21,13 @@ public:
     void Load(const Shape& inputShape, InferenceEngine::InputInfo::Ptr inputInfo);
     void NormalizeImage(const Shape &inputShape, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * @brief Converts the u8 image to fp32 and normalizes it in a single parallel pass, so the converted copy of the image
+     *        isn't materialized. The image may be transposed on the way, the layouts are NCHW or NHWC.
+     */
+    void NormalizeImage(const Shape &inputShape, const uint8_t *input, InferenceEngine::Layout inLayout,
+                        float *output, InferenceEngine::Layout outLayout) const;
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void NormalizeImage(const Shape &inputShape, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
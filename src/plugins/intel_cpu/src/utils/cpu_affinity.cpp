@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_affinity.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace MKLDNNPlugin {
+namespace affinity {
+
+#if defined(__linux__)
+std::vector<int> getCurrentThreadCpus() {
+    std::vector<int> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0)
+        return cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &mask))
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+bool pinCurrentThread(const std::vector<int>& cpus) {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (const auto cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &mask);
+    }
+    return CPU_COUNT(&mask) > 0 && sched_setaffinity(0, sizeof(mask), &mask) == 0;
+}
+#else
+std::vector<int> getCurrentThreadCpus() {
+    return {};
+}
+
+bool pinCurrentThread(const std::vector<int>&) {
+    return false;
+}
+#endif
+
+}  // namespace affinity
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+namespace MKLDNNPlugin {
+namespace affinity {
+
+/**
+ * @brief Queries the logical CPUs the calling thread is allowed to run on
+ * @return the sorted CPU ids, empty if the affinity is not supported by the system or can't be queried
+ */
+std::vector<int> getCurrentThreadCpus();
+
+/**
+ * @brief Restricts the calling thread to the logical CPUs
+ * @return false if the affinity is not supported by the system or failed, also for the empty CPUs
+ */
+bool pinCurrentThread(const std::vector<int>& cpus);
+
+}  // namespace affinity
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_isa.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ie_common.h>
+#include <mkldnn.hpp>
+
+namespace MKLDNNPlugin {
+namespace isa {
+
+namespace {
+const std::vector<std::pair<std::string, dnnl::cpu_isa>>& isaNames() {
+    static const std::vector<std::pair<std::string, dnnl::cpu_isa>> names {
+        {"SSE41", dnnl::cpu_isa::sse41},
+        {"AVX", dnnl::cpu_isa::avx},
+        {"AVX2", dnnl::cpu_isa::avx2},
+        {"AVX2_VNNI", dnnl::cpu_isa::avx2_vnni},
+        {"AVX512_CORE", dnnl::cpu_isa::avx512_core},
+        {"AVX512_CORE_VNNI", dnnl::cpu_isa::avx512_core_vnni},
+        {"AVX512_CORE_BF16", dnnl::cpu_isa::avx512_core_bf16},
+        {"AVX512_CORE_AMX", dnnl::cpu_isa::avx512_core_amx},
+        {"ALL", dnnl::cpu_isa::all},
+    };
+    return names;
+}
+
+std::vector<std::pair<std::string, dnnl::cpu_isa>>::const_iterator findName(const std::string& name) {
+    return std::find_if(isaNames().begin(), isaNames().end(), [&name](const std::pair<std::string, dnnl::cpu_isa>& isa) {
+        return isa.first == name;
+    });
+}
+}  // namespace
+
+bool isValidName(const std::string& name) {
+    return findName(name) != isaNames().end();
+}
+
+void setMaxCpuIsa(const std::string& name) {
+    const auto isa = findName(name);
+    if (isa == isaNames().end())
+        IE_THROW() << "Unknown ISA name " << name;
+
+    static std::mutex mutex;
+    static std::string limit = "ALL";
+    std::lock_guard<std::mutex> lock{mutex};
+    try {
+        dnnl::set_max_cpu_isa(isa->second);
+        limit = name;
+    } catch (const dnnl::error&) {
+        // setting the same limit once again is not an error
+        if (name != limit)
+            IE_THROW() << "The maximal ISA can't be changed to " << name << " after the kernels are dispatched for "
+                       << getEffectiveCpuIsa() << ". Set it before the first model is compiled";
+    }
+}
+
+std::string getEffectiveCpuIsa() {
+    const auto effective = dnnl::get_effective_cpu_isa();
+    const auto isa = std::find_if(isaNames().begin(), isaNames().end(), [effective](const std::pair<std::string, dnnl::cpu_isa>& isa) {
+        return isa.second == effective;
+    });
+    return isa != isaNames().end() ? isa->first : "UNKNOWN";
+}
+
+}  // namespace isa
+}  // namespace MKLDNNPlugin
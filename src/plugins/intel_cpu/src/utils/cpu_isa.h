@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+namespace MKLDNNPlugin {
+namespace isa {
+
+/**
+ * @brief Checks whether the name is one of the ISA names accepted by setMaxCpuIsa (the oneDNN ONEDNN_MAX_CPU_ISA names)
+ */
+bool isValidName(const std::string& name);
+
+/**
+ * @brief Limits the instruction set used by the oneDNN primitives and the JIT kernels of the plugin, e.g. to compare
+ *        AVX512_CORE_AMX against AVX512_CORE_BF16 on the same machine. The limit is process-wide and may be set only
+ *        until the first kernel is dispatched, so it throws if the limit is already fixed to another ISA
+ */
+void setMaxCpuIsa(const std::string& name);
+
+/**
+ * @brief Returns the name of the instruction set the kernels are dispatched for, which is the best ISA supported by
+ *        the machine within the limit
+ */
+std::string getEffectiveCpuIsa();
+
+}  // namespace isa
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_tracer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+#include <ie_common.h>
+
+namespace MKLDNNPlugin {
+
+namespace {
+thread_local int currentStreamId = -1;
+
+uint32_t getCurrentThreadId() noexcept {
+    static std::atomic<uint32_t> threadsCount{0};
+    thread_local const uint32_t threadId = ++threadsCount;
+    return threadId;
+}
+
+void writeJsonString(std::ostream& os, const std::string& str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\r': os << "\\r"; break;
+        case '\t': os << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                os << escaped;
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+void writeMicroseconds(std::ostream& os, int64_t ns) {
+    os << ns / 1000 << '.';
+    const auto fraction = static_cast<int>(ns % 1000);
+    os << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + fraction / 10 % 10)
+       << static_cast<char>('0' + fraction % 10);
+}
+}  // namespace
+
+ExecutionTracer::ExecutionTracer(size_t capacity) : _epoch(std::chrono::steady_clock::now()), _events(capacity) {
+    if (capacity == 0)
+        IE_THROW() << "The capacity of the execution tracer must be positive";
+
+    registerName("wait", "InferRequest");
+    registerName("infer", "InferRequest");
+}
+
+uint32_t ExecutionTracer::registerName(const std::string& name, const std::string& category, const std::string& isa) {
+    std::lock_guard<std::mutex> lock{_namesMutex};
+    const auto id = _nameIds.emplace(std::make_tuple(name, category, isa), static_cast<uint32_t>(_names.size()));
+    if (id.second)
+        _names.push_back({name, category, isa});
+    return id.first->second;
+}
+
+void ExecutionTracer::record(uint32_t nameId, int64_t start, int64_t finish) noexcept {
+    const uint64_t index = _next.fetch_add(1, std::memory_order_relaxed);
+    auto& event = _events[index % _events.size()];
+
+    event.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.nameId.store(nameId, std::memory_order_relaxed);
+    event.streamId.store(currentStreamId, std::memory_order_relaxed);
+    event.threadId.store(getCurrentThreadId(), std::memory_order_relaxed);
+    event.start.store(start, std::memory_order_relaxed);
+    event.finish.store(finish, std::memory_order_relaxed);
+    event.sequence.store(2 * (index + 1), std::memory_order_release);
+}
+
+void ExecutionTracer::setCurrentStream(int streamId) noexcept {
+    currentStreamId = streamId;
+}
+
+std::string ExecutionTracer::dumpChromeTrace() const {
+    struct Record {
+        uint32_t nameId;
+        int32_t streamId;
+        uint32_t threadId;
+        int64_t start;
+        int64_t finish;
+    };
+
+    std::vector<Record> records;
+    records.reserve(_events.size());
+    for (const auto& event : _events) {
+        const auto sequence = event.sequence.load(std::memory_order_acquire);
+        // the event isn't written yet or is being overwritten
+        if (sequence == 0 || sequence % 2 != 0)
+            continue;
+
+        Record record{event.nameId.load(std::memory_order_relaxed), event.streamId.load(std::memory_order_relaxed),
+                      event.threadId.load(std::memory_order_relaxed), event.start.load(std::memory_order_relaxed),
+                      event.finish.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.sequence.load(std::memory_order_relaxed) != sequence)
+            continue;
+
+        records.push_back(record);
+    }
+    std::sort(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) {
+        return lhs.start < rhs.start;
+    });
+
+    std::lock_guard<std::mutex> lock{_namesMutex};
+    std::ostringstream os;
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& record : records) {
+        if (record.nameId >= _names.size())
+            continue;
+
+        const auto& name = _names[record.nameId];
+        if (!first)
+            os << ',';
+        first = false;
+        os << "{\"name\":";
+        writeJsonString(os, name.name);
+        os << ",\"cat\":";
+        writeJsonString(os, name.category);
+        os << ",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(os, record.start);
+        os << ",\"dur\":";
+        writeMicroseconds(os, std::max<int64_t>(record.finish - record.start, 0));
+        os << ",\"pid\":" << record.streamId << ",\"tid\":" << record.threadId;
+        if (!name.isa.empty()) {
+            os << ",\"args\":{\"isa\":";
+            writeJsonString(os, name.isa);
+            os << '}';
+        }
+        os << '}';
+    }
+    os << "]}";
+    return os.str();
+}
+
+}   // namespace MKLDNNPlugin
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Records the execution intervals (e.g. of the graph nodes) into a ring buffer of the fixed capacity, so only
+ *        the latest records are kept. Recording doesn't lock and doesn't allocate, the names of the records are
+ *        registered once in advance. The records are dumped in the Chrome trace event format (chrome://tracing, Perfetto)
+ *        where each stream is shown as a process and each thread as a thread of it.
+ */
+class ExecutionTracer {
+public:
+    using Ptr = std::shared_ptr<ExecutionTracer>;
+
+    // the names registered on construction
+    enum : uint32_t {
+        WAIT = 0,   // a request waiting for the graph of the stream
+        INFER = 1,  // a request inference
+    };
+
+    explicit ExecutionTracer(size_t capacity);
+
+    ExecutionTracer(const ExecutionTracer&) = delete;
+    ExecutionTracer& operator=(const ExecutionTracer&) = delete;
+
+    /**
+     * @brief Registers the name of the records. The names are interned, so the same name registered again (e.g. by the
+     *        graphs of the other streams or by a recreated graph) gets the same id and the names don't grow
+     * @param name the name of the records (e.g. the node name)
+     * @param category the category of the records (e.g. the node type)
+     * @param isa the implementation the records are executed with, may be empty
+     * @return the id to pass to record()
+     */
+    uint32_t registerName(const std::string& name, const std::string& category, const std::string& isa = {});
+
+    /**
+     * @brief Returns the current timestamp in nanoseconds since the tracer creation
+     */
+    int64_t now() const noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _epoch).count();
+    }
+
+    /**
+     * @brief Records the interval for the current thread and stream. Overwrites the oldest record if the buffer is full.
+     */
+    void record(uint32_t nameId, int64_t start, int64_t finish) noexcept;
+
+    /**
+     * @brief Sets the stream id the records of the current thread are attributed to, -1 means the streams are unknown
+     */
+    static void setCurrentStream(int streamId) noexcept;
+
+    size_t getCapacity() const noexcept {
+        return _events.size();
+    }
+
+    /**
+     * @brief Records the interval of the scope lifetime if the tracer isn't null
+     */
+    class Scope {
+    public:
+        Scope(const Ptr& tracer, uint32_t nameId) : _tracer(tracer.get()), _nameId(nameId), _start(_tracer ? _tracer->now() : 0) {}
+        ~Scope() {
+            if (_tracer)
+                _tracer->record(_nameId, _start, _tracer->now());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ExecutionTracer* _tracer;
+        uint32_t _nameId;
+        int64_t _start;
+    };
+
+    /**
+     * @brief Returns the kept records as the Chrome trace JSON object
+     */
+    std::string dumpChromeTrace() const;
+
+private:
+    // the fields are written and read relaxed, the sequence tells whether the event was overwritten during the reading
+    struct Event {
+        // odd while the event is being written, 2 * (index + 1) when the event with the index is written
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint32_t> nameId{0};
+        std::atomic<int32_t> streamId{-1};
+        std::atomic<uint32_t> threadId{0};
+        std::atomic<int64_t> start{0};
+        std::atomic<int64_t> finish{0};
+    };
+
+    struct Name {
+        std::string name;
+        std::string category;
+        std::string isa;
+    };
+
+    std::chrono::steady_clock::time_point _epoch;
+    std::vector<Event> _events;
+    std::atomic<uint64_t> _next{0};
+
+    mutable std::mutex _namesMutex;
+    std::vector<Name> _names;
+    // the ids of the registered names by the name, category and isa
+    std::map<std::tuple<std::string, std::string, std::string>, uint32_t> _nameIds;
+};
+
+}   // namespace MKLDNNPlugin
@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+#define CPU_EXPLICIT_HUGE_PAGES
+#endif
+
+namespace MKLDNNPlugin {
+namespace hugepages {
+namespace {
+constexpr size_t hugePageSize = 2ul * 1024 * 1024;
+constexpr size_t giantPageSize = 1024ul * 1024 * 1024;
+
+#if defined(CPU_EXPLICIT_HUGE_PAGES)
+// the values from linux/mman.h, which may be missing in the old headers
+constexpr int hugeShift = 26;
+constexpr int mapHuge2MB = 21 << hugeShift;
+constexpr int mapHuge1GB = 30 << hugeShift;
+#endif
+
+enum class Kind {
+    Transparent,
+    Fallback,
+    Explicit2M,
+    Explicit1G,
+};
+
+struct Region {
+    size_t size;
+    Kind kind;
+};
+
+std::atomic<Mode> currentMode{Mode::None};
+
+// the huge pages regions by their address, the regular regions aren't registered
+std::mutex regionsMutex;
+std::unordered_map<void*, Region> regions;
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment;
+}
+
+void* alignedAlloc(size_t size, size_t alignment) {
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, std::max(alignment, sizeof(void*)), size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void alignedFree(void* ptr) {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+bool registerRegion(void* ptr, size_t size, Kind kind) {
+    try {
+        std::lock_guard<std::mutex> lock{regionsMutex};
+        regions.emplace(ptr, Region{size, kind});
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void* mapExplicit(size_t size, bool giant) {
+#if defined(CPU_EXPLICIT_HUGE_PAGES)
+    const size_t pageSize = giant ? giantPageSize : hugePageSize;
+    const size_t mapped = roundUp(size, pageSize);
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (giant ? mapHuge1GB : mapHuge2MB);
+    void* ptr = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    if (!registerRegion(ptr, mapped, giant ? Kind::Explicit1G : Kind::Explicit2M)) {
+        munmap(ptr, mapped);
+        return nullptr;
+    }
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void* allocTransparent(size_t size, size_t alignment, Kind kind) {
+    size = roundUp(size, hugePageSize);
+    void* ptr = alignedAlloc(size, std::max(alignment, hugePageSize));
+    if (nullptr == ptr)
+        return nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // the advice is only a hint, the memory is usable anyway
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+    if (!registerRegion(ptr, size, kind)) {
+        alignedFree(ptr);
+        return nullptr;
+    }
+    return ptr;
+}
+}  // namespace
+
+void setMode(Mode mode) {
+    currentMode = mode;
+}
+
+Mode getMode() {
+    return currentMode;
+}
+
+void* allocate(size_t size, size_t alignment) noexcept {
+    return allocate(size, alignment, currentMode);
+}
+
+void* allocate(size_t size, size_t alignment, Mode mode) noexcept {
+    // the regions smaller than a huge page would waste the most of it
+    if (mode == Mode::None || size < hugePageSize)
+        return alignedAlloc(roundUp(size, alignment), alignment);
+
+    if (mode == Mode::Explicit || mode == Mode::Explicit1G) {
+        // the pages are aligned to their size, which is larger than any alignment requested by the plugin
+        if (void* ptr = mapExplicit(size, mode == Mode::Explicit1G && size >= giantPageSize))
+            return ptr;
+        if (void* ptr = allocTransparent(size, alignment, Kind::Fallback))
+            return ptr;
+    } else if (void* ptr = allocTransparent(size, alignment, Kind::Transparent)) {
+        return ptr;
+    }
+    return alignedAlloc(roundUp(size, alignment), alignment);
+}
+
+void free(void* ptr) noexcept {
+    if (nullptr == ptr)
+        return;
+    Region region{0, Kind::Transparent};
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock{regionsMutex};
+        auto it = regions.find(ptr);
+        if (it != regions.end()) {
+            region = it->second;
+            found = true;
+            regions.erase(it);
+        }
+    }
+    if (found && (region.kind == Kind::Explicit2M || region.kind == Kind::Explicit1G)) {
+#if defined(CPU_EXPLICIT_HUGE_PAGES)
+        munmap(ptr, region.size);
+#endif
+        return;
+    }
+    alignedFree(ptr);
+}
+
+std::map<std::string, size_t> getBytes() {
+    std::map<std::string, size_t> bytes{{"EXPLICIT_1G", 0}, {"EXPLICIT_2M", 0}, {"TRANSPARENT", 0}, {"FALLBACK", 0}};
+    std::lock_guard<std::mutex> lock{regionsMutex};
+    for (const auto& region : regions) {
+        switch (region.second.kind) {
+        case Kind::Explicit1G:
+            bytes["EXPLICIT_1G"] += region.second.size;
+            break;
+        case Kind::Explicit2M:
+            bytes["EXPLICIT_2M"] += region.second.size;
+            break;
+        case Kind::Fallback:
+            bytes["FALLBACK"] += region.second.size;
+            bytes["TRANSPARENT"] += region.second.size;
+            break;
+        case Kind::Transparent:
+            bytes["TRANSPARENT"] += region.second.size;
+            break;
+        }
+    }
+    return bytes;
+}
+
+}  // namespace hugepages
+}  // namespace MKLDNNPlugin
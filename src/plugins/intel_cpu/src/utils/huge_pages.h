@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace MKLDNNPlugin {
+namespace hugepages {
+
+enum class Mode {
+    None,
+    // the big regions are aligned to the 2MB page and advised MADV_HUGEPAGE
+    Transparent,
+    // the big regions are mapped from the hugetlbfs pool of the 2MB pages
+    Explicit,
+    // the regions of 1GB and above are mapped from the hugetlbfs pool of the 1GB pages, the smaller ones as Explicit
+    Explicit1G,
+};
+
+/**
+ * @brief Sets how the memory of the weights, the intermediate tensors and the I/O blobs is backed by the huge pages.
+ *        The mode is process-wide and applies to the memory allocated after it's set. The explicit modes fall back to
+ *        the transparent huge pages when the hugetlbfs pool is exhausted, the transparent one to the regular pages
+ *        when the system doesn't support it
+ */
+void setMode(Mode mode);
+
+Mode getMode();
+
+/**
+ * @brief Allocates the memory aligned to the alignment, which must be a power of two, with the pages of the current mode
+ * @return nullptr if the memory can't be allocated
+ */
+void* allocate(size_t size, size_t alignment) noexcept;
+
+/**
+ * @brief Allocates the memory with the pages of the given mode instead of the current one
+ */
+void* allocate(size_t size, size_t alignment, Mode mode) noexcept;
+
+/**
+ * @brief Frees the memory returned by allocate()
+ */
+void free(void* ptr) noexcept;
+
+/**
+ * @brief Returns the number of bytes currently allocated for each kind of the huge pages: EXPLICIT_1G and EXPLICIT_2M
+ *        are mapped from the hugetlbfs pools, TRANSPARENT are advised to the kernel, which backs them with the huge
+ *        pages as far as it's able to. FALLBACK are the bytes of TRANSPARENT which the explicit mode failed to map
+ */
+std::map<std::string, size_t> getBytes();
+
+}  // namespace hugepages
+}  // namespace MKLDNNPlugin
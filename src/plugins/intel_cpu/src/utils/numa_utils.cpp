@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+namespace numa {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+namespace {
+// the values from linux/mempolicy.h, libnuma is not required
+constexpr int MPOL_BIND_MODE = 2;
+constexpr int MPOL_INTERLEAVE_MODE = 3;
+constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+
+constexpr size_t maskBits = sizeof(unsigned long) * 8;  // NOLINT
+
+size_t getPageSize() {
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+// returns the pages entirely covered by the region
+bool getPagesRange(const void* ptr, size_t size, uintptr_t& begin, uintptr_t& end) {
+    const auto pageSize = getPageSize();
+    const auto addr = reinterpret_cast<uintptr_t>(ptr);
+    begin = (addr + pageSize - 1) / pageSize * pageSize;
+    end = (addr + size) / pageSize * pageSize;
+    return ptr != nullptr && end > begin;
+}
+
+bool setPolicy(const void* ptr, size_t size, int mode, const std::vector<int>& numaNodes) {
+    uintptr_t begin, end;
+    if (numaNodes.empty() || !getPagesRange(ptr, size, begin, end))
+        return false;
+
+    const auto maxNode = static_cast<size_t>(*std::max_element(numaNodes.begin(), numaNodes.end()));
+    std::vector<unsigned long> mask(maxNode / maskBits + 1, 0);  // NOLINT
+    for (auto node : numaNodes) {
+        if (node < 0)
+            return false;
+        mask[node / maskBits] |= 1ul << (node % maskBits);
+    }
+
+    // the kernel expects the number of the mask bits plus one
+    return syscall(SYS_mbind, begin, end - begin, mode, mask.data(), mask.size() * maskBits + 1, MPOL_MF_MOVE_FLAG) == 0;
+}
+}  // namespace
+
+bool bindToNode(const void* ptr, size_t size, int numaNode) {
+    return setPolicy(ptr, size, MPOL_BIND_MODE, {numaNode});
+}
+
+bool interleave(const void* ptr, size_t size, const std::vector<int>& numaNodes) {
+    return setPolicy(ptr, size, MPOL_INTERLEAVE_MODE, numaNodes);
+}
+
+std::map<int, size_t> getBytesPerNode(const void* ptr, size_t size) {
+    std::map<int, size_t> bytes;
+    uintptr_t begin, end;
+    if (!getPagesRange(ptr, size, begin, end))
+        return bytes;
+
+    const auto pageSize = getPageSize();
+    const size_t count = (end - begin) / pageSize;
+    std::vector<void*> pages(count);
+    for (size_t i = 0; i < count; i++)
+        pages[i] = reinterpret_cast<void*>(begin + i * pageSize);
+
+    // with no target nodes move_pages only reports the node of each page
+    std::vector<int> status(count, -1);
+    if (syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0) {
+        bytes[-1] = count * pageSize;
+        return bytes;
+    }
+    for (auto node : status) {
+        bytes[node < 0 ? -1 : node] += pageSize;
+    }
+    return bytes;
+}
+#else
+bool bindToNode(const void* ptr, size_t size, int numaNode) {
+    return false;
+}
+
+bool interleave(const void* ptr, size_t size, const std::vector<int>& numaNodes) {
+    return false;
+}
+
+std::map<int, size_t> getBytesPerNode(const void* ptr, size_t size) {
+    return {};
+}
+#endif
+
+}  // namespace numa
+}  // namespace MKLDNNPlugin
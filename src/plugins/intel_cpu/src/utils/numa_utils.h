@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+namespace numa {
+
+/**
+ * @brief Binds the pages of the memory region to the NUMA node moving the already touched pages.
+ *        Only the pages entirely covered by the region are bound.
+ * @return false if the binding is not supported by the system or failed
+ */
+bool bindToNode(const void* ptr, size_t size, int numaNode);
+
+/**
+ * @brief Interleaves the pages of the memory region over the NUMA nodes moving the already touched pages.
+ *        Only the pages entirely covered by the region are interleaved.
+ * @return false if the interleaving is not supported by the system or failed
+ */
+bool interleave(const void* ptr, size_t size, const std::vector<int>& numaNodes);
+
+/**
+ * @brief Queries the NUMA nodes the pages of the memory region are physically placed on
+ * @return the number of bytes per NUMA node, the bytes which placement is unknown (e.g. not touched pages) are reported
+ *         for the node -1
+ */
+std::map<int, size_t> getBytesPerNode(const void* ptr, size_t size);
+
+}  // namespace numa
+}  // namespace MKLDNNPlugin
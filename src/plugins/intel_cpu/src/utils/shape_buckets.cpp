@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_buckets.h"
+
+#include <ie_common.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace MKLDNNPlugin;
+
+ShapeBuckets::ShapeBuckets(const std::string& policy) : _policy(policy) {
+    if (policy.empty() || policy == "NO")
+        return;
+
+    if (policy == "POW2") {
+        _pow2 = true;
+        return;
+    }
+
+    std::stringstream ss(policy);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        size_t pos = 0;
+        long long bucket = 0;
+        try {
+            bucket = std::stoll(item, &pos);
+        } catch (const std::exception&) {
+            pos = 0;
+        }
+        if (pos == 0 || pos != item.size() || bucket <= 0)
+            IE_THROW() << "Wrong shape bucket value '" << item << "' in the policy '" << policy
+                       << "'. Expected only positive integer numbers";
+        if (!_buckets.empty() && _buckets.back() >= static_cast<size_t>(bucket))
+            IE_THROW() << "Wrong shape buckets policy '" << policy << "'. The buckets are expected in ascending order";
+        _buckets.push_back(static_cast<size_t>(bucket));
+    }
+}
+
+size_t ShapeBuckets::roundUp(size_t dim, size_t upperBound) const {
+    // zero dims are kept to preserve the empty tensor semantic
+    if (dim == 0)
+        return dim;
+
+    size_t rounded = dim;
+    if (_pow2) {
+        size_t pow2 = 1;
+        while (pow2 < dim && pow2 <= (std::numeric_limits<size_t>::max() >> 1))
+            pow2 <<= 1;
+        if (pow2 >= dim)
+            rounded = pow2;
+    } else {
+        auto bucket = std::lower_bound(_buckets.begin(), _buckets.end(), dim);
+        if (bucket != _buckets.end())
+            rounded = *bucket;
+    }
+
+    return rounded <= upperBound ? rounded : dim;
+}
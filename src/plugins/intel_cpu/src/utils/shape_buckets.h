@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Rounds dynamic dimensions up to a limited set of values (buckets), which bounds the number of distinct shapes
+ *        the dynamic graph is executed with and therefore the number of primitives compiled for them.
+ *        The policy is defined by a string:
+ *          "" or "NO" - disabled, the dimensions are kept as is;
+ *          "POW2" - the dimensions are rounded up to the nearest power of two;
+ *          "<b1>,<b2>,...,<bn>" - the dimensions are rounded up to the nearest bucket from the ascending list.
+ *        Dimensions greater than the largest bucket and dimensions that can't be rounded without exceeding the upper bound
+ *        are kept as is.
+ */
+class ShapeBuckets {
+public:
+    ShapeBuckets() = default;
+    explicit ShapeBuckets(const std::string& policy);
+
+    bool empty() const noexcept {
+        return !_pow2 && _buckets.empty();
+    }
+
+    size_t roundUp(size_t dim, size_t upperBound = std::numeric_limits<size_t>::max()) const;
+
+    const std::string& getPolicy() const noexcept {
+        return _policy;
+    }
+
+private:
+    std::string _policy;
+    std::vector<size_t> _buckets;
+    bool _pow2 = false;
+};
+
+}   // namespace MKLDNNPlugin
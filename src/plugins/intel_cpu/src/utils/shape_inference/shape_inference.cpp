@@ -79,6 +79,7 @@
 #include "topk_shape_inference.hpp"
 #include "utils.hpp"
 #include "variadic_split_shape_inference.hpp"
+#include "cache/lru_cache.h"
 
 void shape_inference(ov::Node* op,
                      const std::vector<ov::StaticShape>& input_shapes,
@@ -398,7 +399,7 @@ std::shared_ptr<entryIO<OP>> make_shared_entryIO(std::shared_ptr<OP> node) {
     return std::make_shared<entryIO<OP>>(node);
 }
 
-std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::Node>& op) {
+static std::shared_ptr<IShapeInfer> make_shape_inference_impl(const std::shared_ptr<ngraph::Node>& op) {
     if (auto node = ov::as_type_ptr<ov::opset8::Convolution>(op)) {
         return std::make_shared<entryConv<ov::opset8::Convolution>>(node, false);
     } else if (auto node = ov::as_type_ptr<ov::opset8::GroupConvolution>(op)) {
@@ -559,3 +560,124 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
         return std::make_shared<entryFallback>(op);
     }
 }
+
+namespace {
+// the number of the input shapes and values combinations memoized for each node
+constexpr size_t shape_infer_cache_capacity = 32;
+
+struct ShapeInferKey {
+    struct InputValue {
+        size_t port;
+        ov::element::Type type;
+        ov::Shape shape;
+        std::vector<uint8_t> data;
+
+        bool operator==(const InputValue& rhs) const {
+            return port == rhs.port && type == rhs.type && shape == rhs.shape && data == rhs.data;
+        }
+    };
+
+    std::vector<ov::StaticShape> input_shapes;
+    std::vector<InputValue> input_values;
+
+    size_t hash() const {
+        size_t seed = 0;
+        auto combine = [&seed](size_t value) {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+        for (const auto& shape : input_shapes) {
+            combine(shape.size());
+            for (const auto& dim : shape)
+                combine(dim.get_length());
+        }
+        for (const auto& value : input_values) {
+            combine(value.port);
+            for (const auto byte : value.data)
+                combine(byte);
+        }
+        return seed;
+    }
+
+    bool operator==(const ShapeInferKey& rhs) const {
+        return input_shapes == rhs.input_shapes && input_values == rhs.input_values;
+    }
+};
+
+struct ShapeInferResult {
+    std::vector<ov::StaticShape> output_shapes;
+    ov::CoordinateDiff pads_begin, pads_end;
+};
+
+// Memoizes the shape inference results by the input shapes and the values of the data dependent inputs, so the nodes
+// whose input shapes alternate between a few ones don't infer the same output shapes again
+class entryMemoized : public IShapeInfer {
+public:
+    entryMemoized(std::shared_ptr<IShapeInfer> impl, bool infers_pads)
+        : impl(std::move(impl)),
+          infers_pads(infers_pads),
+          cache(shape_infer_cache_capacity) {}
+
+    std::vector<ov::StaticShape> infer(
+        const std::vector<ov::StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        ShapeInferKey key{input_shapes, {}};
+        key.input_values.reserve(constant_data.size());
+        for (const auto& value : constant_data) {
+            const auto& tensor = value.second;
+            const auto data = static_cast<const uint8_t*>(tensor->get_data_ptr());
+            key.input_values.push_back({value.first,
+                                        tensor->get_element_type(),
+                                        tensor->get_shape(),
+                                        std::vector<uint8_t>(data, data + tensor->get_size_in_bytes())});
+        }
+
+        if (auto cached = cache.get(key)) {
+            result = std::move(cached);
+            return result->output_shapes;
+        }
+        auto inferred = std::make_shared<ShapeInferResult>();
+        inferred->output_shapes = impl->infer(input_shapes, constant_data);
+        if (infers_pads) {
+            inferred->pads_begin = impl->get_pads_begin();
+            inferred->pads_end = impl->get_pads_end();
+        }
+        cache.put(key, inferred);
+        result = std::move(inferred);
+        return result->output_shapes;
+    }
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        OPENVINO_ASSERT(infers_pads && result, "The shape inference doesn't infer the pads");
+        return result->pads_begin;
+    }
+
+    const ov::CoordinateDiff& get_pads_end() override {
+        OPENVINO_ASSERT(infers_pads && result, "The shape inference doesn't infer the pads");
+        return result->pads_end;
+    }
+
+    const std::vector<int64_t>& get_input_ranks() override {
+        return impl->get_input_ranks();
+    }
+
+private:
+    std::shared_ptr<IShapeInfer> impl;
+    bool infers_pads;
+    MKLDNNPlugin::LruCache<ShapeInferKey, std::shared_ptr<const ShapeInferResult>> cache;
+    // the result of the last inference, it holds the pads
+    std::shared_ptr<const ShapeInferResult> result;
+};
+
+// the operations whose shape inference calculates the pads as well
+bool infers_pads(const std::shared_ptr<ngraph::Node>& op) {
+    return ov::is_type<ov::opset8::Convolution>(op) || ov::is_type<ov::opset8::GroupConvolution>(op) ||
+           ov::is_type<ov::opset8::ConvolutionBackpropData>(op) ||
+           ov::is_type<ov::opset8::GroupConvolutionBackpropData>(op) || ov::is_type<ov::op::v8::MaxPool>(op) ||
+           ov::is_type<ov::op::v1::MaxPool>(op) || ov::is_type<ov::op::v1::AvgPool>(op) ||
+           ov::is_type<ov::op::v1::DeformableConvolution>(op) || ov::is_type<ov::op::v8::DeformableConvolution>(op);
+}
+}  // namespace
+
+std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::Node>& op) {
+    return std::make_shared<entryMemoized>(make_shape_inference_impl(op), infers_pads(op));
+}
@@ -6,13 +6,13 @@
 using namespace ov;
 
 ov::StaticShape::StaticShape(std::vector<StaticDimension> dimensions)
-        : std::vector<StaticDimension>(std::move(dimensions)) {}
+        : Dimensions(dimensions.begin(), dimensions.end()) {}
 
 ov::StaticShape::StaticShape(const std::vector<StaticDimension::value_type>& dimensions)
-        : std::vector<StaticDimension>(dimensions.begin(), dimensions.end()) {}
+        : Dimensions(dimensions.begin(), dimensions.end()) {}
 
 ov::StaticShape::StaticShape(std::initializer_list<StaticDimension> init)
-        : std::vector<StaticDimension>(init.begin(), init.end()) {}
+        : Dimensions(init.begin(), init.end()) {}
 
 
 ov::Shape ov::StaticShape::get_max_shape() const {
@@ -32,9 +32,10 @@ ov::StaticShape ov::operator+(const StaticShape& s1, const StaticShape& s2) {
         throw std::invalid_argument("rank mismatch");
     }
 
-    std::vector<StaticDimension> result(s1.size());
+    StaticShape result;
+    result.reserve(s1.size());
     for (size_t i = 0; i < s1.size(); ++i)
-        result[i] = (s1[i] + s2[i]);
+        result.push_back(s1[i] + s2[i]);
     return result;
 }
 
@@ -110,14 +111,15 @@ bool ov::StaticShape::broadcast_merge_into(StaticShape& dst,
             auto dst_rank = dst.size();
             auto src_rank = src.size();
             auto new_rank = std::max(dst_rank, src_rank);
-            std::vector<StaticDimension> dims(new_rank);
+            StaticShape dims;
+            dims.resize(new_rank);
             bool success = true;
             for (int64_t i = 0; i < new_rank; i++) {
                 auto dsti = i < (new_rank - dst_rank) ? StaticDimension(1) : dst[i - (new_rank - dst_rank)];
                 auto srci = i < (new_rank - src_rank) ? StaticDimension(1) : src[i - (new_rank - src_rank)];
                 success &= StaticDimension::broadcast_merge(dims[i], dsti, srci);
             }
-            dst = StaticShape(std::move(dims));
+            dst = std::move(dims);
             return success;
         }
         case ngraph::op::AutoBroadcastType::PDPD: {
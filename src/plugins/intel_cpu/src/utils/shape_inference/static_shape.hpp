@@ -13,6 +13,7 @@
 #include "openvino/core/shape.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/small_vector.hpp"
 
 namespace ov {
 namespace op {
@@ -20,7 +21,10 @@ namespace op {
 }
 
 /// \brief Class representing a shape that must be totally static.
-class StaticShape : public std::vector<StaticDimension>  {
+/// The dimensions of the shapes with up to 6 axes are kept inline, so the runtime shape inference doesn't allocate them.
+class StaticShape : public ov::SmallVector<StaticDimension, 6> {
+    using Dimensions = ov::SmallVector<StaticDimension, 6>;
+
 public:
     StaticShape() = default;
     StaticShape(std::initializer_list<StaticDimension> init);
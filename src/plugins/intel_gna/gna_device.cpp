@@ -27,6 +27,7 @@
 //#define MODEL_DUMP
 
 std::mutex GNADeviceHelper::acrossPluginsSync{};
+std::map<uint32_t, uint32_t> GNADeviceHelper::openedDevicesUsage{};
 
 uint8_t* GNADeviceHelper::alloc(uint32_t size_requested, uint32_t *size_granted) {
     std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
@@ -109,7 +110,7 @@ void GNADeviceHelper::enforceLegacyCnnsWhenNeeded(Gna2Model& gnaModel) {
     }
 }
 
-uint32_t GNADeviceHelper::createModel(Gna2Model& gnaModel) const {
+uint32_t GNADeviceHelper::createModel(Gna2Model& gnaModel) {
     std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     uint32_t modelId;
     const auto legacyExecTarget = enforceLegacyCnnNeeded();
@@ -132,6 +133,7 @@ uint32_t GNADeviceHelper::createModel(Gna2Model& gnaModel) const {
     const auto status = Gna2ModelCreate(nGnaDeviceIndex, &gnaModel, &modelId);
 
     checkGna2Status(status, gnaModel);
+    createdModelIds.insert(modelId);
     return modelId;
 }
 
@@ -139,6 +141,7 @@ void GNADeviceHelper::releaseModel(const uint32_t model_id) {
     std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     const auto status = Gna2ModelRelease(model_id);
     checkGna2Status(status, "Gna2ModelRelease");
+    createdModelIds.erase(model_id);
 }
 
 bool GNADeviceHelper::enforceLegacyCnnNeeded() const {
@@ -381,8 +384,10 @@ const std::map <const std::pair<Gna2OperationType, int32_t>, const std::string>
 };
 
 GnaWaitStatus GNADeviceHelper::wait(uint32_t reqId, int64_t millisTimeout) {
-    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
+    // the lock isn't held while the request is waited, so the other requests are enqueued meanwhile
+    // and the device doesn't idle between them
     const auto status = Gna2RequestWait(reqId, millisTimeout);
+    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     if (status == Gna2StatusWarningDeviceBusy) {
         return GNA_REQUEST_PENDING;
     }
@@ -454,8 +459,14 @@ void GNADeviceHelper::open() {
             THROW_GNA_EXCEPTION << "Wrong virtual GNA device version reported: " << detectedGnaDevVersion << " instead of: " << gnaExecTarget;
         }
     } else {
-        const auto status = Gna2DeviceOpen(nGnaDeviceIndex);
-        checkGna2Status(status, "Gna2DeviceOpen");
+        // the device may be already opened for another compiled model
+        auto& usage = openedDevicesUsage[nGnaDeviceIndex];
+        if (usage == 0) {
+            const auto status = Gna2DeviceOpen(nGnaDeviceIndex);
+            checkGna2Status(status, "Gna2DeviceOpen");
+        }
+        usage++;
+        sharedDeviceOpened = true;
     }
     deviceOpened = true;
 }
@@ -470,13 +481,28 @@ void GNADeviceHelper::close() {
         }
     }
     std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
+    // the models of this helper are released explicitly, the device may stay opened for the other compiled models
+    for (auto modelId : createdModelIds) {
+        const auto status = Gna2ModelRelease(modelId);
+        if (status != Gna2StatusSuccess) {
+            gnawarn() << "GNA Model " << modelId << " was not successfully released with status " << status << std::endl;
+        }
+    }
+    createdModelIds.clear();
+    deviceOpened = false;
+    if (sharedDeviceOpened) {
+        sharedDeviceOpened = false;
+        if (--openedDevicesUsage[nGnaDeviceIndex] != 0) {
+            return;
+        }
+        openedDevicesUsage.erase(nGnaDeviceIndex);
+    }
     const auto status = Gna2DeviceClose(nGnaDeviceIndex);
     try {
         checkGna2Status(status, "Gna2DeviceClose");
     } catch (...) {
         gnawarn() << "GNA Device was not successfully closed with status " << status << std::endl;
     }
-    deviceOpened = false;
 }
 
 void GNADeviceHelper::updateGnaPerfCounters() {
@@ -34,6 +34,9 @@ enum GnaWaitStatus : int {
  */
 class GNADeviceHelper {
     static std::mutex acrossPluginsSync;
+    // number of helpers using each opened hardware device, the compiled models share the device
+    // instead of reopening it, so switching between them doesn't pay for the device open
+    static std::map<uint32_t, uint32_t> openedDevicesUsage;
     static std::string decoratedGnaLibVersion() {
         static std::string gnaLibraryVersion{ ", GNA library version: " + GNADeviceHelper::GetGnaLibraryVersion() };
         return gnaLibraryVersion;
@@ -57,9 +60,11 @@ class GNADeviceHelper {
     uint64_t instrumentationTotal[TotalGna2InstrumentationPoints] = {};
     uint32_t instrumentationConfigId = 0;
     std::set<uint32_t> unwaitedRequestIds;
+    std::set<uint32_t> createdModelIds;
 #define MAX_TIMEOUT 500000
     bool isPerformanceMeasuring = false;
     bool deviceOpened = false;
+    bool sharedDeviceOpened = false;
 
 public:
     explicit GNADeviceHelper(std::string executionTargetIn = "",
@@ -100,7 +105,7 @@ public:
 
     void setUpActiveList(unsigned req_config_id, uint32_t layerIndex, uint32_t* ptr_active_indices, uint32_t num_active_indices);
     uint32_t propagate(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode);
-    uint32_t createModel(Gna2Model& gnaModel) const;
+    uint32_t createModel(Gna2Model& gnaModel);
     void releaseModel(const uint32_t model_id);
     uint32_t createRequestConfig(const uint32_t model_id);
     static uint32_t getNumberOfGnaDevices();
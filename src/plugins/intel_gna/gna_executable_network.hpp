@@ -9,9 +9,11 @@
 #include <vector>
 
 #include "gna_infer_request.hpp"
+#include "gna_mapped_streambuf.hpp"
 #include "gna_plugin.hpp"
 #include <gna/gna_config.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <ie_icore.hpp>
 
@@ -19,14 +21,23 @@ namespace GNAPluginNS {
 
 class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal {
     std::shared_ptr<GNAPlugin> plg;
+    // waits the requests started with the callbacks, one thread is enough as the device completes them in order
+    InferenceEngine::ITaskExecutor::Ptr completionExecutor =
+        std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            InferenceEngine::IStreamsExecutor::Config{"GNACompletionExecutor"});
 
  public:
      GNAExecutableNetwork(const std::string& aotFileName, std::shared_ptr<GNAPlugin> plg)
          : plg(plg) {
-         std::fstream inputStream(aotFileName, std::ios_base::in | std::ios_base::binary);
-         if (inputStream.fail()) {
+         // the model is read from the mapped file directly into GNA memory
+         std::shared_ptr<ov::util::MappedMemory> mapped;
+         try {
+             mapped = ov::util::load_mmap_object(aotFileName);
+         } catch (const std::runtime_error&) {
              THROW_GNA_EXCEPTION << "Cannot open file to import model: " << aotFileName;
          }
+         MappedStreamBuf mappedBuf(mapped);
+         std::istream inputStream(&mappedBuf);
          plg->ImportNetwork(inputStream);
          // old API
          setNetworkInputs(plg->GetNetworkInputs());
@@ -63,7 +74,7 @@ class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal
     InferenceEngine::IInferRequestInternal::Ptr
         CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                InferenceEngine::OutputsDataMap networkOutputs) override {
-        return std::make_shared<GNAInferRequest>(plg, networkInputs, networkOutputs);
+        return std::make_shared<GNAInferRequest>(plg, networkInputs, networkOutputs, completionExecutor);
     }
 
     InferenceEngine::IInferRequestInternal::Ptr
@@ -74,7 +85,7 @@ class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal
         const auto& core = _plugin->GetCore();
         if (!core || !core->isNewAPI())
             return nullptr;
-        return std::make_shared<GNAInferRequest>(plg, inputs, outputs);
+        return std::make_shared<GNAInferRequest>(plg, inputs, outputs, completionExecutor);
     }
 
     void Export(const std::string &modelFileName) override {
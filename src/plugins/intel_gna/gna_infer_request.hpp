@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <string>
 #include <map>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp/ie_infer_request.hpp"
+#include "threading/ie_itask_executor.hpp"
 #include "gna_plugin.hpp"
 
 namespace GNAPluginNS {
@@ -34,21 +36,43 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
         }
     }
 
+    static std::exception_ptr ToExceptionPtr(InferenceEngine::StatusCode res) {
+        if (res == InferenceEngine::StatusCode::OK) {
+            return nullptr;
+        }
+        try {
+            IE_EXCEPTION_SWITCH(res, ExceptionType,
+                InferenceEngine::details::ThrowNow<ExceptionType>{}
+                    <<= std::stringstream{} << IE_LOCATION
+                    <<  InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
+        } catch (...) {
+            return std::current_exception();
+        }
+        return nullptr;
+    }
+
  protected:
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    // waits the requests started with a callback, without it the callback is called from StartAsync itself
+    InferenceEngine::ITaskExecutor::Ptr completionExecutor;
+    // the status of the request waited by the completion executor
+    std::shared_future<InferenceEngine::StatusCode> completion;
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
-                    const std::vector<std::shared_ptr<const ov::Node>>& outputs)
-        : InferenceEngine::IInferRequestInternal(inputs, outputs), plg(plg) {
+                    const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                    const InferenceEngine::ITaskExecutor::Ptr& completionExecutor = nullptr)
+        : InferenceEngine::IInferRequestInternal(inputs, outputs), plg(plg), completionExecutor(completionExecutor) {
         CreateInferRequest();
     }
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap networkInputs,
-                    InferenceEngine::OutputsDataMap networkOutputs)
-        : InferenceEngine::IInferRequestInternal(networkInputs, networkOutputs), plg(plg) {
+                    InferenceEngine::OutputsDataMap networkOutputs,
+                    const InferenceEngine::ITaskExecutor::Ptr& completionExecutor = nullptr)
+        : InferenceEngine::IInferRequestInternal(networkInputs, networkOutputs), plg(plg),
+          completionExecutor(completionExecutor) {
         CreateInferRequest();
     }
     /**
@@ -56,6 +80,7 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
      */
     void InferImpl() override {
+        completion = {};
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         // result returned from sync infer wait method
@@ -84,25 +109,45 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
      */
     void StartAsyncImpl() override {
+        completion = {};
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         inferRequestIdx = plg->QueueInference(_inputs, _outputs);
-        // workaround to unblock callback-based flows
-        if (_callback) {
-            auto res = Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        if (!_callback) {
+            return;
+        }
+        if (!completionExecutor) {
+            // workaround to unblock callback-based flows
+            _callback(ToExceptionPtr(Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY)));
+            return;
+        }
+        // the request is waited on the completion executor, so the caller queues the next requests meanwhile and
+        // the request configs keep the device busy, the task doesn't refer to this request as the callback may
+        // release it
+        auto promise = std::make_shared<std::promise<InferenceEngine::StatusCode>>();
+        completion = promise->get_future().share();
+        auto plugin = plg;
+        auto idx = inferRequestIdx;
+        auto callback = _callback;
+        completionExecutor->run([plugin, idx, callback, promise] {
+            InferenceEngine::StatusCode res = InferenceEngine::OK;
             std::exception_ptr exceptionPtr;
-            if (res != InferenceEngine::StatusCode::OK) {
-                try {
-                    IE_EXCEPTION_SWITCH(res, ExceptionType,
-                        InferenceEngine::details::ThrowNow<ExceptionType>{}
-                            <<= std::stringstream{} << IE_LOCATION
-                            <<  InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
-                } catch (...) {
-                    exceptionPtr = std::current_exception();
-                }
+            try {
+                const auto waitStatus = plugin->WaitFor(idx, MAX_TIMEOUT);
+                res = waitStatus == GNA_REQUEST_PENDING ? InferenceEngine::RESULT_NOT_READY
+                    : waitStatus == GNA_REQUEST_ABORTED ? InferenceEngine::INFER_NOT_STARTED
+                    : InferenceEngine::OK;
+                exceptionPtr = ToExceptionPtr(res);
+            } catch (...) {
+                exceptionPtr = std::current_exception();
             }
-            _callback(exceptionPtr);
-        }
+            callback(exceptionPtr);
+            if (exceptionPtr && res == InferenceEngine::OK) {
+                promise->set_exception(exceptionPtr);
+            } else {
+                promise->set_value(res);
+            }
+        });
     }
 
 
@@ -113,6 +158,15 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
             IE_THROW(ParameterMismatch);
         }
 
+        if (completion.valid()) {
+            if (millis_timeout == InferenceEngine::InferRequest::WaitMode::RESULT_READY) {
+                completion.wait();
+            } else if (completion.wait_for(std::chrono::milliseconds(millis_timeout)) != std::future_status::ready) {
+                return InferenceEngine::RESULT_NOT_READY;
+            }
+            return completion.get();
+        }
+
         if (millis_timeout == InferenceEngine::InferRequest::WaitMode::RESULT_READY) {
             millis_timeout = MAX_TIMEOUT;
         }
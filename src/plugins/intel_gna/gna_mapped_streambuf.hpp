@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+
+#include "openvino/util/mmap_object.hpp"
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Read-only stream buffer over the memory-mapped file, the reads are copied from the mapping straight into
+ * the destination (e.g. GNA memory) without the file stream buffering and the small system reads
+ */
+class MappedStreamBuf final : public std::streambuf {
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+
+ public:
+    explicit MappedStreamBuf(std::shared_ptr<ov::util::MappedMemory> mappedMemory) : mapped(std::move(mappedMemory)) {
+        char* begin = mapped->data();
+        setg(begin, begin, begin + mapped->size());
+    }
+
+ protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            base = egptr() - eback();
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const off_type offset = pos;
+        if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + offset, egptr());
+        return pos;
+    }
+};
+
+}  // namespace GNAPluginNS
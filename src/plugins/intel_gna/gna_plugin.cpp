@@ -1149,13 +1149,32 @@ void GNAPlugin::DumpXNNToFile() const {
 
 uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
     auto& nnets = gnaRequestConfigToRequestIdMap;
-    auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
-        return std::get<1>(item) == -1;
+    // the request slot whose GNA input memory holds the input blobs already doesn't need the frames to be copied
+    auto ownsInputBlobs = [&](size_t idx) {
+        for (auto &input : inputs) {
+            const auto& ptrs = inputs_ptr_->at(input.first).ptrs;
+            const void* buffer = input.second->cbuffer().as<const void*>();
+            if (std::find(ptrs.begin(), ptrs.end(), buffer) != ptrs.end() && ptrs[idx] != buffer) {
+                return false;
+            }
+        }
+        return true;
+    };
+    std::unique_lock<std::mutex> slotsLock{requestSlotsMutex};
+    auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [&](decltype(nnets.front()) & item) {
+        return std::get<1>(item) == -1 && ownsInputBlobs(&item - &nnets.front());
     });
+    if (freeNnet == nnets.end()) {
+        freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
+            return std::get<1>(item) == -1;
+        });
+    }
 
     if (freeNnet == nnets.end()) {
         if (!graphCompiler.memory_connection.empty()) {
+            slotsLock.unlock();
             Wait(0);
+            slotsLock.lock();
             freeNnet = nnets.begin();
         } else {
             IE_THROW(RequestBusy)
@@ -1166,6 +1185,21 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
 
     auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
+    // the slot is taken before its GNA memory is written, so the requests queued from the other threads
+    // meanwhile use the other slots, and it is given back if the request isn't queued
+    std::get<1>(*freeNnet) = RESERVED_REQUEST_ID;
+    slotsLock.unlock();
+    struct SlotRelease {
+        GNAPlugin& plugin;
+        decltype(freeNnet) slot;
+        bool queued;
+        ~SlotRelease() {
+            if (!queued) {
+                std::lock_guard<std::mutex> lock{plugin.requestSlotsMutex};
+                std::get<1>(*slot) = -1;
+            }
+        }
+    } slotRelease{*this, freeNnet, false};
 
     int inputNum = 0;
     for (auto &input : inputs) {
@@ -1221,6 +1255,12 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
                                   << ", but input blob size: " << importedBytes;
         }
 
+        if (input.second->cbuffer().as<const void *>() == inputs_ptr_->at(input.first).ptrs[idx]) {
+            // the user wrote the frames directly into GNA input memory
+            ++inputNum;
+            continue;
+        }
+
         ImportFrames(inputs_ptr_->at(input.first).ptrs[idx],
                      input.second->cbuffer().as<float *>(),
                      input.second->getTensorDesc().getPrecision(),
@@ -1249,17 +1289,15 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
         ++inputNum;
     }
     // If there is no gnadevice infer using reference FP32 transforamtions
+    int64_t requestId = 1;
     if (!gnadevice || trivialTopology) {
         auto runtime = runtime::FP(dnn);
         runtime.infer();
-        if (freeNnet != nnets.end()) {
-            std::get<1>(*freeNnet) = 1;
-        }
     } else {
         const auto reqConfigId = std::get<0>(*freeNnet);
         if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff)
             gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
-        std::get<1>(*freeNnet) = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
+        requestId = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
     }
 
 #ifdef PLOT
@@ -1269,9 +1307,12 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     dnn_dump_write_index++;
 #endif
-    if (freeNnet != nnets.end()) {
+    {
+        std::lock_guard<std::mutex> lock{requestSlotsMutex};
+        std::get<1>(*freeNnet) = requestId;
         // TODO: GNA2: Substitute properly when using GNA 2.0 Library setting and CPU
         std::get<2>(*freeNnet) = result;
+        slotRelease.queued = true;
     }
     return idx;
 }
@@ -1282,14 +1323,31 @@ bool GNAPlugin::Wait(uint32_t request_idx) {
 
 GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
     auto& nnets = gnaRequestConfigToRequestIdMap;
-    // TODO: GNA2: check whether necessary
-    if (nnets.size() <= request_idx) return GNA_REQUEST_COMPLETED;
+    int64_t requestId = -1;
+    {
+        std::lock_guard<std::mutex> lock{requestSlotsMutex};
+        // TODO: GNA2: check whether necessary
+        if (nnets.size() <= request_idx) return GNA_REQUEST_COMPLETED;
+        requestId = std::get<1>(nnets[request_idx]);
+    }
     // already synced TODO: might be copy required ???
-    if (std::get<1>(nnets[request_idx]) == -1) return GNA_REQUEST_COMPLETED;
-
+    if (requestId == -1) return GNA_REQUEST_COMPLETED;
+    // the frames of the request are still being imported by the other thread
+    if (requestId == RESERVED_REQUEST_ID) return GNA_REQUEST_PENDING;
+
+    // the slot is given back after its outputs are exported, so no other request overwrites them meanwhile
+    struct SlotRelease {
+        GNAPlugin& plugin;
+        uint32_t idx;
+        ~SlotRelease() {
+            std::lock_guard<std::mutex> lock{plugin.requestSlotsMutex};
+            std::get<1>(plugin.gnaRequestConfigToRequestIdMap[idx]) = -1;
+        }
+    };
     if (gnadevice && !trivialTopology) {
-        const auto waitStatus = gnadevice->wait(std::get<1>(nnets[request_idx]), millisTimeout);
+        const auto waitStatus = gnadevice->wait(static_cast<uint32_t>(requestId), millisTimeout);
         if (waitStatus == GNA_REQUEST_ABORTED) {
+            std::lock_guard<std::mutex> lock{requestSlotsMutex};
             std::get<1>(nnets[request_idx]) = -1;
             return GNA_REQUEST_ABORTED;
         }
@@ -1298,7 +1356,7 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
         }
     }
 
-    std::get<1>(nnets[request_idx]) = -1;
+    SlotRelease slotRelease{*this, request_idx};
     auto &request = std::get<2>(nnets[request_idx]);
 #ifdef PLOT
     if (dnn->num_components() != 0) {
@@ -1472,11 +1530,46 @@ Blob::Ptr GNAPlugin::GetInputBlob(const std::string& name, InferenceEngine::Prec
         THROW_GNA_EXCEPTION << "Input " << name << " isn't found";
     }
     auto inputDims = inputDataIt->second->getTensorDesc().getDims();
-    inputBlob = make_blob_with_precision(TensorDesc(precision, inputDims, GetLayoutForDims(inputDims)));
+    const TensorDesc desc(precision, inputDims, GetLayoutForDims(inputDims));
+    // each request slot gets at most one input blob placed in its GNA memory, so the requests never share the inputs
+    if (CanPlaceInputBlobInGnaMemory(name, desc)) {
+        auto& ptrs = inputs_ptr_->at(name).ptrs;
+        auto& slot = inputBlobsInGnaMemory[name];
+        if (slot < ptrs.size()) {
+            return make_shared_blob<int16_t>(desc, reinterpret_cast<int16_t*>(ptrs[slot++]));
+        }
+    }
+    inputBlob = make_blob_with_precision(desc);
     inputBlob->allocate();
     return inputBlob;
 }
 
+bool GNAPlugin::CanPlaceInputBlobInGnaMemory(const std::string& name, const InferenceEngine::TensorDesc& desc) {
+    // GNA memory of the inputs may be reused by the other layers in compact mode, the blob has to keep the frames
+    if (!gnadevice || trivialTopology || gnaFlags->sw_fp32 || gnaFlags->input_low_precision || gnaFlags->compact_mode) {
+        return false;
+    }
+    // the frames are copied without the conversion only from I16 blobs, the transposition changes them in place
+    if (desc.getPrecision() != Precision::I16 || transpose_inputs_info.count(name) != 0) {
+        return false;
+    }
+    const auto& inputs = inputs_ptr_->Get();
+    auto inputIt = std::find_if(inputs.begin(), inputs.end(), [&name](const InputDesc& input) {
+        return input.name == name;
+    });
+    if (inputIt == inputs.end() || inputIt->ptrs.empty() ||
+        std::find(inputIt->ptrs.begin(), inputIt->ptrs.end(), nullptr) != inputIt->ptrs.end()) {
+        return false;
+    }
+    // the interleaved frames are laid out in GNA memory differently than in the blob
+    const auto& dims = desc.getDims();
+    const bool singleFrame = dims.size() <= 1 || desc.getLayout() == Layout::CHW || dims[0] == 1;
+    if (inputIt->orientation != kDnnNonInterleavedOrientation && !singleFrame) {
+        return false;
+    }
+    return inputIt->tensor_precision == Precision::I16 && inputIt->num_elements >= details::product(dims);
+}
+
 std::vector<InferenceEngine::IVariableStateInternal::Ptr>  GNAPlugin::QueryState() {
     if (memoryStates.size() != graphCompiler.memory_connection.size()) {
         memoryStates.clear();
@@ -10,6 +10,7 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <tuple>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
@@ -45,6 +46,14 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     static constexpr uint32_t FAKE_REQUEST_CONFIG_ID = 0xffffffff;
     std::vector<std::tuple<dnn_ptr>> gnaModels;
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
+    /**
+     * @brief the request id of the slot taken by the request whose frames are being imported
+     */
+    static constexpr int64_t RESERVED_REQUEST_ID = -2;
+    /**
+     * @brief guards the states of the request slots, the requests are queued and waited outside of it
+     */
+    std::mutex requestSlotsMutex;
 
     uint32_t activeLayerIndex = 0xffffffff;
     TranspositionInfoMap transpose_inputs_info;
@@ -70,6 +79,10 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
 
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     bool trivialTopology = false;
+    /**
+     * @brief number of input blobs placed directly in GNA memory of the request slots, per input
+     */
+    std::map<std::string, uint32_t> inputBlobsInGnaMemory;
 
  public:
     explicit GNAPlugin(const std::map<std::string, std::string>& configMap);
@@ -133,6 +146,10 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     InferenceEngine::Blob::Ptr GetInputBlob(const std::string& name, InferenceEngine::Precision precision);
     InferenceEngine::Blob::Ptr GetOutputBlob(const std::string& name, InferenceEngine::Precision precision);
+    /**
+     * @brief checks whether the user input blob can be GNA input memory itself, so the frames aren't copied per inference
+     */
+    bool CanPlaceInputBlobInGnaMemory(const std::string& name, const InferenceEngine::TensorDesc& desc);
     /**
      * helpers to provide inputs info on AOT network
      */
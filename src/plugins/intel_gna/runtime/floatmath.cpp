@@ -7,6 +7,8 @@
 #include <cstdint>
 #include <cstdio>
 
+#include <ie_parallel.hpp>
+
 #include "floatmath.h"
 
 #ifdef __cplusplus
@@ -27,15 +29,23 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        // the rows of C are independent, the inner loop goes along the rows of B and C so it's vectorized,
+        // every element of C still sums the products in the order of k
+        InferenceEngine::parallel_for(M, [&](MKL_INT row) {
+            float *Crow = C + row * ldc;
+            if (beta != 1.0) {
+                for (MKL_INT col = 0; col < N; col++) {
+                    Crow[col] = 0;
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+            for (MKL_INT kk = 0; kk < K; kk++) {
+                const float a = A[row * lda + kk];
+                const float *Brow = B + kk * ldb;
+                for (MKL_INT col = 0; col < N; col++) {
+                    Crow[col] += a * Brow[col];
+                }
+            }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +115,22 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        InferenceEngine::parallel_for(L, [&](MKL_INT l) {
+            const MKL_INT row = OutputList[l];
+            float *Crow = C + l * ldc;
+            if (beta != 1.0) {
+                for (MKL_INT col = 0; col < N; col++) {
+                    Crow[col] = 0;
                 }
-                C[l * ldc + j] = sum;
             }
-        }
+            for (MKL_INT kk = 0; kk < K; kk++) {
+                const float a = A[row * lda + kk];
+                const float *Brow = B + kk * ldb;
+                for (MKL_INT col = 0; col < N; col++) {
+                    Crow[col] += a * Brow[col];
+                }
+            }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -467,6 +470,40 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
     return(pwl);
 }
 
+std::vector<pwl_t> pwl_search_cached(const DnnActivation& activation_type,
+                                     const double l_bound,
+                                     const double u_bound,
+                                     const double threshold,
+                                     const double allowed_err_pct,
+                                     const int samples,
+                                     double& err_pct) {
+    // only the pow activation has the arguments used by the search
+    using Key = std::tuple<DnnActivationType, float, float, float, double, double, double, double, int>;
+    const bool isPow = activation_type == kActPow;
+    const Key key{activation_type,
+                  isPow ? activation_type.args.pow.exponent : 0.0f,
+                  isPow ? activation_type.args.pow.scale : 0.0f,
+                  isPow ? activation_type.args.pow.offset : 0.0f,
+                  l_bound, u_bound, threshold, allowed_err_pct, samples};
+    static std::mutex cacheMutex;
+    static std::map<Key, std::pair<std::vector<pwl_t>, double>> cache;
+    constexpr size_t maxCacheSize = 256;
+    {
+        std::lock_guard<std::mutex> lock{cacheMutex};
+        auto found = cache.find(key);
+        if (found != cache.end()) {
+            err_pct = found->second.second;
+            return found->second.first;
+        }
+    }
+    auto pwl = pwl_search(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples, err_pct);
+    std::lock_guard<std::mutex> lock{cacheMutex};
+    if (cache.size() >= maxCacheSize) {
+        cache.clear();
+    }
+    cache.emplace(key, std::make_pair(pwl, err_pct));
+    return pwl;
+}
 
 void PwlDesignOpt(const DnnActivation& activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
@@ -487,7 +524,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < SIGMOID_DOMAIN) ? -absMax : -SIGMOID_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < SIGMOID_DOMAIN) ? absMax : SIGMOID_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -495,7 +532,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < TANH_DOMAIN) ? -absMax : -TANH_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < TANH_DOMAIN) ? absMax : TANH_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -503,7 +540,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < SOFTSIGN_DOMAIN) ? -absMax : -SOFTSIGN_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < SOFTSIGN_DOMAIN) ? absMax : SOFTSIGN_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -524,28 +561,28 @@ void PwlDesignOpt(const DnnActivation& activation_type,
         case kActLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActNegLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActNegHalfLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActExp: {
             double x_min = -log(scale_out);
             double x_max = x_min + log(INT16_MAX);
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -571,7 +608,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
 
             if (activation_type.args.pow.exponent != 0.0f) {
                 auto maxError = pwlMaxErrorPercent > 0.015f ? 0.015f: pwlMaxErrorPercent;
-                pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, maxError, PWL_DESIGN_SAMPLES, err_pct);
+                pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, maxError, PWL_DESIGN_SAMPLES, err_pct);
             }
 
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
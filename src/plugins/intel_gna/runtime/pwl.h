@@ -75,6 +75,18 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
                               const int samples,
                               double& err_pct);
 
+/**
+ * @brief pwl_search() memoized for the process, the layers and the networks with the same activation and bounds
+ * share the segments instead of searching them again
+ */
+std::vector<pwl_t> pwl_search_cached(const DnnActivation& activation_type,
+                                     const double l_bound,
+                                     const double u_bound,
+                                     const double threshold,
+                                     const double allowed_err_pct,
+                                     const int samples,
+                                     double& err_pct);
+
 bool split_search(const DnnActivationType fun,
                   const double l_bound,
                   const double u_bound);
@@ -39,6 +39,9 @@ struct network_output {
         return _result;
     }
 
+    /// @brief Returns @ref memory object of the output with no wait, the caller synchronizes with the execution.
+    memory::ptr get_result() const { return _result; }
+
 private:
     event::ptr _event;
     memory::ptr _result;
@@ -52,7 +55,8 @@ class primitive_inst;
 struct network {
 public:
     using ptr = std::shared_ptr<network>;
-    explicit network(program::ptr program, stream::ptr stream, bool is_internal = false, bool is_primary_stream = true);
+    explicit network(program::ptr program, stream::ptr stream, bool is_internal = false, bool is_primary_stream = true,
+                     std::shared_ptr<memory_pool> memory_pool = nullptr);
     network(engine& engine,
             const topology& topo,
             const build_options& options = build_options(),
@@ -66,6 +70,11 @@ public:
 
     network(program::ptr program, stream::ptr stream, uint16_t stream_id);
 
+    /// @brief Constructs the network which takes the intermediate buffers from the given @p memory_pool.
+    /// @details The networks sharing a pool must not be executed at the same time, e.g. they're enqueued to the same
+    /// in-order @p stream one by one.
+    network(program::ptr program, stream::ptr stream, std::shared_ptr<memory_pool> memory_pool, uint16_t stream_id);
+
     ~network();
 
 
@@ -171,7 +180,9 @@ public:
     void configure_primitives_second_output();
     void build_insts_deps();
     uint32_t get_id() const { return net_id; }
-    stream& get_stream() const { return *_stream; }
+    /// @brief Returns the stream the current primitive is enqueued to: one of the branch streams during the execution,
+    /// the network stream otherwise
+    stream& get_stream() const { return _active_stream ? *_active_stream : *_stream; }
     stream::ptr get_stream_ptr() const { return _stream; }
     bool is_internal() const { return _internal; }
     bool is_primary_stream() { return _is_primary_stream; }
@@ -187,12 +198,21 @@ public:
         return *_memory_pool;
     }
 
+    /// @brief The device memory blocks by the category, each block is keyed by its handle, so the buffers reused by
+    /// several primitives or shared by the networks of the same program are counted once
+    using memory_blocks = std::map<std::string, std::map<const void*, std::pair<allocation_type, size_t>>>;
+
+    /// @brief Adds the memory of the network to @p blocks: "weights" (the constant data), "activations" (the
+    /// intermediate outputs) and "scratchpad" (the internal buffers of the kernels). Returns the bytes of the inputs and
+    /// outputs, they're bound to the user buffers right before the execution, so only their layouts are counted
+    size_t get_memory_blocks(memory_blocks& blocks) const;
+
 private:
     using output_chains_map = std::map<primitive_id, std::vector<std::shared_ptr<primitive_inst>>>;
     uint32_t net_id = 0;
     program::ptr _program;
     stream::ptr _stream;
-    std::unique_ptr<memory_pool> _memory_pool;
+    std::shared_ptr<memory_pool> _memory_pool;
     bool _internal;
     bool _is_primary_stream;
     bool _reset_arguments;
@@ -206,7 +226,22 @@ private:
     std::unordered_map<primitive_id, event::ptr> _events;
     output_chains_map _output_chains;
 
+    // the independent branches are executed on the extra in-order streams, _branches maps the primitive to the index
+    // of its stream (0 is _stream), _branch_waits to the primitives of the other streams it waits for
+    std::vector<stream::ptr> _branch_streams;
+    std::unordered_map<primitive_id, size_t> _branches;
+    std::unordered_map<primitive_id, std::vector<primitive_id>> _branch_waits;
+    std::set<primitive_id> _branch_sync_points;
+    std::unordered_map<primitive_id, event::ptr> _branch_events;
+    stream* _active_stream = nullptr;
+
+    // the kernels are recorded into a command buffer of the stream and replayed, see engine_configuration
+    bool _recorded_execution = false;
+    bool _recording_valid = false;
+
     void build_exec_order();
+    void assign_branch_streams();
+    void check_recorded_execution();
     void allocate_primitive_instance(program_node const& node);
     void transfer_memory_to_device(std::shared_ptr<primitive_inst> instance, program_node const& node);
     void add_to_exec_order(const primitive_id& id);
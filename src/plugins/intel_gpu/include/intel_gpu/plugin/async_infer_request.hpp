@@ -19,6 +19,7 @@ public:
     AsyncInferRequest(const InferRequest::Ptr &inferRequest,
                       const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
+                      const InferenceEngine::ITaskExecutor::Ptr& preprocExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
 
     ~AsyncInferRequest();
@@ -29,6 +30,7 @@ public:
 private:
     InferRequest::Ptr _inferRequest;
     InferenceEngine::ITaskExecutor::Ptr _waitExecutor;
+    InferenceEngine::ITaskExecutor::Ptr _preprocExecutor;
 };
 
 }  // namespace intel_gpu
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include "ie_blob.h"
@@ -27,6 +28,7 @@ public:
 
     CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_ptr<InferenceEngine::RemoteContext> context, Config config);
 
+    void Export(std::ostream& networkModel) override;
     std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -38,11 +40,24 @@ public:
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
     std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
 
+    /**
+     * @brief Collects the ov::memory_statistics of the networks of all the streams, the peaks are the highest values
+     *        reported so far
+     */
+    std::map<std::string, uint64_t> GetMemoryStatistics() const;
+
+    // the transformed network, which is exported instead of the cldnn program
+    InferenceEngine::CNNNetwork m_network;
     std::vector<std::shared_ptr<Graph>> m_graphs;
     InferenceEngine::gpu::ClContext::Ptr m_context;
     Config m_config;
     InferenceEngine::ITaskExecutor::Ptr m_taskExecutor;
     InferenceEngine::ITaskExecutor::Ptr m_waitExecutor;
+    InferenceEngine::ITaskExecutor::Ptr m_preprocExecutor;
+
+private:
+    mutable std::mutex m_memoryPeaksMutex;
+    mutable std::map<std::string, uint64_t> m_memoryPeaks;
 };
 
 }  // namespace intel_gpu
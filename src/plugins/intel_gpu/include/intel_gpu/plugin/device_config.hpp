@@ -45,7 +45,13 @@ struct Config {
                                                     0,                                                                  // thread binding offset
                                                     1,                                                                  // # of threads
                                                     InferenceEngine::IStreamsExecutor::Config::ANY}),                   // preferred core type
-                                          enable_loop_unrolling(true) {
+                                          enable_loop_unrolling(true),
+                                          branch_queues(1),
+                                          executing_streams(0),
+                                          enable_dynamic_quantization(false),
+                                          recorded_execution(false),
+                                          use_level_zero(false),
+                                          kernel_trace_dir("") {
         adjustKeyMapValues();
     }
 
@@ -78,6 +84,12 @@ struct Config {
     InferenceEngine::IStreamsExecutor::Config task_exec_config;
 
     bool enable_loop_unrolling;
+    uint16_t branch_queues;
+    uint16_t executing_streams;
+    bool enable_dynamic_quantization;
+    bool recorded_execution;
+    bool use_level_zero;
+    std::string kernel_trace_dir;
 
     std::map<std::string, std::string> key_config_map;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
@@ -12,8 +12,10 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <atomic>
 #include "ie_blob.h"
 #include "cpp/ie_cnn_network.h"
 
@@ -39,14 +41,28 @@ public:
     };
     typedef std::shared_ptr<Graph> Ptr;
 
-    Graph(InferenceEngine::CNNNetwork& network, InferenceEngine::gpu::ClContext::Ptr context, Config config, uint16_t stream_id = 0);
-    explicit Graph(std::shared_ptr<Graph> graph, uint16_t stream_id = 0);
+    /**
+     * @brief The in-order queue and the intermediate buffers shared by the stream graphs which execute one at a time,
+     *        the queue and the pool are created by the first graph built in the group
+     */
+    struct ExecutionGroup {
+        using Ptr = std::shared_ptr<ExecutionGroup>;
+        cldnn::stream::ptr stream;
+        std::shared_ptr<cldnn::memory_pool> memory_pool;
+        std::mutex mutex;
+    };
+
+    Graph(InferenceEngine::CNNNetwork& network, InferenceEngine::gpu::ClContext::Ptr context, Config config, uint16_t stream_id = 0,
+          ExecutionGroup::Ptr execution_group = nullptr);
+    explicit Graph(std::shared_ptr<Graph> graph, uint16_t stream_id = 0, ExecutionGroup::Ptr execution_group = nullptr);
     std::shared_ptr<ngraph::Function> GetExecGraphInfo();
 
     bool IsLoaded() const;
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const;
     void UpdatePerfStatistics();
+    // writes the executed kernels of the last inference to a new Chrome trace file in the kernel_trace_dir
+    void DumpKernelTrace();
 
     const Config& getConfig() const { return m_config; }
     InferenceEngine::gpu::ClContext::Ptr GetContext() { return m_context; }
@@ -59,6 +75,8 @@ public:
     std::map<std::string, int64_t> GetOutputDynBatchDims() { return m_program->m_output_batch_dim; }
     size_t GetNetworksCount() const { return m_networks.size(); }
     std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0) const;
+    // the queue of the host input and output copies, so they overlap with the execution of the other requests
+    cldnn::stream::ptr GetCopyStream() const { return m_copy_stream; }
     InferenceEngine::SizeVector GetOutputSize(std::string outName) const;
     std::string MapOutputName(std::string outName) const;
     std::string getName() const { return m_networkName; }
@@ -77,6 +95,10 @@ public:
         m_cv.notify_one();
     }
     std::mutex& get_mutex() { return m_infer_mutex; }
+    // must be held from the enqueue to the end of the wait, so the graphs of the group don't overwrite the shared buffers
+    std::unique_lock<std::mutex> lock_execution() {
+        return m_execution_group ? std::unique_lock<std::mutex>(m_execution_group->mutex) : std::unique_lock<std::mutex>();
+    }
 
     bool use_external_queue() const;
 
@@ -100,8 +122,13 @@ protected:
 
     std::shared_ptr<Program> m_program;
     uint16_t m_stream_id;
+    ExecutionGroup::Ptr m_execution_group;
+    cldnn::stream::ptr m_copy_stream;
+    std::atomic<size_t> m_traceCounter{0};
 
-    std::shared_ptr<cldnn::network> BuildNetwork(std::shared_ptr<cldnn::program> program);
+    std::shared_ptr<cldnn::network> BuildNetwork(std::shared_ptr<cldnn::program> program,
+                                                 cldnn::stream::ptr stream = nullptr,
+                                                 std::shared_ptr<cldnn::memory_pool> memory_pool = nullptr);
     void Build();
     void UpdateLayersMaps();
     std::shared_ptr<ngraph::Function> GetExecGraphInfoByPrimitivesInfo(std::vector<cldnn::primitive_info>& pi,
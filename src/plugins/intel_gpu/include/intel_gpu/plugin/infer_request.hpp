@@ -53,6 +53,8 @@ public:
     void EnableStreams() { m_useStreams = true; }
 
     void setup_stream_graph();
+    // serializes the execution with the graphs sharing the intermediate buffers of the stream graph, held until wait()
+    std::unique_lock<std::mutex> lock_execution() { return m_graph->lock_execution(); }
     void preprocess_notify();
     void enqueue_notify();
     void wait_notify();
@@ -67,6 +69,9 @@ public:
 
     bool use_external_queue() const { return m_useExternalQueue; }
     void enable_external_queue() { m_useExternalQueue = true; }
+    // the host copies are done on the copy queue of the graph, so enqueue() and wait() may run in different stages
+    bool use_copy_stream() const { return m_useCopyStream; }
+    void enable_copy_stream() { m_useCopyStream = true; }
 
 private:
     InferenceEngine::BlobMap _deviceOutputs;
@@ -74,11 +79,16 @@ private:
     std::map<std::string, cldnn::primitive_id> outputsMap;
 
     std::map<std::string, std::vector<InferenceEngine::Blob::Ptr>> inputTensorsMap;
+    // the buffers over the host memory of the user input blobs which the integrated GPU reads with no copy
+    std::map<std::string, std::pair<const void*, cldnn::memory::ptr>> sharedHostInputs;
 
     bool m_useProfiling = false;
     bool m_useStreams = false;
     bool m_useExternalQueue = false;
+    bool m_useCopyStream = false;
     std::shared_ptr<Graph> m_graph;
+    // completes with the execution of the network on its queue, the outputs are read back after it on the copy queue
+    cldnn::event::ptr m_execution_done;
 
     // dynamic batch stuff
     std::map<std::string, std::vector<buf_info>> batchInputs;
@@ -93,6 +103,7 @@ private:
                                                 std::shared_ptr<InferenceEngine::IAllocator> alloc = nullptr);
     InferenceEngine::Blob::Ptr create_device_blob(const InferenceEngine::TensorDesc& desc, const cldnn::layout& layout);
 
+    cldnn::stream& get_copy_stream() const;
     void copy_output_data(cldnn::memory::ptr outputMemory, InferenceEngine::Blob::Ptr bptr, buf_info* bi = nullptr);
     void copy_input_data(std::shared_ptr<cldnn::network> network, const cldnn::primitive_id &inputName,
                          const cldnn::layout& inputLayout, const InferenceEngine::Blob &inputBlob,
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include "cpp/ie_cnn_network.h"
+
+namespace ov {
+namespace runtime {
+namespace intel_gpu {
+
+/**
+ * @brief Writes the network transformed by the plugin together with the precisions and the layouts of its inputs and
+ *        outputs, so the imported network is compiled with no transformations
+ */
+class NetworkSerializer {
+public:
+    explicit NetworkSerializer(std::ostream& ostream);
+    void operator<<(const InferenceEngine::CNNNetwork& network);
+
+private:
+    std::ostream& m_ostream;
+};
+
+class NetworkDeserializer {
+public:
+    using network_builder = std::function<InferenceEngine::CNNNetwork(const std::string& model,
+                                                                      const InferenceEngine::Blob::CPtr& weights)>;
+    NetworkDeserializer(std::istream& istream, network_builder builder);
+    void operator>>(InferenceEngine::CNNNetwork& network);
+
+private:
+    std::istream& m_istream;
+    network_builder m_builder;
+};
+
+}  // namespace intel_gpu
+}  // namespace runtime
+}  // namespace ov
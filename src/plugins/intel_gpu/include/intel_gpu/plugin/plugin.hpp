@@ -43,6 +43,8 @@ class Plugin : public InferenceEngine::IInferencePlugin,
     void RegisterPrimitives();
     void UpdateConfig(Config& conf, const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &params) const;
     void UpdateStatistics(const RemoteCLContext::Ptr& context) const;
+    RemoteCLContext::Ptr GetOrCreateDefaultContext(const Config& conf);
+    InferenceEngine::CNNNetwork ReadExportedNetwork(std::istream& networkModel) const;
 public:
     Plugin();
 
@@ -53,6 +55,13 @@ public:
                                                                         const std::shared_ptr<InferenceEngine::RemoteContext> &context,
                                                                         const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
+                                                                   const std::map<std::string, std::string>& config) override;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
+                                                                   const std::shared_ptr<InferenceEngine::RemoteContext>& context,
+                                                                   const std::map<std::string, std::string>& config) override;
+
     void SetConfig(const std::map<std::string, std::string> &config) override;
     std::string GetDeviceIDFromConfig(const std::map<std::string, std::string>& config) const;
     InferenceEngine::Parameter GetConfig(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
@@ -74,8 +83,8 @@ public:
     static PluginParams GetParams(const Config& config, const cldnn::device::ptr& dev,
                                   InferenceEngine::gpu_handle_param external_queue = nullptr) {
         PluginParams params;
-        params.engine_type = cldnn::engine_types::ocl;
-        params.runtime_type = cldnn::runtime_types::ocl;
+        params.engine_type = config.use_level_zero ? cldnn::engine_types::ze : cldnn::engine_types::ocl;
+        params.runtime_type = config.use_level_zero ? cldnn::runtime_types::ze : cldnn::runtime_types::ocl;
         if (external_queue) {
             params.queue_type = cldnn::stream::detect_queue_type(params.engine_type, external_queue);
         } else if (dev->get_info().supports_immad) {
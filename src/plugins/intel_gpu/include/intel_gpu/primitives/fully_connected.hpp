@@ -83,6 +83,12 @@ struct fully_connected : public primitive_base<fully_connected> {
     primitive_id bias;
     /// @brief Primitive dimension size.
     size_t input_size;
+    /// @brief Primitive id containing the per output feature scales of the int8 weights, which are kept compressed
+    /// in the memory and multiplied by the scales in the kernel. Empty if the weights aren't compressed.
+    primitive_id decompression_scale;
+    /// @brief Quantize the float input per row (token) to int8 on the fly and compute the int8 dot products with the
+    /// compressed weights, the output is dequantized with the row and the decompression scales.
+    bool dynamic_quantization = false;
 
 protected:
     std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override {
@@ -92,6 +98,9 @@ protected:
         if (!bias.empty())
             ret.push_back(bias);
 
+        if (!decompression_scale.empty())
+            ret.push_back(decompression_scale);
+
         return ret;
     }
 };
@@ -8,6 +8,7 @@
 
 #include "intel_gpu/runtime/compounds.hpp"
 #include "intel_gpu/runtime/layout.hpp"
+#include "intel_gpu/runtime/kernel_args.hpp"
 
 #include <algorithm>
 #include <string>
@@ -150,6 +151,8 @@ struct primitive_info {
     data_types runtime_precision;
     bool is_cpu;
     int exec_id;
+    std::vector<work_group_sizes> work_groups;  ///< The global and local sizes of each kernel of the implementation
+    size_t memory_bytes = 0;                    ///< The bytes of the inputs and the output the primitive reads and writes
 };
 
 #define CLDNN_DEFINE_TYPE_ID(PType)     \
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Performs the attention of the transformer blocks.
+/// @details Equation: output = softmax(scale * query x key^T) x value along the last axis, where
+/// query is (B, H, S_q, D), key is (B, H, S_kv, D), value is (B, H, S_kv, D_v) and output is (B, H, S_q, D_v)
+/// in the bfyx order. The (B, H, S_q, S_kv) attention weights are never written to the memory.
+struct scaled_dot_product_attention : public primitive_base<scaled_dot_product_attention> {
+    CLDNN_DECLARE_PRIMITIVE(scaled_dot_product_attention)
+
+    /// @brief Constructs scaled_dot_product_attention primitive.
+    /// @param id This primitive id.
+    /// @param inputs Query, key and value primitive ids.
+    /// @param scale The scale of the query x key^T products.
+    scaled_dot_product_attention(const primitive_id& id,
+                                 const std::vector<primitive_id>& inputs,
+                                 const float scale = 1.0f,
+                                 const primitive_id& ext_prim_id = "",
+                                 const padding& output_padding = padding())
+        : primitive_base(id, inputs, ext_prim_id, output_padding),
+          scale(scale) {
+        if (inputs.size() != 3) {
+            throw std::invalid_argument("Invalid inputs count - scaled_dot_product_attention expects query, key and value");
+        }
+    }
+
+    /// @brief The scale of the query x key^T products.
+    float scale;
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
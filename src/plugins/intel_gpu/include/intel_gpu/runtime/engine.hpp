@@ -65,6 +65,15 @@ public:
     /// Create shared memory object using user-supplied USM pointer @p usm_ptr using specified @p layout
     memory_ptr share_usm(const layout& layout, shared_handle usm_ptr);
 
+    /// Create shared memory object which the device accesses in the user-supplied host memory @p ptr using specified @p layout
+    /// @note The memory is used with no copy if it's aligned as @ref can_share_host_ptr() requires
+    /// User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+    memory_ptr share_host_ptr(const layout& layout, void* ptr);
+
+    /// Returns true if the device accesses the host memory @p ptr of @p size bytes with no copy, i.e. the device is
+    /// integrated and the memory is aligned to the page and its size to the cache line
+    bool can_share_host_ptr(const void* ptr, size_t size) const;
+
     /// Create shared memory object using user-supplied 2D image @p img using specified @p layout
     memory_ptr share_image(const layout& layout, shared_handle img);
 
@@ -128,6 +137,10 @@ public:
     /// Creates stream object from user handle
     virtual stream_ptr create_stream(void *handle) const = 0;
 
+    /// Creates stream object which collects the profiling info of the kernels even if the profiling is disabled in
+    /// engine config, e.g. to measure the candidate kernels during the tuning
+    virtual stream_ptr create_profiling_stream() const = 0;
+
     /// Returns service stream which can be used during program build and optimizations
     virtual stream& get_program_stream() const = 0;
 
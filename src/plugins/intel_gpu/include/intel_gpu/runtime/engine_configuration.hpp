@@ -22,11 +22,13 @@ namespace cldnn {
 /// @brief Defines available engine types
 enum class engine_types : int32_t {
     ocl,
+    ze,  ///< Level Zero, available if the plugin is built with ENABLE_INTEL_GPU_LEVEL_ZERO
 };
 
 /// @brief Defines available runtime types
 enum class runtime_types : int32_t {
     ocl,
+    ze,
 };
 
 /// @brief Defines available priority mode types
@@ -70,6 +72,8 @@ struct engine_configuration {
     uint16_t throughput_streams;              ///< Number of queues/streams executed in parallel by GPU plugin
 
     const std::string tuning_cache_path;      ///< Path to tuning kernel cache
+    uint16_t branch_queues;                   ///< Number of in-order queues the independent branches of a network are executed on
+    bool recorded_execution;                  ///< Records the kernels of a network into a command buffer once and replays it
 
     /// @brief Constructs engine configuration with specified options.
     /// @param enable_profiling Enable per-primitive profiling.
@@ -103,7 +107,9 @@ struct engine_configuration {
         , use_unified_shared_memory(use_unified_shared_memory)
         , kernels_cache_path(kernels_cache_path)
         , throughput_streams(throughput_streams)
-        , tuning_cache_path(tuning_cache_path) { }
+        , tuning_cache_path(tuning_cache_path)
+        , branch_queues(1)
+        , recorded_execution(false) { }
 };
 
 /// @}
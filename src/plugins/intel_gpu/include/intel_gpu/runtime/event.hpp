@@ -37,6 +37,9 @@ public:
 
     std::vector<instrumentation::profiling_interval> get_profiling_info();
 
+    // returns false if the event has no device timestamps, e.g. it isn't profiled or is executed on the host
+    virtual bool get_device_timestamps(instrumentation::device_timestamps&) { return false; }
+
 private:
     std::mutex _handlers_mutex;
     std::list<std::pair<event_handler, void*>> _handlers;
@@ -74,6 +74,7 @@ struct argument_desc {
         WEIGHTS_ZERO_POINTS,
         ACTIVATIONS_ZERO_POINTS,
         COMPENSATION,
+        DECOMPRESSION_SCALE,
         INPUT_OF_FUSED_PRIMITIVE
     };
 
@@ -105,6 +106,7 @@ struct kernel_arguments_data {
     memory::cptr weights_zero_points;
     memory::cptr activations_zero_points;
     memory::cptr compensation;
+    memory::cptr decompression_scale;
     memory::cptr lookup_table;
     memory::cptr scale_table;
     memory::cptr slope;
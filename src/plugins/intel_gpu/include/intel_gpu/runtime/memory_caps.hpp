@@ -77,7 +77,10 @@ enum class shared_mem_type {
     shared_mem_dxbuffer,
 
     /// @brief Structure describes shared USM memory.
-    shared_mem_usm
+    shared_mem_usm,
+
+    /// @brief Structure describes the host memory the device accesses with no copy.
+    shared_mem_host_ptr
 };
 
 using shared_handle = void*;
@@ -78,8 +78,11 @@ struct padded_pool_comparer {
 //         * no: goto 4
 //     4 take next (allocations are sorted in increasing order) allocation. if there is no more allocations, create new
 //     allocation otherwise go t
-// - padded buffers - not implemented yet
-// - images 2d - not implemented yet
+// - padded buffers -
+//     same as the non padded buffers, but the allocations are grouped by the layout, and the allocation is reused only
+//     if its padding is the same and its batch and feature sizes are not smaller than the requested ones
+// - images 2d -
+//     the image dimensions are fixed, so the allocation is reused only by the requests of the same layout
 // - images 2d arrays - not implemented yet
 // - immutable - if user request for non reusable resource don't use pool, return
 
@@ -95,6 +98,7 @@ class memory_pool {
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout, std::list<memory_record>, padded_pool_comparer> _padded_pool;
+    std::map<layout, std::list<memory_record>, padded_pool_comparer> _image_pool;
     std::multimap<uint64_t, memory_record> _no_reusable_pool;
     engine* _engine;
 
@@ -118,6 +122,11 @@ public:
                                     uint32_t network_id,
                                     const std::set<primitive_id>& restrictions,
                                     allocation_type type);
+    memory_ptr get_from_image_pool(const layout& layout,
+                                   const primitive_id& id,
+                                   uint32_t network_id,
+                                   const std::set<primitive_id>& restrictions,
+                                   allocation_type type);
     memory_ptr get_from_across_networks_pool(const layout& layout,
                                              const primitive_id& id,
                                              uint32_t network_id,
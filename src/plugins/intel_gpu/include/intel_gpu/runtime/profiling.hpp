@@ -5,6 +5,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
@@ -69,6 +70,14 @@ struct profiling_interval {
     std::shared_ptr<profiling_period> value;  ///< @brief Interval value.
 };
 
+/// @brief Device clock timestamps of a command in nanoseconds, the points the profiling stages are measured between.
+struct device_timestamps {
+    uint64_t queued = 0;  ///< @brief The command is enqueued by the host.
+    uint64_t submit = 0;  ///< @brief The command is submitted to the device.
+    uint64_t start = 0;   ///< @brief The command starts the execution.
+    uint64_t end = 0;     ///< @brief The command finishes the execution.
+};
+
 /// @brief Represents list of @ref profiling_interval
 struct profiling_info {
     std::string name;                           ///< @brief Display name.
@@ -34,6 +34,17 @@ public:
                                       bool is_output_event = false) = 0;
     virtual event::ptr enqueue_marker(std::vector<event::ptr> const& deps, bool is_output_event = false) = 0;
     virtual void enqueue_barrier() = 0;
+    /// @brief Makes the commands enqueued later wait for the events, which may come from the other streams of the engine
+    virtual void enqueue_barrier(std::vector<event::ptr> const& deps) = 0;
+    /// @brief Returns the event completed when all the commands enqueued so far are done, whatever the sync method is
+    virtual event::ptr enqueue_full_marker() = 0;
+
+    /// @brief Starts recording the kernels enqueued to the stream instead of executing them
+    /// @return false if the recording is not supported, then the kernels are executed as usual
+    virtual bool begin_recording() = 0;
+    virtual void end_recording() = 0;
+    /// @brief Executes the kernels recorded the last time
+    virtual event::ptr enqueue_recording() = 0;
     virtual event::ptr group_events(std::vector<event::ptr> const& deps) = 0;
     virtual void wait_for_events(const std::vector<event::ptr>& events) = 0;
     virtual event::ptr create_user_event(bool set) = 0;
@@ -121,6 +121,10 @@ std::string fully_connected_inst::to_string(fully_connected_node const& node) {
     json_composite fc_info;
     fc_info.add("weights id", weights_id);
     fc_info.add("bias id", bias_id);
+    if (!desc->decompression_scale.empty())
+        fc_info.add("decompression scale id", desc->decompression_scale);
+    if (desc->dynamic_quantization)
+        fc_info.add("dynamic quantization", true);
 
     node_info->add("fully connected info", fc_info);
     node_info->dump(primitive_description);
@@ -43,6 +43,10 @@
 #include "embedding_bag_inst.h"
 #include "extract_image_patches_inst.h"
 #include "reduce_inst.h"
+#include "scaled_dot_product_attention_inst.h"
+#include "data_inst.h"
+#include "kernel_selector_helper.h"
+#include "scaled_dot_product_attention/scaled_dot_product_attention_kernel_opt.h"
 #include <vector>
 #include <map>
 #include <list>
@@ -56,6 +60,7 @@ void prepare_primitive_fusing::run(program& p) {
     fuse_reorders(p);
     remove_redundant_reshape(p);
     fuse_sigmoid_mul_to_swish(p);
+    fuse_attention(p);
     fuse_bias(p);
     fuse_simple_primitives(p);
     fuse_activations(p);
@@ -146,6 +151,127 @@ void prepare_primitive_fusing::fuse_sigmoid_mul_to_swish(program &p) {
     }
 }
 
+void prepare_primitive_fusing::fuse_attention(program &p) {
+    auto get_scalar = [&p](data_node& node, float& value) -> bool {
+        auto mem = node.get_attached_memory_ptr();
+        switch (mem->get_layout().data_type) {
+            case data_types::f32: {
+                mem_lock<float, mem_lock_type::read> lock(mem, p.get_stream());
+                value = lock.data()[0];
+                return true;
+            }
+            case data_types::f16: {
+                mem_lock<uint16_t, mem_lock_type::read> lock(mem, p.get_stream());
+                value = half_to_float(lock.data()[0]);
+                return true;
+            }
+            default:
+                return false;
+        }
+    };
+
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        if (node->is_output())
+            continue;
+
+        // softmax(scale * query x key^T) x value is replaced with one primitive, so the attention weights are
+        // not written to the memory
+        program_helpers::do_for_types<gemm>(*node, [&p, &get_scalar](gemm_node& node) {
+            auto& sv_gemm = node;
+            auto sv_desc = sv_gemm.get_primitive();
+            if (sv_gemm.inputs_count() != 2 || sv_desc->transpose_input0 || sv_desc->transpose_input1 ||
+                sv_desc->alpha != 1.0f || !sv_gemm.input(0).is_type<softmax>())
+                return;
+
+            auto& sm = sv_gemm.input(0).as<softmax>();
+            if (sm.get_primitive()->dimension != softmax::normalize_x || sm.is_output() || sm.get_users().size() != 1)
+                return;
+
+            float scale = 1.0f;
+            program_node* scores = &sm.input();
+            program_node* scale_mul = nullptr;
+            program_node* scale_data = nullptr;
+            if (scores->is_type<eltwise>()) {
+                auto& mul = scores->as<eltwise>();
+                if (mul.get_primitive()->mode != eltwise_mode::prod || mul.get_dependencies().size() != 2 ||
+                    mul.is_output() || mul.get_users().size() != 1)
+                    return;
+
+                size_t scale_idx = mul.get_dependency(1).is_type<data>() ? 1 : 0;
+                scale_data = &mul.get_dependency(scale_idx);
+                if (!scale_data->is_type<data>() || scale_data->get_output_layout().count() != 1 ||
+                    !get_scalar(scale_data->as<data>(), scale))
+                    return;
+
+                scale_mul = &mul;
+                scores = &mul.get_dependency(1 - scale_idx);
+            }
+
+            if (!scores->is_type<gemm>() || scores->is_output() || scores->get_users().size() != 1)
+                return;
+
+            auto& qk_gemm = scores->as<gemm>();
+            auto qk_desc = qk_gemm.get_primitive();
+            if (qk_gemm.inputs_count() != 2 || qk_desc->transpose_input0 || !qk_desc->transpose_input1)
+                return;
+            scale *= qk_desc->alpha;
+
+            auto& query = qk_gemm.input(0);
+            auto& key = qk_gemm.input(1);
+            auto& value = sv_gemm.input(1);
+            auto query_layout = query.get_output_layout();
+            auto data_type = sv_gemm.get_output_layout().data_type;
+            if (!data_type_traits::is_floating_point(data_type))
+                return;
+
+            for (auto input : { &query, &key, &value }) {
+                auto input_layout = input->get_output_layout();
+                if (input_layout.data_type != data_type || input_layout.format.dimension() != 4)
+                    return;
+            }
+
+            // the gemms are replaced only if the attention kernel supports the shapes, e.g. the batch and the heads
+            // of all inputs must match, since the kernel doesn't broadcast them, and the head fits the local memory
+            const auto max_local_mem_size = p.get_engine().get_device_info().max_local_mem_size;
+            if (!kernel_selector::ScaledDotProductAttentionKernelOpt::SupportsInputs(convert_data_tensor(query_layout),
+                                                                                    convert_data_tensor(key.get_output_layout()),
+                                                                                    convert_data_tensor(value.get_output_layout()),
+                                                                                    max_local_mem_size))
+                return;
+
+            auto sdpa_prim = std::make_shared<scaled_dot_product_attention>(sv_gemm.id() + "_sdpa",
+                                                                            std::vector<primitive_id>{ query.id(), key.id(), value.id() },
+                                                                            scale);
+            auto& sdpa = p.get_or_create(sdpa_prim);
+
+            std::vector<program_node*> fused_nodes = { &qk_gemm, &sm, &sv_gemm };
+            if (scale_mul)
+                fused_nodes.push_back(scale_mul);
+            for (auto fused_node : fused_nodes)
+                p.add_optimized_primitive_info(fused_node->id(), {sdpa.id()});
+
+            p.add_connection(query, sdpa);
+            p.add_connection(key, sdpa);
+            p.add_connection(value, sdpa);
+            p.get_processing_order().insert(&sv_gemm, &sdpa);
+            p.replace_all_usages(sv_gemm, sdpa);
+
+            for (auto fused_node : fused_nodes)
+                p.remove_all_connections(*fused_node);
+            for (auto fused_node : fused_nodes)
+                p.remove_if_dangling(*fused_node);
+            if (scale_data)
+                p.remove_if_dangling(*scale_data);
+
+            sdpa.calc_output_layout();
+        });
+    }
+}
+
 void prepare_primitive_fusing::fuse_reorders(program &p) {
     // This loop tries fusing several reorders one by one (if present) into one reorder
     auto itr = p.get_processing_order().begin();
@@ -190,7 +316,9 @@ void prepare_primitive_fusing::fuse_activations(program &p) {
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     auto& engine = p.get_engine();
-    if (engine.get_device_info().supports_immad && engine.configuration().queue_type == queue_types::in_order)
+    // oneDNN runs on the OpenCL queues only
+    if (engine.type() == engine_types::ocl && engine.get_device_info().supports_immad &&
+        engine.configuration().queue_type == queue_types::in_order)
         use_onednn_impls = true;
 #endif
 
@@ -449,6 +577,8 @@ void prepare_primitive_fusing::fuse_bias(program &p) {
                                                                        desc->weights,
                                                                        bias_name,
                                                                        fc.get_output_layout().data_type);
+            fc_with_bias_prim->decompression_scale = desc->decompression_scale;
+            fc_with_bias_prim->dynamic_quantization = desc->dynamic_quantization;
 
             auto& new_fc_node = p.get_or_create(fc_with_bias_prim);
             fuse_bias_f(fc, new_fc_node, bias_node, eltw_node);
@@ -35,6 +35,7 @@ protected:
 
         args.weights = instance.weights_memory();
         args.bias = instance.bias_term() ? instance.bias_memory() : nullptr;
+        args.decompression_scale = instance.decompression_scale_term() ? instance.decompression_scale_memory() : nullptr;
 
         return args;
     }
@@ -52,6 +53,12 @@ public:
         if (primitive->input_size != 3)
             fc_params.output = fc_params.output.FlattenFeatureAndSpatials();
 
+        if (arg.decompression_scale_term()) {
+            fc_params.decompression_scale.push_back(
+                convert_data_tensor(arg.decompression_scale().get_output_layout()).FlattenFeatureAndSpatials());
+        }
+        fc_params.dynamic_quantization = primitive->dynamic_quantization;
+
         bool is_quantized = true;
         for (auto& input : arg.get_dependencies())
             is_quantized &= data_type_traits::is_quantized(input->get_output_layout().data_type);
@@ -67,6 +74,11 @@ public:
 
         auto& kernel_selector = kernel_selector::fully_connected_kernel_selector::Instance();
         auto best_kernels = kernel_selector.GetBestKernels(fc_params, fc_optional_params);
+        if (best_kernels.empty() && fc_params.dynamic_quantization) {
+            // the device or the shapes don't fit the dynamic quantization kernel, so the weights are decompressed
+            fc_params.dynamic_quantization = false;
+            best_kernels = kernel_selector.GetBestKernels(fc_params, fc_optional_params);
+        }
 
         CLDNN_ERROR_BOOL(arg.id(),
                          "Best_kernel.empty()",
@@ -60,6 +60,13 @@ struct typed_primitive_impl_ocl : public typed_primitive_impl<PType> {
 
     bool is_cpu() const override { return false; }
 
+    std::vector<work_group_sizes> get_work_groups() const override {
+        std::vector<work_group_sizes> work_groups;
+        for (auto& kernel : _kernel_data.kernels)
+            work_groups.push_back(kernel.params.workGroups);
+        return work_groups;
+    }
+
 protected:
     virtual bool optimized_out(typed_primitive_inst<PType>&) const { return false; }
 
@@ -67,6 +67,7 @@
 #include "intel_gpu/primitives/grn.hpp"
 #include "intel_gpu/primitives/ctc_greedy_decoder.hpp"
 #include "intel_gpu/primitives/convert_color.hpp"
+#include "intel_gpu/primitives/scaled_dot_product_attention.hpp"
 #include "generic_layer.hpp"
 
 
@@ -152,6 +153,7 @@ REGISTER_OCL(cum_sum);
 REGISTER_OCL(embedding_bag);
 REGISTER_OCL(extract_image_patches);
 REGISTER_OCL(convert_color);
+REGISTER_OCL(scaled_dot_product_attention);
 
 #undef REGISTER_OCL
 
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_inst.h"
+#include "primitive_base.hpp"
+#include "impls/implementation_map.hpp"
+#include "kernel_selector_helper.h"
+#include "scaled_dot_product_attention/scaled_dot_product_attention_kernel_selector.h"
+#include "scaled_dot_product_attention/scaled_dot_product_attention_kernel_opt.h"
+#include "intel_gpu/runtime/error_handler.hpp"
+
+namespace cldnn {
+namespace ocl {
+
+struct scaled_dot_product_attention_impl : typed_primitive_impl_ocl<scaled_dot_product_attention> {
+    using parent = typed_primitive_impl_ocl<scaled_dot_product_attention>;
+    using parent::parent;
+
+    std::unique_ptr<primitive_impl> clone() const override {
+        return make_unique<scaled_dot_product_attention_impl>(*this);
+    }
+
+public:
+    static primitive_impl* create(const scaled_dot_product_attention_node& arg) {
+        auto sdpa_params = get_default_params<kernel_selector::scaled_dot_product_attention_params>(arg);
+        auto sdpa_optional_params =
+            get_default_optional_params<kernel_selector::scaled_dot_product_attention_optional_params>(arg.get_program());
+
+        sdpa_params.inputs.push_back(convert_data_tensor(arg.key().get_output_layout()));
+        sdpa_params.inputs.push_back(convert_data_tensor(arg.value().get_output_layout()));
+        sdpa_params.scale = arg.get_primitive()->scale;
+
+        auto& kernel_selector = kernel_selector::scaled_dot_product_attention_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(sdpa_params, sdpa_optional_params);
+
+        CLDNN_ERROR_BOOL(arg.id(),
+                         "Best_kernel.empty()",
+                         best_kernels.empty(),
+                         "Cannot find a proper kernel with this arguments");
+
+        return new scaled_dot_product_attention_impl(arg, best_kernels[0]);
+    }
+};
+
+namespace detail {
+
+attach_scaled_dot_product_attention_impl::attach_scaled_dot_product_attention_impl() {
+    implementation_map<scaled_dot_product_attention>::add(impl_types::ocl, scaled_dot_product_attention_impl::create, {
+        std::make_tuple(data_types::f16, format::bfyx),
+        std::make_tuple(data_types::f32, format::bfyx),
+    });
+}
+
+}  // namespace detail
+}  // namespace ocl
+}  // namespace cldnn
@@ -142,7 +142,24 @@ protected:
         return weights_reorder_params;
     }
 
-    static std::shared_ptr<dnnl::convolution_forward::desc> get_convolution_descriptor(const convolution_node& arg) {
+    // oneDNN picks Winograd instead of the implicit GEMM for the configurations it has the Winograd kernels for, the
+    // transformed weights are made by the weights reorder at the program build, as for any other weights format
+    static dnnl::algorithm get_convolution_algorithm(const convolution_node& arg) {
+        auto prim = arg.get_primitive();
+        auto input_layout = arg.get_dependency(0).get_output_layout();
+        auto weights_layout = arg.get_dependency(1).get_output_layout();
+        bool is_2d = input_layout.format.spatial_num() == 2;
+        bool is_3x3 = weights_layout.size.spatial[0] == 3 && weights_layout.size.spatial[1] == 3;
+        bool unit_stride = prim->stride.spatial[0] == 1 && prim->stride.spatial[1] == 1;
+        bool unit_dilation = prim->dilation.spatial[0] == 1 && prim->dilation.spatial[1] == 1;
+        bool winograd_candidate = input_layout.data_type == data_types::f16 && arg.get_output_layout().data_type == data_types::f16 &&
+                                  is_2d && is_3x3 && unit_stride && unit_dilation && prim->groups == 1 &&
+                                  !format::is_grouped(weights_layout.format) && !prim->grouped_weights_shape;
+        return winograd_candidate ? dnnl::algorithm::convolution_auto : dnnl::algorithm::convolution_direct;
+    }
+
+    static std::shared_ptr<dnnl::convolution_forward::desc> get_convolution_descriptor(const convolution_node& arg,
+                                                                                      dnnl::algorithm algorithm) {
         auto prim = arg.get_primitive();
 
         auto& input = arg.get_dependency(0);
@@ -173,7 +190,7 @@ protected:
             auto bias_md = onednn::layout_to_memory_desc(arg.get_dependency(2).get_output_layout(), dnnl::memory::format_tag::any, true);
             return std::make_shared<dnnl::convolution_forward::desc>(
                 dnnl::prop_kind::forward_inference,
-                dnnl::algorithm::convolution_direct,
+                algorithm,
                 input_md,
                 weights_md,
                 bias_md,
@@ -185,7 +202,7 @@ protected:
         } else {
             return std::make_shared<dnnl::convolution_forward::desc>(
                 dnnl::prop_kind::forward_inference,
-                dnnl::algorithm::convolution_direct,
+                algorithm,
                 input_md,
                 weights_md,
                 output_md,
@@ -199,11 +216,24 @@ protected:
 public:
     static primitive_impl* create(const convolution_node& arg) {
         auto& engine = arg.get_program().get_engine();
-        auto desc = get_convolution_descriptor(arg);
+        auto algorithm = get_convolution_algorithm(arg);
+        auto desc = get_convolution_descriptor(arg, algorithm);
         auto attr = get_primitive_attributes(arg);
         dnnl::primitive_desc prim_desc{&desc->data, attr.get(), engine.get_onednn_engine(), nullptr};
 
-        return new convolution_onednn(arg, desc, attr, prim_desc, get_weights_reorder(arg, prim_desc));
+        kernel_selector::WeightsReorderParams weights_reorder;
+        try {
+            weights_reorder = get_weights_reorder(arg, prim_desc);
+        } catch (const std::runtime_error&) {
+            if (algorithm == dnnl::algorithm::convolution_direct)
+                throw;
+            // the weights format of the picked Winograd kernel has no clDNN counterpart, so the direct one is taken
+            desc = get_convolution_descriptor(arg, dnnl::algorithm::convolution_direct);
+            prim_desc = dnnl::primitive_desc{&desc->data, attr.get(), engine.get_onednn_engine(), nullptr};
+            weights_reorder = get_weights_reorder(arg, prim_desc);
+        }
+
+        return new convolution_onednn(arg, desc, attr, prim_desc, weights_reorder);
     }
 };
 
@@ -22,7 +22,9 @@ public:
     program_node& input() const { return get_dependency(0); }
     program_node& weights() const { return get_dependency(1); }
     program_node& bias() const { return get_dependency(2); }
+    program_node& decompression_scale() const { return get_dependency(2 + bias_term()); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
+    bool decompression_scale_term() const { return !get_primitive()->decompression_scale.empty(); }
 };
 
 using fully_connected_node = typed_program_node<fully_connected>;
@@ -40,8 +42,10 @@ public:
 
     memory::ptr weights_memory() const { return dep_memory_ptr(1); }
     memory::ptr bias_memory() const { return dep_memory_ptr(2); }
+    memory::ptr decompression_scale_memory() const { return dep_memory_ptr(2 + bias_term()); }
 
     bool bias_term() const { return !argument.bias.empty(); }
+    bool decompression_scale_term() const { return !argument.decompression_scale.empty(); }
 };
 
 using fully_connected_inst = typed_primitive_inst<fully_connected>;
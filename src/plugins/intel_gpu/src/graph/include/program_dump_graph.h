@@ -16,5 +16,6 @@ std::string get_serialization_network_name(build_options);
 void dump_graph_optimized(std::ofstream&, const program&);
 void dump_graph_processing_order(std::ofstream&, const program&);
 void dump_graph_init(std::ofstream&, const program&, std::function<bool(program_node const&)> const&);
+void dump_graph_impls(std::ofstream&, const program&);
 void dump_graph_info(std::ofstream&, const program&, std::function<bool(program_node const&)> const&);
 }  // namespace cldnn
@@ -162,7 +162,8 @@ void kernel_runner::prepare_kernel_args(const kernel_selector::KernelsData& kern
 std::vector<std::chrono::nanoseconds> kernel_runner::run_kernels(const kernel_selector::KernelsData& kernels_data) {
     std::vector<std::chrono::nanoseconds> run_times;
 
-    stream::ptr stream = _engine.create_stream();
+    // the own profiling queue measures the kernels, so the engine doesn't need the profiling for the tuning
+    stream::ptr stream = _engine.create_profiling_stream();
 
     int num_of_kernels_to_run = static_cast<int>(kernels_data.size());
     int num_of_kernels_run = 0;
@@ -876,4 +876,5 @@ void set_optional_params(const program& program, kernel_selector::optional_param
     const auto& tuning_config = program.get_options().get<build_option_type::tuning_config>();
     params.tuningParams.mode = to_tuning_mode(tuning_config->config.mode);
     params.tuningParams.cacheFilePath = tuning_config->config.cache_file_path;
+    params.selectionCacheDir = program.get_engine().configuration().kernels_cache_path;
 }
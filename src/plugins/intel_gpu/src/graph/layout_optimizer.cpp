@@ -1025,6 +1025,11 @@ layout layout_optimizer::get_expected_layout(layout const& current_layout,
             } else {
                 expected_format = cldnn::format::bs_fs_yx_bsv16_fsv16;
             }
+        } else if ((output_layout.data_type == data_types::f16 || output_layout.data_type == data_types::f32) &&
+                   input_layout.format.spatial_num() == 3 && (non_grouped || is_dw)) {
+            // the planar 3D layout would take the generic clDNN kernels, the blocked one has the oneDNN implicit GEMM
+            expected_tensor = current_layout.size;
+            expected_format = cldnn::format::b_fs_zyx_fsv16;
         } // TODO: add this case when corresponding fsv32 optimizations inside clDNN will be implemented
         //else if (input_layout.data_type == data_types::f32 && i8_u8_output && !is_first_conv && is_2d) {
         //    if (input_layout.size.batch[0] % 16 == 0) {
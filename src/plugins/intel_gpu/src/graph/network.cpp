@@ -239,10 +239,11 @@ static void wait_for_the_turn() {
 Network will always have net_id = 0 when it will be cldnn internal micronetwork (created i.e by propagate_constants
 opt pass).
 */
-network::network(program::ptr program, stream::ptr stream, bool is_internal, bool is_primary_stream)
+network::network(program::ptr program, stream::ptr stream, bool is_internal, bool is_primary_stream,
+                 std::shared_ptr<memory_pool> memory_pool)
     : _program(program)
     , _stream(stream)
-    , _memory_pool(new memory_pool(program->get_engine()))
+    , _memory_pool(memory_pool ? memory_pool : std::make_shared<cldnn::memory_pool>(program->get_engine()))
     , _internal(is_internal)
     , _is_primary_stream(is_primary_stream)
     , _reset_arguments(true) {
@@ -261,6 +262,8 @@ network::network(program::ptr program, stream::ptr stream, bool is_internal, boo
     check_names();
     build_insts_deps();
     build_exec_order();
+    assign_branch_streams();
+    check_recorded_execution();
     validate_primitives();
     add_default_output_chains();
 }
@@ -283,6 +286,9 @@ network::network(program::ptr program, uint16_t stream_id)
 network::network(program::ptr program, stream::ptr stream, uint16_t stream_id)
     : network(program, stream, false, stream_id == 0) {}
 
+network::network(program::ptr program, stream::ptr stream, std::shared_ptr<memory_pool> memory_pool, uint16_t stream_id)
+    : network(program, stream, false, stream_id == 0, memory_pool) {}
+
 network::~network() {
     _memory_pool->clear_pool_for_network(net_id);
 }
@@ -359,7 +365,10 @@ void network::set_input_data(const primitive_id& id, memory::ptr data) {
 
     // Wait for previous execution completion
     reset_execution(true);
+    auto prev_data = input->output_memory_ptr();
     input->set_data(data);
+    if (!prev_data || !get_engine().is_the_same_buffer(*prev_data, input->output_memory()))
+        _recording_valid = false;
 }
 
 void network::add_default_output_chains() {
@@ -456,6 +465,9 @@ void network::set_output_memory(const primitive_id& id, memory::ptr mem_new) {
     reset_execution(true);
 
     auto& eng = get_engine();
+    if (!eng.is_the_same_buffer(p_inst->output_memory(), *mem_new))
+        _recording_valid = false;
+
     // locate primitive chain for this output
     // if no chain found - add it
     auto o_iter = _output_chains.find(id);
@@ -472,6 +484,28 @@ void network::set_output_memory(const primitive_id& id, memory::ptr mem_new) {
     }
 }
 
+size_t cldnn::network::get_memory_blocks(memory_blocks& blocks) const {
+    auto add_block = [&blocks](const std::string& category, const memory::cptr& mem) {
+        // the attached user memory has no handle and isn't owned by the network
+        const auto handle = mem ? mem->get_internal_params().mem : nullptr;
+        if (handle)
+            blocks[category][handle] = {mem->get_allocation_type(), mem->size()};
+    };
+
+    size_t io_bytes = 0;
+    for (auto const& prim : _primitives) {
+        const auto& node = prim.second->get_node();
+        if (node.is_type<input_layout>() || prim.second->is_output()) {
+            io_bytes += node.get_output_layout().bytes_count();
+            continue;
+        }
+        add_block(node.is_type<data>() ? "weights" : "activations", prim.second->output_memory_ptr());
+        for (auto const& buffer : prim.second->get_intermediates_memories())
+            add_block("scratchpad", buffer);
+    }
+    return io_bytes;
+}
+
 void cldnn::network::check_names() {
     for (auto const& prim : _primitives) {
         if (find_in_internal_networks(prim.first) != nullptr)
@@ -643,6 +677,89 @@ void network::build_exec_order() {
         }
     }
 }
+void network::assign_branch_streams() {
+    const auto& config = get_engine().configuration();
+    // the streams are synchronized only at the joins, so the per primitive events must not be required by the sync method
+    if (_internal || config.branch_queues <= 1 || config.queue_type != queue_types::in_order || config.enable_profiling)
+        return;
+
+    const size_t n_streams = config.branch_queues;
+    std::vector<primitive_id> tails(n_streams);
+    size_t next_branch = 0;
+
+    // the primitives which are not executed (e.g. data) don't belong to any stream, their producers are waited for instead
+    std::function<void(const program_node&, std::vector<primitive_id>&)> get_producers =
+        [&](const program_node& node, std::vector<primitive_id>& producers) {
+        for (auto& dep : node.get_dependencies()) {
+            if (_branches.count(dep->id()))
+                producers.push_back(dep->id());
+            else
+                get_producers(*dep, producers);
+        }
+    };
+
+    for (auto& inst : _exec_order) {
+        const auto& id = inst->id();
+        std::vector<primitive_id> producers;
+        get_producers(_program->get_node(id), producers);
+
+        // the primitive continues the branch of the first producer it's the last primitive of, each other user of a
+        // producer starts a new branch
+        size_t branch = 0;
+        bool continues = producers.empty();
+        for (auto& producer : producers) {
+            if (tails[_branches.at(producer)] == producer) {
+                branch = _branches.at(producer);
+                continues = true;
+                break;
+            }
+        }
+        if (!continues) {
+            next_branch = (next_branch + 1) % n_streams;
+            branch = next_branch;
+        }
+
+        _branches[id] = branch;
+        tails[branch] = id;
+        for (auto& producer : producers) {
+            if (_branches.at(producer) != branch) {
+                _branch_waits[id].push_back(producer);
+                _branch_sync_points.insert(producer);
+            }
+        }
+    }
+
+    if (_branch_sync_points.empty()) {
+        _branches.clear();
+        return;
+    }
+
+    for (size_t i = 1; i < n_streams; i++) {
+        _branch_streams.push_back(get_engine().create_stream());
+    }
+}
+
+void network::check_recorded_execution() {
+    const auto& config = get_engine().configuration();
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    if (_internal || !config.recorded_execution || config.queue_type != queue_types::in_order || config.enable_profiling ||
+        !_branch_streams.empty())
+        return;
+    GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
+        return;
+    }
+
+    // only the OpenCL kernels can be recorded, the input layouts are only the markers of the set input data
+    for (auto& inst : _exec_order) {
+        auto& node = _program->get_node(inst->id());
+        if (node.get_preferred_impl_type() == impl_types::onednn)
+            return;
+        if (inst->get_impl()->is_cpu() && !node.is_type<input_layout>())
+            return;
+    }
+    _recorded_execution = true;
+}
+
 void network::add_to_exec_order(const primitive_id& id) {
     auto inst = get_primitive(id);
     _exec_order.push_back(inst);
@@ -680,45 +797,100 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
     auto surf_lock = surfaces_lock::create(get_engine().type(), in_out_mem, get_stream());
 
     set_arguments();
-    for (auto& inst : _exec_order) {
-        GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
-            auto& node = _program->get_node(inst->id());
-            const std::string layer_name = node.id();
-            GPU_DEBUG_IF(debug_config->verbose >= 2) {
-                std::cerr << get_primitive_info(inst->id()) << std::endl;
+
+    // the branch streams start after the commands already enqueued to the network stream, e.g. the input copies
+    if (!_branch_streams.empty()) {
+        auto start = _stream->enqueue_full_marker();
+        for (auto& branch_stream : _branch_streams)
+            branch_stream->enqueue_barrier({start});
+    }
+
+    // the recording is replayed while the arguments of the kernels, i.e. the input and output buffers, are the same
+    const bool replay = _recorded_execution && _recording_valid;
+    const bool record = _recorded_execution && !_recording_valid && get_stream().begin_recording();
+    if (_recorded_execution && !replay && !record)
+        _recorded_execution = false;
+
+    if (!replay) {
+        for (auto& inst : _exec_order) {
+            GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
+                auto& node = _program->get_node(inst->id());
+                const std::string layer_name = node.id();
+                GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                    std::cerr << get_primitive_info(inst->id()) << std::endl;
+                }
+
+                GPU_DEBUG_IF(debug_config->dump_layers_dst_only == 0 &&
+                                debug_config->is_dumped_layer(layer_name)) {
+                    for (size_t i = 0; i < get_primitive(inst->id())->dependencies().size(); i++) {
+                        log_memory_to_file(get_primitive(inst->id())->dep_memory_ptr(i), get_stream(),
+                                        layer_name + "_src_" + std::to_string(i));
+                    }
+                }
+            }
+
+            GPU_DEBUG_IF(debug_config->verbose >= 1) {
+                GPU_DEBUG_COUT << "Execute " << inst->id() << ", memory type: "
+                               << inst->output_memory().get_allocation_type() << std::endl;
             }
 
-            GPU_DEBUG_IF(debug_config->dump_layers_dst_only == 0 &&
-                            debug_config->is_dumped_layer(layer_name)) {
-                for (size_t i = 0; i < get_primitive(inst->id())->dependencies().size(); i++) {
-                    log_memory_to_file(get_primitive(inst->id())->dep_memory_ptr(i), get_stream(),
-                                    layer_name + "_src_" + std::to_string(i));
+            // If a node has mutable input or it's an output, then the input/output buffers might be changed
+            // So we need to set arguments on each execution.
+            if (inst->has_mutable_input() || inst->is_output()) {
+                inst->set_arguments();
+            }
+            if (!_branch_streams.empty()) {
+                auto branch = _branches.at(inst->id());
+                _active_stream = branch == 0 ? _stream.get() : _branch_streams[branch - 1].get();
+
+                auto waits = _branch_waits.find(inst->id());
+                if (waits != _branch_waits.end()) {
+                    std::vector<event::ptr> producer_events;
+                    for (auto& producer : waits->second)
+                        producer_events.push_back(_branch_events.at(producer));
+                    _active_stream->enqueue_barrier(producer_events);
                 }
             }
-        }
 
-        GPU_DEBUG_IF(debug_config->verbose >= 1) {
-            GPU_DEBUG_COUT << "Execute " << inst->id() << ", memory type: "
-                           << inst->output_memory().get_allocation_type() << std::endl;
-        }
+            execute_primitive(inst, events);
 
-        // If a node has mutable input or it's an output, then the input/output buffers might be changed
-        // So we need to set arguments on each execution.
-        if (inst->has_mutable_input() || inst->is_output()) {
-            inst->set_arguments();
-        }
-        execute_primitive(inst, events);
-
-        GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
-            get_stream().finish();
-            auto& node = _program->get_node(inst->id());
-            const std::string layer_name = node.id();
-            GPU_DEBUG_IF(debug_config->is_dumped_layer(layer_name)) {
-                log_memory_to_file(get_primitive(inst->id())->output_memory_ptr(), get_stream(), layer_name + "_dst_0");
+            if (!_branch_streams.empty()) {
+                if (_branch_sync_points.count(inst->id()))
+                    _branch_events[inst->id()] = _active_stream->enqueue_full_marker();
+                _active_stream = nullptr;
+            }
+
+            GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
+                get_stream().finish();
+                auto& node = _program->get_node(inst->id());
+                const std::string layer_name = node.id();
+                GPU_DEBUG_IF(debug_config->is_dumped_layer(layer_name)) {
+                    log_memory_to_file(get_primitive(inst->id())->output_memory_ptr(), get_stream(), layer_name + "_dst_0");
+                }
             }
         }
     }
 
+    if (record) {
+        get_stream().end_recording();
+        _recording_valid = true;
+    }
+
+    if (replay || record) {
+        auto ev = get_stream().enqueue_recording();
+        for (auto& inst : _exec_order)
+            _events[inst->id()] = ev;
+    }
+
+    // the outputs are read and the next execution is enqueued through the network stream, so it waits for all the branches
+    if (!_branch_streams.empty()) {
+        std::vector<event::ptr> branch_ends;
+        for (auto& branch_stream : _branch_streams)
+            branch_ends.push_back(branch_stream->enqueue_full_marker());
+        _stream->enqueue_barrier(branch_ends);
+        _branch_events.clear();
+    }
+
     for (auto& inst : _program->get_processing_order()) {
         // Special handling for mutable data. The event should be the same as the user or dependency with highest
         // processing_num as the mutable_data can be updated when is both user or dependency.
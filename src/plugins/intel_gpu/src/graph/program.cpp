@@ -413,12 +413,6 @@ void program::set_options() {
     prog_id = ++id_gen;
     assert(prog_id != 0);
 
-    if ((options.get<build_option_type::tuning_config>()->config.mode == tuning_mode::tuning_tune_and_cache ||
-         options.get<build_option_type::tuning_config>()->config.mode == tuning_mode::tuning_retune_and_cache) &&
-        !_engine.configuration().enable_profiling) {
-        throw std::invalid_argument("Engine must be created with profiling enabled in tune_and_cache mode!");
-    }
-
     GPU_DEBUG_GET_INSTANCE(debug_config);
     GPU_DEBUG_IF(!debug_config->dump_graphs.empty()) {
         options.set_option(cldnn::build_option::graph_dumps_dir(debug_config->dump_graphs));
@@ -1140,6 +1134,15 @@ void program::dump_program(const char* stage,
 
     graph.open(path + "cldnn_program_" + std::to_string(prog_id) + "_" + stage + ".optimized");
     dump_graph_optimized(graph, *this);
+
+    // the implementations are known since the graph compilation
+    bool has_impls = std::any_of(processing_order.begin(), processing_order.end(), [](const program_node* node) {
+        return node->get_selected_impl() != nullptr;
+    });
+    if (has_impls) {
+        graph.open(path + "cldnn_program_" + std::to_string(prog_id) + "_" + stage + ".impls");
+        dump_graph_impls(graph, *this);
+    }
 }
 
 data_types program::get_inference_precision(const program_node& node) const {
@@ -1240,6 +1243,15 @@ program::primitives_info program::get_current_stage_info() const {
                           p->selected_impl ? p->selected_impl->is_cpu() : false,
                           exec_id++);
 
+        if (p->selected_impl)
+            pi.work_groups = p->selected_impl->get_work_groups();
+        for (auto& dep : p->dependencies) {
+            if (dep->is_valid_output_layout())
+                pi.memory_bytes += dep->get_output_layout().bytes_count();
+        }
+        if (p->is_valid_output_layout())
+            pi.memory_bytes += output_layout.bytes_count();
+
         info.push_back(pi);
     }
 
@@ -1442,7 +1454,9 @@ void program::set_layout_optimizer_attributes(layout_optimizer& lo) {
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     auto& engine = get_engine();
-    if (engine.get_device_info().supports_immad && engine.configuration().queue_type == queue_types::in_order)
+    // oneDNN runs on the OpenCL queues only
+    if (engine.type() == engine_types::ocl && engine.get_device_info().supports_immad &&
+        engine.configuration().queue_type == queue_types::in_order)
         lo.set_optimization_attribute(layout_optimizer::optimization_attributes_type::use_onednn_impls, 1);
 #endif
 }
@@ -10,6 +10,8 @@
 #include "condition_inst.h"
 
 #include <algorithm>
+#include <map>
+#include <sstream>
 #include <vector>
 #include <string>
 
@@ -302,6 +304,28 @@ void dump_graph_optimized(std::ofstream& graph, const program& program) {
     close_stream(graph);
 }
 
+void dump_graph_impls(std::ofstream& graph, const program& program) {
+    // one line per executed primitive and the number of primitives per implementation at the end, to track the coverage
+    std::map<std::string, size_t> impls_count;
+    for (auto& node : program.get_processing_order()) {
+        auto impl = node->get_selected_impl();
+        if (impl == nullptr || node->can_be_optimized() || node->is_type<data>())
+            continue;
+
+        std::stringstream impl_type;
+        impl_type << (impl->is_cpu() ? impl_types::cpu : node->get_preferred_impl_type());
+        const auto& layout = node->get_output_layout();
+        graph << node->id() << "\t" << type_to_str(node->get_primitive()) << "\t" << dt_to_str(layout.data_type) << "\t"
+              << fmt_to_str(layout.format) << "\t" << impl_type.str() << "\t" << impl->get_kernel_name() << "\n";
+        impls_count[type_to_str(node->get_primitive()) + "\t" + impl_type.str() + "\t" + impl->get_kernel_name()]++;
+    }
+
+    graph << "\n";
+    for (auto& count : impls_count)
+        graph << count.first << "\t" << count.second << "\n";
+    close_stream(graph);
+}
+
 void dump_graph_info(std::ofstream& graph,
                      const program& program,
                      std::function<bool(program_node const&)> const& filter) {
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_inst.h"
+
+#include "primitive_type_base.h"
+#include "intel_gpu/runtime/error_handler.hpp"
+#include "json_object.h"
+#include <string>
+
+namespace cldnn {
+primitive_type_id scaled_dot_product_attention::type_id() {
+    static primitive_type_base<scaled_dot_product_attention> instance;
+    return &instance;
+}
+
+layout scaled_dot_product_attention_inst::calc_output_layout(scaled_dot_product_attention_node const& node) {
+    auto query_layout = node.query().get_output_layout();
+    auto value_layout = node.value().get_output_layout();
+
+    auto output_size = tensor(query_layout.size.batch[0],
+                              query_layout.size.feature[0],
+                              value_layout.size.spatial[0],
+                              query_layout.size.spatial[1]);
+
+    return layout(query_layout.data_type, format::bfyx, output_size);
+}
+
+std::string scaled_dot_product_attention_inst::to_string(scaled_dot_product_attention_node const& node) {
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+
+    std::stringstream primitive_description;
+
+    json_composite sdpa_info;
+    sdpa_info.add("query id", node.query().id());
+    sdpa_info.add("key id", node.key().id());
+    sdpa_info.add("value id", node.value().id());
+    sdpa_info.add("scale", desc->scale);
+
+    node_info->add("scaled_dot_product_attention info", sdpa_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+scaled_dot_product_attention_inst::typed_primitive_inst(network& network, scaled_dot_product_attention_node const& node)
+    : parent(network, node) {
+    auto query_layout = node.query().get_output_layout();
+    auto key_layout = node.key().get_output_layout();
+    auto value_layout = node.value().get_output_layout();
+
+    CLDNN_ERROR_NOT_EQUAL(node.id(), "Query head size", query_layout.size.spatial[0],
+                          "key head size", key_layout.size.spatial[0], "");
+    CLDNN_ERROR_NOT_EQUAL(node.id(), "Key sequence length", key_layout.size.spatial[1],
+                          "value sequence length", value_layout.size.spatial[1], "");
+}
+}  // namespace cldnn
@@ -40,6 +40,30 @@ std::string convolution_params::to_cache_string_v2() const {
     return s.str();
 }
 
+std::string convolution_params::to_selection_key() const {
+    std::stringstream s;
+
+    s << base_selection_key() << ";";
+    s << toString(weights) << ";";
+    for (const auto& tensors : {&bias, &weights_zero_points, &activations_zero_points, &compensation}) {
+        for (const auto& tensor : *tensors) {
+            s << toString_v2(tensor) << "_";
+        }
+        s << ";";
+    }
+    s << filterSize.x << "_" << filterSize.y << "_" << filterSize.z << ";";
+    s << stride.x << "_" << stride.y << "_" << stride.z << ";";
+    s << dilation.x << "_" << dilation.y << "_" << dilation.z << ";";
+    s << padding.x << "_" << padding.y << "_" << padding.z << ";";
+    s << kernelSize.x << "_" << kernelSize.y << "_" << kernelSize.z << ";";
+    s << split << "_" << groups << "_" << deformable_groups << ";";
+    s << depthwise_separable_opt << transposed << deformable_mode << bilinear_interpolation_pad
+      << deformable_mask_enabled << ";";
+    s << static_cast<int>(quantization);
+
+    return s.str();
+}
+
 ParamsKey convolution_params::GetParamsKey() const {
     ParamsKey k = parent::GetParamsKey();
 
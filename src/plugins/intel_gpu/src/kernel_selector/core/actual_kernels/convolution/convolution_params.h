@@ -34,6 +34,7 @@ struct convolution_params : public weight_bias_zero_point_params {
 
     std::string to_string() const override;
     std::string to_cache_string_v2() const override;
+    std::string to_selection_key() const override;
     ParamsKey GetParamsKey() const override;
 };
 
@@ -17,6 +17,10 @@ JitConstants FullyConnectedKernelBase::GetJitConstants(const fully_connected_par
     const auto x_size = input.LogicalSize() / input.Batch().v;
 
     jit.AddConstant(MakeJitConstant("INPUT0_ELEMENTS_COUNT", x_size));
+    if (!params.decompression_scale.empty()) {
+        jit.AddConstant(MakeJitConstant("DECOMPRESSION_SCALE_TERM", 1));
+        jit.AddConstant(MakeJitConstant("DECOMPRESSION_SCALE", params.decompression_scale[0]));
+    }
 
     return jit;
 }
@@ -106,8 +110,14 @@ KernelsData FullyConnectedKernelBase::GetCommonKernelsData(const Params &params,
                      exeMode,
                      true,
                      !orgParams.bias.empty(),
-                     1,
-                     fused_deps_total);
+                     1);
+
+    if (!newParams.decompression_scale.empty())
+        kernel.params.arguments.push_back({ArgumentDescriptor::Types::DECOMPRESSION_SCALE, 0});
+
+    for (uint32_t i = 0; i < fused_deps_total; i++) {
+        kernel.params.arguments.push_back({ArgumentDescriptor::Types::INPUT_OF_FUSED_PRIMITIVE, i});
+    }
 
     // TODO Pass estimated time only through DispatchData
     kd.autoTuneIndex = autoTuneIndex;
@@ -36,6 +36,7 @@ ParamsKey FullyConnected_bfyx_Ref::GetSupportedKey() const {
     k.EnableTensorPitches();
     k.EnableBatching();
     k.EnableQuantization(QuantizationType::SYMMETRIC);
+    k.EnableFCDecompressionScale();
     return k;
 }
 
@@ -109,6 +110,11 @@ bool FullyConnected_bfyx_Ref::Validate(const Params& params, const optional_para
     auto input_type = fc_params.inputs[0].GetDType();
     auto output_type = fc_params.output.GetDType();
 
+    // the compressed weights are the int8 ones multiplied by the scales of the float inference
+    if (!fc_params.decompression_scale.empty() &&
+        (fc_params.weights.GetDType() != WeightsType::INT8 || fc_params.quantization != QuantizationType::NONE))
+        return false;
+
     // int8/uint8 inputs (quantization case) require additional checks
     // require some additional checks.
     if ((input_type != Datatype::UINT8 && input_type != Datatype::INT8) &&
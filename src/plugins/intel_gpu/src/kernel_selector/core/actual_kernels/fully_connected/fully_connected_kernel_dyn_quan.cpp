@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "fully_connected_kernel_dyn_quan.h"
+#include "common_tools.h"
+
+// Fully_Connected with the dynamic quantization of the input.
+// Each work group quantizes its input row (token) to int8 in the local memory with the scale of the row max, then each
+// work item computes the int8 dot product of the row with the compressed int8 weights of its output feature.
+// Limitations are:
+// 1. Float input without padding, the whole input row fits the local memory
+// 2. Int8 weights with the per output feature decompression scales
+
+namespace kernel_selector {
+
+static size_t GetLocalSize(const fully_connected_params& params) {
+    // the row max is reduced like a binary tree, so the size is a power of two
+    size_t lws = 64;
+    while (lws > 1 && lws > params.engineInfo.maxWorkGroupSize)
+        lws /= 2;
+    return lws;
+}
+
+static size_t GetInputRowSize(const fully_connected_params& params) {
+    const auto& input = params.inputs[0];
+    return input.LogicalSize() / input.Batch().v;
+}
+
+ParamsKey FullyConnectedKernelDynQuan::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputWeightsType(WeightsType::INT8);
+    k.EnableInputLayout(DataLayout::bf);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bf);
+    k.EnableDifferentInputWeightsTypes();
+    k.EnableDifferentTypes();
+    k.EnableBiasPerOutput();
+    k.EnableBiasPerFeature();
+    k.EnableNonBiasTerm();
+    k.EnableBatching();
+    k.EnableFCDecompressionScale();
+    k.EnableFCDynamicQuantization();
+    return k;
+}
+
+FullyConnectedKernelDynQuan::DispatchData FullyConnectedKernelDynQuan::SetDefault(const fully_connected_params& params,
+                                                                                  int) const {
+    auto dispatchData = Parent::SetDefault(params);
+    const auto lws = GetLocalSize(params);
+
+    dispatchData.gws = { RoundUp(params.output.Feature().v, lws), params.output.Batch().v, 1 };
+    dispatchData.lws = { lws, 1, 1 };
+
+    return dispatchData;
+}
+
+KernelsPriority FullyConnectedKernelDynQuan::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return FORCE_PRIORITY_3;
+}
+
+bool FullyConnectedKernelDynQuan::Validate(const Params& params, const optional_params& options) const {
+    if (!Parent::Validate(params, options))
+        return false;
+
+    const auto& fc_params = static_cast<const fully_connected_params&>(params);
+    const auto& input = fc_params.inputs[0];
+
+    // the int8 dot products are worth it with the hardware IMAD only
+    if (!fc_params.dynamic_quantization || !params.engineInfo.bIMADSupport)
+        return false;
+
+    if (fc_params.decompression_scale.empty() || fc_params.weights.GetDType() != WeightsType::INT8 ||
+        fc_params.quantization != QuantizationType::NONE)
+        return false;
+
+    // the input row is read linearly
+    if (input.PitchesDifferFromLogicalDims() || input.GetFirstElementOffset() != 0)
+        return false;
+
+    const auto local_mem_size = RoundUp(GetInputRowSize(fc_params), 4) + GetLocalSize(fc_params) * sizeof(float);
+    if (local_mem_size > params.engineInfo.maxLocalMemSize)
+        return false;
+
+    return true;
+}
+
+JitConstants FullyConnectedKernelDynQuan::GetJitConstants(const fully_connected_params& params,
+                                                          const FullyConnectedKernelBase::DispatchData& dispatchData) const {
+    JitConstants jit = Parent::GetJitConstants(params, dispatchData);
+    const auto activation_dt = Datatype::F32;
+
+    jit.AddConstant(MakeJitConstant("LWS", dispatchData.lws[0]));
+    jit.AddConstant(MakeJitConstant("INPUT0_ELEMENTS_COUNT_ALIGNED", RoundUp(GetInputRowSize(params), 4)));
+    jit.Merge(MakeTypeJitConstants(activation_dt, "ACTIVATION"));
+    jit.Merge(MakeActivationJitConstants(params.activations, activation_dt, "_TYPED"));
+
+    if (!params.fused_ops.empty()) {
+        FusedOpsConfiguration conf = { "", {"b", "ofm", "0", "0"}, "dequantized", activation_dt, 1 };
+        jit.Merge(MakeFusedOpsJitConstants(params, { conf }));
+    }
+    return jit;
+}
+
+KernelsData FullyConnectedKernelDynQuan::GetKernelsData(const Params& params, const optional_params& options) const {
+    KernelsData res = {};
+    for (size_t i = 0; i < autoTuneOptions.size(); i++) {
+        KernelsData kd = GetTunedKernelsDataByIndex(params,
+                                                    options,
+                                                    DataLayout::bf,
+                                                    WeightsLayout::oiyx,
+                                                    static_cast<int>(i));
+        if (!kd.empty()) {
+            res.emplace_back(kd[0]);
+        }
+    }
+
+    return res;
+}
+
+}  // namespace kernel_selector
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include "fully_connected_kernel_base.h"
+
+namespace kernel_selector {
+
+class FullyConnectedKernelDynQuan : public FullyConnectedKernelBase {
+public:
+    using Parent = FullyConnectedKernelBase;
+
+    FullyConnectedKernelDynQuan() : Parent("fully_connected_gpu_dyn_quan") {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& params, const optional_params& options) const override;
+    DispatchData SetDefault(const fully_connected_params& params, int autoTuneIndex = -1) const override;
+    JitConstants GetJitConstants(const fully_connected_params& params, const DispatchData& dispatchData) const override;
+    std::vector<FusedOpType> GetSupportedFusedOps() const override {
+        return { FusedOpType::QUANTIZE,
+                 FusedOpType::SCALE,
+                 FusedOpType::ACTIVATION,
+                 FusedOpType::ELTWISE };
+    }
+};
+}  // namespace kernel_selector
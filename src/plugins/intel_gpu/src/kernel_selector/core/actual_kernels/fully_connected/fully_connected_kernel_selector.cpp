@@ -20,6 +20,7 @@
 #include "fully_connected_kernel_imad.h"
 #include "fully_connected_kernel_fs_byx_fsv32.h"
 #include "fully_connected_kernel_bf_tiled.h"
+#include "fully_connected_kernel_dyn_quan.h"
 
 namespace kernel_selector {
 
@@ -41,6 +42,7 @@ fully_connected_kernel_selector::fully_connected_kernel_selector() {
     Attach<FullyConnectedKernelIMAD>();
     Attach<FullyConnected_fs_byx_fsv32>();
     Attach<FullyConnected_bf_tiled>();
+    Attach<FullyConnectedKernelDynQuan>();
 }
 
 KernelsData fully_connected_kernel_selector::GetBestKernels(const Params& params,
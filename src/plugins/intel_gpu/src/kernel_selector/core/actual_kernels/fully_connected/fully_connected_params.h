@@ -5,6 +5,7 @@
 #pragma once
 
 #include "weight_bias_params.h"
+#include <string>
 
 namespace kernel_selector {
 
@@ -15,14 +16,31 @@ struct fully_connected_params : public weight_bias_params {
     fully_connected_params() : weight_bias_params(KernelType::FULLY_CONNECTED) {}
 
     QuantizationType quantization = QuantizationType::NONE;
+    // the per output feature scales the int8 weights are multiplied by when they are loaded
+    MultiDataTensor decompression_scale;
+    // the float input is quantized to int8 per row on the fly and multiplied by the int8 weights
+    bool dynamic_quantization = false;
 
     ParamsKey GetParamsKey() const override {
         ParamsKey k = weight_bias_params::GetParamsKey();
 
         k.EnableQuantization(quantization);
+        if (!decompression_scale.empty())
+            k.EnableFCDecompressionScale();
+        if (dynamic_quantization)
+            k.EnableFCDynamicQuantization();
 
         return k;
     }
+
+    std::string to_cache_string_v2() const override {
+        std::string s = weight_bias_params::to_cache_string_v2();
+        if (!decompression_scale.empty())
+            s += ";decompression_scale";
+        if (dynamic_quantization)
+            s += ";dynamic_quantization";
+        return s;
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_kernel_opt.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector {
+
+namespace {
+constexpr size_t query_block = 16;
+constexpr size_t kv_tile = 16;
+// the rows of the query and the accumulated rows of the output are kept in the private memory
+constexpr size_t max_head_size = 256;
+}  // namespace
+
+ParamsKey ScaledDotProductAttentionKernelOpt::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    return k;
+}
+
+CommonDispatchData ScaledDotProductAttentionKernelOpt::SetDefault(const scaled_dot_product_attention_params& params) const {
+    CommonDispatchData dispatchData;
+    const auto& query = params.inputs[0];
+
+    dispatchData.gws = { Align(query.Y().v, query_block), query.Batch().v * query.Feature().v, 1 };
+    dispatchData.lws = { query_block, 1, 1 };
+
+    return dispatchData;
+}
+
+JitConstants ScaledDotProductAttentionKernelOpt::GetJitConstants(const scaled_dot_product_attention_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("HEAD_SIZE", params.inputs[0].X().v),
+        MakeJitConstant("VALUE_SIZE", params.inputs[2].X().v),
+        MakeJitConstant("KV_SEQ_LEN", params.inputs[1].Y().v),
+        MakeJitConstant("QUERY_BLOCK", query_block),
+        MakeJitConstant("KV_TILE", kv_tile),
+        MakeJitConstant("SCALE_FACTOR", params.scale),
+    });
+    jit.Merge(MakeTypeJitConstants(Datatype::F32, "ACCUMULATOR"));
+
+    return jit;
+}
+
+KernelsData ScaledDotProductAttentionKernelOpt::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options)) {
+        return {};
+    }
+
+    KernelData kd = KernelData::Default<scaled_dot_product_attention_params>(params);
+    const auto& newParams = static_cast<const scaled_dot_product_attention_params&>(*kd.params.get());
+
+    auto dispatchData = SetDefault(newParams);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, params, options);
+    auto cldnn_jit = GetJitConstants(newParams);
+    auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point, DEFAULT, false, false, 3);
+
+    return {kd};
+}
+
+KernelsPriority ScaledDotProductAttentionKernelOpt::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return FORCE_PRIORITY_1;
+}
+
+bool ScaledDotProductAttentionKernelOpt::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::SCALED_DOT_PRODUCT_ATTENTION || o.GetType() != KernelType::SCALED_DOT_PRODUCT_ATTENTION)
+        return false;
+
+    const auto& params = static_cast<const scaled_dot_product_attention_params&>(p);
+    if (params.inputs.size() != 3)
+        return false;
+
+    return SupportsInputs(params.inputs[0], params.inputs[1], params.inputs[2], params.engineInfo.maxLocalMemSize);
+}
+
+bool ScaledDotProductAttentionKernelOpt::SupportsInputs(const DataTensor& query, const DataTensor& key,
+                                                        const DataTensor& value, uint64_t maxLocalMemSize) {
+    for (const auto& input : { &query, &key, &value }) {
+        if (input->Batch().v != query.Batch().v || input->Feature().v != query.Feature().v)
+            return false;
+    }
+
+    if (key.X().v != query.X().v || key.Y().v != value.Y().v)
+        return false;
+
+    if (query.X().v > max_head_size || value.X().v > max_head_size)
+        return false;
+
+    const size_t slm_bytes = kv_tile * (query.X().v + value.X().v) * BytesPerElement(Datatype::F32);
+    if (slm_bytes > maxLocalMemSize)
+        return false;
+
+    return true;
+}
+
+}  // namespace kernel_selector
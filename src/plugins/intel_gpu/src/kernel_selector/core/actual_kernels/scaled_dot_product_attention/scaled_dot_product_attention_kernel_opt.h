@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+
+namespace kernel_selector {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// scaled_dot_product_attention_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct scaled_dot_product_attention_params : public base_params {
+    scaled_dot_product_attention_params() : base_params(KernelType::SCALED_DOT_PRODUCT_ATTENTION) {}
+
+    float scale = 1.0f;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// scaled_dot_product_attention_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct scaled_dot_product_attention_optional_params : optional_params {
+    scaled_dot_product_attention_optional_params() : optional_params(KernelType::SCALED_DOT_PRODUCT_ATTENTION) {}
+};
+
+/**
+ * The attention kernel which tiles the key and the value in the local memory and computes the softmax online.
+ */
+class ScaledDotProductAttentionKernelOpt : public KernelBaseOpenCL {
+public:
+    ScaledDotProductAttentionKernelOpt() : KernelBaseOpenCL("scaled_dot_product_attention_opt") {}
+    virtual ~ScaledDotProductAttentionKernelOpt() = default;
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+    /**
+     * @brief Checks the shapes the kernel supports, so the attention is fused only if the kernel exists for it
+     */
+    static bool SupportsInputs(const DataTensor& query, const DataTensor& key, const DataTensor& value,
+                               uint64_t maxLocalMemSize);
+
+protected:
+    bool Validate(const Params& params, const optional_params& options) const override;
+    JitConstants GetJitConstants(const scaled_dot_product_attention_params& params) const;
+    CommonDispatchData SetDefault(const scaled_dot_product_attention_params& params) const;
+};
+}  // namespace kernel_selector
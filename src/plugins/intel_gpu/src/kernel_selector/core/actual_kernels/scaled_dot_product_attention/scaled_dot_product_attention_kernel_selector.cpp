@@ -0,0 +1,17 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_kernel_selector.h"
+#include "scaled_dot_product_attention_kernel_opt.h"
+
+namespace kernel_selector {
+scaled_dot_product_attention_kernel_selector::scaled_dot_product_attention_kernel_selector() {
+    Attach<ScaledDotProductAttentionKernelOpt>();
+}
+
+KernelsData scaled_dot_product_attention_kernel_selector::GetBestKernels(const Params& params,
+                                                                         const optional_params& options) const {
+    return GetNaiveBestKernel(params, options, KernelType::SCALED_DOT_PRODUCT_ATTENTION);
+}
+}  // namespace kernel_selector
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_selector.h"
+
+namespace kernel_selector {
+class scaled_dot_product_attention_kernel_selector : public kernel_selector_base {
+public:
+    static scaled_dot_product_attention_kernel_selector& Instance() {
+        static scaled_dot_product_attention_kernel_selector instance_;
+        return instance_;
+    }
+
+    scaled_dot_product_attention_kernel_selector();
+    virtual ~scaled_dot_product_attention_kernel_selector() = default;
+
+    KernelsData GetBestKernels(const Params& params, const optional_params& options) const override;
+};
+}  // namespace kernel_selector
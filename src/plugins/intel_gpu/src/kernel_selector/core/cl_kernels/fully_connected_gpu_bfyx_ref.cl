@@ -13,6 +13,9 @@ KERNEL(fc)(
 #if BIAS_TERM
     , const __global BIAS_TYPE* biases
 #endif
+#if DECOMPRESSION_SCALE_TERM
+    , const __global DECOMPRESSION_SCALE_TYPE* decompression_scale
+#endif
 #if HAS_FUSED_OPS_DECLS
     , FUSED_OPS_DECLS
 #endif
@@ -61,6 +64,11 @@ KERNEL(fc)(
     const uint bias_index = ofm;
 #endif
 
+#if DECOMPRESSION_SCALE_TERM
+    // the scale is per output feature, so the weights are decompressed once for the whole dot product
+    dotProd *= (ACCUMULATOR_TYPE)decompression_scale[bias_index];
+#endif
+
 #if BIAS_TERM
     ACTIVATION_TYPE dequantized = dotProd + biases[bias_index];
 #else
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/data_types.cl"
+#include "include/batch_headers/fetch_data.cl"
+#include "include/imad.cl"
+
+KERNEL(fully_connected_gpu_dyn_quan)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+    , const __global DECOMPRESSION_SCALE_TYPE* decompression_scale
+#if HAS_FUSED_OPS_DECLS
+    , FUSED_OPS_DECLS
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint ofm = get_global_id(0);
+    const uint b = get_global_id(1);
+
+    __local char input_quantized[INPUT0_ELEMENTS_COUNT_ALIGNED];
+    __local float partial_max[LWS];
+
+    const __global INPUT0_TYPE* input_row = input + b * INPUT0_BATCH_PITCH;
+
+    // The scale of the row: each work item finds the max of its part, then the parts are reduced in the local memory
+    float max_abs = 0.f;
+    for (uint i = lid; i < INPUT0_ELEMENTS_COUNT; i += LWS) {
+        max_abs = fmax(max_abs, fabs((float)input_row[i]));
+    }
+    partial_max[lid] = max_abs;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (uint size = LWS / 2; size > 0; size /= 2) {
+        if (lid < size) {
+            partial_max[lid] = fmax(partial_max[lid], partial_max[lid + size]);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    const float input_scale = partial_max[0] > 0.f ? partial_max[0] / 127.f : 1.f;
+    const float input_scale_inv = 1.f / input_scale;
+
+    // The tail of the row is zeroed, so the dot product reads four values at once up to the end
+    for (uint i = lid; i < INPUT0_ELEMENTS_COUNT_ALIGNED; i += LWS) {
+        input_quantized[i] = i < INPUT0_ELEMENTS_COUNT ? convert_char_sat_rte((float)input_row[i] * input_scale_inv) : 0;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (ofm >= OUTPUT_FEATURE_NUM) {
+        return;
+    }
+
+    const __global FILTER_TYPE* filter_row = weights + ofm * FILTER_OFM_PITCH;
+    int dotProd = 0;
+    uint i = 0;
+    for (; i + 4 <= INPUT0_ELEMENTS_COUNT; i += 4) {
+        dotProd = IMAD(dotProd, vload4(0, input_quantized + i), as_char4(vload4(0, filter_row + i)));
+    }
+    for (; i < INPUT0_ELEMENTS_COUNT; ++i) {
+        dotProd += (int)input_quantized[i] * (int)filter_row[i];
+    }
+
+    ACTIVATION_TYPE dequantized = TO_ACTIVATION_TYPE(dotProd) * input_scale * TO_ACTIVATION_TYPE(decompression_scale[ofm]);
+#if BIAS_TERM
+    dequantized += TO_ACTIVATION_TYPE(biases[ofm]);
+#endif
+
+    const uint dst_index = GET_DATA_INDEX(OUTPUT, b, ofm, 0, 0);
+#if HAS_FUSED_OPS
+    FUSED_OPS;
+    OUTPUT_TYPE res = FUSED_OPS_RESULT;
+    output[dst_index] = res;
+#else
+    output[dst_index] = TO_OUTPUT_TYPE(ACTIVATION_TYPED(dequantized, ACTIVATION_PARAMS_TYPED));
+#endif
+}
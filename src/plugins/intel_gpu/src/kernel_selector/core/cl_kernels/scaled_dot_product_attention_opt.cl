@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/data_types.cl"
+#include "include/batch_headers/fetch_data.cl"
+
+// Required JIT definitions:
+// HEAD_SIZE        - the number of the query and key values in a row (D).
+// VALUE_SIZE       - the number of the values in a row of value (D_v).
+// KV_SEQ_LEN       - the number of the key and value rows (S_kv).
+// QUERY_BLOCK      - the number of the query rows of a work group.
+// KV_TILE          - the number of the key and value rows loaded to the local memory at once.
+// SCALE_FACTOR     - the scale of the query x key^T products.
+// ACCUMULATOR_TYPE - type used for intermediate results accumulation.
+//
+// Each work item computes one query row. The work group loads the key and value tiles to the local memory and all
+// its work items use them, the softmax is computed online, so the attention weights of the row are never stored.
+
+__attribute__((reqd_work_group_size(QUERY_BLOCK, 1, 1)))
+KERNEL(scaled_dot_product_attention_opt)(
+    const __global INPUT0_TYPE* query,
+    const __global INPUT1_TYPE* key,
+    const __global INPUT2_TYPE* value,
+    __global OUTPUT_TYPE* output)
+{
+    const uint q_row = (uint)get_global_id(0);
+    const uint bh = (uint)get_global_id(1);
+    const uint b = bh / INPUT0_FEATURE_NUM;
+    const uint h = bh % INPUT0_FEATURE_NUM;
+    const uint lid = (uint)get_local_id(0);
+    const bool valid_row = q_row < INPUT0_SIZE_Y;
+
+    __local ACCUMULATOR_TYPE key_tile[KV_TILE * HEAD_SIZE];
+    __local ACCUMULATOR_TYPE value_tile[KV_TILE * VALUE_SIZE];
+
+    ACCUMULATOR_TYPE q[HEAD_SIZE];
+    ACCUMULATOR_TYPE acc[VALUE_SIZE];
+    for (uint d = 0; d < HEAD_SIZE; ++d)
+        q[d] = valid_row ? TO_ACCUMULATOR_TYPE(query[GET_DATA_INDEX(INPUT0, b, h, q_row, d)]) * SCALE_FACTOR
+                         : ACCUMULATOR_VAL_ZERO;
+    for (uint d = 0; d < VALUE_SIZE; ++d)
+        acc[d] = ACCUMULATOR_VAL_ZERO;
+
+    ACCUMULATOR_TYPE max_score = -INFINITY;
+    ACCUMULATOR_TYPE sum = ACCUMULATOR_VAL_ZERO;
+
+    for (uint kv_start = 0; kv_start < KV_SEQ_LEN; kv_start += KV_TILE) {
+        const uint tile_rows = min((uint)KV_TILE, (uint)(KV_SEQ_LEN - kv_start));
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (uint i = lid; i < tile_rows * HEAD_SIZE; i += QUERY_BLOCK)
+            key_tile[i] = TO_ACCUMULATOR_TYPE(key[GET_DATA_INDEX(INPUT1, b, h, kv_start + i / HEAD_SIZE, i % HEAD_SIZE)]);
+        for (uint i = lid; i < tile_rows * VALUE_SIZE; i += QUERY_BLOCK)
+            value_tile[i] = TO_ACCUMULATOR_TYPE(value[GET_DATA_INDEX(INPUT2, b, h, kv_start + i / VALUE_SIZE, i % VALUE_SIZE)]);
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (!valid_row)
+            continue;
+
+        for (uint j = 0; j < tile_rows; ++j) {
+            ACCUMULATOR_TYPE score = ACCUMULATOR_VAL_ZERO;
+            for (uint d = 0; d < HEAD_SIZE; ++d)
+                score = mad(q[d], key_tile[j * HEAD_SIZE + d], score);
+
+            // rescale the accumulated row when the running maximum grows, so exp never overflows
+            const ACCUMULATOR_TYPE new_max = fmax(max_score, score);
+            const ACCUMULATOR_TYPE correction = exp(max_score - new_max);
+            const ACCUMULATOR_TYPE p = exp(score - new_max);
+            sum = mad(sum, correction, p);
+            for (uint d = 0; d < VALUE_SIZE; ++d)
+                acc[d] = mad(acc[d], correction, p * value_tile[j * VALUE_SIZE + d]);
+            max_score = new_max;
+        }
+    }
+
+    if (!valid_row)
+        return;
+
+    for (uint d = 0; d < VALUE_SIZE; ++d)
+        output[GET_DATA_INDEX(OUTPUT, b, h, q_row, d)] = TO_OUTPUT_TYPE(acc[d] / sum);
+}
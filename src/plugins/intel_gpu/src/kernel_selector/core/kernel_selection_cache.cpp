@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_selection_cache.h"
+#include <fstream>
+#include <string>
+
+namespace kernel_selector {
+
+constexpr const char* KernelSelectionCache::fileName;
+
+std::string KernelSelectionCache::GetFilePath(const std::string& cacheDir) {
+    if (cacheDir.back() == '/' || cacheDir.back() == '\\') {
+        return cacheDir + fileName;
+    }
+    return cacheDir + "/" + fileName;
+}
+
+void KernelSelectionCache::LoadFile(const std::string& cacheDir) {
+    if (cacheDir.empty() || !loadedDirs.insert(cacheDir).second) {
+        return;
+    }
+
+    // Each line is "<selection key>\t<implementation name>", the later lines override the earlier ones
+    std::ifstream file(GetFilePath(cacheDir));
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto separator = line.rfind('\t');
+        if (separator == std::string::npos || separator == 0 || separator + 1 == line.size()) {
+            continue;
+        }
+        selections[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+}
+
+std::string KernelSelectionCache::Load(const std::string& cacheDir, const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    LoadFile(cacheDir);
+
+    auto it = selections.find(key);
+    return it != selections.end() ? it->second : std::string();
+}
+
+void KernelSelectionCache::Store(const std::string& cacheDir,
+                                 const std::string& key,
+                                 const std::string& implementationName) {
+    std::lock_guard<std::mutex> lock(mutex);
+    LoadFile(cacheDir);
+
+    auto& selection = selections[key];
+    if (selection == implementationName) {
+        return;
+    }
+    selection = implementationName;
+
+    if (!cacheDir.empty()) {
+        // The cache is an optimization only, so failing to write it isn't an error
+        std::ofstream file(GetFilePath(cacheDir), std::ios::app);
+        if (file) {
+            file << key << '\t' << implementationName << '\n';
+        }
+    }
+}
+}  // namespace kernel_selector
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace kernel_selector {
+
+// Remembers which implementation the naive selection picked for the given selection key, so the next selection of the
+// same primitive tries this implementation only instead of all the candidates. If the cache directory is set, the
+// decisions are also appended to the file in it and are reused by the next processes.
+class KernelSelectionCache {
+public:
+    KernelSelectionCache() = default;
+
+    std::string Load(const std::string& cacheDir, const std::string& key);
+    void Store(const std::string& cacheDir, const std::string& key, const std::string& implementationName);
+
+    static constexpr const char* fileName = "kernel_selection.txt";
+
+private:
+    void LoadFile(const std::string& cacheDir);
+    static std::string GetFilePath(const std::string& cacheDir);
+
+    std::unordered_map<std::string, std::string> selections;
+    std::set<std::string> loadedDirs;
+    std::mutex mutex;
+};
+}  // namespace kernel_selector
@@ -30,6 +30,7 @@
 namespace kernel_selector {
 
 AutoTuner kernel_selector_base::autoTuner;
+KernelSelectionCache kernel_selector_base::selectionCache;
 
 #ifdef ENABLE_ENV
 std::string strip(const std::string str) {
@@ -73,6 +74,29 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
 
     auto allImplementations = GetAllImplementations(params, options, kType);
 
+    // The forced and denied kernels change the choice, so it's neither reused nor remembered then
+    const auto selectionKey = forceKernels.empty() ? GetSelectionKey(params, options) : std::string();
+    if (!selectionKey.empty()) {
+        const auto cachedKernelName = selectionCache.Load(options.selectionCacheDir, selectionKey);
+        for (const auto& implementation : allImplementations) {
+            if (cachedKernelName.empty() || implementation->GetName() != cachedKernelName) {
+                continue;
+            }
+            try {
+                KernelsData kds = implementation->GetKernelsData(params, options);
+                if (kds.size() && kds[0].kernels.size()) {
+                    kernelsData = kds;
+                    kernelsData[0].kernelName = cachedKernelName;
+                    kernelsData[0].kernels[0].params.layerID = params.layerID;
+                    return kernelsData;
+                }
+            } catch (std::runtime_error&) {
+                // the cached decision is stale, so the implementations are enumerated again below
+            }
+            break;
+        }
+    }
+
     for (const auto& implementation : allImplementations) {
         // TODO: Unify this check with the Validate virtual method. Make
         // sure that the method is called here only, not in all the
@@ -114,6 +138,9 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
     if (kernelsData.size()) {
         kernelsData[0].kernelName = kernelName;
         kernelsData[0].kernels[0].params.layerID = params.layerID;
+        if (!selectionKey.empty()) {
+            selectionCache.Store(options.selectionCacheDir, selectionKey, kernelName);
+        }
     }
 
     return kernelsData;
@@ -251,6 +278,29 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
     return kernelsData;
 }
 
+std::string kernel_selector_base::GetSelectionKey(const Params& params, const optional_params& options) const {
+    const auto paramsKey = params.to_selection_key();
+    if (paramsKey.empty()) {
+        return {};
+    }
+
+    std::stringstream s;
+    s << params.engineInfo.deviceId << "_" << params.engineInfo.driverVersion << "_"
+      << params.engineInfo.computeUnitsCount << "_" << params.engineInfo.maxWorkGroupSize << ";";
+    s << paramsKey << ";";
+    for (auto l : options.inputLayouts) {
+        s << toString(l) << "_";
+    }
+    s << ";";
+    for (auto l : options.outputLayouts) {
+        s << toString(l) << "_";
+    }
+    s << ";" << options.allowStaticInputReordering << options.allowInputReordering << options.allowOutputReordering;
+    s << ";" << params.forceImplementation;
+
+    return s.str();
+}
+
 KernelList kernel_selector_base::GetAllImplementations(const Params& params, const optional_params& options, KernelType kType) const {
     using PriorityPair = std::pair<KernelsPriority, std::shared_ptr<KernelBase>>;
     auto comparePriority = [](const PriorityPair& firstImpl, const PriorityPair& secondImpl) {
@@ -7,6 +7,7 @@
 #include "kernel_selector_common.h"
 #include "kernel_runner_interface.h"
 #include "auto_tuner.h"
+#include "kernel_selection_cache.h"
 #include <vector>
 #include <memory>
 #include <string>
@@ -40,10 +41,12 @@ protected:
                                               KernelType kType) const;
 
     KernelList GetAllImplementations(const Params& params, const optional_params& options, KernelType kType) const;
+    std::string GetSelectionKey(const Params& params, const optional_params& options) const;
 
     KernelList implementations;
     ForceList forceKernels;
 
     static AutoTuner autoTuner;
+    static KernelSelectionCache selectionCache;
 };
 }  // namespace kernel_selector
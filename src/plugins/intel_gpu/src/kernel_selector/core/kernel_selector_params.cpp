@@ -473,6 +473,10 @@ std::string Params::to_cache_string_v2() const {
     return "";
 }
 
+std::string Params::to_selection_key() const {
+    return "";
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // optional_params
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,4 +596,29 @@ std::string base_params::to_cache_string_v2() const {
     return s.str();
 }
 
+std::string base_params::base_selection_key() const {
+    std::stringstream s;
+
+    s << toString(kType);
+    for (const auto& input : inputs) {
+        s << ";" << toString_v2(input);
+    }
+    s << ";" << toString_v2(output);
+    for (const auto& activation : activations) {
+        s << ";" << activation.to_string();
+    }
+    for (const auto& fused_op : fused_ops) {
+        s << ";fused_" << toString(fused_op.GetType()) << "_" << fused_op.dep_size;
+        for (const auto& tensor : fused_op.tensors) {
+            s << "_" << toString_v2(tensor);
+        }
+        s << "_" << toString_v2(fused_op.output_tensor);
+        if (fused_op.GetType() == KernelType::ACTIVATION) {
+            s << "_" << fused_op.GetOpParams<activation_fuse_params>()->param.to_string();
+        }
+    }
+
+    return s.str();
+}
+
 }  // namespace kernel_selector
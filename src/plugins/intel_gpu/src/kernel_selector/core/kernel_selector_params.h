@@ -137,6 +137,8 @@ public:
                         uint32_t deformable_mask_enabled : 1;
                     } conv;
                     struct fc_t {
+                        uint32_t decompression_scale : 1;
+                        uint32_t dynamic_quantization : 1;
                     } fc;
                     struct softmax_t {
                         uint32_t dimX : 1;
@@ -294,6 +296,8 @@ public:
     void EnableDeformableMode() { key.restrict.val.dedicated.conv.deformable = 1; }
     void EnableBilinearInterpolationPad() { key.restrict.val.dedicated.conv.bilinear_interpolation_pad = 1; }
     void EnableDeformableMask() { key.restrict.val.dedicated.conv.deformable_mask_enabled = 1; }
+    void EnableFCDecompressionScale() { key.restrict.val.dedicated.fc.decompression_scale = 1; }
+    void EnableFCDynamicQuantization() { key.restrict.val.dedicated.fc.dynamic_quantization = 1; }
 
     void EnableQuantizePackedBinaryOutput() { key.restrict.val.dedicated.quantize.packed_binary_output = 1; }
     void EnableQuantizeScaleShiftOpt() { key.restrict.val.dedicated.quantize.scale_shift_opt = 1; }
@@ -390,6 +394,8 @@ public:
 
     virtual std::string to_string() const;
     virtual std::string to_cache_string_v2() const;
+    // Describes everything the choice of the implementation depends on. Empty key means the choice isn't cached.
+    virtual std::string to_selection_key() const;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -597,6 +603,8 @@ struct base_params : public Params {
 
 protected:
     explicit base_params(KernelType kt) : Params(kt, ""), inputs(1) {}
+    // The part of the selection key common for all the primitives: the tensors, the activations and the fused ops
+    std::string base_selection_key() const;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,6 +639,7 @@ struct optional_params {
         false;  // allow kernel to ask graph compiler to reorder the output data before executing the next kernel
 
     TuningParams tuningParams;
+    std::string selectionCacheDir;  // directory to persist the decisions of the kernels selection in
 
     virtual ParamsKey GetSupportedKey() const;
 
@@ -13,16 +13,56 @@ namespace intel_gpu {
 AsyncInferRequest::AsyncInferRequest(const InferRequest::Ptr &inferRequest,
                                      const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                      const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
+                                     const InferenceEngine::ITaskExecutor::Ptr& preprocExecutor,
                                      const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor), _inferRequest(inferRequest), _waitExecutor(waitExecutor) {
+    : AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor), _inferRequest(inferRequest), _waitExecutor(waitExecutor),
+      _preprocExecutor(preprocExecutor) {
     _pipeline = {};
 
-    if (!_inferRequest->use_external_queue()) {
+    if (_inferRequest->use_copy_stream()) {
+        // the wait and the output copies of this request run while the next request uploads its inputs and enqueues
+        if (_preprocExecutor) {
+            _pipeline.push_back({_preprocExecutor,
+                        [this] {
+                            OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::Preprocessing");
+                            _inferRequest->preprocess();
+            } });
+        }
+        _pipeline.push_back({taskExecutor,
+                    [this] {
+                        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::StartPipeline");
+                        _inferRequest->setup_stream_graph();
+                        if (!_preprocExecutor)
+                            _inferRequest->preprocess();
+                        _inferRequest->enqueue();
+        } });
+        _pipeline.push_back({_waitExecutor,
+                    [this] {
+                        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::WaitPipeline");
+                        _inferRequest->wait();
+        } });
+    } else if (!_inferRequest->use_external_queue() && _preprocExecutor) {
+        // the host preprocessing of the next request overlaps with the device inference of this one
+        _pipeline.push_back({_preprocExecutor,
+                    [this] {
+                        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::Preprocessing");
+                        _inferRequest->preprocess();
+        } });
+        _pipeline.push_back({taskExecutor,
+                    [this] {
+                        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::StartPipeline");
+                        _inferRequest->setup_stream_graph();
+                        auto lock = _inferRequest->lock_execution();
+                        _inferRequest->enqueue();
+                        _inferRequest->wait();
+        } });
+    } else if (!_inferRequest->use_external_queue()) {
         _pipeline.push_back({taskExecutor,
                     [this] {
                         OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::PreprocessingAndStartPipeline");
                         _inferRequest->setup_stream_graph();
                         _inferRequest->preprocess();
+                        auto lock = _inferRequest->lock_execution();
                         _inferRequest->enqueue();
                         _inferRequest->wait();
         } });
@@ -8,6 +8,7 @@
 #include "intel_gpu/plugin/infer_request.hpp"
 #include "intel_gpu/plugin/compiled_model.hpp"
 #include "intel_gpu/plugin/async_infer_request.hpp"
+#include "intel_gpu/plugin/network_serializer.hpp"
 #include "openvino/runtime/intel_gpu/properties.hpp"
 
 #include <description_buffer.hpp>
@@ -18,6 +19,7 @@
 #include "ie_icore.hpp"
 
 #include <fstream>
+#include <sstream>
 #include <utility>
 #include <sys/types.h>
 #include <chrono>
@@ -44,9 +46,11 @@ CompiledModel::CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_p
                 IStreamsExecutor::Config{"Intel GPU plugin executor", 1});
         }
     }()},
+    m_network(network),
     m_config(config),
     m_taskExecutor{ _taskExecutor },
-    m_waitExecutor(executorManager()->getIdleCPUStreamsExecutor({ "GPUWaitExecutor" })) {
+    m_waitExecutor(executorManager()->getIdleCPUStreamsExecutor({ "GPUWaitExecutor" })),
+    m_preprocExecutor(executorManager()->getIdleCPUStreamsExecutor({ "GPUPreprocExecutor", std::max<int>(1, config.throughput_streams) })) {
     auto casted_context = std::dynamic_pointer_cast<gpu::ClContext>(context);
 
     if (nullptr == casted_context) {
@@ -55,9 +59,19 @@ CompiledModel::CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_p
 
     m_context = casted_context;
 
-    auto graph_base = std::make_shared<Graph>(network, m_context, m_config, 0);
+    // the streams beyond the executing ones take the queue and the intermediate buffers of the group they are added to
+    std::vector<Graph::ExecutionGroup::Ptr> execution_groups;
+    if (m_config.executing_streams > 0 && m_config.executing_streams < m_config.throughput_streams) {
+        for (uint16_t n = 0; n < m_config.executing_streams; n++)
+            execution_groups.push_back(std::make_shared<Graph::ExecutionGroup>());
+    }
+    auto get_execution_group = [&](uint16_t n) {
+        return execution_groups.empty() ? nullptr : execution_groups[n % execution_groups.size()];
+    };
+
+    auto graph_base = std::make_shared<Graph>(network, m_context, m_config, 0, get_execution_group(0));
     for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
-        auto graph = n == 0 ? graph_base : std::make_shared<Graph>(graph_base, n);
+        auto graph = n == 0 ? graph_base : std::make_shared<Graph>(graph_base, n, get_execution_group(n));
         m_graphs.push_back(graph);
     }
 }
@@ -75,6 +89,10 @@ IInferRequestInternal::Ptr CompiledModel::CreateInferRequestImpl(InputsDataMap n
     if (m_graphs.front()->use_external_queue()) {
         ptr->enable_external_queue();
     }
+    // the profiling data is collected from the network in wait(), so it must not run with the next enqueue()
+    if (m_graphs.front()->GetCopyStream() && !m_config.useProfiling) {
+        ptr->enable_copy_stream();
+    }
     ptr->SetGraph(m_graphs.front());
 
     return ptr;
@@ -99,6 +117,12 @@ IInferRequestInternal::Ptr CompiledModel::CreateInferRequestImpl(const std::vect
     return ptr;
 }
 
+void CompiledModel::Export(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "CompiledModel::Export");
+    NetworkSerializer serializer(networkModel);
+    serializer << m_network;
+}
+
 IInferRequestInternal::Ptr CompiledModel::CreateInferRequest() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "CompiledModel::CreateInferRequest");
     InferenceEngine::IInferRequestInternal::Ptr internalRequest;
@@ -124,9 +148,12 @@ IInferRequestInternal::Ptr CompiledModel::CreateInferRequest() {
     if (!internalRequest)
         internalRequest = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     internalRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    // the dynamic batch is taken from the input blobs when the stream graph is set up, before the preprocessing
+    const bool dynamicBatch = m_graphs.front()->GetMaxDynamicBatchSize() > 1;
     return std::make_shared<AsyncInferRequest>(std::static_pointer_cast<InferRequest>(internalRequest),
                                                m_taskExecutor,
                                                m_waitExecutor,
+                                               dynamicBatch ? nullptr : m_preprocExecutor,
                                                _callbackExecutor);
 }
 
@@ -189,6 +216,7 @@ InferenceEngine::Parameter CompiledModel::GetMetric(const std::string &name) con
             ov::PropertyName{ov::supported_properties.name(), PropertyMutability::RO},
             ov::PropertyName{ov::model_name.name(), PropertyMutability::RO},
             ov::PropertyName{ov::optimal_number_of_infer_requests.name(), PropertyMutability::RO},
+            ov::PropertyName{ov::memory_statistics.name(), PropertyMutability::RO},
 
             // Configs
             ov::PropertyName{ov::enable_profiling.name(), PropertyMutability::RO},
@@ -213,6 +241,7 @@ InferenceEngine::Parameter CompiledModel::GetMetric(const std::string &name) con
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(ov::memory_statistics.name());
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -225,11 +254,44 @@ InferenceEngine::Parameter CompiledModel::GetMetric(const std::string &name) con
         if (m_config.perfHintsConfig.ovPerfHint != CONFIG_VALUE(LATENCY))
             nr *= 2;
         return decltype(ov::optimal_number_of_infer_requests)::value_type {nr};
+    } else if (name == ov::memory_statistics) {
+        return decltype(ov::memory_statistics)::value_type {GetMemoryStatistics()};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+std::map<std::string, uint64_t> CompiledModel::GetMemoryStatistics() const {
+    // the networks of the streams are built from the same program, so their constants are counted once
+    cldnn::network::memory_blocks blocks;
+    uint64_t io_bytes = 0;
+    for (const auto& graph : m_graphs) {
+        for (size_t i = 0; i < graph->GetNetworksCount(); i++)
+            io_bytes += graph->GetNetwork(i)->get_memory_blocks(blocks);
+    }
+
+    std::map<std::string, uint64_t> statistics;
+    for (const auto& category : blocks) {
+        for (const auto& block : category.second) {
+            std::ostringstream location;
+            location << block.second.first;
+            statistics[category.first + "/" + location.str() + "/current"] += block.second.second;
+            statistics[category.first + "/total/current"] += block.second.second;
+        }
+    }
+    statistics.emplace("weights/total/current", 0);
+    statistics.emplace("activations/total/current", 0);
+    statistics["io/total/current"] = io_bytes;
+
+    std::lock_guard<std::mutex> lock(m_memoryPeaksMutex);
+    for (const auto& stat : statistics) {
+        auto& peak = m_memoryPeaks[stat.first.substr(0, stat.first.rfind('/')) + "/peak"];
+        peak = std::max(peak, stat.second);
+    }
+    statistics.insert(m_memoryPeaks.begin(), m_memoryPeaks.end());
+    return statistics;
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> CompiledModel::GetContext() const {
     return m_context;
 }
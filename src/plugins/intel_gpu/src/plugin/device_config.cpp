@@ -14,6 +14,7 @@
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include <ie_system_conf.h>
 #include <thread>
+#include <limits>
 
 #ifdef _WIN32
 # include <direct.h>
@@ -45,8 +46,8 @@ static void createDirectory(std::string _path) {
 }
 
 static int getNumberOfCores(const IStreamsExecutor::Config::PreferredCoreType core_type) {
-    const auto total_num_cores = getNumberOfLogicalCPUCores();
-    const auto total_num_big_cores = getNumberOfLogicalCPUCores(true);
+    const auto total_num_cores = limitByCPUQuota(getNumberOfLogicalCPUCores());
+    const auto total_num_big_cores = limitByCPUQuota(getNumberOfLogicalCPUCores(true));
     const auto total_num_little_cores = total_num_cores - total_num_big_cores;
 
     int num_cores = total_num_cores;
@@ -269,6 +270,60 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             }
             // Set this value.
             device_id = val;
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_BRANCH_QUEUES) == 0) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 1 || val_i > std::numeric_limits<uint16_t>::max()) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_BRANCH_QUEUES << ": " << val
+                           << "\nSpecify the number of the queues as a positive integer.";
+            }
+            branch_queues = static_cast<uint16_t>(val_i);
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_EXECUTING_STREAMS) == 0) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0 || val_i > std::numeric_limits<uint16_t>::max()) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_EXECUTING_STREAMS << ": " << val
+                           << "\nSpecify the number of the streams executing at the same time as a non-negative integer.";
+            }
+            executing_streams = static_cast<uint16_t>(val_i);
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_DYNAMIC_QUANTIZATION) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                enable_dynamic_quantization = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                enable_dynamic_quantization = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_RECORDED_EXECUTION) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                recorded_execution = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                recorded_execution = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_LEVEL_ZERO) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+#ifndef ENABLE_INTEL_GPU_LEVEL_ZERO
+                IE_THROW() << "GPU plugin is built without Level Zero runtime, "
+                           << PluginConfigInternalParams::KEY_GPU_LEVEL_ZERO << " can't be enabled";
+#endif
+                use_level_zero = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                use_level_zero = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_KERNEL_TRACE_DIR) == 0) {
+            kernel_trace_dir = val;
+            if (!kernel_trace_dir.empty())
+                createDirectory(kernel_trace_dir);
         } else if (key.compare(PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 enableInt8 = true;
@@ -335,6 +390,10 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             IE_THROW(NotFound) << "Unsupported property key by plugin: " << key;
         }
 
+        // the trace is made of the profiling events
+        if (!kernel_trace_dir.empty())
+            useProfiling = true;
+
         adjustKeyMapValues();
     }
 }
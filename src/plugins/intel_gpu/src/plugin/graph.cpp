@@ -42,11 +42,13 @@ namespace ov {
 namespace runtime {
 namespace intel_gpu {
 
-Graph::Graph(InferenceEngine::CNNNetwork& network, gpu::ClContext::Ptr context, Config config, uint16_t stream_id)
+Graph::Graph(InferenceEngine::CNNNetwork& network, gpu::ClContext::Ptr context, Config config, uint16_t stream_id,
+             ExecutionGroup::Ptr execution_group)
     : m_context(context)
     , m_networkName(network.getName())
     , m_config(config)
     , m_stream_id(stream_id)
+    , m_execution_group(execution_group)
     , m_state(0) {
     m_program = std::make_shared<Program>(network, GetEngine(), m_config);
     if (m_program->m_max_batch > 1)
@@ -54,12 +56,13 @@ Graph::Graph(InferenceEngine::CNNNetwork& network, gpu::ClContext::Ptr context,
     Build();
 }
 
-Graph::Graph(std::shared_ptr<Graph> graph, uint16_t stream_id)
+Graph::Graph(std::shared_ptr<Graph> graph, uint16_t stream_id, ExecutionGroup::Ptr execution_group)
         : m_context(graph->m_context)
         , m_program(graph->m_program)
         , m_networkName(graph->m_networkName)
         , m_config(graph->m_config)
         , m_stream_id(stream_id)
+        , m_execution_group(execution_group)
         , m_state(0) {
     Build();
 }
@@ -77,17 +80,53 @@ void Graph::Build() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Graph::Build");
     UpdateLayersMaps();
 
+    auto& engine = m_program->GetEngine();
+    const bool can_share_memory = engine.configuration().queue_type == cldnn::queue_types::in_order &&
+                                  engine.configuration().use_memory_pool;
+    // the branch queues of a network are not synchronized with the other networks of the group
+    if (!can_share_memory || m_config.branch_queues > 1 || use_external_queue())
+        m_execution_group = nullptr;
+    if (m_execution_group && !m_execution_group->stream) {
+        m_execution_group->stream = engine.create_stream();
+        m_execution_group->memory_pool = std::make_shared<cldnn::memory_pool>(engine);
+    }
+
     if (GetMaxDynamicBatchSize() > 1) {
+        // The networks of the batch sizes are executed one after another, so on the in-order queue they share the
+        // queue and the intermediate buffers. The smaller networks are built after the bigger ones and reuse their
+        // buffers, so the memory footprint is the one of the biggest network instead of the sum of all of them
+        cldnn::stream::ptr stream = nullptr;
+        std::shared_ptr<cldnn::memory_pool> memory_pool = nullptr;
+        if (m_execution_group) {
+            stream = m_execution_group->stream;
+            memory_pool = m_execution_group->memory_pool;
+        } else if (can_share_memory) {
+            auto externalQueue = getContextImpl(m_context)->GetExternalQueue();
+            stream = externalQueue ? engine.create_stream(externalQueue) : engine.create_stream();
+            memory_pool = std::make_shared<cldnn::memory_pool>(engine);
+        }
+
         int m_bv_sz = m_program->GetMaxBatchSizeForSingleProgram();
         for (int b = m_bv_sz - 1; b >= 0; b--) {
-            auto network = BuildNetwork(m_program->GetCompiledProgram(b));
+            auto network = BuildNetwork(m_program->GetCompiledProgram(b), stream, memory_pool);
             m_networks.insert(m_networks.begin(), network);
         }
+    } else if (m_execution_group) {
+        // the graphs of the group take the same buffers from the pool, as they never execute at the same time
+        auto network = BuildNetwork(m_program->GetCompiledProgram(), m_execution_group->stream, m_execution_group->memory_pool);
+        m_networks.emplace_back(network);
     } else {
         auto network = BuildNetwork(m_program->GetCompiledProgram());
         m_networks.emplace_back(network);
     }
 
+    // the copies are ordered with the execution by the events only, which the in-order queue of a single network
+    // without the branch queues has at its start and end
+    if (engine.configuration().queue_type == cldnn::queue_types::in_order && m_config.branch_queues <= 1 &&
+        !use_external_queue() && !m_execution_group && GetMaxDynamicBatchSize() <= 1) {
+        m_copy_stream = engine.create_stream();
+    }
+
     GPU_DEBUG_GET_INSTANCE(debug_config);
     GPU_DEBUG_IF(!debug_config->dry_run_path.empty()) {
         CNNNetwork net(GetExecGraphInfo());
@@ -101,15 +140,20 @@ bool Graph::use_external_queue() const {
     return impl->GetExternalQueue() != nullptr;
 }
 
-std::shared_ptr<cldnn::network> Graph::BuildNetwork(std::shared_ptr<cldnn::program> program) {
+std::shared_ptr<cldnn::network> Graph::BuildNetwork(std::shared_ptr<cldnn::program> program,
+                                                    cldnn::stream::ptr stream,
+                                                    std::shared_ptr<cldnn::memory_pool> memory_pool) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Graph::BuildNetwork");
     std::shared_ptr<cldnn::network> network = nullptr;
 
     auto impl = getContextImpl(m_context);
     auto externalQueue = impl->GetExternalQueue();
-    if (externalQueue) {
-        if (m_config.throughput_streams != 1)
-            IE_THROW(ParameterMismatch) << "Throughput streams can't be used with shared queue!\n";
+    if (externalQueue && m_config.throughput_streams != 1)
+        IE_THROW(ParameterMismatch) << "Throughput streams can't be used with shared queue!\n";
+
+    if (stream) {
+        network = std::make_shared<cldnn::network>(program, stream, memory_pool, m_stream_id);
+    } else if (externalQueue) {
         auto &engine = m_program->GetEngine();
         network = std::make_shared<cldnn::network>(program, engine.create_stream(externalQueue), m_stream_id);
     } else {
@@ -541,6 +585,91 @@ void Graph::UpdatePerfStatistics() {
     }
 }
 
+namespace {
+std::string escape_json(const std::string& str) {
+    std::string escaped;
+    for (auto c : str) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+std::string sizes_to_json(const std::vector<size_t>& sizes) {
+    std::string json = "[";
+    for (size_t i = 0; i < sizes.size(); i++)
+        json += (i ? "," : "") + std::to_string(sizes[i]);
+    return json + "]";
+}
+}  // namespace
+
+void Graph::DumpKernelTrace() {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Graph::DumpKernelTrace");
+    if (GetNetworksCount() == 0) {
+        return;
+    }
+
+    auto network = GetNetwork();
+    auto executedPrimitives = network->get_executed_primitives();
+    const auto& primitivesInfo = network->get_primitives_info();
+    const auto eu_count = std::max<uint32_t>(GetEngine()->get_device_info().execution_units_count, 1);
+
+    // the events are written in the Chrome trace format, the timestamps are the device ones in microseconds
+    std::stringstream trace;
+    trace << "{\"traceEvents\":[";
+    bool first = true;
+    for (auto& pi : primitivesInfo) {
+        auto execIter = executedPrimitives.find(pi.original_id);
+        if (execIter == executedPrimitives.end() || !execIter->second)
+            continue;
+
+        cldnn::instrumentation::device_timestamps timestamps;
+        if (!execIter->second->get_device_timestamps(timestamps))
+            continue;
+
+        size_t work_groups = 0;
+        std::string gws = "[", lws = "[";
+        for (size_t k = 0; k < pi.work_groups.size(); k++) {
+            const auto& global = pi.work_groups[k].global;
+            const auto& local = pi.work_groups[k].local;
+            size_t kernel_groups = 1;
+            for (size_t i = 0; i < global.size(); i++) {
+                const size_t local_size = i < local.size() && local[i] != 0 ? local[i] : 1;
+                kernel_groups *= (global[i] + local_size - 1) / local_size;
+            }
+            work_groups += kernel_groups;
+            gws += (k ? "," : "") + sizes_to_json(global);
+            lws += (k ? "," : "") + sizes_to_json(local);
+        }
+        gws += "]";
+        lws += "]";
+
+        trace << (first ? "" : ",") << "\n{\"name\":\"" << escape_json(pi.original_id) << "\""
+              << ",\"cat\":\"" << escape_json(pi.type_id) << "\""
+              << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << m_stream_id
+              << ",\"ts\":" << timestamps.start / 1000.0
+              << ",\"dur\":" << (timestamps.end - timestamps.start) / 1000.0
+              << ",\"args\":{\"kernel\":\"" << escape_json(pi.kernel_id) << "\""
+              << ",\"queued\":" << timestamps.queued
+              << ",\"submit\":" << timestamps.submit
+              << ",\"start\":" << timestamps.start
+              << ",\"end\":" << timestamps.end
+              << ",\"gws\":" << gws
+              << ",\"lws\":" << lws
+              << ",\"work_groups\":" << work_groups
+              << ",\"work_groups_per_eu\":" << static_cast<double>(work_groups) / eu_count
+              << ",\"bytes\":" << pi.memory_bytes << "}}";
+        first = false;
+    }
+    trace << "\n]}\n";
+
+    const auto trace_id = m_traceCounter++;
+    std::ofstream file(m_config.kernel_trace_dir + "/" + m_networkName + "_" + std::to_string(m_stream_id) + "_" +
+                       std::to_string(trace_id) + ".json");
+    file << trace.str();
+}
+
 bool Graph::IsLoaded() const {
     return GetNetwork() != nullptr;
 }
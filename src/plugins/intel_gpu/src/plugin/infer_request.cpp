@@ -628,11 +628,8 @@ void InferRequest::preprocess_notify() {
 }
 
 void InferRequest::preprocess() {
-    if (m_graph->GetMaxDynamicBatchSize() > 1) {
-        preprocess_dynamic();
-    } else {
-        execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
-    }
+    // doesn't use the stream graph, so it may run before setup_stream_graph() in a separate pipeline stage
+    execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
 }
 
 void InferRequest::enqueue_notify() {
@@ -740,8 +737,16 @@ void InferRequest::enqueue() {
         prepare_output(outputName, outputBlob);
     }
 
+    auto& network_stream = m_graph->GetNetwork()->get_stream();
+    if (m_useCopyStream) {
+        // the kernels of the in-order queue don't wait for the events, so the copy queue is joined explicitly
+        network_stream.enqueue_barrier(dependencies);
+    }
+
     internal_outputs.clear();
     internal_outputs = m_graph->GetNetwork()->execute(dependencies);
+    if (m_useCopyStream)
+        m_execution_done = network_stream.enqueue_full_marker();
 
     // If dump layers path is set, only runs first inference.
     GPU_DEBUG_GET_INSTANCE(debug_config);
@@ -766,11 +771,16 @@ void InferRequest::wait() {
         IE_THROW() << "Inference was not started!\n";
     }
 
+    // the network queue isn't finished, as it may already execute the next request
+    if (m_useCopyStream)
+        m_execution_done->wait();
+
     // wait for completion & collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
         Blob::Ptr bptr = _outputs[no.first];
         std::string outputID = outputsMap.at(no.first);
-        auto outputMemory = internal_outputs.at(outputID).get_memory();
+        auto outputMemory = m_useCopyStream ? internal_outputs.at(outputID).get_result()
+                                            : internal_outputs.at(outputID).get_memory();
 
         // mapping remote blobs not needed -
         // let the user take care of them explicitly
@@ -790,6 +800,8 @@ void InferRequest::wait() {
     // finally collect profiling info
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
+        if (!m_graph->getConfig().kernel_trace_dir.empty())
+            m_graph->DumpKernelTrace();
     }
 }
 
@@ -894,9 +906,13 @@ Blob::Ptr InferRequest::create_shared_device_blob(const InferenceEngine::TensorD
     return blob;
 }
 
+cldnn::stream& InferRequest::get_copy_stream() const {
+    return m_useCopyStream ? *m_graph->GetCopyStream() : m_graph->GetNetwork()->get_stream();
+}
+
 void InferRequest::copy_output_data(cldnn::memory::ptr src, Blob::Ptr dst, buf_info* bi) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::copy_output_data");
-    auto& stream = m_graph->GetNetwork()->get_stream();
+    auto& stream = get_copy_stream();
     switch (dst->getTensorDesc().getPrecision()) {
     case Precision::FP32: copyResultToOutputBlob<float>(src, dst, bi, stream);    break;
     case Precision::FP16: copyResultToOutputBlob<uint16_t>(src, dst, bi, stream); break;
@@ -1086,6 +1102,7 @@ void InferRequest::InferImpl() {
     setup_stream_graph();
     std::lock_guard<std::mutex> lk(m_graph->get_mutex());
     preprocess();
+    auto execution_lock = m_graph->lock_execution();
     enqueue();
     wait();
 }
@@ -1111,7 +1128,7 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
     cldnn::primitive_id internalName = "parameter:" + inputName;
     const auto& prec = inputBlob->getTensorDesc().getPrecision();
     auto remote_ptr = inputBlob->as<gpu::ClBlob>();
-    auto& stream = m_graph->GetNetwork()->get_stream();
+    auto& stream = get_copy_stream();
     bool is_dev_input = remote_ptr != nullptr;
 
     switch (prec) {
@@ -1152,9 +1169,18 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
                 } else {
                     auto src_lock = inputBlob->cbuffer();
                     auto src_ptr = src_lock.as<uint8_t*>();
+                    auto& engine = _nw_ptr->get_engine();
                     if (!same_host_mem(inputMem, src_ptr)) {
-                        auto ev = inputMem->copy_from(stream, src_ptr);
-                        dependencies.push_back(ev);
+                        if (engine.can_share_host_ptr(src_ptr, inputMem->size())) {
+                            // the integrated GPU reads the user blob in place, the buffer is kept while the blob is the same
+                            auto& shared = sharedHostInputs[inputName];
+                            if (shared.first != src_ptr || shared.second->get_layout() != inputMem->get_layout())
+                                shared = { src_ptr, engine.share_host_ptr(inputMem->get_layout(), src_ptr) };
+                            inputMem = shared.second;
+                        } else {
+                            auto ev = inputMem->copy_from(stream, src_ptr);
+                            dependencies.push_back(ev);
+                        }
                     }
                 }
             }
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/plugin/network_serializer.hpp"
+
+#include <sstream>
+#include <unordered_map>
+
+#include <openvino/pass/serialize.hpp>
+#include <pugixml.hpp>
+
+#include "ie_common.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace runtime {
+namespace intel_gpu {
+
+namespace {
+std::string to_string(InferenceEngine::Layout layout) {
+    std::stringstream ss;
+    ss << layout;
+    return ss.str();
+}
+
+InferenceEngine::Layout layout_from_string(const std::string& name) {
+    using InferenceEngine::Layout;
+    static const std::unordered_map<std::string, Layout> layouts = {
+        { "ANY", Layout::ANY }, { "NCHW", Layout::NCHW }, { "NHWC", Layout::NHWC }, { "NCDHW", Layout::NCDHW },
+        { "NDHWC", Layout::NDHWC }, { "OIHW", Layout::OIHW }, { "C", Layout::C }, { "CHW", Layout::CHW },
+        { "HWC", Layout::HWC }, { "HW", Layout::HW }, { "NC", Layout::NC }, { "CN", Layout::CN },
+        { "SCALAR", Layout::SCALAR }, { "BLOCKED", Layout::BLOCKED }
+    };
+    auto it = layouts.find(name);
+    if (it == layouts.end())
+        IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
+    return it->second;
+}
+
+template <typename T>
+void append_info(pugi::xml_node parent, const char* name, const T& info) {
+    for (const auto& item : info) {
+        auto node = parent.append_child(name);
+        node.append_attribute("name").set_value(item.first.c_str());
+        node.append_attribute("precision").set_value(item.second->getPrecision().name());
+        node.append_attribute("layout").set_value(to_string(item.second->getLayout()).c_str());
+    }
+}
+
+template <typename T>
+void set_info(pugi::xml_object_range<pugi::xml_named_node_iterator>&& nodes, T&& info) {
+    for (auto node : nodes) {
+        auto name_attr = node.attribute("name");
+        auto precision_attr = node.attribute("precision");
+        auto layout_attr = node.attribute("layout");
+        if (!name_attr || !precision_attr || !layout_attr)
+            IE_THROW(NetworkNotRead) << "The inputs/outputs information is invalid.";
+
+        auto it = info.find(name_attr.value());
+        if (it == info.end())
+            IE_THROW(NetworkNotRead) << "The input/output with name '" << name_attr.value() << "' not found";
+        it->second->setPrecision(Precision::FromStr(precision_attr.value()));
+        it->second->setLayout(layout_from_string(layout_attr.value()));
+    }
+}
+}  // namespace
+
+NetworkSerializer::NetworkSerializer(std::ostream& ostream) : m_ostream(ostream) {}
+
+void NetworkSerializer::operator<<(const CNNNetwork& network) {
+    auto serialize_inputs_and_outputs = [&](std::ostream& stream) {
+        pugi::xml_document xml_doc;
+        pugi::xml_node root = xml_doc.append_child("cnndata");
+        append_info(root.append_child("inputs"), "in", network.getInputsInfo());
+        append_info(root.append_child("outputs"), "out", network.getOutputsInfo());
+        xml_doc.save(stream);
+    };
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    ov::pass::StreamSerialize serializer(m_ostream, {}, serialize_inputs_and_outputs);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+}
+
+NetworkDeserializer::NetworkDeserializer(std::istream& istream, network_builder builder)
+    : m_istream(istream), m_builder(std::move(builder)) {}
+
+void NetworkDeserializer::operator>>(CNNNetwork& network) {
+    ov::pass::StreamSerialize::DataHeader hdr = {};
+    m_istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
+    if (!m_istream)
+        IE_THROW(NetworkNotRead) << "The compiled model header is invalid.";
+
+    // the offsets are the positions in the stream the network was exported to, e.g. after the core cache header
+    std::string xml_in_out(hdr.custom_data_size, '\0');
+    m_istream.seekg(hdr.custom_data_offset);
+    m_istream.read(&xml_in_out[0], hdr.custom_data_size);
+    pugi::xml_document xml_in_out_doc;
+    if (xml_in_out_doc.load_string(xml_in_out.c_str()).status != pugi::status_ok)
+        IE_THROW(NetworkNotRead) << "The inputs and outputs information is invalid.";
+
+    Blob::Ptr weights;
+    if (hdr.consts_size) {
+        weights = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {hdr.consts_size}, Layout::C));
+        weights->allocate();
+        m_istream.seekg(hdr.consts_offset);
+        m_istream.read(weights->buffer(), hdr.consts_size);
+    }
+
+    std::string xml(hdr.model_size, '\0');
+    m_istream.seekg(hdr.model_offset);
+    m_istream.read(&xml[0], hdr.model_size);
+    if (!m_istream)
+        IE_THROW(NetworkNotRead) << "The compiled model is truncated.";
+
+    network = m_builder(xml, weights);
+
+    pugi::xml_node root = xml_in_out_doc.child("cnndata");
+    set_info(root.child("inputs").children("in"), network.getInputsInfo());
+    set_info(root.child("outputs").children("out"), network.getOutputsInfo());
+}
+
+}  // namespace intel_gpu
+}  // namespace runtime
+}  // namespace ov
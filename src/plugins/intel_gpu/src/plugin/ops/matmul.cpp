@@ -7,7 +7,9 @@
 
 #include "ngraph/op/matmul.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/fake_quantize.hpp"
+#include "ngraph/op/multiply.hpp"
 
 #include "intel_gpu/primitives/gemm.hpp"
 #include "intel_gpu/primitives/fully_connected.hpp"
@@ -54,6 +56,39 @@ static std::pair<ngraph::Shape, ngraph::Shape> get_aligned_shapes(const ngraph::
     return {shape_a_aligned, shape_b_aligned};
 }
 
+/*
+*  get_compressed_weights function matches the weights compressed to int8 with the per output feature scales:
+*  MatMul(X, Multiply(Convert(Constant i8 [N, K]), Constant [N, 1])) with transpose_b. The int8 constant and the scales
+*  are given to the FC as is, so the weights take one byte per value and are decompressed by the kernel.
+*/
+static bool get_compressed_weights(Program& p,
+                                   const std::shared_ptr<ngraph::op::v0::MatMul>& matmul,
+                                   cldnn::primitive_id& weights,
+                                   cldnn::primitive_id& scale) {
+    if (!matmul->get_transpose_b() || !matmul->get_input_element_type(0).is_real())
+        return false;
+
+    auto multiply = std::dynamic_pointer_cast<ngraph::op::v1::Multiply>(matmul->get_input_node_shared_ptr(1));
+    if (!multiply)
+        return false;
+    auto convert = std::dynamic_pointer_cast<ngraph::op::v0::Convert>(multiply->get_input_node_shared_ptr(0));
+    auto scale_const = std::dynamic_pointer_cast<ngraph::op::v0::Constant>(multiply->get_input_node_shared_ptr(1));
+    if (!convert || !scale_const)
+        return false;
+    auto weights_const = std::dynamic_pointer_cast<ngraph::op::v0::Constant>(convert->get_input_node_shared_ptr(0));
+    if (!weights_const || weights_const->get_output_element_type(0) != ngraph::element::i8)
+        return false;
+
+    const auto& weights_shape = weights_const->get_shape();
+    const auto& scale_shape = scale_const->get_shape();
+    if (weights_shape.size() != 2 || scale_shape != ngraph::Shape{weights_shape[0], 1})
+        return false;
+
+    weights = p.GetInputPrimitiveIDs(convert)[0];
+    scale = p.GetInputPrimitiveIDs(multiply)[1];
+    return true;
+}
+
 static void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::MatMul>& op) {
     p.ValidateInputs(op, {2});
     auto inputPrimitives = p.GetInputPrimitiveIDs(op);
@@ -77,6 +112,8 @@ static void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::Mat
 
         auto inputName = inputPrimitives[0];
         auto weightsName = inputPrimitives[1];
+        cldnn::primitive_id decompressionScaleName;
+        get_compressed_weights(p, op, weightsName, decompressionScaleName);
 
         // Weights normalization
         if (!op->get_transpose_b()) {
@@ -154,6 +191,8 @@ static void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::Mat
                                              op->get_friendly_name(),
                                              cldnn::padding(),
                                              input_rank);
+        fcPrim.decompression_scale = decompressionScaleName;
+        fcPrim.dynamic_quantization = p.GetConfig().enable_dynamic_quantization && !decompressionScaleName.empty();
 
         p.AddPrimitive(fcPrim);
 
@@ -22,6 +22,7 @@
 #include "intel_gpu/plugin/transformations_pipeline.hpp"
 #include "intel_gpu/plugin/custom_layer.hpp"
 #include "intel_gpu/plugin/itt.hpp"
+#include "intel_gpu/plugin/network_serializer.hpp"
 #include "gpu/gpu_config.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
@@ -234,22 +235,7 @@ std::map<std::string, std::string> Plugin::ConvertPerfHintsToConfig(
     return config;
 }
 
-IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
-                                                                const std::map<std::string, std::string> &orig_config) {
-    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadExeNetworkImpl");
-    // verification of supported input
-    InferenceEngine::InputsDataMap _networkInputs = network.getInputsInfo();
-    check_inputs(_networkInputs);
-
-    Configs confs = _impl->m_configs;
-    std::string device_id = GetDeviceIDFromConfig(orig_config);
-    Config conf = confs.GetConfig(device_id);
-
-    auto config = ConvertPerfHintsToConfig(orig_config, conf);
-    UpdateConfig(conf, network, config);
-
-    RemoteCLContext::Ptr context;
-
+RemoteCLContext::Ptr Plugin::GetOrCreateDefaultContext(const Config& conf) {
     auto canReuseDefaultContext = [&]() -> bool {
         if (m_defaultContext == nullptr)
             return false;
@@ -270,18 +256,38 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
                context_config.device_id == current_config.device_id &&
                context_config.task_exec_config._streams == current_config.task_exec_config._streams &&
                context_config.task_exec_config._threadPreferredCoreType == current_config.task_exec_config._threadPreferredCoreType &&
-               context_config.enable_loop_unrolling == current_config.enable_loop_unrolling;
+               context_config.enable_loop_unrolling == current_config.enable_loop_unrolling &&
+               context_config.branch_queues == current_config.branch_queues &&
+               context_config.recorded_execution == current_config.recorded_execution &&
+               context_config.use_level_zero == current_config.use_level_zero;
     };
 
     {
-        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadExeNetworkImpl::CreateContext");
+        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::GetOrCreateDefaultContext");
         std::lock_guard<std::mutex> lock(engine_mutex);
         if (!canReuseDefaultContext()) {
             m_defaultContext.reset(new RemoteCLContext(shared_from_this(), AnyMap(), conf));
         }
     }
 
-    context = m_defaultContext;
+    return m_defaultContext;
+}
+
+IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
+                                                                const std::map<std::string, std::string> &orig_config) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadExeNetworkImpl");
+    // verification of supported input
+    InferenceEngine::InputsDataMap _networkInputs = network.getInputsInfo();
+    check_inputs(_networkInputs);
+
+    Configs confs = _impl->m_configs;
+    std::string device_id = GetDeviceIDFromConfig(orig_config);
+    Config conf = confs.GetConfig(device_id);
+
+    auto config = ConvertPerfHintsToConfig(orig_config, conf);
+    UpdateConfig(conf, network, config);
+
+    auto context = GetOrCreateDefaultContext(conf);
 
     auto transformedNetwork = CloneAndTransformNetwork(network, conf);
     {
@@ -311,6 +317,62 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
     return std::make_shared<CompiledModel>(transformedNetwork, casted, conf);
 }
 
+InferenceEngine::CNNNetwork Plugin::ReadExportedNetwork(std::istream& networkModel) const {
+    // Only the transformed model round-trips, the cldnn program is tied to the engine and is built again on import.
+    // The kernels are not compiled again if they are found in the kernels cache (CACHE_DIR).
+    NetworkDeserializer deserializer(networkModel, [this](const std::string& model, const Blob::CPtr& weights) {
+        return GetCore()->ReadNetwork(model, weights);
+    });
+    CNNNetwork network;
+    deserializer >> network;
+    return network;
+}
+
+IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(std::istream& networkModel,
+                                                      const std::map<std::string, std::string>& orig_config) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::ImportNetwork");
+    CNNNetwork network = ReadExportedNetwork(networkModel);
+
+    std::string device_id = GetDeviceIDFromConfig(orig_config);
+    Config conf = _impl->m_configs.GetConfig(device_id);
+    auto config = ConvertPerfHintsToConfig(orig_config, conf);
+    UpdateConfig(conf, network, config);
+
+    auto context = GetOrCreateDefaultContext(conf);
+
+    auto exeNetwork = std::make_shared<CompiledModel>(network, context, conf);
+    exeNetwork->setNetworkInputs(network.getInputsInfo());
+    exeNetwork->setNetworkOutputs(network.getOutputsInfo());
+    SetExeNetworkInfo(exeNetwork, network.getFunction());
+    UpdateStatistics(context);
+    return exeNetwork;
+}
+
+IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(std::istream& networkModel,
+                                                      const InferenceEngine::RemoteContext::Ptr& context,
+                                                      const std::map<std::string, std::string>& orig_config) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::ImportNetwork");
+    auto casted = std::dynamic_pointer_cast<ClContext>(context);
+    if (nullptr == casted) {
+        IE_THROW() << "Invalid context";
+    }
+
+    CNNNetwork network = ReadExportedNetwork(networkModel);
+
+    Config conf = getContextImpl(casted)->GetConfig();
+    auto config = ConvertPerfHintsToConfig(orig_config, conf);
+    UpdateConfig(conf, network, config);
+
+    auto exeNetwork = std::make_shared<CompiledModel>(network, casted, conf);
+    exeNetwork->setNetworkInputs(network.getInputsInfo());
+    exeNetwork->setNetworkOutputs(network.getOutputsInfo());
+    SetExeNetworkInfo(exeNetwork, network.getFunction());
+    // the memory statistics are collected for the OpenCL contexts, as on the default context path
+    if (auto clContext = std::dynamic_pointer_cast<RemoteCLContext>(casted))
+        UpdateStatistics(clContext);
+    return exeNetwork;
+}
+
 InferenceEngine::RemoteContext::Ptr Plugin::CreateContext(const AnyMap& params) {
     // parameter map is non-empty
     std::string contextTypeStr = _StrFromParams(params, GPU_PARAM_KEY(CONTEXT_TYPE));
@@ -708,6 +770,7 @@ Parameter Plugin::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(GPU_METRIC_KEY(UARCH_VERSION));
         metrics.push_back(GPU_METRIC_KEY(EXECUTION_UNITS_COUNT));
         metrics.push_back(GPU_METRIC_KEY(MEMORY_STATISTICS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
         std::vector<std::string> availableDevices = { };
@@ -849,8 +912,11 @@ Parameter Plugin::GetMetric(const std::string& name, const std::map<std::string,
             capabilities.push_back(ov::device::capability::INT8);
         if (device_info.supports_immad)
             capabilities.push_back(ov::intel_gpu::capability::HW_MATMUL);
+        capabilities.push_back(ov::device::capability::EXPORT_IMPORT);
 
         return decltype(ov::device::capabilities)::value_type {capabilities};
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else if (name == ov::range_for_async_infer_requests) {
         std::tuple<unsigned int, unsigned int, unsigned int> range = std::make_tuple(1, 2, 1);
         IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, range);
@@ -949,6 +1015,9 @@ Parameter Plugin::GetMetric(const std::string& name, const std::map<std::string,
         InferenceEngine::CNNNetwork network(model);
         size_t base_batch_size = 16; // empirically decided for DG1
         auto engine_params = Plugin::GetParams(config, device, nullptr);
+        // the memory is estimated on the OpenCL device of the plugin whatever runtime executes the model
+        engine_params.engine_type = cldnn::engine_types::ocl;
+        engine_params.runtime_type = cldnn::runtime_types::ocl;
         auto engine = cldnn::engine::create(engine_params.engine_type, engine_params.runtime_type, device,
                                 cldnn::engine_configuration(false, engine_params.queue_type, std::string(),
                                 config.queuePriority, config.queueThrottle, config.memory_pool_on,
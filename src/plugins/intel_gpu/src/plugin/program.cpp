@@ -329,7 +329,14 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(const std::vector<std::sha
     }
 
     options.set_option(cldnn::build_option::optimize_data(true));
-    options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+    auto tuningConfig = m_config.tuningConfig;
+    if (tuningConfig.mode != cldnn::tuning_mode::tuning_disabled && tuningConfig.cache_file_path.empty() &&
+        !m_config.kernels_cache_dir.empty()) {
+        // the tuned kernels are specific to the device, so the cache in the cache dir is kept per device ID
+        tuningConfig.cache_file_path = m_config.kernels_cache_dir + "/tuning_cache_" +
+                                       std::to_string(m_engine->get_device_info().device_id) + ".json";
+    }
+    options.set_option(cldnn::build_option::tuning_config(tuningConfig));
     if (partialBuild) {
         options.set_option(cldnn::build_option::partial_build_program(true));
     }
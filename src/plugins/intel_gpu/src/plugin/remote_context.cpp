@@ -301,9 +301,10 @@ ExecutionContextImpl::ExecutionContextImpl(const std::shared_ptr<IInferencePlugi
         }
     }
 
-    // TODO: Parameterize this based on plugin config and compilation options
-    auto engine_type = cldnn::engine_types::ocl;
-    auto runtime_type = cldnn::runtime_types::ocl;
+    auto engine_type = m_config.use_level_zero ? cldnn::engine_types::ze : cldnn::engine_types::ocl;
+    auto runtime_type = m_config.use_level_zero ? cldnn::runtime_types::ze : cldnn::runtime_types::ocl;
+    if (m_config.use_level_zero && (_context_id || _va_device || m_external_queue))
+        IE_THROW() << "Level Zero runtime of GPU plugin can't be used with the user OpenCL context, queue or VA device";
     // Use actual runtime and engine types
     cldnn::device_query device_query(engine_type, runtime_type, _context_id, _va_device, ctx_device_id, target_tile_id);
     auto device_map = device_query.get_available_devices();
@@ -311,22 +312,21 @@ ExecutionContextImpl::ExecutionContextImpl(const std::shared_ptr<IInferencePlugi
     auto iter = device_map.find(m_config.device_id);
     auto& dev = iter != device_map.end() ? iter->second : device_map.begin()->second;
 
-    bool enable_profiling = (m_config.useProfiling ||
-                            (m_config.tuningConfig.mode == cldnn::tuning_mode::tuning_tune_and_cache) ||
-                            (m_config.tuningConfig.mode == cldnn::tuning_mode::tuning_retune_and_cache));
-
     auto engine_params = Plugin::GetParams(m_config, dev, m_external_queue);
+    cldnn::engine_configuration engine_config(m_config.useProfiling,
+                                              engine_params.queue_type,
+                                              m_config.sources_dumps_dir,
+                                              m_config.queuePriority,
+                                              m_config.queueThrottle,
+                                              m_config.memory_pool_on,
+                                              engine_params.use_unified_shared_memory,
+                                              m_config.kernels_cache_dir,
+                                              m_config.throughput_streams);
+    engine_config.branch_queues = m_config.branch_queues;
+    engine_config.recorded_execution = m_config.recorded_execution;
     m_engine = cldnn::engine::create(engine_params.engine_type,
                                      engine_params.runtime_type, dev,
-                                     cldnn::engine_configuration(enable_profiling,
-                                         engine_params.queue_type,
-                                         m_config.sources_dumps_dir,
-                                         m_config.queuePriority,
-                                         m_config.queueThrottle,
-                                         m_config.memory_pool_on,
-                                         engine_params.use_unified_shared_memory,
-                                         m_config.kernels_cache_dir,
-                                         m_config.throughput_streams),
+                                     engine_config,
                                      engine_params.task_executor);
 }
 
@@ -22,6 +22,7 @@
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/rt_info.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <ie_algorithm.hpp>
 
@@ -99,6 +100,63 @@ static bool disableReduceDecomposition(const std::shared_ptr<const ngraph::Node>
     }
     return false;
 }
+
+// Compresses the float constant weights [N, K] (or [K, N] without transpose_b) of the MatMuls to int8 with per output
+// feature scales: MatMul(X, Multiply(Convert(Constant i8 [N, K]), Constant [N, 1])) with transpose_b, the same subgraph
+// the FC takes the int8 weights with the decompression scales from
+static void compress_matmul_weights(const std::shared_ptr<ov::Model>& func) {
+    // the weights shared by several MatMuls are compressed once for each layout they are used in
+    std::map<std::pair<ngraph::Node*, bool>, std::shared_ptr<ngraph::Node>> compressed_weights;
+    for (const auto& node : func->get_ordered_ops()) {
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!matmul || !matmul->get_input_element_type(0).is_real() || matmul->get_input_partial_shape(0).is_dynamic() ||
+            matmul->get_input_shape(0).size() < 2)
+            continue;
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(matmul->get_input_node_shared_ptr(1));
+        if (!weights || !weights->get_output_element_type(0).is_real() || weights->get_shape().size() != 2)
+            continue;
+
+        const bool transpose_b = matmul->get_transpose_b();
+        auto& decompressed = compressed_weights[{weights.get(), transpose_b}];
+        if (decompressed) {
+            matmul->input(1).replace_source_output(decompressed);
+            matmul->set_transpose_b(true);
+            continue;
+        }
+
+        const auto& shape = weights->get_shape();
+        const size_t N = transpose_b ? shape[0] : shape[1];
+        const size_t K = transpose_b ? shape[1] : shape[0];
+        const auto values = weights->cast_vector<float>();
+
+        std::vector<int8_t> compressed(N * K);
+        std::vector<float> scales(N);
+        for (size_t n = 0; n < N; n++) {
+            auto value = [&](size_t k) { return transpose_b ? values[n * K + k] : values[k * N + n]; };
+            float max_abs = 0.f;
+            for (size_t k = 0; k < K; k++)
+                max_abs = std::max(max_abs, std::fabs(value(k)));
+            scales[n] = max_abs > 0.f ? max_abs / 127.f : 1.f;
+            for (size_t k = 0; k < K; k++)
+                compressed[n * K + k] = static_cast<int8_t>(std::round(value(k) / scales[n]));
+        }
+
+        const auto type = weights->get_output_element_type(0);
+        auto compressed_const = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i8, ngraph::Shape{N, K}, compressed);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(compressed_const, type);
+        auto scales_const = std::make_shared<ngraph::opset1::Constant>(type, ngraph::Shape{N, 1}, scales);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scales_const);
+        compressed_const->set_friendly_name(weights->get_friendly_name() + "/compressed");
+        scales_const->set_friendly_name(weights->get_friendly_name() + "/scales");
+        multiply->set_friendly_name(weights->get_friendly_name() + "/decompressed");
+        ngraph::copy_runtime_info(weights, {compressed_const, convert, scales_const, multiply});
+        ov::disable_constant_folding(convert);
+
+        decompressed = multiply;
+        matmul->input(1).replace_source_output(multiply);
+        matmul->set_transpose_b(true);
+    }
+}
 }  // namespace
 
 namespace ov {
@@ -111,7 +169,7 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
 
     bool use_onednn = false;
 #ifdef ENABLE_ONEDNN_FOR_GPU
-    use_onednn = device_info.supports_immad;
+    use_onednn = device_info.supports_immad && !config.use_level_zero;
 #endif
 
     bool enableInt8;
@@ -123,6 +181,20 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
         if (enableInt8) {
             manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
                 std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+        } else {
+            // keeps the int8 weights of the MatMuls compressed, the FC multiplies them by the scales in the kernel
+            for (const auto& node : func->get_ordered_ops()) {
+                if (!ngraph::is_type<ngraph::opset1::MatMul>(node))
+                    continue;
+                auto multiply = std::dynamic_pointer_cast<ngraph::opset1::Multiply>(node->get_input_node_shared_ptr(1));
+                if (!multiply)
+                    continue;
+                auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(multiply->get_input_node_shared_ptr(0));
+                if (convert && convert->get_input_element_type(0) == ngraph::element::i8 &&
+                    ngraph::is_type<ngraph::opset1::Constant>(convert->get_input_node_ptr(0)) &&
+                    ngraph::is_type<ngraph::opset1::Constant>(multiply->get_input_node_ptr(1)))
+                    ov::disable_constant_folding(convert);
+            }
         }
 
         manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -453,6 +525,11 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
         lptManager.run_passes(func);
     }
 
+    if (config.enable_dynamic_quantization && !enableInt8) {
+        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "TransformationsPipeline::apply::compress_matmul_weights");
+        compress_matmul_weights(func);
+    }
+
     {
         OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "TransformationsPipeline::apply::run_passes");
         ngraph::pass::Manager manager;
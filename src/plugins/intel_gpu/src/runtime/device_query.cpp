@@ -4,6 +4,9 @@
 
 #include "intel_gpu/runtime/device_query.hpp"
 #include "ocl/ocl_device_detector.hpp"
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+#include "ze/ze_device.hpp"
+#endif
 
 #include <map>
 #include <string>
@@ -25,6 +28,19 @@ device_query::device_query(engine_types engine_type,
         _available_devices = ocl_detector.get_available_devices(user_context, user_device, ctx_device_id, target_tile_id);
         break;
     }
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+    case engine_types::ze: {
+        if (runtime_type != runtime_types::ze)
+            throw std::runtime_error("Unsupported runtime type for Level Zero engine");
+
+        // the kernels are still built by OpenCL, so each Level Zero device keeps its OpenCL twin
+        ocl::ocl_device_detector ocl_detector;
+        ze::ze_device_detector ze_detector;
+        auto ocl_devices = ocl_detector.get_available_devices(user_context, user_device, ctx_device_id, target_tile_id);
+        _available_devices = ze_detector.get_available_devices(ocl_devices);
+        break;
+    }
+#endif
     default: throw std::runtime_error("Unsupported engine type in device_query");
     }
 
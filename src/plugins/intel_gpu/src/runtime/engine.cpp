@@ -10,6 +10,9 @@
 #include "intel_gpu/runtime/debug_configuration.hpp"
 
 #include "ocl/ocl_engine_factory.hpp"
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+#include "ze/ze_engine_factory.hpp"
+#endif
 
 #include <string>
 #include <vector>
@@ -103,6 +106,25 @@ memory_ptr engine::share_usm(const layout& layout, shared_handle usm_ptr) {
     return reinterpret_handle(layout, params);
 }
 
+memory_ptr engine::share_host_ptr(const layout& layout, void* ptr) {
+    shared_mem_params params = { shared_mem_type::shared_mem_host_ptr, nullptr, nullptr, ptr,
+#ifdef _WIN32
+        nullptr,
+#else
+        0,
+#endif
+        0 };
+    return reinterpret_handle(layout, params);
+}
+
+bool engine::can_share_host_ptr(const void* ptr, size_t size) const {
+    const size_t page_size = 4096;
+    const size_t cache_line_size = 64;
+    return get_device_info().dev_type == device_type::integrated_gpu &&
+           reinterpret_cast<uintptr_t>(ptr) % page_size == 0 &&
+           size % cache_line_size == 0;
+}
+
 memory::ptr engine::share_image(const layout& layout, shared_handle img) {
     shared_mem_params params = { shared_mem_type::shared_mem_image, nullptr, nullptr, img,
 #ifdef _WIN32
@@ -203,6 +225,9 @@ std::shared_ptr<cldnn::engine> engine::create(engine_types engine_type,
                                               const InferenceEngine::ITaskExecutor::Ptr task_executor) {
     switch (engine_type) {
         case engine_types::ocl: return ocl::create_ocl_engine(device, runtime_type, configuration, task_executor);
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+        case engine_types::ze: return ze::create_ze_engine(device, runtime_type, configuration, task_executor);
+#endif
         default: throw std::runtime_error("Invalid engine type");
     }
 }
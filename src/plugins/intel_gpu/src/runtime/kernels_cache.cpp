@@ -5,7 +5,11 @@
 #include "kernels_factory.hpp"
 #include "kernels_cache.hpp"
 #include "ocl/ocl_engine.hpp"
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+#include "ze/ze_device.hpp"
+#endif
 #include "intel_gpu/runtime/debug_configuration.hpp"
+#include "intel_gpu/runtime/utils.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -15,6 +19,7 @@
 #include <string>
 #include <memory>
 #include <utility>
+#include <iterator>
 
 #include "cldnn_itt.hpp"
 #if defined(__unix__) && !defined(__ANDROID__)
@@ -129,6 +134,21 @@ inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
 
+// The entry point has the ids of the program and the node, so the kernels which differ in it only are the same kernel.
+// The whole normalized source is the key, so the kernels with colliding hashes are never mixed up.
+std::string get_compiled_kernel_key(const cldnn::kernel_string& code) {
+    std::string full_code = code.options + " " + code.jit + code.str + code.undefs;
+    const auto& entry_point = code.entry_point;
+    if (!entry_point.empty()) {
+        const std::string placeholder = "__ENTRY_POINT__";
+        for (auto pos = full_code.find(entry_point); pos != std::string::npos;
+             pos = full_code.find(entry_point, pos + placeholder.size())) {
+            full_code.replace(pos, entry_point.size(), placeholder);
+        }
+    }
+    return full_code;
+}
+
 }  // namespace
 
 namespace cldnn {
@@ -155,6 +175,11 @@ size_t kernels_cache::get_max_kernels_per_batch() const {
     return 10;
 }
 
+size_t kernels_cache::get_max_batch_source_size() const {
+    // the batches of the big kernels are split earlier, so a few of them don't build long after the rest are done
+    return 256 * 1024;
+}
+
 
 void kernels_cache::get_program_source(const kernels_code& kernels_source_code, std::vector<kernels_cache::batch_program>* all_batches) const {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "KernelsCache::BuildAll::GetProgramSource");
@@ -191,7 +216,8 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
         }
 
         // Create new kernels batch when the limit is reached
-        if (current_bucket.back().kernels_counter >= get_max_kernels_per_batch()) {
+        if (current_bucket.back().kernels_counter >= get_max_kernels_per_batch() ||
+            current_bucket.back().source_size >= get_max_batch_source_size()) {
             const auto& bucket_id =  static_cast<int32_t>(program_buckets.size());
             const auto& batch_id = static_cast<int32_t>(current_bucket.size());
             current_bucket.push_back(batch_program(bucket_id, batch_id, options, batch_header_str));
@@ -201,6 +227,7 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
         current_batch.dump_custom_program = dump_custom_program;
         current_batch.entry_point_to_id[entry_point] = code.id;
 
+        current_batch.source_size += full_code.size();
         current_batch.source.push_back(std::move(full_code));
         current_batch.kernels_counter++;
     }
@@ -221,10 +248,70 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
             all_batches->push_back(b);
         }
     }
+
+    // The biggest batches are built first, so the small ones fill the threads up at the end
+    std::stable_sort(all_batches->begin(), all_batches->end(), [](const batch_program& lhs, const batch_program& rhs) {
+        return lhs.source_size > rhs.source_size;
+    });
 }
 
 kernels_cache::kernels_cache(engine& engine, uint32_t prog_id, const std::vector<std::string>& batch_header_str)
-                                : _engine(engine), _prog_id(prog_id), batch_header_str(std::move(batch_header_str)) { }
+                                : _engine(engine), _prog_id(prog_id), batch_header_str(std::move(batch_header_str)),
+                                  _compiled_kernels(get_compiled_kernels(engine)) { }
+
+std::shared_ptr<kernels_cache::compiled_kernels> kernels_cache::get_compiled_kernels(const engine& engine) {
+    // the kernels of the engine are kept while one of its caches exists, so the engine is alive as well
+    static std::mutex registry_mutex;
+    static std::map<const cldnn::engine*, std::weak_ptr<compiled_kernels>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto it = registry.begin(); it != registry.end();) {
+        it = it->second.expired() ? registry.erase(it) : std::next(it);
+    }
+    auto& entry = registry[&engine];
+    auto result = entry.lock();
+    if (!result) {
+        result = std::make_shared<compiled_kernels>();
+        entry = result;
+    }
+    return result;
+}
+
+void kernels_cache::take_compiled_kernels() {
+    std::lock_guard<std::mutex> lock(_compiled_kernels->mutex);
+    for (auto it = _kernels_code.begin(); it != _kernels_code.end();) {
+        // the dumped programs must be built to have the sources and the build log
+        if (it->dump_custom_program) {
+            ++it;
+            continue;
+        }
+
+        auto key = get_compiled_kernel_key(*it->kernel_strings);
+        auto compiled = _compiled_kernels->kernels.find(key);
+        auto kernel = compiled != _compiled_kernels->kernels.end() ? compiled->second.lock() : nullptr;
+        if (kernel) {
+            _kernels.insert({it->id, kernel});
+            it = _kernels_code.erase(it);
+        } else {
+            _compiled_kernel_keys[it->id] = std::move(key);
+            ++it;
+        }
+    }
+}
+
+void kernels_cache::share_compiled_kernels() {
+    std::lock_guard<std::mutex> lock(_compiled_kernels->mutex);
+    auto& kernels = _compiled_kernels->kernels;
+    for (auto it = kernels.begin(); it != kernels.end();) {
+        it = it->second.expired() ? kernels.erase(it) : std::next(it);
+    }
+    for (const auto& key : _compiled_kernel_keys) {
+        auto kernel = _kernels.find(key.first);
+        if (kernel != _kernels.end())
+            kernels[key.second] = kernel->second;
+    }
+    _compiled_kernel_keys.clear();
+}
 
 kernel_id kernels_cache::set_kernel_source(
     const std::shared_ptr<kernel_string>& kernel_string,
@@ -305,8 +392,11 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
             precompiled_kernels.push_back(bin);
         }
     }
+    // The engines of the other runtimes load the native binary built by OpenCL
+    const bool native_kernels = _engine.type() != engine_types::ocl;
     try {
         cl::vector<cl::Kernel> kernels;
+        std::vector<unsigned char> binary;
 
         // Run compilation
         if (precompiled_kernels.empty()) {
@@ -326,19 +416,40 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
 
             program.createKernels(&kernels);
 
+            if (is_cache_enabled() || native_kernels)
+                binary = getProgramBinaries(program);
+
             if (is_cache_enabled()) {
                 // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
                 // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
                 // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
                 // compile time.
-                saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
+                saveBinaryToFile(cached_bin_name, binary);
             }
         } else {
             cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
             program.build(cl_build_engine.get_cl_device(), batch.options.c_str());
             program.createKernels(&kernels);
+            if (native_kernels)
+                binary = precompiled_kernels.front();
         }
-        {
+        if (native_kernels) {
+            std::vector<std::string> entry_points;
+            std::vector<kernel_id> ids;
+            for (auto& k : kernels) {
+                const auto& entry_point = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                const auto& k_id = batch.entry_point_to_id.find(entry_point);
+                if (k_id == batch.entry_point_to_id.end())
+                    throw std::runtime_error("Could not find entry point");
+                entry_points.push_back(entry_point);
+                ids.push_back(k_id->second);
+            }
+            auto native = kernels_factory::create(_engine, binary, entry_points);
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < native.size(); i++)
+                _kernels.insert(std::make_pair(ids[i], native[i]));
+        } else {
             std::lock_guard<std::mutex> lock(_mutex);
             for (auto& k : kernels) {
                 const auto& entry_point = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
@@ -412,23 +523,34 @@ void kernels_cache::build_all() {
     if (_engine.type() == engine_types::ocl) {
         _build_engine = std::unique_ptr<ocl::ocl_engine>(new ocl::ocl_engine(_engine.get_device(), runtime_types::ocl,
                                                                     _engine.configuration(), _engine.get_task_executor()));
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+    } else if (_engine.type() == engine_types::ze) {
+        // Level Zero has no online compiler of OpenCL C, so the kernels are built on the OpenCL twin of the device
+        auto ocl_device = downcast<const ze::ze_device>(*_engine.get_device()).get_ocl_device();
+        _build_engine = std::unique_ptr<ocl::ocl_engine>(new ocl::ocl_engine(ocl_device, runtime_types::ocl,
+                                                                    _engine.configuration(), _engine.get_task_executor()));
+#endif
     }
     std::vector<batch_program> batches;
     {
         std::lock_guard<std::mutex> lock(_mutex);
+        take_compiled_kernels();
         get_program_source(_kernels_code, &batches);
     }
 
     auto _task_executor = _engine.get_task_executor();
     std::exception_ptr exception;
+    std::mutex exception_mutex;
     std::vector<InferenceEngine::Task> tasks;
     for (int idx = 0; idx < batches.size(); idx++) {
         auto& batch = batches[idx];
-        tasks.push_back([this, &_build_engine, batch, &exception] {
+        tasks.push_back([this, &_build_engine, batch, &exception, &exception_mutex] {
             try {
                 build_batch(*_build_engine, batch);
             } catch(...) {
-                exception = std::current_exception();
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception)
+                    exception = std::current_exception();
             }
         });
     }
@@ -441,6 +563,7 @@ void kernels_cache::build_all() {
 
     {
         std::lock_guard<std::mutex> lock(_mutex);
+        share_compiled_kernels();
         _kernels_code.clear();
         _pending_compilation = false;
 #if defined(__unix__) && !defined(__ANDROID__)
@@ -457,6 +580,7 @@ void kernels_cache::build_all() {
 void kernels_cache::reset() {
     _kernels.clear();
     _kernels_code.clear();
+    _compiled_kernel_keys.clear();
     _pending_compilation = false;
 }
 
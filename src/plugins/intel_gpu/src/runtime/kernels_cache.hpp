@@ -14,6 +14,7 @@
 #include <atomic>
 #include <string>
 #include <set>
+#include <unordered_map>
 
 #include <threading/ie_cpu_streams_executor.hpp>
 
@@ -26,6 +27,8 @@ public:
         int32_t batch_id;
         size_t hash_value;
         uint32_t kernels_counter;
+        // bytes of the kernels sources, the estimate of the build time
+        size_t source_size;
         source_code source;
         std::string options;
         bool dump_custom_program;
@@ -36,6 +39,7 @@ public:
               batch_id(_batch_id),
               hash_value(0),
               kernels_counter(0),
+              source_size(0),
               source(std::move(batch_header_str)),
               options(_options),
               dump_custom_program(false),
@@ -70,6 +74,13 @@ public:
 
     using kernels_code = std::set<kernel_code, cmp_kernel_code>;
 
+    // The kernels compiled by all the caches of one engine, so the programs of the related models don't build the same
+    // kernels again. A kernel is kept while one of the programs holds it, the instances execute its clones.
+    struct compiled_kernels {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::weak_ptr<kernel>> kernels;
+    };
+
 private:
     static std::mutex _mutex;
     engine& _engine;
@@ -78,13 +89,20 @@ private:
     std::atomic<bool> _pending_compilation{false};
     std::map<const std::string, kernel::ptr> _kernels;
     std::vector<std::string> batch_header_str;
+    std::shared_ptr<compiled_kernels> _compiled_kernels;
+    // the keys of the compiled kernels of the pending kernels which are built by this cache
+    std::map<kernel_id, std::string> _compiled_kernel_keys;
 
+    static std::shared_ptr<compiled_kernels> get_compiled_kernels(const engine& engine);
+    void take_compiled_kernels();
+    void share_compiled_kernels();
     void get_program_source(const kernels_code& kernels_source_code, std::vector<batch_program>*) const;
     void build_batch(const engine& build_engine, const batch_program& batch);
 
     std::string get_cache_path() const;
     bool is_cache_enabled() const;
     size_t get_max_kernels_per_batch() const;
+    size_t get_max_batch_source_size() const;
 
 public:
     explicit kernels_cache(engine& engine, uint32_t prog_id, const std::vector<std::string>& batch_header_str = {});
@@ -9,6 +9,14 @@ namespace ocl {
 std::shared_ptr<kernel> create_ocl_kernel(engine& engine, cl_context context, cl_kernel kernel, std::string  entry_point);
 }  // namespace ocl
 
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+namespace ze {
+std::vector<std::shared_ptr<kernel>> create_ze_kernels(engine& engine,
+                                                       const std::vector<unsigned char>& binary,
+                                                       const std::vector<std::string>& entry_points);
+}  // namespace ze
+#endif
+
 namespace kernels_factory {
 
 std::shared_ptr<kernel> create(engine& engine, cl_context context, cl_kernel kernel, std::string  entry_point) {
@@ -18,5 +26,16 @@ std::shared_ptr<kernel> create(engine& engine, cl_context context, cl_kernel ker
     }
 }
 
+std::vector<std::shared_ptr<kernel>> create(engine& engine,
+                                            const std::vector<unsigned char>& binary,
+                                            const std::vector<std::string>& entry_points) {
+    switch (engine.type()) {
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+        case engine_types::ze: return ze::create_ze_kernels(engine, binary, entry_points);
+#endif
+        default: throw std::runtime_error("Unsupported engine type in kernels_factory::create");
+    }
+}
+
 }  // namespace kernels_factory
 }  // namespace cldnn
@@ -9,6 +9,8 @@
 #include "ocl/ocl_common.hpp"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cldnn {
 
@@ -18,5 +20,11 @@ namespace kernels_factory {
 // For ocl engine it creates a copy of kernel object
 std::shared_ptr<kernel> create(engine& engine, cl_context context, cl_kernel kernel, kernel_id kernel_id);
 
+// Creates the kernels of the entry points from the native binary of the program for the engines, which don't run
+// OpenCL kernels
+std::vector<std::shared_ptr<kernel>> create(engine& engine,
+                                            const std::vector<unsigned char>& binary,
+                                            const std::vector<std::string>& entry_points);
+
 }  // namespace kernels_factory
 }  // namespace cldnn
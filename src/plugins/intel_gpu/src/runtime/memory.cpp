@@ -47,6 +47,8 @@ memory::~memory() {
 std::unique_ptr<surfaces_lock> surfaces_lock::create(engine_types engine_type, std::vector<memory::ptr> mem, const stream& stream) {
     switch (engine_type) {
     case engine_types::ocl: return std::unique_ptr<ocl::ocl_surfaces_lock>(new ocl::ocl_surfaces_lock(mem, stream));
+    // Level Zero engine has no shared surfaces to acquire
+    case engine_types::ze: return std::unique_ptr<surfaces_lock>(new surfaces_lock());
     default: throw std::runtime_error("Unsupported engine type in surfaces_lock::create");
     }
 }
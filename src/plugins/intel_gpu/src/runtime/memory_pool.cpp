@@ -80,10 +80,10 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
             }
         }
     }
-    {
-        auto itr = _padded_pool.find(_layout);
+    auto release_from_layout_pool = [&](std::map<layout, std::list<memory_record>, padded_pool_comparer>& pool) {
+        auto itr = pool.find(_layout);
 
-        if (itr != _padded_pool.end()) {
+        if (itr != pool.end()) {
             auto& list = itr->second;
             auto list_itr = list.begin();
 
@@ -110,10 +110,12 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
             }
 
             if (list.empty()) {
-                _padded_pool.erase(itr);
+                pool.erase(itr);
             }
         }
-    }
+    };
+
+    release_from_layout_pool(_layout.format.is_image() ? _image_pool : _padded_pool);
 }
 
 memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
@@ -189,6 +191,30 @@ memory::ptr memory_pool::get_from_padded_pool(const layout& layout,
     return mem;
 }
 
+memory::ptr memory_pool::get_from_image_pool(const layout& layout,
+                                             const primitive_id& id,
+                                             uint32_t network_id,
+                                             const std::set<primitive_id>& restrictions,
+                                             allocation_type type) {
+    auto& list = _image_pool[layout];
+    for (auto& rec : list) {
+        if (rec._network_id == network_id &&
+            rec._type == type &&
+            rec._memory->get_layout() == layout &&
+            !has_conflict(rec._users, restrictions, network_id)) {
+            rec._users.insert({id, network_id});
+            return _engine->reinterpret_buffer(*rec._memory, layout);
+        }
+    }
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->verbose >= 2) {
+        GPU_DEBUG_COUT << "[" << id << ": output]" << std::endl;
+    }
+    auto mem = alloc_memory(layout, type);
+    list.emplace_back(memory_record({{id, network_id}}, mem, network_id, type));
+    return mem;
+}
+
 /*
         This is not reusable within one network or it's internal micronetworks. But we can use this memory records
    between networks.
@@ -237,8 +263,8 @@ memory::ptr memory_pool::get_memory(const layout& layout,
             // padded buffers
             return get_from_padded_pool(layout, id, network_id, restrictions, type);
         } else {
-            // images (reuse not yet implemented)
-            return alloc_memory(layout, type);
+            // images 2d
+            return get_from_image_pool(layout, id, network_id, restrictions, type);
         }
     } else {
         return alloc_memory(layout, type);
@@ -263,11 +289,11 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
         }
     }
 
-    // free up _padded_pool for this network
-    {
-        auto itr = _padded_pool.begin();
+    // free up _padded_pool and _image_pool for this network
+    for (auto pool : { &_padded_pool, &_image_pool }) {
+        auto itr = pool->begin();
 
-        while (itr != _padded_pool.end()) {
+        while (itr != pool->end()) {
             auto& list = itr->second;
             auto list_itr = list.begin();
 
@@ -280,7 +306,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
             }
 
             if (list.empty()) {
-                itr = _padded_pool.erase(itr);
+                itr = pool->erase(itr);
             } else {
                 itr++;
             }
@@ -52,6 +52,11 @@ ocl_engine::ocl_engine(const device::ptr dev, runtime_types runtime_type,
     casted->get_device().getInfo(CL_DEVICE_EXTENSIONS, &_extensions);
 
     _usm_helper.reset(new cl::UsmHelper(get_cl_context(), get_cl_device(), use_unified_shared_memory()));
+    if (conf.recorded_execution && extension_supported("cl_khr_command_buffer")) {
+        _command_buffer_helper.reset(new cl::CommandBufferHelper(get_cl_context()));
+        if (!_command_buffer_helper->is_supported())
+            _command_buffer_helper.reset();
+    }
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     _onednn_engine = std::make_shared<dnnl::engine>(dnnl::ocl_interop::make_engine(casted->get_device().get(), casted->get_context().get()));
@@ -85,6 +90,10 @@ const cl::UsmHelper& ocl_engine::get_usm_helper() const {
     return *_usm_helper;
 }
 
+const cl::CommandBufferHelper* ocl_engine::get_command_buffer_helper() const {
+    return _command_buffer_helper.get();
+}
+
 memory::ptr ocl_engine::allocate_memory(const layout& layout, allocation_type type, bool reset) {
     if (layout.bytes_count() > get_device_info().max_alloc_mem_size) {
         throw std::runtime_error("exceeded max size of memory object allocation");
@@ -183,6 +192,9 @@ memory::ptr ocl_engine::reinterpret_handle(const layout& new_layout, shared_mem_
                                          ") than specified layout (" + std::to_string(requested_mem_size) + ")");
             }
             return std::make_shared<ocl::gpu_usm>(this, new_layout, usm_buffer);
+        } else if (params.mem_type == shared_mem_type::shared_mem_host_ptr) {
+            cl::Buffer buf(get_cl_context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, new_layout.bytes_count(), params.mem);
+            return std::make_shared<ocl::gpu_buffer>(this, new_layout, buf);
         } else {
             throw std::runtime_error("unknown shared object fromat or type");
         }
@@ -233,6 +245,10 @@ stream::ptr ocl_engine::create_stream(void* handle) const {
     return std::make_shared<ocl_stream>(*this, handle);
 }
 
+stream::ptr ocl_engine::create_profiling_stream() const {
+    return std::make_shared<ocl_stream>(*this, true);
+}
+
 stream& ocl_engine::get_program_stream() const {
     return *_program_stream;
 }
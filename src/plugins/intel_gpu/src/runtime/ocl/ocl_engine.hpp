@@ -36,11 +36,14 @@ public:
     const cl::Context& get_cl_context() const;
     const cl::Device& get_cl_device() const;
     const cl::UsmHelper& get_usm_helper() const;
+    /// Returns nullptr if the recorded execution is disabled or cl_khr_command_buffer is not supported
+    const cl::CommandBufferHelper* get_command_buffer_helper() const;
 
     bool extension_supported(std::string extension) const;
 
     stream_ptr create_stream() const override;
     stream_ptr create_stream(void *handle) const override;
+    stream_ptr create_profiling_stream() const override;
     stream& get_program_stream() const override;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -55,6 +58,7 @@ private:
     std::string _extensions;
     std::unique_ptr<stream> _program_stream;
     std::unique_ptr<cl::UsmHelper> _usm_helper;
+    std::unique_ptr<cl::CommandBufferHelper> _command_buffer_helper;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::engine> _onednn_engine;
@@ -5,6 +5,7 @@
 #include "ocl_event.hpp"
 #include "intel_gpu/runtime/debug_configuration.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <vector>
@@ -93,6 +94,17 @@ bool ocl_event::get_profiling_info_impl(std::list<instrumentation::profiling_int
     return true;
 }
 
+bool ocl_event::get_device_timestamps(instrumentation::device_timestamps& timestamps) {
+    if (!is_event_profiled(_event))
+        return false;
+
+    _event.getProfilingInfo(CL_PROFILING_COMMAND_QUEUED, &timestamps.queued);
+    _event.getProfilingInfo(CL_PROFILING_COMMAND_SUBMIT, &timestamps.submit);
+    _event.getProfilingInfo(CL_PROFILING_COMMAND_START, &timestamps.start);
+    _event.getProfilingInfo(CL_PROFILING_COMMAND_END, &timestamps.end);
+    return true;
+}
+
 void ocl_events::wait_impl() {
     if (_last_ocl_event.get() != nullptr) {
         _last_ocl_event.wait();
@@ -110,6 +122,27 @@ bool ocl_events::is_set_impl() {
     return true;
 }
 
+bool ocl_events::get_device_timestamps(instrumentation::device_timestamps& timestamps) {
+    // the kernels of the primitive make up one span from the first enqueued to the last finished one
+    bool profiled = false;
+    for (auto& ev : _events) {
+        instrumentation::device_timestamps ev_timestamps;
+        if (!ev->get_device_timestamps(ev_timestamps))
+            continue;
+
+        if (!profiled) {
+            timestamps = ev_timestamps;
+            profiled = true;
+            continue;
+        }
+        timestamps.queued = std::min(timestamps.queued, ev_timestamps.queued);
+        timestamps.submit = std::min(timestamps.submit, ev_timestamps.submit);
+        timestamps.start = std::min(timestamps.start, ev_timestamps.start);
+        timestamps.end = std::max(timestamps.end, ev_timestamps.end);
+    }
+    return profiled;
+}
+
 bool ocl_events::get_profiling_info_impl(std::list<instrumentation::profiling_interval>& info) {
     // For every profiling period (i.e. submission / starting / executing),
     // the goal is to sum up all disjoint durations of its projection on the time axis
@@ -21,6 +21,7 @@ public:
         , _event(ev) {}
 
     cl::Event get() override { return _event; }
+    bool get_device_timestamps(instrumentation::device_timestamps& timestamps) override;
 
 private:
     bool _callback_set = false;
@@ -48,6 +49,7 @@ public:
     }
 
     cl::Event get() override { return _last_ocl_event; }
+    bool get_device_timestamps(instrumentation::device_timestamps& timestamps) override;
 
     void reset() override {
         event::reset();
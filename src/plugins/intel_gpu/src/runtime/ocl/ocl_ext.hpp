@@ -38,6 +38,47 @@ typedef cl_bitfield         cl_device_feature_capabilities_intel;
 #define CL_DEVICE_FEATURE_FLAG_DP4A_INTEL         (1 << 0)
 #define CL_DEVICE_FEATURE_FLAG_DPAS_INTEL         (1 << 1)
 
+// cl_khr_command_buffer
+#ifndef cl_khr_command_buffer
+typedef struct _cl_command_buffer_khr* cl_command_buffer_khr;
+typedef struct _cl_mutable_command_khr* cl_mutable_command_khr;
+typedef cl_uint cl_sync_point_khr;
+typedef cl_ulong cl_command_buffer_properties_khr;
+typedef cl_ulong cl_ndrange_kernel_command_properties_khr;
+#endif
+
+typedef CL_API_ENTRY cl_command_buffer_khr(CL_API_CALL *clCreateCommandBufferKHR_fn)(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *clFinalizeCommandBufferKHR_fn)(cl_command_buffer_khr command_buffer);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *clReleaseCommandBufferKHR_fn)(cl_command_buffer_khr command_buffer);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *clEnqueueCommandBufferKHR_fn)(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *clCommandNDRangeKernelKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_ndrange_kernel_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
 #define CL_HPP_PARAM_NAME_CL_INTEL_COMMAND_QUEUE_FAMILIES_(F) \
     F(cl_device_info, CL_DEVICE_QUEUE_FAMILY_PROPERTIES_INTEL, cl::vector<cl_queue_family_properties_intel>) \
     \
@@ -658,6 +699,74 @@ private:
     clGetMemAllocInfoINTEL_fn _get_mem_alloc_info_fn = nullptr;
 };
 
+/*
+    Wraps the cl_khr_command_buffer entry points. The kernels appended to a command buffer are executed in the order
+    they are recorded, each one waits for the sync point of the previous one.
+*/
+class CommandBufferHelper {
+public:
+    explicit CommandBufferHelper(const cl::Context& ctx) {
+        _create_fn   = try_load_entrypoint<clCreateCommandBufferKHR_fn>(ctx.get(), "clCreateCommandBufferKHR");
+        _finalize_fn = try_load_entrypoint<clFinalizeCommandBufferKHR_fn>(ctx.get(), "clFinalizeCommandBufferKHR");
+        _release_fn  = try_load_entrypoint<clReleaseCommandBufferKHR_fn>(ctx.get(), "clReleaseCommandBufferKHR");
+        _enqueue_fn  = try_load_entrypoint<clEnqueueCommandBufferKHR_fn>(ctx.get(), "clEnqueueCommandBufferKHR");
+        _ndrange_fn  = try_load_entrypoint<clCommandNDRangeKernelKHR_fn>(ctx.get(), "clCommandNDRangeKernelKHR");
+    }
+
+    bool is_supported() const {
+        return _create_fn && _finalize_fn && _release_fn && _enqueue_fn && _ndrange_fn;
+    }
+
+    cl_command_buffer_khr create(const cl::CommandQueue& queue) const {
+        cl_int err = CL_SUCCESS;
+        cl_command_queue queue_handle = queue.get();
+        auto buffer = _create_fn(1, &queue_handle, nullptr, &err);
+        if (err != CL_SUCCESS)
+            throw cl::Error(err, "clCreateCommandBufferKHR");
+        return buffer;
+    }
+
+    void append_kernel(cl_command_buffer_khr buffer, const cl::Kernel& kernel, const cl::NDRange& global,
+                       const cl::NDRange& local, cl_sync_point_khr* last_sync_point) const {
+        cl_sync_point_khr sync_point;
+        const bool has_last = *last_sync_point != invalid_sync_point;
+        cl_int err = _ndrange_fn(buffer, nullptr, nullptr, kernel.get(), static_cast<cl_uint>(global.dimensions()), nullptr,
+                                 global, local.dimensions() != 0 ? static_cast<const size_t*>(local) : nullptr,
+                                 has_last ? 1 : 0, has_last ? last_sync_point : nullptr, &sync_point, nullptr);
+        if (err != CL_SUCCESS)
+            throw cl::Error(err, "clCommandNDRangeKernelKHR");
+        *last_sync_point = sync_point;
+    }
+
+    void finalize(cl_command_buffer_khr buffer) const {
+        cl_int err = _finalize_fn(buffer);
+        if (err != CL_SUCCESS)
+            throw cl::Error(err, "clFinalizeCommandBufferKHR");
+    }
+
+    cl::Event enqueue(cl_command_buffer_khr buffer, const cl::CommandQueue& queue) const {
+        cl_command_queue queue_handle = queue.get();
+        cl_event ev = nullptr;
+        cl_int err = _enqueue_fn(1, &queue_handle, buffer, 0, nullptr, &ev);
+        if (err != CL_SUCCESS)
+            throw cl::Error(err, "clEnqueueCommandBufferKHR");
+        return cl::Event(ev);
+    }
+
+    void release(cl_command_buffer_khr buffer) const {
+        _release_fn(buffer);
+    }
+
+    static constexpr cl_sync_point_khr invalid_sync_point = static_cast<cl_sync_point_khr>(-1);
+
+private:
+    clCreateCommandBufferKHR_fn _create_fn = nullptr;
+    clFinalizeCommandBufferKHR_fn _finalize_fn = nullptr;
+    clReleaseCommandBufferKHR_fn _release_fn = nullptr;
+    clEnqueueCommandBufferKHR_fn _enqueue_fn = nullptr;
+    clCommandNDRangeKernelKHR_fn _ndrange_fn = nullptr;
+};
+
 /*
     UsmPointer requires associated context to free it.
     Simple wrapper class for usm allocated pointer.
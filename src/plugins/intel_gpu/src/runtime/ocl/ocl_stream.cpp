@@ -156,6 +156,18 @@ void set_arguments_impl(ocl_kernel_type& kernel,
                                  std::dynamic_pointer_cast<const ocl::gpu_buffer>(data.compensation)->get_buffer());
                 }
                 break;
+            case args_t::DECOMPRESSION_SCALE:
+                if (data.decompression_scale) {
+                    if (memory_capabilities::is_usm_type(data.decompression_scale->get_allocation_type()))
+                        status = kernel.setArgUsm(
+                                i,
+                                std::dynamic_pointer_cast<const ocl::gpu_usm>(data.decompression_scale)->get_buffer());
+                    else
+                        status = kernel.setArg(
+                                 i,
+                                 std::dynamic_pointer_cast<const ocl::gpu_buffer>(data.decompression_scale)->get_buffer());
+                }
+                break;
             case args_t::SCALE_TABLE:
                 if (data.scale_table) {
                     if (memory_capabilities::is_usm_type(data.scale_table->get_allocation_type()))
@@ -254,22 +266,28 @@ void set_arguments_impl(ocl_kernel_type& kernel,
     }
 }
 
+sync_methods get_expected_sync_method(const engine_configuration &config, bool enable_profiling) {
+    return enable_profiling ? sync_methods::events : config.queue_type == queue_types::out_of_order ? sync_methods::barriers
+                                                                                                    : sync_methods::none;
+}
+
 sync_methods get_expected_sync_method(const engine_configuration &config) {
-    return config.enable_profiling ? sync_methods::events : config.queue_type == queue_types::out_of_order ? sync_methods::barriers
-                                                                                                           : sync_methods::none;
+    return get_expected_sync_method(config, config.enable_profiling);
 }
 
 }  // namespace
 
-ocl_stream::ocl_stream(const ocl_engine &engine)
+ocl_stream::ocl_stream(const ocl_engine &engine) : ocl_stream(engine, engine.configuration().enable_profiling) {}
+
+ocl_stream::ocl_stream(const ocl_engine &engine, bool enable_profiling)
     : stream(engine.configuration().queue_type)
     , _engine(engine)
-    , sync_method(get_expected_sync_method(engine.configuration())) {
+    , sync_method(get_expected_sync_method(engine.configuration(), enable_profiling)) {
     auto context = engine.get_cl_context();
     auto device = engine.get_cl_device();
     auto config = engine.configuration();
     ocl::command_queues_builder queue_builder;
-    queue_builder.set_profiling(config.enable_profiling);
+    queue_builder.set_profiling(enable_profiling);
     queue_builder.set_out_of_order((config.queue_type == queue_types::out_of_order));
 
     if (sync_method == sync_methods::none && config.queue_type == queue_types::out_of_order) {
@@ -313,6 +331,11 @@ ocl_stream::ocl_stream(const ocl_engine &engine, void *handle)
 #endif
 }
 
+ocl_stream::~ocl_stream() {
+    if (_command_buffer)
+        _engine.get_command_buffer_helper()->release(_command_buffer);
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::stream& ocl_stream::get_onednn_stream() {
     if (!_onednn_stream)
@@ -371,6 +394,16 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
         sync_events(deps, is_output);
     }
 
+    if (_recording) {
+        try {
+            _engine.get_command_buffer_helper()->append_kernel(_command_buffer, kern, global, local, &_last_sync_point);
+        } catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+        // the events of the recorded kernels are replaced by the event of the whole recording once it's enqueued
+        return std::make_shared<ocl_event>(cl::Event(), ++_queue_counter);
+    }
+
     cl::Event ret_ev;
 
     bool set_output_event = sync_method == sync_methods::events || is_output;
@@ -388,6 +421,75 @@ void ocl_stream::enqueue_barrier() {
     _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
 }
 
+void ocl_stream::enqueue_barrier(std::vector<event::ptr> const& deps) {
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps) {
+        if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get()))
+            if (ocl_base_ev->get().get() != nullptr)
+                dep_events.push_back(ocl_base_ev->get());
+    }
+    if (dep_events.empty())
+        return;
+
+    try {
+        _command_queue.enqueueBarrierWithWaitList(&dep_events, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
+event::ptr ocl_stream::enqueue_full_marker() {
+    cl::Event ret_ev;
+    try {
+        _command_queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+    return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
+}
+
+bool ocl_stream::begin_recording() {
+    auto helper = _engine.get_command_buffer_helper();
+    // the recorded kernels are chained by the sync points, so only the in-order execution without events is recorded
+    if (!helper || sync_method != sync_methods::none)
+        return false;
+
+    if (_command_buffer) {
+        helper->release(_command_buffer);
+        _command_buffer = nullptr;
+    }
+
+    try {
+        _command_buffer = helper->create(_command_queue);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+    _last_sync_point = cl::CommandBufferHelper::invalid_sync_point;
+    _recording = true;
+    return true;
+}
+
+void ocl_stream::end_recording() {
+    _recording = false;
+    try {
+        _engine.get_command_buffer_helper()->finalize(_command_buffer);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
+event::ptr ocl_stream::enqueue_recording() {
+    if (!_command_buffer || _recording)
+        throw std::runtime_error("[GPU] There is no finished recording to enqueue");
+
+    try {
+        return std::make_shared<ocl_event>(_engine.get_command_buffer_helper()->enqueue(_command_buffer, _command_queue),
+                                           ++_queue_counter);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
 event::ptr ocl_stream::enqueue_marker(std::vector<event::ptr> const& deps, bool is_output) {
     if (deps.empty())
         return std::make_shared<ocl_user_event>(_engine.get_cl_context(), true);
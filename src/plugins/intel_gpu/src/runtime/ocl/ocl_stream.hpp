@@ -50,6 +50,7 @@ public:
     const ocl_queue_type& get_cl_queue() const { return _command_queue; }
 
     explicit ocl_stream(const ocl_engine& engine);
+    ocl_stream(const ocl_engine& engine, bool enable_profiling);
     ocl_stream(const ocl_engine &engine, void *handle);
     ocl_stream(ocl_stream&& other)
         : stream(other._engine.configuration().queue_type)
@@ -58,9 +59,14 @@ public:
         , _queue_counter(other._queue_counter.load())
         , _last_barrier(other._last_barrier.load())
         , _last_barrier_ev(other._last_barrier_ev)
-        , sync_method(other.sync_method) {}
+        , sync_method(other.sync_method)
+        , _command_buffer(other._command_buffer)
+        , _last_sync_point(other._last_sync_point)
+        , _recording(other._recording) {
+        other._command_buffer = nullptr;
+    }
 
-    ~ocl_stream() = default;
+    ~ocl_stream();
 
     void flush() const override;
     void finish() const override;
@@ -75,6 +81,11 @@ public:
     event::ptr group_events(std::vector<event::ptr> const& deps) override;
     void wait_for_events(const std::vector<event::ptr>& events) override;
     void enqueue_barrier() override;
+    void enqueue_barrier(std::vector<event::ptr> const& deps) override;
+    event::ptr enqueue_full_marker() override;
+    bool begin_recording() override;
+    void end_recording() override;
+    event::ptr enqueue_recording() override;
     event::ptr create_user_event(bool set) override;
     event::ptr create_base_event() override;
 
@@ -97,6 +108,10 @@ private:
 
     sync_methods sync_method;
 
+    cl_command_buffer_khr _command_buffer = nullptr;
+    cl_sync_point_khr _last_sync_point = cl::CommandBufferHelper::invalid_sync_point;
+    bool _recording = false;
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::stream> _onednn_stream = nullptr;
 #endif
@@ -0,0 +1,35 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace cldnn {
+namespace ze {
+
+class ze_error : public std::runtime_error {
+public:
+    ze_error(const std::string& call, ze_result_t result)
+        : std::runtime_error("[GPU] " + call + " failed, error code: " + std::to_string(static_cast<int>(result)))
+        , _result(result) {}
+
+    ze_result_t result() const { return _result; }
+
+private:
+    ze_result_t _result;
+};
+
+}  // namespace ze
+}  // namespace cldnn
+
+#define ZE_CHECK(call)                                           \
+    do {                                                         \
+        ze_result_t ze_check_result = (call);                    \
+        if (ze_check_result != ZE_RESULT_SUCCESS)                \
+            throw ::cldnn::ze::ze_error(#call, ze_check_result); \
+    } while (false)
@@ -0,0 +1,150 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ze_device.hpp"
+#include "ocl/ocl_device.hpp"
+#include "intel_gpu/runtime/utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifndef CL_DEVICE_UUID_KHR
+#define CL_DEVICE_UUID_KHR 0x106A
+#endif
+#ifndef CL_UUID_SIZE_KHR
+#define CL_UUID_SIZE_KHR 16
+#endif
+
+namespace cldnn {
+namespace ze {
+
+namespace {
+using device_uuid = std::array<uint8_t, ZE_MAX_DEVICE_UUID_SIZE>;
+
+bool get_ocl_device_uuid(const cl::Device& device, device_uuid& uuid) {
+    static_assert(CL_UUID_SIZE_KHR <= ZE_MAX_DEVICE_UUID_SIZE, "OpenCL device UUID doesn't fit the Level Zero one");
+    if (device.getInfo<CL_DEVICE_EXTENSIONS>().find("cl_khr_device_uuid") == std::string::npos)
+        return false;
+
+    uuid.fill(0);
+    return clGetDeviceInfo(device.get(), CL_DEVICE_UUID_KHR, CL_UUID_SIZE_KHR, uuid.data(), nullptr) == CL_SUCCESS;
+}
+
+memory_capabilities init_memory_caps(ze_device_handle_t device) {
+    ze_device_memory_access_properties_t props = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_ACCESS_PROPERTIES};
+    ZE_CHECK(zeDeviceGetMemoryAccessProperties(device, &props));
+
+    std::vector<allocation_type> memory_caps;
+    if (props.hostAllocCapabilities & ZE_MEMORY_ACCESS_CAP_FLAG_RW)
+        memory_caps.push_back(allocation_type::usm_host);
+    if (props.sharedSingleDeviceAllocCapabilities & ZE_MEMORY_ACCESS_CAP_FLAG_RW)
+        memory_caps.push_back(allocation_type::usm_shared);
+    if (props.deviceAllocCapabilities & ZE_MEMORY_ACCESS_CAP_FLAG_RW)
+        memory_caps.push_back(allocation_type::usm_device);
+
+    return memory_capabilities(memory_caps);
+}
+
+uint32_t get_compute_queue_ordinal(ze_device_handle_t device) {
+    uint32_t count = 0;
+    ZE_CHECK(zeDeviceGetCommandQueueGroupProperties(device, &count, nullptr));
+    std::vector<ze_command_queue_group_properties_t> groups(count, {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES});
+    ZE_CHECK(zeDeviceGetCommandQueueGroupProperties(device, &count, groups.data()));
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (groups[i].flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE)
+            return i;
+    }
+    throw std::runtime_error("[GPU] Level Zero device has no compute command queue group");
+}
+}  // namespace
+
+ze_device::ze_device(const device::ptr ocl_device, ze_driver_handle_t driver, ze_device_handle_t device)
+    : _ocl_device(ocl_device)
+    , _driver(driver)
+    , _device(device)
+    , _info(ocl_device->get_info())
+    , _mem_caps(init_memory_caps(device)) {
+    ze_device_properties_t props = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    ZE_CHECK(zeDeviceGetProperties(_device, &props));
+    _timer_resolution = std::max<uint64_t>(props.timerResolution, 1);
+    _timestamp_valid_bits = props.kernelTimestampValidBits;
+    _compute_queue_ordinal = get_compute_queue_ordinal(_device);
+
+    // the buffers are the USM allocations, so the kernels are selected for the buffers only
+    _info.supports_image = false;
+    _info.supports_usm = _mem_caps.supports_usm();
+
+    ze_context_desc_t context_desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ZE_CHECK(zeContextCreate(_driver, &context_desc, &_context));
+}
+
+ze_device::~ze_device() {
+    if (_context)
+        zeContextDestroy(_context);
+}
+
+bool ze_device::is_same(const device::ptr other) {
+    if (auto casted = dynamic_cast<ze_device*>(other.get()))
+        return _device == casted->get_device();
+
+    return _ocl_device->is_same(other);
+}
+
+std::map<std::string, device::ptr> ze_device_detector::get_available_devices(
+    const std::map<std::string, device::ptr>& ocl_devices) const {
+    ZE_CHECK(zeInit(ZE_INIT_FLAG_GPU_ONLY));
+
+    struct ze_device_desc {
+        ze_driver_handle_t driver;
+        ze_device_handle_t device;
+        ze_device_properties_t props;
+    };
+    std::vector<ze_device_desc> ze_devices;
+
+    uint32_t drivers_count = 0;
+    ZE_CHECK(zeDriverGet(&drivers_count, nullptr));
+    std::vector<ze_driver_handle_t> drivers(drivers_count);
+    ZE_CHECK(zeDriverGet(&drivers_count, drivers.data()));
+    for (auto driver : drivers) {
+        uint32_t devices_count = 0;
+        ZE_CHECK(zeDeviceGet(driver, &devices_count, nullptr));
+        std::vector<ze_device_handle_t> devices(devices_count);
+        ZE_CHECK(zeDeviceGet(driver, &devices_count, devices.data()));
+        for (auto device : devices) {
+            ze_device_properties_t props = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+            ZE_CHECK(zeDeviceGetProperties(device, &props));
+            if (props.type == ZE_DEVICE_TYPE_GPU)
+                ze_devices.push_back({driver, device, props});
+        }
+    }
+
+    std::map<std::string, device::ptr> ret;
+    for (auto& ocl_device : ocl_devices) {
+        auto& cl_device = downcast<ocl::ocl_device>(*ocl_device.second).get_device();
+        auto info = ocl_device.second->get_info();
+
+        // the devices are matched by UUID, the drivers without cl_khr_device_uuid are matched by the PCI device id
+        device_uuid uuid;
+        bool has_uuid = get_ocl_device_uuid(cl_device, uuid);
+        auto match = std::find_if(ze_devices.begin(), ze_devices.end(), [&](const ze_device_desc& desc) {
+            if (has_uuid)
+                return std::equal(uuid.begin(), uuid.end(), desc.props.uuid.id);
+            return desc.props.vendorId == info.vendor_id && desc.props.deviceId == info.device_id;
+        });
+        if (match == ze_devices.end())
+            continue;
+
+        ret[ocl_device.first] = std::make_shared<ze_device>(ocl_device.second, match->driver, match->device);
+        ze_devices.erase(match);
+    }
+
+    return ret;
+}
+
+}  // namespace ze
+}  // namespace cldnn
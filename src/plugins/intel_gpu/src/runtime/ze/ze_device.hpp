@@ -0,0 +1,59 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "intel_gpu/runtime/device.hpp"
+#include "ze_common.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+// The Level Zero device is paired with the OpenCL device of the same GPU: OpenCL reports the device info and builds
+// the kernels, their binaries are executed by Level Zero
+struct ze_device : public device {
+public:
+    ze_device(const device::ptr ocl_device, ze_driver_handle_t driver, ze_device_handle_t device);
+    ~ze_device();
+
+    device_info get_info() const override { return _info; }
+    memory_capabilities get_mem_caps() const override { return _mem_caps; }
+
+    const device::ptr& get_ocl_device() const { return _ocl_device; }
+    ze_driver_handle_t get_driver() const { return _driver; }
+    ze_device_handle_t get_device() const { return _device; }
+    ze_context_handle_t get_context() const { return _context; }
+    uint32_t get_compute_queue_ordinal() const { return _compute_queue_ordinal; }
+    /// Returns the duration of the timestamp tick in ns
+    uint64_t get_timer_resolution() const { return _timer_resolution; }
+    uint32_t get_timestamp_valid_bits() const { return _timestamp_valid_bits; }
+
+    bool is_same(const device::ptr other) override;
+
+private:
+    device::ptr _ocl_device;
+    ze_driver_handle_t _driver;
+    ze_device_handle_t _device;
+    ze_context_handle_t _context = nullptr;
+    uint32_t _compute_queue_ordinal = 0;
+    uint64_t _timer_resolution = 1;
+    uint32_t _timestamp_valid_bits = 64;
+    device_info _info;
+    memory_capabilities _mem_caps;
+};
+
+class ze_device_detector {
+public:
+    ze_device_detector() = default;
+
+    /// Returns the Level Zero devices of the OpenCL ones with the same ids, the devices Level Zero doesn't see are skipped
+    std::map<std::string, device::ptr> get_available_devices(const std::map<std::string, device::ptr>& ocl_devices) const;
+};
+
+}  // namespace ze
+}  // namespace cldnn
@@ -0,0 +1,159 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ze_engine.hpp"
+#include "ze_engine_factory.hpp"
+#include "ze_common.hpp"
+#include "ze_memory.hpp"
+#include "ze_stream.hpp"
+#include "intel_gpu/runtime/utils.hpp"
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace cldnn {
+namespace ze {
+
+ze_engine::ze_engine(const device::ptr dev, runtime_types runtime_type,
+            const engine_configuration& conf, const InferenceEngine::ITaskExecutor::Ptr task_executor)
+    : engine(dev, conf, task_executor) {
+    if (runtime_type != runtime_types::ze) {
+        throw std::runtime_error("Invalid runtime type specified for Level Zero engine. Only Level Zero runtime is supported");
+    }
+
+    if (!dynamic_cast<ze_device*>(dev.get()))
+        throw std::runtime_error("[GPU] Invalid device type passed to Level Zero engine");
+
+    if (!use_unified_shared_memory())
+        throw std::runtime_error("[GPU] Level Zero engine requires USM, which is unsupported by the device or disabled");
+
+    _program_stream.reset(new ze_stream(*this));
+}
+
+#ifdef ENABLE_ONEDNN_FOR_GPU
+dnnl::engine& ze_engine::get_onednn_engine() const {
+    throw std::runtime_error("[GPU] onednn engine isn't available for Level Zero runtime");
+}
+#endif
+
+const ze_device& ze_engine::get_ze_device() const {
+    return downcast<const ze_device>(*_device);
+}
+
+memory::ptr ze_engine::allocate_memory(const layout& layout, allocation_type type, bool reset) {
+    if (layout.bytes_count() > get_device_info().max_alloc_mem_size) {
+        throw std::runtime_error("exceeded max size of memory object allocation");
+    }
+
+    if (layout.format.is_image()) {
+        throw std::runtime_error("[GPU] image memory isn't supported by Level Zero engine");
+    }
+
+    if (!memory_capabilities::is_usm_type(type) || !supports_allocation(type)) {
+        std::ostringstream type_str;
+        type_str << type;
+        throw std::runtime_error("Unsupported allocation type " + type_str.str());
+    }
+
+    try {
+        memory::ptr res = std::make_shared<ze::gpu_usm>(this, layout, type);
+
+        if (reset || res->is_memory_reset_needed(layout)) {
+            res->fill(get_program_stream());
+        }
+
+        return res;
+    } catch (const ze_error& err) {
+        switch (err.result()) {
+            case ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY:
+            case ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY:
+                throw std::runtime_error("out of GPU resources");
+            default:
+                throw std::runtime_error("GPU buffer allocation failed");
+        }
+    }
+}
+
+memory::ptr ze_engine::reinterpret_buffer(const memory& memory, const layout& new_layout) {
+    if (memory.get_engine() != this)
+        throw std::runtime_error("trying to reinterpret buffer allocated by a different engine");
+
+    if (new_layout.format.is_image())
+        throw std::runtime_error("[GPU] image memory isn't supported by Level Zero engine");
+
+    return std::make_shared<ze::gpu_usm>(this,
+                                         new_layout,
+                                         downcast<const ze::gpu_usm>(memory).get_shared_buffer(),
+                                         memory.get_allocation_type());
+}
+
+memory::ptr ze_engine::reinterpret_handle(const layout& new_layout, shared_mem_params params) {
+    if (params.mem_type != shared_mem_type::shared_mem_usm)
+        throw std::runtime_error("[GPU] Level Zero engine supports only the shared USM buffers");
+
+    auto type = gpu_usm::detect_allocation_type(get_context(), params.mem);
+    if (type == allocation_type::unknown)
+        throw std::runtime_error("[GPU] shared USM buffer isn't allocated in the context of the engine");
+
+    void* base = nullptr;
+    size_t actual_mem_size = 0;
+    ZE_CHECK(zeMemGetAddressRange(get_context(), params.mem, &base, &actual_mem_size));
+    actual_mem_size -= static_cast<char*>(params.mem) - static_cast<char*>(base);
+    auto requested_mem_size = new_layout.bytes_count();
+    if (actual_mem_size < requested_mem_size) {
+        throw std::runtime_error("[GPU] shared USM buffer has smaller size (" + std::to_string(actual_mem_size) +
+                                 ") than specified layout (" + std::to_string(requested_mem_size) + ")");
+    }
+
+    // the user keeps the ownership of the buffer
+    std::shared_ptr<void> buffer(params.mem, [](void*) {});
+    return std::make_shared<ze::gpu_usm>(this, new_layout, buffer, type);
+}
+
+bool ze_engine::is_the_same_buffer(const memory& mem1, const memory& mem2) {
+    if (mem1.get_engine() != this || mem2.get_engine() != this)
+        return false;
+    if (mem1.get_allocation_type() != mem2.get_allocation_type())
+        return false;
+    if (&mem1 == &mem2)
+        return true;
+
+    return (reinterpret_cast<const ze::gpu_usm&>(mem1).get_buffer() ==
+            reinterpret_cast<const ze::gpu_usm&>(mem2).get_buffer());
+}
+
+void* ze_engine::get_user_context() const {
+    return static_cast<void*>(get_context());
+}
+
+stream::ptr ze_engine::create_stream() const {
+    return std::make_shared<ze_stream>(*this);
+}
+
+stream::ptr ze_engine::create_stream(void* /* handle */) const {
+    throw std::runtime_error("[GPU] Level Zero engine doesn't support user queues");
+}
+
+stream::ptr ze_engine::create_profiling_stream() const {
+    return std::make_shared<ze_stream>(*this, true);
+}
+
+stream& ze_engine::get_program_stream() const {
+    return *_program_stream;
+}
+
+std::shared_ptr<cldnn::engine> ze_engine::create(const device::ptr device, runtime_types runtime_type,
+                            const engine_configuration& configuration, const InferenceEngine::ITaskExecutor::Ptr task_executor) {
+    return std::make_shared<ze::ze_engine>(device, runtime_type, configuration, task_executor);
+}
+
+std::shared_ptr<cldnn::engine> create_ze_engine(const device::ptr device, runtime_types runtime_type,
+                            const engine_configuration& configuration, InferenceEngine::ITaskExecutor::Ptr task_executor) {
+    return ze_engine::create(device, runtime_type, configuration, task_executor);
+}
+
+}  // namespace ze
+}  // namespace cldnn
@@ -0,0 +1,57 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "intel_gpu/runtime/memory.hpp"
+#include "intel_gpu/runtime/engine.hpp"
+#include "intel_gpu/runtime/stream.hpp"
+#include "ze_device.hpp"
+
+#include <memory>
+#include <string>
+
+namespace cldnn {
+namespace ze {
+
+// Executes the kernels on the immediate command lists of Level Zero, all the buffers are the USM allocations
+class ze_engine : public engine {
+public:
+    ze_engine(const device::ptr dev, runtime_types runtime_type, const engine_configuration& conf, const InferenceEngine::ITaskExecutor::Ptr task_executor);
+    engine_types type() const override { return engine_types::ze; };
+    runtime_types runtime_type() const override { return runtime_types::ze; };
+
+    memory_ptr allocate_memory(const layout& layout, allocation_type type, bool reset = true) override;
+    memory_ptr reinterpret_handle(const layout& new_layout, shared_mem_params params) override;
+    memory_ptr reinterpret_buffer(const memory& memory, const layout& new_layout) override;
+    bool is_the_same_buffer(const memory& mem1, const memory& mem2) override;
+
+    /// Returns the Level Zero context
+    void* get_user_context() const override;
+
+    allocation_type get_default_allocation_type() const override { return allocation_type::usm_device; }
+
+    const ze_device& get_ze_device() const;
+    ze_context_handle_t get_context() const { return get_ze_device().get_context(); }
+    ze_device_handle_t get_device_handle() const { return get_ze_device().get_device(); }
+
+    stream_ptr create_stream() const override;
+    stream_ptr create_stream(void *handle) const override;
+    stream_ptr create_profiling_stream() const override;
+    stream& get_program_stream() const override;
+
+#ifdef ENABLE_ONEDNN_FOR_GPU
+    /// oneDNN isn't used with Level Zero, throws
+    dnnl::engine& get_onednn_engine() const override;
+#endif
+
+    static std::shared_ptr<cldnn::engine> create(const device::ptr device, runtime_types runtime_type,
+                const engine_configuration& configuration, const InferenceEngine::ITaskExecutor::Ptr task_executor);
+
+private:
+    std::unique_ptr<stream> _program_stream;
+};
+
+}  // namespace ze
+}  // namespace cldnn
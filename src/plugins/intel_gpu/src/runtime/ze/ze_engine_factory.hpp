@@ -0,0 +1,19 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "intel_gpu/runtime/device.hpp"
+#include "intel_gpu/runtime/engine.hpp"
+#include "intel_gpu/runtime/stream.hpp"
+
+namespace cldnn {
+namespace ze {
+
+// Factory for ze_engine creation, keeps the Level Zero includes out of engine.cpp
+std::shared_ptr<cldnn::engine> create_ze_engine(const device::ptr device, runtime_types runtime_type,
+        const engine_configuration& configuration, InferenceEngine::ITaskExecutor::Ptr task_executor);
+
+}  // namespace ze
+}  // namespace cldnn
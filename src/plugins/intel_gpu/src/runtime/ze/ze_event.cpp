@@ -0,0 +1,185 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ze_event.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <utility>
+#include <vector>
+
+using namespace cldnn;
+using namespace ze;
+
+namespace {
+instrumentation::profiling_interval get_profiling_interval(instrumentation::profiling_stage stage, uint64_t start, uint64_t end) {
+    auto diff = std::chrono::nanoseconds(end - start);
+    auto period = std::make_shared<instrumentation::profiling_period_basic>(diff);
+    return { stage, period };
+}
+}  // namespace
+
+ze_event_pool::ze_event_pool(const ze_device& device, uint32_t capacity, bool enable_profiling)
+    : _capacity(capacity)
+    , _profiled(enable_profiling)
+    , _timer_resolution(device.get_timer_resolution())
+    , _timestamp_mask(device.get_timestamp_valid_bits() >= 64 ? std::numeric_limits<uint64_t>::max()
+                                                              : (uint64_t(1) << device.get_timestamp_valid_bits()) - 1) {
+    ze_event_pool_desc_t desc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    desc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    if (enable_profiling)
+        desc.flags |= ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+    desc.count = capacity;
+    auto ze_device_handle = device.get_device();
+    ZE_CHECK(zeEventPoolCreate(device.get_context(), &desc, 1, &ze_device_handle, &_pool));
+}
+
+ze_event_pool::~ze_event_pool() {
+    if (_pool)
+        zeEventPoolDestroy(_pool);
+}
+
+ze_event::ze_event(std::shared_ptr<ze_event_pool> pool, uint64_t queue_stamp)
+    : ze_base_event(queue_stamp)
+    , _pool(pool) {
+    if (!_pool)
+        return;
+
+    ze_event_desc_t desc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    desc.index = _pool->take_index();
+    desc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    desc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    ZE_CHECK(zeEventCreate(_pool->get(), &desc, &_event));
+}
+
+ze_event::~ze_event() {
+    if (_event)
+        zeEventDestroy(_event);
+}
+
+void ze_event::wait_impl() {
+    if (_event) {
+        ZE_CHECK(zeEventHostSynchronize(_event, std::numeric_limits<uint64_t>::max()));
+    }
+}
+
+void ze_event::set_impl() {
+    wait_impl();
+}
+
+bool ze_event::is_set_impl() {
+    if (!_event)
+        return true;
+
+    auto status = zeEventQueryStatus(_event);
+    if (status == ZE_RESULT_NOT_READY)
+        return false;
+    ZE_CHECK(status);
+    return true;
+}
+
+bool ze_event::get_profiling_info_impl(std::list<instrumentation::profiling_interval>& info) {
+    instrumentation::device_timestamps timestamps;
+    if (!get_device_timestamps(timestamps))
+        return true;
+
+    info.push_back(get_profiling_interval(instrumentation::profiling_stage::executing, timestamps.start, timestamps.end));
+    return true;
+}
+
+bool ze_event::get_device_timestamps(instrumentation::device_timestamps& timestamps) {
+    if (!_event || !_pool->is_profiled())
+        return false;
+
+    ze_kernel_timestamp_result_t result;
+    ZE_CHECK(zeEventQueryKernelTimestamp(_event, &result));
+
+    // Level Zero has no queued and submit timestamps, the command starts right away on the immediate command list
+    auto mask = _pool->get_timestamp_mask();
+    auto ticks = (result.global.kernelEnd - result.global.kernelStart) & mask;
+    timestamps.start = (result.global.kernelStart & mask) * _pool->get_timer_resolution();
+    timestamps.end = timestamps.start + ticks * _pool->get_timer_resolution();
+    timestamps.queued = timestamps.start;
+    timestamps.submit = timestamps.start;
+    return true;
+}
+
+void ze_user_event::set_impl() {
+    ZE_CHECK(zeEventHostSignal(_event));
+    _duration = std::unique_ptr<cldnn::instrumentation::profiling_period_basic>(
+        new cldnn::instrumentation::profiling_period_basic(_timer.uptime()));
+}
+
+bool ze_user_event::get_profiling_info_impl(std::list<cldnn::instrumentation::profiling_interval>& info) {
+    if (_duration == nullptr) {
+        return false;
+    }
+
+    auto period = std::make_shared<instrumentation::profiling_period_basic>(_duration->value());
+    info.push_back({ instrumentation::profiling_stage::executing, period });
+    return true;
+}
+
+void ze_events::wait_impl() {
+    if (_last_ze_event)
+        _last_ze_event->wait();
+}
+
+void ze_events::set_impl() {
+    wait_impl();
+}
+
+bool ze_events::is_set_impl() {
+    return !_last_ze_event || _last_ze_event->is_set();
+}
+
+bool ze_events::get_device_timestamps(instrumentation::device_timestamps& timestamps) {
+    // the kernels of the primitive make up one span from the first started to the last finished one
+    bool profiled = false;
+    for (auto& ev : _events) {
+        instrumentation::device_timestamps ev_timestamps;
+        if (!ev->get_device_timestamps(ev_timestamps))
+            continue;
+
+        if (!profiled) {
+            timestamps = ev_timestamps;
+            profiled = true;
+            continue;
+        }
+        timestamps.queued = std::min(timestamps.queued, ev_timestamps.queued);
+        timestamps.submit = std::min(timestamps.submit, ev_timestamps.submit);
+        timestamps.start = std::min(timestamps.start, ev_timestamps.start);
+        timestamps.end = std::max(timestamps.end, ev_timestamps.end);
+    }
+    return profiled;
+}
+
+bool ze_events::get_profiling_info_impl(std::list<instrumentation::profiling_interval>& info) {
+    // sums up the disjoint durations of the kernels on the time axis
+    std::vector<std::pair<uint64_t, uint64_t>> durations;
+    for (auto& ev : _events) {
+        instrumentation::device_timestamps ev_timestamps;
+        if (ev->get_device_timestamps(ev_timestamps))
+            durations.emplace_back(ev_timestamps.start, ev_timestamps.end);
+    }
+    if (durations.empty())
+        return true;
+
+    std::sort(durations.begin(), durations.end());
+    uint64_t sum = 0;
+    auto current = durations.front();
+    for (auto& duration : durations) {
+        if (duration.first > current.second) {
+            sum += current.second - current.first;
+            current = duration;
+        } else {
+            current.second = std::max(current.second, duration.second);
+        }
+    }
+    sum += current.second - current.first;
+
+    info.push_back(get_profiling_interval(instrumentation::profiling_stage::executing, 0, sum));
+    return true;
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ze_common.hpp"
+#include "ze_device.hpp"
+#include "intel_gpu/runtime/event.hpp"
+#include "intel_gpu/runtime/utils.hpp"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+// The events of a stream are taken from the pools of the fixed size, a new pool is created when the last one is
+// exhausted and is destroyed when all of its events are
+class ze_event_pool {
+public:
+    ze_event_pool(const ze_device& device, uint32_t capacity, bool enable_profiling);
+    ~ze_event_pool();
+
+    ze_event_pool_handle_t get() const { return _pool; }
+    bool is_profiled() const { return _profiled; }
+    bool is_exhausted() const { return _next_index == _capacity; }
+    uint32_t take_index() { return _next_index++; }
+
+    uint64_t get_timer_resolution() const { return _timer_resolution; }
+    uint64_t get_timestamp_mask() const { return _timestamp_mask; }
+
+private:
+    ze_event_pool_handle_t _pool = nullptr;
+    uint32_t _capacity;
+    uint32_t _next_index = 0;
+    bool _profiled;
+    uint64_t _timer_resolution;
+    uint64_t _timestamp_mask;
+};
+
+struct ze_base_event : public event {
+public:
+    explicit ze_base_event(uint64_t queue_stamp = 0) : event(), _queue_stamp(queue_stamp) { }
+    uint64_t get_queue_stamp() const { return _queue_stamp; }
+    virtual ze_event_handle_t get() = 0;
+
+protected:
+    uint64_t _queue_stamp = 0;
+};
+
+struct ze_event : public ze_base_event {
+public:
+    /// Takes a new event of the pool, the null pool makes the event which is always set
+    ze_event(std::shared_ptr<ze_event_pool> pool, uint64_t queue_stamp = 0);
+    ~ze_event();
+
+    ze_event_handle_t get() override { return _event; }
+    bool get_device_timestamps(instrumentation::device_timestamps& timestamps) override;
+
+protected:
+    void wait_impl() override;
+    void set_impl() override;
+    bool is_set_impl() override;
+    // there are no completion callbacks in Level Zero
+    bool add_event_handler_impl(event_handler, void*) override { return false; }
+    bool get_profiling_info_impl(std::list<instrumentation::profiling_interval>& info) override;
+
+    std::shared_ptr<ze_event_pool> _pool;
+    ze_event_handle_t _event = nullptr;
+};
+
+struct ze_user_event : public ze_event {
+public:
+    explicit ze_user_event(std::shared_ptr<ze_event_pool> pool, bool is_set = false)
+        : ze_event(pool) {
+        if (is_set) {
+            set();
+        }
+    }
+
+    bool get_device_timestamps(instrumentation::device_timestamps&) override { return false; }
+
+protected:
+    void set_impl() override;
+    bool get_profiling_info_impl(std::list<instrumentation::profiling_interval>& info) override;
+
+    cldnn::instrumentation::timer<> _timer;
+    std::unique_ptr<cldnn::instrumentation::profiling_period_basic> _duration;
+};
+
+struct ze_events : public ze_base_event {
+public:
+    ze_events(std::vector<event::ptr> const& ev)
+        : ze_base_event(0) {
+        process_events(ev);
+    }
+
+    ze_event_handle_t get() override { return _last_ze_event ? _last_ze_event->get() : nullptr; }
+    bool get_device_timestamps(instrumentation::device_timestamps& timestamps) override;
+
+    void reset() override {
+        event::reset();
+        _events.clear();
+    }
+
+private:
+    void wait_impl() override;
+    void set_impl() override;
+    bool is_set_impl() override;
+    bool get_profiling_info_impl(std::list<instrumentation::profiling_interval>& info) override;
+
+    void process_events(const std::vector<event::ptr>& ev) {
+        for (auto& e : ev) {
+            if (auto multiple_events = dynamic_cast<ze_events*>(e.get())) {
+                for (auto& inner : multiple_events->_events)
+                    add_event(inner);
+            } else {
+                add_event(e);
+            }
+        }
+    }
+
+    void add_event(const event::ptr& ev) {
+        if (auto base_ev = std::dynamic_pointer_cast<ze_event>(ev)) {
+            auto current_ev_queue_stamp = base_ev->get_queue_stamp();
+            if ((_queue_stamp == 0) || (current_ev_queue_stamp > _queue_stamp)) {
+                _queue_stamp = current_ev_queue_stamp;
+                _last_ze_event = base_ev;
+            }
+        }
+        _events.push_back(ev);
+    }
+
+    std::shared_ptr<ze_event> _last_ze_event;
+    std::vector<event::ptr> _events;
+};
+
+}  // namespace ze
+}  // namespace cldnn
@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ze_kernel.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+ze_module::ze_module(ze_context_handle_t context, ze_device_handle_t device, const std::vector<unsigned char>& binary) {
+    ze_module_desc_t desc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    desc.format = ZE_MODULE_FORMAT_NATIVE;
+    desc.inputSize = binary.size();
+    desc.pInputModule = binary.data();
+    desc.pBuildFlags = "";
+
+    ze_module_build_log_handle_t build_log = nullptr;
+    auto status = zeModuleCreate(context, device, &desc, &_module, &build_log);
+    if (status != ZE_RESULT_SUCCESS) {
+        std::string log;
+        size_t log_size = 0;
+        if (build_log && zeModuleBuildLogGetString(build_log, &log_size, nullptr) == ZE_RESULT_SUCCESS && log_size > 0) {
+            log.resize(log_size);
+            zeModuleBuildLogGetString(build_log, &log_size, &log[0]);
+        }
+        if (build_log)
+            zeModuleBuildLogDestroy(build_log);
+        throw ze_error("zeModuleCreate (" + log + ")", status);
+    }
+    if (build_log)
+        zeModuleBuildLogDestroy(build_log);
+}
+
+ze_module::~ze_module() {
+    if (_module)
+        zeModuleDestroy(_module);
+}
+
+ze_kernel::ze_kernel(std::shared_ptr<ze_module> module, const std::string& kernel_id)
+    : _module(module)
+    , _kernel_id(kernel_id) {
+    ze_kernel_desc_t desc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    desc.pKernelName = _kernel_id.c_str();
+    ZE_CHECK(zeKernelCreate(_module->get(), &desc, &_kernel));
+}
+
+ze_kernel::~ze_kernel() {
+    if (_kernel)
+        zeKernelDestroy(_kernel);
+}
+
+void ze_kernel::set_group_size(uint32_t x, uint32_t y, uint32_t z) {
+    if (_group_size[0] == x && _group_size[1] == y && _group_size[2] == z)
+        return;
+
+    ZE_CHECK(zeKernelSetGroupSize(_kernel, x, y, z));
+    _group_size = {{x, y, z}};
+}
+
+}  // namespace ze
+}  // namespace cldnn
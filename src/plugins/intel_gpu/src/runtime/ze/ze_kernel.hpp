@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ze_common.hpp"
+#include "intel_gpu/runtime/kernel_args.hpp"
+#include "intel_gpu/runtime/kernel.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+// The module of the binary of the program built by OpenCL
+class ze_module {
+public:
+    ze_module(ze_context_handle_t context, ze_device_handle_t device, const std::vector<unsigned char>& binary);
+    ~ze_module();
+
+    ze_module(const ze_module& other) = delete;
+    ze_module& operator=(const ze_module& other) = delete;
+
+    ze_module_handle_t get() const { return _module; }
+
+private:
+    ze_module_handle_t _module = nullptr;
+};
+
+class ze_kernel : public kernel {
+    std::shared_ptr<ze_module> _module;
+    ze_kernel_handle_t _kernel = nullptr;
+    std::string _kernel_id;
+    std::array<uint32_t, 3> _group_size = {{0, 0, 0}};
+
+public:
+    ze_kernel(std::shared_ptr<ze_module> module, const std::string& kernel_id);
+    ~ze_kernel();
+
+    ze_kernel_handle_t get_handle() const { return _kernel; }
+    /// Sets the group size of the next launches, the kernel keeps it till it's changed
+    void set_group_size(uint32_t x, uint32_t y, uint32_t z);
+    std::shared_ptr<kernel> clone() const override { return std::make_shared<ze_kernel>(_module, _kernel_id); }
+};
+
+}  // namespace ze
+}  // namespace cldnn
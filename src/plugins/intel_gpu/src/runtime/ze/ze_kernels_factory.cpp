@@ -0,0 +1,29 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ze_kernel.hpp"
+#include "ze_engine.hpp"
+#include "kernels_factory.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+std::vector<std::shared_ptr<kernel>> create_ze_kernels(engine& engine,
+                                                       const std::vector<unsigned char>& binary,
+                                                       const std::vector<std::string>& entry_points) {
+    auto& casted = downcast<ze_engine>(engine);
+    auto module = std::make_shared<ze_module>(casted.get_context(), casted.get_device_handle(), binary);
+
+    std::vector<std::shared_ptr<kernel>> kernels;
+    for (auto& entry_point : entry_points)
+        kernels.push_back(std::make_shared<ze_kernel>(module, entry_point));
+    return kernels;
+}
+
+}  // namespace ze
+}  // namespace cldnn
@@ -0,0 +1,146 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/runtime/error_handler.hpp"
+#include "intel_gpu/runtime/utils.hpp"
+#include "intel_gpu/runtime/debug_configuration.hpp"
+#include "ze_memory.hpp"
+#include "ze_engine.hpp"
+#include "ze_stream.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+namespace cldnn {
+namespace ze {
+
+namespace {
+std::shared_ptr<void> allocate_usm(const ze_engine& engine, allocation_type type, size_t size) {
+    void* ptr = nullptr;
+    // the empty layouts still get a valid pointer
+    size = std::max<size_t>(size, 1);
+    switch (type) {
+    case allocation_type::usm_host: {
+        ze_host_mem_alloc_desc_t host_desc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+        ZE_CHECK(zeMemAllocHost(engine.get_context(), &host_desc, size, 0, &ptr));
+        break;
+    }
+    case allocation_type::usm_shared: {
+        ze_host_mem_alloc_desc_t host_desc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+        ze_device_mem_alloc_desc_t device_desc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+        ZE_CHECK(zeMemAllocShared(engine.get_context(), &device_desc, &host_desc, size, 0, engine.get_device_handle(), &ptr));
+        break;
+    }
+    case allocation_type::usm_device: {
+        ze_device_mem_alloc_desc_t device_desc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+        ZE_CHECK(zeMemAllocDevice(engine.get_context(), &device_desc, size, 0, engine.get_device_handle(), &ptr));
+        break;
+    }
+    default:
+        CLDNN_ERROR_MESSAGE("gpu_usm allocation type",
+            "Unknown unified shared memory type!");
+    }
+
+    auto context = engine.get_context();
+    return std::shared_ptr<void>(ptr, [context](void* p) { zeMemFree(context, p); });
+}
+}  // namespace
+
+gpu_usm::gpu_usm(ze_engine* engine, const layout& new_layout, const std::shared_ptr<void>& buffer, allocation_type type)
+    : memory(engine, new_layout, type, true)
+    , _buffer(buffer) {
+}
+
+gpu_usm::gpu_usm(ze_engine* engine, const layout& layout, allocation_type type)
+    : memory(engine, layout, type, false)
+    , _buffer(allocate_usm(*engine, type, _bytes_count)) {
+}
+
+void* gpu_usm::lock(const stream& stream, mem_lock_type type) {
+    std::lock_guard<std::mutex> locker(_mutex);
+    if (0 == _lock_count) {
+        auto& l0_stream = downcast<const ze::ze_stream>(stream);
+        if (get_allocation_type() == allocation_type::usm_device) {
+            if (type != mem_lock_type::read) {
+                throw std::runtime_error("Unable to lock allocation_type::usm_device with write lock_type.");
+            }
+            GPU_DEBUG_GET_INSTANCE(debug_config);
+            GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                GPU_DEBUG_COUT << "Copy usm_device buffer to host buffer." << std::endl;
+            }
+            _host_buffer = allocate_usm(downcast<const ze_engine>(*_engine), allocation_type::usm_host, _bytes_count);
+            l0_stream.copy(_host_buffer.get(), _buffer.get(), _bytes_count);
+            _mapped_ptr = _host_buffer.get();
+        } else {
+            l0_stream.finish();  // the kernels writing the memory may be still executed
+            _mapped_ptr = _buffer.get();
+        }
+    }
+    _lock_count++;
+    return _mapped_ptr;
+}
+
+void gpu_usm::unlock(const stream& /* stream */) {
+    std::lock_guard<std::mutex> locker(_mutex);
+    _lock_count--;
+    if (0 == _lock_count) {
+        _host_buffer.reset();
+        _mapped_ptr = nullptr;
+    }
+}
+
+event::ptr gpu_usm::fill(stream& stream, unsigned char pattern) {
+    auto& l0_stream = downcast<ze::ze_stream>(stream);
+    l0_stream.fill(_buffer.get(), pattern, _bytes_count);
+    return stream.create_user_event(true);
+}
+
+event::ptr gpu_usm::fill(stream& stream) {
+    return fill(stream, 0);
+}
+
+event::ptr gpu_usm::copy_from(stream& stream, const memory& other) {
+    auto& l0_stream = downcast<ze::ze_stream>(stream);
+    auto& casted = downcast<const gpu_usm>(other);
+    l0_stream.copy(_buffer.get(), casted.get_buffer(), _bytes_count);
+    return stream.create_user_event(true);
+}
+
+event::ptr gpu_usm::copy_from(stream& stream, const void* host_ptr) {
+    auto& l0_stream = downcast<ze::ze_stream>(stream);
+    l0_stream.copy(_buffer.get(), host_ptr, _bytes_count);
+    return stream.create_user_event(true);
+}
+
+shared_mem_params gpu_usm::get_internal_params() const {
+    return {
+        shared_mem_type::shared_mem_usm,  // shared_mem_type
+        _engine->get_user_context(),  // context handle
+        nullptr,        // user_device handle
+        _buffer.get(),  // mem handle
+#ifdef _WIN32
+        nullptr,  // surface handle
+#else
+        0,  // surface handle
+#endif
+        0  // plane
+    };
+}
+
+allocation_type gpu_usm::detect_allocation_type(ze_context_handle_t context, const void* ptr) {
+    ze_memory_allocation_properties_t props = {ZE_STRUCTURE_TYPE_MEMORY_ALLOCATION_PROPERTIES};
+    ze_device_handle_t device = nullptr;
+    ZE_CHECK(zeMemGetAllocProperties(context, ptr, &props, &device));
+
+    switch (props.type) {
+        case ZE_MEMORY_TYPE_DEVICE: return allocation_type::usm_device;
+        case ZE_MEMORY_TYPE_HOST: return allocation_type::usm_host;
+        case ZE_MEMORY_TYPE_SHARED: return allocation_type::usm_shared;
+        default: return allocation_type::unknown;
+    }
+}
+
+}  // namespace ze
+}  // namespace cldnn
@@ -0,0 +1,47 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ze_common.hpp"
+#include "ze_engine.hpp"
+#include "intel_gpu/runtime/memory.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace cldnn {
+namespace ze {
+
+struct gpu_usm : public memory {
+    gpu_usm(ze_engine* engine, const layout& layout, allocation_type type);
+    /// Shares the allocation of the other memory or wraps the user one, which isn't freed then
+    gpu_usm(ze_engine* engine, const layout& new_layout, const std::shared_ptr<void>& buffer, allocation_type type);
+
+    void* lock(const stream& stream, mem_lock_type type = mem_lock_type::read_write) override;
+    void unlock(const stream& stream) override;
+    void* get_buffer() const { return _buffer.get(); }
+    const std::shared_ptr<void>& get_shared_buffer() const { return _buffer; }
+
+    event::ptr fill(stream& stream, unsigned char pattern) override;
+    event::ptr fill(stream& stream) override;
+    shared_mem_params get_internal_params() const override;
+
+    event::ptr copy_from(stream& stream, const memory& other) override;
+    event::ptr copy_from(stream& stream, const void* host_ptr) override;
+
+    /// Returns the USM type of the allocation made in the context, unknown for the other pointers
+    static allocation_type detect_allocation_type(ze_context_handle_t context, const void* ptr);
+
+protected:
+    std::shared_ptr<void> _buffer;
+    std::shared_ptr<void> _host_buffer;
+
+    std::mutex _mutex;
+    unsigned _lock_count = 0;
+    void* _mapped_ptr = nullptr;
+};
+
+}  // namespace ze
+}  // namespace cldnn
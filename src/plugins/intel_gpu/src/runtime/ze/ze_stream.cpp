@@ -0,0 +1,351 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ze_stream.hpp"
+#include "ze_event.hpp"
+#include "ze_kernel.hpp"
+#include "ze_memory.hpp"
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+namespace {
+// the events are taken from the pools of this size
+constexpr uint32_t event_pool_size = 1024;
+
+ze_command_queue_priority_t get_queue_priority(priority_mode_types priority_mode) {
+    switch (priority_mode) {
+        case priority_mode_types::low: return ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW;
+        case priority_mode_types::high: return ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH;
+        default: return ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+    }
+}
+
+memory::cptr get_indexed(const std::vector<memory::cptr>& mems, uint32_t index) {
+    return index < mems.size() ? mems[index] : nullptr;
+}
+
+void set_arg_memory(ze_kernel_handle_t kernel, uint32_t idx, const memory::cptr& mem) {
+    if (!mem)
+        throw std::runtime_error("Error set arg " + std::to_string(idx) + ", the memory isn't set\n");
+
+    // the engine allocates the USM only, the kernels are selected for the buffers and get the pointers
+    void* ptr = downcast<const ze::gpu_usm>(*mem).get_buffer();
+    ZE_CHECK(zeKernelSetArgumentValue(kernel, idx, sizeof(ptr), &ptr));
+}
+
+template <typename T>
+void set_arg_value(ze_kernel_handle_t kernel, uint32_t idx, const T& value) {
+    ZE_CHECK(zeKernelSetArgumentValue(kernel, idx, sizeof(T), &value));
+}
+
+void set_arguments_impl(ze_kernel_handle_t kernel,
+                        const arguments_desc& args,
+                        const kernel_arguments_data& data) {
+    using args_t = argument_desc::Types;
+    using scalar_t = scalar_desc::Types;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(args.size()); i++) {
+        switch (args[i].t) {
+            case args_t::INPUT:
+                set_arg_memory(kernel, i, get_indexed(data.inputs, args[i].index));
+                break;
+            case args_t::INPUT_OF_FUSED_PRIMITIVE:
+                set_arg_memory(kernel, i, get_indexed(data.fused_op_inputs, args[i].index));
+                break;
+            case args_t::INTERNAL_BUFFER:
+                set_arg_memory(kernel, i, get_indexed(data.intermediates, args[i].index));
+                break;
+            case args_t::OUTPUT:
+                set_arg_memory(kernel, i, data.output);
+                break;
+            case args_t::WEIGHTS:
+                set_arg_memory(kernel, i, data.weights);
+                break;
+            case args_t::BIAS:
+                set_arg_memory(kernel, i, data.bias);
+                break;
+            case args_t::WEIGHTS_ZERO_POINTS:
+                set_arg_memory(kernel, i, data.weights_zero_points);
+                break;
+            case args_t::ACTIVATIONS_ZERO_POINTS:
+                set_arg_memory(kernel, i, data.activations_zero_points);
+                break;
+            case args_t::COMPENSATION:
+                set_arg_memory(kernel, i, data.compensation);
+                break;
+            case args_t::DECOMPRESSION_SCALE:
+                set_arg_memory(kernel, i, data.decompression_scale);
+                break;
+            case args_t::SCALE_TABLE:
+                set_arg_memory(kernel, i, data.scale_table);
+                break;
+            case args_t::SLOPE:
+                set_arg_memory(kernel, i, data.slope);
+                break;
+            case args_t::SPLIT:
+                set_arg_value(kernel, i, data.split);
+                break;
+            case args_t::SCALAR: {
+                if (!data.scalars || args[i].index >= data.scalars->size())
+                    throw std::runtime_error("Error set arg " + std::to_string(i) + ", the scalar isn't set\n");
+                const auto& scalar = (*data.scalars)[args[i].index];
+                switch (scalar.t) {
+                    case scalar_t::UINT8: set_arg_value(kernel, i, scalar.v.u8); break;
+                    case scalar_t::UINT16: set_arg_value(kernel, i, scalar.v.u16); break;
+                    case scalar_t::UINT32: set_arg_value(kernel, i, scalar.v.u32); break;
+                    case scalar_t::UINT64: set_arg_value(kernel, i, scalar.v.u64); break;
+                    case scalar_t::INT8: set_arg_value(kernel, i, scalar.v.s8); break;
+                    case scalar_t::INT16: set_arg_value(kernel, i, scalar.v.s16); break;
+                    case scalar_t::INT32: set_arg_value(kernel, i, scalar.v.s32); break;
+                    case scalar_t::INT64: set_arg_value(kernel, i, scalar.v.s64); break;
+                    case scalar_t::FLOAT32: set_arg_value(kernel, i, scalar.v.f32); break;
+                    case scalar_t::FLOAT64: set_arg_value(kernel, i, scalar.v.f64); break;
+                    default: throw std::runtime_error("Error set arg " + std::to_string(i) + ", unknown scalar type\n");
+                }
+                break;
+            }
+            case args_t::RECURRENT:  // RNN/LSTM/GRU layers
+                set_arg_memory(kernel, i, data.recurrent);
+                break;
+            case args_t::HIDDEN:  // RNN/LSTM/GRU layers
+                set_arg_memory(kernel, i, data.hidden);
+                break;
+            case args_t::CELL:  // LSTMlayers
+                set_arg_memory(kernel, i, data.cell);
+                break;
+            default:
+                throw std::runtime_error("Error set arg " + std::to_string(i) + ", unsupported argument type\n");
+        }
+    }
+}
+
+}  // namespace
+
+ze_stream::ze_stream(const ze_engine& engine) : ze_stream(engine, engine.configuration().enable_profiling) {}
+
+ze_stream::ze_stream(const ze_engine& engine, bool enable_profiling)
+    : stream(engine.configuration().queue_type)
+    , _engine(engine)
+    , _profiling(enable_profiling)
+    , sync_method(enable_profiling ? sync_methods::events : sync_methods::barriers) {
+    ze_command_queue_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    desc.ordinal = engine.get_ze_device().get_compute_queue_ordinal();
+    desc.index = 0;
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    desc.priority = get_queue_priority(engine.configuration().priority_mode);
+    ZE_CHECK(zeCommandListCreateImmediate(engine.get_context(), engine.get_device_handle(), &desc, &_command_list));
+}
+
+ze_stream::~ze_stream() {
+    if (_command_list)
+        zeCommandListDestroy(_command_list);
+}
+
+#ifdef ENABLE_ONEDNN_FOR_GPU
+dnnl::stream& ze_stream::get_onednn_stream() {
+    throw std::runtime_error("[GPU] onednn stream isn't supported by Level Zero engine");
+}
+#endif
+
+std::shared_ptr<ze_event_pool> ze_stream::get_event_pool() {
+    if (!_event_pool || _event_pool->is_exhausted())
+        _event_pool = std::make_shared<ze_event_pool>(_engine.get_ze_device(), event_pool_size, _profiling);
+    return _event_pool;
+}
+
+std::shared_ptr<ze_event> ze_stream::create_ze_event(uint64_t queue_stamp) {
+    return std::make_shared<ze_event>(get_event_pool(), queue_stamp);
+}
+
+std::vector<ze_event_handle_t> ze_stream::get_handles(std::vector<event::ptr> const& deps) const {
+    std::vector<ze_event_handle_t> handles;
+    for (auto& dep : deps) {
+        if (auto ze_base_ev = dynamic_cast<ze_base_event*>(dep.get()))
+            if (ze_base_ev->get() != nullptr)
+                handles.push_back(ze_base_ev->get());
+    }
+    return handles;
+}
+
+void ze_stream::set_arguments(kernel& kernel, const kernel_arguments_desc& args_desc, const kernel_arguments_data& args) {
+    auto& kern = downcast<ze_kernel>(kernel);
+    set_arguments_impl(kern.get_handle(), args_desc.arguments, args);
+}
+
+event::ptr ze_stream::enqueue_kernel(kernel& kernel,
+                                     const kernel_arguments_desc& args_desc,
+                                     const kernel_arguments_data& /* args */,
+                                     std::vector<event::ptr> const& deps,
+                                     bool is_output) {
+    auto& kern = downcast<ze_kernel>(kernel);
+
+    const auto& global = args_desc.workGroups.global;
+    const auto& local = args_desc.workGroups.local;
+    if (global.empty() || global.size() > 3)
+        throw std::runtime_error("[GPU] Unsupported global work size dimensions of the kernel " + args_desc.layerID);
+
+    std::array<uint32_t, 3> global_size = {{1, 1, 1}};
+    std::array<uint32_t, 3> group_size = {{1, 1, 1}};
+    for (size_t i = 0; i < global.size(); i++)
+        global_size[i] = static_cast<uint32_t>(global[i]);
+    if (local.size() == global.size()) {
+        for (size_t i = 0; i < local.size(); i++)
+            group_size[i] = static_cast<uint32_t>(local[i]);
+    } else {
+        ZE_CHECK(zeKernelSuggestGroupSize(kern.get_handle(), global_size[0], global_size[1], global_size[2],
+                                          &group_size[0], &group_size[1], &group_size[2]));
+    }
+
+    // Level Zero launches the whole groups only
+    ze_group_count_t group_count;
+    for (size_t i = 0; i < 3; i++) {
+        if (group_size[i] == 0 || global_size[i] % group_size[i] != 0)
+            throw std::runtime_error("[GPU] The global work size of the kernel " + args_desc.layerID +
+                                     " isn't divisible by the local one");
+    }
+    group_count.groupCountX = global_size[0] / group_size[0];
+    group_count.groupCountY = global_size[1] / group_size[1];
+    group_count.groupCountZ = global_size[2] / group_size[2];
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    kern.set_group_size(group_size[0], group_size[1], group_size[2]);
+
+    std::vector<ze_event_handle_t> dep_events;
+    if (sync_method == sync_methods::events) {
+        dep_events = get_handles(deps);
+    } else {
+        sync_events(deps, is_output);
+    }
+
+    bool set_output_event = sync_method == sync_methods::events || is_output;
+    auto ret_ev = set_output_event ? create_ze_event(++_queue_counter) : std::make_shared<ze_event>(nullptr, ++_queue_counter);
+
+    ZE_CHECK(zeCommandListAppendLaunchKernel(_command_list, kern.get_handle(), &group_count, ret_ev->get(),
+                                             static_cast<uint32_t>(dep_events.size()),
+                                             dep_events.empty() ? nullptr : dep_events.data()));
+    return ret_ev;
+}
+
+void ze_stream::enqueue_barrier() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ZE_CHECK(zeCommandListAppendBarrier(_command_list, nullptr, 0, nullptr));
+}
+
+void ze_stream::enqueue_barrier(std::vector<event::ptr> const& deps) {
+    auto dep_events = get_handles(deps);
+    if (dep_events.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ZE_CHECK(zeCommandListAppendBarrier(_command_list, nullptr, static_cast<uint32_t>(dep_events.size()), dep_events.data()));
+}
+
+event::ptr ze_stream::enqueue_full_marker() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto ret_ev = create_ze_event(++_queue_counter);
+    ZE_CHECK(zeCommandListAppendBarrier(_command_list, ret_ev->get(), 0, nullptr));
+    return ret_ev;
+}
+
+event::ptr ze_stream::enqueue_recording() {
+    throw std::runtime_error("[GPU] There is no finished recording to enqueue");
+}
+
+event::ptr ze_stream::enqueue_marker(std::vector<event::ptr> const& deps, bool is_output) {
+    if (deps.empty())
+        return create_user_event(true);
+
+    if (sync_method == sync_methods::events) {
+        auto dep_events = get_handles(deps);
+        if (dep_events.empty())
+            return create_user_event(true);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto ret_ev = create_ze_event(++_queue_counter);
+        ZE_CHECK(zeCommandListAppendBarrier(_command_list, ret_ev->get(), static_cast<uint32_t>(dep_events.size()),
+                                            dep_events.data()));
+        return ret_ev;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    sync_events(deps, is_output);
+    if (_last_barrier_ev)
+        return _last_barrier_ev;
+    return std::make_shared<ze_event>(nullptr, _last_barrier);
+}
+
+event::ptr ze_stream::group_events(std::vector<event::ptr> const& deps) {
+    return std::make_shared<ze_events>(deps);
+}
+
+event::ptr ze_stream::create_user_event(bool set) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return std::make_shared<ze_user_event>(get_event_pool(), set);
+}
+
+event::ptr ze_stream::create_base_event() {
+    return std::make_shared<ze_event>(nullptr, ++_queue_counter);
+}
+
+void ze_stream::flush() const {
+    // the immediate command list submits the commands when they're appended
+}
+
+void ze_stream::finish() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ZE_CHECK(zeCommandListHostSynchronize(_command_list, std::numeric_limits<uint64_t>::max()));
+}
+
+void ze_stream::copy(void* dst, const void* src, size_t size) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ZE_CHECK(zeCommandListAppendBarrier(_command_list, nullptr, 0, nullptr));
+    ZE_CHECK(zeCommandListAppendMemoryCopy(_command_list, dst, src, size, nullptr, 0, nullptr));
+    ZE_CHECK(zeCommandListHostSynchronize(_command_list, std::numeric_limits<uint64_t>::max()));
+}
+
+void ze_stream::fill(void* dst, unsigned char pattern, size_t size) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ZE_CHECK(zeCommandListAppendBarrier(_command_list, nullptr, 0, nullptr));
+    ZE_CHECK(zeCommandListAppendMemoryFill(_command_list, dst, &pattern, sizeof(pattern), size, nullptr, 0, nullptr));
+    ZE_CHECK(zeCommandListHostSynchronize(_command_list, std::numeric_limits<uint64_t>::max()));
+}
+
+void ze_stream::wait_for_events(const std::vector<event::ptr>& events) {
+    for (auto& ev : events) {
+        if (ev)
+            ev->wait();
+    }
+}
+
+void ze_stream::sync_events(std::vector<event::ptr> const& deps, bool is_output) {
+    bool needs_barrier = false;
+    for (auto& dep : deps) {
+        auto* ze_base_ev = downcast<ze_base_event>(dep.get());
+        if (ze_base_ev->get_queue_stamp() > _last_barrier) {
+            needs_barrier = true;
+        }
+    }
+
+    if (needs_barrier) {
+        if (is_output) {
+            _last_barrier_ev = create_ze_event(++_queue_counter);
+            ZE_CHECK(zeCommandListAppendBarrier(_command_list, _last_barrier_ev->get(), 0, nullptr));
+        } else {
+            ZE_CHECK(zeCommandListAppendBarrier(_command_list, nullptr, 0, nullptr));
+            ++_queue_counter;
+        }
+
+        _last_barrier = _queue_counter.load();
+    }
+}
+
+}  // namespace ze
+}  // namespace cldnn
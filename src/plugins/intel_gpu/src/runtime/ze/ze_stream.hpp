@@ -0,0 +1,88 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "intel_gpu/runtime/event.hpp"
+#include "intel_gpu/runtime/stream.hpp"
+#include "ze_common.hpp"
+#include "ze_engine.hpp"
+#include "ze_event.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cldnn {
+namespace ze {
+
+// Possible sync methods for kernels in stream
+enum class sync_methods {
+    /* Each kernel signals its own event which the dependent kernels wait for, is used with the profiling */
+    events = 0,
+    /* Appends a barrier before the kernel which depends on ones appended after the last barrier. The commands of the
+       command list may overlap, so the barriers are used for the in-order queue type too */
+    barriers = 1
+};
+
+// Appends the commands to an immediate command list, which submits them to the device at once
+class ze_stream : public stream {
+public:
+    explicit ze_stream(const ze_engine& engine);
+    ze_stream(const ze_engine& engine, bool enable_profiling);
+    ~ze_stream();
+
+    void flush() const override;
+    void finish() const override;
+
+    void set_arguments(kernel& kernel, const kernel_arguments_desc& args_desc, const kernel_arguments_data& args) override;
+    event::ptr enqueue_kernel(kernel& kernel,
+                              const kernel_arguments_desc& args_desc,
+                              const kernel_arguments_data& args,
+                              std::vector<event::ptr> const& deps,
+                              bool is_output = false) override;
+    event::ptr enqueue_marker(std::vector<event::ptr> const& deps, bool is_output) override;
+    event::ptr group_events(std::vector<event::ptr> const& deps) override;
+    void wait_for_events(const std::vector<event::ptr>& events) override;
+    void enqueue_barrier() override;
+    void enqueue_barrier(std::vector<event::ptr> const& deps) override;
+    event::ptr enqueue_full_marker() override;
+    // the command lists of Level Zero aren't recorded, the immediate one has no per kernel submission cost anyway
+    bool begin_recording() override { return false; }
+    void end_recording() override {}
+    event::ptr enqueue_recording() override;
+    event::ptr create_user_event(bool set) override;
+    event::ptr create_base_event() override;
+
+    /// Copies the memory once all the commands appended before are done and waits for the copy
+    void copy(void* dst, const void* src, size_t size) const;
+    /// Fills the memory once all the commands appended before are done and waits for the fill
+    void fill(void* dst, unsigned char pattern, size_t size) const;
+
+#ifdef ENABLE_ONEDNN_FOR_GPU
+    dnnl::stream& get_onednn_stream() override;
+#endif
+
+private:
+    void sync_events(std::vector<event::ptr> const& deps, bool is_output = false);
+    std::shared_ptr<ze_event_pool> get_event_pool();
+    std::shared_ptr<ze_event> create_ze_event(uint64_t queue_stamp);
+    std::vector<ze_event_handle_t> get_handles(std::vector<event::ptr> const& deps) const;
+
+    const ze_engine& _engine;
+    ze_command_list_handle_t _command_list = nullptr;
+    // the immediate command list isn't thread safe
+    mutable std::mutex _mutex;
+    bool _profiling;
+    std::shared_ptr<ze_event_pool> _event_pool;
+    std::atomic<uint64_t> _queue_counter{0};
+    std::atomic<uint64_t> _last_barrier{0};
+    std::shared_ptr<ze_event> _last_barrier_ev;
+
+    sync_methods sync_method;
+};
+
+}  // namespace ze
+}  // namespace cldnn
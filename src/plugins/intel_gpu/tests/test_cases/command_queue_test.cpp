@@ -99,3 +99,37 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
     auto engine = engine::create(engine_types::ocl, runtime_types::ocl, configuration);
     exexute_network(*engine);
 }
+
+TEST(command_queue_test, profiled_events_have_device_timestamps) {
+    engine_configuration configuration =
+        engine_configuration(
+            true,           // profiling
+            queue_types::in_order);
+    auto engine = engine::create(engine_types::ocl, runtime_types::ocl, configuration);
+
+    auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 2, 3, 2, 2 } });
+    set_values(input, std::vector<float>(input->count(), 1.f));
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(arg_max_min("arg_max", { "input" }, arg_max_min::max));
+
+    network network(*engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+    auto ev = outputs.at("arg_max").get_event();
+    ev->wait();
+
+    instrumentation::device_timestamps timestamps;
+    ASSERT_TRUE(ev->get_device_timestamps(timestamps));
+    EXPECT_LE(timestamps.queued, timestamps.submit);
+    EXPECT_LE(timestamps.submit, timestamps.start);
+    EXPECT_LE(timestamps.start, timestamps.end);
+
+    for (auto& pi : network.get_primitives_info()) {
+        if (pi.original_id != "arg_max")
+            continue;
+        ASSERT_EQ(pi.work_groups.size(), size_t(1));
+        EXPECT_FALSE(pi.work_groups[0].global.empty());
+        EXPECT_EQ(pi.memory_bytes, input->get_layout().bytes_count() + pi.output_layout.bytes_count());
+    }
+}
@@ -286,6 +286,138 @@ TEST(fully_connected_gpu, no_biases_int8) {
     EXPECT_EQ(-52.0f, output_ptr[3]);
 }
 
+TEST(fully_connected_gpu, compressed_int8_weights) {
+    //  Input  : 3x1
+    //  Output : 4x1
+    //  Weights: 4x3 int8, decompressed by the per output feature scales
+    //
+    //  Input:
+    //  8.0f, 2.0f, -4.0f
+    //
+    //  Weights:
+    //   2      1     0
+    //  -3     -2     1
+    //   0     -2    -4
+    //  -5     10     8
+    //
+    //  Scales:
+    //   0.5    2.0   0.25   1.0
+    //
+    //  Biases:
+    //   1.0   -1.0   0.0    2.0
+    //
+    //  Output:
+    //  10    -65    3    -50
+
+    const int32_t input_x = 3, input_b = 1,  // size of whole input buffer
+        weight_b = 4, weight_x = 3;  // size of whole weights buffer
+
+    auto& engine = get_test_engine();
+
+    auto input_prim = engine.allocate_memory({ data_types::f32,format::bfyx,{ input_b, 1, input_x, 1 } });
+    auto weights_prim = engine.allocate_memory({ data_types::i8,format::bfyx,{ weight_b, 1, weight_x, 1 } });
+    auto scale_prim = engine.allocate_memory({ data_types::f32,format::bfyx,{ 1, 1, weight_b, 1 } });
+    auto bias_prim = engine.allocate_memory({ data_types::f32,format::bfyx,{ 1, 1, weight_b, 1 } });
+
+    set_values(input_prim, { 8.0f, 2.0f, -4.0f });
+    set_values<char>(weights_prim, { 2, 1, 0, -3, -2, 1, 0, -2, -4, -5, 10, 8 });
+    set_values(scale_prim, { 0.5f, 2.0f, 0.25f, 1.0f });
+    set_values(bias_prim, { 1.0f, -1.0f, 0.0f, 2.0f });
+
+    auto fc = fully_connected("full_con_prim", "input", "weights", "bias");
+    fc.decompression_scale = "scale";
+    topology topology;
+    topology.add(input_layout("input", input_prim->get_layout()));
+    topology.add(data("weights", weights_prim));
+    topology.add(data("scale", scale_prim));
+    topology.add(data("bias", bias_prim));
+    topology.add(fc);
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "full_con_prim");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    EXPECT_EQ(output_prim->get_layout().data_type, data_types::f32);
+
+    cldnn::mem_lock<float> output_ptr (output_prim, get_test_stream());
+
+    EXPECT_EQ(10.0f, output_ptr[0]);
+    EXPECT_EQ(-65.0f, output_ptr[1]);
+    EXPECT_EQ(3.0f, output_ptr[2]);
+    EXPECT_EQ(-50.0f, output_ptr[3]);
+}
+
+TEST(fully_connected_gpu, compressed_int8_weights_dynamic_quantization) {
+    //  Input  : 9x2, each row is quantized to int8 with its own scale
+    //  Output : 3x2
+    //  Weights: 3x9 int8, decompressed by the per output feature scales
+    //
+    //  The result differs from the float one by the rounding of the input only
+
+    const int32_t input_x = 9, input_b = 2, weight_b = 3;
+
+    auto& engine = get_test_engine();
+
+    auto input_prim = engine.allocate_memory({ data_types::f32,format::bfyx,{ input_b, 1, input_x, 1 } });
+    auto weights_prim = engine.allocate_memory({ data_types::i8,format::bfyx,{ weight_b, 1, input_x, 1 } });
+    auto scale_prim = engine.allocate_memory({ data_types::f32,format::bfyx,{ 1, 1, weight_b, 1 } });
+    auto bias_prim = engine.allocate_memory({ data_types::f32,format::bfyx,{ 1, 1, weight_b, 1 } });
+
+    std::vector<float> input = { 0.5f, -1.25f, 3.0f, 0.1f, -0.7f, 2.2f, -3.1f, 1.0f, 0.3f,
+                                 40.0f, -12.5f, 7.0f, 0.0f, 25.0f, -33.0f, 1.5f, -8.0f, 16.0f };
+    std::vector<char> weights = { 12, -7, 3, 100, -127, 5, 0, 64, -32,
+                                  -1, 2, -3, 4, -5, 6, -7, 8, -9,
+                                  127, 127, -128, 0, 50, -50, 25, -25, 1 };
+    std::vector<float> scales = { 0.01f, 0.5f, 0.002f };
+    std::vector<float> biases = { 1.0f, -2.0f, 0.5f };
+    set_values(input_prim, input);
+    set_values<char>(weights_prim, weights);
+    set_values(scale_prim, scales);
+    set_values(bias_prim, biases);
+
+    auto fc = fully_connected("full_con_prim", "input", "weights", "bias");
+    fc.decompression_scale = "scale";
+    fc.dynamic_quantization = true;
+    topology topology;
+    topology.add(input_layout("input", input_prim->get_layout()));
+    topology.add(data("weights", weights_prim));
+    topology.add(data("scale", scale_prim));
+    topology.add(data("bias", bias_prim));
+    topology.add(fc);
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "full_con_prim");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    cldnn::mem_lock<float> output_ptr (output_prim, get_test_stream());
+
+    for (int32_t b = 0; b < input_b; b++) {
+        float max_abs = 0.f;
+        for (int32_t x = 0; x < input_x; x++)
+            max_abs = std::max(max_abs, std::fabs(input[b * input_x + x]));
+        for (int32_t o = 0; o < weight_b; o++) {
+            float expected = 0.f;
+            float tolerance = 0.f;
+            for (int32_t x = 0; x < input_x; x++) {
+                const float weight = weights[o * input_x + x] * scales[o];
+                expected += input[b * input_x + x] * weight;
+                // the input is rounded to the half of the quantization step at most
+                tolerance += std::fabs(weight) * max_abs / 254.f;
+            }
+            expected += biases[o];
+            EXPECT_NEAR(expected, output_ptr[b * weight_b + o], tolerance + 1e-4f) << "b=" << b << " o=" << o;
+        }
+    }
+}
+
 TEST(fully_connected_gpu, xb_f32_batch_1) {
     //  Input  : 3x1
     //  Output : 4x1
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils.h"
+
+#include "kernels_cache.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+std::shared_ptr<kernel_string> make_kernel_string(const std::string& entry_point, const std::string& body) {
+    auto code = std::make_shared<kernel_string>();
+    code->entry_point = entry_point;
+    code->str = "__kernel void " + entry_point + "(__global float* data) { " + body + " }\n";
+    code->batch_compilation = true;
+    return code;
+}
+}  // namespace
+
+TEST(kernels_cache, shares_kernels_among_programs) {
+    auto& engine = get_test_engine();
+    kernels_cache first(engine, 1);
+    kernels_cache second(engine, 2);
+
+    auto first_id = first.set_kernel_source(make_kernel_string("add_one", "data[0] += 1.f;"), false);
+    first.build_all();
+    auto second_id = second.set_kernel_source(make_kernel_string("add_one", "data[0] += 1.f;"), false);
+    second.build_all();
+
+    ASSERT_EQ(first.get_kernel(first_id), second.get_kernel(second_id));
+}
+
+TEST(kernels_cache, shares_kernels_differing_in_entry_point_only) {
+    auto& engine = get_test_engine();
+    kernels_cache first(engine, 1);
+    kernels_cache second(engine, 2);
+
+    // the entry points carry the ids of the programs and the nodes
+    auto first_id = first.set_kernel_source(make_kernel_string("add_one_1_3", "data[0] += 1.f;"), false);
+    first.build_all();
+    auto second_id = second.set_kernel_source(make_kernel_string("add_one_2_5", "data[0] += 1.f;"), false);
+    second.build_all();
+
+    ASSERT_EQ(first.get_kernel(first_id), second.get_kernel(second_id));
+}
+
+TEST(kernels_cache, does_not_share_different_kernels) {
+    auto& engine = get_test_engine();
+    kernels_cache first(engine, 1);
+    kernels_cache second(engine, 2);
+
+    auto first_id = first.set_kernel_source(make_kernel_string("add_1", "data[0] += 1.f;"), false);
+    first.build_all();
+    auto second_id = second.set_kernel_source(make_kernel_string("add_2", "data[0] += 2.f;"), false);
+    second.build_all();
+
+    ASSERT_NE(first.get_kernel(first_id), second.get_kernel(second_id));
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef ENABLE_INTEL_GPU_LEVEL_ZERO
+
+#include "test_utils/test_utils.h"
+
+#include <intel_gpu/primitives/input_layout.hpp>
+#include <intel_gpu/primitives/activation.hpp>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+std::shared_ptr<engine> create_level_zero_engine(bool enable_profiling) {
+    engine_configuration configuration(enable_profiling, queue_types::in_order);
+    return engine::create(engine_types::ze, runtime_types::ze, configuration);
+}
+
+void execute_relu(engine& engine) {
+    layout in_layout{ data_types::f32, format::bfyx, { 1, 2, 4, 4 } };
+    auto input = engine.allocate_memory(in_layout, allocation_type::usm_host);
+
+    topology topology;
+    topology.add(input_layout("input", in_layout));
+    topology.add(activation("relu", "input", activation_func::relu));
+
+    network network(engine, topology);
+    auto& stream = network.get_stream();
+    const size_t count = in_layout.count();
+    {
+        cldnn::mem_lock<float> input_ptr(input, stream);
+        for (size_t i = 0; i < count; i++)
+            input_ptr[i] = static_cast<float>(i) - static_cast<float>(count / 2);
+    }
+
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+    ASSERT_EQ(outputs.size(), size_t(1));
+
+    auto output = outputs.at("relu").get_memory();
+    cldnn::mem_lock<float, mem_lock_type::read> output_ptr(output, stream);
+    for (size_t i = 0; i < count; i++)
+        EXPECT_EQ(output_ptr[i], std::max(0.f, static_cast<float>(i) - static_cast<float>(count / 2))) << i;
+}
+}  // namespace
+
+TEST(level_zero_engine_test, executes_network) {
+    auto engine = create_level_zero_engine(false);
+    ASSERT_EQ(engine->type(), engine_types::ze);
+    execute_relu(*engine);
+}
+
+TEST(level_zero_engine_test, executes_network_with_profiling) {
+    auto engine = create_level_zero_engine(true);
+    execute_relu(*engine);
+}
+
+TEST(level_zero_engine_test, copies_device_memory) {
+    auto engine = create_level_zero_engine(false);
+    auto& stream = engine->get_program_stream();
+    layout l{ data_types::f32, format::bfyx, { 1, 1, 8, 8 } };
+
+    auto host = engine->allocate_memory(l, allocation_type::usm_host);
+    auto device = engine->allocate_memory(l, allocation_type::usm_device);
+    ASSERT_EQ(device->get_allocation_type(), allocation_type::usm_device);
+    {
+        cldnn::mem_lock<float> host_ptr(host, stream);
+        for (size_t i = 0; i < l.count(); i++)
+            host_ptr[i] = static_cast<float>(i);
+    }
+    device->copy_from(stream, *host)->wait();
+
+    cldnn::mem_lock<float, mem_lock_type::read> device_ptr(device, stream);
+    for (size_t i = 0; i < l.count(); i++)
+        EXPECT_EQ(device_ptr[i], static_cast<float>(i)) << i;
+}
+
+#endif  // ENABLE_INTEL_GPU_LEVEL_ZERO
@@ -406,6 +406,67 @@ TEST(memory_pool, shared_mem_pool_diff_batches) {
     EXPECT_EQ(engine->get_max_used_device_memory(), (uint64_t) 5912);
 }
 
+TEST(memory_pool, shared_mem_pool_diff_batches_networks) {
+    // We need a new engine here to get correct get_max_used_device_memory() result
+    // If we reuse common engine, then max memory value will be taken from some previously executed tests
+    // as it's tracked within engine instance
+    auto engine = create_test_engine();
+    auto batch_8 = 8;
+    auto batch_1 = 1;
+    auto feature_num = 3;
+    auto inp_x_size = 4;
+    auto inp_y_size = 4;
+    auto dt = data_types::f32;
+    auto fmt = format::bfyx;
+    layout lay_batch_1 = { dt, fmt, { tensor(spatial(inp_x_size, inp_y_size), feature(feature_num), batch(batch_1)) }};
+    layout lay_batch_8 = { dt, fmt, { tensor(spatial(inp_x_size, inp_y_size), feature(feature_num), batch(batch_8)) }};
+    auto input_1 = engine->allocate_memory(lay_batch_1);
+    auto input_8 = engine->allocate_memory(lay_batch_8);
+    auto weights = engine->allocate_memory({ dt, fmt, { 1, 3, 3, 2 } });
+
+    set_values(input_1, generate_random_1d<float>(batch_1 * feature_num * inp_x_size * inp_y_size, 0, 1));
+    set_values(input_8, generate_random_1d<float>(batch_8 * feature_num * inp_x_size * inp_y_size, 0, 1));
+    set_values(weights, { 0.10f, 0.2f, 0.1f, 0.2f, 0.1f, 0.2f });
+
+    topology topo(
+        input_layout("input", input_8->get_layout()),
+        data("weights", weights),
+        convolution("conv", "input", { "weights" }, { 1, 1, 1, 2 }),
+        activation("relu", "conv", activation_func::relu),
+        softmax("softmax", "relu"));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    auto stream = engine->create_stream();
+    auto pool = std::make_shared<memory_pool>(*engine);
+
+    network network_first(program::build_program(*engine, topo, bo), stream, pool, 0);
+    network_first.set_input_data("input", input_8);
+    network_first.execute();
+    auto used_by_first = engine->get_max_used_device_memory();
+
+    topo.change_input_layout("input", input_1->get_layout());
+
+    network network_own_pool(program::build_program(*engine, topo, bo), stream);
+    network_own_pool.set_input_data("input", input_1);
+    network_own_pool.execute();
+    auto used_by_own_pool = engine->get_max_used_device_memory() - used_by_first;
+
+    network network_shared_pool(program::build_program(*engine, topo, bo), stream, pool, 0);
+    network_shared_pool.set_input_data("input", input_1);
+    auto outputs = network_shared_pool.execute();
+    auto used_by_shared_pool = engine->get_max_used_device_memory() - used_by_first - used_by_own_pool;
+
+    // the intermediate buffer of the batch 1 network is taken from the buffers of the batch 8 one
+    EXPECT_LT(used_by_shared_pool, used_by_own_pool);
+
+    auto output = outputs.at("softmax").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, *stream);
+    for (size_t i = 0; i < output->count(); i++)
+        EXPECT_FALSE(std::isnan(output_ptr[i]));
+}
+
 TEST(memory_pool, shared_dep_two_output) {
     // We need a new engine here to get correct get_max_used_device_memory() result
     // If we reuse common engine, then max memory value will be taken from some previously executed tests
@@ -556,3 +617,35 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
 }
+
+TEST(memory_tests, share_host_ptr) {
+    auto& engine = get_test_engine();
+    const int count = 1024;
+    layout lay(data_types::f32, format::bfyx, tensor(1, 1, count, 1));
+
+    // the page aligned host memory of the cache line multiple size
+    std::vector<float> storage(count + 4096 / sizeof(float));
+    void* ptr = storage.data();
+    size_t space = storage.size() * sizeof(float);
+    ASSERT_NE(nullptr, std::align(4096, lay.bytes_count(), ptr, space));
+    auto host_data = static_cast<float*>(ptr);
+    for (int i = 0; i < count; i++)
+        host_data[i] = -static_cast<float>(i);
+
+    bool is_integrated = engine.get_device_info().dev_type == device_type::integrated_gpu;
+    EXPECT_EQ(is_integrated, engine.can_share_host_ptr(host_data, lay.bytes_count()));
+    EXPECT_FALSE(engine.can_share_host_ptr(host_data + 1, lay.bytes_count()));
+
+    topology topo(
+        input_layout("input", lay),
+        activation("abs", "input", activation_func::abs));
+
+    network network(engine, topo);
+    network.set_input_data("input", engine.share_host_ptr(lay, host_data));
+    auto outputs = network.execute();
+
+    auto output = outputs.at("abs").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+    for (int i = 0; i < count; i++)
+        EXPECT_EQ(static_cast<float>(i), output_ptr[i]);
+}
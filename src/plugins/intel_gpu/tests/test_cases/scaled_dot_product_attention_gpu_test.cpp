@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "test_utils.h"
+
+#include <intel_gpu/primitives/input_layout.hpp>
+#include <intel_gpu/primitives/scaled_dot_product_attention.hpp>
+#include <intel_gpu/primitives/gemm.hpp>
+#include <intel_gpu/primitives/eltwise.hpp>
+#include <intel_gpu/primitives/softmax.hpp>
+#include <intel_gpu/primitives/reorder.hpp>
+#include <intel_gpu/primitives/data.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+// query (B, H, S_q, D), key (B, H, S_kv, D), value (B, H, S_kv, D_v) in bfyx
+std::vector<float> attention_ref(const std::vector<float>& query, const std::vector<float>& key, const std::vector<float>& value,
+                                 size_t batch_heads, size_t q_len, size_t kv_len, size_t head_size, size_t value_size, float scale) {
+    std::vector<float> output(batch_heads * q_len * value_size);
+    for (size_t bh = 0; bh < batch_heads; ++bh) {
+        for (size_t i = 0; i < q_len; ++i) {
+            std::vector<float> scores(kv_len);
+            for (size_t j = 0; j < kv_len; ++j) {
+                float score = 0.0f;
+                for (size_t d = 0; d < head_size; ++d)
+                    score += query[(bh * q_len + i) * head_size + d] * key[(bh * kv_len + j) * head_size + d];
+                scores[j] = score * scale;
+            }
+            float max_score = *std::max_element(scores.begin(), scores.end());
+            float sum = 0.0f;
+            for (auto& score : scores) {
+                score = std::exp(score - max_score);
+                sum += score;
+            }
+            for (size_t d = 0; d < value_size; ++d) {
+                float res = 0.0f;
+                for (size_t j = 0; j < kv_len; ++j)
+                    res += scores[j] / sum * value[(bh * kv_len + j) * value_size + d];
+                output[(bh * q_len + i) * value_size + d] = res;
+            }
+        }
+    }
+    return output;
+}
+
+struct attention_inputs {
+    memory::ptr query;
+    memory::ptr key;
+    memory::ptr value;
+    std::vector<float> expected;
+};
+
+struct attention_dims {
+    int batch, heads, q_len, kv_len, head_size, value_size;
+};
+
+// the key and value are longer than one tile of the local memory and aren't a multiple of it
+constexpr attention_dims default_dims = { 2, 3, 5, 19, 8, 4 };
+
+attention_inputs make_inputs(engine& engine, float scale, const attention_dims& dims = default_dims) {
+    attention_inputs inputs;
+    inputs.query = engine.allocate_memory({ data_types::f32, format::bfyx, { dims.batch, dims.heads, dims.head_size, dims.q_len } });
+    inputs.key = engine.allocate_memory({ data_types::f32, format::bfyx, { dims.batch, dims.heads, dims.head_size, dims.kv_len } });
+    inputs.value = engine.allocate_memory({ data_types::f32, format::bfyx, { dims.batch, dims.heads, dims.value_size, dims.kv_len } });
+
+    auto query_data = generate_random_1d<float>(dims.batch * dims.heads * dims.q_len * dims.head_size, -2, 2);
+    auto key_data = generate_random_1d<float>(dims.batch * dims.heads * dims.kv_len * dims.head_size, -2, 2);
+    auto value_data = generate_random_1d<float>(dims.batch * dims.heads * dims.kv_len * dims.value_size, -2, 2);
+    set_values(inputs.query, query_data);
+    set_values(inputs.key, key_data);
+    set_values(inputs.value, value_data);
+
+    inputs.expected = attention_ref(query_data, key_data, value_data, dims.batch * dims.heads, dims.q_len, dims.kv_len,
+                                    dims.head_size, dims.value_size, scale);
+    return inputs;
+}
+
+void check_output(const memory::ptr& output, const std::vector<float>& expected, const attention_dims& dims = default_dims) {
+    auto output_layout = output->get_layout();
+    ASSERT_EQ(output_layout.size, tensor(dims.batch, dims.heads, dims.value_size, dims.q_len));
+
+    cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+    ASSERT_EQ(output_ptr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(expected[i], output_ptr[i], 1e-4f) << "i = " << i;
+    }
+}
+
+// query x key^T x value with the scale applied to the scores
+topology make_gemm_softmax_gemm(const attention_inputs& inputs, engine& engine, float scale) {
+    auto scale_mem = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+    set_values(scale_mem, { scale });
+
+    topology topology;
+    topology.add(input_layout("query", inputs.query->get_layout()));
+    topology.add(input_layout("key", inputs.key->get_layout()));
+    topology.add(input_layout("value", inputs.value->get_layout()));
+    topology.add(data("scale", scale_mem));
+    topology.add(gemm("qk", { "query", "key" }, data_types::f32, false, true));
+    topology.add(eltwise("scaled_qk", { "qk", "scale" }, eltwise_mode::prod));
+    topology.add(softmax("softmax", "scaled_qk", softmax::normalize_x));
+    topology.add(gemm("sv", { "softmax", "value" }, data_types::f32));
+    topology.add(reorder("output", "sv", format::bfyx, data_types::f32));
+    return topology;
+}
+}  // namespace
+
+TEST(scaled_dot_product_attention_gpu, basic) {
+    auto& engine = get_test_engine();
+    const float scale = 0.35f;
+    auto inputs = make_inputs(engine, scale);
+
+    topology topology;
+    topology.add(input_layout("query", inputs.query->get_layout()));
+    topology.add(input_layout("key", inputs.key->get_layout()));
+    topology.add(input_layout("value", inputs.value->get_layout()));
+    topology.add(scaled_dot_product_attention("sdpa", { "query", "key", "value" }, scale));
+
+    network network(engine, topology);
+    network.set_input_data("query", inputs.query);
+    network.set_input_data("key", inputs.key);
+    network.set_input_data("value", inputs.value);
+
+    auto outputs = network.execute();
+    check_output(outputs.at("sdpa").get_memory(), inputs.expected);
+}
+
+TEST(scaled_dot_product_attention_gpu, gemm_softmax_gemm_is_fused) {
+    auto& engine = get_test_engine();
+    const float scale = 0.35f;
+    auto inputs = make_inputs(engine, scale);
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, make_gemm_softmax_gemm(inputs, engine, scale), options);
+    network.set_input_data("query", inputs.query);
+    network.set_input_data("key", inputs.key);
+    network.set_input_data("value", inputs.value);
+
+    auto outputs = network.execute();
+    check_output(outputs.at("output").get_memory(), inputs.expected);
+
+    auto executed = network.get_executed_primitive_ids();
+    ASSERT_NE(std::find(executed.begin(), executed.end(), "sv_sdpa"), executed.end());
+    ASSERT_EQ(std::find(executed.begin(), executed.end(), "softmax"), executed.end());
+}
+
+TEST(scaled_dot_product_attention_gpu, gemm_softmax_gemm_is_not_fused_for_unsupported_shapes) {
+    auto& engine = get_test_engine();
+    const float scale = 0.05f;
+    // the head exceeds the private memory of the attention kernel
+    const std::vector<attention_dims> unsupported = {
+        { 1, 2, 3, 7, 264, 4 },
+    };
+
+    for (const auto& dims : unsupported) {
+        auto inputs = make_inputs(engine, scale, dims);
+
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        network network(engine, make_gemm_softmax_gemm(inputs, engine, scale), options);
+        network.set_input_data("query", inputs.query);
+        network.set_input_data("key", inputs.key);
+        network.set_input_data("value", inputs.value);
+
+        auto outputs = network.execute();
+        check_output(outputs.at("output").get_memory(), inputs.expected, dims);
+
+        auto executed = network.get_executed_primitive_ids();
+        ASSERT_EQ(std::find(executed.begin(), executed.end(), "sv_sdpa"), executed.end());
+        ASSERT_NE(std::find(executed.begin(), executed.end(), "softmax"), executed.end());
+    }
+}
@@ -149,4 +149,12 @@ DECLARE_VPU_CONFIG(MYRIAD_DEVICE_CONNECT_TIMEOUT);
 
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_ASYNC_DMA);
 
+/**
+ * @brief The number of the devices the compiled network is loaded onto, the infer requests are distributed between them.
+ * The network is compiled once and the same blob is allocated on each device.
+ * The devices are taken from the not busy ones, so fewer devices can be used if the others aren't available.
+ * Default value: 1
+ */
+DECLARE_VPU_CONFIG(MYRIAD_NUMBER_OF_DEVICES);
+
 }  // namespace InferenceEngine
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "vpu/private_plugin_config.hpp"
+#include "vpu/configuration/options/number_of_devices.hpp"
+#include "vpu/configuration/plugin_configuration.hpp"
+#include "vpu/utils/error.hpp"
+
+namespace vpu {
+
+void NumberOfDevicesOption::validate(const std::string& value) {
+    int intValue;
+    try {
+        intValue = std::stoi(value);
+    } catch (const std::exception& e) {
+        VPU_THROW_FORMAT(R"(unexpected {} option value "{}", must be a number)", key(), value);
+    }
+
+    VPU_THROW_UNSUPPORTED_OPTION_UNLESS(intValue >= 1,
+        R"(unexpected {} option value "{}", only positive numbers are supported)", key(), value);
+}
+
+void NumberOfDevicesOption::validate(const PluginConfiguration& configuration) {
+    validate(configuration[key()]);
+}
+
+std::string NumberOfDevicesOption::key() {
+    return InferenceEngine::MYRIAD_NUMBER_OF_DEVICES;
+}
+
+details::Access NumberOfDevicesOption::access() {
+    return details::Access::Private;
+}
+
+details::Category NumberOfDevicesOption::category() {
+    return details::Category::RunTime;
+}
+
+std::string NumberOfDevicesOption::defaultValue() {
+    return std::to_string(1);
+}
+
+NumberOfDevicesOption::value_type NumberOfDevicesOption::parse(const std::string& value) {
+    validate(value);
+    return std::stoi(value);
+}
+
+}  // namespace vpu
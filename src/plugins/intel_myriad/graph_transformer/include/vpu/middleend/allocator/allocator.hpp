@@ -27,6 +27,8 @@ struct UsedMemory final {
     int blob = 0;
     int input = 0;
     int output = 0;
+    // the intermediate data, which were placed in DDR instead of CMX or copied from CMX to DDR
+    int spilledCMX = 0;
 };
 
 void printTo(std::ostream& os, const UsedMemory& usedMemory);
@@ -95,6 +97,7 @@ public:
 
     DataSet& getCandidatesForCMX() { return _candidatesForCMX; }
     bool removeCMXCandidates(const Data& data);
+    const DataVector& getSpilledCMXCandidates() const { return _spilledCMXCandidates; }
 
     std::size_t freeCMXMemoryAmount() const;
 
@@ -139,6 +142,7 @@ private:
     bool _needToAllocNonIntermData = true;
 
     DataSet _candidatesForCMX;
+    DataVector _spilledCMXCandidates;
 };
 
 int calcAllocationSize(const Data& data);
@@ -160,7 +160,10 @@ public:
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
 private:
+    // the options are memoized by the convolution parameters, so the same convolutions in the network and in
+    // the networks compiled after it (e.g. after reshape) aren't searched again
     std::vector<TilingOption> selectBetterTiling() const;
+    std::vector<TilingOption> searchBetterTiling() const;
 
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
@@ -28,6 +28,7 @@ void printTo(std::ostream& os, const UsedMemory& usedMemory) {
     os << "blob=" << usedMemory.blob << std::endl;
     os << "input=" << usedMemory.input << std::endl;
     os << "output=" << usedMemory.output << std::endl;
+    os << "spilledCMX=" << usedMemory.spilledCMX << std::endl;
 
     os << "]";
 }
@@ -39,6 +40,7 @@ void printTo(DotLabel& lbl, const UsedMemory& usedMemory) {
     subLbl.appendPair("blob", usedMemory.blob);
     subLbl.appendPair("input", usedMemory.input);
     subLbl.appendPair("output", usedMemory.output);
+    subLbl.appendPair("spilledCMX", usedMemory.spilledCMX);
 }
 
 //
@@ -711,6 +713,22 @@ AllocationResult Allocator::preprocess(const Model& model) {
     return AllocationResult();
 }
 
+namespace {
+
+// The execution index of the last stage using the data or its child datas
+int lastConsumerIndex(const Data& data) {
+    int lastIndex = -1;
+    loopOverData(data, [&lastIndex](const Data& subData) {
+        for (const auto& consumer : subData->consumers()) {
+            lastIndex = std::max(lastIndex, consumer->index());
+        }
+        return DataLoopStatus::NextChild;
+    });
+    return lastIndex;
+}
+
+}  // namespace
+
 bool Allocator::removeCMXCandidates(const vpu::Data& data) {
     auto it = _candidatesForCMX.find(data);
 
@@ -734,29 +752,47 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
         });
 
         _candidatesForCMX.erase(it);
+        _spilledCMXCandidates.push_back(data);
 
         return true;
     } else {
-        auto cmxDatas = getAllocatedDatas(MemoryType::CMX);
+        //
+        // Move the candidate living the longest, it frees CMX for the most of the following stages,
+        // the larger one and then the name are compared to keep the allocation stable from run to run
+        //
 
-        for (const auto& cmxData : cmxDatas) {
+        Data spilledData;
+        int spilledLastUse = -1;
+
+        for (const auto& cmxData : getAllocatedDatas(MemoryType::CMX)) {
             IE_ASSERT(cmxData->parentDataToDataEdge() == nullptr);
 
-            it = _candidatesForCMX.find(cmxData);
+            if (_candidatesForCMX.count(cmxData) == 0) {
+                continue;
+            }
+
+            const auto lastUse = lastConsumerIndex(cmxData);
+            if (spilledData == nullptr || lastUse > spilledLastUse ||
+                (lastUse == spilledLastUse && (calcAllocationSize(cmxData) > calcAllocationSize(spilledData) ||
+                    (calcAllocationSize(cmxData) == calcAllocationSize(spilledData) &&
+                     cmxData->name() < spilledData->name())))) {
+                spilledData = cmxData;
+                spilledLastUse = lastUse;
+            }
+        }
 
-            if (it != _candidatesForCMX.end()) {
-                freeData(cmxData, DeallocationMode::MoveFromCMX);
+        if (spilledData != nullptr) {
+            freeData(spilledData, DeallocationMode::MoveFromCMX);
 
-                loopOverData(cmxData, [](const Data& subData) {
-                    subData->setMemReqs(MemoryType::DDR);
-                    return DataLoopStatus::NextChild;
-                });
+            loopOverData(spilledData, [](const Data& subData) {
+                subData->setMemReqs(MemoryType::DDR);
+                return DataLoopStatus::NextChild;
+            });
 
-                _candidatesForCMX.erase(it);
+            _candidatesForCMX.erase(spilledData);
+            _spilledCMXCandidates.push_back(spilledData);
 
-                // TODO: remove the first CMX candidate or remove all CMX candidates?
-                return true;
-            }
+            return true;
         }
     }
 
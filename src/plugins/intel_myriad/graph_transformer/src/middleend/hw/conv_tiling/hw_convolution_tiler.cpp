@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -619,6 +621,44 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
 std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
+    // The searched options depend only on the convolution parameters (not on the stage name) and the CMX resources
+    static std::map<std::vector<int>, std::vector<TilingOption>> cache;
+    static std::mutex cacheMutex;
+    constexpr size_t maxCacheSize = 4096;
+
+    const auto& env = CompileEnv::get();
+    std::vector<int> key = {
+        static_cast<int>(_dirTiling->getDirection()), static_cast<int>(_maxTilingOptions),
+        env.resources.tilingCMXLimit, env.resources.numCMXSlices,
+        _convolutionOptions._kernelSizeX, _convolutionOptions._kernelSizeY, _convolutionOptions._kernelStride,
+        _convolutionOptions._paddingLeft, _convolutionOptions._paddingRight,
+        _convolutionOptions._paddingTop, _convolutionOptions._paddingBottom,
+        static_cast<int>(_convolutionOptions._withPool)};
+    for (const auto& dims : {_convolutionOptions._inputDims, _convolutionOptions._outputDims,
+                             _convolutionOptions._origOutputDims}) {
+        const auto values = dims.toVector(-1);
+        key.insert(key.end(), values.begin(), values.end());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        const auto cached = cache.find(key);
+        if (cached != cache.end()) {
+            return cached->second;
+        }
+    }
+
+    auto tilingOptions = searchBetterTiling();
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (cache.size() >= maxCacheSize) {
+        cache.clear();
+    }
+    cache.emplace(std::move(key), tilingOptions);
+    return tilingOptions;
+}
+
+std::vector<TilingOption> HWConvolutionTilingSearcher::searchBetterTiling() const {
     const auto& env = CompileEnv::get();
 
     auto& dirTiling = *_dirTiling;
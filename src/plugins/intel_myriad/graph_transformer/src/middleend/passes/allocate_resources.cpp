@@ -278,7 +278,41 @@ void PassImpl::run(const Model& model) {
     // Allocation statistics
     //
 
-    model->attrs().set<UsedMemory>("usedMemory", allocator.usedMemoryAmount());
+    auto usedMemory = allocator.usedMemoryAmount();
+
+    //
+    // Report the intermediate data, which didn't stay in CMX, per producer stage
+    //
+
+    const auto& env = CompileEnv::get();
+
+    env.log->info("Data spilled from CMX to DDR");
+    VPU_LOGGER_SECTION(env.log);
+
+    const auto producerName = [](const Data& data) {
+        return data->producer() != nullptr ? data->producer()->name() : std::string("<none>");
+    };
+
+    for (const auto& data : allocator.getSpilledCMXCandidates()) {
+        const auto size = calcAllocationSize(data);
+        env.log->info("Stage [%s] output [%s] : %d bytes placed in DDR", producerName(data), data->name(), size);
+        usedMemory.spilledCMX += size;
+    }
+
+    for (const auto& stage : model->getStages()) {
+        if (!stage->attrs().getOrDefault<bool>("CMX-to-DDR", false)) {
+            continue;
+        }
+
+        const auto cmxData = stage->input(0);
+        const auto size = calcAllocationSize(cmxData);
+        env.log->info("Stage [%s] output [%s] : %d bytes copied to DDR", producerName(cmxData), cmxData->name(), size);
+        usedMemory.spilledCMX += size;
+    }
+
+    env.log->info("Total : %d bytes", usedMemory.spilledCMX);
+
+    model->attrs().set<UsedMemory>("usedMemory", usedMemory);
 }
 
 }  // namespace
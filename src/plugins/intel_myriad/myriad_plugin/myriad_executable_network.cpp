@@ -21,6 +21,7 @@
 #include <vpu/configuration/options/performance_hint.hpp>
 #include "vpu/configuration/options/performance_hint_num_requests.hpp"
 #include <vpu/configuration/options/ov_throughput_streams.hpp>
+#include <vpu/configuration/options/number_of_devices.hpp>
 #include <vpu/ngraph/operations/dynamic_shape_resolver.hpp>
 #include <vpu/ngraph/transformations/dynamic_to_static_shape.hpp>
 #include <ngraph/opsets/opset3.hpp>
@@ -73,6 +74,34 @@ void ExecutableNetwork::openDevice(std::vector<DevicePtr>& devicePool) {
     _actualNumExecutors = executors ? executors : DefaultAllocation::numStreams(_config);
 }
 
+void ExecutableNetwork::allocateGraphs(std::vector<DevicePtr>& devicePool,
+                                       const std::pair<const char*, size_t>& blobHeader,
+                                       size_t numStages,
+                                       const std::string& networkName) {
+    openDevice(devicePool);
+    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors, _config);
+
+    // The same blob is loaded onto the other devices, so the network isn't compiled once per device as with MULTI
+    const auto numDevices = _config.get<NumberOfDevicesOption>();
+    while (_device->isBooted() && static_cast<int>(_extraDevices.size()) + 1 < numDevices) {
+        auto device = _executor->openDevice(devicePool, _config);
+        const auto isOpened = device == _device ||
+            std::find(_extraDevices.begin(), _extraDevices.end(), device) != _extraDevices.end();
+        if (isOpened || !device->isBooted()) {
+            if (isOpened) {
+                device->_graphNum--;
+            }
+            _log->warning("Only %d of %d devices are available for the network", _extraDevices.size() + 1, numDevices);
+            break;
+        }
+
+        _extraGraphDescs.emplace_back();
+        _executor->allocateGraph(device, _extraGraphDescs.back(), _graphBlob, blobHeader, numStages, networkName,
+                                 _actualNumExecutors, _config);
+        _extraDevices.push_back(device);
+    }
+}
+
 ExecutableNetwork::ExecutableNetwork(
         const ie::CNNNetwork& network,
         std::shared_ptr<IMvnc> mvnc,
@@ -154,9 +183,7 @@ ExecutableNetwork::ExecutableNetwork(
         }
         return;
     }
-    openDevice(devicePool);
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages,
-                             networkName, _actualNumExecutors, _config);
+    allocateGraphs(devicePool, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName);
 }
 
 void ExecutableNetwork::Import(std::istream& strm, std::vector<DevicePtr> &devicePool, const PluginConfiguration& configuration) {
@@ -188,8 +215,7 @@ void ExecutableNetwork::Import(std::istream& strm, std::vector<DevicePtr> &devic
     std::size_t numStages = blobReader.getStageCount();
     auto blobHeader = blobReader.getHeader();
 
-    openDevice(devicePool);
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors, _config);
+    allocateGraphs(devicePool, blobHeader, numStages, networkName);
     _graphMetaData.stagesMeta.resize(numStages);
     for (auto &meta : _graphMetaData.stagesMeta) {
         meta.stageName = meta.stageType = meta.layerName = meta.layerType = "UNKNOWN";
@@ -237,7 +263,8 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string &name)
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>());
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        unsigned int optimalNumOfInferRequests = static_cast<unsigned int>(2u * _actualNumExecutors);
+        unsigned int optimalNumOfInferRequests =
+                static_cast<unsigned int>(2u * _actualNumExecutors * (_extraDevices.size() + 1));
 
         if (!_config.get<PerformanceHintOption>().empty()) {
             optimalNumOfInferRequests =
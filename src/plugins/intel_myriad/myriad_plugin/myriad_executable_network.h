@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -46,6 +47,9 @@ public:
             if (_device != nullptr) {
                 _executor->deallocateGraph(_device, _graphDesc);
             }
+            for (size_t i = 0; i < _extraDevices.size(); i++) {
+                _executor->deallocateGraph(_extraDevices[i], _extraGraphDescs[i]);
+            }
         }
         catch (...) {
             std::cerr << "ERROR ~ExecutableNetwork():\n"
@@ -59,7 +63,7 @@ public:
             IE_THROW() << "Can not create infer request: there is no available devices with platform ";
         }
 
-        return std::make_shared<MyriadInferRequest>(_graphDesc, networkInputs, networkOutputs,
+        return std::make_shared<MyriadInferRequest>(getNextGraphDesc(), networkInputs, networkOutputs,
                                                     _inputInfo, _outputInfo,
                                                     _graphMetaData.stagesMeta, _config, _log, _executor,
                                                     _constDatas, _isNetworkConstant);
@@ -70,16 +74,17 @@ public:
             IE_THROW() << "Can not create infer request: there is no available devices with platform ";
         }
         std::shared_ptr<MyriadInferRequest> syncRequestImpl;
+        auto& graphDesc = getNextGraphDesc();
         if (this->_plugin) {
             const auto& core = _plugin->GetCore();
             if (core && core->isNewAPI())
-                syncRequestImpl = std::make_shared<MyriadInferRequest>(_graphDesc, _parameters, _results,
+                syncRequestImpl = std::make_shared<MyriadInferRequest>(graphDesc, _parameters, _results,
                                                                        _inputInfo, _outputInfo,
                                                                        _graphMetaData.stagesMeta, _config, _log,
                                                                        _executor, _constDatas, _isNetworkConstant);
         }
         if (!syncRequestImpl)
-            syncRequestImpl = std::make_shared<MyriadInferRequest>(_graphDesc, _networkInputs, _networkOutputs,
+            syncRequestImpl = std::make_shared<MyriadInferRequest>(graphDesc, _networkInputs, _networkOutputs,
                                                                    _inputInfo, _outputInfo,
                                                                    _graphMetaData.stagesMeta, _config, _log,
                                                                    _executor, _constDatas, _isNetworkConstant);
@@ -116,6 +121,10 @@ private:
     std::vector<char> _graphBlob;
     GraphDesc _graphDesc;
     DevicePtr _device;
+    // The devices the same blob is loaded onto in addition to _device, see MYRIAD_NUMBER_OF_DEVICES
+    std::vector<DevicePtr> _extraDevices;
+    std::vector<GraphDesc> _extraGraphDescs;
+    std::atomic<size_t> _nextGraphIdx{0};
     GraphMetaInfo _graphMetaData;
     PluginConfiguration _config;
     bool _isNetworkConstant = false;
@@ -145,7 +154,15 @@ private:
         return taskExecutor;
     }
 
+    // The infer requests are distributed between the devices in turn, each graph has its own FIFOs
+    GraphDesc& getNextGraphDesc() {
+        const auto idx = _nextGraphIdx++ % (_extraGraphDescs.size() + 1);
+        return idx == 0 ? _graphDesc : _extraGraphDescs[idx - 1];
+    }
+
     void openDevice(std::vector<DevicePtr>& devicePool);
+    void allocateGraphs(std::vector<DevicePtr>& devicePool, const std::pair<const char*, size_t>& blobHeader,
+                        size_t numStages, const std::string& networkName);
 };
 
 }  // namespace MyriadPlugin
@@ -224,8 +224,8 @@ void MyriadInferRequest::InferAsync() {
     // execute input pre-processing
     execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
 
-    auto inputInfo = _inputInfo;
-    auto networkInputs = _networkInputs;
+    const auto& inputInfo = _inputInfo;
+    const auto& networkInputs = _networkInputs;
 
     auto getOffset = [&inputInfo] (const std::string& name) {
         const auto offsetIt = inputInfo.offset.find(name);
@@ -241,6 +241,22 @@ void MyriadInferRequest::InferAsync() {
         return foundBlob;
     };
 
+    // For networks with only one input the blob is written to the device as is, without the copy to inputBuffer.
+    // All the inputs are sent with one FIFO write, the input FIFO keeps several elements, so the input of the next
+    // request is transferred while the device computes the previous one
+    if (_inputs.size() == 1 && inputInfo.offset.size() == 1) {
+        const auto& name = _inputs.begin()->first;
+        const auto& blob = _inputs.begin()->second;
+        const auto& tensorDesc = blob->getTensorDesc();
+
+        if (getOffset(name) == 0 && blob->byteSize() == static_cast<size_t>(inputInfo.totalSize) &&
+            tensorDesc.getLayout() == getNetInputInfo(name)->second->getTensorDesc().getLayout() &&
+            !needsTypeConvert(tensorDesc.getPrecision())) {
+            _executor->queueInference(_graphDesc, blob->buffer(), _inputInfo.totalSize, nullptr, 0);
+            return;
+        }
+    }
+
     for (const auto& input : _inputs) {
         const auto& name = input.first;
         const auto& blob = input.second;
@@ -65,6 +65,7 @@
 #include <vpu/configuration/options/enable_custom_reshape_param.hpp>
 #include <vpu/configuration/options/none_layers.hpp>
 #include <vpu/configuration/options/enable_async_dma.hpp>
+#include <vpu/configuration/options/number_of_devices.hpp>
 #include <vpu/configuration/options/enable_mx_boot.hpp>
 #include "vpu/configuration/options/performance_hint.hpp"
 #include "vpu/configuration/options/performance_hint_num_requests.hpp"
@@ -247,6 +248,7 @@ Engine::Engine(std::shared_ptr<IMvnc> mvnc) :
     _parsedConfig.registerOption<EnableCustomReshapeParamOption>();
     _parsedConfig.registerOption<NoneLayersOption>();
     _parsedConfig.registerOption<EnableAsyncDMAOption>();
+    _parsedConfig.registerOption<NumberOfDevicesOption>();
     _parsedConfig.registerOption<EnableMXBootOption>();
     _parsedConfig.registerOption<PerformanceHintOption>();
     _parsedConfig.registerOption<PerformanceHintNumRequestsOption>();
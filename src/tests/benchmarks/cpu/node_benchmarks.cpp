@@ -0,0 +1,290 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// The microbenchmarks of the CPU plugin nodes: each benchmark compiles the model of a single operation (or of a chain
+// of the eltwise ones, which the plugin fuses or tokenizes to a snippets subgraph) and measures its inference.
+// The benchmarks are named "<case>/<input shape>/<precision>/threads:<count>", the label lists the types and the
+// implementations of the nodes the plugin has created, e.g. "Convolution:jit_avx512_FP32".
+//
+// The standard google-benchmark flags are supported, e.g. --benchmark_filter, --benchmark_format=json and
+// --benchmark_out=<file> for the machine-readable results. The own flags of the suite are:
+//     --cpu_threads=<n>[,<n>...]   the inference thread counts, the default is 1 and all the cores
+// The instruction set is limited with the ONEDNN_MAX_CPU_ISA environment variable, e.g. ONEDNN_MAX_CPU_ISA=AVX2.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+using NodeBuilder = std::function<std::shared_ptr<ov::Node>(const ov::Output<ov::Node>&)>;
+
+struct NodeCase {
+    std::string name;
+    std::vector<ov::Shape> shapes;
+    NodeBuilder make;
+};
+
+std::shared_ptr<ov::Node> makeConstant(const ov::Shape& shape, float low = -1.f, float high = 1.f) {
+    // the fixed seed makes the weights, and so the data dependent kernels timings, the same in all the runs
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::vector<float> values(ov::shape_size(shape));
+    std::generate(values.begin(), values.end(), [&] {
+        return distribution(generator);
+    });
+    return ov::opset8::Constant::create(ov::element::f32, shape, values);
+}
+
+std::shared_ptr<ov::Node> makeIndices(const ov::Shape& shape, int64_t upperBound) {
+    std::vector<int64_t> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<int64_t>((i * 7919) % upperBound);
+    return ov::opset8::Constant::create(ov::element::i64, shape, values);
+}
+
+std::vector<NodeCase> getNodeCases() {
+    using namespace ov::opset8;
+    std::vector<NodeCase> cases;
+
+    cases.push_back({"Convolution", {{1, 64, 56, 56}, {1, 256, 14, 14}}, [](const ov::Output<ov::Node>& in) {
+                         const auto channels = in.get_shape()[1];
+                         return std::make_shared<Convolution>(in,
+                                                              makeConstant({channels, channels, 3, 3}),
+                                                              ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+                     }});
+
+    cases.push_back({"FullyConnected", {{1, 1024}, {128, 768}}, [](const ov::Output<ov::Node>& in) {
+                         const auto inputSize = in.get_shape().back();
+                         return std::make_shared<MatMul>(in, makeConstant({inputSize * 4, inputSize}), false, true);
+                     }});
+
+    // the eltwise nodes are fused into one
+    cases.push_back({"EltwiseChain", {{1, 64, 56, 56}, {1, 3, 224, 224}}, [](const ov::Output<ov::Node>& in) {
+                         const auto channels = in.get_shape()[1];
+                         auto add = std::make_shared<Add>(in, makeConstant({1, channels, 1, 1}));
+                         auto multiply = std::make_shared<Multiply>(add, makeConstant({1, channels, 1, 1}));
+                         return std::make_shared<Relu>(multiply);
+                     }});
+
+    // the longer chain with the transcendental functions is tokenized to the snippets subgraph
+    cases.push_back({"SnippetsSubgraph", {{1, 64, 56, 56}, {1, 128, 28, 28}}, [](const ov::Output<ov::Node>& in) {
+                         auto sigmoid = std::make_shared<Sigmoid>(in);
+                         auto multiply = std::make_shared<Multiply>(in, sigmoid);
+                         auto subtract = std::make_shared<Subtract>(multiply, makeConstant({1}));
+                         auto power = std::make_shared<Power>(subtract, Constant::create(ov::element::f32, {1}, {2.f}));
+                         return std::make_shared<Clamp>(power, 0., 6.);
+                     }});
+
+    cases.push_back({"Gather", {{30522, 768}, {1, 64, 56, 56}}, [](const ov::Output<ov::Node>& in) {
+                         const auto rows = static_cast<int64_t>(in.get_shape()[0] > 1 ? in.get_shape()[0]
+                                                                                      : in.get_shape()[1]);
+                         const int64_t axis = in.get_shape()[0] > 1 ? 0 : 1;
+                         return std::make_shared<Gather>(in,
+                                                         makeIndices({1, 128}, rows),
+                                                         Constant::create(ov::element::i64, {}, {axis}));
+                     }});
+
+    cases.push_back({"ReduceMean", {{1, 256, 56, 56}, {32, 1024, 7, 7}}, [](const ov::Output<ov::Node>& in) {
+                         return std::make_shared<ReduceMean>(in,
+                                                             Constant::create(ov::element::i64, {2}, {2, 3}),
+                                                             true);
+                     }});
+
+    cases.push_back({"ReduceSum", {{32, 1024}, {1, 12, 128, 128}}, [](const ov::Output<ov::Node>& in) {
+                         return std::make_shared<ReduceSum>(in, Constant::create(ov::element::i64, {1}, {-1}), false);
+                     }});
+
+    cases.push_back({"TopK", {{1, 1000}, {1, 80, 8400}}, [](const ov::Output<ov::Node>& in) {
+                         return std::make_shared<TopK>(in,
+                                                       Constant::create(ov::element::i64, {}, {10}),
+                                                       -1,
+                                                       TopK::Mode::MAX,
+                                                       TopK::SortType::SORT_VALUES);
+                     }});
+
+    auto makeInterpolate = [](Interpolate::InterpolateMode mode) {
+        return [mode](const ov::Output<ov::Node>& in) {
+            Interpolate::InterpolateAttrs attrs;
+            attrs.mode = mode;
+            attrs.shape_calculation_mode = Interpolate::ShapeCalcMode::SIZES;
+            const auto& shape = in.get_shape();
+            const std::vector<int64_t> outputSize{static_cast<int64_t>(shape[2] * 2),
+                                                  static_cast<int64_t>(shape[3] * 2)};
+            const auto sizes = Constant::create(ov::element::i64, {2}, outputSize);
+            return std::make_shared<Interpolate>(in,
+                                                 sizes,
+                                                 Constant::create(ov::element::f32, {2}, {2.f, 2.f}),
+                                                 Constant::create(ov::element::i64, {2}, {2, 3}),
+                                                 attrs);
+        };
+    };
+    cases.push_back({"InterpolateLinear", {{1, 64, 56, 56}}, makeInterpolate(Interpolate::InterpolateMode::LINEAR)});
+    cases.push_back({"InterpolateNearest", {{1, 64, 56, 56}}, makeInterpolate(Interpolate::InterpolateMode::NEAREST)});
+
+    cases.push_back({"Softmax", {{1, 12, 128, 128}, {32, 1000}}, [](const ov::Output<ov::Node>& in) {
+                         return std::make_shared<Softmax>(in, -1);
+                     }});
+
+    cases.push_back({"Transpose", {{1, 64, 56, 56}, {1, 128, 12, 64}}, [](const ov::Output<ov::Node>& in) {
+                         return std::make_shared<Transpose>(in, Constant::create(ov::element::i64, {4}, {0, 2, 1, 3}));
+                     }});
+
+    return cases;
+}
+
+std::string toString(const ov::Shape& shape) {
+    std::ostringstream out;
+    for (size_t i = 0; i < shape.size(); i++)
+        out << (i ? "x" : "") << shape[i];
+    return out.str();
+}
+
+// lists the nodes of the compiled model except the inputs, outputs and constants, e.g. "Convolution:jit_avx2_FP32"
+std::string getImplementations(const ov::CompiledModel& compiledModel) {
+    std::string implementations;
+    for (const auto& op : compiledModel.get_runtime_model()->get_ordered_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        const auto layerType = rtInfo.find("layerType");
+        const auto primitiveType = rtInfo.find("primitiveType");
+        if (layerType == rtInfo.end() || primitiveType == rtInfo.end())
+            continue;
+        const auto type = layerType->second.as<std::string>();
+        if (type == "Input" || type == "Output" || type == "Const")
+            continue;
+        implementations += (implementations.empty() ? "" : ",") + type + ":" + primitiveType->second.as<std::string>();
+    }
+    return implementations;
+}
+
+class NodeBenchmark {
+public:
+    NodeBenchmark(ov::Core& core,
+                  const NodeCase& nodeCase,
+                  const ov::Shape& shape,
+                  ov::element::Type precision,
+                  int threads)
+        : _core(core),
+          _nodeCase(nodeCase),
+          _shape(shape),
+          _precision(precision),
+          _threads(threads) {}
+
+    void run(benchmark::State& state) {
+        // google-benchmark calls the function several times to find the iterations count, the model is compiled once
+        if (!_request) {
+            auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, _shape);
+            auto model = std::make_shared<ov::Model>(_nodeCase.make(input)->outputs(), ov::ParameterVector{input});
+            auto compiledModel = _core.compile_model(model,
+                                                     "CPU",
+                                                     ov::streams::num(1),
+                                                     ov::inference_num_threads(_threads),
+                                                     ov::hint::inference_precision(_precision));
+            _label = getImplementations(compiledModel);
+            _request = std::make_shared<ov::InferRequest>(compiledModel.create_infer_request());
+
+            auto tensor = _request->get_input_tensor();
+            std::mt19937 generator(7);
+            std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+            auto data = tensor.data<float>();
+            for (size_t i = 0; i < tensor.get_size(); i++)
+                data[i] = distribution(generator);
+            // the first inference creates the primitives of the dynamic nodes and warms the caches up
+            _request->infer();
+        }
+
+        for (auto _ : state) {
+            _request->infer();
+        }
+
+        state.SetLabel(_label);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ov::shape_size(_shape) * sizeof(float)));
+        state.counters["threads"] = _threads;
+    }
+
+private:
+    ov::Core& _core;
+    const NodeCase& _nodeCase;
+    const ov::Shape _shape;
+    const ov::element::Type _precision;
+    const int _threads;
+    std::shared_ptr<ov::InferRequest> _request;
+    std::string _label;
+};
+
+// removes the own flags of the suite, so google-benchmark doesn't reject them
+std::vector<int> parseThreads(int& argc, char** argv) {
+    std::vector<int> threads;
+    const std::string flag = "--cpu_threads=";
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], flag.c_str(), flag.size()) == 0) {
+            std::istringstream values(argv[i] + flag.size());
+            std::string value;
+            while (std::getline(values, value, ','))
+                threads.push_back(std::max(1, std::stoi(value)));
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+
+    if (threads.empty()) {
+        threads = {1, static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))};
+        threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+    }
+    return threads;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto threads = parseThreads(argc, argv);
+
+    ov::Core core;
+    std::vector<ov::element::Type> precisions{ov::element::f32};
+    const auto capabilities = core.get_property("CPU", ov::device::capabilities);
+    if (std::find(capabilities.begin(), capabilities.end(), ov::device::capability::BF16) != capabilities.end())
+        precisions.push_back(ov::element::bf16);
+
+    const auto nodeCases = getNodeCases();
+    std::vector<std::unique_ptr<NodeBenchmark>> benchmarks;
+    for (const auto& nodeCase : nodeCases) {
+        for (const auto& shape : nodeCase.shapes) {
+            for (const auto& precision : precisions) {
+                for (const auto threadsCount : threads) {
+                    benchmarks.emplace_back(new NodeBenchmark(core, nodeCase, shape, precision, threadsCount));
+                    auto benchmark = benchmarks.back().get();
+                    const auto name = nodeCase.name + "/" + toString(shape) + "/" + precision.get_type_name() +
+                                      "/threads:" + std::to_string(threadsCount);
+                    benchmark::RegisterBenchmark(name.c_str(), [benchmark](benchmark::State& state) {
+                        benchmark->run(state);
+                    })->Unit(benchmark::kMicrosecond)->UseRealTime();
+                }
+            }
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -49,6 +49,7 @@ InferenceEngine::Blob::Ptr createBlob(InferenceEngine::Precision precision, Size
         case  InferenceEngine::Precision::FP64:
              return make_shared_blob<double>(tensorDesc);
         case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::BF16:
         case InferenceEngine::Precision::I16:
         case InferenceEngine::Precision::Q78:
             return make_shared_blob<int16_t>(tensorDesc);
@@ -123,6 +124,7 @@ void FillBlob(Blob::Ptr& inputBlob) {
         case  InferenceEngine::Precision::FP64:
             return FillBlobRandom<double>(inputBlob);
         case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::BF16:
         case InferenceEngine::Precision::I16:
         case InferenceEngine::Precision::Q78:
             return FillBlobRandom<int16_t>(inputBlob);
@@ -215,6 +217,7 @@ bool IsCorrectBlobCopy(Blob::Ptr& srcBlob, Blob::Ptr& dstBlob) {
         case  InferenceEngine::Precision::FP64:
             return IsCorrectBlobCopy_Impl<double>(srcBlob, dstBlob);
         case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::BF16:
         case InferenceEngine::Precision::I16:
         case InferenceEngine::Precision::Q78:
             return IsCorrectBlobCopy_Impl<int16_t>(srcBlob, dstBlob);
@@ -294,7 +297,7 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
 };
 
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        1, 3, 7, 17,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
@@ -304,12 +307,13 @@ std::vector<Dims> BlobCopy_Dims = {
 
 //  The 'blob_copy(4/5)_d' function is a template with the parameter-list  <InferenceEngine::Precision::ePrecision PRC>
 //  FP32 is used for cases with the following accuracy:  FP32, I32, U32
-//  FP16 is used for cases with the following accuracy:  FP16, U16, I16
+//  FP16 is used for cases with the following accuracy:  FP16, BF16, U16, I16
 //  U8 is used for cases with the following accuracy:  U8, I8
 //  Cases with other precision are not supported
 std::vector<PrecisionType> BlobCopy_PrecisionParams = {
         InferenceEngine::Precision::FP32,
         InferenceEngine::Precision::FP16,
+        InferenceEngine::Precision::BF16,
         InferenceEngine::Precision::U8,
         InferenceEngine::Precision::I8,
         InferenceEngine::Precision::U16,
@@ -346,6 +350,7 @@ bool IsEqualBlobCopy(Blob::Ptr& srcBlob, Blob::Ptr& dstBlob) {
     case InferenceEngine::Precision::FP64:
         return IsEqualBlobCopy_Impl<double>(srcBlob, dstBlob);
     case InferenceEngine::Precision::FP16:
+    case InferenceEngine::Precision::BF16:
     case InferenceEngine::Precision::I16:
     case InferenceEngine::Precision::Q78:
         return IsEqualBlobCopy_Impl<int16_t>(srcBlob, dstBlob);
@@ -399,6 +404,7 @@ void copy3DBlobsAllBytesWithReLayoutWrapper(const Blob::Ptr& srcLayoutBlob, Blob
     case InferenceEngine::Precision::FP64:
         return copy3DBlobsAllBytesWithReLayout<double>(srcLayoutBlob, trgLayoutBlob);
     case InferenceEngine::Precision::FP16:
+    case InferenceEngine::Precision::BF16:
     case InferenceEngine::Precision::I16:
     case InferenceEngine::Precision::Q78:
         return copy3DBlobsAllBytesWithReLayout<int16_t>(srcLayoutBlob, trgLayoutBlob);
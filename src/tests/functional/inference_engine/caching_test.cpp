@@ -9,10 +9,12 @@
 #include <chrono>
 #include <mutex>
 #include <functional>
+#include <future>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "ie_core.hpp"
+#include "openvino/runtime/core.hpp"
 #include "ngraph/function.hpp"
 #include "ie_metric_helpers.hpp"
 #include "openvino/op/logical_not.hpp"
@@ -1658,6 +1660,40 @@ TEST_P(CachingTest, Load_threads) {
     std::cout << "Caching Load multiple threads test completed. Tried " << index << " times" << std::endl;
 }
 
+TEST_P(CachingTest, CompileModelAsync) {
+    const auto MODELS_COUNT = 4;
+    EXPECT_CALL(*mockPlugin, GetMetric(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, QueryNetwork(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    if (m_remoteContext || m_type != TestLoadType::EModelName) {
+        return; // the asynchronous compilation reads the model by name itself
+    }
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        EXPECT_CALL(net, Export(_)).Times(1);
+    });
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(1);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(MODELS_COUNT - 1);
+    {
+        ov::Core core;
+        injectProxyEngine(mockPlugin.get());
+        core.register_plugin(std::string("mock_engine") + IE_BUILD_POSTFIX, deviceName);
+        core.set_property(ov::cache_dir(m_cacheDir));
+        // the first compiled model is exported while the others wait for the cache entry and import it
+        std::vector<std::future<ov::CompiledModel>> futures;
+        for (int i = 0; i < MODELS_COUNT; i++) {
+            futures.push_back(core.compile_model_async(modelName, deviceToLoad));
+        }
+        for (auto& future : futures) {
+            ASSERT_NO_THROW(future.get());
+        }
+        auto failed = core.compile_model_async("not_existing_model.xml", deviceToLoad);
+        ASSERT_THROW(failed.get(), ov::Exception);
+        core.unload_plugin(deviceName);
+    }
+}
+
 // MULTI-DEVICE test
 // Test loading of devices with different architectures
 // In case of sporadic failures - increase 'TEST_DEVICE_MAX_COUNT' 100x times for better reproducibility
@@ -39,6 +39,7 @@
 #include "ie_precision.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cnn_network_ngraph_impl.hpp"
+#include "ie_ngraph_utils.hpp"
 
 using namespace testing;
 using namespace InferenceEngine;
@@ -118,6 +119,56 @@ TEST(CNNNGraphImplTests, TestNMS5OutputNames) {
     ASSERT_EQ(outputs_info.count("nms.2"), 1);
 }
 
+namespace {
+std::shared_ptr<ngraph::Function> makeNMS5Function(const ngraph::PartialShape& boxesShape, const ngraph::PartialShape& scoresShape) {
+    auto boxes = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, boxesShape);
+    auto scores = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, scoresShape);
+    boxes->set_friendly_name("boxes");
+    scores->set_friendly_name("scores");
+    auto max_output_boxes_per_class = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {10});
+    auto iou_threshold = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.75});
+    auto score_threshold = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.7});
+    auto nms = std::make_shared<ngraph::opset5::NonMaxSuppression>(boxes, scores, max_output_boxes_per_class,  iou_threshold, score_threshold,
+                                                           ngraph::opset5::NonMaxSuppression::BoxEncodingType::CORNER, true);
+    nms->set_friendly_name("nms");
+    return std::make_shared<ngraph::Function>(ngraph::OutputVector{nms->output(0), nms->output(1), nms->output(2)}, ngraph::ParameterVector{boxes, scores});
+}
+}  // namespace
+
+TEST(CNNNGraphImplTests, TestNMS5DynamicOutputsWithNewAPI) {
+    auto f = makeNMS5Function(ngraph::PartialShape{1, -1, 4}, ngraph::PartialShape{1, 1, -1});
+
+    // the outputs of the dynamic inputs aren't resolved with the legacy NMS, so they stay dynamic in the network and its clones
+    InferenceEngine::CNNNetwork cnnNet(std::make_shared<InferenceEngine::details::CNNNetworkNGraphImpl>(
+        f, std::vector<InferenceEngine::IExtensionPtr>{}, true));
+    auto cloned = InferenceEngine::details::cloneNetwork(cnnNet);
+    ASSERT_NO_THROW(cloned.reshape(std::map<std::string, ngraph::PartialShape>{{"boxes", ngraph::PartialShape{1, -1, 4}}, {"scores", ngraph::PartialShape{1, 1, -1}}}));
+    for (const auto& net : {cnnNet, cloned}) {
+        auto outputs_info = net.getOutputsInfo();
+        ASSERT_EQ(outputs_info.size(), 3);
+        EXPECT_TRUE(outputs_info.at("nms.0")->isDynamic());
+        EXPECT_EQ(InferenceEngine::Precision::I64, outputs_info.at("nms.0")->getPrecision());
+        EXPECT_EQ(InferenceEngine::Precision::FP32, outputs_info.at("nms.1")->getPrecision());
+    }
+}
+
+TEST(CNNNGraphImplTests, TestNMS5StaticInputsKeepStaticOutputsWithNewAPI) {
+    auto f = makeNMS5Function(ngraph::Shape{1, 1000, 4}, ngraph::Shape{1, 1, 1000});
+
+    // the plugins allocating the output blobs by the network dims get the static outputs of the legacy NMS
+    InferenceEngine::CNNNetwork cnnNet(std::make_shared<InferenceEngine::details::CNNNetworkNGraphImpl>(
+        f, std::vector<InferenceEngine::IExtensionPtr>{}, true));
+    auto cloned = InferenceEngine::details::cloneNetwork(cnnNet);
+    ASSERT_NO_THROW(cloned.reshape({{"boxes", SizeVector{1, 500, 4}}, {"scores", SizeVector{1, 1, 500}}}));
+    for (const auto& net : {cnnNet, cloned}) {
+        auto outputs_info = net.getOutputsInfo();
+        ASSERT_EQ(outputs_info.size(), 3);
+        ASSERT_FALSE(outputs_info.at("nms.0")->isDynamic());
+        // up to max_output_boxes_per_class boxes of the single batch and class
+        EXPECT_EQ((SizeVector{10, 3}), outputs_info.at("nms.0")->getTensorDesc().getDims());
+    }
+}
+
 IE_SUPPRESS_DEPRECATED_START
 
 TEST(CNNNGraphImplTests, TestConvertWithRemoveLastLayerNetwork) {
@@ -5,6 +5,7 @@
 #include <ie_core.hpp>
 #include <ie_plugin_config.hpp>
 #include <ie_extension.h>
+#include <openvino/runtime/properties.hpp>
 
 #include <file_utils.h>
 #include <ngraph_functions/subgraph_builders.hpp>
@@ -87,6 +88,32 @@ TEST_F(CoreThreadingTests, RegisterPlugin) {
     }, 4000);
 }
 
+// tested function: GetVersions of the different plugins loaded at once
+TEST_F(CoreThreadingTests, LoadDifferentPlugins) {
+    InferenceEngine::Core ie;
+    std::vector<std::string> deviceNames;
+    for (int i = 0; i < 8; ++i) {
+        deviceNames.push_back("MOCK" + std::to_string(i));
+        ie.RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, deviceNames.back());
+    }
+    std::atomic<unsigned int> index{0};
+    runParallel([&] () {
+        ie.GetVersions(deviceNames[index++ % deviceNames.size()]);
+    }, 10);
+    for (auto&& deviceName : deviceNames) {
+        ie.UnregisterPlugin(deviceName);
+    }
+}
+
+// tested function: GetAvailableDevices with the device allow list
+TEST_F(CoreThreadingTests, GetAvailableDevicesAllowList) {
+    InferenceEngine::Core ie;
+    ie.SetConfig({{ov::device::allow_list.name(), "NOT_REGISTERED_DEVICE"}});
+    runParallel([&] () {
+        ASSERT_TRUE(ie.GetAvailableDevices().empty());
+    }, 10);
+}
+
 // TODO: CVS-68982
 #ifndef OPENVINO_STATIC_LIBRARY
 
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common_test_utils/file_utils.hpp>
+#include <fstream>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "openvino/frontend/manager.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+
+class CompactIRSerializationTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_cir_path = test_name + ".cir";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(m_out_xml_path, m_out_bin_path);
+        std::remove(m_out_cir_path.c_str());
+    }
+
+    std::shared_ptr<ov::Model> getWithIRFrontend(const std::string& model_path) {
+        ov::AnyVector params{model_path};
+        auto FE = manager.load_by_model(params);
+        if (!FE)
+            return nullptr;
+        return FE->convert(FE->load(params));
+    }
+
+    static std::shared_ptr<ov::Model> create_model() {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 3, 16, 16});
+        data->set_friendly_name("data & <input>");
+        auto weights =
+            ov::opset8::Constant::create(ov::element::f32, {8, 3, 3, 3}, std::vector<float>(8 * 3 * 3 * 3, 0.5f));
+        auto conv = std::make_shared<ov::opset8::Convolution>(data,
+                                                              weights,
+                                                              ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+        auto relu = std::make_shared<ov::opset8::Relu>(conv);
+        auto result = std::make_shared<ov::opset8::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data}, "\"compact\" model");
+    }
+
+private:
+    ov::frontend::FrontEndManager manager;
+};
+
+TEST_F(CompactIRSerializationTest, ReadsTheSameModelAsXml) {
+    auto model = create_model();
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::CompactSerialize>(m_out_cir_path);
+    m.run_passes(model);
+
+    auto compact = getWithIRFrontend(m_out_cir_path);
+    ASSERT_NE(nullptr, compact);
+
+    const auto res = FunctionsComparator::with_default()
+                         .enable(FunctionsComparator::CONST_VALUES)
+                         .enable(FunctionsComparator::NAMES)
+                         .compare(compact, model);
+    EXPECT_TRUE(res.valid) << res.message;
+    EXPECT_EQ(compact->get_friendly_name(), model->get_friendly_name());
+}
+
+TEST_F(CompactIRSerializationTest, TopologyIsSmallerThanXml) {
+    auto model = create_model();
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::Serialize>(m_out_xml_path, m_out_bin_path);
+    m.register_pass<ov::pass::CompactSerialize>(m_out_cir_path, m_out_bin_path);
+    m.run_passes(model);
+
+    std::ifstream xml(m_out_xml_path, std::ios::binary | std::ios::ate);
+    std::ifstream cir(m_out_cir_path, std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(xml && cir);
+    EXPECT_LT(cir.tellg(), xml.tellg());
+}
+
+TEST_F(CompactIRSerializationTest, TruncatedTopologyThrows) {
+    auto model = create_model();
+    std::stringstream cir, bin;
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::CompactSerialize>(cir, bin);
+    m.run_passes(model);
+
+    const auto data = cir.str();
+    std::ofstream(m_out_cir_path, std::ios::binary).write(data.data(), data.size() / 2);
+    std::ofstream(m_out_bin_path, std::ios::binary) << bin.str();
+    EXPECT_ANY_THROW(getWithIRFrontend(m_out_cir_path));
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "openvino/runtime/core.hpp"
+
+namespace {
+// Parameter -> num_layers ReLU layers -> Result
+std::string make_relu_chain(size_t num_layers) {
+    const std::string port = R"V0G0N(<dim>1</dim><dim>8</dim>)V0G0N";
+    std::ostringstream layers, edges;
+    layers << R"V0G0N(<layer name="in" type="Parameter" id="0" version="opset1">)V0G0N"
+           << R"V0G0N(<data element_type="f32" shape="1,8"/>)V0G0N"
+           << R"V0G0N(<output><port id="0" precision="FP32">)V0G0N" << port << "</port></output></layer>";
+    for (size_t id = 1; id <= num_layers; ++id) {
+        layers << "<layer name=\"relu" << id << "\" type=\"ReLU\" id=\"" << id << "\" version=\"opset1\">"
+               << "<input><port id=\"0\">" << port << "</port></input>"
+               << "<output><port id=\"1\" precision=\"FP32\">" << port << "</port></output></layer>";
+        edges << "<edge from-layer=\"" << id - 1 << "\" from-port=\"" << (id == 1 ? 0 : 1) << "\" to-layer=\"" << id
+              << "\" to-port=\"0\"/>";
+    }
+    layers << "<layer name=\"out\" type=\"Result\" id=\"" << num_layers + 1 << "\" version=\"opset1\">"
+           << "<input><port id=\"0\">" << port << "</port></input></layer>";
+    edges << "<edge from-layer=\"" << num_layers << "\" from-port=\"1\" to-layer=\"" << num_layers + 1
+          << "\" to-port=\"0\"/>";
+    return "<net name=\"Network\" version=\"11\"><layers>" + layers.str() + "</layers><edges>" + edges.str() +
+           "</edges></net>";
+}
+}  // namespace
+
+TEST(DeepModelDeserialization, LongChainOfLayers) {
+    // the topological sort of the layers doesn't recurse into the inputs, so the chain doesn't overflow the stack
+    constexpr size_t num_layers = 100000;
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(make_relu_chain(num_layers), ov::Tensor()));
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(model->get_ordered_ops().size(), num_layers + 2);
+}
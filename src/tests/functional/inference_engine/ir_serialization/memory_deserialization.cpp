@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/opsets/opset8.hpp>
+#include <sstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/core.hpp"
+
+class MemoryDeserializationTest : public testing::Test {
+protected:
+    void SetUp() override {
+        model = create_model();
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::Serialize>(xml, bin);
+        m.run_passes(model);
+    }
+
+    static std::shared_ptr<ov::Model> create_model() {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 16, 16});
+        auto weights =
+            ov::opset8::Constant::create(ov::element::f32, {8, 3, 3, 3}, std::vector<float>(8 * 3 * 3 * 3, 0.5f));
+        auto conv = std::make_shared<ov::opset8::Convolution>(data,
+                                                              weights,
+                                                              ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+        auto result = std::make_shared<ov::opset8::Result>(conv);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+
+    void compare(const std::shared_ptr<ov::Model>& read) const {
+        ASSERT_NE(nullptr, read);
+        const auto res = FunctionsComparator::with_default()
+                             .enable(FunctionsComparator::CONST_VALUES)
+                             .compare(read, model);
+        EXPECT_TRUE(res.valid) << res.message;
+    }
+
+    std::shared_ptr<ov::Model> model;
+    std::stringstream xml;
+    std::stringstream bin;
+    ov::Core core;
+};
+
+namespace {
+// The stream receiving the data from network can't tell its size
+class NonSeekableStreamBuf : public std::streambuf {
+public:
+    explicit NonSeekableStreamBuf(std::string str) : data(std::move(str)) {
+        setg(&data[0], &data[0], &data[0] + data.size());
+    }
+
+private:
+    std::string data;
+};
+}  // namespace
+
+TEST_F(MemoryDeserializationTest, ReadFromStreams) {
+    compare(core.read_model(xml, bin));
+}
+
+TEST_F(MemoryDeserializationTest, ReadFromNonSeekableWeightsStream) {
+    NonSeekableStreamBuf buf(bin.str());
+    std::istream weights(&buf);
+    compare(core.read_model(xml, weights));
+}
+
+TEST_F(MemoryDeserializationTest, WeightsTensorIsShared) {
+    const auto bin_str = bin.str();
+    ov::Tensor weights(ov::element::u8, ov::Shape{bin_str.size()});
+    std::copy(bin_str.begin(), bin_str.end(), weights.data<char>());
+
+    auto read = core.read_model(xml.str(), weights);
+    compare(read);
+    for (const auto& op : read->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(op)) {
+            const auto data = constant->get_data_ptr<char>();
+            EXPECT_GE(data, weights.data<char>());
+            EXPECT_LE(data + constant->get_byte_size(), weights.data<char>() + weights.get_byte_size());
+        }
+    }
+}
@@ -13,6 +13,7 @@
 #include <transformations/utils/utils.hpp>
 #include <transformations/init_node_info.hpp>
 #include <low_precision/mat_mul.hpp>
+#include <low_precision/network_helper.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "lpt_ngraph_functions/mat_mul_function.hpp"
@@ -497,4 +498,36 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::ValuesIn(testValuesWithPerChannelDq)),
     MatMulTransformation::getTestCaseName);
 } // namespace testValues3
+
+TEST(LPT, MatMulTransformationWithZeroPointOnSecondActivation) {
+    auto function = ngraph::builder::subgraph::MatMulFunction::getOriginal(
+        ngraph::element::f32,
+        { 1, 16, 384, 64 },
+        ngraph::element::u8,
+        { ngraph::element::f32, {}, { 0.02f } },
+        { 1, 16, 64, 384 },
+        ngraph::element::i8,
+        { ngraph::element::f32, { 5.f }, { 0.03f } });
+
+    SimpleLowPrecisionTransformer transformer;
+    transformer.add<ngraph::pass::low_precision::MatMulTransformation, ngraph::opset1::MatMul>(
+        LayerTransformation::createParamsU8I8());
+    transformer.transform(function);
+
+    size_t reduceSumCount = 0ul;
+    for (const auto& node : function->get_ordered_ops()) {
+        if (ov::is_type<ngraph::opset1::MatMul>(node)) {
+            ASSERT_EQ(ngraph::element::u8, node->get_input_element_type(0));
+            ASSERT_EQ(ngraph::element::i8, node->get_input_element_type(1));
+        } else if (ov::is_type<ngraph::opset1::ReduceSum>(node)) {
+            reduceSumCount++;
+        }
+    }
+    ASSERT_EQ(1ul, reduceSumCount);
+
+    const auto dequantization = ngraph::pass::low_precision::NetworkHelper::getDequantization(
+        function->get_results()[0], 0ul);
+    ASSERT_NE(nullptr, dequantization.multiply);
+    ASSERT_TRUE(ov::is_type<ngraph::opset1::Subtract>(dequantization.multiply->get_input_node_shared_ptr(0)));
+}
 } // namespace
@@ -21,6 +21,8 @@
 #include <ngraph/op/relu.hpp>
 #include <ngraph/op/result.hpp>
 #include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
 #include <ngraph/graph_util.hpp>
 
 #include <ie_core.hpp>
@@ -301,6 +303,32 @@ TEST_F(NGraphReshapeTests, CNNReshapeSpatialReLUDynamicToDynamic) {
     IE_SUPPRESS_DEPRECATED_END
 }
 
+TEST_F(NGraphReshapeTests, CNNReshapeRevalidatesShapeOfConsumers) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto data = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4});
+        data->set_friendly_name("data");
+        auto values = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{12});
+        values->set_friendly_name("values");
+        auto relu = std::make_shared<ngraph::op::Relu>(values);
+        auto shape_of = std::make_shared<ngraph::opset3::ShapeOf>(data);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(values, shape_of, false);
+        ngraph::ResultVector results{std::make_shared<ngraph::op::Result>(reshape),
+                                     std::make_shared<ngraph::op::Result>(relu)};
+        ngraph = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{data, values});
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    // only the shape of "data" is changed, the Reshape depends on its value through the ShapeOf
+    cnnNetwork.reshape({{"data", {1, 4, 3}}});
+    ASSERT_EQ(ngraph->get_results()[0]->get_output_partial_shape(0), ngraph::PartialShape({1, 4, 3}));
+    ASSERT_EQ(ngraph->get_results()[1]->get_output_partial_shape(0), ngraph::PartialShape({12}));
+
+    cnnNetwork.reshape({{"data", {1, 3, 4}}});
+    ASSERT_EQ(ngraph->get_results()[0]->get_output_partial_shape(0), ngraph::PartialShape({1, 3, 4}));
+    ASSERT_EQ(ngraph->get_results()[1]->get_output_partial_shape(0), ngraph::PartialShape({12}));
+}
+
 class CustomTestOp: public ngraph::op::Op {
 public:
     OPENVINO_OP("CustomTestLayer", "test_extension");
@@ -73,3 +73,19 @@ TEST(ExecutableNetworkOVTests, throwsOnUninitializedGetContext) {
     ov::CompiledModel exec;
     ASSERT_THROW(exec.get_context(), ov::Exception);
 }
+
+TEST(ExecutableNetworkOVTests, throwsOnUninitializedAcquireInferRequest) {
+    ov::CompiledModel exec;
+    ASSERT_THROW(exec.acquire_infer_request(), ov::Exception);
+}
+
+TEST(ExecutableNetworkOVTests, throwsOnUninitializedSetInferRequestPoolSize) {
+    ov::CompiledModel exec;
+    ASSERT_THROW(exec.set_infer_request_pool_size(1), ov::Exception);
+}
+
+TEST(ExecutableNetworkOVTests, throwsOnEmptyPooledInferRequest) {
+    ov::PooledInferRequest req;
+    ASSERT_FALSE(req);
+    ASSERT_THROW(*req, ov::Exception);
+}
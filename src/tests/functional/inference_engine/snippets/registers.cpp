@@ -135,3 +135,91 @@ TEST(TransformationTests, AssignRegisters2) {
         ASSERT_EQ(total_ops, ref_registers.size());
     }
 }
+
+TEST(TransformationTests, AssignRegistersReduction) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 16});
+        auto y00 = std::make_shared<snippets::isa::Load>(p0); y00->set_friendly_name("y00");
+        auto y01 = std::make_shared<opset1::Relu>(y00); y01->set_friendly_name("y01");
+        auto y02 = std::make_shared<snippets::isa::Reduce>(y01, snippets::isa::Reduce::Kind::Sum); y02->set_friendly_name("y02");
+        auto y03 = std::make_shared<snippets::isa::ReduceStore>(y02); y03->set_friendly_name("y03");
+
+        f = std::make_shared<Function>(NodeVector{y03}, ParameterVector{p0});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AssignRegisters>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    // the accumulator keeps its value between the tile iterations, so it gets the register no other statement uses
+    {
+        std::map<std::string, size_t> ref_registers {
+            {"y00", 0},
+            {"y01", 1},
+            {"y02", 15}
+        };
+
+        auto total_ops = 0;
+        for (auto& op : f->get_ordered_ops()) {
+            auto& rt = op->get_rt_info();
+            auto it_rinfo = rt.find("reginfo");
+            if (it_rinfo != rt.end()) {
+                auto reginfo = it_rinfo->second.as<std::vector<size_t>>();
+                ASSERT_EQ(ref_registers[op->get_friendly_name()], reginfo[0]);
+                total_ops++;
+            }
+        }
+        ASSERT_EQ(total_ops, ref_registers.size());
+    }
+}
+
+TEST(TransformationTests, AssignRegistersSpill) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        // all the values of the chain are alive until they're accumulated in the reverse order, so they don't fit the bank
+        auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape(1));
+        auto load = std::make_shared<snippets::isa::Load>(p0);
+        std::vector<std::shared_ptr<Node>> chain{std::make_shared<opset1::Relu>(load)};
+        for (size_t i = 1; i < 18; i++) {
+            chain.push_back(std::make_shared<opset1::Relu>(chain.back()));
+        }
+        std::shared_ptr<Node> sum = chain.back();
+        for (auto it = chain.rbegin() + 1; it != chain.rend(); it++) {
+            sum = std::make_shared<opset1::Add>(sum, *it);
+        }
+        auto store = std::make_shared<snippets::isa::Store>(sum);
+
+        f = std::make_shared<Function>(NodeVector{store}, ParameterVector{p0});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AssignRegisters>();
+        ASSERT_NO_THROW(m.run_passes(f));
+    }
+
+    // the spilled values are reloaded from their own slots, the registers stay within the bank
+    {
+        std::set<size_t> spills;
+        size_t reloads = 0;
+        for (auto& op : f->get_ordered_ops()) {
+            if (auto spill = ov::as_type_ptr<snippets::isa::Spill>(op)) {
+                ASSERT_TRUE(spills.insert(spill->get_slot()).second);
+                ASSERT_EQ(op->get_rt_info().count("reginfo"), 0u);
+            } else if (auto reload = ov::as_type_ptr<snippets::isa::Reload>(op)) {
+                ASSERT_EQ(spills.count(reload->get_slot()), 1u);
+                reloads++;
+            }
+            auto& rt = op->get_rt_info();
+            auto it_rinfo = rt.find("reginfo");
+            if (it_rinfo != rt.end()) {
+                for (auto reg : it_rinfo->second.as<std::vector<size_t>>())
+                    ASSERT_LT(reg, 16u);
+            }
+        }
+        ASSERT_FALSE(spills.empty());
+        ASSERT_GE(reloads, spills.size());
+    }
+}
@@ -285,3 +285,104 @@ TEST(TransformationTests, DontAttachToSubgraphIfLoop) {
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, AttachInnermostReductionToSubgraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 16});
+    auto indata = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 16});
+    auto relu = std::make_shared<Subgraph>(NodeVector{data},
+        std::make_shared<Model>(NodeVector{std::make_shared<op::v0::Relu>(indata)}, ParameterVector{indata}));
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {-1});
+    auto sum = std::make_shared<op::v1::ReduceSum>(relu, axes, true);
+    auto f = std::make_shared<Model>(NodeVector{sum}, ParameterVector{data});
+
+    pass::Manager m;
+    m.register_pass<InitNodeInfo>();
+    m.register_pass<EnumerateNodes>();
+    m.register_pass<TokenizeSnippets>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::ReduceSum>(f), 0);
+}
+
+TEST(TransformationTests, DontStartSubgraphWithReduction) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 16});
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {2});
+    auto max = std::make_shared<op::v1::ReduceMax>(data, axes, true);
+    auto f = std::make_shared<Model>(NodeVector{max}, ParameterVector{data});
+
+    pass::Manager m;
+    m.register_pass<InitNodeInfo>();
+    m.register_pass<EnumerateNodes>();
+    m.register_pass<TokenizeSnippets>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::ReduceMax>(f), 1);
+}
+
+TEST(TransformationTests, DontAttachReductionConsumerToSubgraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 16});
+    auto indata = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 16});
+    auto relu = std::make_shared<Subgraph>(NodeVector{data},
+        std::make_shared<Model>(NodeVector{std::make_shared<op::v0::Relu>(indata)}, ParameterVector{indata}));
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {-1});
+    auto sum = std::make_shared<op::v1::ReduceSum>(relu, axes, true);
+    auto div = std::make_shared<op::v1::Divide>(relu, sum);
+    auto f = std::make_shared<Model>(NodeVector{div}, ParameterVector{data});
+
+    pass::Manager m;
+    m.register_pass<InitNodeInfo>();
+    m.register_pass<EnumerateNodes>();
+    m.register_pass<TokenizeSnippets>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    // the division needs the sum of the whole row, so it's done by the next subgraph
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::v1::ReduceSum>(f), 0);
+}
+
+TEST(TransformationTests, AttachToDynamicSubgraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 3});
+    auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{1, 3});
+    auto indata0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 3});
+    auto indata1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{1, 3});
+    auto add = std::make_shared<Subgraph>(NodeVector{data0, data1},
+        std::make_shared<Model>(NodeVector{std::make_shared<op::v1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+    auto neg = std::make_shared<op::v0::Negative>(add);
+    auto f = std::make_shared<Model>(NodeVector{neg}, ParameterVector{data0, data1});
+
+    pass::Manager m;
+    m.register_pass<InitNodeInfo>();
+    m.register_pass<EnumerateNodes>();
+    m.register_pass<TokenizeSnippets>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Negative>(f), 0);
+    ASSERT_EQ(f->get_output_partial_shape(0), (PartialShape{-1, 3}));
+}
+
+TEST(TransformationTests, CanonicalizeDynamicSubgraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1});
+    auto indata0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto indata1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1});
+    auto subgraph = std::make_shared<Subgraph>(NodeVector{data0, data1},
+        std::make_shared<Model>(NodeVector{std::make_shared<op::v1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+
+    const Subgraph::BlockedShapeVector input_shapes{{Shape{4, 7}, AxisVector{0, 1}, element::f32},
+                                                    {Shape{1}, AxisVector{0}, element::f32}};
+    const Subgraph::BlockedShapeVector output_shapes{{Shape{4, 7}, AxisVector{0, 1}, element::f32}};
+    ASSERT_EQ(subgraph->canonicalize(output_shapes, input_shapes), (Shape{4, 7}));
+    ASSERT_EQ(subgraph->get_body()->get_parameters()[1]->get_shape(), (Shape{1, 1}));
+}
@@ -8,6 +8,7 @@
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_executor_manager.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
 #include <thread>
@@ -187,6 +188,86 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+class StreamsExecutorPriorityTests : public ::testing::TestWithParam<bool> {};
+
+TEST_P(StreamsExecutorPriorityTests, latencyTasksArePulledFirst) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 1, 1};
+    config._workStealing = GetParam();
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    std::promise<void> started;
+    taskExecutor->run([&] {
+        started.set_value();
+        // intentionally block the only stream until the other tasks are queued
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isBlocked] { return !isBlocked; });
+    });
+    started.get_future().wait();
+
+    std::vector<CPUStreamsExecutor::Priority> order;
+    std::vector<Future> futures;
+    for (auto priority : {CPUStreamsExecutor::Priority::BATCH, CPUStreamsExecutor::Priority::LATENCY}) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&order, priority] { order.push_back(priority); });
+        futures.emplace_back(p->get_future());
+        taskExecutor->run([p] {(*p)();}, priority);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+    for (auto&& f : futures) f.wait();
+
+    ASSERT_EQ(order, (std::vector<CPUStreamsExecutor::Priority>{CPUStreamsExecutor::Priority::LATENCY,
+                                                                CPUStreamsExecutor::Priority::BATCH}));
+}
+
+INSTANTIATE_TEST_SUITE_P(StreamsExecutorPriorityTests, StreamsExecutorPriorityTests, ::testing::Bool());
+
+TEST(StreamsExecutorConfigTests, defaultThreadsAreLimitedByCPUQuota) {
+    const auto quota = getCPUQuota();
+    ASSERT_GE(quota, 0);
+    auto config = IStreamsExecutor::Config::MakeDefaultMultiThreaded(IStreamsExecutor::Config{"TestQuota", 1});
+    if (quota > 0 && parallel_get_env_threads() == 0) {
+        EXPECT_LE(config._threadsPerStream, quota);
+    }
+    EXPECT_EQ(limitByCPUQuota(1), 1);
+}
+
+TEST(SharedStreamsExecutorTests, idleLeaseGetsStreamBeforeBusyOne) {
+    IStreamsExecutor::Config config{"TestSharedStreamsExecutor", 1, 1};
+    auto busyExecutor = executorManager()->getSharedCPUStreamsExecutor(config, 1);
+    auto idleExecutor = executorManager()->getSharedCPUStreamsExecutor(config, 1);
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    std::promise<void> started;
+    busyExecutor->run([&] {
+        started.set_value();
+        // intentionally block the only stream of the pool until the other tasks are queued
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isBlocked] { return !isBlocked; });
+    });
+    started.get_future().wait();
+
+    std::vector<int> order;
+    std::vector<Future> futures;
+    for (int i = 0; i < 3; i++) {
+        futures.emplace_back(async(busyExecutor, [&order] { order.push_back(0); }));
+    }
+    futures.emplace_back(async(idleExecutor, [&order] { order.push_back(1); }));
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+    for (auto&& f : futures) f.wait();
+
+    ASSERT_EQ(order, (std::vector<int>{1, 0, 0, 0}));
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -208,6 +289,30 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::HYBRID_AWARE};
+        config._threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN;
+        config._workStealing = true;
+        config._latencyOnBigCores = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        return executorManager()->getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"TestSharedStreamsExecutor",
+                                               streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE}, 1);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -233,6 +338,20 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        return executorManager()->getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"TestSharedStreamsExecutor",
+                                               streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE}, 1);
     }
 );
 
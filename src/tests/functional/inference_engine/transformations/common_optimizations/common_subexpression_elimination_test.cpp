@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+TEST_F(TransformationTestsF, CommonSubexpressionEliminationChains) {
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 3, 16, 16});
+
+        auto add_1 = std::make_shared<opset8::Add>(data, opset8::Constant::create(element::f32, Shape{1}, {0.5}));
+        auto relu_1 = std::make_shared<opset8::Relu>(add_1);
+        auto add_2 = std::make_shared<opset8::Add>(data, opset8::Constant::create(element::f32, Shape{1}, {0.5}));
+        auto relu_2 = std::make_shared<opset8::Relu>(add_2);
+
+        auto mul = std::make_shared<opset8::Multiply>(relu_1, relu_2);
+        function = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data});
+        manager.register_pass<pass::CommonSubexpressionElimination>();
+    }
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 3, 16, 16});
+
+        auto add = std::make_shared<opset8::Add>(data, opset8::Constant::create(element::f32, Shape{1}, {0.5}));
+        auto relu = std::make_shared<opset8::Relu>(add);
+
+        auto mul = std::make_shared<opset8::Multiply>(relu, relu);
+        function_ref = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, CommonSubexpressionEliminationDifferentAttributes) {
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 3, 16, 16});
+
+        auto softmax_1 = std::make_shared<opset8::Softmax>(data, 1);
+        auto softmax_2 = std::make_shared<opset8::Softmax>(data, 2);
+        auto softmax_3 = std::make_shared<opset8::Softmax>(data, 1);
+
+        auto add = std::make_shared<opset8::Add>(softmax_1, softmax_2);
+        auto mul = std::make_shared<opset8::Multiply>(add, softmax_3);
+        function = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data});
+        manager.register_pass<pass::CommonSubexpressionElimination>();
+    }
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 3, 16, 16});
+
+        auto softmax_1 = std::make_shared<opset8::Softmax>(data, 1);
+        auto softmax_2 = std::make_shared<opset8::Softmax>(data, 2);
+
+        auto add = std::make_shared<opset8::Add>(softmax_1, softmax_2);
+        auto mul = std::make_shared<opset8::Multiply>(add, softmax_1);
+        function_ref = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, CommonSubexpressionEliminationDifferentConstants) {
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+
+        auto add_1 = std::make_shared<opset8::Add>(data, opset8::Constant::create(element::f32, Shape{3}, {1, 2, 3}));
+        auto add_2 = std::make_shared<opset8::Add>(data, opset8::Constant::create(element::f32, Shape{3}, {1, 2, 4}));
+        auto add_3 = std::make_shared<opset8::Add>(data, opset8::Constant::create(element::f32, Shape{1, 3}, {1, 2, 3}));
+
+        function = std::make_shared<Function>(NodeVector{add_1, add_2, add_3}, ParameterVector{data});
+        manager.register_pass<pass::CommonSubexpressionElimination>();
+    }
+}
+
+TEST_F(TransformationTestsF, CommonSubexpressionEliminationKeepsRandomUniform) {
+    {
+        auto shape = opset8::Constant::create(element::i64, Shape{2}, {2, 3});
+        auto min_value = opset8::Constant::create(element::f32, Shape{}, {0});
+        auto max_value = opset8::Constant::create(element::f32, Shape{}, {1});
+
+        auto random_1 = std::make_shared<opset8::RandomUniform>(shape, min_value, max_value, element::f32, 0, 0);
+        auto random_2 = std::make_shared<opset8::RandomUniform>(shape, min_value, max_value, element::f32, 0, 0);
+
+        auto add = std::make_shared<opset8::Add>(random_1, random_2);
+        function = std::make_shared<Function>(NodeVector{add}, ParameterVector{});
+        manager.register_pass<pass::CommonSubexpressionElimination>();
+    }
+}
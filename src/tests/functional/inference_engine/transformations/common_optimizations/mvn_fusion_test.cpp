@@ -340,6 +340,63 @@ TEST_F(TransformationTestsF, MVNFusionTestAltDivInsideSqrt) {
     }
 }
 
+TEST_F(TransformationTestsF, MVNFusionTestSquareMul) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 128, 768 });
+        auto mean1_axes = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{ 1 }, { 2 });
+        auto mean1 = std::make_shared<ngraph::opset6::ReduceMean>(input, mean1_axes, true);
+        auto sub1 = std::make_shared<ngraph::opset6::Subtract>(input, mean1);
+        auto square = std::make_shared<ngraph::opset6::Multiply>(sub1, sub1);
+        auto mean3_axes = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{ 1 }, { 2 });
+        auto mean3 = std::make_shared<ngraph::opset6::ReduceMean>(square, mean3_axes, true);
+        auto sqrt = std::make_shared<ngraph::opset6::Sqrt>(mean3);
+        auto eps = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 1e-5 });
+        auto add_eps = std::make_shared<ngraph::opset6::Add>(sqrt, eps);
+        auto div = std::make_shared<ngraph::opset6::Divide>(sub1, add_eps);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ div }, ngraph::ParameterVector{ input });
+
+        manager.register_pass<ngraph::pass::MVNFusion>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 128, 768 });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{ 1 }, { 2 });
+        auto mvn = std::make_shared<ngraph::opset6::MVN>(input, axes, true, 1e-5, ngraph::op::MVNEpsMode::OUTSIDE_SQRT);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mvn }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, MVNFusionTestSquaredDifferenceRsqrt) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 128, 768 });
+        auto mean1_axes = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{ 1 }, { 2 });
+        auto mean1 = std::make_shared<ngraph::opset6::ReduceMean>(input, mean1_axes, true);
+        auto sub1 = std::make_shared<ngraph::opset6::Subtract>(input, mean1);
+        auto squared_difference = std::make_shared<ngraph::opset6::SquaredDifference>(input, mean1);
+        auto mean3_axes = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{ 1 }, { 2 });
+        auto mean3 = std::make_shared<ngraph::opset6::ReduceMean>(squared_difference, mean3_axes, true);
+        auto eps = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 1e-5 });
+        auto add_eps = std::make_shared<ngraph::opset6::Add>(mean3, eps);
+        auto const_neg_0_5 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { -0.5 });
+        auto power_rsqrt = std::make_shared<ngraph::opset6::Power>(add_eps, const_neg_0_5);
+        auto div = std::make_shared<ngraph::opset6::Multiply>(sub1, power_rsqrt);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ div }, ngraph::ParameterVector{ input });
+
+        manager.register_pass<ngraph::pass::MVNFusion>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 128, 768 });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{ 1 }, { 2 });
+        auto mvn = std::make_shared<ngraph::opset6::MVN>(input, axes, true, 1e-5, ngraph::op::MVNEpsMode::INSIDE_SQRT);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mvn }, ngraph::ParameterVector{ input });
+    }
+}
+
 TEST_F(TransformationTestsF, MVNFusionTestWithParametersInside) {
     {
         auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 224 });
@@ -307,4 +307,149 @@ TEST_F(TransformationTestsF, TransposeConvertNegativeConsumers) {
         function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ convert, transpose }, ngraph::ParameterVector{ input });
         manager.register_pass<ngraph::pass::TransposeConvert>();
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TransformationTestsF, TransposeUnary) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto relu = std::make_shared<ngraph::opset6::Relu>(transpose);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposeUnary>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto relu = std::make_shared<ngraph::opset6::Relu>(input);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(relu, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeBinaryEltwise) {
+    {
+        auto input_1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto input_2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto order_1 = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose_1 = std::make_shared<ngraph::opset6::Transpose>(input_1, order_1);
+        auto order_2 = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose_2 = std::make_shared<ngraph::opset6::Transpose>(input_2, order_2);
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose_1, transpose_2);
+        auto mul_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1, 1 }, { 1, 2, 3 });
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, mul_const);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mul }, ngraph::ParameterVector{ input_1, input_2 });
+        manager.register_pass<ngraph::pass::TransposeSinking>();
+    }
+
+    {
+        auto input_1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto input_2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto add = std::make_shared<ngraph::opset6::Add>(input_1, input_2);
+        auto mul_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 3 }, { 1, 2, 3 });
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, mul_const);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(mul, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input_1, input_2 });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeBinaryEltwiseNegativeDifferentOrders) {
+    {
+        auto input_1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 16 });
+        auto input_2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 16 });
+        auto order_1 = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose_1 = std::make_shared<ngraph::opset6::Transpose>(input_1, order_1);
+        auto order_2 = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose_2 = std::make_shared<ngraph::opset6::Transpose>(input_2, order_2);
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose_1, transpose_2);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input_1, input_2 });
+        manager.register_pass<ngraph::pass::TransposeBinaryEltwise>();
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeConcat) {
+    {
+        auto input_1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto input_2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 5 });
+        auto order_1 = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose_1 = std::make_shared<ngraph::opset6::Transpose>(input_1, order_1);
+        auto order_2 = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose_2 = std::make_shared<ngraph::opset6::Transpose>(input_2, order_2);
+        auto concat = std::make_shared<ngraph::opset6::Concat>(ngraph::OutputVector{ transpose_1, transpose_2 }, 1);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ concat }, ngraph::ParameterVector{ input_1, input_2 });
+        manager.register_pass<ngraph::pass::TransposeConcat>();
+    }
+
+    {
+        auto input_1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto input_2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 5 });
+        auto concat = std::make_shared<ngraph::opset6::Concat>(ngraph::OutputVector{ input_1, input_2 }, 3);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(concat, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input_1, input_2 });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposePad) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto pads_begin = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 0, 1, 2 });
+        auto pads_end = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 0, 3, 4 });
+        auto pad = std::make_shared<ngraph::opset6::Pad>(transpose, pads_begin, pads_end, ngraph::op::PadMode::REFLECT);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ pad }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposePad>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto pads_begin = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 1, 2, 0 });
+        auto pads_end = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 4, 0 });
+        auto pad = std::make_shared<ngraph::opset6::Pad>(input, pads_begin, pads_end, ngraph::op::PadMode::REFLECT);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(pad, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeInterpolate) {
+    ngraph::opset6::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = ngraph::opset6::Interpolate::InterpolateMode::NEAREST;
+    attrs.shape_calculation_mode = ngraph::opset6::Interpolate::ShapeCalcMode::SCALES;
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto sizes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 32, 32 });
+        auto scales = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 2 }, { 2, 2 });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 2, 3 });
+        auto interpolate = std::make_shared<ngraph::opset6::Interpolate>(transpose, sizes, scales, axes, attrs);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ interpolate }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposeInterpolate>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto sizes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 32, 32 });
+        auto scales = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 2 }, { 2, 2 });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 1, 2 });
+        auto interpolate = std::make_shared<ngraph::opset6::Interpolate>(input, sizes, scales, axes, attrs);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(interpolate, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input });
+    }
+}
@@ -2230,3 +2230,143 @@ TEST_F(TransformationTestsF, PruneSEBlock) {
     disable_rt_info_check();
     enable_accuracy_check();
 }
+
+
+TEST_F(TransformationTestsF, PruneMatMulDense) {
+    auto inputShapes = PartialShape{2, 8};
+
+    auto input = std::make_shared<opset5::Parameter>(element::f32, inputShapes);
+    auto first_weights = create_constant_with_zeros({8, 6}, {{}, {1, 2}});
+    auto first_matmul = std::make_shared<opset5::MatMul>(input, first_weights);
+    auto bias = create_constant_with_zeros({6}, {{1, 2}});
+    auto add = std::make_shared<opset5::Add>(first_matmul, bias);
+    auto relu = std::make_shared<opset5::Relu>(add);
+
+    auto last_weights = create_constant_with_zeros({4, 6}, {{}, {}});
+    auto last_matmul = std::make_shared<opset5::MatMul>(relu, last_weights, false, true);
+
+    function = std::make_shared<ngraph::Function>(OutputVector{last_matmul}, ParameterVector{input}, "MatMulDense");
+    {
+        auto input = std::make_shared<opset5::Parameter>(element::f32, inputShapes);
+        auto first_weights = create_constant_with_zeros({8, 4}, {{}, {}});
+        auto first_matmul = std::make_shared<opset5::MatMul>(input, first_weights);
+        auto bias = create_constant_with_zeros({1, 4}, {{}, {}});
+        auto add = std::make_shared<opset5::Add>(first_matmul, bias);
+        auto relu = std::make_shared<opset5::Relu>(add);
+
+        auto last_weights = create_constant_with_zeros({4, 4}, {{}, {}});
+        auto last_matmul = std::make_shared<opset5::MatMul>(relu, last_weights, false, true);
+
+        function_ref = std::make_shared<ngraph::Function>(OutputVector{last_matmul}, ParameterVector{input}, "MatMulDense");
+    }
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PruneMatMulDense.svg").run_on_function(function);
+    {
+        pass::Manager m;
+        m.register_pass<pass::InitMasks>();
+        m.register_pass<pass::PropagateMasks>();
+        m.run_passes(function);
+    }
+    compare_masks(*getMask(first_weights.get_node_shared_ptr()->output(0)),  Mask({{}, {1, 2}}));
+    compare_masks(*getMask(first_matmul->output(0)),  Mask({{}, {1, 2}}));
+    compare_masks(*getMask(add->output(0)),  Mask({{}, {1, 2}}));
+    compare_masks(*getMask(relu->output(0)),  Mask({{}, {1, 2}}));
+
+    compare_masks(*getMask(last_weights.get_node_shared_ptr()->output(0)),  Mask({{}, {1, 2}}));
+    compare_masks(*getMask(last_matmul->output(0)),  Mask({{}, {}}));
+    {
+        pass::Manager m;
+        m.register_pass<pass::ShrinkWeights>();
+        m.run_passes(function);
+    }
+    disable_rt_info_check();
+    enable_accuracy_check();
+}
+
+
+TEST_F(TransformationTestsF, PruneAttentionHeads) {
+    auto inputShapes = PartialShape{1, 3, 4};
+    // 2 heads of size 2, the second head has zero query, key and value weights
+    auto heads_shape = std::vector<int64_t>{1, 3, 2, 2};
+
+    auto input = std::make_shared<opset5::Parameter>(element::f32, inputShapes);
+    auto make_head_input = [&](const Output<Node> & weights, const std::vector<int64_t> & order) {
+        auto matmul = std::make_shared<opset5::MatMul>(input, weights);
+        auto reshape_const = opset5::Constant::create(element::i64, Shape{4}, heads_shape);
+        auto reshape = std::make_shared<opset5::Reshape>(matmul, reshape_const, true);
+        auto order_const = opset5::Constant::create(element::i64, Shape{4}, order);
+        return std::make_shared<opset5::Transpose>(reshape, order_const);
+    };
+    auto query_weights = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto key_weights = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto value_weights = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto query = make_head_input(query_weights, {0, 2, 1, 3});
+    auto key = make_head_input(key_weights, {0, 2, 3, 1});
+    auto value = make_head_input(value_weights, {0, 2, 1, 3});
+
+    auto scores = std::make_shared<opset5::MatMul>(query, key);
+    auto scale = std::make_shared<opset5::Multiply>(scores, opset5::Constant::create(element::f32, Shape{}, {0.5}));
+    auto softmax = std::make_shared<opset5::Softmax>(scale, 3);
+    auto context = std::make_shared<opset5::MatMul>(softmax, value);
+    auto context_transpose = std::make_shared<opset5::Transpose>(context,
+            opset5::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3}));
+    auto context_reshape = std::make_shared<opset5::Reshape>(context_transpose,
+            opset5::Constant::create(element::i64, Shape{3}, {1, 3, 4}), true);
+
+    auto output_weights = create_constant_with_zeros({4, 4}, {{}, {}});
+    auto output = std::make_shared<opset5::MatMul>(context_reshape, output_weights);
+
+    function = std::make_shared<ngraph::Function>(OutputVector{output}, ParameterVector{input}, "AttentionHeads");
+    {
+        auto input = std::make_shared<opset5::Parameter>(element::f32, inputShapes);
+        auto make_head_input = [&](const std::vector<int64_t> & order) {
+            auto weights = create_constant_with_zeros({4, 2}, {{}, {}});
+            auto matmul = std::make_shared<opset5::MatMul>(input, weights);
+            auto reshape_const = opset5::Constant::create(element::i64, Shape{4}, {1, 3, 1, 2});
+            auto reshape = std::make_shared<opset5::Reshape>(matmul, reshape_const, true);
+            auto order_const = opset5::Constant::create(element::i64, Shape{4}, order);
+            return std::make_shared<opset5::Transpose>(reshape, order_const);
+        };
+        auto query = make_head_input({0, 2, 1, 3});
+        auto key = make_head_input({0, 2, 3, 1});
+        auto value = make_head_input({0, 2, 1, 3});
+
+        auto scores = std::make_shared<opset5::MatMul>(query, key);
+        auto scale = std::make_shared<opset5::Multiply>(scores, opset5::Constant::create(element::f32, Shape{}, {0.5}));
+        auto softmax = std::make_shared<opset5::Softmax>(scale, 3);
+        auto context = std::make_shared<opset5::MatMul>(softmax, value);
+        auto context_transpose = std::make_shared<opset5::Transpose>(context,
+                opset5::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3}));
+        auto context_reshape = std::make_shared<opset5::Reshape>(context_transpose,
+                opset5::Constant::create(element::i64, Shape{3}, {1, 3, 2}), true);
+
+        auto output_weights = create_constant_with_zeros({2, 4}, {{}, {}});
+        auto output = std::make_shared<opset5::MatMul>(context_reshape, output_weights);
+
+        function_ref = std::make_shared<ngraph::Function>(OutputVector{output}, ParameterVector{input}, "AttentionHeads");
+    }
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PruneAttentionHeads.svg").run_on_function(function);
+    {
+        pass::Manager m;
+        m.register_pass<pass::InitMasks>();
+        m.register_pass<pass::PropagateMasks>();
+        m.run_passes(function);
+    }
+    compare_masks(*getMask(query_weights.get_node_shared_ptr()->output(0)),  Mask({{}, {2, 3}}));
+    compare_masks(*getMask(query->output(0)),  Mask({{}, {1}, {}, {}}));
+    compare_masks(*getMask(key->output(0)),  Mask({{}, {1}, {}, {}}));
+    compare_masks(*getMask(scores->output(0)),  Mask({{}, {1}, {}, {}}));
+    compare_masks(*getMask(context->output(0)),  Mask({{}, {1}, {}, {}}));
+    compare_masks(*getMask(context_reshape->output(0)),  Mask({{}, {}, {2, 3}}));
+
+    compare_masks(*getMask(output_weights.get_node_shared_ptr()->output(0)),  Mask({{2, 3}, {}}));
+    compare_masks(*getMask(output->output(0)),  Mask({{}, {}, {}}));
+    {
+        pass::Manager m;
+        m.register_pass<pass::ShrinkWeights>();
+        m.run_passes(function);
+    }
+    disable_rt_info_check();
+    enable_accuracy_check();
+}
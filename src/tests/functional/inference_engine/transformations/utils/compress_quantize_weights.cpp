@@ -177,3 +177,50 @@ TEST_F(TransformationTestsF, NegativeCompressQuantizeWeightsNonConstantInput) {
     comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
     enable_accuracy_check();
 }
+
+TEST_F(TransformationTestsF, CompressWeightsPerChannelSymmetric) {
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset8::Constant::create(element::f32, Shape{2, 4}, {-63.5, 1, 0.5, 63.5, 127, -2, 0, 1});
+        auto matmul = std::make_shared<opset8::MatMul>(data, weights, false, true);
+        function = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+
+        manager.register_pass<pass::CompressWeights>(element::i8);
+    }
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset8::Constant::create(element::i8, Shape{2, 4}, {-127, 2, 1, 127, 127, -2, 0, 1});
+        auto convert = std::make_shared<opset8::Convert>(weights, element::f32);
+        auto scale = opset8::Constant::create(element::f32, Shape{2, 1}, {0.5, 1});
+        auto mul = std::make_shared<opset8::Multiply>(convert, scale);
+        auto matmul = std::make_shared<opset8::MatMul>(data, mul, false, true);
+        function_ref = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    enable_accuracy_check();
+}
+
+TEST_F(TransformationTestsF, CompressWeightsGroupsAsymmetricU4) {
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset8::Constant::create(element::f32, Shape{4, 2}, {0, -1, 15, 14, -7.5, 7.5, 0, 3});
+        auto matmul = std::make_shared<opset8::MatMul>(data, weights);
+        function = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+
+        manager.register_pass<pass::CompressWeights>(element::u4, 2);
+    }
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset8::Constant::create(element::u4, Shape{2, 2, 2}, {0, 0, 15, 15, 0, 15, 15, 6});
+        auto convert = std::make_shared<opset8::Convert>(weights, element::f32);
+        auto zero_point = opset8::Constant::create(element::f32, Shape{2, 1, 2}, {0, 1, 15, 0});
+        auto sub = std::make_shared<opset8::Subtract>(convert, zero_point);
+        auto scale = opset8::Constant::create(element::f32, Shape{2, 1, 2}, {1, 1, 0.5, 0.5});
+        auto mul = std::make_shared<opset8::Multiply>(sub, scale);
+        auto reshape = std::make_shared<opset8::Reshape>(mul, opset8::Constant::create(element::i64, Shape{2}, {4, 2}), false);
+        auto matmul = std::make_shared<opset8::MatMul>(data, reshape);
+        function_ref = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    enable_accuracy_check();
+}
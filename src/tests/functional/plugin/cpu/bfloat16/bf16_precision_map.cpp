@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace {
+//  Input -> FC_1 -> Relu_2 -> FC_3 -> Softmax_4
+std::shared_ptr<Function> createFcSoftmax() {
+    auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 64});
+    input->set_friendly_name("Input_0");
+    auto fc1 = std::make_shared<opset1::MatMul>(input, opset1::Constant::create(element::f32, Shape{64, 64}, {0.01f}));
+    fc1->set_friendly_name("FC_1");
+    auto relu = std::make_shared<opset1::Relu>(fc1);
+    relu->set_friendly_name("Relu_2");
+    auto fc3 = std::make_shared<opset1::MatMul>(relu, opset1::Constant::create(element::f32, Shape{64, 64}, {0.02f}));
+    fc3->set_friendly_name("FC_3");
+    auto softmax = std::make_shared<opset1::Softmax>(fc3, 1);
+    softmax->set_friendly_name("Softmax_4");
+    return std::make_shared<Function>(NodeVector{softmax}, ParameterVector{input});
+}
+
+std::string getPrecisionMap(const std::map<std::string, std::string>& config) {
+    Core ie;
+    CNNNetwork network(createFcSoftmax());
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    return execNet.GetMetric(PluginConfigInternalParams::METRIC_CPU_BF16_PRECISION_MAP).as<std::string>();
+}
+}  // namespace
+
+TEST(BF16PrecisionMapTest, AutoMixedPrecisionKeepsSensitiveNodesInFP32) {
+    if (!with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    const auto enforced = getPrecisionMap({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}});
+    ASSERT_NE(enforced.find("FC_3:BF16"), std::string::npos);
+
+    const auto mixed = getPrecisionMap({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES},
+                                        {PluginConfigInternalParams::KEY_CPU_BF16_AUTO_MIXED_PRECISION, PluginConfigParams::YES}});
+    ASSERT_NE(mixed.find("FC_1:BF16"), std::string::npos);
+    ASSERT_NE(mixed.find("FC_3:FP32"), std::string::npos);
+}
+
+TEST(BF16PrecisionMapTest, ExplicitPrecisionsOverrideRules) {
+    if (!with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    const auto exported = getPrecisionMap({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES},
+                                           {PluginConfigInternalParams::KEY_CPU_BF16_PRECISION_MAP, "FC_1:FP32"}});
+    ASSERT_NE(exported.find("FC_1:FP32"), std::string::npos);
+
+    // the exported map is accepted back as is
+    ASSERT_EQ(getPrecisionMap({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES},
+                               {PluginConfigInternalParams::KEY_CPU_BF16_PRECISION_MAP, exported}}), exported);
+}
+
+TEST(BF16PrecisionMapTest, WrongPrecisionMapThrows) {
+    Core ie;
+    CNNNetwork network(createFcSoftmax());
+    ASSERT_ANY_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                    {{PluginConfigInternalParams::KEY_CPU_BF16_PRECISION_MAP, "FC_1:FP16"}}));
+}
+
+TEST(BF16PrecisionMapTest, EmptyIfBF16IsNotEnforced) {
+    ASSERT_TRUE(getPrecisionMap({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}}).empty());
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#include <openvino/runtime/core.hpp>
+#include <openvino/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+//  Input -> FC_1 -> Relu_2
+std::shared_ptr<ov::Model> createFcRelu() {
+    auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{4, 64});
+    auto fc1 = std::make_shared<ov::opset1::MatMul>(input, ov::opset1::Constant::create(ov::element::f32, {64, 64}, {0.01f}));
+    auto relu = std::make_shared<ov::opset1::Relu>(fc1);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{input});
+}
+
+bool isAligned(const void* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % 64 == 0;
+}
+}  // namespace
+
+TEST(CPURemoteContextTest, HostTensorsAreAlignedAndGiveSameResults) {
+    ov::Core core;
+    auto compiled = core.compile_model(createFcRelu(), CommonTestUtils::DEVICE_CPU);
+    auto request = compiled.create_infer_request();
+    std::fill_n(request.get_input_tensor().data<float>(), request.get_input_tensor().get_size(), 1.0f);
+    request.infer();
+    const auto expected = request.get_output_tensor();
+
+    auto context = core.get_default_context(CommonTestUtils::DEVICE_CPU);
+    auto input = context.create_host_tensor(ov::element::f32, {4, 64});
+    auto output = context.create_host_tensor(ov::element::f32, {4, 64});
+    ASSERT_TRUE(isAligned(input.data()));
+    ASSERT_TRUE(isAligned(output.data()));
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+
+    auto hostRequest = compiled.create_infer_request();
+    hostRequest.set_input_tensor(input);
+    hostRequest.set_output_tensor(output);
+    hostRequest.infer();
+    ASSERT_TRUE(std::equal(output.data<float>(), output.data<float>() + output.get_size(), expected.data<float>()));
+}
+
+TEST(CPURemoteContextTest, RemoteTensorsCanBeSetToRequest) {
+    ov::Core core;
+    auto context = core.create_context(CommonTestUtils::DEVICE_CPU, {{"NUMA_NODE_ID", -1}});
+    auto compiled = core.compile_model(createFcRelu(), context);
+    ASSERT_EQ(CommonTestUtils::DEVICE_CPU, compiled.get_context().get_device_name());
+
+    auto input = context.create_tensor(ov::element::f32, {4, 64});
+    ASSERT_EQ(CommonTestUtils::DEVICE_CPU, input.get_device_name());
+    auto request = compiled.create_infer_request();
+    ASSERT_NO_THROW(request.set_input_tensor(input));
+    ASSERT_NO_THROW(request.infer());
+}
+
+TEST(CPURemoteContextTest, WrongNumaNodeThrows) {
+    ov::Core core;
+    ASSERT_ANY_THROW(core.create_context(CommonTestUtils::DEVICE_CPU, {{"NUMA_NODE_ID", 1024}}));
+    ASSERT_ANY_THROW(core.create_context(CommonTestUtils::DEVICE_CPU, {{"UNKNOWN_PARAM", 0}}));
+}
@@ -43,6 +43,20 @@ const auto testCase1D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* 1D DFT of the lengths 37, 97 and 4099 with a prime factor > 32 computed by the Bluestein algorithm, 400 is mixed radix */
+const std::vector<std::vector<int64_t>> signalSizes1DBluestein = {
+    {37}, {97}, {400}, {4099}
+};
+
+const auto testCase1DBluestein = ::testing::Combine(
+    ::testing::Values(std::vector<size_t>{2, 400, 2}),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::Values(std::vector<int64_t>{1}),
+    ::testing::ValuesIn(signalSizes1DBluestein),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 /* 2D DFT */
 
 const std::vector<std::vector<int64_t>> axes2D = {
@@ -102,6 +116,7 @@ const auto testCase4D = ::testing::Combine(
 
 
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d_Bluestein, DFTLayerTest, testCase1DBluestein, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
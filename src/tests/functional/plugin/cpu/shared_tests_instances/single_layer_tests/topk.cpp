@@ -54,4 +54,31 @@ INSTANTIATE_TEST_SUITE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({21, 21, 21, 21})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+// The long innermost axis makes the heap sort split the rows into chunks for K > 6, K = 1 stays on the bubble sort.
+// In FP16 the generated values are closer than the precision, so the rows have many tied values
+const std::vector<int64_t> kLongAxis = {
+        1,
+        7,
+        64
+};
+
+const std::vector<std::vector<size_t>> inputShapesLongAxis = {
+        {1, 8192},
+        {2, 5000}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_LongAxis, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(kLongAxis),
+                ::testing::Values(static_cast<int64_t>(1)),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::ValuesIn(inputShapesLongAxis),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
@@ -643,6 +643,22 @@ INSTANTIATE_TEST_SUITE_P(smoke_Concat5D_CPU_Block16inPlace, ConcatLayerCPUTest,
                                 ::testing::Values(blocked16_5D)),
                         ConcatLayerCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Concat4D_CPU_Block8inPlaceSpatial, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(2, 3),
+                                ::testing::Values(static_shapes_to_test_representation({{1, 8, 3, 5}, {1, 8, 3, 5}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(blocked8_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Concat5D_CPU_Block16inPlaceSpatial, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(2, 3, 4),
+                                ::testing::Values(static_shapes_to_test_representation({{1, 16, 3, 5, 7}, {1, 16, 3, 5, 7}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(blocked16_5D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_Concat_inPlace, ConcatLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(0, 1, 2, -1),
@@ -136,5 +136,42 @@ INSTANTIATE_TEST_SUITE_P(smoke_set1, GatherElementsCPUTest,
                 ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
         GatherElementsCPUTest::getTestCaseName);
 
+// the rows along the innermost axis and along the axis stride are long enough to be gathered by the vectors
+const std::vector<std::vector<InputShape>> inLongRowsShapeParams = {
+    {{{}, {{2, 3, 5, 37}}},
+     {{}, {{2, 3, 5, 21}}}},
+    {{{-1, -1, -1, -1}, {{2, 3, 5, 37}, {1, 2, 4, 19}}},
+     {{-1, -1, -1, -1}, {{2, 3, 5, 21}, {1, 2, 4, 35}}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_set2, GatherElementsCPUTest,
+            ::testing::Combine(
+                ::testing::Combine(
+                    ::testing::ValuesIn(inLongRowsShapeParams),               // shape
+                    ::testing::ValuesIn(std::vector<int>({3, -1})),           // Axis
+                    ::testing::Values(ElementType::f32),
+                    ::testing::Values(ElementType::i32),
+                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
+        GatherElementsCPUTest::getTestCaseName);
+
+const std::vector<std::vector<InputShape>> inLongStrideShapeParams = {
+    {{{}, {{2, 17, 3, 8}}},
+     {{}, {{2, 5, 3, 8}}}},
+    {{{-1, -1, -1, -1}, {{2, 17, 3, 8}, {1, 16, 5, 7}}},
+     {{-1, -1, -1, -1}, {{2, 5, 3, 8}, {1, 3, 5, 7}}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_set3, GatherElementsCPUTest,
+            ::testing::Combine(
+                ::testing::Combine(
+                    ::testing::ValuesIn(inLongStrideShapeParams),             // shape
+                    ::testing::ValuesIn(std::vector<int>({1, -3})),           // Axis
+                    ::testing::Values(ElementType::f32),
+                    ::testing::Values(ElementType::i32),
+                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
+        GatherElementsCPUTest::getTestCaseName);
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -157,7 +157,10 @@ protected:
 
         function = makeNgraphFunction(netPrecision, params, lstmSequenceOp, "lstmSequenceOp");
 
-        if (seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ) {
+        const bool isPureSequence = seqMode == ngraph::helpers::SequenceTestsMode::PURE_SEQ ||
+                                    seqMode == ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_CONST ||
+                                    seqMode == ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM;
+        if (!isPureSequence) {
             ov::pass::Manager manager;
             if (direction == ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL)
                 manager.register_pass<ngraph::pass::BidirectionalLSTMSequenceDecomposition>();
@@ -246,6 +249,19 @@ INSTANTIATE_TEST_SUITE_P(smoke_static, LSTMSequenceCPUTest,
                                    ::testing::Values(std::map<std::string, std::string>{})),
                 LSTMSequenceCPUTest::getTestCaseName);
 
+// the sequences shorter than the max length are executed by the plugin node instead of TensorIterator
+INSTANTIATE_TEST_SUITE_P(smoke_static_RandSeqLen, LSTMSequenceCPUTest,
+                ::testing::Combine(::testing::ValuesIn(std::vector<std::vector<InputShape>>{staticShapes[0], staticShapes[1]}),
+                                   ::testing::Values(ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_CONST),
+                                   ::testing::ValuesIn(activations),
+                                   ::testing::ValuesIn(clip),
+                                   ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                     ov::op::RecurrentSequenceDirection::REVERSE),
+                                   ::testing::ValuesIn(netPrecisions),
+                                   ::testing::Values(cpuParams),
+                                   ::testing::Values(std::map<std::string, std::string>{})),
+                LSTMSequenceCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_static_BatchSizeOne, LSTMSequenceCPUTest,
                 ::testing::Combine(::testing::ValuesIn(std::vector<std::vector<InputShape>>{staticShapes[3]}),
                                    ::testing::ValuesIn(mode),
@@ -297,6 +297,25 @@ std::vector<std::vector<ov::test::InputShape>> inputShapes_6D = {
     {{{{1, 5}, 19, {1, 5}, {1, 5}, {1, 5}, {1, 5}}, {{2, 19, 2, 2, 2, 2}, {2, 19, 2, 2, 3, 2}}}},
 };
 
+// the outputs are few, so the input is reduced to the partial results by the threads
+std::vector<std::vector<ov::test::InputShape>> inputShapes_LowOutputCount = {
+    {{{}, {{2, 19, 64, 64}}}},
+    {{{}, {{2048, 3, 2, 2}}}},
+};
+
+const std::vector<std::vector<int>> axesLowOutputCount = {
+        {0},
+        {1, 2, 3},
+        {0, 1, 2, 3}
+};
+
+const std::vector<ngraph::helpers::ReductionType> reductionTypesLowOutputCount = {
+        ngraph::helpers::ReductionType::Mean,
+        ngraph::helpers::ReductionType::Max,
+        ngraph::helpers::ReductionType::Min,
+        ngraph::helpers::ReductionType::L2,
+};
+
 std::vector<CPUSpecificParams> cpuParams_4D = {
         CPUSpecificParams({nChw16c}, {nChw16c}, {}, {}),
         CPUSpecificParams({nchw}, {nchw}, {}, {}),
@@ -409,6 +428,19 @@ const auto params_MultiAxis_6D = testing::Combine(
         testing::Values(emptyCPUSpec),
         testing::Values(emptyFusingSpec));
 
+const auto params_LowOutputCount_4D = testing::Combine(
+        testing::Combine(
+                testing::ValuesIn(axesLowOutputCount),
+                testing::Values(CommonTestUtils::OpType::VECTOR),
+                testing::Values(true),
+                testing::ValuesIn(reductionTypesLowOutputCount),
+                testing::Values(ElementType::f32),
+                testing::Values(ElementType::undefined),
+                testing::Values(ElementType::undefined),
+                testing::ValuesIn(inputShapes_LowOutputCount)),
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+        testing::Values(emptyFusingSpec));
+
 INSTANTIATE_TEST_SUITE_P(
         smoke_Reduce_OneAxis_CPU,
         ReduceCPULayerTest,
@@ -451,6 +483,13 @@ INSTANTIATE_TEST_SUITE_P(
         ReduceCPULayerTest::getTestCaseName
 );
 
+INSTANTIATE_TEST_SUITE_P(
+        smoke_Reduce_LowOutputCount_4D_CPU,
+        ReduceCPULayerTest,
+        params_LowOutputCount_4D,
+        ReduceCPULayerTest::getTestCaseName
+);
+
 /* ================================ 1.2 No fusion - Logical ================================ */
 const auto params_OneAxis_Logical = testing::Combine(
         testing::Combine(
@@ -236,7 +236,6 @@ INSTANTIATE_TEST_SUITE_P(smoke_Split4D_CPU_planar, SplitLayerCPUTest,
                         SplitLayerCPUTest::getTestCaseName);
 
 const std::vector<InputShape> inputShapes4D_block = {
-        { {}, {{3, 16, 12, 12}} },
         {
             // dynamic
             {-1, 16, -1, -1},
@@ -314,7 +313,6 @@ INSTANTIATE_TEST_SUITE_P(smoke_Split5D_CPU_planar, SplitLayerCPUTest,
                         SplitLayerCPUTest::getTestCaseName);
 
 const std::vector<InputShape> inputShapes5D_block = {
-        { {}, {{3, 16, 24, 12, 36}} },
         {
             // dynamic
             {-1, 16, -1, -1, -1},
@@ -500,6 +498,46 @@ INSTANTIATE_TEST_SUITE_P(smoke_Split5D_CPU_Block16inPlace, SplitLayerCPUTest,
                                 ::testing::Values(blocked16_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Split4D_CPU_Block8inPlaceSpatial, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(2, 3),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(InputShape{ {}, {{3, 16, 12, 12}} }),
+                                ::testing::ValuesIn(outIndices3),
+                                ::testing::Values(blocked8_4D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Split4D_CPU_Block16inPlaceSpatial, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(4),
+                                ::testing::Values(2, 3),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(InputShape{ {}, {{3, 16, 12, 12}} }),
+                                ::testing::ValuesIn(outIndices4),
+                                ::testing::Values(blocked16_4D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Split5D_CPU_Block8inPlaceSpatial, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(2, 3, 4),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(InputShape{ {}, {{3, 16, 24, 12, 36}} }),
+                                ::testing::ValuesIn(outIndices3),
+                                ::testing::Values(blocked8_5D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Split5D_CPU_Block16inPlaceSpatial, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(4),
+                                ::testing::Values(2, 3, 4),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(InputShape{ {}, {{3, 16, 24, 12, 36}} }),
+                                ::testing::ValuesIn(outIndices4),
+                                ::testing::Values(blocked16_5D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
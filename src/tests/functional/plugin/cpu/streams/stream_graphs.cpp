@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace {
+//  Input -> FC_1 -> Relu_2
+std::shared_ptr<Function> createFcRelu() {
+    auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 64});
+    input->set_friendly_name("Input_0");
+    auto fc1 = std::make_shared<opset1::MatMul>(input, opset1::Constant::create(element::f32, Shape{64, 64}, {0.01f}));
+    fc1->set_friendly_name("FC_1");
+    auto relu = std::make_shared<opset1::Relu>(fc1);
+    relu->set_friendly_name("Relu_2");
+    return std::make_shared<Function>(NodeVector{relu}, ParameterVector{input});
+}
+
+std::vector<float> infer(InferRequest& request) {
+    auto input = request.GetBlob("Input_0");
+    auto inputData = input->buffer().as<float*>();
+    std::fill(inputData, inputData + input->size(), 1.0f);
+    request.Infer();
+    auto output = request.GetBlob("Relu_2");
+    auto outputData = output->cbuffer().as<const float*>();
+    return std::vector<float>(outputData, outputData + output->size());
+}
+}  // namespace
+
+TEST(StreamGraphsTest, IdleGraphsAreCreatedAgainOnUse) {
+    Core ie;
+    CNNNetwork network(createFcRelu());
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"},
+                                   {PluginConfigInternalParams::KEY_CPU_STREAM_GRAPHS_IDLE_TIMEOUT, "1"}});
+    auto reference = execNet.CreateInferRequest();
+    const auto expected = infer(reference);
+
+    for (int i = 0; i < 4; i++) {
+        std::vector<InferRequest> requests;
+        for (int j = 0; j < 4; j++)
+            requests.push_back(execNet.CreateInferRequest());
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+        // the requests are destroyed, so the graphs of their streams may be released after the timeout
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ASSERT_EQ(expected, infer(reference));
+    }
+}
+
+TEST(StreamGraphsTest, WrongIdleTimeoutThrows) {
+    Core ie;
+    CNNNetwork network(createFcRelu());
+    ASSERT_ANY_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                    {{PluginConfigInternalParams::KEY_CPU_STREAM_GRAPHS_IDLE_TIMEOUT, "-1"}}));
+}
+
+TEST(StreamGraphsTest, StreamGraphsReplayingSelectionGiveSameResults) {
+    Core ie;
+    CNNNetwork network(createFcRelu());
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"}});
+    auto reference = execNet.CreateInferRequest();
+    const auto expected = infer(reference);
+
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 8; i++)
+        requests.push_back(execNet.CreateInferRequest());
+    for (auto&& request : requests) {
+        std::fill_n(request.GetBlob("Input_0")->buffer().as<float*>(), request.GetBlob("Input_0")->size(), 1.0f);
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        request.Wait(InferRequest::WaitMode::RESULT_READY);
+        auto output = request.GetBlob("Relu_2");
+        auto outputData = output->cbuffer().as<const float*>();
+        ASSERT_EQ(expected, std::vector<float>(outputData, outputData + output->size()));
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <openvino/op/nv12_to_rgb.hpp>
+#include <openvino/op/i420_to_bgr.hpp>
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+using ColorConvertTransposeParams = std::tuple<bool,        // NV12 (true) or I420 (false)
+                                               bool,        // single plane
+                                               Precision>;
+
+class ColorConvertTransposeTest : public testing::WithParamInterface<ColorConvertTransposeParams>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon,
+                                  public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ColorConvertTransposeParams>& obj) {
+        bool nv12, singlePlane;
+        Precision prc;
+        std::tie(nv12, singlePlane, prc) = obj.param;
+        std::ostringstream result;
+        result << (nv12 ? "NV12toRGB" : "I420toBGR") << "_";
+        result << (singlePlane ? "single_plane" : "multi_plane") << "_";
+        result << "prc=" << prc.name();
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool nv12, singlePlane;
+        Precision prc;
+        std::tie(nv12, singlePlane, prc) = GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        abs_threshold = 1.0f; // the color conversion can round differently than the reference one
+        threshold = 1.f;
+
+        const size_t height = 16, width = 38;
+        const auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(prc);
+        ngraph::ParameterVector params;
+        std::shared_ptr<ngraph::Node> colorConvert;
+        if (singlePlane) {
+            params = ngraph::builder::makeParams(ngPrc, {{1, height * 3 / 2, width, 1}});
+            if (nv12)
+                colorConvert = std::make_shared<ov::op::v8::NV12toRGB>(params[0]);
+            else
+                colorConvert = std::make_shared<ov::op::v8::I420toBGR>(params[0]);
+        } else if (nv12) {
+            params = ngraph::builder::makeParams(ngPrc, {{1, height, width, 1}, {1, height / 2, width / 2, 2}});
+            colorConvert = std::make_shared<ov::op::v8::NV12toRGB>(params[0], params[1]);
+        } else {
+            params = ngraph::builder::makeParams(ngPrc, {{1, height, width, 1}, {1, height / 2, width / 2, 1}, {1, height / 2, width / 2, 1}});
+            colorConvert = std::make_shared<ov::op::v8::I420toBGR>(params[0], params[1], params[2]);
+        }
+        auto order = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {4}, {0, 3, 1, 2});
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(colorConvert, order);
+
+        function = makeNgraphFunction(ngPrc, params, transpose, "ColorConvertTranspose");
+    }
+};
+
+/* The conversion of the camera frame to the NCHW RGB image.
+ * Test that the Transpose is fused into ColorConvert, which writes the channels as the planes.
+
+    Input[NV12/I420]
+        |
+    ColorConvert
+        |
+    Transpose(0,3,1,2)
+        |
+    Output[NCHW]
+*/
+TEST_P(ColorConvertTransposeTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "Transpose", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "ColorConvert", 1);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertTranspose, ColorConvertTransposeTest,
+                         ::testing::Combine(::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(Precision::U8, Precision::FP32)),
+                         ColorConvertTransposeTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
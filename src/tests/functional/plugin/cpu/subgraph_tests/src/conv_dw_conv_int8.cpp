@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The quantized 1x1 convolution with the u8 output is fused with the following quantized depthwise 3x3 convolution.
+   The fusion is taken on the avx2 machines without avx512 for the activations which don't fit the L3 cache, so the
+   spatial dims are big enough.
+
+        Input
+          |
+     FakeQuantize (u8)
+          |
+     Convolution 1x1 --- FakeQuantize (i8) --- Weights
+          |
+        Relu
+          |
+     FakeQuantize (u8)
+          |
+   GroupConvolution 3x3 --- FakeQuantize (i8) --- Weights
+          |
+        Result
+*/
+using ConvDWConvInt8Params = std::tuple<InputShape,
+                                        size_t>;  // the stride of the depthwise convolution
+
+class ConvDWConvInt8CPUTest : public testing::WithParamInterface<ConvDWConvInt8Params>,
+                              virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvDWConvInt8Params>& obj) {
+        InputShape inputShape;
+        size_t stride;
+        std::tie(inputShape, stride) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& item : inputShape.second)
+            result << CommonTestUtils::vec2str(item) << "_";
+        result << "stride=" << stride;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t stride;
+        std::tie(inputShape, stride) = this->GetParam();
+        // the rounding of the intermediate u8 tensor may differ from the reference by one quantization step
+        abs_threshold = 0.5;
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const size_t channels = inputDynamicShapes[0][1].get_length();
+
+        auto input = ngraph::builder::makeFakeQuantize(params[0], ov::element::f32, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+
+        auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {channels, channels, 1, 1}, {}, true);
+        auto weightsFQ = ngraph::builder::makeFakeQuantize(weights, ov::element::f32, 255, {channels, 1, 1, 1},
+                                                           {-1.27f}, {1.27f}, {-1.27f}, {1.27f});
+        auto conv = std::make_shared<ov::opset8::Convolution>(input, weightsFQ, ov::Strides{1, 1}, ov::CoordinateDiff{0, 0},
+                                                              ov::CoordinateDiff{0, 0}, ov::Strides{1, 1});
+        auto relu = std::make_shared<ov::opset8::Relu>(conv);
+        auto convOutput = ngraph::builder::makeFakeQuantize(relu, ov::element::f32, 256, {}, {0.f}, {25.5f}, {0.f}, {25.5f});
+
+        auto dwWeights = ngraph::builder::makeConstant<float>(ov::element::f32, {channels, 1, 1, 3, 3}, {}, true);
+        auto dwWeightsFQ = ngraph::builder::makeFakeQuantize(dwWeights, ov::element::f32, 255, {channels, 1, 1, 1, 1},
+                                                             {-1.27f}, {1.27f}, {-1.27f}, {1.27f});
+        auto dwConv = std::make_shared<ov::opset8::GroupConvolution>(convOutput, dwWeightsFQ, ov::Strides{stride, stride},
+                                                                     ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                                     ov::Strides{1, 1});
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{dwConv}, params, "ConvDWConvInt8");
+    }
+};
+
+TEST_P(ConvDWConvInt8CPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    // the dw convolution is the post op of the 1x1 convolution
+    const bool fused = InferenceEngine::with_cpu_x86_avx2() && !InferenceEngine::with_cpu_x86_avx512f();
+    CheckNumberOfNodesWithType(executableNetwork, "Convolution", fused ? 1 : 2);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConvDWConvInt8_Stride1, ConvDWConvInt8CPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{1, 32, 640, 640}}}),
+                                            ::testing::Values(1)),
+                         ConvDWConvInt8CPUTest::getTestCaseName);
+
+// the output of the strided dw convolution is smaller, so the input is bigger to be out of the cache
+INSTANTIATE_TEST_SUITE_P(smoke_ConvDWConvInt8_Stride2, ConvDWConvInt8CPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{1, 32, 960, 960}}}),
+                                            ::testing::Values(2)),
+                         ConvDWConvInt8CPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ov;
+
+namespace SubgraphTestsDefinitions {
+namespace {
+constexpr size_t numChannels = 8;
+constexpr size_t capacityRows = 16;
+}  // namespace
+
+// The dynamic output is written directly to the user tensor while the output fits it, otherwise it's copied and the
+// tensor is enlarged. The graph memory must not refer to the user tensor of a request after its inference, so the
+// requests sharing the graph don't overwrite the outputs of each other.
+class DynamicOutputUserMemory : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto input = std::make_shared<opset8::Parameter>(element::f32, PartialShape{-1, numChannels});
+        auto scale = opset8::Constant::create(element::f32, Shape{}, {2.f});
+        auto mul = std::make_shared<opset8::Multiply>(input, scale);
+        auto relu = std::make_shared<opset8::Relu>(mul);
+        auto model = std::make_shared<Model>(NodeVector{relu}, ParameterVector{input}, "DynamicOutput");
+
+        auto core = test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    }
+
+    static float inputValue(size_t seed, size_t i) {
+        return static_cast<float>(static_cast<int>((seed * 31 + i * 7) % 23) - 11);
+    }
+
+    static void setInput(InferRequest& request, size_t rows, size_t seed) {
+        Tensor input(element::f32, Shape{rows, numChannels});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = inputValue(seed, i);
+        request.set_input_tensor(input);
+    }
+
+    static void checkOutput(InferRequest& request, size_t rows, size_t seed) {
+        auto output = request.get_output_tensor();
+        ASSERT_EQ((Shape{rows, numChannels}), output.get_shape());
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_FLOAT_EQ(std::max(inputValue(seed, i) * 2.f, 0.f), output.data<float>()[i]) << "element " << i;
+    }
+
+    CompiledModel compiledModel;
+};
+
+TEST_F(DynamicOutputUserMemory, smoke_WritesToUserTensor) {
+    auto request = compiledModel.create_infer_request();
+    Tensor output(element::f32, Shape{capacityRows, numChannels});
+    auto userPtr = output.data<float>();
+    auto capacity = capacityRows;
+    request.set_output_tensor(output);
+
+    // the rows bigger than the capacity enlarge the tensor, then the same rows are written to it directly
+    const std::vector<size_t> rows = {4, capacityRows, 2, capacityRows + 5, capacityRows + 5, 3};
+    for (size_t i = 0; i < rows.size(); i++) {
+        setInput(request, rows[i], i);
+        request.infer();
+        checkOutput(request, rows[i], i);
+        if (rows[i] <= capacity) {
+            ASSERT_EQ(userPtr, request.get_output_tensor().data<float>()) << "inference " << i;
+        } else {
+            userPtr = request.get_output_tensor().data<float>();
+            capacity = rows[i];
+        }
+    }
+}
+
+TEST_F(DynamicOutputUserMemory, smoke_RequestsKeepTheirOutputs) {
+    std::vector<InferRequest> requests;
+    for (size_t r = 0; r < 2; r++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_output_tensor(Tensor(element::f32, Shape{capacityRows, numChannels}));
+    }
+
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        const size_t rows = iteration + 2;
+        for (size_t r = 0; r < requests.size(); r++) {
+            setInput(requests[r], rows, iteration * 10 + r);
+            requests[r].infer();
+        }
+        for (size_t r = 0; r < requests.size(); r++)
+            checkOutput(requests[r], rows, iteration * 10 + r);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
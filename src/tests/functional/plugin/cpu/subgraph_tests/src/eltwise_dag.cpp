@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+using ngraph::helpers::EltwiseTypes;
+using ngraph::helpers::ActivationTypes;
+
+namespace SubgraphTestsDefinitions {
+
+/* The eltwise nodes sharing the input are fused into the single Eltwise node.
+   The rank is greater than the snippets support, so the legacy eltwise fusing is checked.
+
+        Parameter
+        /   |   \
+     Tanh   |    |
+        \   |    |
+       Multiply  |
+            \    |
+             Add
+              |
+            Result
+*/
+class EltwiseDagTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 3, 2, 2, 4, 3, 5}});
+
+        auto tanh = builder::makeActivation(inputParams[0], ngPrc, ActivationTypes::Tanh);
+        auto multiply = builder::makeEltwise(tanh, inputParams[0], EltwiseTypes::MULTIPLY);
+        auto add = builder::makeEltwise(multiply, inputParams[0], EltwiseTypes::ADD);
+
+        NodeVector results{add};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "EltwiseDag");
+    }
+};
+
+TEST_F(EltwiseDagTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 1);
+}
+
+} // namespace SubgraphTestsDefinitions
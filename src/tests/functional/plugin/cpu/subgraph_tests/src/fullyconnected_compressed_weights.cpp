@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The constant weights of FullyConnected are compressed to INT8 or INT4 with CPU_WEIGHTS_COMPRESSION and dequantized
+   by the kernel. The weights are on the INT4 grid and each group of the input channels has both limits of the grid,
+   so the compression is lossless for both precisions and the result matches the reference.
+
+    Input   Weights
+       \     /
+        MatMul
+          |
+        [Add] --- Bias
+          |
+        Result
+*/
+using CompressedWeightsParams = std::tuple<InputShape,
+                                           std::string,  // CPU_WEIGHTS_COMPRESSION
+                                           std::string,  // CPU_WEIGHTS_COMPRESSION_GROUP_SIZE
+                                           bool>;        // with the bias
+
+class FullyConnectedCompressedWeightsCPUTest : public testing::WithParamInterface<CompressedWeightsParams>,
+                                               virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CompressedWeightsParams>& obj) {
+        InputShape inputShape;
+        std::string compression, groupSize;
+        bool withBias;
+        std::tie(inputShape, compression, groupSize, withBias) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& item : inputShape.second)
+            result << CommonTestUtils::vec2str(item) << "_";
+        result << "compression=" << compression << "_";
+        result << "group=" << groupSize << "_";
+        result << "bias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t OC = 40;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        std::string compression, groupSize;
+        bool withBias;
+        std::tie(inputShape, compression, groupSize, withBias) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION, compression});
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_COMPRESSION_GROUP_SIZE,
+                              groupSize});
+        compressed = compression != InferenceEngine::PluginConfigParams::NO;
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const size_t IC = inputDynamicShapes[0].rbegin()->get_length();
+        const size_t group = std::stoul(groupSize);
+
+        std::vector<float> weightsData(OC * IC);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                // the 16 levels of INT4 are a subset of the INT8 levels with the same limits
+                size_t level = (oc * 5 + ic * 3) % 16;
+                if (ic % group == 0)
+                    level = 0;
+                else if (ic % group == 1)
+                    level = 15;
+                weightsData[oc * IC + ic] = static_cast<float>(level) * 0.125f - 1.f;
+            }
+        }
+        auto weights = ngraph::builder::makeConstant(ov::element::f32, {OC, IC}, weightsData);
+        std::shared_ptr<ov::Node> fc = std::make_shared<ov::opset8::MatMul>(params[0], weights, false, true);
+        if (withBias) {
+            auto bias = ngraph::builder::makeConstant<float>(ov::element::f32, {OC}, {}, true);
+            fc = std::make_shared<ov::opset8::Add>(fc, bias);
+        }
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{fc}, params, "FullyConnectedCompressedWeights");
+    }
+
+    bool compressed = false;
+};
+
+TEST_P(FullyConnectedCompressedWeightsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+    // the compressed kernel is executed on avx2 and avx512 only
+    if (compressed && InferenceEngine::with_cpu_x86_avx2()) {
+        selectedType = makeSelectedTypeStr(InferenceEngine::with_cpu_x86_avx512f() ? "jit_avx512" : "jit_avx2",
+                                           ov::element::f32);
+        CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+    }
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 160}}},
+    {{}, {{9, 160}}},
+    {{}, {{1, 3, 160}}},
+    {{-1, 160}, {{1, 160}, {6, 160}, {33, 160}, {1, 160}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedCompressedWeights, FullyConnectedCompressedWeightsCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(InferenceEngine::PluginConfigInternalParams::INT8,
+                                                              InferenceEngine::PluginConfigInternalParams::INT4,
+                                                              InferenceEngine::PluginConfigParams::NO),
+                                            // 160 input channels are split with the tail group by both sizes
+                                            ::testing::Values("128", "48"),
+                                            ::testing::Values(false, true)),
+                         FullyConnectedCompressedWeightsCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The constant weights of FullyConnected with the share of the zero blocks (16 output channels by 1 input channel)
+   not less than CPU_SPARSE_WEIGHTS_RATE are executed by the sparse kernel, the other weights by oneDNN.
+   The number of the output channels isn't a multiple of the block to cover the tail block.
+
+    Input   Weights (3 of 4 blocks are zero)
+       \     /
+        MatMul
+          |
+        [Add] --- Bias
+          |
+        Result
+*/
+using SparseWeightsParams = std::tuple<InputShape,
+                                       std::string,  // CPU_SPARSE_WEIGHTS_RATE
+                                       bool>;        // with the bias
+
+class FullyConnectedSparseWeightsCPUTest : public testing::WithParamInterface<SparseWeightsParams>,
+                                           virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SparseWeightsParams>& obj) {
+        InputShape inputShape;
+        std::string rate;
+        bool withBias;
+        std::tie(inputShape, rate, withBias) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& item : inputShape.second)
+            result << CommonTestUtils::vec2str(item) << "_";
+        result << "rate=" << rate << "_";
+        result << "bias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t OC = 72;
+    static constexpr size_t blockSize = 16;
+    static constexpr float zeroBlocksShare = 0.75f;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        std::string rate;
+        bool withBias;
+        std::tie(inputShape, rate, withBias) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_RATE, rate});
+        sparse = std::stof(rate) <= zeroBlocksShare;
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const size_t IC = inputDynamicShapes[0].rbegin()->get_length();
+
+        std::vector<float> weightsData(OC * IC);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                const bool zeroBlock = (oc / blockSize + ic) % 4 != 0;
+                weightsData[oc * IC + ic] = zeroBlock ? 0.f : static_cast<float>((oc * 7 + ic * 3) % 11) / 5.f - 1.f;
+            }
+        }
+        auto weights = ngraph::builder::makeConstant(ov::element::f32, {OC, IC}, weightsData);
+        std::shared_ptr<ov::Node> fc = std::make_shared<ov::opset8::MatMul>(params[0], weights, false, true);
+        if (withBias) {
+            auto bias = ngraph::builder::makeConstant<float>(ov::element::f32, {OC}, {}, true);
+            fc = std::make_shared<ov::opset8::Add>(fc, bias);
+        }
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{fc}, params, "FullyConnectedSparseWeights");
+    }
+
+    bool sparse = false;
+};
+
+TEST_P(FullyConnectedSparseWeightsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+    // the sparse kernel is executed on avx2 and avx512 only
+    if (sparse && InferenceEngine::with_cpu_x86_avx2()) {
+        selectedType = makeSelectedTypeStr(InferenceEngine::with_cpu_x86_avx512f() ? "jit_avx512" : "jit_avx2",
+                                           ov::element::f32);
+        CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+    }
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 64}}},
+    {{}, {{13, 64}}},
+    {{}, {{2, 5, 48}}},
+    {{-1, 64}, {{1, 64}, {7, 64}, {32, 64}, {1, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedSparseWeights, FullyConnectedSparseWeightsCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values("0.5", "0.9"),
+                                            ::testing::Values(false, true)),
+                         FullyConnectedSparseWeightsCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
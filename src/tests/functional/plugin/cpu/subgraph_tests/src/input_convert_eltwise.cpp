@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+using InputConvertEltwiseParams = Precision;
+
+class InputConvertEltwiseTest : public testing::WithParamInterface<InputConvertEltwiseParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon,
+                                public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InputConvertEltwiseParams>& obj) {
+        std::ostringstream result;
+        result << "inPrc=" << obj.param.name();
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        inPrc = GetParam();
+        outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<size_t> inputShape{1, 3, 32, 32};
+        const std::vector<size_t> channelShape{1, 3, 1, 1};
+        auto input = ngraph::builder::makeParams(FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(inPrc), {inputShape});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input[0], ngraph::element::f32);
+        auto mean = ngraph::builder::makeConstant<float>(ngraph::element::f32, channelShape, {10.f, 20.f, 30.f});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, mean);
+        auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, channelShape, {0.5f, 0.25f, 0.125f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+
+        function = makeNgraphFunction(ngraph::element::f32, input, multiply, "InputConvertEltwise");
+    }
+};
+
+/* The preprocessing of an integer input.
+ * Test that the Convert isn't executed, the Eltwise loads the integer input and converts it by itself.
+
+    Input[U8]
+        |
+     Convert[U8->FP32]    Constant[FP32]
+           \                 /
+            Subtract[FP32]      Constant[FP32]
+                    \             /
+                    Multiply[FP32]
+                          |
+                    Output[FP32]
+*/
+TEST_P(InputConvertEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 1);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_InputConvertEltwise, InputConvertEltwiseTest,
+                         ::testing::Values(Precision::U8, Precision::I8, Precision::U16, Precision::I16),
+                         InputConvertEltwiseTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
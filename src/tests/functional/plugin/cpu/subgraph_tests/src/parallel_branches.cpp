@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The independent branches are executed concurrently in their own arenas if CPU_PARALLEL_BRANCHES is enabled.
+   The threads of the arenas are bound like the threads of the stream executing the graph.
+
+            Input
+         /    |    \
+    MatMul  MatMul  Multiply
+       |      |       |
+     Relu   Sigmoid   |
+         \    |    /
+            Concat
+              |
+            Result
+*/
+using ParallelBranchesParams = std::tuple<std::string,   // the thread binding
+                                          std::string>;  // the number of streams
+
+class ParallelBranchesCPUTest : public testing::WithParamInterface<ParallelBranchesParams>,
+                                virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelBranchesParams>& obj) {
+        std::string binding, streams;
+        std::tie(binding, streams) = obj.param;
+
+        std::ostringstream result;
+        result << "bind=" << binding << "_";
+        result << "streams=" << streams;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::string binding, streams;
+        std::tie(binding, streams) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES,
+                              InferenceEngine::PluginConfigParams::YES});
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, binding});
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams});
+
+        init_input_shapes({{{}, {{4, 64}}}});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        auto weights0 = ngraph::builder::makeConstant<float>(ov::element::f32, {64, 32}, {}, true);
+        auto matmul0 = std::make_shared<ov::opset8::MatMul>(params[0], weights0);
+        auto relu = std::make_shared<ov::opset8::Relu>(matmul0);
+
+        auto weights1 = ngraph::builder::makeConstant<float>(ov::element::f32, {64, 16}, {}, true);
+        auto matmul1 = std::make_shared<ov::opset8::MatMul>(params[0], weights1);
+        auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(matmul1);
+
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+        auto mul = std::make_shared<ov::opset8::Multiply>(params[0], scale);
+
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::NodeVector{relu, sigmoid, mul}, 1);
+        function = std::make_shared<ov::Model>(ov::NodeVector{concat}, params, "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches, ParallelBranchesCPUTest,
+                         ::testing::Combine(::testing::Values(InferenceEngine::PluginConfigParams::YES,
+                                                              InferenceEngine::PluginConfigParams::NUMA,
+                                                              InferenceEngine::PluginConfigParams::NO),
+                                            ::testing::Values("1", "2")),
+                         ParallelBranchesCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The descriptors and the primitives of the graph nodes are created by several threads. Concat and Convolution check
+   whether their parents are constant, which is resolved for all the nodes before the nodes are processed in parallel.
+   Many branches make the neighbour nodes be processed at the same time.
+
+              Input
+         /      |      \
+     Conv     Conv  ... Conv      (constant weights)
+       |        |        |
+    Concat   Concat ... Concat --- Constant
+         \      |      /
+              Concat
+                |
+              Result
+*/
+using ParallelGraphInitParams = std::tuple<std::string,  // the number of threads
+                                           size_t>;      // the number of branches
+
+class ParallelGraphInitCPUTest : public testing::WithParamInterface<ParallelGraphInitParams>,
+                                 virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelGraphInitParams>& obj) {
+        std::string threads;
+        size_t branches;
+        std::tie(threads, branches) = obj.param;
+
+        std::ostringstream result;
+        result << "threads=" << threads << "_";
+        result << "branches=" << branches;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::string threads;
+        size_t branches;
+        std::tie(threads, branches) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, threads});
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"});
+
+        init_input_shapes({{{}, {{1, 8, 10, 10}}}});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        ov::OutputVector concats;
+        for (size_t b = 0; b < branches; b++) {
+            auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {8, 8, 3, 3}, {}, true);
+            auto conv = std::make_shared<ov::opset8::Convolution>(params[0], weights, ov::Strides{1, 1},
+                                                                  ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                                  ov::Strides{1, 1});
+            auto constant = ngraph::builder::makeConstant<float>(ov::element::f32, {1, 4, 10, 10}, {}, true);
+            concats.push_back(std::make_shared<ov::opset8::Concat>(ov::OutputVector{conv, constant}, 1));
+        }
+        auto concat = std::make_shared<ov::opset8::Concat>(concats, 1);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{concat}, params, "ParallelGraphInit");
+    }
+};
+
+TEST_P(ParallelGraphInitCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelGraphInit, ParallelGraphInitCPUTest,
+                         ::testing::Combine(::testing::Values("1", "4", "8"),
+                                            ::testing::Values(16)),
+                         ParallelGraphInitCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ov;
+
+namespace SubgraphTestsDefinitions {
+namespace {
+constexpr size_t numElements = 64;
+constexpr size_t numLayers = 6;
+constexpr size_t numRequests = 8;
+constexpr size_t numIterations = 4;
+}  // namespace
+
+// With CPU_PIPELINED_STREAMS the streams share a single graph split into the stages, which are executed by the
+// different requests concurrently. All the requests are started at once with the distinct inputs, so they flow through
+// the stages together, and their outputs are compared with the outputs of the model compiled without the pipeline.
+class PipelinedStreams : public ::testing::TestWithParam<int32_t> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<int32_t>& obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, numElements});
+        std::shared_ptr<Node> layer = input;
+        for (size_t l = 0; l < numLayers; l++) {
+            std::vector<float> weights(numElements * numElements);
+            for (size_t i = 0; i < weights.size(); i++)
+                weights[i] = static_cast<float>(static_cast<int>((i * 13 + l * 5) % 17) - 8) / 64.f;
+            auto weightsConst = opset8::Constant::create(element::f32, Shape{numElements, numElements}, weights);
+            auto matmul = std::make_shared<opset8::MatMul>(layer, weightsConst, false, true);
+            layer = std::make_shared<opset8::Relu>(matmul);
+        }
+        auto model = std::make_shared<Model>(NodeVector{layer}, ParameterVector{input}, "Pipeline");
+
+        auto core = test::utils::PluginCache::get().core();
+        const int32_t streams = GetParam();
+        pipelinedModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                             {streams::num(streams),
+                                              {InferenceEngine::PluginConfigInternalParams::KEY_CPU_PIPELINED_STREAMS,
+                                               InferenceEngine::PluginConfigParams::YES}});
+        referenceModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU, streams::num(1));
+    }
+
+    static Tensor makeInput(size_t seed) {
+        Tensor input(element::f32, Shape{1, numElements});
+        for (size_t i = 0; i < numElements; i++)
+            input.data<float>()[i] = static_cast<float>(static_cast<int>((seed * 7 + i * 3) % 19) - 9) / 4.f;
+        return input;
+    }
+
+    CompiledModel pipelinedModel;
+    CompiledModel referenceModel;
+};
+
+TEST_P(PipelinedStreams, CompareWithNotPipelined) {
+    std::vector<InferRequest> requests;
+    for (size_t r = 0; r < numRequests; r++)
+        requests.push_back(pipelinedModel.create_infer_request());
+    auto referenceRequest = referenceModel.create_infer_request();
+
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        for (size_t r = 0; r < numRequests; r++) {
+            requests[r].set_input_tensor(makeInput(iteration * numRequests + r));
+            requests[r].start_async();
+        }
+        for (auto& request : requests)
+            request.wait();
+
+        for (size_t r = 0; r < numRequests; r++) {
+            referenceRequest.set_input_tensor(makeInput(iteration * numRequests + r));
+            referenceRequest.infer();
+            auto reference = referenceRequest.get_output_tensor();
+            auto output = requests[r].get_output_tensor();
+            ASSERT_EQ(reference.get_shape(), output.get_shape());
+            for (size_t i = 0; i < output.get_size(); i++) {
+                const float expected = reference.data<float>()[i];
+                ASSERT_NEAR(expected, output.data<float>()[i], 1e-4f * std::max(1.f, std::abs(expected)))
+                    << "iteration " << iteration << ", request " << r << ", element " << i;
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_PipelinedStreams, PipelinedStreams, ::testing::Values(2, 3, 4),
+                         PipelinedStreams::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
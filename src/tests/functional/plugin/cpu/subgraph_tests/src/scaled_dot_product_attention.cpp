@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The attention is fused into the ScaledDotProductAttention node unless CPU_ATTENTION_FUSION is disabled.
+   The batch dimensions and the mask may be broadcast, also only at runtime for the dynamic shapes.
+
+    Query   Key
+        \   /
+        MatMul
+          |
+       Multiply
+          |
+         Add --- Mask
+          |
+       Softmax   Value
+           \     /
+            MatMul
+              |
+            Result
+*/
+using AttentionParams = std::tuple<std::vector<InputShape>,  // the query, key, value and optional mask shapes
+                                   bool,                     // the key is transposed by the MatMul
+                                   bool>;                    // the fusion is enabled
+
+class ScaledDotProductAttentionCPUTest : public testing::WithParamInterface<AttentionParams>,
+                                         virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AttentionParams>& obj) {
+        std::vector<InputShape> inputShapes;
+        bool keyTransposed, fusion;
+        std::tie(inputShapes, keyTransposed, fusion) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+            for (const auto& item : shape.second)
+                result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "keyTransposed=" << keyTransposed << "_";
+        result << "fusion=" << fusion;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes;
+        bool keyTransposed;
+        std::tie(inputShapes, keyTransposed, fusion) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION,
+                              fusion ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO});
+
+        init_input_shapes(inputShapes);
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        auto scores = std::make_shared<ov::opset8::MatMul>(params[0], params[1], false, keyTransposed);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {0.125f});
+        std::shared_ptr<ov::Node> scaled = std::make_shared<ov::opset8::Multiply>(scores, scale);
+        if (params.size() == 4)
+            scaled = std::make_shared<ov::opset8::Add>(scaled, params[3]);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(scaled, -1);
+        auto attention = std::make_shared<ov::opset8::MatMul>(softmax, params[2]);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{attention}, params, "ScaledDotProductAttention");
+    }
+
+    bool fusion = false;
+};
+
+TEST_P(ScaledDotProductAttentionCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(executableNetwork, "ScaledDotProductAttention", fusion ? 1 : 0);
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> staticShapes = {
+    // query, key, value, mask
+    {{{}, {{2, 4, 32, 16}}}, {{}, {{2, 4, 80, 16}}}, {{}, {{2, 4, 80, 8}}}, {{}, {{2, 1, 1, 80}}}},
+    {{{}, {{2, 4, 32, 16}}}, {{}, {{2, 4, 80, 16}}}, {{}, {{2, 4, 80, 8}}}},
+    // the key and value batches are broadcast to the heads of the query
+    {{{}, {{3, 20, 16}}}, {{}, {{1, 70, 16}}}, {{}, {{1, 70, 16}}}, {{}, {{20, 70}}}},
+    // the single query row is broadcast to the rows of the mask
+    {{{}, {{1, 2, 1, 16}}}, {{}, {{1, 2, 24, 16}}}, {{}, {{1, 2, 24, 16}}}, {{}, {{1, 2, 8, 24}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Static, ScaledDotProductAttentionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(staticShapes),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true, false)),
+                         ScaledDotProductAttentionCPUTest::getTestCaseName);
+
+const std::vector<std::vector<InputShape>> keyNotTransposedShapes = {
+    {{{}, {{2, 4, 32, 16}}}, {{}, {{2, 4, 16, 80}}}, {{}, {{2, 4, 80, 8}}}, {{}, {{2, 4, 32, 80}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_KeyNotTransposed, ScaledDotProductAttentionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(keyNotTransposedShapes),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true)),
+                         ScaledDotProductAttentionCPUTest::getTestCaseName);
+
+// the batches and the mask are broadcast only by the runtime shapes
+const std::vector<std::vector<InputShape>> dynamicShapes = {
+    {
+        {{-1, 4, -1, 16}, {{2, 4, 20, 16}, {1, 4, 10, 16}, {2, 4, 20, 16}}},
+        {{-1, -1, -1, 16}, {{1, 4, 70, 16}, {1, 1, 100, 16}, {2, 4, 70, 16}}},
+        {{-1, -1, -1, 8}, {{1, 4, 70, 8}, {1, 1, 100, 8}, {2, 4, 70, 8}}},
+        {{-1, -1, -1, -1}, {{2, 1, 20, 70}, {1, 4, 1, 100}, {1, 1, 1, 70}}}
+    },
+    {
+        {{-1, -1, 16}, {{4, 33, 16}, {4, 1, 16}}},
+        {{-1, -1, 16}, {{1, 130, 16}, {4, 5, 16}}},
+        {{-1, -1, 16}, {{4, 130, 16}, {1, 5, 16}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Dynamic, ScaledDotProductAttentionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true)),
+                         ScaledDotProductAttentionCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
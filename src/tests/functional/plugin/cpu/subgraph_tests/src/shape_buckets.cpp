@@ -0,0 +1,218 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The dynamic inputs are padded up to the shape buckets and the outputs are cropped back to the dims they have with
+   the original input dims. The second input may be of the bucket size itself, so its output isn't cropped.
+   Softmax along the padded axis isn't tail safe, so the padding is disabled for such models.
+
+    Input0      Input1
+      |           |
+   Multiply    Multiply
+      |           |
+   Transpose   [Softmax]
+      |           |
+    MatMul      Result
+   (weights)
+      |
+    Result
+*/
+using ShapeBucketsParams = std::tuple<std::vector<InputShape>,
+                                      bool>;  // the second branch has Softmax
+
+class ShapeBucketsCPUTest : public testing::WithParamInterface<ShapeBucketsParams>,
+                            virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ShapeBucketsParams>& obj) {
+        std::vector<InputShape> inputShapes;
+        bool withSoftmax;
+        std::tie(inputShapes, withSoftmax) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+            for (const auto& item : shape.second)
+                result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "softmax=" << withSoftmax;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHAPE_BUCKETS, "8,16,32"});
+
+        std::vector<InputShape> inputShapes;
+        bool withSoftmax;
+        std::tie(inputShapes, withSoftmax) = this->GetParam();
+
+        init_input_shapes(inputShapes);
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {2.f});
+        auto mul0 = std::make_shared<ov::opset8::Multiply>(params[0], scale);
+        auto order = ov::opset8::Constant::create(ov::element::i64, ov::Shape{3}, {0, 2, 1});
+        auto transpose = std::make_shared<ov::opset8::Transpose>(mul0, order);
+        auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {4, 16}, {}, true);
+        auto matmul = std::make_shared<ov::opset8::MatMul>(weights, transpose);
+
+        std::shared_ptr<ov::Node> second = std::make_shared<ov::opset8::Multiply>(params[1], scale);
+        if (withSoftmax)
+            second = std::make_shared<ov::opset8::Softmax>(second, 1);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{matmul, second}, params, "ShapeBuckets");
+    }
+};
+
+TEST_P(ShapeBucketsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        // the padded axis is moved by Transpose, the dims of the second input equal to the buckets aren't cropped
+        {{1, -1, 16}, {{1, 5, 16}, {1, 12, 16}, {1, 16, 16}, {1, 3, 16}}},
+        {{1, -1, 8}, {{1, 8, 8}, {1, 16, 8}, {1, 5, 8}, {1, 32, 8}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapeBuckets, ShapeBucketsCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(false, true)),
+                         ShapeBucketsCPUTest::getTestCaseName);
+
+}  // namespace
+
+/* The zero tails of the padded inputs are neutral to the sums of MatMul and to the windows of Convolution, but they
+   become non-zero after the bias or after the first convolution, so the padding must be disabled for the second
+   reducing or windowed node, as well as for the convolutions with the pads or windows depending on the input dims.
+   The outputs are compared with the reference computed with the original dims.
+*/
+enum class TailPattern {
+    MulMatMul,   // the tails stay zero, the inputs are padded
+    AddMatMul,   // the bias makes the tails non-zero before the reduction along the padded axis
+    ConvConv,    // the first convolution mixes the valid values into the tails
+    StridedConv,
+    AutoPadConv,
+};
+
+std::ostream& operator<<(std::ostream& os, TailPattern pattern) {
+    switch (pattern) {
+    case TailPattern::MulMatMul: return os << "MulMatMul";
+    case TailPattern::AddMatMul: return os << "AddMatMul";
+    case TailPattern::ConvConv: return os << "ConvConv";
+    case TailPattern::StridedConv: return os << "StridedConv";
+    case TailPattern::AutoPadConv: return os << "AutoPadConv";
+    }
+    return os;
+}
+
+using ShapeBucketsTailParams = std::tuple<InputShape, TailPattern>;
+
+class ShapeBucketsTailCPUTest : public testing::WithParamInterface<ShapeBucketsTailParams>,
+                                virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ShapeBucketsTailParams>& obj) {
+        InputShape inputShape;
+        TailPattern pattern;
+        std::tie(inputShape, pattern) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& item : inputShape.second)
+            result << CommonTestUtils::vec2str(item) << "_";
+        result << "pattern=" << pattern;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHAPE_BUCKETS, "8,16,32"});
+
+        InputShape inputShape;
+        TailPattern pattern;
+        std::tie(inputShape, pattern) = this->GetParam();
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        std::shared_ptr<ov::Node> result;
+        switch (pattern) {
+        case TailPattern::MulMatMul:
+        case TailPattern::AddMatMul: {
+            const auto channels = inputDynamicShapes.front().rbegin()->get_length();
+            std::shared_ptr<ov::Node> eltwise;
+            if (pattern == TailPattern::MulMatMul) {
+                auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {2.f});
+                eltwise = std::make_shared<ov::opset8::Multiply>(params[0], scale);
+            } else {
+                auto bias = ngraph::builder::makeConstant<float>(ov::element::f32, {static_cast<size_t>(channels)}, {},
+                                                                 true);
+                eltwise = std::make_shared<ov::opset8::Add>(params[0], bias);
+            }
+            // the sum along the padded axis
+            result = std::make_shared<ov::opset8::MatMul>(eltwise, eltwise, true, false);
+            break;
+        }
+        case TailPattern::ConvConv: {
+            auto conv = ngraph::builder::makeConvolution(params[0], ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                         {1, 1}, ov::op::PadType::EXPLICIT, 4);
+            result = ngraph::builder::makeConvolution(conv, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                      {1, 1}, ov::op::PadType::EXPLICIT, 4);
+            break;
+        }
+        case TailPattern::StridedConv:
+            result = ngraph::builder::makeConvolution(params[0], ov::element::f32, {3, 3}, {2, 2}, {1, 1}, {1, 1},
+                                                      {1, 1}, ov::op::PadType::EXPLICIT, 4);
+            break;
+        case TailPattern::AutoPadConv:
+            result = ngraph::builder::makeConvolution(params[0], ov::element::f32, {4, 4}, {1, 1}, {0, 0}, {0, 0},
+                                                      {1, 1}, ov::op::PadType::SAME_UPPER, 4);
+            break;
+        }
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{result}, params, "ShapeBucketsTail");
+    }
+};
+
+TEST_P(ShapeBucketsTailCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+const InputShape matMulShape = {{1, -1, 16}, {{1, 5, 16}, {1, 12, 16}, {1, 16, 16}, {1, 3, 16}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapeBucketsTail_MatMul, ShapeBucketsTailCPUTest,
+                         ::testing::Combine(::testing::Values(matMulShape),
+                                            ::testing::Values(TailPattern::MulMatMul, TailPattern::AddMatMul)),
+                         ShapeBucketsTailCPUTest::getTestCaseName);
+
+const InputShape convShape = {{1, 4, -1, -1}, {{1, 4, 5, 7}, {1, 4, 12, 9}, {1, 4, 16, 16}, {1, 4, 3, 10}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapeBucketsTail_Conv, ShapeBucketsTailCPUTest,
+                         ::testing::Combine(::testing::Values(convShape),
+                                            ::testing::Values(TailPattern::ConvConv, TailPattern::StridedConv,
+                                                              TailPattern::AutoPadConv)),
+                         ShapeBucketsTailCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
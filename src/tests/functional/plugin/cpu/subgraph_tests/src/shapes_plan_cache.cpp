@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The output shapes of the dynamic graph are recorded per the input shapes and reused when the same input shapes come
+   again. The target shape of Reshape is computed from the input shape, so the recorded shapes are valid. The output
+   shape of NonZero depends on the input data, so the recorded shapes can't be reused for such graph.
+
+         Input
+        /     \
+   ShapeOf   Multiply
+      |        |
+   Gather      |
+      |        |
+   Concat --- Reshape   [NonZero]
+               |           |
+            Softmax      Result
+               |
+            Result
+*/
+using ShapesPlanCacheParams = std::tuple<std::vector<InputShape>,
+                                         bool>;  // with the data dependent output shape
+
+class ShapesPlanCacheCPUTest : public testing::WithParamInterface<ShapesPlanCacheParams>,
+                               virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ShapesPlanCacheParams>& obj) {
+        std::vector<InputShape> inputShapes;
+        bool withNonZero;
+        std::tie(inputShapes, withNonZero) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+            for (const auto& item : shape.second)
+                result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "nonZero=" << withNonZero;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes;
+        bool withNonZero;
+        std::tie(inputShapes, withNonZero) = this->GetParam();
+
+        init_input_shapes(inputShapes);
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        auto shapeOf = std::make_shared<ov::opset8::ShapeOf>(params[0]);
+        auto batch = std::make_shared<ov::opset8::Gather>(shapeOf,
+                                                          ov::opset8::Constant::create(ov::element::i64, {1}, {0}),
+                                                          ov::opset8::Constant::create(ov::element::i64, {}, {0}));
+        auto targetShape = std::make_shared<ov::opset8::Concat>(
+                ov::OutputVector{batch, ov::opset8::Constant::create(ov::element::i64, {1}, {-1})}, 0);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+        auto mul = std::make_shared<ov::opset8::Multiply>(params[0], scale);
+        auto reshape = std::make_shared<ov::opset8::Reshape>(mul, targetShape, false);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(reshape, 1);
+
+        ov::NodeVector results{softmax};
+        if (withNonZero)
+            results.push_back(std::make_shared<ov::opset8::NonZero>(params[0]));
+        function = std::make_shared<ov::Model>(results, params, "ShapesPlanCache");
+    }
+};
+
+TEST_P(ShapesPlanCacheCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        // the shapes are repeated to be executed with the recorded output shapes, also after the other shapes
+        {{-1, -1, 8}, {{2, 5, 8}, {2, 5, 8}, {1, 3, 8}, {2, 5, 8}, {4, 1, 8}, {1, 3, 8}, {1, 3, 8}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapesPlanCache, ShapesPlanCacheCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(false, true)),
+                         ShapesPlanCacheCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ov;
+
+namespace SubgraphTestsDefinitions {
+namespace {
+constexpr size_t numElements = 8;
+constexpr int32_t numStreams = 4;
+constexpr size_t numRequests = 6;
+constexpr size_t numIterations = 5;
+}  // namespace
+
+// The stateful model accumulates its inputs: out = state + in, state = out.
+// The requests are inferred by several streams, so the same request meets different graphs, whose variable storages
+// must not mix the states of the requests.
+class StatefulMultiStream : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const Shape shape{1, numElements};
+        auto input = std::make_shared<opset8::Parameter>(element::f32, shape);
+        auto variable = std::make_shared<op::util::Variable>(
+                op::util::VariableInfo{PartialShape(shape), element::f32, "accumulator"});
+        auto init = opset8::Constant::create(element::f32, shape, {0.f});
+        auto read = std::make_shared<opset8::ReadValue>(init, variable);
+        auto add = std::make_shared<opset8::Add>(read, input);
+        auto assign = std::make_shared<opset8::Assign>(add, variable);
+        auto result = std::make_shared<opset8::Result>(add);
+        model = std::make_shared<Model>(ResultVector{result}, SinkVector{assign}, ParameterVector{input}, "Accumulator");
+
+        auto core = test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU, streams::num(numStreams));
+        for (size_t i = 0; i < numRequests; i++)
+            requests.push_back(compiledModel.create_infer_request());
+        references.assign(numRequests, std::vector<float>(numElements, 0.f));
+    }
+
+    // infers all the requests at once with the distinct inputs and updates the expected states
+    void inferAll(size_t iteration) {
+        for (size_t r = 0; r < numRequests; r++) {
+            Tensor input(element::f32, Shape{1, numElements});
+            auto data = input.data<float>();
+            for (size_t i = 0; i < numElements; i++) {
+                data[i] = static_cast<float>((r + 1) * 10 + i + iteration);
+                references[r][i] += data[i];
+            }
+            requests[r].set_input_tensor(input);
+        }
+        // the requests are started in the changing order to land on the other streams than the previous time
+        for (size_t r = 0; r < numRequests; r++)
+            requests[(r + iteration) % numRequests].start_async();
+        for (auto& request : requests)
+            request.wait();
+    }
+
+    void checkAll() {
+        for (size_t r = 0; r < numRequests; r++) {
+            auto output = requests[r].get_output_tensor();
+            auto states = requests[r].query_state();
+            ASSERT_EQ(1, states.size());
+            auto state = states.front().get_state();
+            for (size_t i = 0; i < numElements; i++) {
+                ASSERT_FLOAT_EQ(references[r][i], output.data<float>()[i]) << "request " << r << ", element " << i;
+                ASSERT_FLOAT_EQ(references[r][i], state.data<float>()[i]) << "request " << r << ", element " << i;
+            }
+        }
+    }
+
+    std::shared_ptr<Model> model;
+    CompiledModel compiledModel;
+    std::vector<InferRequest> requests;
+    std::vector<std::vector<float>> references;
+};
+
+TEST_F(StatefulMultiStream, smoke_AccumulatesEachRequestState) {
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        inferAll(iteration);
+        checkAll();
+    }
+}
+
+TEST_F(StatefulMultiStream, smoke_SetAndGetStateAcrossStreams) {
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        // the states are set by the user between the inferences on the other streams
+        for (size_t r = 0; r < numRequests; r += 2) {
+            Tensor value(element::f32, Shape{1, numElements});
+            for (size_t i = 0; i < numElements; i++)
+                value.data<float>()[i] = references[r][i] = static_cast<float>(r * 100 + iteration * 1000 + i);
+            requests[r].query_state().front().set_state(value);
+        }
+        // the states are read by the user before the inference, while they are bound to the graphs of the streams
+        for (size_t r = 1; r < numRequests; r += 2) {
+            auto state = requests[r].query_state().front().get_state();
+            for (size_t i = 0; i < numElements; i++)
+                ASSERT_FLOAT_EQ(references[r][i], state.data<float>()[i]) << "request " << r << ", element " << i;
+        }
+        inferAll(iteration);
+        checkAll();
+        // the reset state starts from the initial value on any stream
+        requests[iteration % numRequests].query_state().front().reset();
+        references[iteration % numRequests].assign(numElements, 0.f);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
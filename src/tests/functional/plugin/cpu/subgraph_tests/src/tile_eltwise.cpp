@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+using ngraph::helpers::EltwiseTypes;
+
+namespace SubgraphTestsDefinitions {
+
+/* The Tile repeating the dims of 1 only is dropped, the Eltwise broadcasts its input itself.
+   The rank is greater than the snippets support, so the Eltwise node gets the input.
+
+    Parameter  Parameter
+        |         |
+        |       Tile
+         \       /
+           Add
+            |
+          Result
+*/
+class TileEltwiseTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 3, 2, 2, 4, 3, 5}, {1, 1, 1, 1, 1, 3, 5}});
+
+        auto tile = builder::makeTile(inputParams[1], {1, 3, 2, 2, 4, 1, 1});
+        auto add = builder::makeEltwise(inputParams[0], tile, EltwiseTypes::ADD);
+
+        NodeVector results{add};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "TileEltwise");
+    }
+};
+
+TEST_F(TileEltwiseTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Tile", 0);
+}
+
+} // namespace SubgraphTestsDefinitions
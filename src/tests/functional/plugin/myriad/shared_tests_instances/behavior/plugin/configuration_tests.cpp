@@ -150,6 +150,9 @@ std::vector<std::map<std::string, std::string>> getCorrectConfigs() {
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, CONFIG_VALUE(YES)}},
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, CONFIG_VALUE(NO)}},
 
+        {{InferenceEngine::MYRIAD_NUMBER_OF_DEVICES, "1"}},
+        {{InferenceEngine::MYRIAD_NUMBER_OF_DEVICES, "2"}},
+
         {
             {KEY_LOG_LEVEL, LOG_INFO},
             {InferenceEngine::MYRIAD_COPY_OPTIMIZATION, CONFIG_VALUE(NO)},
@@ -287,6 +290,7 @@ const std::vector<std::pair<std::string, InferenceEngine::Parameter>>& getDefaul
         {InferenceEngine::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM, {false}},
         {InferenceEngine::MYRIAD_NONE_LAYERS, {std::string()}},
         {InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, {true}},
+        {InferenceEngine::MYRIAD_NUMBER_OF_DEVICES, {1}},
     };
     return defaultEntries;
 }
@@ -503,6 +507,8 @@ const std::vector<std::tuple<std::string, std::string, InferenceEngine::Paramete
             InferenceEngine::Parameter{true}),
         std::make_tuple(InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, InferenceEngine::PluginConfigParams::NO,
             InferenceEngine::Parameter{false}),
+
+        std::make_tuple(InferenceEngine::MYRIAD_NUMBER_OF_DEVICES, "2", InferenceEngine::Parameter{2}),
     };
     return customEntries;
 }
@@ -573,6 +579,7 @@ const std::vector<std::string>& getPrivateOptions() {
         InferenceEngine::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM,
         InferenceEngine::MYRIAD_NONE_LAYERS,
         InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA,
+        InferenceEngine::MYRIAD_NUMBER_OF_DEVICES,
     };
     return privateOptions;
 }
@@ -697,6 +704,9 @@ const std::vector<std::map<std::string, std::string>>& getIncorrectConfigs() {
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, "ON"}},
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, "OFF"}},
 
+        {{InferenceEngine::MYRIAD_NUMBER_OF_DEVICES, "0"}},
+        {{InferenceEngine::MYRIAD_NUMBER_OF_DEVICES, "-1"}},
+
         {
             {KEY_LOG_LEVEL, LOG_INFO},
             {InferenceEngine::MYRIAD_COPY_OPTIMIZATION, "ON"},
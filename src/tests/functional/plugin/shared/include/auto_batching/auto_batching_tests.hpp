@@ -8,6 +8,7 @@
 #include <memory>
 
 #include <gpu/gpu_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <common_test_utils/test_common.hpp>
 #include <functional_test_utils/plugin_cache.hpp>
 
@@ -49,6 +50,9 @@ protected:
     size_t num_streams;
     size_t num_requests;
     size_t num_batch;
+    unsigned int latency_target = 0;  // in ms, the default fixed timeout
+    // the blobs set to the requests are the consecutive slices of one region, so they're bound to the batch
+    bool use_contiguous_blobs = false;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
 
     void TestAutoBatch() {
@@ -62,6 +66,9 @@ protected:
         std::vector<InferRequest> irs;
         std::vector<std::vector<uint8_t>> ref;
         std::vector<int> outElementsCount;
+        std::vector<ExecutableNetwork> exec_nets;
+        // the regions the contiguous blobs are the slices of
+        std::map<std::string, std::vector<float>> regions;
 
         for (size_t i = 0; i < nets.size(); ++i) {
             auto net = nets[i];
@@ -76,13 +83,24 @@ protected:
                 config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
             // minimize timeout to reduce test time
             config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            if (latency_target)
+                config[CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_TARGET)] = std::to_string(latency_target);
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     device_name + "(" + std::to_string(num_batch) + ")",
                                                config);
+            exec_nets.push_back(exec_net_ref);
 
             auto network_outputs = net.getOutputsInfo();
             ASSERT_EQ(network_outputs.size(), 1) << " Auto-Batching tests use networks with single output";
             auto output = network_outputs.begin();  //single output
+            auto make_slice = [&](const std::string& name, const TensorDesc& desc, size_t j) -> Blob::Ptr {
+                auto& region = regions[std::to_string(i) + name];
+                const auto slice = std::accumulate(desc.getDims().begin(), desc.getDims().end(), size_t{1},
+                                                   std::multiplies<size_t>());
+                if (region.empty())
+                    region.resize(slice * num_requests);
+                return make_shared_blob<float>(desc, region.data() + slice * j, slice);
+            };
             for (size_t j = 0; j < num_requests; j++) {
                 outputs.push_back(output->first);
                 outElementsCount.push_back(
@@ -98,7 +116,11 @@ protected:
                     if (use_get_blob)
                         memcpy(reinterpret_cast<void *>(inf_req.GetBlob(n.first)->buffer().as<uint8_t*>()),
                                reinterpret_cast<const void *>(blob->cbuffer().as<uint8_t*>()), blob->byteSize());
-                    else
+                    else if (use_contiguous_blobs) {
+                        auto slice = make_slice(n.first, n.second->getTensorDesc(), j);
+                        memcpy(slice->buffer().as<uint8_t*>(), blob->cbuffer().as<uint8_t*>(), blob->byteSize());
+                        inf_req.SetBlob(n.first, slice);
+                    } else
                         inf_req.SetBlob(n.first, blob);
 
                     const auto inBlob = inf_req.GetBlob(n.first);
@@ -107,7 +129,8 @@ protected:
                     inData.push_back(std::vector<uint8_t>(inBlobBuf, inBlobBuf + blobSize));
                 }
                 if (!use_get_blob) {
-                    auto blob = FuncTestUtils::createAndFillBlob(output->second->getTensorDesc());
+                    auto blob = use_contiguous_blobs ? make_slice(output->first, output->second->getTensorDesc(), j)
+                                                     : FuncTestUtils::createAndFillBlob(output->second->getTensorDesc());
                     inf_req.SetBlob(output->first, blob);
                 }
 
@@ -127,6 +150,16 @@ protected:
             }
         }
 
+        if (latency_target && num_batch > 1) {
+            for (auto& exec_net : exec_nets) {
+                auto stats = exec_net.GetMetric(PluginConfigInternalParams::METRIC_AUTO_BATCH_TIMEOUT_STATS)
+                                 .as<std::map<std::string, float>>();
+                ASSERT_EQ(latency_target, stats.at("LATENCY_TARGET_MS"));
+                // the configured timeout is the upper bound of the adaptive one
+                ASSERT_LE(stats.at("TIMEOUT_MS"), 1.f);
+            }
+        }
+
         auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
         for (size_t i = 0; i < irs.size(); ++i) {
             const auto &refBuffer = ref[i].data();
@@ -158,6 +191,22 @@ public:
     }
 };
 
+class AutoBatching_Test_LatencyTarget : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        AutoBatching_Test::SetUp();
+        latency_target = 100;
+    };
+};
+
+class AutoBatching_Test_ContiguousBlobs : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        AutoBatching_Test::SetUp();
+        use_contiguous_blobs = true;
+    };
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -166,4 +215,12 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_LatencyTarget, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
+TEST_P(AutoBatching_Test_ContiguousBlobs, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
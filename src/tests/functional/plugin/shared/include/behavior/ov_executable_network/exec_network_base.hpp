@@ -96,6 +96,25 @@ TEST_P(OVExecutableNetworkBaseTest, canLoadCorrectNetworkToGetExecutableAndCreat
     EXPECT_NO_THROW(auto req = execNet.create_infer_request());
 }
 
+TEST_P(OVExecutableNetworkBaseTest, canAcquireInferRequestFromPoolAndReuseIt) {
+    auto execNet = core->compile_model(function, targetDevice, configuration);
+    ASSERT_NO_THROW(execNet.set_infer_request_pool_size(1));
+    ov::InferRequest first;
+    {
+        auto req = execNet.acquire_infer_request();
+        ASSERT_TRUE(req);
+        first = *req;
+        ASSERT_NO_THROW(req->infer());
+    }
+    // the only request of the pool is given back and borrowed again, with its tensors
+    auto copy = execNet;
+    auto req = copy.acquire_infer_request();
+    EXPECT_TRUE(first == *req);
+    EXPECT_NO_THROW(req->infer());
+    req.release();
+    EXPECT_FALSE(req);
+}
+
 TEST_P(OVExecutableNetworkBaseTest, checkGetExecGraphInfoIsNotNullptr) {
     auto execNet = core->compile_model(function, targetDevice, configuration);
     auto execGraph = execNet.get_runtime_model();
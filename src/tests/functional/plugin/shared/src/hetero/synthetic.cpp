@@ -9,6 +9,7 @@
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -183,4 +184,26 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[CONFIG_KEY_INTERNAL(HETERO_PIPELINED_EXECUTION)] = InferenceEngine::PluginConfigParams::YES;
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        ASSERT_NE(nullptr, cnnNetwork.getFunction());
+    }
+}
+
+TEST_P(HeteroSyntheticTest, costBasedAffinityKeepsEqualDevicesOnHost) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // the devices of the same plugin have the same costs, so any transfer only adds to the latency
+    configuration[CONFIG_KEY_INTERNAL(HETERO_COST_BASED_AFFINITY)] = InferenceEngine::PluginConfigParams::YES;
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    auto result = PluginCache::get().ie()->QueryNetwork(InferenceEngine::CNNNetwork{function}, targetDevice, configuration);
+    ASSERT_FALSE(result.supportedLayersMap.empty());
+    for (auto&& layer : result.supportedLayersMap) {
+        ASSERT_EQ(pluginParameters.back()._name, layer.second) << layer.first;
+    }
+}
+
 }  //  namespace HeteroTests
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include <common_test_utils/test_constants.hpp>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/impl/mock_inference_plugin_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinference_plugin.hpp"
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "plugin/mock_auto_device_plugin.hpp"
+#include "cpp/ie_plugin.hpp"
+#include "mock_common.hpp"
+
+using ::testing::MatcherCast;
+using ::testing::_;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::Contains;
+using ::testing::Pair;
+using ::testing::AnyNumber;
+using Config = std::map<std::string, std::string>;
+using namespace MockMultiDevice;
+
+class AutoCumulativeThroughputTest : public ::testing::Test {
+public:
+    std::shared_ptr<ngraph::Function>               function;
+    InferenceEngine::CNNNetwork                     cnnNet;
+    std::shared_ptr<MockICore>                      core;
+    std::shared_ptr<MockMultiDeviceInferencePlugin> plugin;
+
+    //mock exeNetwork
+    std::shared_ptr<MockIExecutableNetworkInternal> mockIExeNet;
+    ov::SoPtr<IExecutableNetworkInternal>           mockExeNetwork;
+    InferenceEngine::InferencePlugin                mockPlugin;
+    std::shared_ptr<MockIInferRequestInternal>      inferReqInternal;
+
+public:
+    void TearDown() override {
+        core.reset();
+        plugin.reset();
+        mockIExeNet.reset();
+        mockExeNetwork = {};
+        mockPlugin = {};
+        inferReqInternal.reset();
+    }
+
+    void SetUp() override {
+       // prepare mockExeNetwork
+       mockIExeNet = std::make_shared<MockIExecutableNetworkInternal>();
+       auto mockIPluginPtr = std::make_shared<MockIInferencePlugin>();
+       ON_CALL(*mockIPluginPtr, LoadNetwork(MatcherCast<const CNNNetwork&>(_), _)).WillByDefault(Return(mockIExeNet));
+       mockPlugin = InferenceEngine::InferencePlugin{mockIPluginPtr, {}};
+       // remove annoying ON CALL message
+       EXPECT_CALL(*mockIPluginPtr, LoadNetwork(MatcherCast<const CNNNetwork&>(_), _)).Times(1);
+       mockExeNetwork = mockPlugin.LoadNetwork(CNNNetwork{}, {});
+
+       // prepare mockicore and cnnNetwork for loading
+       core  = std::shared_ptr<MockICore>(new MockICore());
+       auto* origin_plugin = new MockMultiDeviceInferencePlugin();
+       plugin  = std::shared_ptr<MockMultiDeviceInferencePlugin>(origin_plugin);
+       function = ngraph::builder::subgraph::makeConvPoolRelu();
+       cnnNet = InferenceEngine::CNNNetwork(function);
+       // replace core with mock Icore
+       plugin->SetCore(core);
+       // mock execNetwork can work
+       inferReqInternal = std::make_shared<MockIInferRequestInternal>();
+       ON_CALL(*mockIExeNet.get(), CreateInferRequest()).WillByDefault(Return(inferReqInternal));
+       IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNum, 2);
+       ON_CALL(*mockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(Return(optimalNum));
+       IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, supportConfigs, {});
+       ON_CALL(*core, GetMetric(_, StrEq(METRIC_KEY(SUPPORTED_CONFIG_KEYS)), _))
+           .WillByDefault(Return(supportConfigs));
+       EXPECT_CALL(*core, GetMetric(_, StrEq(METRIC_KEY(SUPPORTED_CONFIG_KEYS)), _)).Times(AnyNumber());
+    }
+};
+
+TEST_F(AutoCumulativeThroughputTest, loadToAllDevicesWithOptimalRequests) {
+    // the devices the core reports, the requests count of each one is its optimal one
+    const std::vector<std::string> devices = {"GPU.0", "GPU.1", CommonTestUtils::DEVICE_CPU};
+    std::vector<DeviceInformation> metaDevices;
+    for (auto&& device : devices)
+        metaDevices.push_back({device, {}, -1, ""});
+    ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+    EXPECT_CALL(*plugin, ParseMetaDevices(_, _)).Times(1);
+    EXPECT_CALL(*core, GetAvailableDevices()).WillOnce(Return(devices));
+    // no single device is selected, each one is loaded with the throughput hint
+    EXPECT_CALL(*plugin, SelectDevice(_, _, _)).Times(0);
+    for (auto&& device : devices) {
+        EXPECT_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                    ::testing::Matcher<const std::string&>(StrEq(device)),
+                    ::testing::Matcher<const Config&>(Contains(Pair(CONFIG_KEY(PERFORMANCE_HINT),
+                        InferenceEngine::PluginConfigParams::THROUGHPUT)))))
+            .WillOnce(Return(mockExeNetwork));
+    }
+    EXPECT_CALL(*mockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+        .Times(devices.size());
+    EXPECT_CALL(*mockIExeNet.get(), CreateInferRequest()).Times(devices.size() * 2);
+    EXPECT_CALL(*inferReqInternal, SetCallback(_)).Times(devices.size() * 2);
+
+    Config config = {{CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO), InferenceEngine::PluginConfigParams::YES},
+                     {CONFIG_KEY_INTERNAL(AUTO_CUMULATIVE_THROUGHPUT), InferenceEngine::PluginConfigParams::YES}};
+    ASSERT_NO_THROW(plugin->LoadExeNetworkImpl(cnnNet, config));
+}
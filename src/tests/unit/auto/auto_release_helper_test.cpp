@@ -187,4 +187,71 @@ const std::vector<ConfigParams> testConfigs = {ConfigParams {true, true},
 
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests, AutoReleaseHelperTest,
                 ::testing::ValuesIn(testConfigs),
-            AutoReleaseHelperTest::getTestCaseName);
\ No newline at end of file
+            AutoReleaseHelperTest::getTestCaseName);
+
+class AutoHandoverTest : public AutoReleaseHelperTest {
+public:
+    void SetUpDevices() {
+        config.insert({CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO), InferenceEngine::PluginConfigParams::YES});
+        ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                    ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_GPU)),
+                    ::testing::Matcher<const Config&>(_))).WillByDefault(InvokeWithoutArgs([this]() {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                        return mockExeNetworkActual; }));
+        ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                    ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                    ::testing::Matcher<const Config&>(_))).WillByDefault(Return(mockExeNetwork));
+        metaDevices = {{CommonTestUtils::DEVICE_CPU, {}, -1}, {CommonTestUtils::DEVICE_GPU, {}, -1}};
+        ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+        ON_CALL(*plugin, SelectDevice(Property(&std::vector<DeviceInformation>::size, Eq(2)), _, _))
+                .WillByDefault(Return(metaDevices[1]));
+        ON_CALL(*plugin, SelectDevice(Property(&std::vector<DeviceInformation>::size, Eq(1)), _, _))
+                .WillByDefault(Return(metaDevices[0]));
+        config.insert({InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                      CommonTestUtils::DEVICE_CPU + std::string(",") + CommonTestUtils::DEVICE_GPU});
+    }
+};
+
+TEST_P(AutoHandoverTest, migrateVariableStatesAndReportSwitchTime) {
+    SetUpDevices();
+    auto state = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 4},
+                                                          InferenceEngine::Layout::NC});
+    state->allocate();
+    auto cpuState = std::make_shared<NiceMock<MockIVariableStateInternal>>();
+    ON_CALL(*cpuState, GetName()).WillByDefault(Return("state"));
+    ON_CALL(*cpuState, GetState()).WillByDefault(Return(state));
+    auto actualState = std::make_shared<NiceMock<MockIVariableStateInternal>>();
+    ON_CALL(*actualState, GetName()).WillByDefault(Return("state"));
+    ON_CALL(*inferReqInternal, QueryState())
+        .WillByDefault(Return(std::vector<InferenceEngine::IVariableStateInternal::Ptr>{cpuState}));
+    ON_CALL(*inferReqInternalActual, QueryState())
+        .WillByDefault(Return(std::vector<InferenceEngine::IVariableStateInternal::Ptr>{actualState}));
+    EXPECT_CALL(*actualState, SetState(_)).Times(1);
+
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = plugin->LoadExeNetworkImpl(cnnNet, config));
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    auto stats = exeNetwork->GetMetric(InferenceEngine::PluginConfigInternalParams::METRIC_AUTO_SWITCH_STATS)
+                     .as<std::map<std::string, float>>();
+    ASSERT_EQ(1, stats.count("ACTUAL_READY_MS"));
+    ASSERT_EQ(1, stats.count("SWITCH_MS"));
+    EXPECT_GE(stats["ACTUAL_READY_MS"], 200.f);
+}
+
+TEST_P(AutoHandoverTest, keepHelperWithCpuOverflow) {
+    SetUpDevices();
+    config.insert({CONFIG_KEY_INTERNAL(AUTO_CPU_OVERFLOW), InferenceEngine::PluginConfigParams::YES});
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = plugin->LoadExeNetworkImpl(cnnNet, config));
+    auto sharedcount = mockExeNetwork._ptr.use_count();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_EQ(mockExeNetwork._ptr.use_count(), sharedcount);
+    auto stats = exeNetwork->GetMetric(InferenceEngine::PluginConfigInternalParams::METRIC_AUTO_SWITCH_STATS)
+                     .as<std::map<std::string, float>>();
+    EXPECT_EQ(1, stats.count("ACTUAL_READY_MS"));
+    EXPECT_EQ(0, stats.count("SWITCH_MS"));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests, AutoHandoverTest,
+                ::testing::Values(ConfigParams {true, true}),
+            AutoHandoverTest::getTestCaseName);
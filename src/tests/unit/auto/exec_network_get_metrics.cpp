@@ -317,3 +317,23 @@ const std::vector<ConfigParams> testConfigs = {
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests, ExecNetworkGetMetric,
                 ::testing::ValuesIn(testConfigs),
             ExecNetworkGetMetric::getTestCaseName);
+
+TEST(ExecNetworkRequestStats, reportCountAndPercentilesPerDevice) {
+    MultiDeviceExecutableNetwork::DeviceRequestStats requestStats;
+    std::map<std::string, float> stats;
+    requestStats.Report(CommonTestUtils::DEVICE_GPU, stats);
+    EXPECT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats["GPU:COUNT"], 0.f);
+
+    // the percentiles are of the last 1024 requests, so the first 1000 ones are out of the window
+    for (int i = 0; i < 1000; i++)
+        requestStats.Add(1000.f, 1000.f);
+    for (int i = 1; i <= 1024; i++)
+        requestStats.Add(0.f, static_cast<float>(i));
+    requestStats.Report(CommonTestUtils::DEVICE_GPU, stats);
+    EXPECT_EQ(stats["GPU:COUNT"], 2024.f);
+    EXPECT_EQ(stats["GPU:QUEUE_P99_MS"], 0.f);
+    EXPECT_EQ(stats["GPU:EXEC_P50_MS"], 512.f);
+    EXPECT_EQ(stats["GPU:EXEC_P90_MS"], 921.f);
+    EXPECT_EQ(stats["GPU:EXEC_P99_MS"], 1013.f);
+}
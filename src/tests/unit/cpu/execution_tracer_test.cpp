@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include "utils/execution_tracer.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+size_t countOf(const std::string& str, const std::string& pattern) {
+    size_t count = 0;
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + pattern.size()))
+        count++;
+    return count;
+}
+}  // namespace
+
+TEST(ExecutionTracerTests, DumpsRecordsAsChromeTrace) {
+    ExecutionTracer tracer(16);
+    const auto id = tracer.registerName("conv\"1", "Convolution", "jit_avx512");
+
+    ExecutionTracer::setCurrentStream(3);
+    tracer.record(id, 1500, 4000);
+    tracer.record(ExecutionTracer::INFER, 1000, 5000);
+    ExecutionTracer::setCurrentStream(-1);
+
+    const auto trace = tracer.dumpChromeTrace();
+    ASSERT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[{\"name\":\"infer\""), 0u);
+    ASSERT_NE(trace.find("\"name\":\"conv\\\"1\",\"cat\":\"Convolution\",\"ph\":\"X\",\"ts\":1.500,\"dur\":2.500,\"pid\":3"),
+              std::string::npos);
+    ASSERT_NE(trace.find("\"args\":{\"isa\":\"jit_avx512\"}"), std::string::npos);
+    ASSERT_EQ(countOf(trace, "\"ph\":\"X\""), 2u);
+}
+
+TEST(ExecutionTracerTests, KeepsLatestRecords) {
+    ExecutionTracer tracer(4);
+    for (int64_t i = 0; i < 10; i++) {
+        tracer.record(ExecutionTracer::WAIT, i * 1000, i * 1000 + 1);
+    }
+
+    const auto trace = tracer.dumpChromeTrace();
+    ASSERT_EQ(countOf(trace, "\"ph\":\"X\""), 4u);
+    ASSERT_EQ(trace.find("\"ts\":5.000"), std::string::npos);
+    ASSERT_NE(trace.find("\"ts\":6.000"), std::string::npos);
+    ASSERT_NE(trace.find("\"ts\":9.000"), std::string::npos);
+}
+
+TEST(ExecutionTracerTests, RecordsThreadsSeparately) {
+    ExecutionTracer tracer(64);
+    auto recordAll = [&] {
+        for (int i = 0; i < 8; i++)
+            tracer.record(ExecutionTracer::INFER, tracer.now(), tracer.now());
+    };
+    std::thread first(recordAll);
+    std::thread second(recordAll);
+    first.join();
+    second.join();
+
+    const auto trace = tracer.dumpChromeTrace();
+    ASSERT_EQ(countOf(trace, "\"ph\":\"X\""), 16u);
+}
+
+TEST(ExecutionTracerTests, InternsRegisteredNames) {
+    ExecutionTracer tracer(16);
+    // the graphs of the streams register the same nodes
+    const auto id = tracer.registerName("conv1", "Convolution", "jit_avx2");
+    for (int i = 0; i < 3; i++)
+        ASSERT_EQ(id, tracer.registerName("conv1", "Convolution", "jit_avx2"));
+    ASSERT_NE(id, tracer.registerName("conv1", "Convolution", "jit_avx512"));
+    ASSERT_NE(id, tracer.registerName("conv2", "Convolution", "jit_avx2"));
+    ASSERT_EQ(ExecutionTracer::INFER, tracer.registerName("infer", "InferRequest"));
+
+    tracer.record(id, 1000, 2000);
+    const auto trace = tracer.dumpChromeTrace();
+    ASSERT_NE(trace.find("\"name\":\"conv1\",\"cat\":\"Convolution\""), std::string::npos);
+    ASSERT_NE(trace.find("\"args\":{\"isa\":\"jit_avx2\"}"), std::string::npos);
+}
+
+TEST(ExecutionTracerTests, ZeroCapacityThrows) {
+    ASSERT_ANY_THROW(ExecutionTracer tracer(0));
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "utils/huge_pages.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+size_t hugePagesBytes() {
+    const auto bytes = hugepages::getBytes();
+    return bytes.at("EXPLICIT_1G") + bytes.at("EXPLICIT_2M") + bytes.at("TRANSPARENT");
+}
+}  // namespace
+
+TEST(HugePagesTests, SmallRegionsUseRegularPages) {
+    const auto before = hugePagesBytes();
+    void* ptr = hugepages::allocate(1024, 64, hugepages::Mode::Transparent);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % 64);
+    ASSERT_EQ(before, hugePagesBytes());
+    hugepages::free(ptr);
+}
+
+TEST(HugePagesTests, BigRegionsAreAlignedToHugePage) {
+    for (auto mode : {hugepages::Mode::Transparent, hugepages::Mode::Explicit, hugepages::Mode::Explicit1G}) {
+        const auto before = hugePagesBytes();
+        const size_t size = 3 * hugePageSize + 1;
+        void* ptr = hugepages::allocate(size, 64, mode);
+        ASSERT_NE(nullptr, ptr);
+        std::memset(ptr, 0, size);
+        // the explicit modes fall back to the transparent pages if the hugetlbfs pool is empty
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % hugePageSize);
+        ASSERT_EQ(before + 4 * hugePageSize, hugePagesBytes());
+        hugepages::free(ptr);
+        ASSERT_EQ(before, hugePagesBytes());
+    }
+}
+
+TEST(HugePagesTests, ModeIsUsedByDefault) {
+    const auto mode = hugepages::getMode();
+    hugepages::setMode(hugepages::Mode::None);
+    const auto before = hugePagesBytes();
+    void* ptr = hugepages::allocate(4 * hugePageSize, 64);
+    ASSERT_EQ(before, hugePagesBytes());
+    hugepages::free(ptr);
+
+    hugepages::setMode(hugepages::Mode::Transparent);
+    ptr = hugepages::allocate(4 * hugePageSize, 64);
+    ASSERT_EQ(before + 4 * hugePageSize, hugePagesBytes());
+    hugepages::free(ptr);
+    hugepages::setMode(mode);
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory_arena.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(DynamicMemoryArenaTest, FallbackUntilRelayout) {
+    // box {start, finish, size, id}, the first two coexist in time, the third one may reuse the memory of the first
+    auto arena = std::make_shared<DynamicMemoryArena>(std::vector<MemorySolver::Box>{{0, 1, 0, 0}, {1, 2, 0, 1}, {2, 3, 0, 2}});
+    std::vector<DnnlMemoryMngrPtr> mngrs;
+    for (size_t i = 0; i < 3; i++)
+        mngrs.push_back(arena->createMemoryMngr(i));
+
+    ASSERT_FALSE(arena->relayout());
+    for (auto& mngr : mngrs) {
+        ASSERT_EQ(mngr->getRawPtr(), nullptr);
+        ASSERT_TRUE(mngr->resize(100));
+        ASSERT_NE(mngr->getRawPtr(), nullptr);
+        // the separate allocation is reused within the inference
+        ASSERT_FALSE(mngr->resize(50));
+    }
+
+    ASSERT_TRUE(arena->relayout());
+    ASSERT_EQ(arena->getSize(), 2u * 128u);
+    auto* base = static_cast<int8_t*>(mngrs[0]->getRawPtr());
+    auto* second = static_cast<int8_t*>(mngrs[1]->getRawPtr());
+    auto* third = static_cast<int8_t*>(mngrs[2]->getRawPtr());
+    ASSERT_NE(base, second);
+    ASSERT_NE(second, third);
+    ASSERT_LE(std::min(base, second), third);
+    ASSERT_LT(third, std::min(base, second) + arena->getSize());
+
+    // the planned capacity is enough, so the memory is not reallocated
+    ASSERT_FALSE(mngrs[1]->resize(128));
+    ASSERT_FALSE(arena->relayout());
+    ASSERT_EQ(mngrs[1]->getRawPtr(), second);
+}
+
+TEST(DynamicMemoryArenaTest, GrowOnly) {
+    auto arena = std::make_shared<DynamicMemoryArena>(std::vector<MemorySolver::Box>{{0, 1, 0, 0}});
+    auto mngr = arena->createMemoryMngr(0);
+
+    ASSERT_TRUE(mngr->resize(64));
+    ASSERT_TRUE(arena->relayout());
+    ASSERT_EQ(arena->getSize(), 64u);
+
+    ASSERT_TRUE(mngr->resize(256));
+    ASSERT_TRUE(arena->relayout());
+    ASSERT_EQ(arena->getSize(), 256u);
+
+    // smaller requests never release the buffer
+    ASSERT_FALSE(mngr->resize(64));
+    ASSERT_FALSE(arena->relayout());
+    ASSERT_EQ(arena->getSize(), 256u);
+}
+
+TEST(DynamicMemoryArenaTest, ExternalBuffer) {
+    auto arena = std::make_shared<DynamicMemoryArena>(std::vector<MemorySolver::Box>{{0, 1, 0, 0}});
+    auto mngr = arena->createMemoryMngr(0);
+
+    std::vector<int8_t> buffer(128);
+    mngr->setExtBuff(buffer.data(), buffer.size());
+    ASSERT_TRUE(mngr->hasExtBuffer());
+    ASSERT_EQ(mngr->getRawPtr(), buffer.data());
+    ASSERT_FALSE(mngr->resize(buffer.size()));
+    ASSERT_FALSE(arena->relayout());
+
+    ASSERT_TRUE(mngr->resize(buffer.size() + 1));
+    ASSERT_FALSE(mngr->hasExtBuffer());
+    ASSERT_NE(mngr->getRawPtr(), buffer.data());
+}
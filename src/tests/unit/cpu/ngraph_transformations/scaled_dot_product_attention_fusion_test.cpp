@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph_transformations/op/scaled_dot_product_attention.hpp>
+#include <ngraph_transformations/scaled_dot_product_attention_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 1, 1, 16 });
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 2.f });
+        auto scaled = std::make_shared<ngraph::opset1::Divide>(scores, scale);
+        auto masked = std::make_shared<ngraph::opset1::Add>(mask, scaled);
+        auto softmax = std::make_shared<ngraph::opset8::Softmax>(masked, -1);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ query, key, value, mask });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 1, 1, 16 });
+        auto attention = std::make_shared<ScaledDotProductAttentionNode>(query, key, value, mask, 0.5f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value, mask });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithoutMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 12, -1, 64 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 12, 64, -1 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 12, -1, 64 });
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(query, key);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 3);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ query, key, value });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 12, -1, 64 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 12, 64, -1 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 12, -1, 64 });
+        auto attention = std::make_shared<ScaledDotProductAttentionNode>(query, key, value, 1.f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionScoresWithSeveralConsumers) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto createFunction = [] {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 4, 16, 8 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 4, 16, 8 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 4, 16, 8 });
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 2);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul, scores }, ngraph::ParameterVector{ query, key, value });
+    };
+    {
+        f = createFunction();
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    f_ref = createFunction();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
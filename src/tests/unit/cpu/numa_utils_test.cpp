@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "utils/numa_utils.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(NumaUtilsTests, BytesPerNodeCoverWholePages) {
+    constexpr size_t size = 1 << 20;
+    std::vector<char> buffer(size);
+    std::memset(buffer.data(), 1, size);
+
+    const auto bytes = numa::getBytesPerNode(buffer.data(), size);
+    if (bytes.empty())
+        GTEST_SKIP() << "The pages placement query is not supported";
+
+    const auto total = std::accumulate(bytes.begin(), bytes.end(), size_t{0},
+                                       [](size_t acc, const std::pair<const int, size_t>& nodeBytes) { return acc + nodeBytes.second; });
+    // only the pages entirely covered by the buffer are reported
+    ASSERT_LE(total, size);
+    ASSERT_GT(total, 0u);
+}
+
+TEST(NumaUtilsTests, EmptyRegion) {
+    ASSERT_TRUE(numa::getBytesPerNode(nullptr, 0).empty());
+    ASSERT_FALSE(numa::bindToNode(nullptr, 0, 0));
+    ASSERT_FALSE(numa::interleave(nullptr, 0, {0}));
+}
@@ -96,6 +96,44 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+namespace {
+struct ValueSizeCost {
+    size_t operator()(const std::string& val) const noexcept {
+        return val.size();
+    }
+};
+}// namespace
+
+TEST(LruCacheTests, CostBasedEviction) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, std::string, ValueSizeCost> cache(capacity);
+    cache.put({1}, "aaaa");
+    cache.put({2}, "bbbb");
+    ASSERT_EQ(cache.getCost(), 8);
+    ASSERT_EQ(cache.size(), 2);
+
+    // touch the first record, so the second one becomes the least recently used
+    ASSERT_EQ(cache.get({1}), "aaaa");
+    cache.put({3}, "ccc");
+    ASSERT_EQ(cache.get({2}), std::string());
+    ASSERT_EQ(cache.get({1}), "aaaa");
+    ASSERT_EQ(cache.get({3}), "ccc");
+    ASSERT_EQ(cache.getCost(), 7);
+
+    // replacing a value updates the accumulated cost
+    cache.put({3}, "cccccc");
+    ASSERT_EQ(cache.getCost(), 10);
+    ASSERT_EQ(cache.size(), 2);
+
+    // a record exceeding the whole capacity can't be stored and doesn't evict the others
+    cache.put({4}, "ddddddddddd");
+    ASSERT_EQ(cache.get({4}), std::string());
+    ASSERT_EQ(cache.getCost(), 10);
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.get({1}), "aaaa");
+    ASSERT_EQ(cache.get({3}), "cccccc");
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -379,3 +417,80 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+    constexpr size_t numShards = 4;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    //each shard is able to keep all the records
+    MultiCache cache(capacity * numShards, numShards);
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < 10; ++j) {
+            for (int i = 0; i < capacity; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    //all the records fit into the cache, so they must be found
+    for (int i = 0; i < capacity; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(*intResult.first, i);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
+
+namespace {
+struct Payload {
+    char data[100];
+};
+} // namespace
+
+TEST(MultiCacheTests, CostInBytes) {
+    using ValueType = std::shared_ptr<Payload>;
+    constexpr size_t recordBytes = sizeof(ValueType) + sizeof(Payload);
+    constexpr int records = 8;
+    ASSERT_EQ(recordBytes, cacheByteSize(std::make_shared<Payload>()));
+
+    auto builder = [](const IntKey&) { return std::make_shared<Payload>(); };
+
+    // the budget keeps the given number of records regardless of the records limit
+    MultiCache cache(records * recordBytes, 1, true);
+    ASSERT_TRUE(cache.isCostInBytes());
+    for (int i = 0; i < records + 2; ++i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, builder).second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    //the least recently used records exceed the budget
+    for (int i = records + 1; i >= 2; --i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, builder).second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    // the same cache counting the records keeps all of them
+    MultiCache recordsCache(records * recordBytes);
+    for (int i = 0; i < records + 2; ++i) {
+        recordsCache.getOrCreate(IntKey{i}, builder);
+    }
+    for (int i = 0; i < records + 2; ++i) {
+        ASSERT_EQ(recordsCache.getOrCreate(IntKey{i}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
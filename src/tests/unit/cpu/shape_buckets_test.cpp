@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_common.h>
+#include "utils/shape_buckets.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(ShapeBucketsTests, Disabled) {
+    for (const auto& policy : {"", "NO"}) {
+        ShapeBuckets buckets(policy);
+        ASSERT_TRUE(buckets.empty());
+        ASSERT_EQ(buckets.roundUp(7), 7u);
+    }
+}
+
+TEST(ShapeBucketsTests, PowerOfTwo) {
+    ShapeBuckets buckets("POW2");
+    ASSERT_FALSE(buckets.empty());
+    ASSERT_EQ(buckets.roundUp(0), 0u);
+    ASSERT_EQ(buckets.roundUp(1), 1u);
+    ASSERT_EQ(buckets.roundUp(3), 4u);
+    ASSERT_EQ(buckets.roundUp(64), 64u);
+    ASSERT_EQ(buckets.roundUp(65), 128u);
+    // the upper bound can't be exceeded
+    ASSERT_EQ(buckets.roundUp(65, 100), 65u);
+}
+
+TEST(ShapeBucketsTests, List) {
+    ShapeBuckets buckets("16,32,128");
+    ASSERT_FALSE(buckets.empty());
+    ASSERT_EQ(buckets.roundUp(1), 16u);
+    ASSERT_EQ(buckets.roundUp(16), 16u);
+    ASSERT_EQ(buckets.roundUp(17), 32u);
+    ASSERT_EQ(buckets.roundUp(100), 128u);
+    ASSERT_EQ(buckets.roundUp(100, 110), 100u);
+    // the dims greater than the largest bucket are kept as is
+    ASSERT_EQ(buckets.roundUp(129), 129u);
+}
+
+TEST(ShapeBucketsTests, WrongPolicy) {
+    for (const auto& policy : {"POW3", "16,a", "16,,32", "32,16", "0,16", "-1", "16.5"}) {
+        ASSERT_THROW(ShapeBuckets{policy}, InferenceEngine::Exception) << policy;
+    }
+}
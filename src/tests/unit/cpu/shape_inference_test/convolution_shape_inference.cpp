@@ -159,4 +159,35 @@ TEST(StaticShapeInferenceTest, ConvolutionTimeTest) {
     std::cout << (convolution_time_sum >= other_op_time_sum ? "ON PAR WITH CONVOLUTION: " : "LONGER THAN CONVOLUTION ")
               << 1. * other_op_time_sum / convolution_time_sum << std::endl;
 }
-#endif
\ No newline at end of file
+#endif
+
+TEST(StaticShapeInferenceTest, MemoizedConvolutionPadsTest) {
+    Strides strides{2, 2};
+    CoordinateDiff pads_begin{0, 0};
+    CoordinateDiff pads_end{0, 0};
+    Strides dilations{1, 1};
+    const auto auto_pad = op::PadType::SAME_UPPER;
+
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto filters = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+
+    auto conv =
+        std::make_shared<op::v1::Convolution>(data, filters, strides, pads_begin, pads_end, dilations, auto_pad);
+    auto shape_infer = make_shape_inference(conv);
+
+    const std::vector<StaticShape> small_input_shapes = {StaticShape{1, 3, 5, 5}, StaticShape{7, 3, 3, 3}},
+                                   large_input_shapes = {StaticShape{1, 3, 6, 6}, StaticShape{7, 3, 3, 3}};
+    // the second inference of the small shapes is memoized, the pads are of the memoized result
+    for (int i = 0; i < 2; ++i) {
+        auto output_shapes = shape_infer->infer(small_input_shapes, {});
+        ASSERT_EQ(output_shapes[0], StaticShape({1, 7, 3, 3}));
+        ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({1, 1}));
+        ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({1, 1}));
+
+        output_shapes = shape_infer->infer(large_input_shapes, {});
+        ASSERT_EQ(output_shapes[0], StaticShape({1, 7, 3, 3}));
+        ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({0, 0}));
+        ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({1, 1}));
+    }
+    ASSERT_TRUE(StaticShape({1, 3, 6, 6}).is_inline());
+}
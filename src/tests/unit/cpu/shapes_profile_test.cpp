@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common_test_utils/file_utils.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include "cache/shapes_profile.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+std::shared_ptr<ov::Model> makeDynamicModel() {
+    auto param = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ov::PartialShape{-1, 3, -1});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset8::Relu>(param);
+    auto result = std::make_shared<ngraph::opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "dynamic");
+}
+} // namespace
+
+class ShapesProfileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CommonTestUtils::createDirectory(cacheDir);
+    }
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "txt");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    const std::string cacheDir = "shapes_profile_test_cache";
+};
+
+TEST_F(ShapesProfileTest, RecordsArePersisted) {
+    const auto model = makeDynamicModel();
+    const ShapesProfile::InputShapes first{{"input name with spaces", {1, 3, 10}}};
+    const ShapesProfile::InputShapes second{{"input name with spaces", {2, 3, 20}}};
+    {
+        ShapesProfile profile(cacheDir, model);
+        ASSERT_TRUE(profile.getLoadedRecords().empty());
+        profile.record(first);
+        profile.record(second);
+        profile.record(first);
+    }
+
+    ShapesProfile profile(cacheDir, model);
+    const auto& records = profile.getLoadedRecords();
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records[0], first);
+    ASSERT_EQ(records[1], second);
+}
+
+TEST_F(ShapesProfileTest, DifferentModelsDoNotShareProfile) {
+    {
+        ShapesProfile profile(cacheDir, makeDynamicModel());
+        profile.record({{"input", {1, 3, 10}}});
+    }
+
+    auto otherModel = makeDynamicModel();
+    otherModel->set_friendly_name("other");
+    ShapesProfile profile(cacheDir, otherModel);
+    ASSERT_TRUE(profile.getLoadedRecords().empty());
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <cstring>
+#include <ngraph/opsets/opset1.hpp>
+#include "mkldnn_weights_cache.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+std::shared_ptr<ngraph::opset1::Constant> makeConstant(const ngraph::Shape& shape, float value) {
+    // the data exceeds a single hashing chunk
+    std::vector<float> data(ngraph::shape_size(shape), value);
+    data.back() += 1.0f;
+    return ngraph::opset1::Constant::create(ngraph::element::f32, shape, data);
+}
+
+MKLDNNMemoryPtr makeMemory(const std::vector<float>& data) {
+    auto memory = std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    const CpuBlockedMemoryDesc desc(InferenceEngine::Precision::FP32, Shape(InferenceEngine::SizeVector{data.size()}));
+    memory->Create(desc, data.data());
+    return memory;
+}
+
+std::function<bool(const MKLDNNMemory&)> isEqualTo(const std::vector<float>& data) {
+    return [data](const MKLDNNMemory& memory) {
+        return memory.GetSize() == data.size() * sizeof(float) &&
+               std::memcmp(memory.GetPtr(), data.data(), memory.GetSize()) == 0;
+    };
+}
+}  // namespace
+
+TEST(WeightsCacheTests, SameContentGivesSameKey) {
+    MKLDNNWeightsSharing cache;
+    const auto first = makeConstant({512, 1024}, 1.0f);
+    const auto second = makeConstant({512, 1024}, 1.0f);
+    ASSERT_NE(first->get_data_ptr(), second->get_data_ptr());
+    ASSERT_EQ(cache.getContentKey(first), cache.getContentKey(second));
+    // the remembered key is returned for the same constant
+    ASSERT_EQ(cache.getContentKey(first), cache.getContentKey(first));
+}
+
+TEST(WeightsCacheTests, DifferentContentGivesDifferentKeys) {
+    MKLDNNWeightsSharing cache;
+    const auto key = cache.getContentKey(makeConstant({512, 1024}, 1.0f));
+    ASSERT_NE(key, cache.getContentKey(makeConstant({512, 1024}, 2.0f)));
+    // the same data of the different shape isn't shared, as the memory descriptor differs
+    ASSERT_NE(key, cache.getContentKey(makeConstant({1024, 512}, 1.0f)));
+}
+
+TEST(WeightsCacheTests, ContentKeySharesMemory) {
+    MKLDNNWeightsSharing cache;
+    const auto first = makeConstant({16, 16}, 1.0f);
+    const auto second = makeConstant({16, 16}, 1.0f);
+    int created = 0;
+    auto create = [&created] {
+        created++;
+        return std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    };
+    MKLDNNMemoryPtr firstMemory = *cache.findOrCreate(cache.getContentKey(first), create);
+    MKLDNNMemoryPtr secondMemory = *cache.findOrCreate(cache.getContentKey(second), create);
+    ASSERT_EQ(1, created);
+    ASSERT_EQ(firstMemory, secondMemory);
+}
+
+TEST(WeightsCacheTests, CollidingKeysDontShareDifferentContent) {
+    MKLDNNWeightsSharing cache;
+    const std::vector<float> first{1.f, 2.f, 3.f, 4.f};
+    const std::vector<float> second{5.f, 6.f, 7.f, 8.f};
+    // the different content gets the same key as if the hashes collided
+    const std::string key = "content_collision";
+    std::string firstKey, secondKey, key0, key1;
+
+    MKLDNNMemoryPtr firstMemory = *cache.findOrCreateEqual(key, [&] { return makeMemory(first); },
+                                                           isEqualTo(first), firstKey);
+    MKLDNNMemoryPtr secondMemory = *cache.findOrCreateEqual(key, [&] { return makeMemory(second); },
+                                                            isEqualTo(second), secondKey);
+    ASSERT_NE(firstMemory, secondMemory);
+    ASSERT_NE(firstKey, secondKey);
+    ASSERT_TRUE(isEqualTo(first)(*firstMemory));
+    ASSERT_TRUE(isEqualTo(second)(*secondMemory));
+
+    // the same content finds its own memory by the colliding key
+    int created = 0;
+    auto create = [&created] {
+        created++;
+        return MKLDNNMemoryPtr();
+    };
+    MKLDNNMemoryPtr firstFound = *cache.findOrCreateEqual(key, create, isEqualTo(first), key0);
+    MKLDNNMemoryPtr secondFound = *cache.findOrCreateEqual(key, create, isEqualTo(second), key1);
+    ASSERT_EQ(0, created);
+    ASSERT_EQ(firstMemory, firstFound);
+    ASSERT_EQ(secondMemory, secondFound);
+    ASSERT_EQ(firstKey, key0);
+    ASSERT_EQ(secondKey, key1);
+}
@@ -2,12 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdio>
+#include <fstream>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 // to suppress deprecated definition errors
 #define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
 #include "gna_model_serial.hpp"
+#include "gna_mapped_streambuf.hpp"
 
 using ::testing::Return;
 using ::testing::_;
@@ -24,3 +28,28 @@ TEST(GNAModelSerialTest, TestErrorOnTellg) {
     std::istream is(&mock);
     ASSERT_THROW(GNAModelSerial::ReadHeader(is), InferenceEngine::Exception);
 }
+
+TEST(GNAModelSerialTest, TestMappedStreamReadAndSeek) {
+    const std::string fileName = "gna_mapped_stream_test.bin";
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file << "GNAM0123456789";
+    }
+    {
+        GNAPluginNS::MappedStreamBuf buf(ov::util::load_mmap_object(fileName));
+        std::istream is(&buf);
+        char magic[4];
+        is.read(magic, sizeof(magic));
+        EXPECT_EQ(std::string(magic, sizeof(magic)), "GNAM");
+        EXPECT_EQ(is.tellg(), 4);
+        is.seekg(0, is.end);
+        EXPECT_EQ(is.tellg(), 14);
+        is.seekg(-3, is.cur);
+        std::string tail(3, '\0');
+        is.read(&tail[0], tail.size());
+        EXPECT_EQ(tail, "789");
+        is.seekg(4, is.beg);
+        EXPECT_EQ(is.get(), '0');
+    }
+    std::remove(fileName.c_str());
+}
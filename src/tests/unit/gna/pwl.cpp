@@ -103,4 +103,21 @@ TEST_F(PwlTest, neghalflog) {
     EXPECT_FALSE(GetPwl(DnnActivation::fromType(kActNegHalfLog), 1e-10, LOG_DOMAIN, 0, pwl));
 }
 
+TEST_F(PwlTest, cached_search_same_as_search) {
+    auto sigmoid = DnnActivation::fromType(kActSigmoid);
+    double err_pct = 0, cached_err_pct = 0;
+    auto pwl = pwl_search(sigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES, err_pct);
+    for (int i = 0; i < 2; i++) {
+        auto cached = pwl_search_cached(sigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, 0.5,
+                                        PWL_DESIGN_SAMPLES, cached_err_pct);
+        ASSERT_EQ(cached.size(), pwl.size());
+        for (size_t j = 0; j < pwl.size(); j++) {
+            EXPECT_EQ(cached[j].alpha, pwl[j].alpha);
+            EXPECT_EQ(cached[j].m, pwl[j].m);
+            EXPECT_EQ(cached[j].b, pwl[j].b);
+        }
+        EXPECT_EQ(cached_err_pct, err_pct);
+    }
+}
+
 } // namespace
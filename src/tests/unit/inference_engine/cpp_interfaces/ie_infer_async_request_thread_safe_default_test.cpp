@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <condition_variable>
 #include <deque>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -194,3 +196,66 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+// SetScheduling
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetScheduling) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetScheduling(true, {}, false), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, expiredRequestIsDropped) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    ASSERT_NO_THROW(testRequest->SetScheduling(false, std::chrono::microseconds{1}, true));
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(0);
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    taskExecutor->executeAll();
+    EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), InferCancelled);
+
+    // the expired request isn't dropped without the option
+    ASSERT_NO_THROW(testRequest->SetScheduling(false, std::chrono::microseconds{1}, false));
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    taskExecutor->executeAll();
+    EXPECT_NO_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, latencyRequestIsExecutedBeforeBatchOne) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    std::promise<void> started;
+    taskExecutor->run([&] {
+        started.set_value();
+        // intentionally block the only stream until the requests are started
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isBlocked] { return !isBlocked; });
+    });
+    started.get_future().wait();
+
+    std::vector<std::string> order;
+    auto batchInferRequest = make_shared<MockIInferRequestInternal>(InputsDataMap{}, OutputsDataMap{});
+    auto batchRequest = make_shared<AsyncInferRequestThreadSafeDefault>(batchInferRequest, taskExecutor, taskExecutor);
+    EXPECT_CALL(*batchInferRequest, InferImpl()).WillOnce(Invoke([&] { order.push_back("batch"); }));
+    auto latencyRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    latencyRequest->SetScheduling(true, {}, false);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).WillOnce(Invoke([&] { order.push_back("latency"); }));
+
+    batchRequest->StartAsync();
+    latencyRequest->StartAsync();
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+    batchRequest->Wait(InferRequest::WaitMode::RESULT_READY);
+    latencyRequest->Wait(InferRequest::WaitMode::RESULT_READY);
+    ASSERT_EQ(order, (std::vector<std::string>{"latency", "batch"}));
+}
@@ -10,9 +10,11 @@
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -403,6 +405,57 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    auto fun1 = create_simple_function();
+    auto fun2 = create_simple_function();
+    auto fun3 = create_simple_function();
+    auto replaceConstant = [](const std::shared_ptr<ngraph::Function>& fun, int8_t value) {
+        for (const auto& op : fun->get_ops()) {
+            if (op->get_friendly_name() == "mul_constant") {
+                auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                constant->set_friendly_name("mul_constant");
+                constant->get_output_tensor(0).set_names({"mul_constant"});
+                ngraph::replace_node(op, constant);
+            }
+        }
+    };
+    replaceConstant(fun2, 4);
+    replaceConstant(fun3, 4);
+    ASSERT_NE(NetworkCompilationContext::computeHash(CNNNetwork(fun1), {}),
+              NetworkCompilationContext::computeHash(CNNNetwork(fun2), {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(CNNNetwork(fun2), {}),
+              NetworkCompilationContext::computeHash(CNNNetwork(fun3), {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithMappedWeights) {
+    // the constants inside the mapped weights are identified by the file identity and the offsets
+    std::vector<int8_t> weights1 = {1, 2, 3, 4};
+    std::vector<int8_t> weights2 = {5, 6, 7, 8};
+    auto createFunction = [](std::vector<int8_t>& weights, size_t offset, uint64_t identity) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{1, 2});
+        data->set_friendly_name("data");
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<void>>>(
+            reinterpret_cast<char*>(weights.data()) + offset, 2, nullptr);
+        auto constant = std::make_shared<ngraph::opset6::Constant>(ngraph::element::i8, ngraph::Shape{1, 2}, buffer);
+        constant->set_friendly_name("constant");
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        add->set_friendly_name("add");
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        res->set_friendly_name("res");
+        auto fun = std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+        fun->get_rt_info()["weights_mapping"] =
+            std::vector<uint64_t>{reinterpret_cast<uint64_t>(weights.data()), weights.size(), identity};
+        return CNNNetwork(fun);
+    };
+
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createFunction(weights1, 0, 1), {}),
+              NetworkCompilationContext::computeHash(createFunction(weights2, 0, 1), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createFunction(weights1, 0, 1), {}),
+              NetworkCompilationContext::computeHash(createFunction(weights1, 2, 1), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createFunction(weights1, 0, 1), {}),
+              NetworkCompilationContext::computeHash(createFunction(weights1, 0, 2), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -6,7 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <limits>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +48,48 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArraysMatchesScalar) {
+    // all the half-precision values, the tail is not a multiple of the vector size
+    std::vector<ie_fp16> src(65536 + 5);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    std::vector<float> dst(src.size());
+    InferenceEngine::PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        // the default bias turns the negative zero into the positive one
+        const float expected = InferenceEngine::PrecisionUtils::f16tof32(src[i]) * 1.f + 0.f;
+        ASSERT_EQ(0, std::memcmp(&expected, &dst[i], sizeof(float))) << "at " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArraysMatchesScalar) {
+    // the values around the half-precision range and the special cases
+    std::vector<float> src = {0.f,
+                              -0.f,
+                              std::numeric_limits<float>::infinity(),
+                              -std::numeric_limits<float>::infinity(),
+                              std::numeric_limits<float>::quiet_NaN(),
+                              std::numeric_limits<float>::max(),
+                              std::numeric_limits<float>::lowest(),
+                              std::numeric_limits<float>::denorm_min(),
+                              65504.f,
+                              65519.f,
+                              65520.f,
+                              6.1035156e-05f,
+                              3.0517578e-05f,
+                              3.0517576e-05f};
+    for (float value = -70000.f; value < 70000.f; value += 1.37f) {
+        src.push_back(value);
+    }
+    for (float value = 1e-8f; value < 1e-3f; value *= 1.01f) {
+        src.push_back(value);
+        src.push_back(-value);
+    }
+    std::vector<ie_fp16> dst(src.size());
+    InferenceEngine::PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        ASSERT_EQ(InferenceEngine::PrecisionUtils::f32tof16(src[i] * 1.f + 0.f), dst[i]) << "at " << i;
+    }
+}
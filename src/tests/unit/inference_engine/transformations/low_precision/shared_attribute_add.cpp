@@ -23,3 +23,14 @@ TEST(LPT_SharedAttribute, assign) {
     ASSERT_EQ(2ul, attribute1.attribute->sharedValue->getAttributes().size());
     ASSERT_EQ(2ul, attribute2.attribute->sharedValue->getAttributes().size());
 }
+
+TEST(LPT_SharedAttribute, addTwice) {
+    const auto attribute1 = ngraph::PrecisionPreservedAttribute();
+    const auto attribute2 = ngraph::PrecisionPreservedAttribute();
+
+    attribute1.attribute->sharedValue->addAttribute(attribute2.attribute);
+    attribute1.attribute->sharedValue->addAttribute(attribute2.attribute);
+    attribute1.attribute->sharedValue->addAttribute(attribute1.attribute);
+
+    ASSERT_EQ(2ul, attribute1.attribute->sharedValue->getAttributes().size());
+}
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+This script runs perftest_pipeline executable several times, aggregates the
+collected statistics and compares them with the references.
+
+Usage: ./run_perftest.py ../../bin/intel64/Release/perftest_pipeline -m model.xml -d CPU -hint THROUGHPUT
+"""
+
+import argparse
+import logging
+import os
+import statistics
+import sys
+import tempfile
+from pathlib import Path
+from pprint import pprint
+
+import yaml
+
+UTILS_DIR = os.path.join(os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__)))), "utils")
+sys.path.insert(0, str(UTILS_DIR))
+
+from proc_utils import cmd_exec
+from path_utils import check_positive_int
+
+# Define a range to cut outliers which are < Q1 − IQR_CUTOFF * IQR, and > Q3 + IQR_CUTOFF * IQR
+IQR_CUTOFF = 1.5
+
+# The allowed ratio of the current value to the reference one by the metric prefix, the longest matching prefix is
+# used. The metrics which are better when they are higher (the throughput) have the ratio less than 1, which is the
+# allowed minimum, the other ratios are the allowed maximum. The metrics without a threshold aren't compared.
+DEFAULT_THRESHOLDS = {
+    "time/": 1.2,
+    "memory/": 1.1,
+    "memory_statistics/": 1.1,
+    "peak_rss_kb": 1.1,
+    "jit_kernels": 1.0,
+    "steady_state/throughput_fps": 0.9,
+    "steady_state/latency_": 1.2,
+}
+
+
+def filter_outliers(values: list):
+    """Remove the values outside of the interquartile range widened by IQR_CUTOFF"""
+    if len(values) < 4:
+        return values
+    quartiles = statistics.quantiles(values, n=4)
+    cut_off = (quartiles[2] - quartiles[0]) * IQR_CUTOFF
+    filtered = [x for x in values if quartiles[0] - cut_off <= x <= quartiles[2] + cut_off]
+    return filtered if filtered else values
+
+
+def aggregate_stats(stats: dict):
+    """Aggregate provided statistics, the median is used as the value to compare being robust to the outliers"""
+    aggregated = {}
+    for name, values in stats.items():
+        values = filter_outliers(values)
+        aggregated[name] = {"median": statistics.median(values),
+                            "stdev": statistics.stdev(values) if len(values) > 1 else 0}
+    return aggregated
+
+
+def prepare_executable_cmd(args: dict):
+    """Generate common part of cmd from arguments to execute"""
+    return [
+        str(args["executable"].resolve(strict=True)),
+        "-m", str(args["model"].resolve(strict=True)),
+        "-d", args["device"],
+        "-hint", args["hint"],
+        "-t", str(args["time"]),
+    ]
+
+
+def run_perftest(args: dict, log=None):
+    """Run provided executable several times and aggregate collected statistics"""
+    if log is None:
+        log = logging.getLogger("run_perftest")
+
+    cmd_common = prepare_executable_cmd(args)
+
+    stats = {}
+    for run_iter in range(args["niter"]):
+        tmp_stats_path = tempfile.NamedTemporaryFile().name
+        retcode, msg = cmd_exec(cmd_common + ["-s", str(tmp_stats_path)], log=log)
+        if retcode != 0:
+            log.error(f"Run of executable '{args['executable']}' failed with return code '{retcode}'. Error: {msg}\n"
+                      f"Statistics aggregation is skipped.")
+            return retcode, msg, {}, {}
+
+        with open(tmp_stats_path, "r") as file:
+            raw_data = yaml.safe_load(file)
+        os.unlink(tmp_stats_path)
+        log.debug(f"Statistics after run of executable #{run_iter}: {raw_data}")
+
+        for name, value in raw_data.items():
+            stats.setdefault(name, []).append(value)
+
+    aggregated_stats = aggregate_stats(stats)
+    log.debug(f"Aggregated statistics after full run: {aggregated_stats}")
+    return 0, "", aggregated_stats, stats
+
+
+def get_threshold(metric: str, thresholds: dict):
+    """Return the threshold of the longest prefix matching the metric, None if there is no such prefix"""
+    prefixes = [prefix for prefix in thresholds if metric.startswith(prefix)]
+    return thresholds[max(prefixes, key=len)] if prefixes else None
+
+
+def compare_with_references(aggr_stats: dict, references: dict, thresholds: dict = None, log=None):
+    """Compare the medians with the references, return the list of the failed metrics"""
+    if log is None:
+        log = logging.getLogger("run_perftest")
+    thresholds = {**DEFAULT_THRESHOLDS, **(thresholds or {})}
+
+    failed = []
+    for metric, reference in references.items():
+        threshold = get_threshold(metric, thresholds)
+        if threshold is None:
+            continue
+        if metric not in aggr_stats:
+            log.error(f"Metric '{metric}' has the reference but isn't reported")
+            failed.append(metric)
+            continue
+        current = aggr_stats[metric]["median"]
+        passed = current >= reference * threshold if threshold < 1 else current <= reference * threshold
+        message = f"'{metric}': reference {reference}, current {current}, allowed ratio {threshold}"
+        if passed:
+            log.info(f"Comparison passed for {message}")
+        else:
+            log.error(f"Comparison failed for {message}")
+            failed.append(metric)
+    return failed
+
+
+def cli_parser():
+    """parse command-line arguments"""
+    parser = argparse.ArgumentParser(description="Run perftest_pipeline executable")
+    parser.add_argument("executable",
+                        type=Path,
+                        help="Binary to execute")
+    parser.add_argument("-m",
+                        required=True,
+                        dest="model",
+                        type=Path,
+                        help="Path to an .xml/.onnx file with a trained model")
+    parser.add_argument("-d",
+                        required=True,
+                        dest="device",
+                        type=str,
+                        help="Target device to infer on")
+    parser.add_argument("-hint",
+                        default="LATENCY",
+                        choices=["LATENCY", "THROUGHPUT"],
+                        help="Performance hint the model is compiled with")
+    parser.add_argument("-t",
+                        dest="time",
+                        default=10,
+                        type=check_positive_int,
+                        help="Duration of the steady state inference in seconds")
+    parser.add_argument("-niter",
+                        default=5,
+                        type=check_positive_int,
+                        help="Number of times to execute binary to aggregate statistics of")
+    parser.add_argument("-s",
+                        dest="stats_path",
+                        type=Path,
+                        help="Path to a file to save aggregated statistics")
+    parser.add_argument("-r",
+                        dest="references_path",
+                        type=Path,
+                        help="Path to a YAML file with the references ('metric: value') to compare with")
+
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    args = cli_parser()
+
+    logging.basicConfig(format="[ %(levelname)s ] %(message)s",
+                        level=logging.DEBUG, stream=sys.stdout)
+
+    exit_code, _, aggr_stats, _ = run_perftest(
+        dict(args._get_kwargs()), log=logging)  # pylint: disable=protected-access
+    if args.stats_path:
+        with open(args.stats_path, "w") as file:
+            yaml.safe_dump(aggr_stats, file)
+        logging.info(f"Aggregated statistics saved to a file: '{args.stats_path.resolve()}'")
+    else:
+        logging.info("Aggregated statistics:")
+        pprint(aggr_stats)
+
+    if exit_code == 0 and args.references_path:
+        with open(args.references_path, "r") as file:
+            references = yaml.safe_load(file) or {}
+        if compare_with_references(aggr_stats, references, log=logging):
+            exit_code = 1
+
+    sys.exit(exit_code)
+
+
+def test_compare_with_references():
+    aggr_stats = {"time/compile_model_us": {"median": 110}, "steady_state/throughput_fps": {"median": 80},
+                  "steady_state/iterations": {"median": 1}}
+    references = {"time/compile_model_us": 100, "steady_state/throughput_fps": 100, "steady_state/iterations": 100}
+    assert compare_with_references(aggr_stats, references) == ["steady_state/throughput_fps"]
+    assert compare_with_references(aggr_stats, references, {"time/": 1.05}) == ["time/compile_model_us",
+                                                                               "steady_state/throughput_fps"]
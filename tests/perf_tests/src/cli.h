@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+#include <string>
+
+/// @brief message for help argument
+static const char help_message[] =
+        "Print a usage message.";
+
+/// @brief message for model argument
+static const char model_message[] =
+        "Required. Path to an .xml/.onnx file with a trained model.";
+
+/// @brief message for target device argument
+static const char target_device_message[] =
+        "Required. Specify a target device to infer on.";
+
+/// @brief message for performance hint argument
+static const char hint_message[] =
+        "Not required. Performance hint the model is compiled with: LATENCY or THROUGHPUT. Default: LATENCY.";
+
+/// @brief message for steady state duration argument
+static const char time_message[] =
+        "Not required. Duration of the steady state inference in seconds. Default: 10.";
+
+/// @brief message for statistics path argument
+static const char statistics_path_message[] =
+        "Required. Path to a file to write statistics.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set target device to infer on <br>
+/// It is a required parameter
+DEFINE_string(d, "", target_device_message);
+
+/// @brief Define parameter for set performance hint <br>
+/// It is a non-required parameter
+DEFINE_string(hint, "LATENCY", hint_message);
+
+/// @brief Define parameter for set steady state duration <br>
+/// It is a non-required parameter
+DEFINE_uint32(t, 10, time_message);
+
+/// @brief Define parameter for set path to a file to write statistics <br>
+/// It is a required parameter
+DEFINE_string(s, "", statistics_path_message);
+
+/**
+ * @brief This function show a help message
+ */
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "PerfTestPipeline [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h, --help           " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"        " << model_message << std::endl;
+    std::cout << "    -d \"<device>\"      " << target_device_message << std::endl;
+    std::cout << "    -hint \"<hint>\"     " << hint_message << std::endl;
+    std::cout << "    -t \"<seconds>\"     " << time_message << std::endl;
+    std::cout << "    -s \"<path>\"        " << statistics_path_message << std::endl;
+}
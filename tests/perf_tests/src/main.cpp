@@ -0,0 +1,255 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// The pipeline runs the model through the read -> compile -> first inference -> steady state phases and writes the
+// statistics of the run to a flat YAML file: the duration and the process memory of each phase, the number of the
+// kernels generated, the memory of the compiled model and the steady state throughput and latency under the hint.
+
+#include <openvino/runtime/core.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+#include "cli.h"
+#include "common_utils.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Keeps the statistics in the order they are recorded
+ */
+class Statistics {
+public:
+    void add(const std::string& name, double value) {
+        records.emplace_back(name, value);
+    }
+
+    void write(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file.good())
+            throw std::runtime_error("Statistic file \"" + path + "\" can't be used for writing");
+        for (const auto& record : records)
+            file << record.first << ": " << record.second << '\n';
+    }
+
+private:
+    std::vector<std::pair<std::string, double>> records;
+};
+
+#ifdef _WIN32
+size_t getVmRSSInKB() {
+    PROCESS_MEMORY_COUNTERS pmc;
+    pmc.cb = sizeof(pmc);
+    GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb);
+    return pmc.WorkingSetSize / 1024;
+}
+
+size_t getVmHWMInKB() {
+    PROCESS_MEMORY_COUNTERS pmc;
+    pmc.cb = sizeof(pmc);
+    GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb);
+    return pmc.PeakWorkingSetSize / 1024;
+}
+#else
+size_t getSystemDataByName(const char* name) {
+    FILE* file = fopen("/proc/self/status", "r");
+    size_t result = 0;
+    if (file != nullptr) {
+        char line[128];
+        while (fgets(line, sizeof(line), file) != nullptr) {
+            if (strncmp(line, name, strlen(name)) == 0) {
+                result = std::strtoull(line + strlen(name), nullptr, 10);
+                break;
+            }
+        }
+        fclose(file);
+    }
+    return result;
+}
+
+size_t getVmRSSInKB() {
+    return getSystemDataByName("VmRSS:");
+}
+
+size_t getVmHWMInKB() {
+    return getSystemDataByName("VmHWM:");
+}
+#endif
+
+/**
+ * @brief Measures the duration of the phase and the process memory at its end
+ */
+class Phase {
+public:
+    Phase(Statistics& statistics, std::string name)
+        : statistics(statistics), name(std::move(name)), start(Clock::now()) {}
+
+    ~Phase() {
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+        statistics.add("time/" + name + "_us", static_cast<double>(duration.count()));
+        statistics.add("memory/" + name + "/vmrss_kb", static_cast<double>(getVmRSSInKB()));
+        statistics.add("memory/" + name + "/vmhwm_kb", static_cast<double>(getVmHWMInKB()));
+    }
+
+private:
+    Statistics& statistics;
+    std::string name;
+    Clock::time_point start;
+};
+
+double toMilliseconds(Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
+double percentile(std::vector<double> values, double fraction) {
+    if (values.empty())
+        return 0.;
+    const auto index = static_cast<size_t>(fraction * (values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+/**
+ * @brief Records the plugin counters of the compiled model, the ones the device doesn't report are skipped
+ */
+void addCompiledModelStatistics(Statistics& statistics, const ov::CompiledModel& compiledModel) {
+    // the primitives created through the runtime cache of the CPU plugin are its JIT kernels
+    try {
+        auto cacheStats = compiledModel.get_property("CPU_RUNTIME_CACHE_STATS").as<std::map<std::string, uint64_t>>();
+        statistics.add("jit_kernels", static_cast<double>(cacheStats["misses"]));
+    } catch (const std::exception&) {
+    }
+    try {
+        for (const auto& stat : compiledModel.get_property(ov::memory_statistics)) {
+            if (stat.first.find("/total/") != std::string::npos)
+                statistics.add("memory_statistics/" + stat.first, static_cast<double>(stat.second));
+        }
+    } catch (const std::exception&) {
+    }
+}
+
+void runSteadyState(Statistics& statistics,
+                    ov::CompiledModel& compiledModel,
+                    const std::vector<ov::Output<const ov::Node>>& inputs,
+                    std::chrono::seconds duration) {
+    const auto requestsCount = std::max(1u, compiledModel.get_property(ov::optimal_number_of_infer_requests));
+    std::vector<ov::InferRequest> requests;
+    for (uint32_t i = 0; i < requestsCount; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        auto requestInputs = inputs;
+        fillTensors(requests.back(), requestInputs);
+    }
+
+    // the requests are waited in the order they were started, so each latency includes the time its result waited for
+    // the results of the requests started earlier, like the application processing the results in order would see it
+    std::vector<double> latencies;
+    std::vector<Clock::time_point> starts(requests.size());
+    const auto begin = Clock::now();
+    for (size_t i = 0; i < requests.size(); i++) {
+        starts[i] = Clock::now();
+        requests[i].start_async();
+    }
+    const auto deadline = begin + duration;
+    while (Clock::now() < deadline) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            const auto now = Clock::now();
+            latencies.push_back(toMilliseconds(now - starts[i]));
+            starts[i] = now;
+            requests[i].start_async();
+        }
+    }
+    for (auto& request : requests) {
+        request.wait();
+    }
+    const auto elapsed = toMilliseconds(Clock::now() - begin);
+
+    statistics.add("steady_state/requests", static_cast<double>(requests.size()));
+    statistics.add("steady_state/iterations", static_cast<double>(latencies.size()));
+    statistics.add("steady_state/throughput_fps", elapsed > 0. ? latencies.size() * 1000. / elapsed : 0.);
+    statistics.add("steady_state/latency_median_ms", percentile(latencies, 0.5));
+    statistics.add("steady_state/latency_p90_ms", percentile(latencies, 0.9));
+    statistics.add("memory/steady_state/vmrss_kb", static_cast<double>(getVmRSSInKB()));
+    statistics.add("memory/steady_state/vmhwm_kb", static_cast<double>(getVmHWMInKB()));
+}
+
+void runPipeline(Statistics& statistics) {
+    ov::Core core;
+    const auto hint = FLAGS_hint == "THROUGHPUT" ? ov::hint::PerformanceMode::THROUGHPUT
+                                                 : ov::hint::PerformanceMode::LATENCY;
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+    ov::InferRequest inferRequest;
+    std::vector<ov::Output<const ov::Node>> inputs;
+
+    const auto begin = Clock::now();
+    {
+        Phase phase(statistics, "read_model");
+        model = core.read_model(FLAGS_m);
+    }
+    {
+        Phase phase(statistics, "compile_model");
+        compiledModel = core.compile_model(model, FLAGS_d, ov::hint::performance_mode(hint));
+    }
+    {
+        inferRequest = compiledModel.create_infer_request();
+        inputs = compiledModel.inputs();
+        fillTensors(inferRequest, inputs);
+        Phase phase(statistics, "first_inference");
+        inferRequest.infer();
+    }
+    const auto timeToFirstInference = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin);
+    statistics.add("time/time_to_first_inference_us", static_cast<double>(timeToFirstInference.count()));
+    addCompiledModelStatistics(statistics, compiledModel);
+
+    runSteadyState(statistics, compiledModel, inputs, std::chrono::seconds(FLAGS_t));
+    statistics.add("peak_rss_kb", static_cast<double>(getVmHWMInKB()));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        return 0;
+    }
+    if (FLAGS_m.empty() || FLAGS_d.empty() || FLAGS_s.empty()) {
+        std::cerr << "The model (-m), the device (-d) and the statistics path (-s) are required\n";
+        showUsage();
+        return -1;
+    }
+    if (FLAGS_hint != "LATENCY" && FLAGS_hint != "THROUGHPUT") {
+        std::cerr << "Unknown performance hint: " << FLAGS_hint << "\n";
+        return -1;
+    }
+
+    Statistics statistics;
+    try {
+        runPipeline(statistics);
+    } catch (const std::exception& ex) {
+        std::cerr << "The pipeline failed with exception:\n" << ex.what();
+        return 2;
+    } catch (...) {
+        std::cerr << "The pipeline failed\n";
+        return 3;
+    }
+    statistics.write(FLAGS_s);
+    return 0;
+}
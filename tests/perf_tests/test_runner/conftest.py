@@ -0,0 +1,181 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+"""
+Basic high-level plugin file for pytest.
+See [Writing plugins](https://docs.pytest.org/en/latest/writing_plugins.html)
+for more information.
+This plugin adds the following command-line options:
+* `--test_conf` - Path to test configuration file. Used to parametrize tests.
+  Format: YAML file.
+* `--exe` - Path to a perftest binary to execute.
+* `--niter` - Number of times to run executable.
+* `--time` - Duration of the steady state inference in seconds.
+* `--dump_refs` - Path to a test configuration file to save the collected medians as the references to.
+"""
+
+import json
+import logging
+# pylint:disable=import-error
+import os
+import sys
+import tempfile
+from pathlib import Path
+
+import pytest
+import yaml
+from jsonschema import validate, ValidationError
+
+# add utils folder to imports
+UTILS_DIR = os.path.join(os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__)))), "utils")
+sys.path.insert(0, str(UTILS_DIR))
+
+from path_utils import check_positive_int
+
+# -------------------- CLI options --------------------
+
+
+def pytest_addoption(parser):
+    """Specify command-line options for all plugins"""
+    test_args_parser = parser.getgroup("perftest test run")
+    test_args_parser.addoption(
+        "--test_conf",
+        type=Path,
+        help="Path to a test config",
+        default=Path(__file__).parent / "test_config.yml"
+    )
+    test_args_parser.addoption(
+        "--exe",
+        required=True,
+        dest="executable",
+        type=Path,
+        help="Path to a perftest binary to execute"
+    )
+    test_args_parser.addoption(
+        "--niter",
+        type=check_positive_int,
+        help="Number of iterations to run executable and aggregate results",
+        default=5
+    )
+    test_args_parser.addoption(
+        "--time",
+        type=check_positive_int,
+        help="Duration of the steady state inference in seconds",
+        default=10
+    )
+    test_args_parser.addoption(
+        "--dump_refs",
+        type=Path,
+        help="Path to a test config to save the collected medians as the references to"
+    )
+
+
+@pytest.fixture(scope="session")
+def executable(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('executable')
+
+
+@pytest.fixture(scope="session")
+def niter(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('niter')
+
+
+@pytest.fixture(scope="session")
+def steady_time(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('time')
+
+
+# -------------------- CLI options --------------------
+
+
+@pytest.fixture(scope="function")
+def temp_dir(pytestconfig):
+    """Create temporary directory for test purposes.
+    It will be cleaned up after every test run.
+    """
+    temp_dir = tempfile.TemporaryDirectory()
+    yield Path(temp_dir.name)
+    temp_dir.cleanup()
+
+
+@pytest.fixture(scope="function")
+def validate_test_case(request):
+    """Fixture for validating test case on correctness.
+    Fixture checks current test case contains all fields required for
+    a correct work.
+    """
+    schema = """
+    {
+        "type": "object",
+        "properties": {
+            "device": {
+                "type": "object",
+                "properties": {
+                    "name": {"type": "string"}
+                },
+                "required": ["name"]
+            },
+            "model": {
+                "type": "object",
+                "properties": {
+                    "path": {"type": "string"}
+                },
+                "required": ["path"]
+            },
+            "hint": {"enum": ["LATENCY", "THROUGHPUT"]},
+            "references": {"type": "object"},
+            "thresholds": {"type": "object"}
+        },
+        "required": ["device", "model"],
+        "additionalProperties": true
+    }
+    """
+    schema = json.loads(schema)
+    validate(instance=request.node.funcargs["instance"], schema=schema)
+    yield
+
+
+def pytest_generate_tests(metafunc):
+    """Pytest hook for test generation.
+    Generate parameterized tests from discovered modules and test config
+    parameters.
+    """
+    with open(metafunc.config.getoption('test_conf'), "r") as file:
+        test_cases = yaml.safe_load(file)
+    if test_cases:
+        metafunc.config.test_cases = test_cases
+        metafunc.parametrize("instance", test_cases)
+
+
+def pytest_make_parametrize_id(config, val, argname):
+    """Pytest hook for user-friendly test name representation"""
+    return "-".join([f"device_{val['device']['name']}",
+                     f"model_{val['model'].get('name', Path(val['model']['path']).stem)}",
+                     f"hint_{val.get('hint', 'LATENCY')}"])
+
+
+@pytest.fixture(scope="function")
+def save_references(request, instance):
+    """Fixture storing the medians collected by the test as the references of its test case.
+    The test cases are shared objects of the session, so the test config with the new references is dumped
+    once all the tests are finished.
+    """
+    results = {}
+    yield results
+    if request.config.getoption("dump_refs") and results:
+        instance["references"] = {name: stat["median"] for name, stat in results.items()}
+
+
+def pytest_sessionfinish(session):
+    """Pytest hook for the session teardown.
+    Dump the test config with the collected references if requested.
+    """
+    dump_refs = session.config.getoption("dump_refs")
+    test_cases = getattr(session.config, "test_cases", None)
+    if dump_refs and test_cases:
+        with open(dump_refs, "w") as file:
+            yaml.safe_dump(test_cases, file, sort_keys=False)
+        logging.info(f"Test config with the references saved to a file: '{dump_refs.resolve()}'")
@@ -0,0 +1,73 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""Main entry-point to run perftests tests.
+
+Default run:
+$ pytest test_perftest.py --exe ../../bin/intel64/Release/perftest_pipeline
+
+Options[*]:
+--test_conf     Path to test config
+--exe           Path to perftest binary to execute
+--niter         Number of times to run executable
+--time          Duration of the steady state inference in seconds
+--dump_refs     Path to save the test config with the collected references to
+
+[*] For more information see conftest.py
+"""
+
+from pathlib import Path
+import logging
+import os
+import shutil
+import sys
+
+# add utils folder to imports
+UTILS_DIR = os.path.join(os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__)))), "utils")
+sys.path.insert(0, str(UTILS_DIR))
+
+from path_utils import expand_env_vars
+
+PERF_TESTS_DIR = os.path.dirname(os.path.dirname(__file__))
+sys.path.append(PERF_TESTS_DIR)
+
+from scripts.run_perftest import run_perftest, compare_with_references
+
+
+def test_perftest(instance, executable, niter, steady_time, temp_dir, validate_test_case, save_references):
+    """Parameterized test.
+
+    :param instance: test instance. Should not be changed during test run
+    :param executable: perftest executable to run
+    :param niter: number of times to run executable
+    :param steady_time: duration of the steady state inference in seconds
+    :param temp_dir: path to a temporary directory. Will be cleaned up after test run
+    :param validate_test_case: custom pytest fixture. Should be declared as test argument to be enabled
+    :param save_references: custom pytest fixture collecting the medians to dump as the references
+    """
+    # Prepare model to get model_path
+    model_path = instance["model"].get("path")
+    assert model_path, "Model path is empty"
+    model_path = Path(expand_env_vars(model_path))
+
+    # Copy model to a local temporary directory
+    model_dir = temp_dir / "model"
+    shutil.copytree(model_path.parent, model_dir)
+    model_path = model_dir / model_path.name
+
+    # Run executable
+    exe_args = {
+        "executable": Path(executable),
+        "model": Path(model_path),
+        "device": instance["device"]["name"],
+        "hint": instance.get("hint", "LATENCY"),
+        "time": steady_time,
+        "niter": niter,
+    }
+    retcode, msg, aggr_stats, _ = run_perftest(exe_args, log=logging)
+    assert retcode == 0, f"Run of executable failed: {msg}"
+    save_references.update(aggr_stats)
+
+    failed = compare_with_references(aggr_stats, instance.get("references") or {}, instance.get("thresholds"),
+                                     log=logging)
+    assert not failed, f"Performance regressed for the metrics: {failed}"
@@ -6,7 +6,10 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -76,6 +79,17 @@ static constexpr char ioml_message[] =
 "                                             Notice that quotes are required.\n"
 "                                             Overwrites layout from il and ol options for specified layers.";
 
+static constexpr char cache_dir_message[] =
+                                             "Optional. Compile the models into the model cache directory (ov::cache_dir)\n"
+"                                             instead of exporting the blob, so the application setting the same cache\n"
+"                                             directory imports them on the first load. In this mode -m, -d and -c accept\n"
+"                                             the lists separated with ';' and each model is compiled for each device with\n"
+"                                             each configuration.";
+
+static constexpr char nthreads_message[] =
+                                             "Optional. Number of the models compiled in parallel with -cache_dir.\n"
+"                                             Default value: the number of the hardware threads.";
+
 static constexpr char api1_message[] =
                                              "Optional. Compile model to legacy format for usage in Inference Engine API,\n"
 "                                             by default compiles to OV 2.0 API";
@@ -111,6 +125,8 @@ DEFINE_string(iol, "", iol_message);
 DEFINE_string(iml, "", inputs_model_layout_message);
 DEFINE_string(oml, "", outputs_model_layout_message);
 DEFINE_string(ioml, "", ioml_message);
+DEFINE_string(cache_dir, "", cache_dir_message);
+DEFINE_uint32(nthreads, 0, nthreads_message);
 DEFINE_bool(ov_api_1_0, false, api1_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
@@ -373,10 +389,11 @@ bool isFP32(const ov::element::Type& type) {
 }
 
 static void setDefaultIO(ov::preprocess::PrePostProcessor& preprocessor,
+                         const std::string& device,
                          const std::vector<ov::Output<ov::Node>>& inputs,
                          const std::vector<ov::Output<ov::Node>>& outputs) {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    const bool isVPUX = FLAGS_d.find("VPUX") != std::string::npos;
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    const bool isVPUX = device.find("VPUX") != std::string::npos;
 
     if (isMYRIAD) {
         for (size_t i = 0; i < inputs.size(); i++) {
@@ -402,6 +419,7 @@ static void setDefaultIO(ov::preprocess::PrePostProcessor& preprocessor,
 }
 
 void configurePrePostProcessing(std::shared_ptr<ov::Model>& model,
+    const std::string& device,
     const std::string& ip,
     const std::string& op,
     const std::string& iop,
@@ -414,7 +432,7 @@ void configurePrePostProcessing(std::shared_ptr<ov::Model>& model,
     auto preprocessor = ov::preprocess::PrePostProcessor(model);
     const auto inputs = model->inputs();
     const auto outputs = model->outputs();
-    setDefaultIO(preprocessor, inputs, outputs);
+    setDefaultIO(preprocessor, device, inputs, outputs);
 
     if (!ip.empty()) {
         auto type = getType(ip);
@@ -588,6 +606,8 @@ static void showUsage() {
     std::cout << "    -iml                         <value>     "   << inputs_model_layout_message  << std::endl;
     std::cout << "    -oml                         <value>     "   << outputs_model_layout_message << std::endl;
     std::cout << "    -ioml                       \"<value>\"    "   << ioml_message               << std::endl;
+    std::cout << "    -cache_dir                   <value>     "   << cache_dir_message            << std::endl;
+    std::cout << "    -nthreads                    <value>     "   << nthreads_message             << std::endl;
     std::cout << "    -ov_api_1_0                              "   << api1_message                 << std::endl;
     std::cout                                                                                      << std::endl;
     std::cout << " MYRIAD-specific options:                    "                                   << std::endl;
@@ -613,6 +633,10 @@ static bool parseCommandLine(int* argc, char*** argv) {
         throw std::invalid_argument("Target device name is required");
     }
 
+    if (!FLAGS_cache_dir.empty() && (FLAGS_ov_api_1_0 || !FLAGS_o.empty())) {
+        throw std::invalid_argument("-cache_dir can't be used with -ov_api_1_0 or -o");
+    }
+
     if (1 < *argc) {
         std::stringstream message;
         message << "Unknown arguments: ";
@@ -628,10 +652,10 @@ static bool parseCommandLine(int* argc, char*** argv) {
     return true;
 }
 
-static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+static std::map<std::string, std::string> parseConfigFile(const std::string& path, char comment = '#') {
     std::map<std::string, std::string> config;
 
-    std::ifstream file(FLAGS_c);
+    std::ifstream file(path);
     if (file.is_open()) {
         std::string option;
         while (std::getline(file, option)) {
@@ -650,9 +674,9 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
     return config;
 }
 
-static std::map<std::string, std::string> configure() {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    auto config = parseConfigFile();
+static std::map<std::string, std::string> configure(const std::string& device, const std::string& configPath) {
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    auto config = parseConfigFile(configPath);
 
     if (isMYRIAD) {
         if (!FLAGS_VPU_NUMBER_OF_SHAVES.empty()) {
@@ -733,6 +757,110 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+struct CompileJob {
+    std::string model;
+    std::string device;
+    std::string config;
+};
+
+// Compiles each model of the -m list for each device of the -d list with each configuration of the -c list into the
+// cache directory. The compilations share the core and run in parallel, the failed ones don't stop the others.
+static int compileToCache() {
+    const auto models = splitStringList(FLAGS_m, ';');
+    const auto devices = splitStringList(FLAGS_d, ';');
+    auto configPaths = splitStringList(FLAGS_c, ';');
+    if (configPaths.empty()) {
+        configPaths.emplace_back();
+    }
+
+    std::vector<CompileJob> jobs;
+    for (auto&& model : models) {
+        for (auto&& device : devices) {
+            for (auto&& configPath : configPaths) {
+                jobs.push_back({model, device, configPath});
+            }
+        }
+    }
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(FLAGS_cache_dir));
+    for (auto&& device : devices) {
+        if (!FLAGS_log_level.empty()) {
+            ov::log::Level level;
+            std::stringstream{FLAGS_log_level} >> level;
+            core.set_property(device, ov::log::level(level));
+        }
+        // the core compiles the model without caching it if the device can't export it
+        bool exportSupported = false;
+        try {
+            exportSupported = core.get_property(device, METRIC_KEY(IMPORT_EXPORT_SUPPORT)).as<bool>();
+        } catch (const std::exception&) {
+            try {
+                const auto capabilities = core.get_property(device, ov::device::capabilities);
+                exportSupported = std::find(capabilities.begin(), capabilities.end(),
+                                            ov::device::capability::EXPORT_IMPORT) != capabilities.end();
+            } catch (const std::exception&) {
+                exportSupported = true;
+            }
+        }
+        if (!exportSupported) {
+            std::cout << "[ WARNING ] " << device << " doesn't support the model caching" << std::endl;
+        }
+    }
+
+    // the blobs of the models compiled from the file are keyed by the path, so they are preprocessed only if asked
+    const bool prePostProcessing = !FLAGS_ip.empty() || !FLAGS_op.empty() || !FLAGS_iop.empty() ||
+                                   !FLAGS_il.empty() || !FLAGS_ol.empty() || !FLAGS_iol.empty() ||
+                                   !FLAGS_iml.empty() || !FLAGS_oml.empty() || !FLAGS_ioml.empty();
+
+    size_t nthreads = FLAGS_nthreads != 0 ? FLAGS_nthreads : std::thread::hardware_concurrency();
+    nthreads = std::max<size_t>(1, std::min(nthreads, jobs.size()));
+
+    std::atomic<size_t> nextJob{0};
+    std::atomic<size_t> failedJobs{0};
+    std::mutex outputMutex;
+    auto worker = [&] {
+        for (auto i = nextJob++; i < jobs.size(); i = nextJob++) {
+            const auto& job = jobs[i];
+            const auto name = job.model + " for " + job.device + (job.config.empty() ? "" : " with " + job.config);
+            try {
+                const auto start = std::chrono::steady_clock::now();
+                const auto config = configure(job.device, job.config);
+                const ov::AnyMap properties{config.begin(), config.end()};
+                if (prePostProcessing) {
+                    auto model = core.read_model(job.model);
+                    configurePrePostProcessing(model, job.device, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol,
+                                               FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
+                    core.compile_model(model, job.device, properties);
+                } else {
+                    core.compile_model(job.model, job.device, properties);
+                }
+                const auto elapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - start);
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                std::cout << "Compiled " << name << " in " << elapsed.count() << " ms" << std::endl;
+            } catch (const std::exception& error) {
+                failedJobs++;
+                std::lock_guard<std::mutex> lock(outputMutex);
+                std::cerr << "Failed to compile " << name << ": " << error.what() << std::endl;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < nthreads; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    std::cout << "Done. " << jobs.size() - failedJobs << " of " << jobs.size() << " models are compiled to "
+              << FLAGS_cache_dir << std::endl;
+    return failedJobs == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int main(int argc, char* argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
 
@@ -747,6 +875,9 @@ int main(int argc, char* argv[]) {
         if (!parseCommandLine(&argc, &argv)) {
             return EXIT_SUCCESS;
         }
+        if (!FLAGS_cache_dir.empty()) {
+            return compileToCache();
+        }
         if (FLAGS_ov_api_1_0) {
             InferenceEngine::Core ie;
             if (!FLAGS_log_level.empty()) {
@@ -762,7 +893,7 @@ int main(int argc, char* argv[]) {
             printInputAndOutputsInfo(network);
 
             auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure());
+            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure(FLAGS_d, FLAGS_c));
             loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
 
             std::string outputName = FLAGS_o;
@@ -787,10 +918,10 @@ int main(int argc, char* argv[]) {
 
             auto model = core.read_model(FLAGS_m);
 
-            configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
+            configurePrePostProcessing(model, FLAGS_d, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
             printInputAndOutputsInfoShort(*model);
             auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto configs = configure();
+            auto configs = configure(FLAGS_d, FLAGS_c);
             auto compiledModel = core.compile_model(model, FLAGS_d, {configs.begin(), configs.end()});
             loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
             std::string outputName = FLAGS_o;